@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 template <typename K, typename V>
 class HashMap :
     public ReferenceTracker<
@@ -15,7 +17,25 @@ class HashMap :
     typedef typename tracker_ref<V> V_storage;
     typedef typename winrt::IKeyValuePair<K, V> KVP;
 
-    typedef typename std::map<K_storage, V_storage>::const_iterator T_iterator;
+    // Keys are hashed on the value they hold, so lookups don't have to walk the map.
+    struct KeyHash
+    {
+        size_t operator()(const K_storage& key) const
+        {
+            return std::hash<K>{}(key.get());
+        }
+    };
+
+    struct KeyEqual
+    {
+        bool operator()(const K_storage& lhs, const K_storage& rhs) const
+        {
+            return lhs.get() == rhs.get();
+        }
+    };
+
+    typedef typename std::unordered_map<K_storage, V_storage, KeyHash, KeyEqual> T_map;
+    typedef typename T_map::const_iterator T_iterator;
 
 public:
 #pragma region IMap(View)<K, V> interface
@@ -50,15 +70,16 @@ public:
     bool Insert(K const& key, V const& value)
     {
         ++m_mutationCount;
-        auto it = FindKey(key);
+        K_storage keyStorage{ this, key };
+        auto it = m_map.find(keyStorage);
         bool found = (it != m_map.end());
         if (found)
         {
-            it->second = tracker_ref<V>{ this, value };
+            it->second.set(value);
         }
         else
         {
-            m_map.insert(std::make_pair(tracker_ref<K>{ this, key }, tracker_ref<V>{ this, value }));
+            m_map.emplace(std::move(keyStorage), V_storage{ this, value });
         }
 
         return found;
@@ -113,7 +134,7 @@ public:
 private:
     auto FindKey(K const& key)
     {
-        return std::find_if(m_map.begin(), m_map.end(), [&key](const auto& entry) { return entry.first == key; });
+        return m_map.find(K_storage{ this, key });
     }
 
     class Iterator :
@@ -222,6 +243,6 @@ private:
         };
     };
 
-    std::map<K_storage, V_storage> m_map;
+    T_map m_map;
     unsigned int m_mutationCount = 0;
 };
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "VectorIterator.h"
 #include "VectorChangedEventArgs.h"
 #include <algorithm>
+#include <unordered_map>
 
 // Nearly all Vector need to set DependencyObjectBase flag 
 // to make DependencyObject as ComposableBase
@@ -16,7 +17,8 @@ enum class VectorFlag {
     Observable = 1, 
     DependencyObjectBase = 2, 
     Bindable = 4,
-    NoTrackerRef = 8
+    NoTrackerRef = 8,
+    HashedIndexOf = 16 // IndexOf uses an identity to index hash, only for reference types
 };
 
 template <VectorFlag first, VectorFlag ...others>
@@ -37,6 +39,7 @@ template <int flag> struct VectorFlagHelper
     static constexpr bool isDependencyObjectBase = !!(flag & static_cast<int>(VectorFlag::DependencyObjectBase));
     static constexpr bool isBindable = !!(flag & static_cast<int>(VectorFlag::Bindable));
     static constexpr bool isNoTrackerRef = !!(flag & static_cast<int>(VectorFlag::NoTrackerRef));
+    static constexpr bool isHashedIndexOf = !!(flag & static_cast<int>(VectorFlag::HashedIndexOf));
 };
 
 // TStorageWrapperImpl is used to do the data conversion from T <-> T_Storage
@@ -115,9 +118,9 @@ struct ObservableTraits<T, true, isBindable>
     
     using EventToken = typename winrt::event_token;
 
-    static void RaiseEvent(EventSource* e, SenderType sender, winrt::CollectionChange collectionChange, uint32_t index)
+    static void RaiseEvent(EventSource* e, SenderType sender, winrt::CollectionChange collectionChange, uint32_t index, uint32_t count)
     {
-        auto args = winrt::make<VectorChangedEventArgs>(collectionChange, index);
+        auto args = winrt::make<VectorChangedEventArgs>(collectionChange, index, count);
         (*e)(sender, args);
     }
     static winrt::event_token AddEventHandler(EventSource* e, EventHandler const& handler)
@@ -186,6 +189,7 @@ public:
         if (index < static_cast<uint32_t>(m_vector.size()))
         {
             m_vector[index] = wrap(value);
+            InvalidateIndexesFrom(index);
             RaiseChildrenChanged(winrt::CollectionChange::ItemChanged, index);
         }
         else
@@ -204,6 +208,14 @@ public:
     {
         index = 0;
 
+        if constexpr (std::is_base_of_v<winrt::Windows::Foundation::IUnknown, T_type>)
+        {
+            if (m_isHashedIndexOf)
+            {
+                return HashedIndexOf(value, index);
+            }
+        }
+
         auto it = std::find(m_vector.begin(), m_vector.end(), wrap(value));
 
         if (it != m_vector.end())
@@ -240,6 +252,7 @@ public:
         if (index <= static_cast<uint32_t>(m_vector.size()))
         {
             m_vector.insert(m_vector.begin() + index, wrap(value));
+            InvalidateIndexesFrom(index);
             RaiseChildrenChanged(winrt::CollectionChange::ItemInserted, index);
         }
         else
@@ -249,11 +262,38 @@ public:
         
     }
 
+    // Inserts all values at once and raises a single range ItemInserted instead of one per value.
+    void InsertRangeAt(uint32_t const index, std::vector<typename T_type> const& values)
+    {
+        if (index <= static_cast<uint32_t>(m_vector.size()))
+        {
+            if (values.empty())
+            {
+                return;
+            }
+
+            std::vector<T_Storage> wrappedValues;
+            wrappedValues.reserve(values.size());
+            for (auto const& value : values)
+            {
+                wrappedValues.push_back(wrap(value));
+            }
+            m_vector.insert(m_vector.begin() + index, std::make_move_iterator(wrappedValues.begin()), std::make_move_iterator(wrappedValues.end()));
+            InvalidateIndexesFrom(index);
+            RaiseChildrenChanged(winrt::CollectionChange::ItemInserted, index, static_cast<uint32_t>(values.size()));
+        }
+        else
+        {
+            throw winrt::hresult_out_of_bounds();
+        }
+    }
+
     void RemoveAt(uint32_t const index)
     {
         if (index < static_cast<uint32_t>(m_vector.size()))
         {
             m_vector.erase(m_vector.begin() + index);
+            InvalidateIndexesFrom(index);
             RaiseChildrenChanged(winrt::CollectionChange::ItemRemoved, index);
         }
         else
@@ -262,11 +302,32 @@ public:
         }
     }
 
+    // Removes count values at once and raises a single range ItemRemoved instead of one per value.
+    void RemoveRangeAt(uint32_t const index, uint32_t const count)
+    {
+        if (index <= static_cast<uint32_t>(m_vector.size()) && count <= static_cast<uint32_t>(m_vector.size()) - index)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            m_vector.erase(m_vector.begin() + index, m_vector.begin() + index + count);
+            InvalidateIndexesFrom(index);
+            RaiseChildrenChanged(winrt::CollectionChange::ItemRemoved, index, count);
+        }
+        else
+        {
+            throw winrt::hresult_out_of_bounds();
+        }
+    }
+
     void RemoveAtEnd()
     {
         if (!m_vector.empty())
         {
             m_vector.pop_back();
+            InvalidateIndexesFrom(static_cast<uint32_t>(m_vector.size()));
             RaiseChildrenChanged(winrt::CollectionChange::ItemRemoved, static_cast<uint32_t>(m_vector.size()));
         }
     }
@@ -274,6 +335,7 @@ public:
     void Clear()
     {
         m_vector.clear();
+        InvalidateIndexesFrom(0);
         RaiseChildrenChanged(winrt::CollectionChange::Reset, 0u);
     }
 
@@ -286,10 +348,58 @@ public:
         }
     }
 
-    virtual void RaiseChildrenChanged(winrt::CollectionChange collectionChange, unsigned int index) {};
+    // Replaces the content with values and raises a single Reset instead of a Reset plus one ItemInserted per value.
+    void AssignRange(winrt::array_view<T_type const> values)
+    {
+        m_vector.clear();
+        InvalidateIndexesFrom(0);
+        m_vector.reserve(values.size());
+        for (auto const& value : values)
+        {
+            m_vector.push_back(wrap(value));
+        }
+        RaiseChildrenChanged(winrt::CollectionChange::Reset, 0u);
+    }
+
+    // Holds back change notifications until the matching EndDeferVectorChanged, which raises a single
+    // Reset if the vector was modified in between. Calls can be nested.
+    void BeginDeferVectorChanged()
+    {
+        m_deferVectorChangedCount++;
+    }
+
+    void EndDeferVectorChanged()
+    {
+        MUX_ASSERT(m_deferVectorChangedCount > 0);
+        if (--m_deferVectorChangedCount == 0 && m_hasDeferredVectorChanged)
+        {
+            m_hasDeferredVectorChanged = false;
+            RaiseVectorChanged(winrt::CollectionChange::Reset, 0u, 0u);
+        }
+    }
 
     void reserve(unsigned int n) { m_vector.reserve(n); }
+
+    void EnableHashedIndexOf()
+    {
+        static_assert(std::is_base_of_v<winrt::Windows::Foundation::IUnknown, T_type>, "HashedIndexOf needs a reference type");
+        m_isHashedIndexOf = true;
+    }
 protected:
+    void RaiseChildrenChanged(winrt::CollectionChange collectionChange, unsigned int index, unsigned int count = 1)
+    {
+        if (m_deferVectorChangedCount > 0)
+        {
+            m_hasDeferredVectorChanged = true;
+        }
+        else
+        {
+            RaiseVectorChanged(collectionChange, index, count);
+        }
+    }
+
+    virtual void RaiseVectorChanged(winrt::CollectionChange collectionChange, unsigned int index, unsigned int count) {};
+
     using T_Storage = typename Wrapper::Holder;
 
     inline ITrackerHandleManager* GetTrackerHandlerManager() { return m_trackerHandleManager; }
@@ -304,6 +414,70 @@ protected:
 
     std::vector<T_Storage> m_vector;
     ITrackerHandleManager* m_trackerHandleManager{ nullptr };
+
+private:
+    static void* GetIdentity(typename T_type const& value)
+    {
+        return winrt::get_abi(value.try_as<winrt::Windows::Foundation::IUnknown>());
+    }
+
+    // m_indexes holds the index of the first occurrence of every value in [0, m_indexedCount).
+    // Other entries can be stale, so a hit is checked against the vector.
+    // A mutation only shrinks the indexed prefix, lookups of unindexed values extend it again.
+    bool HashedIndexOf(typename T_type const& value, uint32_t& index)
+    {
+        void* identity = GetIdentity(value);
+        auto it = m_indexes.find(identity);
+        if (it != m_indexes.end() && it->second < m_indexedCount && IsAt(it->second, identity))
+        {
+            index = it->second;
+            return true;
+        }
+
+        const auto size = static_cast<uint32_t>(m_vector.size());
+        while (m_indexedCount < size)
+        {
+            const uint32_t current = m_indexedCount++;
+            void* currentIdentity = GetIdentity(unwrap(m_vector[current]));
+            auto [entry, inserted] = m_indexes.try_emplace(currentIdentity, current);
+            if (!inserted && (entry->second >= current || !IsAt(entry->second, currentIdentity)))
+            {
+                entry->second = current;
+            }
+
+            if (currentIdentity == identity)
+            {
+                index = entry->second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool IsAt(uint32_t index, void* identity)
+    {
+        return GetIdentity(unwrap(m_vector[index])) == identity;
+    }
+
+    void InvalidateIndexesFrom(uint32_t index)
+    {
+        // Drop stale entries of removed values too, once they start to dominate.
+        if (index == 0 || m_indexes.size() > 2 * m_vector.size())
+        {
+            m_indexes.clear();
+            m_indexedCount = 0;
+        }
+        else
+        {
+            m_indexedCount = std::min(m_indexedCount, index);
+        }
+    }
+
+    bool m_isHashedIndexOf{ false };
+    std::unordered_map<void*, uint32_t> m_indexes;
+    uint32_t m_indexedCount{ 0 };
+    unsigned int m_deferVectorChangedCount{ 0 };
+    bool m_hasDeferredVectorChanged{ false };
 };
 
 // Vector Inner implementation with Observable function
@@ -326,13 +500,6 @@ public:
     {
     }
 
-    void RaiseChildrenChanged(winrt::CollectionChange collectionChange, unsigned int index) override
-    {
-        if (auto sender = m_pIVectorExternal->GetVectorEventSender().try_as< SenderType>()) {
-            Traits::RaiseEvent(m_pIVectorExternal->GetVectorEventSource(), sender, collectionChange, index);
-        }
-    }
-    
     winrt::event_token AddEventHandler(EventHandler const& handler)
     {
         return Traits::AddEventHandler(m_pIVectorExternal->GetVectorEventSource(), handler);
@@ -343,6 +510,14 @@ public:
        Traits::RemoveEventHandler(m_pIVectorExternal->GetVectorEventSource(), token);
     };
 
+protected:
+    void RaiseVectorChanged(winrt::CollectionChange collectionChange, unsigned int index, unsigned int count) override
+    {
+        if (auto sender = m_pIVectorExternal->GetVectorEventSender().try_as< SenderType>()) {
+            Traits::RaiseEvent(m_pIVectorExternal->GetVectorEventSource(), sender, collectionChange, index, count);
+        }
+    }
+
 private:
     IVectorOwner<EventSource, T_type>* m_pIVectorExternal{ nullptr };
 };
@@ -600,8 +775,15 @@ class Vector :
     public VectorBase<T, Helper::isObservable, Helper::isBindable, Helper::isDependencyObjectBase, Helper::isNoTrackerRef>
 {
 public:
-    Vector() {}
-    Vector(uint32_t capacity) : VectorBase(capacity) {}
+    Vector()
+    {
+        InitializeIndexOf();
+    }
+
+    Vector(uint32_t capacity) : VectorBase(capacity)
+    {
+        InitializeIndexOf();
+    }
 
     // The same copy of data for NavigationView split into two parts in top navigationview. So two or more vectors are created to provide multiple datasource for controls.
     // InspectingDataSource is converting C# collections to Vector<winrt::IInspectable>. When GetAt(index) for things like string, a new IInspectable is always returned by C# projection. 
@@ -625,9 +807,18 @@ public:
                 return CustomIndexOf(value, index);
             });
         }
+        InitializeIndexOf();
     }
 
 private:
+    void InitializeIndexOf()
+    {
+        if constexpr (Helper::isHashedIndexOf)
+        {
+            GetVectorInnerImpl()->EnableHashedIndexOf();
+        }
+    }
+
     bool CustomIndexOf(T const& value, uint32_t& index)
     {
         if (m_indexOfFunction)
@@ -9,12 +9,29 @@ public:
     {
         m_action = action;
         m_index = index;
+        m_rangeAction = action;
+    }
+
+    // A change of count items starting at index. IVectorChangedEventArgs can only describe a single item,
+    // so listeners see a multi-item insert or remove as a Reset. Internal listeners can read the range back
+    // through RangeAction/Index/Count.
+    VectorChangedEventArgs(winrt::CollectionChange rangeAction, unsigned int index, unsigned int count)
+    {
+        m_action = (count == 1 || rangeAction == winrt::CollectionChange::Reset) ? rangeAction : winrt::CollectionChange::Reset;
+        m_index = index;
+        m_count = count;
+        m_rangeAction = rangeAction;
     }
 
     winrt::CollectionChange CollectionChange() { return m_action; }
     uint32_t Index() { return m_index; }
 
+    winrt::CollectionChange RangeAction() { return m_rangeAction; }
+    uint32_t Count() { return m_count; }
+
 private:
     winrt::CollectionChange m_action;
     unsigned int m_index;
+    winrt::CollectionChange m_rangeAction;
+    unsigned int m_count{ 1 };
 };
\ No newline at end of file
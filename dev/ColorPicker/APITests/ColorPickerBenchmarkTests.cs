@@ -0,0 +1,148 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using MUXControlsTestApp.Utilities;
+using System;
+using Common;
+
+#if USING_TAEF
+using WEX.TestExecution;
+using WEX.TestExecution.Markup;
+using WEX.Logging.Interop;
+#else
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
+#endif
+
+#if !BUILD_WINDOWS
+using ColorSpectrumShape = Microsoft.UI.Xaml.Controls.ColorSpectrumShape;
+using ColorSpectrumComponents = Microsoft.UI.Xaml.Controls.ColorSpectrumComponents;
+using ColorPickerTestApi = Microsoft.UI.Private.Controls.ColorPickerTestApi;
+#endif
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
+{
+    // Runs the ColorPicker's pixel generation code directly, without a ColorPicker or the threadpool,
+    // so that its per-pixel cost can be measured. Each scenario logs the average time per bitmap and
+    // the throughput in megabytes of pixel data per second.
+    [TestClass]
+    public class ColorPickerBenchmarkTests
+    {
+        private static readonly int[] SpectrumSizes = { 128, 336, 600 };
+        private const int Iterations = 10;
+        private const int BytesPerPixel = 4;
+
+        [TestMethod]
+        public void BenchmarkSpectrumPixelFill()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (ColorSpectrumShape shape in new[] { ColorSpectrumShape.Box, ColorSpectrumShape.Ring })
+                {
+                    foreach (ColorSpectrumComponents components in new[] { ColorSpectrumComponents.HueSaturation, ColorSpectrumComponents.HueValue, ColorSpectrumComponents.SaturationValue })
+                    {
+                        foreach (int size in SpectrumSizes)
+                        {
+                            double milliseconds = ColorPickerTestApi.MeasureSpectrumPixelFill(shape, components, size, Iterations);
+                            LogResult(
+                                string.Format("Spectrum pixel fill {0} {1} {2}x{2}", shape, components, size),
+                                milliseconds,
+                                (long)size * size * BytesPerPixel * GetSpectrumBitmapCount(components));
+                        }
+                    }
+                }
+            });
+        }
+
+        [TestMethod]
+        public void BenchmarkSpectrumBitmapCreation()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (ColorSpectrumComponents components in new[] { ColorSpectrumComponents.HueSaturation, ColorSpectrumComponents.HueValue, ColorSpectrumComponents.SaturationValue })
+                {
+                    foreach (int size in SpectrumSizes)
+                    {
+                        double milliseconds = ColorPickerTestApi.MeasureSpectrumBitmapCreation(components, size, Iterations);
+                        LogResult(
+                            string.Format("Spectrum bitmap creation {0} {1}x{1}", components, size),
+                            milliseconds,
+                            (long)size * size * BytesPerPixel * GetSpectrumBitmapCount(components));
+                    }
+                }
+            });
+        }
+
+        [TestMethod]
+        public void BenchmarkSurfaceCreation()
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThanOrEqual(OSVersion.Redstone2))
+            {
+                Log.Comment("Composition surfaces are only used on RS2 and later.");
+                return;
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (int size in SpectrumSizes)
+                {
+                    double milliseconds = ColorPickerTestApi.MeasureSurfaceCreation(size, Iterations);
+                    LogResult(string.Format("Surface creation {0}x{0}", size), milliseconds, (long)size * size * BytesPerPixel);
+                }
+            });
+        }
+
+        [TestMethod]
+        public void BenchmarkCheckeredBackgroundFill()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // The color preview rectangle and the alpha slider background, at their default and at a large size.
+                foreach (var size in new[] { Tuple.Create(44, 260), Tuple.Create(312, 11), Tuple.Create(600, 600) })
+                {
+                    double milliseconds = ColorPickerTestApi.MeasureCheckeredBackgroundFill(size.Item1, size.Item2, Iterations);
+                    LogResult(
+                        string.Format("Checkered background fill {0}x{1}", size.Item1, size.Item2),
+                        milliseconds,
+                        (long)size.Item1 * size.Item2 * BytesPerPixel);
+                }
+            });
+        }
+
+        [TestMethod]
+        public void BenchmarkColorConversion()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (int colorCount in new[] { 360, 336 * 336 })
+                {
+                    double milliseconds = ColorPickerTestApi.MeasureColorConversion(colorCount, Iterations);
+                    LogResult(
+                        string.Format("HSV to RGB to HSV, {0} colors", colorCount),
+                        milliseconds,
+                        (long)colorCount * 2 * 3 * sizeof(double));
+                }
+            });
+        }
+
+        // With hue as the third dimension, ColorSpectrum fills six bitmaps, one per sextant boundary; otherwise it fills a min and a max.
+        private static int GetSpectrumBitmapCount(ColorSpectrumComponents components)
+        {
+            return components == ColorSpectrumComponents.ValueSaturation || components == ColorSpectrumComponents.SaturationValue ? 6 : 2;
+        }
+
+        private static void LogResult(string scenario, double totalMilliseconds, long bytesPerIteration)
+        {
+            Verify.IsTrue(totalMilliseconds >= 0);
+
+            double millisecondsPerIteration = totalMilliseconds / Iterations;
+            double megabytesPerSecond = totalMilliseconds > 0 ? bytesPerIteration * Iterations / (totalMilliseconds * 1000.0) : 0;
+
+            Log.Comment(string.Format(
+                "{0}: {1:F3} ms per bitmap, {2:F1} MB/s",
+                scenario,
+                millisecondsPerIteration,
+                megabytesPerSecond));
+        }
+    }
+}
@@ -6,8 +6,27 @@
 #include "ColorHelpers.h"
 #include "SharedHelpers.h"
 
+#include <d3d11.h>
+#include <windows.ui.composition.interop.h>
+
 const int CheckerSize = 4;
 
+// Upper bound on the pixel data held by s_checkeredBackgroundCache.
+static constexpr size_t s_checkeredBackgroundCacheByteLimit = 8 * 1024 * 1024;
+
+struct CheckeredBackgroundCacheEntry
+{
+    int width;
+    int height;
+    winrt::Color checkerColor;
+    winrt::WriteableBitmap bitmap;
+};
+
+// Checkered backgrounds only depend on their size and color, so every ColorPicker on this thread shares them,
+// least recently used first.  WriteableBitmaps can only be used on the thread that created them.
+static thread_local std::vector<CheckeredBackgroundCacheEntry> s_checkeredBackgroundCache;
+static thread_local size_t s_checkeredBackgroundCacheByteCount{ 0 };
+
 Hsv FindNextNamedColor(
     const Hsv &originalHsv,
     winrt::ColorPickerHsvChannel channel,
@@ -360,6 +379,92 @@ double IncrementAlphaChannel(
     return originalAlpha / 100;
 }
 
+static size_t GetCheckeredBackgroundByteCount(int width, int height)
+{
+    return static_cast<size_t>(width) * height * 4;
+}
+
+void FillCheckeredBackgroundPixelData(
+    int width,
+    int height,
+    winrt::Color checkerColor,
+    std::vector<byte> &bgraCheckeredPixelData,
+    winrt::IAsyncAction const& workItem)
+{
+    for (int y = 0; y < height; y++)
+    {
+        if (workItem && workItem.Status() == winrt::AsyncStatus::Canceled)
+        {
+            break;
+        }
+
+        for (int x = 0; x < width; x++)
+        {
+            // We want the checkered pattern to alternate both vertically and horizontally.
+            // In order to achieve that, we'll toggle visibility of the current pixel on or off
+            // depending on both its x- and its y-position.  If x == CheckerSize, we'll turn visibility off,
+            // but then if y == CheckerSize, we'll turn it back on.
+            // The below is a shorthand for the above intent.
+            bool pixelShouldBeBlank = (x / CheckerSize + y / CheckerSize) % 2 == 0 ? 255 : 0;
+
+            if (pixelShouldBeBlank)
+            {
+                bgraCheckeredPixelData.push_back(0);
+                bgraCheckeredPixelData.push_back(0);
+                bgraCheckeredPixelData.push_back(0);
+                bgraCheckeredPixelData.push_back(0);
+            }
+            else
+            {
+                bgraCheckeredPixelData.push_back(checkerColor.B * checkerColor.A / 255);
+                bgraCheckeredPixelData.push_back(checkerColor.G * checkerColor.A / 255);
+                bgraCheckeredPixelData.push_back(checkerColor.R * checkerColor.A / 255);
+                bgraCheckeredPixelData.push_back(checkerColor.A);
+            }
+        }
+    }
+}
+
+static winrt::WriteableBitmap FindCachedCheckeredBackground(int width, int height, winrt::Color checkerColor)
+{
+    auto entry = std::find_if(s_checkeredBackgroundCache.begin(), s_checkeredBackgroundCache.end(),
+        [width, height, checkerColor](const CheckeredBackgroundCacheEntry& entry)
+        {
+            return entry.width == width && entry.height == height && entry.checkerColor == checkerColor;
+        });
+
+    if (entry == s_checkeredBackgroundCache.end())
+    {
+        return nullptr;
+    }
+
+    // The most recently used entry lives at the back.
+    std::rotate(entry, entry + 1, s_checkeredBackgroundCache.end());
+    return s_checkeredBackgroundCache.back().bitmap;
+}
+
+static void CacheCheckeredBackground(int width, int height, winrt::Color checkerColor, winrt::WriteableBitmap const& bitmap)
+{
+    const size_t byteCount = GetCheckeredBackgroundByteCount(width, height);
+
+    if (byteCount > s_checkeredBackgroundCacheByteLimit ||
+        FindCachedCheckeredBackground(width, height, checkerColor))
+    {
+        return;
+    }
+
+    while (!s_checkeredBackgroundCache.empty() &&
+        s_checkeredBackgroundCacheByteCount + byteCount > s_checkeredBackgroundCacheByteLimit)
+    {
+        const CheckeredBackgroundCacheEntry& oldestEntry = s_checkeredBackgroundCache.front();
+        s_checkeredBackgroundCacheByteCount -= GetCheckeredBackgroundByteCount(oldestEntry.width, oldestEntry.height);
+        s_checkeredBackgroundCache.erase(s_checkeredBackgroundCache.begin());
+    }
+
+    s_checkeredBackgroundCache.push_back({ width, height, checkerColor, bitmap });
+    s_checkeredBackgroundCacheByteCount += byteCount;
+}
+
 void CreateCheckeredBackgroundAsync(
     int width,
     int height,
@@ -374,44 +479,23 @@ void CreateCheckeredBackgroundAsync(
         return;
     }
 
-    bgraCheckeredPixelData->reserve(static_cast<size_t>(width * height * 4));
+    // Another ColorPicker, or this one at an earlier size, may already have generated this exact background.
+    if (auto cachedBitmap = FindCachedCheckeredBackground(width, height, checkerColor))
+    {
+        CancelAsyncAction(asyncActionToAssign);
+        asyncActionToAssign = nullptr;
+
+        completedFunction(cachedBitmap);
+        return;
+    }
+
+    bgraCheckeredPixelData->reserve(GetCheckeredBackgroundByteCount(width, height));
 
     winrt::WorkItemHandler workItemHandler(
         [width, height, checkerColor, bgraCheckeredPixelData]
     (winrt::IAsyncAction workItem)
     {
-        for (int y = 0; y < height; y++)
-        {
-            for (int x = 0; x < width; x++)
-            {
-                if (workItem.Status() == winrt::AsyncStatus::Canceled)
-                {
-                    break;
-                }
-
-                // We want the checkered pattern to alternate both vertically and horizontally.
-                // In order to achieve that, we'll toggle visibility of the current pixel on or off
-                // depending on both its x- and its y-position.  If x == CheckerSize, we'll turn visibility off,
-                // but then if y == CheckerSize, we'll turn it back on.
-                // The below is a shorthand for the above intent.
-                bool pixelShouldBeBlank = (x / CheckerSize + y / CheckerSize) % 2 == 0 ? 255 : 0;
-
-                if (pixelShouldBeBlank)
-                {
-                    bgraCheckeredPixelData->push_back(0);
-                    bgraCheckeredPixelData->push_back(0);
-                    bgraCheckeredPixelData->push_back(0);
-                    bgraCheckeredPixelData->push_back(0);
-                }
-                else
-                {
-                    bgraCheckeredPixelData->push_back(checkerColor.B * checkerColor.A / 255);
-                    bgraCheckeredPixelData->push_back(checkerColor.G * checkerColor.A / 255);
-                    bgraCheckeredPixelData->push_back(checkerColor.R * checkerColor.A / 255);
-                    bgraCheckeredPixelData->push_back(checkerColor.A);
-                }
-            }
-        }
+        FillCheckeredBackgroundPixelData(width, height, checkerColor, *bgraCheckeredPixelData, workItem);
     });
 
     if (asyncActionToAssign)
@@ -421,7 +505,7 @@ void CreateCheckeredBackgroundAsync(
 
     asyncActionToAssign = winrt::ThreadPool::RunAsync(workItemHandler);
     asyncActionToAssign.Completed(winrt::AsyncActionCompletedHandler(
-        [width, height, bgraCheckeredPixelData, &asyncActionToAssign, completedFunction, dispatcherHelper] 
+        [width, height, checkerColor, bgraCheckeredPixelData, &asyncActionToAssign, completedFunction, dispatcherHelper] 
     (winrt::IAsyncAction asyncInfo, winrt::AsyncStatus asyncStatus)
     {
         if (asyncStatus != winrt::AsyncStatus::Completed)
@@ -431,11 +515,12 @@ void CreateCheckeredBackgroundAsync(
 
         asyncActionToAssign = nullptr;
 
-        dispatcherHelper.RunAsync([completedFunction, width, height, bgraCheckeredPixelData]()
+        dispatcherHelper.RunAsync([completedFunction, width, height, checkerColor, bgraCheckeredPixelData]()
         {
             winrt::WriteableBitmap checkeredBackgroundBitmap = CreateBitmapFromPixelData(width, height, bgraCheckeredPixelData);
+            CacheCheckeredBackground(width, height, checkerColor, checkeredBackgroundBitmap);
             completedFunction(checkeredBackgroundBitmap);
-        });
+        }, false /* fallbackToThisThread */, DispatcherHelper::Priority::Low);
     }));
 }
 
@@ -459,13 +544,141 @@ winrt::WriteableBitmap CreateBitmapFromPixelData(
     return bitmap;
 }
 
-winrt::LoadedImageSurface CreateSurfaceFromPixelData(
+// The D3D device that CreateSurfaceFromPixelData() uses to copy pixel data straight into composition surfaces.
+// A CompositionGraphicsDevice belongs to a single compositor, so each UI thread gets its own.
+struct SurfaceUploadDevice
+{
+    winrt::Compositor compositor{ nullptr };
+    winrt::com_ptr<ID3D11Device> d3dDevice;
+    winrt::com_ptr<ID3D11DeviceContext> d3dDeviceContext;
+    winrt::CompositionGraphicsDevice graphicsDevice{ nullptr };
+};
+
+static thread_local SurfaceUploadDevice s_surfaceUploadDevice;
+static thread_local unsigned int s_surfaceUploadDeviceGeneration{ 0 };
+
+static void ResetSurfaceUploadDevice()
+{
+    if (s_surfaceUploadDevice.graphicsDevice)
+    {
+        s_surfaceUploadDevice = {};
+        s_surfaceUploadDeviceGeneration++;
+    }
+}
+
+static bool EnsureSurfaceUploadDevice(const winrt::Compositor& compositor)
+{
+    SurfaceUploadDevice& device = s_surfaceUploadDevice;
+
+    if (device.graphicsDevice &&
+        device.compositor == compositor &&
+        device.d3dDevice->GetDeviceRemovedReason() == S_OK)
+    {
+        return true;
+    }
+
+    ResetSurfaceUploadDevice();
+
+    winrt::com_ptr<ID3D11Device> d3dDevice;
+    winrt::com_ptr<ID3D11DeviceContext> d3dDeviceContext;
+    HRESULT hr = E_FAIL;
+
+    // Fall back to WARP when there is no hardware device, e.g. in a VM or a remote session.
+    for (D3D_DRIVER_TYPE driverType : { D3D_DRIVER_TYPE_HARDWARE, D3D_DRIVER_TYPE_WARP })
+    {
+        hr = D3D11CreateDevice(
+            nullptr,
+            driverType,
+            nullptr,
+            D3D11_CREATE_DEVICE_BGRA_SUPPORT,
+            nullptr,
+            0,
+            D3D11_SDK_VERSION,
+            d3dDevice.put(),
+            nullptr,
+            d3dDeviceContext.put());
+
+        if (SUCCEEDED(hr))
+        {
+            break;
+        }
+    }
+
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    winrt::CompositionGraphicsDevice graphicsDevice{ nullptr };
+    hr = compositor.as<ABI::Windows::UI::Composition::ICompositorInterop>()->CreateGraphicsDevice(
+        d3dDevice.get(),
+        reinterpret_cast<ABI::Windows::UI::Composition::ICompositionGraphicsDevice**>(winrt::put_abi(graphicsDevice)));
+
+    if (FAILED(hr))
+    {
+        return false;
+    }
+
+    device.compositor = compositor;
+    device.d3dDevice = std::move(d3dDevice);
+    device.d3dDeviceContext = std::move(d3dDeviceContext);
+    device.graphicsDevice = std::move(graphicsDevice);
+    return true;
+}
+
+// Copies BGRA pixel data into a new CompositionDrawingSurface.  Returns null if no D3D device is available
+// or the device was lost during the upload, in which case the caller should fall back to the BMP path.
+static winrt::CompositionDrawingSurface CreateDrawingSurfaceFromPixelData(
     int pixelWidth,
     int pixelHeight,
     std::shared_ptr<std::vector<byte>> const& bgraPixelData)
 {
-    MUX_ASSERT(SharedHelpers::IsRS2OrHigher());
+    if (!EnsureSurfaceUploadDevice(winrt::Window::Current().Compositor()))
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        winrt::CompositionDrawingSurface surface = s_surfaceUploadDevice.graphicsDevice.CreateDrawingSurface(
+            { static_cast<float>(pixelWidth), static_cast<float>(pixelHeight) },
+            winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+            winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+
+        auto surfaceInterop = surface.as<ABI::Windows::UI::Composition::ICompositionDrawingSurfaceInterop>();
+
+        // BeginDraw may hand us a texture from an atlas, so the update has to be placed at the returned offset.
+        winrt::com_ptr<ID3D11Texture2D> texture;
+        POINT offset{};
+        winrt::check_hresult(surfaceInterop->BeginDraw(nullptr, __uuidof(ID3D11Texture2D), texture.put_void(), &offset));
+
+        const D3D11_BOX destinationBox{
+            static_cast<UINT>(offset.x),
+            static_cast<UINT>(offset.y),
+            0,
+            static_cast<UINT>(offset.x + pixelWidth),
+            static_cast<UINT>(offset.y + pixelHeight),
+            1 };
+        s_surfaceUploadDevice.d3dDeviceContext->UpdateSubresource(
+            texture.get(), 0, &destinationBox, (*bgraPixelData).data(), static_cast<UINT>(pixelWidth * 4), 0);
+
+        winrt::check_hresult(surfaceInterop->EndDraw());
+
+        return surface;
+    }
+    catch (winrt::hresult_error&)
+    {
+        // Most likely the device was lost.  Drop it so the next call starts over with a new one.
+        ResetSurfaceUploadDevice();
+        return nullptr;
+    }
+}
 
+static winrt::LoadedImageSurface CreateLoadedImageSurfaceFromPixelData(
+    int pixelWidth,
+    int pixelHeight,
+    std::shared_ptr<std::vector<byte>> const& bgraPixelData)
+{
     // LoadedImageSurface uses WIC to load images, so we need to put the pixel data into an image format.
     // We'll use the BMP format, since it stores uncompressed pixel data.
     std::vector<byte> bmpData;
@@ -584,6 +797,90 @@ winrt::LoadedImageSurface CreateSurfaceFromPixelData(
     return winrt::LoadedImageSurface::StartLoadFromStream(stream);
 }
 
+unsigned int GetSurfaceUploadDeviceGeneration()
+{
+    if (s_surfaceUploadDevice.graphicsDevice &&
+        s_surfaceUploadDevice.d3dDevice->GetDeviceRemovedReason() != S_OK)
+    {
+        ResetSurfaceUploadDevice();
+    }
+
+    return s_surfaceUploadDeviceGeneration;
+}
+
+winrt::ICompositionSurface CreateSurfaceFromPixelData(
+    int pixelWidth,
+    int pixelHeight,
+    std::shared_ptr<std::vector<byte>> const& bgraPixelData)
+{
+    MUX_ASSERT(SharedHelpers::IsRS2OrHigher());
+
+    // Uploading the pixels directly avoids encoding them as a BMP, copying that into a stream, and having WIC decode it again.
+    if (winrt::CompositionDrawingSurface surface = CreateDrawingSurfaceFromPixelData(pixelWidth, pixelHeight, bgraPixelData))
+    {
+        return surface;
+    }
+
+    return CreateLoadedImageSurfaceFromPixelData(pixelWidth, pixelHeight, bgraPixelData);
+}
+
+void AddGradientStop(winrt::LinearGradientBrush const& brush, double offset, Hsv hsvColor, double alpha)
+{
+    winrt::GradientStop stop;
+
+    Rgb rgbColor = HsvToRgb(hsvColor);
+
+    stop.Color(winrt::ColorHelper::FromArgb(
+        static_cast<unsigned char>(round(alpha * 255)),
+        static_cast<unsigned char>(round(rgbColor.r * 255)),
+        static_cast<unsigned char>(round(rgbColor.g * 255)),
+        static_cast<unsigned char>(round(rgbColor.b * 255))));
+    stop.Offset(offset);
+
+    brush.GradientStops().Append(stop);
+}
+
+void SetGradientStop(winrt::LinearGradientBrush const& brush, uint32_t index, double offset, Hsv hsvColor, double alpha)
+{
+    auto stops = brush.GradientStops();
+
+    if (index >= stops.Size())
+    {
+        AddGradientStop(brush, offset, hsvColor, alpha);
+        return;
+    }
+
+    Rgb rgbColor = HsvToRgb(hsvColor);
+    const winrt::Color color = winrt::ColorHelper::FromArgb(
+        static_cast<unsigned char>(round(alpha * 255)),
+        static_cast<unsigned char>(round(rgbColor.r * 255)),
+        static_cast<unsigned char>(round(rgbColor.g * 255)),
+        static_cast<unsigned char>(round(rgbColor.b * 255)));
+
+    // Only touch properties that changed, each set invalidates the brush.
+    auto stop = stops.GetAt(index);
+
+    if (stop.Color() != color)
+    {
+        stop.Color(color);
+    }
+
+    if (stop.Offset() != offset)
+    {
+        stop.Offset(offset);
+    }
+}
+
+void TrimGradientStops(winrt::LinearGradientBrush const& brush, uint32_t count)
+{
+    auto stops = brush.GradientStops();
+
+    while (stops.Size() > count)
+    {
+        stops.RemoveAtEnd();
+    }
+}
+
 void CancelAsyncAction(winrt::IAsyncAction const& action)
 {
     if (action && action.Status() == winrt::AsyncStatus::Started)
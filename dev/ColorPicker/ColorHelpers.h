@@ -36,6 +36,14 @@ double IncrementAlphaChannel(
     double minBound,
     double maxBound);
 
+// Appends the pixels of a checkered background to bgraCheckeredPixelData, stopping early if workItem is canceled.
+void FillCheckeredBackgroundPixelData(
+    int width,
+    int height,
+    winrt::Color checkerColor,
+    std::vector<byte> &bgraCheckeredPixelData,
+    winrt::IAsyncAction const& workItem);
+
 void CreateCheckeredBackgroundAsync(
     int width,
     int height,
@@ -50,9 +58,19 @@ winrt::WriteableBitmap CreateBitmapFromPixelData(
     int pixelHeight,
     std::shared_ptr<std::vector<byte>> const& bgraPixelData);
 
-winrt::LoadedImageSurface CreateSurfaceFromPixelData(
+winrt::ICompositionSurface CreateSurfaceFromPixelData(
     int pixelWidth,
     int pixelHeight,
     std::shared_ptr<std::vector<byte>> const& bgraPixelData);
 
+// Changes whenever the device behind the surfaces returned by CreateSurfaceFromPixelData() is lost, which also loses their contents.
+unsigned int GetSurfaceUploadDeviceGeneration();
+
+void AddGradientStop(winrt::LinearGradientBrush const& brush, double offset, Hsv hsvColor, double alpha);
+
+// Like AddGradientStop, but reuses the brush's existing stop at 'index' when there is one, so that gradients
+// updated on every color change don't allocate new stops. Follow with TrimGradientStops to drop any stops past the last one set.
+void SetGradientStop(winrt::LinearGradientBrush const& brush, uint32_t index, double offset, Hsv hsvColor, double alpha);
+void TrimGradientStops(winrt::LinearGradientBrush const& brush, uint32_t count);
+
 void CancelAsyncAction(winrt::IAsyncAction const& action);
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "ResourceAccessor.h"
 #include "RuntimeProfiler.h"
+#include "StartupTrace.h"
 
 using namespace std;
 
@@ -23,6 +24,8 @@ ColorPicker::ColorPicker()
 
 void ColorPicker::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"ColorPicker");
+
     winrt::IControlProtected thisAsControlProtected = *this;
 
     m_colorSpectrum.set(GetTemplateChildT<winrt::ColorSpectrum>(L"ColorSpectrum", thisAsControlProtected));
@@ -563,69 +566,46 @@ void ColorPicker::UpdateColorControls(ColorUpdateReason reason)
         UpdateAlphaSlider();
     }
 
-    auto strongThis = get_strong();
-    auto updateTextBoxes = [strongThis, reason]()
+    // While the user drags across the ColorSpectrum, the color can change several times per frame,
+    // but only the last of those colors is ever seen, so we'll update the text boxes at most once per frame.
+    if (reason == ColorUpdateReason::ColorSpectrumColorChanged && !SharedHelpers::IsInDesignMode())
     {
-        if (reason != ColorUpdateReason::RgbTextBoxChanged)
+        if (!m_isTextBoxUpdatePending)
         {
-            if (strongThis->m_redTextBox)
-            {
-                strongThis->m_redTextBox.Text(to_wstring(static_cast<::byte>(round(strongThis->m_currentRgb.r * 255))));
-            }
-
-            if (strongThis->m_greenTextBox)
-            {
-                strongThis->m_greenTextBox.Text(to_wstring(static_cast<::byte>(round(strongThis->m_currentRgb.g * 255))));
-            }
+            m_isTextBoxUpdatePending = true;
 
-            if (strongThis->m_blueTextBox)
+            auto strongThis = get_strong();
+            SharedHelpers::QueueCallbackForCompositionRendering([strongThis]()
             {
-                strongThis->m_blueTextBox.Text(to_wstring(static_cast<::byte>(round(strongThis->m_currentRgb.b * 255))));
-            }
+                if (strongThis->m_isTextBoxUpdatePending)
+                {
+                    strongThis->m_isTextBoxUpdatePending = false;
+                    strongThis->m_updatingControls = true;
+                    strongThis->UpdateTextBoxes(ColorUpdateReason::ColorSpectrumColorChanged);
+                    strongThis->m_updatingControls = false;
+                }
+            });
         }
-
-        if (reason != ColorUpdateReason::HsvTextBoxChanged)
-        {
-            if (strongThis->m_hueTextBox)
-            {
-                strongThis->m_hueTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentHsv.h))));
-            }
-
-            if (strongThis->m_saturationTextBox)
-            {
-                strongThis->m_saturationTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentHsv.s * 100))));
-            }
-
-            if (strongThis->m_valueTextBox)
-            {
-                strongThis->m_valueTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentHsv.v * 100))));
-            }
-        }
-
-        if (reason != ColorUpdateReason::AlphaTextBoxChanged && strongThis->m_alphaTextBox)
-        {
-            strongThis->m_alphaTextBox.Text(to_wstring(static_cast<int>(round(strongThis->m_currentAlpha * 100))) + wstring(L"%"));
-        }
-
-        if (reason != ColorUpdateReason::HexTextBoxChanged && strongThis->m_hexTextBox)
-        {
-            strongThis->m_hexTextBox.Text(strongThis->m_currentHex);
-        }
-    };
-
-    if (SharedHelpers::IsRS2OrHigher())
+    }
+    else if (SharedHelpers::IsRS2OrHigher())
     {
+        // An update still waiting for the next frame would overwrite the text box that caused this one.
+        m_isTextBoxUpdatePending = false;
+
         // A reentrancy bug with setting TextBox.Text was fixed in RS2,
         // so we can just directly set the TextBoxes' Text property there.
-        updateTextBoxes();
+        UpdateTextBoxes(reason);
     }
     else if (!SharedHelpers::IsInDesignMode())
     {
+        m_isTextBoxUpdatePending = false;
+
         // Otherwise, we need to post this to the dispatcher to avoid that reentrancy bug.
-        m_dispatcherHelper.RunAsync([strongThis, updateTextBoxes]()
+        auto strongThis = get_strong();
+        m_dispatcherHelper.RunAsync([strongThis, reason]()
         {
             strongThis->m_updatingControls = true;
-            updateTextBoxes();
+            strongThis->UpdateTextBoxes(reason);
             strongThis->m_updatingControls = false;
         });
     }
@@ -633,6 +613,51 @@ void ColorPicker::UpdateColorControls(ColorUpdateReason reason)
     m_updatingControls = false;
 }
 
+void ColorPicker::UpdateTextBoxes(ColorUpdateReason reason)
+{
+    if (reason != ColorUpdateReason::RgbTextBoxChanged)
+    {
+        SetTextBoxNumber(m_redTextBox, static_cast<::byte>(round(m_currentRgb.r * 255)), L"%d");
+        SetTextBoxNumber(m_greenTextBox, static_cast<::byte>(round(m_currentRgb.g * 255)), L"%d");
+        SetTextBoxNumber(m_blueTextBox, static_cast<::byte>(round(m_currentRgb.b * 255)), L"%d");
+    }
+
+    if (reason != ColorUpdateReason::HsvTextBoxChanged)
+    {
+        SetTextBoxNumber(m_hueTextBox, static_cast<int>(round(m_currentHsv.h)), L"%d");
+        SetTextBoxNumber(m_saturationTextBox, static_cast<int>(round(m_currentHsv.s * 100)), L"%d");
+        SetTextBoxNumber(m_valueTextBox, static_cast<int>(round(m_currentHsv.v * 100)), L"%d");
+    }
+
+    if (reason != ColorUpdateReason::AlphaTextBoxChanged)
+    {
+        SetTextBoxNumber(m_alphaTextBox, static_cast<int>(round(m_currentAlpha * 100)), L"%d%%");
+    }
+
+    if (reason != ColorUpdateReason::HexTextBoxChanged && m_hexTextBox && m_hexTextBox.Text() != m_currentHex)
+    {
+        m_hexTextBox.Text(m_currentHex);
+    }
+}
+
+void ColorPicker::SetTextBoxNumber(const winrt::TextBox& textBox, int number, _In_z_ PCWSTR format)
+{
+    if (!textBox)
+    {
+        return;
+    }
+
+    // Large enough for any int, a percent sign and the null terminator.
+    wchar_t text[16];
+    winrt::check_hresult(StringCchPrintfW(&text[0], ARRAYSIZE(text), format, number));
+
+    // Setting the same text again would still allocate a new string and raise TextChanged, so we'll only set it when it's different.
+    if (textBox.Text() != text)
+    {
+        textBox.Text(text);
+    }
+}
+
 void ColorPicker::OnColorSpectrumColorChanged(const winrt::ColorSpectrum& sender, const winrt::ColorChangedEventArgs& /*args*/)
 {
     // If we're updating controls, then this is being raised in response to that,
@@ -1030,7 +1055,8 @@ void ColorPicker::UpdateThirdDimensionSlider()
     // We'll have the gradient go between the minimum and maximum values in the case where
     // the slider handles saturation or value, or in the case where it handles hue,
     // we'll have it go between red, yellow, green, cyan, blue, and purple, in that order.
-    m_thirdDimensionSliderGradientBrush.GradientStops().Clear();
+    // The existing stops are updated in place, since this runs on every color change including spectrum drags.
+    uint32_t stopCount = 0;
 
     switch (ColorSpectrumComponents())
     {
@@ -1051,8 +1077,8 @@ void ColorPicker::UpdateThirdDimensionSlider()
             maxSaturation = minSaturation;
         }
 
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 0.0, { m_currentHsv.h, minSaturation / 100.0, 1.0 }, 1.0);
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 1.0, { m_currentHsv.h, maxSaturation / 100.0, 1.0 }, 1.0);
+        SetGradientStop(m_thirdDimensionSliderGradientBrush, stopCount++, 0.0, { m_currentHsv.h, minSaturation / 100.0, 1.0 }, 1.0);
+        SetGradientStop(m_thirdDimensionSliderGradientBrush, stopCount++, 1.0, { m_currentHsv.h, maxSaturation / 100.0, 1.0 }, 1.0);
     }
     break;
 
@@ -1073,8 +1099,8 @@ void ColorPicker::UpdateThirdDimensionSlider()
             maxValue = minValue;
         }
 
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 0.0, { m_currentHsv.h, m_currentHsv.s, minValue / 100.0 }, 1.0);
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 1.0, { m_currentHsv.h, m_currentHsv.s, maxValue / 100.0 }, 1.0);
+        SetGradientStop(m_thirdDimensionSliderGradientBrush, stopCount++, 0.0, { m_currentHsv.h, m_currentHsv.s, minValue / 100.0 }, 1.0);
+        SetGradientStop(m_thirdDimensionSliderGradientBrush, stopCount++, 1.0, { m_currentHsv.h, m_currentHsv.s, maxValue / 100.0 }, 1.0);
     }
     break;
 
@@ -1103,7 +1129,7 @@ void ColorPicker::UpdateThirdDimensionSlider()
         // We know we need a gradient stop at the start and end corresponding to the min and max values for hue,
         // and then in the middle, we'll add any gradient stops corresponding to the hue of those six pure colors that exist
         // between the min and max hue.
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 0.0, { static_cast<double>(minHue), 1.0, 1.0 }, 1.0);
+        SetGradientStop(m_thirdDimensionSliderGradientBrush, stopCount++, 0.0, { static_cast<double>(minHue), 1.0, 1.0 }, 1.0);
 
         for (int sextant = 1; sextant <= 5; sextant++)
         {
@@ -1111,14 +1137,16 @@ void ColorPicker::UpdateThirdDimensionSlider()
 
             if (minOffset < offset && maxOffset > offset)
             {
-                AddGradientStop(m_thirdDimensionSliderGradientBrush, (offset - minOffset) / (maxOffset - minOffset), { 60.0 * sextant, 1.0, 1.0 }, 1.0);
+                SetGradientStop(m_thirdDimensionSliderGradientBrush, stopCount++, (offset - minOffset) / (maxOffset - minOffset), { 60.0 * sextant, 1.0, 1.0 }, 1.0);
             }
         }
 
-        AddGradientStop(m_thirdDimensionSliderGradientBrush, 1.0, { static_cast<double>(maxHue), 1.0, 1.0 }, 1.0);
+        SetGradientStop(m_thirdDimensionSliderGradientBrush, stopCount++, 1.0, { static_cast<double>(maxHue), 1.0, 1.0 }, 1.0);
     }
     break;
     }
+
+    TrimGradientStops(m_thirdDimensionSliderGradientBrush, stopCount);
 }
 
 void ColorPicker::SetThirdDimensionSliderChannel()
@@ -1162,14 +1190,15 @@ void ColorPicker::UpdateAlphaSlider()
     // We'll have the gradient go between the minimum and maximum values in the case where
     // the slider handles saturation or value, or in the case where it handles hue,
     // we'll have it go between red, yellow, green, cyan, blue, and purple, in that order.
-    m_alphaSliderGradientBrush.GradientStops().Clear();
+    // The existing stops are updated in place, since this runs on every color change including spectrum drags.
 
     m_alphaSlider.Minimum(0);
     m_alphaSlider.Maximum(100);
     m_alphaSlider.Value(m_currentAlpha * 100);
 
-    AddGradientStop(m_alphaSliderGradientBrush, 0.0, m_currentHsv, 0.0);
-    AddGradientStop(m_alphaSliderGradientBrush, 1.0, m_currentHsv, 1.0);
+    SetGradientStop(m_alphaSliderGradientBrush, 0, 0.0, m_currentHsv, 0.0);
+    SetGradientStop(m_alphaSliderGradientBrush, 1, 1.0, m_currentHsv, 1.0);
+    TrimGradientStops(m_alphaSliderGradientBrush, 2);
 }
 
 void ColorPicker::CreateColorPreviewCheckeredBackground()
@@ -1224,22 +1253,6 @@ void ColorPicker::CreateAlphaSliderCheckeredBackground()
     }
 }
 
-void ColorPicker::AddGradientStop(winrt::LinearGradientBrush brush, double offset, Hsv hsvColor, double alpha)
-{
-    winrt::GradientStop stop;
-
-    Rgb rgbColor = HsvToRgb(hsvColor);
-
-    stop.Color(winrt::ColorHelper::FromArgb(
-        static_cast<unsigned char>(round(alpha * 255)),
-        static_cast<unsigned char>(round(rgbColor.r * 255)),
-        static_cast<unsigned char>(round(rgbColor.g * 255)),
-        static_cast<unsigned char>(round(rgbColor.b * 255))));
-    stop.Offset(offset);
-
-    brush.GradientStops().Append(stop);
-}
-
 winrt::Color ColorPicker::GetCheckerColor()
 {
     winrt::Color checkerColor;
@@ -82,8 +82,6 @@ private:
     // Helper functions
     void UpdateVisualState(bool useTransitions);
 
-    static void AddGradientStop(winrt::LinearGradientBrush brush, double offset, Hsv hsvColor, double alpha);
-
     winrt::Color GetCheckerColor();
 
     enum class ColorUpdateReason
@@ -108,6 +106,8 @@ private:
     void UpdatePreviousColorRectangle();
 
     void UpdateColorControls(ColorUpdateReason reason);
+    void UpdateTextBoxes(ColorUpdateReason reason);
+    static void SetTextBoxNumber(const winrt::TextBox& textBox, int number, _In_z_ PCWSTR format);
 
     void UpdateThirdDimensionSlider();
     void SetThirdDimensionSliderChannel();
@@ -126,6 +126,7 @@ private:
 
     bool m_updatingColor{ false };
     bool m_updatingControls{ false };
+    bool m_isTextBoxUpdatePending{ false };
     Rgb m_currentRgb{ 1.0, 1.0, 1.0 };
     Hsv m_currentHsv{ 0.0, 1.0, 1.0 };
     winrt::hstring m_currentHex{ L"#FFFFFFFF" };
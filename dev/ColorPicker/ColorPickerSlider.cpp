@@ -9,6 +9,7 @@
 #include "ColorPicker.h"
 #include "ResourceAccessor.h"
 #include "Utils.h"
+#include "StartupTrace.h"
 
 ColorPickerSlider::ColorPickerSlider()
 {
@@ -29,6 +30,8 @@ winrt::AutomationPeer ColorPickerSlider::OnCreateAutomationPeer()
 
 void ColorPickerSlider::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"ColorPickerSlider");
+
     __super::OnApplyTemplate();
 
     winrt::IControlProtected thisAsControlProtected = *this;
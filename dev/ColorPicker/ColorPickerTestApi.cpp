@@ -0,0 +1,102 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ColorSpectrum.h"
+#include "ColorPickerTestApi.h"
+
+#include <chrono>
+
+using namespace std;
+
+template <typename Function>
+static double MeasureMilliseconds(int iterations, const Function &function)
+{
+    const auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < iterations; i++)
+    {
+        function();
+    }
+
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+static ColorSpectrum::SpectrumBitmapCacheKey GetFullRangeSpectrumKey(winrt::ColorSpectrumShape shape, winrt::ColorSpectrumComponents components, int size)
+{
+    return { static_cast<double>(size), shape, components, 0, 359, 0, 100, 0, 100 };
+}
+
+double ColorPickerTestApi::MeasureSpectrumPixelFill(winrt::ColorSpectrumShape const& shape, winrt::ColorSpectrumComponents const& components, int size, int iterations)
+{
+    auto data = ColorSpectrum::CreateSpectrumBitmapData(GetFullRangeSpectrumKey(shape, components, size));
+    vector<Hsv> hsvRow(data->pixelDimension);
+    vector<Hsv> scratchHsvRow(data->pixelDimension);
+
+    // A single thread fills every row, so this measures the per-pixel work rather than how well it spreads over the threadpool.
+    return MeasureMilliseconds(iterations, [&]()
+    {
+        for (int row = 0; row < data->pixelDimension; row++)
+        {
+            ColorSpectrum::FillRow(*data, row, hsvRow, scratchHsvRow);
+        }
+    });
+}
+
+double ColorPickerTestApi::MeasureSpectrumBitmapCreation(winrt::ColorSpectrumComponents const& components, int size, int iterations)
+{
+    auto data = ColorSpectrum::CreateSpectrumBitmapData(GetFullRangeSpectrumKey(winrt::ColorSpectrumShape::Ring, components, size));
+    vector<Hsv> hsvRow(data->pixelDimension);
+    vector<Hsv> scratchHsvRow(data->pixelDimension);
+
+    for (int row = 0; row < data->pixelDimension; row++)
+    {
+        ColorSpectrum::FillRow(*data, row, hsvRow, scratchHsvRow);
+    }
+
+    return MeasureMilliseconds(iterations, [&]()
+    {
+        ColorSpectrum::CreateSpectrumBitmaps(*data);
+    });
+}
+
+double ColorPickerTestApi::MeasureSurfaceCreation(int size, int iterations)
+{
+    auto bgraPixelData = make_shared<vector<::byte>>(static_cast<size_t>(size) * size * 4, static_cast<::byte>(255));
+
+    return MeasureMilliseconds(iterations, [&]()
+    {
+        CreateSurfaceFromPixelData(size, size, bgraPixelData);
+    });
+}
+
+double ColorPickerTestApi::MeasureCheckeredBackgroundFill(int width, int height, int iterations)
+{
+    vector<::byte> bgraCheckeredPixelData;
+    bgraCheckeredPixelData.reserve(static_cast<size_t>(width) * height * 4);
+
+    return MeasureMilliseconds(iterations, [&]()
+    {
+        bgraCheckeredPixelData.clear();
+        FillCheckeredBackgroundPixelData(width, height, winrt::ColorHelper::FromArgb(255, 128, 128, 128), bgraCheckeredPixelData, nullptr);
+    });
+}
+
+double ColorPickerTestApi::MeasureColorConversion(int colorCount, int iterations)
+{
+    vector<Hsv> hsvValues(colorCount);
+    vector<Rgb> rgbValues(colorCount);
+
+    for (int i = 0; i < colorCount; i++)
+    {
+        hsvValues[i] = Hsv(i % 360, (i % 101) / 100.0, (i % 67) / 66.0);
+    }
+
+    // Each iteration converts every color to RGB and back.
+    return MeasureMilliseconds(iterations, [&]()
+    {
+        HsvToRgb(hsvValues.data(), rgbValues.data(), hsvValues.size());
+        RgbToHsv(rgbValues.data(), hsvValues.data(), rgbValues.size());
+    });
+}
@@ -0,0 +1,19 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ColorPickerTestApi.g.h"
+
+class ColorPickerTestApi :
+    public winrt::implementation::ColorPickerTestApiT<ColorPickerTestApi>
+{
+public:
+    static double MeasureSpectrumPixelFill(winrt::ColorSpectrumShape const& shape, winrt::ColorSpectrumComponents const& components, int size, int iterations);
+    static double MeasureSpectrumBitmapCreation(winrt::ColorSpectrumComponents const& components, int size, int iterations);
+    static double MeasureSurfaceCreation(int size, int iterations);
+    static double MeasureCheckeredBackgroundFill(int width, int height, int iterations);
+    static double MeasureColorConversion(int colorCount, int iterations);
+};
+
+CppWinRTActivatableClassWithBasicFactory(ColorPickerTestApi);
@@ -7,9 +7,21 @@
 
 #include "ColorSpectrumAutomationPeer.h"
 #include "SpectrumBrush.h"
+#include "SampledPerfTrace.h"
+#include "StartupTrace.h"
 
 using namespace std;
 
+// Upper bound on the pixel data held by s_spectrumBitmapCache.
+// A 600x600 spectrum with hue as its third dimension takes about 8.6MB.
+static constexpr size_t s_spectrumBitmapCacheByteLimit = 64 * 1024 * 1024;
+
+// How long the size of the spectrum must stay the same before stretched bitmaps get regenerated, in 100ns units.
+static constexpr int64_t s_bitmapCreationDelay = 200 * 10000;
+
+thread_local std::vector<ColorSpectrum::SpectrumBitmapCacheEntry> ColorSpectrum::s_spectrumBitmapCache;
+thread_local size_t ColorSpectrum::s_spectrumBitmapCacheByteCount{ 0 };
+
 ColorSpectrum::ColorSpectrum()
 {
     SetDefaultStyleKey(this);
@@ -46,6 +58,8 @@ winrt::AutomationPeer ColorSpectrum::OnCreateAutomationPeer()
 
 void ColorSpectrum::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"ColorSpectrum");
+
     winrt::IControlProtected thisAsControlProtected = *this;
 
     m_layoutRoot = GetTemplateChildT<winrt::Grid>(L"LayoutRoot", thisAsControlProtected);
@@ -83,7 +97,7 @@ void ColorSpectrum::OnApplyTemplate()
     }
 
     // If we haven't yet created our bitmaps, do so now.
-    if (m_hsvValues.size() == 0)
+    if (m_imageWidthFromLastBitmapCreation == 0)
     {
         CreateBitmapsAndColorMap();
     }
@@ -413,6 +427,11 @@ void ColorSpectrum::OnUnloaded(winrt::IInspectable const& sender, winrt::RoutedE
     // we'll want to synchronously cancel it so we don't have any asynchronous actions
     // lingering beyond our lifetime.
     CancelAsyncAction(m_createImageBitmapAction);
+
+    if (m_bitmapCreationTimer)
+    {
+        m_bitmapCreationTimer.Stop();
+    }
 }
 
 winrt::Rect ColorSpectrum::GetBoundingRectangle()
@@ -488,9 +507,9 @@ void ColorSpectrum::UpdateColor(Hsv newHsv)
 
 void ColorSpectrum::UpdateColorFromPoint(winrt::PointerPoint point)
 {
-    // If we haven't initialized our HSV value array yet, then we should just ignore any user input -
+    // If we haven't created our bitmaps yet, then we should just ignore any user input -
     // we don't yet know what to do with it.
-    if (m_hsvValues.size() == 0)
+    if (m_imageWidthFromLastBitmapCreation == 0)
     {
         return;
     }
@@ -509,10 +528,9 @@ void ColorSpectrum::UpdateColorFromPoint(winrt::PointerPoint point)
         yPosition = (radius / distanceFromRadius) * (yPosition - radius) + radius;
     }
 
-    // Now we need to find the index into the array of HSL values at each point in the spectrum m_image.
+    // Now we need to find the pixel of the spectrum image under the point.
     int x = static_cast<int>(round(xPosition));
     int y = static_cast<int>(round(yPosition));
-    int width = static_cast<int>(round(m_imageWidthFromLastBitmapCreation));
 
     if (x < 0)
     {
@@ -534,7 +552,7 @@ void ColorSpectrum::UpdateColorFromPoint(winrt::PointerPoint point)
 
     // The gradient image contains two dimensions of HSL information, but not the third.
     // We should keep the third where it already was.
-    Hsv hsvAtPoint = m_hsvValues[y * width + x];
+    Hsv hsvAtPoint = GetHsvForPixel(m_spectrumParametersFromLastBitmapCreation, y, x);
 
     auto components = Components();
     auto hsvColor = HsvColor();
@@ -744,8 +762,22 @@ void ColorSpectrum::UpdateEllipse()
 
 void ColorSpectrum::OnLayoutRootSizeChanged(winrt::IInspectable const& /*sender*/, winrt::SizeChangedEventArgs const& /*args*/)
 {
-    // We want ColorSpectrum to always be a square, so we'll take the smaller of the dimensions
-    // and size the sizing grid to that.
+    // Gradient brushes are cheap to resize, but the ring needs its bitmaps regenerated at each new size.
+    // Doing that for every size change of an interactive resize would keep a core busy, so once we have bitmaps,
+    // we stretch them while the size keeps changing and only regenerate them after it settles.
+    if (m_imageWidthFromLastBitmapCreation != 0 &&
+        !m_isSpectrumDrawnWithGradients)
+    {
+        StretchBitmapsAndDeferCreation();
+    }
+    else
+    {
+        CreateBitmapsAndColorMap();
+    }
+}
+
+void ColorSpectrum::OnBitmapCreationTimerTick(winrt::IInspectable const& /*sender*/, winrt::IInspectable const& /*args*/)
+{
     CreateBitmapsAndColorMap();
 }
 
@@ -808,7 +840,7 @@ void ColorSpectrum::OnSelectionEllipseFlowDirectionChanged(winrt::DependencyObje
     UpdateEllipse();
 }
 
-void ColorSpectrum::CreateBitmapsAndColorMap()
+double ColorSpectrum::UpdateSpectrumSize()
 {
     if (!m_layoutRoot ||
         !m_sizingGrid ||
@@ -819,14 +851,16 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
         !m_spectrumOverlayEllipse ||
         SharedHelpers::IsInDesignMode())
     {
-        return;
+        return 0;
     }
 
+    // We want ColorSpectrum to always be a square, so we'll take the smaller of the dimensions
+    // and size the sizing grid to that.
     double minDimension = min(m_layoutRoot.ActualWidth(), m_layoutRoot.ActualHeight());
 
     if (minDimension == 0)
     {
-        return;
+        return 0;
     }
 
     m_sizingGrid.Width(minDimension);
@@ -848,7 +882,59 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
     m_spectrumOverlayEllipse.Width(minDimension);
     m_spectrumOverlayEllipse.Height(minDimension);
 
-    winrt::float4 hsvColor = HsvColor();
+    return minDimension;
+}
+
+void ColorSpectrum::StretchBitmapsAndDeferCreation()
+{
+    const double minDimension = UpdateSpectrumSize();
+
+    if (minDimension == 0)
+    {
+        return;
+    }
+
+    // Bitmaps still being generated for an earlier size would already be out of date.
+    CancelAsyncAction(m_createImageBitmapAction);
+    m_createImageBitmapAction = nullptr;
+    m_bitmapCreationId++;
+
+    // The spectrum brushes stretch the bitmaps we have to the new size, and hit testing only depends on the
+    // geometry of the spectrum, so all that needs to change until the bitmaps are regenerated is the size.
+    m_imageWidthFromLastBitmapCreation = minDimension;
+    m_imageHeightFromLastBitmapCreation = minDimension;
+    m_spectrumParametersFromLastBitmapCreation.minDimension = minDimension;
+    m_spectrumParametersFromLastBitmapCreation.pixelDimension = static_cast<int>(round(minDimension));
+    UpdateEllipse();
+
+    if (!m_bitmapCreationTimer)
+    {
+        m_bitmapCreationTimer = winrt::DispatcherTimer();
+        m_bitmapCreationTimer.Interval(winrt::TimeSpan::duration(s_bitmapCreationDelay));
+        m_bitmapCreationTimer.Tick({ this, &ColorSpectrum::OnBitmapCreationTimerTick });
+    }
+
+    m_bitmapCreationTimer.Stop();
+    m_bitmapCreationTimer.Start();
+}
+
+void ColorSpectrum::CreateBitmapsAndColorMap()
+{
+    SAMPLED_PERF_TRACE_SCOPE("ColorSpectrum.CreateBitmaps");
+
+    // Whatever we were waiting for the size to settle for, we're about to do now.
+    if (m_bitmapCreationTimer)
+    {
+        m_bitmapCreationTimer.Stop();
+    }
+
+    const double minDimension = UpdateSpectrumSize();
+
+    if (minDimension == 0)
+    {
+        return;
+    }
+
     int minHue = MinHue();
     int maxHue = MaxHue();
     int minSaturation = MinSaturation();
@@ -874,36 +960,42 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
         maxValue = minValue;
     }
 
-    Hsv hsv = { hsv::GetHue(hsvColor), hsv::GetSaturation(hsvColor), hsv::GetValue(hsvColor) };
+    m_bitmapCreationId++;
 
-    // The middle 4 are only needed and used in the case of hue as the third dimension.
-    // Saturation and luminosity need only a min and max.
-    shared_ptr<vector<::byte>> bgraMinPixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle1PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle2PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle3PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMiddle4PixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<::byte>> bgraMaxPixelData = make_shared<vector<::byte>>();
-    shared_ptr<vector<Hsv>> newHsvValues = make_shared<vector<Hsv>>();
+    const SpectrumBitmapCacheKey cacheKey{ minDimension, shape, components, minHue, maxHue, minSaturation, maxSaturation, minValue, maxValue };
 
-    bgraMinPixelData->reserve(static_cast<size_t>(minDimension * minDimension * 4));
+    // Gradient brushes scale to any size and are cheap to update, so a box spectrum doesn't need any bitmaps.
+    if (shape == winrt::ColorSpectrumShape::Box)
+    {
+        CancelAsyncAction(m_createImageBitmapAction);
+        m_createImageBitmapAction = nullptr;
 
-    // We'll only save pixel data for the middle bitmaps if our third dimension is hue.
-    if (components == winrt::ColorSpectrumComponents::ValueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationValue)
+        m_isSpectrumDrawnWithGradients = true;
+        UpdateStateFromLastBitmapCreation(cacheKey);
+        UpdateBitmapSources();
+        UpdateEllipse();
+        return;
+    }
+
+    // Another ColorSpectrum, or this one at an earlier size, may already have generated exactly these bitmaps.
+    if (auto cachedBitmaps = FindCachedSpectrumBitmaps(cacheKey))
     {
-        bgraMiddle1PixelData->reserve(static_cast<size_t>(minDimension * minDimension * 4));
-        bgraMiddle2PixelData->reserve(static_cast<size_t>(minDimension * minDimension * 4));
-        bgraMiddle3PixelData->reserve(static_cast<size_t>(minDimension * minDimension * 4));
-        bgraMiddle4PixelData->reserve(static_cast<size_t>(minDimension * minDimension * 4));
+        CancelAsyncAction(m_createImageBitmapAction);
+        m_createImageBitmapAction = nullptr;
+
+        ApplySpectrumBitmaps(cacheKey, *cachedBitmaps);
+        return;
     }
 
-    bgraMaxPixelData->reserve(static_cast<size_t>(minDimension * minDimension * 4));
-    newHsvValues->reserve(static_cast<size_t>(minDimension * minDimension));
+    auto data = CreateSpectrumBitmapData(cacheKey);
+
+    // Rows don't depend on each other, so we spread them over one work item per processor.
+    SYSTEM_INFO systemInfo{};
+    GetSystemInfo(&systemInfo);
+    const int workItemCount = max(1, min(static_cast<int>(systemInfo.dwNumberOfProcessors), data->pixelDimension));
 
     winrt::WorkItemHandler workItemHandler(
-        [minDimension, hsv, minHue, maxHue, minSaturation, maxSaturation, minValue, maxValue, shape, components,
-        bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData, newHsvValues]
+        [data, workItemCount]
     (winrt::IAsyncAction workItem)
     {
         // As the user perceives it, every time the third dimension not represented in the ColorSpectrum changes,
@@ -920,41 +1012,44 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
         // We'll then blend between whichever colors our hue exists between - e.g., an orange color would use red and yellow with an opacity of 50%.
         // This optimization does incur slightly more startup time initially since we have to generate multiple bitmaps at once instead of only one,
         // but the running time savings after that are *huge* when we can just set an opacity instead of generating a brand new bitmap.
-        if (shape == winrt::ColorSpectrumShape::Box)
+        //
+        // Each work item repeatedly claims the next unfilled row until none are left, so a slow worker never holds up the others.
+        // Cancellation is checked once per row.
+        auto nextRow = make_shared<atomic<int>>(0);
+        auto fillRows = [data, nextRow, workItem]()
         {
-            for (double x = minDimension - 1; x >= 0; --x)
+            vector<Hsv> hsvRow(data->pixelDimension);
+            vector<Hsv> scratchHsvRow(data->pixelDimension);
+
+            for (int row = (*nextRow)++; row < data->pixelDimension; row = (*nextRow)++)
             {
-                for (double y = minDimension - 1; y >= 0; --y)
+                if (workItem.Status() == winrt::AsyncStatus::Canceled)
                 {
-                    if (workItem.Status() == winrt::AsyncStatus::Canceled)
-                    {
-                        break;
-                    }
-
-                    ColorSpectrum::FillPixelForBox(
-                        x, y, hsv, minDimension, components, minHue, maxHue, minSaturation, maxSaturation, minValue, maxValue,
-                        bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData,
-                        newHsvValues);
+                    break;
                 }
+
+                ColorSpectrum::FillRow(*data, row, hsvRow, scratchHsvRow);
             }
-        }
-        else
+        };
+
+        vector<winrt::IAsyncAction> helperWorkItems;
+        helperWorkItems.reserve(workItemCount - 1);
+
+        for (int i = 1; i < workItemCount; i++)
         {
-            for (double y = 0; y < minDimension; ++y)
+            helperWorkItems.push_back(winrt::ThreadPool::RunAsync(winrt::WorkItemHandler(
+                [fillRows](winrt::IAsyncAction)
             {
-                for (double x = 0; x < minDimension; ++x)
-                {
-                    if (workItem.Status() == winrt::AsyncStatus::Canceled)
-                    {
-                        break;
-                    }
-
-                    ColorSpectrum::FillPixelForRing(
-                        x, y, minDimension / 2, hsv, components, minHue, maxHue, minSaturation, maxSaturation, minValue, maxValue,
-                        bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData,
-                        newHsvValues);
-                }
-            }
+                fillRows();
+            })));
+        }
+
+        fillRows();
+
+        // The bitmaps are only complete once every helper has finished its last row.
+        for (auto& helperWorkItem : helperWorkItems)
+        {
+            helperWorkItem.get();
         }
     });
 
@@ -965,8 +1060,9 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
 
     m_createImageBitmapAction = winrt::ThreadPool::RunAsync(workItemHandler);
     auto strongThis = get_strong();
+    const unsigned int bitmapCreationId = m_bitmapCreationId;
     m_createImageBitmapAction.Completed(winrt::AsyncActionCompletedHandler(
-        [strongThis, minDimension, components, bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData, newHsvValues]
+        [strongThis, data, cacheKey, bitmapCreationId]
     (winrt::IAsyncAction asyncInfo, winrt::AsyncStatus asyncStatus)
     {
         if (asyncStatus != winrt::AsyncStatus::Completed)
@@ -974,277 +1070,330 @@ void ColorSpectrum::CreateBitmapsAndColorMap()
             return;
         }
 
-        strongThis->m_createImageBitmapAction = nullptr;
-
         strongThis->m_dispatcherHelper.RunAsync(
-            [strongThis, minDimension, bgraMinPixelData, bgraMiddle1PixelData, bgraMiddle2PixelData, bgraMiddle3PixelData, bgraMiddle4PixelData, bgraMaxPixelData, newHsvValues]()
+            [strongThis, data, cacheKey, bitmapCreationId]()
         {
-            int pixelWidth = static_cast<int>(round(minDimension));
-            int pixelHeight = static_cast<int>(round(minDimension));
+            const size_t bitmapByteCount =
+                data->bgraMinPixelData->size() +
+                data->bgraMiddle1PixelData->size() +
+                data->bgraMiddle2PixelData->size() +
+                data->bgraMiddle3PixelData->size() +
+                data->bgraMiddle4PixelData->size() +
+                data->bgraMaxPixelData->size();
+
+            auto bitmaps = CreateSpectrumBitmaps(*data);
+            CacheSpectrumBitmaps(cacheKey, bitmaps, bitmapByteCount);
+
+            // The bitmaps are still worth caching if a newer request superseded this one in the meantime,
+            // but they are no longer the ones we want to display.
+            if (bitmapCreationId == strongThis->m_bitmapCreationId)
+            {
+                strongThis->m_createImageBitmapAction = nullptr;
+                strongThis->ApplySpectrumBitmaps(cacheKey, *bitmaps);
+            }
+        }, false /* fallbackToThisThread */, DispatcherHelper::Priority::Low);
+    }));
+}
 
-            winrt::ColorSpectrumComponents components = strongThis->Components();
+shared_ptr<const ColorSpectrum::SpectrumBitmaps> ColorSpectrum::CreateSpectrumBitmaps(const SpectrumBitmapData &data)
+{
+    const int pixelWidth = data.pixelDimension;
+    const int pixelHeight = data.pixelDimension;
 
-            if (SharedHelpers::IsRS2OrHigher())
-            {
-                winrt::LoadedImageSurface minSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMinPixelData);
-                winrt::LoadedImageSurface maxSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMaxPixelData);
+    // When saturation is the third dimension, only the maximum bitmap is displayed.
+    const bool usesMinBitmap =
+        data.components != winrt::ColorSpectrumComponents::HueSaturation &&
+        data.components != winrt::ColorSpectrumComponents::SaturationHue;
+    const bool usesMiddleBitmaps =
+        data.components == winrt::ColorSpectrumComponents::ValueSaturation ||
+        data.components == winrt::ColorSpectrumComponents::SaturationValue;
 
-                switch (components)
-                {
-                case winrt::ColorSpectrumComponents::HueValue:
-                case winrt::ColorSpectrumComponents::ValueHue:
-                    strongThis->m_saturationMinimumSurface = minSurface;
-                    strongThis->m_saturationMaximumSurface = maxSurface;
-                    break;
-                case winrt::ColorSpectrumComponents::HueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationHue:
-                    strongThis->m_valueSurface = maxSurface;
-                    break;
-                case winrt::ColorSpectrumComponents::ValueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationValue:
-                    strongThis->m_hueRedSurface = minSurface;
-                    strongThis->m_hueYellowSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle1PixelData);
-                    strongThis->m_hueGreenSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle2PixelData);
-                    strongThis->m_hueCyanSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle3PixelData);
-                    strongThis->m_hueBlueSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, bgraMiddle4PixelData);
-                    strongThis->m_huePurpleSurface = maxSurface;
-                    break;
-                }
-            }
-            else
-            {
-                winrt::WriteableBitmap minBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMinPixelData);
-                winrt::WriteableBitmap maxBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMaxPixelData);
+    auto bitmaps = make_shared<SpectrumBitmaps>();
 
-                switch (components)
-                {
-                case winrt::ColorSpectrumComponents::HueValue:
-                case winrt::ColorSpectrumComponents::ValueHue:
-                    strongThis->m_saturationMinimumBitmap = minBitmap;
-                    strongThis->m_saturationMaximumBitmap = maxBitmap;
-                    break;
-                case winrt::ColorSpectrumComponents::HueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationHue:
-                    strongThis->m_valueBitmap = maxBitmap;
-                    break;
-                case winrt::ColorSpectrumComponents::ValueSaturation:
-                case winrt::ColorSpectrumComponents::SaturationValue:
-                    strongThis->m_hueRedBitmap = minBitmap;
-                    strongThis->m_hueYellowBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle1PixelData);
-                    strongThis->m_hueGreenBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle2PixelData);
-                    strongThis->m_hueCyanBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle3PixelData);
-                    strongThis->m_hueBlueBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, bgraMiddle4PixelData);
-                    strongThis->m_huePurpleBitmap = maxBitmap;
-                    break;
-                }
-            }
+    if (SharedHelpers::IsRS2OrHigher())
+    {
+        if (usesMinBitmap)
+        {
+            bitmaps->minSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, data.bgraMinPixelData);
+        }
 
-            strongThis->m_shapeFromLastBitmapCreation = strongThis->Shape();
-            strongThis->m_componentsFromLastBitmapCreation = strongThis->Components();
-            strongThis->m_imageWidthFromLastBitmapCreation = minDimension;
-            strongThis->m_imageHeightFromLastBitmapCreation = minDimension;
-            strongThis->m_minHueFromLastBitmapCreation = strongThis->MinHue();
-            strongThis->m_maxHueFromLastBitmapCreation = strongThis->MaxHue();
-            strongThis->m_minSaturationFromLastBitmapCreation = strongThis->MinSaturation();
-            strongThis->m_maxSaturationFromLastBitmapCreation = strongThis->MaxSaturation();
-            strongThis->m_minValueFromLastBitmapCreation = strongThis->MinValue();
-            strongThis->m_maxValueFromLastBitmapCreation = strongThis->MaxValue();
-
-            strongThis->m_hsvValues = *newHsvValues;
-
-            strongThis->UpdateBitmapSources();
-            strongThis->UpdateEllipse();
-        });
-    }));
+        if (usesMiddleBitmaps)
+        {
+            bitmaps->middle1Surface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle1PixelData);
+            bitmaps->middle2Surface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle2PixelData);
+            bitmaps->middle3Surface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle3PixelData);
+            bitmaps->middle4Surface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle4PixelData);
+        }
+
+        bitmaps->maxSurface = CreateSurfaceFromPixelData(pixelWidth, pixelHeight, data.bgraMaxPixelData);
+    }
+    else
+    {
+        if (usesMinBitmap)
+        {
+            bitmaps->minBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, data.bgraMinPixelData);
+        }
+
+        if (usesMiddleBitmaps)
+        {
+            bitmaps->middle1Bitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle1PixelData);
+            bitmaps->middle2Bitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle2PixelData);
+            bitmaps->middle3Bitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle3PixelData);
+            bitmaps->middle4Bitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, data.bgraMiddle4PixelData);
+        }
+
+        bitmaps->maxBitmap = CreateBitmapFromPixelData(pixelWidth, pixelHeight, data.bgraMaxPixelData);
+    }
+
+    return bitmaps;
 }
 
-void ColorSpectrum::FillPixelForBox(
-    double x,
-    double y,
-    const Hsv &baseHsv,
-    double minDimension,
-    winrt::ColorSpectrumComponents components,
-    double minHue,
-    double maxHue,
-    double minSaturation,
-    double maxSaturation,
-    double minValue,
-    double maxValue,
-    shared_ptr<vector<::byte>> bgraMinPixelData,
-    shared_ptr<vector<::byte>> bgraMiddle1PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle2PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle3PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle4PixelData,
-    shared_ptr<vector<::byte>> bgraMaxPixelData,
-    shared_ptr<vector<Hsv>> newHsvValues)
+void ColorSpectrum::ApplySpectrumBitmaps(const SpectrumBitmapCacheKey &key, const SpectrumBitmaps &bitmaps)
 {
-    double hMin = minHue;
-    double hMax = maxHue;
-    double sMin = minSaturation / 100.0;
-    double sMax = maxSaturation / 100.0;
-    double vMin = minValue / 100.0;
-    double vMax = maxValue / 100.0;
-
-    Hsv hsvMin = baseHsv;
-    Hsv hsvMiddle1 = baseHsv;
-    Hsv hsvMiddle2 = baseHsv;
-    Hsv hsvMiddle3 = baseHsv;
-    Hsv hsvMiddle4 = baseHsv;
-    Hsv hsvMax = baseHsv;
-
-    double xPercent = (minDimension - 1 - x) / (minDimension - 1);
-    double yPercent = (minDimension - 1 - y) / (minDimension - 1);
-
-    switch (components)
+    switch (key.components)
     {
     case winrt::ColorSpectrumComponents::HueValue:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + yPercent * (hMax - hMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + xPercent * (vMax - vMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
+    case winrt::ColorSpectrumComponents::ValueHue:
+        m_saturationMinimumSurface = bitmaps.minSurface;
+        m_saturationMaximumSurface = bitmaps.maxSurface;
+        m_saturationMinimumBitmap = bitmaps.minBitmap;
+        m_saturationMaximumBitmap = bitmaps.maxBitmap;
         break;
-
     case winrt::ColorSpectrumComponents::HueSaturation:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + yPercent * (hMax - hMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + xPercent * (sMax - sMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
-        break;
-
-    case winrt::ColorSpectrumComponents::ValueHue:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + yPercent * (vMax - vMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + xPercent * (hMax - hMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
+    case winrt::ColorSpectrumComponents::SaturationHue:
+        m_valueSurface = bitmaps.maxSurface;
+        m_valueBitmap = bitmaps.maxBitmap;
         break;
-
     case winrt::ColorSpectrumComponents::ValueSaturation:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + yPercent * (vMax - vMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + xPercent * (sMax - sMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
+    case winrt::ColorSpectrumComponents::SaturationValue:
+        m_hueRedSurface = bitmaps.minSurface;
+        m_hueYellowSurface = bitmaps.middle1Surface;
+        m_hueGreenSurface = bitmaps.middle2Surface;
+        m_hueCyanSurface = bitmaps.middle3Surface;
+        m_hueBlueSurface = bitmaps.middle4Surface;
+        m_huePurpleSurface = bitmaps.maxSurface;
+        m_hueRedBitmap = bitmaps.minBitmap;
+        m_hueYellowBitmap = bitmaps.middle1Bitmap;
+        m_hueGreenBitmap = bitmaps.middle2Bitmap;
+        m_hueCyanBitmap = bitmaps.middle3Bitmap;
+        m_hueBlueBitmap = bitmaps.middle4Bitmap;
+        m_huePurpleBitmap = bitmaps.maxBitmap;
         break;
+    }
 
-    case winrt::ColorSpectrumComponents::SaturationHue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + yPercent * (sMax - sMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + xPercent * (hMax - hMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
-        break;
+    // On RS2 and later, the SpectrumBrush draws both bitmaps by itself and nothing else fills the overlay.
+    if (m_isSpectrumDrawnWithGradients && m_spectrumOverlayRectangle)
+    {
+        m_spectrumOverlayRectangle.Fill(nullptr);
+    }
 
-    case winrt::ColorSpectrumComponents::SaturationValue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + yPercent * (sMax - sMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + xPercent * (vMax - vMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
-        break;
+    m_isSpectrumDrawnWithGradients = false;
+    UpdateStateFromLastBitmapCreation(key);
+    UpdateBitmapSources();
+    UpdateEllipse();
+}
+
+void ColorSpectrum::UpdateStateFromLastBitmapCreation(const SpectrumBitmapCacheKey &key)
+{
+    m_shapeFromLastBitmapCreation = key.shape;
+    m_componentsFromLastBitmapCreation = key.components;
+    m_imageWidthFromLastBitmapCreation = key.minDimension;
+    m_imageHeightFromLastBitmapCreation = key.minDimension;
+    m_minHueFromLastBitmapCreation = MinHue();
+    m_maxHueFromLastBitmapCreation = MaxHue();
+    m_minSaturationFromLastBitmapCreation = MinSaturation();
+    m_maxSaturationFromLastBitmapCreation = MaxSaturation();
+    m_minValueFromLastBitmapCreation = MinValue();
+    m_maxValueFromLastBitmapCreation = MaxValue();
+    m_spectrumParametersFromLastBitmapCreation = GetSpectrumParameters(key);
+}
+
+bool ColorSpectrum::SpectrumBitmapCacheKey::operator==(const SpectrumBitmapCacheKey& other) const
+{
+    return
+        minDimension == other.minDimension &&
+        shape == other.shape &&
+        components == other.components &&
+        minHue == other.minHue &&
+        maxHue == other.maxHue &&
+        minSaturation == other.minSaturation &&
+        maxSaturation == other.maxSaturation &&
+        minValue == other.minValue &&
+        maxValue == other.maxValue;
+}
+
+shared_ptr<const ColorSpectrum::SpectrumBitmaps> ColorSpectrum::FindCachedSpectrumBitmaps(const SpectrumBitmapCacheKey &key)
+{
+    auto entry = find_if(s_spectrumBitmapCache.begin(), s_spectrumBitmapCache.end(),
+        [&key](const SpectrumBitmapCacheEntry& entry) { return entry.key == key; });
+
+    if (entry == s_spectrumBitmapCache.end())
+    {
+        return nullptr;
     }
 
-    // If saturation is an axis in the spectrum with hue, or value is an axis, then we want
-    // that axis to go from maximum at the top to minimum at the bottom,
-    // or maximum at the outside to minimum at the inside in the case of the ring configuration,
-    // so we'll invert the number before assigning the HSL value to the array.
-    // Otherwise, we'll have a very narrow section in the middle that actually has meaningful hue
-    // in the case of the ring configuration.
-    if (components == winrt::ColorSpectrumComponents::HueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationHue)
+    // Surfaces created on a device that has since been lost no longer have any contents.
+    if (SharedHelpers::IsRS2OrHigher() &&
+        entry->surfaceUploadDeviceGeneration != GetSurfaceUploadDeviceGeneration())
     {
-        hsvMin.s = sMax - hsvMin.s + sMin;
-        hsvMiddle1.s = sMax - hsvMiddle1.s + sMin;
-        hsvMiddle2.s = sMax - hsvMiddle2.s + sMin;
-        hsvMiddle3.s = sMax - hsvMiddle3.s + sMin;
-        hsvMiddle4.s = sMax - hsvMiddle4.s + sMin;
-        hsvMax.s = sMax - hsvMax.s + sMin;
+        s_spectrumBitmapCacheByteCount -= entry->byteCount;
+        s_spectrumBitmapCache.erase(entry);
+        return nullptr;
     }
-    else
+
+    // The most recently used entry lives at the back.
+    rotate(entry, entry + 1, s_spectrumBitmapCache.end());
+    return s_spectrumBitmapCache.back().bitmaps;
+}
+
+void ColorSpectrum::CacheSpectrumBitmaps(const SpectrumBitmapCacheKey &key, const shared_ptr<const SpectrumBitmaps> &bitmaps, size_t byteCount)
+{
+    // A spectrum that wouldn't fit even on its own isn't worth evicting everything else for.
+    if (byteCount > s_spectrumBitmapCacheByteLimit)
+    {
+        return;
+    }
+
+    auto existingEntry = find_if(s_spectrumBitmapCache.begin(), s_spectrumBitmapCache.end(),
+        [&key](const SpectrumBitmapCacheEntry& entry) { return entry.key == key; });
+
+    if (existingEntry != s_spectrumBitmapCache.end())
+    {
+        s_spectrumBitmapCacheByteCount -= existingEntry->byteCount;
+        s_spectrumBitmapCache.erase(existingEntry);
+    }
+
+    while (!s_spectrumBitmapCache.empty() &&
+        s_spectrumBitmapCacheByteCount + byteCount > s_spectrumBitmapCacheByteLimit)
+    {
+        s_spectrumBitmapCacheByteCount -= s_spectrumBitmapCache.front().byteCount;
+        s_spectrumBitmapCache.erase(s_spectrumBitmapCache.begin());
+    }
+
+    s_spectrumBitmapCache.push_back({ key, bitmaps, byteCount, GetSurfaceUploadDeviceGeneration() });
+    s_spectrumBitmapCacheByteCount += byteCount;
+}
+
+shared_ptr<ColorSpectrum::SpectrumBitmapData> ColorSpectrum::CreateSpectrumBitmapData(const SpectrumBitmapCacheKey &key)
+{
+    auto data = make_shared<SpectrumBitmapData>();
+    static_cast<SpectrumParameters&>(*data) = GetSpectrumParameters(key);
+
+    const size_t pixelCount = static_cast<size_t>(data->pixelDimension) * data->pixelDimension;
+
+    // The middle 4 are only needed and used in the case of hue as the third dimension.
+    // Saturation and luminosity need only a min and max.
+    const size_t middlePixelCount =
+        key.components == winrt::ColorSpectrumComponents::ValueSaturation ||
+        key.components == winrt::ColorSpectrumComponents::SaturationValue ? pixelCount : 0;
+
+    data->bgraMinPixelData = make_shared<vector<::byte>>(pixelCount * 4);
+    data->bgraMiddle1PixelData = make_shared<vector<::byte>>(middlePixelCount * 4);
+    data->bgraMiddle2PixelData = make_shared<vector<::byte>>(middlePixelCount * 4);
+    data->bgraMiddle3PixelData = make_shared<vector<::byte>>(middlePixelCount * 4);
+    data->bgraMiddle4PixelData = make_shared<vector<::byte>>(middlePixelCount * 4);
+    data->bgraMaxPixelData = make_shared<vector<::byte>>(pixelCount * 4);
+
+    return data;
+}
+
+ColorSpectrum::SpectrumParameters ColorSpectrum::GetSpectrumParameters(const SpectrumBitmapCacheKey &key)
+{
+    SpectrumParameters parameters;
+    parameters.minDimension = key.minDimension;
+    parameters.pixelDimension = static_cast<int>(round(key.minDimension));
+    parameters.shape = key.shape;
+    parameters.components = key.components;
+    parameters.minHue = key.minHue;
+    parameters.maxHue = key.maxHue;
+    parameters.minSaturation = key.minSaturation / 100.0;
+    parameters.maxSaturation = key.maxSaturation / 100.0;
+    parameters.minValue = key.minValue / 100.0;
+    parameters.maxValue = key.maxValue / 100.0;
+    return parameters;
+}
+
+void ColorSpectrum::FillRow(const SpectrumBitmapData &data, int row, vector<Hsv> &hsvRow, vector<Hsv> &scratchHsvRow)
+{
+    const int pixelDimension = data.pixelDimension;
+    const size_t pixelOffset = static_cast<size_t>(row) * pixelDimension;
+
+    // Each pixel's HSV value has the third dimension at its minimum, which is exactly what the min bitmap displays.
+    for (int column = 0; column < pixelDimension; column++)
     {
-        hsvMin.v = vMax - hsvMin.v + vMin;
-        hsvMiddle1.v = vMax - hsvMiddle1.v + vMin;
-        hsvMiddle2.v = vMax - hsvMiddle2.v + vMin;
-        hsvMiddle3.v = vMax - hsvMiddle3.v + vMin;
-        hsvMiddle4.v = vMax - hsvMiddle4.v + vMin;
-        hsvMax.v = vMax - hsvMax.v + vMin;
+        hsvRow[column] = GetHsvForPixel(data, row, column);
     }
 
-    newHsvValues->push_back(hsvMin);
+    HsvToBgra(hsvRow.data(), data.bgraMinPixelData->data() + pixelOffset * 4, pixelDimension);
 
-    Rgb rgbMin = HsvToRgb(hsvMin);
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.b * 255))); // b
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.g * 255))); // g
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.r * 255))); // r
-    bgraMinPixelData->push_back(255); // a - ignored
+    // Every other bitmap shares the same two dimensions and only differs in the value of the third one.
+    auto fillBitmapRow = [&](double thirdDimensionValue, vector<::byte> &bgraPixelData)
+    {
+        for (int i = 0; i < pixelDimension; i++)
+        {
+            Hsv hsv = hsvRow[i];
+
+            switch (data.components)
+            {
+            case winrt::ColorSpectrumComponents::HueValue:
+            case winrt::ColorSpectrumComponents::ValueHue:
+                hsv.s = thirdDimensionValue;
+                break;
+
+            case winrt::ColorSpectrumComponents::HueSaturation:
+            case winrt::ColorSpectrumComponents::SaturationHue:
+                hsv.v = thirdDimensionValue;
+                break;
+
+            case winrt::ColorSpectrumComponents::ValueSaturation:
+            case winrt::ColorSpectrumComponents::SaturationValue:
+                hsv.h = thirdDimensionValue;
+                break;
+            }
+
+            scratchHsvRow[i] = hsv;
+        }
+
+        HsvToBgra(scratchHsvRow.data(), bgraPixelData.data() + pixelOffset * 4, pixelDimension);
+    };
 
     // We'll only save pixel data for the middle bitmaps if our third dimension is hue.
-    if (components == winrt::ColorSpectrumComponents::ValueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationValue)
-    {
-        Rgb rgbMiddle1 = HsvToRgb(hsvMiddle1);
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.b * 255))); // b
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.g * 255))); // g
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.r * 255))); // r
-        bgraMiddle1PixelData->push_back(255); // a - ignored
-
-        Rgb rgbMiddle2 = HsvToRgb(hsvMiddle2);
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.b * 255))); // b
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.g * 255))); // g
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.r * 255))); // r
-        bgraMiddle2PixelData->push_back(255); // a - ignored
-
-        Rgb rgbMiddle3 = HsvToRgb(hsvMiddle3);
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.b * 255))); // b
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.g * 255))); // g
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.r * 255))); // r
-        bgraMiddle3PixelData->push_back(255); // a - ignored
-
-        Rgb rgbMiddle4 = HsvToRgb(hsvMiddle4);
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.b * 255))); // b
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.g * 255))); // g
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.r * 255))); // r
-        bgraMiddle4PixelData->push_back(255); // a - ignored
-    }
-
-    Rgb rgbMax = HsvToRgb(hsvMax);
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.b * 255))); // b
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.g * 255))); // g
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.r * 255))); // r
-    bgraMaxPixelData->push_back(255); // a - ignored
+    if (data.components == winrt::ColorSpectrumComponents::ValueSaturation ||
+        data.components == winrt::ColorSpectrumComponents::SaturationValue)
+    {
+        fillBitmapRow(60, *data.bgraMiddle1PixelData);
+        fillBitmapRow(120, *data.bgraMiddle2PixelData);
+        fillBitmapRow(180, *data.bgraMiddle3PixelData);
+        fillBitmapRow(240, *data.bgraMiddle4PixelData);
+        fillBitmapRow(300, *data.bgraMaxPixelData);
+    }
+    else
+    {
+        fillBitmapRow(1, *data.bgraMaxPixelData);
+    }
 }
 
-void ColorSpectrum::FillPixelForRing(
-    double x,
-    double y,
-    double radius,
-    const Hsv &baseHsv,
-    winrt::ColorSpectrumComponents components,
-    double minHue,
-    double maxHue,
-    double minSaturation,
-    double maxSaturation,
-    double minValue,
-    double maxValue,
-    shared_ptr<vector<::byte>> bgraMinPixelData,
-    shared_ptr<vector<::byte>> bgraMiddle1PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle2PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle3PixelData,
-    shared_ptr<vector<::byte>> bgraMiddle4PixelData,
-    shared_ptr<vector<::byte>> bgraMaxPixelData,
-    shared_ptr<vector<Hsv>> newHsvValues)
+Hsv ColorSpectrum::GetHsvForPixel(const SpectrumParameters &parameters, int row, int column)
 {
-    double hMin = minHue;
-    double hMax = maxHue;
-    double sMin = minSaturation / 100.0;
-    double sMax = maxSaturation / 100.0;
-    double vMin = minValue / 100.0;
-    double vMax = maxValue / 100.0;
+    return parameters.shape == winrt::ColorSpectrumShape::Box ?
+        GetHsvForBoxPixel(parameters, row, column) :
+        GetHsvForRingPixel(parameters, row, column);
+}
+
+Hsv ColorSpectrum::GetHsvForBoxPixel(const SpectrumParameters &parameters, int row, int column)
+{
+    // Rows go from the minimum to the maximum of the first dimension and columns from the minimum to the maximum of the second.
+    const double xPercent = row / (parameters.minDimension - 1);
+    const double yPercent = column / (parameters.minDimension - 1);
+
+    return GetHsvForSpectrumPosition(parameters, xPercent, yPercent);
+}
 
+Hsv ColorSpectrum::GetHsvForRingPixel(const SpectrumParameters &parameters, int row, int column)
+{
+    const double radius = parameters.minDimension / 2;
+    const double x = column;
+    const double y = row;
     double distanceFromRadius = sqrt(pow(x - radius, 2) + pow(y - radius, 2));
 
     double xToUse = x;
@@ -1261,14 +1410,7 @@ void ColorSpectrum::FillPixelForRing(
         distanceFromRadius = radius;
     }
 
-    Hsv hsvMin = baseHsv;
-    Hsv hsvMiddle1 = baseHsv;
-    Hsv hsvMiddle2 = baseHsv;
-    Hsv hsvMiddle3 = baseHsv;
-    Hsv hsvMiddle4 = baseHsv;
-    Hsv hsvMax = baseHsv;
-
-    double r = 1 - distanceFromRadius / radius;
+    const double r = 1 - distanceFromRadius / radius;
 
     double theta = atan2((radius - yToUse), (radius - xToUse)) * 180.0 / M_PI;
     theta += 180.0;
@@ -1279,58 +1421,57 @@ void ColorSpectrum::FillPixelForRing(
         theta -= 360;
     }
 
-    double thetaPercent = theta / 360;
+    return GetHsvForSpectrumPosition(parameters, r, theta / 360);
+}
 
-    switch (components)
+Hsv ColorSpectrum::GetHsvForSpectrumPosition(const SpectrumParameters &parameters, double primaryPercent, double secondaryPercent)
+{
+    const double hMin = parameters.minHue;
+    const double hMax = parameters.maxHue;
+    const double sMin = parameters.minSaturation;
+    const double sMax = parameters.maxSaturation;
+    const double vMin = parameters.minValue;
+    const double vMax = parameters.maxValue;
+
+    // The third dimension is left at its minimum.  FillRow() produces the other bitmaps from this value.
+    Hsv hsv(0, 0, 0);
+
+    switch (parameters.components)
     {
     case winrt::ColorSpectrumComponents::HueValue:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + thetaPercent * (hMax - hMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + r * (vMax - vMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
+        hsv.h = hMin + secondaryPercent * (hMax - hMin);
+        hsv.v = vMin + primaryPercent * (vMax - vMin);
+        hsv.s = 0;
         break;
 
     case winrt::ColorSpectrumComponents::HueSaturation:
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + thetaPercent * (hMax - hMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + r * (sMax - sMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
+        hsv.h = hMin + secondaryPercent * (hMax - hMin);
+        hsv.s = sMin + primaryPercent * (sMax - sMin);
+        hsv.v = 0;
         break;
 
     case winrt::ColorSpectrumComponents::ValueHue:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + thetaPercent * (vMax - vMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + r * (hMax - hMin);
-        hsvMin.s = 0;
-        hsvMax.s = 1;
+        hsv.v = vMin + secondaryPercent * (vMax - vMin);
+        hsv.h = hMin + primaryPercent * (hMax - hMin);
+        hsv.s = 0;
         break;
 
     case winrt::ColorSpectrumComponents::ValueSaturation:
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + thetaPercent * (vMax - vMin);
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + r * (sMax - sMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
+        hsv.v = vMin + secondaryPercent * (vMax - vMin);
+        hsv.s = sMin + primaryPercent * (sMax - sMin);
+        hsv.h = 0;
         break;
 
     case winrt::ColorSpectrumComponents::SaturationHue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + thetaPercent * (sMax - sMin);
-        hsvMin.h = hsvMiddle1.h = hsvMiddle2.h = hsvMiddle3.h = hsvMiddle4.h = hsvMax.h = hMin + r * (hMax - hMin);
-        hsvMin.v = 0;
-        hsvMax.v = 1;
+        hsv.s = sMin + secondaryPercent * (sMax - sMin);
+        hsv.h = hMin + primaryPercent * (hMax - hMin);
+        hsv.v = 0;
         break;
 
     case winrt::ColorSpectrumComponents::SaturationValue:
-        hsvMin.s = hsvMiddle1.s = hsvMiddle2.s = hsvMiddle3.s = hsvMiddle4.s = hsvMax.s = sMin + thetaPercent * (sMax - sMin);
-        hsvMin.v = hsvMiddle1.v = hsvMiddle2.v = hsvMiddle3.v = hsvMiddle4.v = hsvMax.v = vMin + r * (vMax - vMin);
-        hsvMin.h = 0;
-        hsvMiddle1.h = 60;
-        hsvMiddle2.h = 120;
-        hsvMiddle3.h = 180;
-        hsvMiddle4.h = 240;
-        hsvMax.h = 300;
+        hsv.s = sMin + secondaryPercent * (sMax - sMin);
+        hsv.v = vMin + primaryPercent * (vMax - vMin);
+        hsv.h = 0;
         break;
     }
 
@@ -1340,78 +1481,35 @@ void ColorSpectrum::FillPixelForRing(
     // so we'll invert the number before assigning the HSL value to the array.
     // Otherwise, we'll have a very narrow section in the middle that actually has meaningful hue
     // in the case of the ring configuration.
-    if (components == winrt::ColorSpectrumComponents::HueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationHue)
+    if (parameters.components == winrt::ColorSpectrumComponents::HueSaturation ||
+        parameters.components == winrt::ColorSpectrumComponents::SaturationHue)
     {
-        hsvMin.s = sMax - hsvMin.s + sMin;
-        hsvMiddle1.s = sMax - hsvMiddle1.s + sMin;
-        hsvMiddle2.s = sMax - hsvMiddle2.s + sMin;
-        hsvMiddle3.s = sMax - hsvMiddle3.s + sMin;
-        hsvMiddle4.s = sMax - hsvMiddle4.s + sMin;
-        hsvMax.s = sMax - hsvMax.s + sMin;
+        hsv.s = sMax - hsv.s + sMin;
     }
     else
     {
-        hsvMin.v = vMax - hsvMin.v + vMin;
-        hsvMiddle1.v = vMax - hsvMiddle1.v + vMin;
-        hsvMiddle2.v = vMax - hsvMiddle2.v + vMin;
-        hsvMiddle3.v = vMax - hsvMiddle3.v + vMin;
-        hsvMiddle4.v = vMax - hsvMiddle4.v + vMin;
-        hsvMax.v = vMax - hsvMax.v + vMin;
+        hsv.v = vMax - hsv.v + vMin;
     }
 
-    newHsvValues->push_back(hsvMin);
-
-    Rgb rgbMin = HsvToRgb(hsvMin);
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.b * 255))); // b
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.g * 255))); // g
-    bgraMinPixelData->push_back(static_cast<::byte>(round(rgbMin.r * 255))); // r
-    bgraMinPixelData->push_back(255); // a
-
-    // We'll only save pixel data for the middle bitmaps if our third dimension is hue.
-    if (components == winrt::ColorSpectrumComponents::ValueSaturation ||
-        components == winrt::ColorSpectrumComponents::SaturationValue)
-    {
-        Rgb rgbMiddle1 = HsvToRgb(hsvMiddle1);
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.b * 255))); // b
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.g * 255))); // g
-        bgraMiddle1PixelData->push_back(static_cast<::byte>(round(rgbMiddle1.r * 255))); // r
-        bgraMiddle1PixelData->push_back(255); // a
-
-        Rgb rgbMiddle2 = HsvToRgb(hsvMiddle2);
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.b * 255))); // b
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.g * 255))); // g
-        bgraMiddle2PixelData->push_back(static_cast<::byte>(round(rgbMiddle2.r * 255))); // r
-        bgraMiddle2PixelData->push_back(255); // a
-
-        Rgb rgbMiddle3 = HsvToRgb(hsvMiddle3);
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.b * 255))); // b
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.g * 255))); // g
-        bgraMiddle3PixelData->push_back(static_cast<::byte>(round(rgbMiddle3.r * 255))); // r
-        bgraMiddle3PixelData->push_back(255); // a
-
-        Rgb rgbMiddle4 = HsvToRgb(hsvMiddle4);
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.b * 255))); // b
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.g * 255))); // g
-        bgraMiddle4PixelData->push_back(static_cast<::byte>(round(rgbMiddle4.r * 255))); // r
-        bgraMiddle4PixelData->push_back(255); // a
-    }
-
-    Rgb rgbMax = HsvToRgb(hsvMax);
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.b * 255))); // b
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.g * 255))); // g
-    bgraMaxPixelData->push_back(static_cast<::byte>(round(rgbMax.r * 255))); // r
-    bgraMaxPixelData->push_back(255); // a
+    return hsv;
 }
 
 void ColorSpectrum::UpdateBitmapSources()
 {
+    SAMPLED_PERF_TRACE_SCOPE("ColorSpectrum.UpdateBitmapSources");
+
     if (!m_spectrumOverlayRectangle ||
         !m_spectrumOverlayEllipse)
     {
         return;
     }
 
+    if (m_isSpectrumDrawnWithGradients)
+    {
+        UpdateGradientSpectrum();
+        return;
+    }
+
     winrt::float4 hsvColor = HsvColor();
     winrt::ColorSpectrumComponents components = Components();
 
@@ -1613,6 +1711,116 @@ void ColorSpectrum::UpdateBitmapSources()
     }
 }
 
+void ColorSpectrum::UpdateGradientSpectrum()
+{
+    if (!m_spectrumRectangle ||
+        !m_spectrumOverlayRectangle)
+    {
+        return;
+    }
+
+    if (!m_spectrumGradientBrush)
+    {
+        m_spectrumGradientBrush = winrt::LinearGradientBrush();
+        m_spectrumOverlayGradientBrush = winrt::LinearGradientBrush();
+    }
+
+    const SpectrumParameters &parameters = m_spectrumParametersFromLastBitmapCreation;
+    const winrt::float4 hsvColor = HsvColor();
+    const Hsv black(0, 0, 0);
+    const Hsv white(0, 0, 1);
+
+    m_spectrumGradientBrush.GradientStops().Clear();
+    m_spectrumOverlayGradientBrush.GradientStops().Clear();
+
+    // The base brush varies along one axis of the box and the overlay brush along the other one,
+    // fading in black to lower the value or white to lower the saturation.
+    // Between two multiples of 60 degrees, each RGB channel of an HSV color is linear in hue,
+    // so with a gradient stop at each of those hues, this matches what GetHsvForBoxPixel() computes.
+    // The overlay's alpha goes from the third dimension's maximum to its minimum, like the bitmaps did.
+    switch (parameters.components)
+    {
+    case winrt::ColorSpectrumComponents::HueValue:
+        SetGradientDirection(m_spectrumGradientBrush, false /* isVertical */);
+        AddHueGradientStops(m_spectrumGradientBrush, parameters.minHue, parameters.maxHue, hsv::GetSaturation(hsvColor));
+        SetGradientDirection(m_spectrumOverlayGradientBrush, true /* isVertical */);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 0.0, black, 1 - parameters.maxValue);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 1.0, black, 1 - parameters.minValue);
+        break;
+
+    case winrt::ColorSpectrumComponents::ValueHue:
+        SetGradientDirection(m_spectrumGradientBrush, true /* isVertical */);
+        AddHueGradientStops(m_spectrumGradientBrush, parameters.minHue, parameters.maxHue, hsv::GetSaturation(hsvColor));
+        SetGradientDirection(m_spectrumOverlayGradientBrush, false /* isVertical */);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 0.0, black, 1 - parameters.maxValue);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 1.0, black, 1 - parameters.minValue);
+        break;
+
+    case winrt::ColorSpectrumComponents::HueSaturation:
+        SetGradientDirection(m_spectrumGradientBrush, false /* isVertical */);
+        AddHueGradientStops(m_spectrumGradientBrush, parameters.minHue, parameters.maxHue, 1.0);
+        SetGradientDirection(m_spectrumOverlayGradientBrush, true /* isVertical */);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 0.0, white, 1 - parameters.maxSaturation);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 1.0, white, 1 - parameters.minSaturation);
+        break;
+
+    case winrt::ColorSpectrumComponents::SaturationHue:
+        SetGradientDirection(m_spectrumGradientBrush, true /* isVertical */);
+        AddHueGradientStops(m_spectrumGradientBrush, parameters.minHue, parameters.maxHue, 1.0);
+        SetGradientDirection(m_spectrumOverlayGradientBrush, false /* isVertical */);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 0.0, white, 1 - parameters.maxSaturation);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 1.0, white, 1 - parameters.minSaturation);
+        break;
+
+    case winrt::ColorSpectrumComponents::ValueSaturation:
+        SetGradientDirection(m_spectrumGradientBrush, true /* isVertical */);
+        AddGradientStop(m_spectrumGradientBrush, 0.0, { hsv::GetHue(hsvColor), parameters.minSaturation, 1.0 }, 1.0);
+        AddGradientStop(m_spectrumGradientBrush, 1.0, { hsv::GetHue(hsvColor), parameters.maxSaturation, 1.0 }, 1.0);
+        SetGradientDirection(m_spectrumOverlayGradientBrush, false /* isVertical */);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 0.0, black, 1 - parameters.maxValue);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 1.0, black, 1 - parameters.minValue);
+        break;
+
+    case winrt::ColorSpectrumComponents::SaturationValue:
+        SetGradientDirection(m_spectrumGradientBrush, false /* isVertical */);
+        AddGradientStop(m_spectrumGradientBrush, 0.0, { hsv::GetHue(hsvColor), parameters.minSaturation, 1.0 }, 1.0);
+        AddGradientStop(m_spectrumGradientBrush, 1.0, { hsv::GetHue(hsvColor), parameters.maxSaturation, 1.0 }, 1.0);
+        SetGradientDirection(m_spectrumOverlayGradientBrush, true /* isVertical */);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 0.0, black, 1 - parameters.maxValue);
+        AddGradientStop(m_spectrumOverlayGradientBrush, 1.0, black, 1 - parameters.minValue);
+        break;
+    }
+
+    m_spectrumRectangle.Fill(m_spectrumGradientBrush);
+    m_spectrumOverlayRectangle.Fill(m_spectrumOverlayGradientBrush);
+    m_spectrumOverlayRectangle.Opacity(1);
+}
+
+void ColorSpectrum::AddHueGradientStops(const winrt::LinearGradientBrush &brush, double minHue, double maxHue, double saturation)
+{
+    if (minHue >= maxHue)
+    {
+        AddGradientStop(brush, 0.0, { minHue, saturation, 1.0 }, 1.0);
+        AddGradientStop(brush, 1.0, { minHue, saturation, 1.0 }, 1.0);
+        return;
+    }
+
+    AddGradientStop(brush, 0.0, { minHue, saturation, 1.0 }, 1.0);
+
+    for (double hue = (floor(minHue / 60) + 1) * 60; hue < maxHue; hue += 60)
+    {
+        AddGradientStop(brush, (hue - minHue) / (maxHue - minHue), { hue, saturation, 1.0 }, 1.0);
+    }
+
+    AddGradientStop(brush, 1.0, { maxHue, saturation, 1.0 }, 1.0);
+}
+
+void ColorSpectrum::SetGradientDirection(const winrt::LinearGradientBrush &brush, bool isVertical)
+{
+    brush.StartPoint(winrt::Point(0, 0));
+    brush.EndPoint(isVertical ? winrt::Point(0, 1) : winrt::Point(1, 0));
+}
+
 bool ColorSpectrum::SelectionEllipseShouldBeLight()
 {
     // The selection ellipse should be light if and only if the chosen color
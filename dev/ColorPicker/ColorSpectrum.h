@@ -14,6 +14,9 @@ class ColorSpectrum :
     public ReferenceTracker<ColorSpectrum, winrt::implementation::ColorSpectrumT>,
     public ColorSpectrumProperties
 {
+    // Measures the bitmap generation helpers below in isolation.
+    friend class ColorPickerTestApi;
+
 public:
     ColorSpectrum();
 
@@ -50,6 +53,7 @@ private:
 
     // Template part event handlers
     void OnLayoutRootSizeChanged(winrt::IInspectable const& sender, winrt::SizeChangedEventArgs const& args);
+    void OnBitmapCreationTimerTick(winrt::IInspectable const& sender, winrt::IInspectable const& args);
     void OnInputTargetPointerEntered(winrt::IInspectable const& sender, winrt::PointerRoutedEventArgs const& args);
     void OnInputTargetPointerExited(winrt::IInspectable const& sender, winrt::PointerRoutedEventArgs const& args);
     void OnInputTargetPointerMoved(winrt::IInspectable const& sender, winrt::PointerRoutedEventArgs const& args);
@@ -65,57 +69,120 @@ private:
     void UpdateColorFromPoint(winrt::PointerPoint point);
     void UpdateEllipse();
 
+    double UpdateSpectrumSize();
+    void StretchBitmapsAndDeferCreation();
     void CreateBitmapsAndColorMap();
     void UpdateBitmapSources();
+    void UpdateGradientSpectrum();
 
     bool SelectionEllipseShouldBeLight();
 
+    // Everything that determines the contents of the spectrum bitmaps.  The current color doesn't,
+    // since the bitmaps always span the whole range of the third dimension.
+    struct SpectrumBitmapCacheKey
+    {
+        double minDimension;
+        winrt::ColorSpectrumShape shape;
+        winrt::ColorSpectrumComponents components;
+        int minHue;
+        int maxHue;
+        int minSaturation;
+        int maxSaturation;
+        int minValue;
+        int maxValue;
+
+        bool operator==(const SpectrumBitmapCacheKey& other) const;
+    };
+
+    // The geometry of a spectrum, with the ranges normalized the way the bitmaps use them.
+    // This is all that's needed to compute the color of any pixel, both when generating the bitmaps and when hit testing.
+    struct SpectrumParameters
+    {
+        double minDimension;
+        int pixelDimension;
+        winrt::ColorSpectrumShape shape;
+        winrt::ColorSpectrumComponents components;
+        double minHue;
+        double maxHue;
+        double minSaturation;
+        double maxSaturation;
+        double minValue;
+        double maxValue;
+    };
+
+    // Everything the threadpool work items in CreateBitmapsAndColorMap() need to fill the spectrum bitmaps.
+    // The pixel buffers are sized up front so that rows can be filled in place, in any order, by several work items at once.
+    struct SpectrumBitmapData : SpectrumParameters
+    {
+        // The middle 4 are only needed and used in the case of hue as the third dimension.
+        std::shared_ptr<std::vector<byte>> bgraMinPixelData;
+        std::shared_ptr<std::vector<byte>> bgraMiddle1PixelData;
+        std::shared_ptr<std::vector<byte>> bgraMiddle2PixelData;
+        std::shared_ptr<std::vector<byte>> bgraMiddle3PixelData;
+        std::shared_ptr<std::vector<byte>> bgraMiddle4PixelData;
+        std::shared_ptr<std::vector<byte>> bgraMaxPixelData;
+    };
+
+    static SpectrumParameters GetSpectrumParameters(const SpectrumBitmapCacheKey &key);
+    static std::shared_ptr<SpectrumBitmapData> CreateSpectrumBitmapData(const SpectrumBitmapCacheKey &key);
+
     // Helpers used by CreateBitmapsAndColorMap() to fill pixel data and create bitmaps from that data.
-    static void FillPixelForBox(
-        double x,
-        double y,
-        const Hsv &baseHsv,
-        double minDimension,
-        winrt::ColorSpectrumComponents components,
-        double minHue,
-        double maxHue,
-        double minSaturation,
-        double maxSaturation,
-        double minValue,
-        double maxValue,
-        std::shared_ptr<std::vector<byte>> bgraMinPixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle1PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle2PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle3PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle4PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMaxPixelData,
-        std::shared_ptr<std::vector<Hsv>> newHsvValues);
-    static void FillPixelForRing(
-        double x,
-        double y,
-        double radius,
-        const Hsv &baseHsv,
-        winrt::ColorSpectrumComponents components,
-        double minHue,
-        double maxHue,
-        double minSaturation,
-        double maxSaturation,
-        double minValue,
-        double maxValue,
-        std::shared_ptr<std::vector<byte>> bgraMinPixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle1PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle2PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle3PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMiddle4PixelData,
-        std::shared_ptr<std::vector<byte>> bgraMaxPixelData,
-        std::shared_ptr<std::vector<Hsv>> newHsvValues);
+    static void FillRow(const SpectrumBitmapData &data, int row, std::vector<Hsv> &hsvRow, std::vector<Hsv> &scratchHsvRow);
+
+    // Returns the HSV value displayed at a pixel of the spectrum, with the third dimension at its minimum.
+    static Hsv GetHsvForPixel(const SpectrumParameters &parameters, int row, int column);
+    static Hsv GetHsvForBoxPixel(const SpectrumParameters &parameters, int row, int column);
+    static Hsv GetHsvForRingPixel(const SpectrumParameters &parameters, int row, int column);
+    static Hsv GetHsvForSpectrumPosition(const SpectrumParameters &parameters, double primaryPercent, double secondaryPercent);
+
+    // The bitmaps created from a SpectrumBitmapData.
+    // On RS2 and later only the surfaces are set, and before that only the bitmaps.
+    // The middle 4 are only set when hue is the third dimension.
+    struct SpectrumBitmaps
+    {
+        winrt::ICompositionSurface minSurface{ nullptr };
+        winrt::ICompositionSurface middle1Surface{ nullptr };
+        winrt::ICompositionSurface middle2Surface{ nullptr };
+        winrt::ICompositionSurface middle3Surface{ nullptr };
+        winrt::ICompositionSurface middle4Surface{ nullptr };
+        winrt::ICompositionSurface maxSurface{ nullptr };
+
+        winrt::WriteableBitmap minBitmap{ nullptr };
+        winrt::WriteableBitmap middle1Bitmap{ nullptr };
+        winrt::WriteableBitmap middle2Bitmap{ nullptr };
+        winrt::WriteableBitmap middle3Bitmap{ nullptr };
+        winrt::WriteableBitmap middle4Bitmap{ nullptr };
+        winrt::WriteableBitmap maxBitmap{ nullptr };
+    };
+
+    struct SpectrumBitmapCacheEntry
+    {
+        SpectrumBitmapCacheKey key;
+        std::shared_ptr<const SpectrumBitmaps> bitmaps;
+        size_t byteCount;
+        unsigned int surfaceUploadDeviceGeneration;
+    };
+
+    static std::shared_ptr<const SpectrumBitmaps> CreateSpectrumBitmaps(const SpectrumBitmapData &data);
+    void ApplySpectrumBitmaps(const SpectrumBitmapCacheKey &key, const SpectrumBitmaps &bitmaps);
+    void UpdateStateFromLastBitmapCreation(const SpectrumBitmapCacheKey &key);
+
+    static void AddHueGradientStops(const winrt::LinearGradientBrush &brush, double minHue, double maxHue, double saturation);
+    static void SetGradientDirection(const winrt::LinearGradientBrush &brush, bool isVertical);
+
+    static std::shared_ptr<const SpectrumBitmaps> FindCachedSpectrumBitmaps(const SpectrumBitmapCacheKey &key);
+    static void CacheSpectrumBitmaps(const SpectrumBitmapCacheKey &key, const std::shared_ptr<const SpectrumBitmaps> &bitmaps, size_t byteCount);
+
+    // Bitmaps generated by any ColorSpectrum on this thread, least recently used first.
+    // Composition surfaces can only be used with the compositor that created them, which is why this isn't shared across threads.
+    static thread_local std::vector<SpectrumBitmapCacheEntry> s_spectrumBitmapCache;
+    static thread_local size_t s_spectrumBitmapCacheByteCount;
 
     bool m_updatingColor;
     bool m_updatingHsvColor;
     bool m_isPointerOver;
     bool m_isPointerPressed;
     bool m_shouldShowLargeSelection;
-    std::vector<Hsv> m_hsvValues;
 
     // XAML elements
     winrt::Grid m_layoutRoot{ nullptr };
@@ -133,6 +200,12 @@ private:
 
     winrt::IAsyncAction m_createImageBitmapAction{ nullptr };
 
+    // Incremented by every call to CreateBitmapsAndColorMap(), so that bitmaps finishing after a newer request are not applied.
+    unsigned int m_bitmapCreationId{ 0 };
+
+    // Restarted by every size change while bitmaps are being stretched, so that they're only regenerated once the size settles.
+    winrt::DispatcherTimer m_bitmapCreationTimer{ nullptr };
+
     // On RS1 and before, we put the spectrum images in a bitmap,
     // which we then give to an ImageBrush.
     winrt::WriteableBitmap m_hueRedBitmap{ nullptr };
@@ -149,17 +222,23 @@ private:
 
     // On RS2 and later, we put the spectrum images in a loaded image surface,
     // which we then put into a SpectrumBrush.
-    winrt::LoadedImageSurface m_hueRedSurface{ nullptr };
-    winrt::LoadedImageSurface m_hueYellowSurface{ nullptr };
-    winrt::LoadedImageSurface m_hueGreenSurface{ nullptr };
-    winrt::LoadedImageSurface m_hueCyanSurface{ nullptr };
-    winrt::LoadedImageSurface m_hueBlueSurface{ nullptr };
-    winrt::LoadedImageSurface m_huePurpleSurface{ nullptr };
+    winrt::ICompositionSurface m_hueRedSurface{ nullptr };
+    winrt::ICompositionSurface m_hueYellowSurface{ nullptr };
+    winrt::ICompositionSurface m_hueGreenSurface{ nullptr };
+    winrt::ICompositionSurface m_hueCyanSurface{ nullptr };
+    winrt::ICompositionSurface m_hueBlueSurface{ nullptr };
+    winrt::ICompositionSurface m_huePurpleSurface{ nullptr };
+
+    winrt::ICompositionSurface m_saturationMinimumSurface{ nullptr };
+    winrt::ICompositionSurface m_saturationMaximumSurface{ nullptr };
 
-    winrt::LoadedImageSurface m_saturationMinimumSurface{ nullptr };
-    winrt::LoadedImageSurface m_saturationMaximumSurface{ nullptr };
+    winrt::ICompositionSurface m_valueSurface{ nullptr };
 
-    winrt::LoadedImageSurface m_valueSurface{ nullptr };
+    // A box spectrum only contains linear gradients, so rather than generating bitmaps for it,
+    // we fill the spectrum rectangle and its overlay with these gradient brushes.
+    bool m_isSpectrumDrawnWithGradients{ false };
+    winrt::LinearGradientBrush m_spectrumGradientBrush{ nullptr };
+    winrt::LinearGradientBrush m_spectrumOverlayGradientBrush{ nullptr };
 
     // Fields used by UpdateEllipse() to ensure that it's using the data
     // associated with the last call to CreateBitmapsAndColorMap(),
@@ -176,6 +255,9 @@ private:
     int m_minValueFromLastBitmapCreation{ 0 };
     int m_maxValueFromLastBitmapCreation{ 0 };
 
+    // Used by UpdateColorFromPoint() to compute the color under the pointer.
+    SpectrumParameters m_spectrumParametersFromLastBitmapCreation{};
+
     winrt::Color m_oldColor{ 255, 255, 255, 255 };
     winrt::float4 m_oldHsvColor{ 0.0, 0.0, 1.0, 1.0 };
 
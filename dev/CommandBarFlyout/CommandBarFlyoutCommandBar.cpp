@@ -5,6 +5,7 @@
 #include "common.h"
 #include "CommandBarFlyoutCommandBar.h"
 #include "CommandBarFlyoutCommandBarTemplateSettings.h"
+#include "StartupTrace.h"
 
 CommandBarFlyoutCommandBar::CommandBarFlyoutCommandBar()
 {
@@ -71,6 +72,8 @@ CommandBarFlyoutCommandBar::~CommandBarFlyoutCommandBar()
 
 void CommandBarFlyoutCommandBar::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"CommandBarFlyoutCommandBar");
+
     __super::OnApplyTemplate();
     DetachEventHandlers();
     
@@ -81,6 +84,7 @@ void CommandBarFlyoutCommandBar::OnApplyTemplate()
     m_moreButton.set(GetTemplateChildT<winrt::ButtonBase>(L"MoreButton", thisAsControlProtected));
     m_openingStoryboard.set(GetTemplateChildT<winrt::Storyboard>(L"OpeningStoryboard", thisAsControlProtected));
     m_closingStoryboard.set(GetTemplateChildT<winrt::Storyboard>(L"ClosingStoryboard", thisAsControlProtected));
+    m_hasTemplateSettingsInputs = false;
 
     AttachEventHandlers();
     UpdateFlowsFromAndFlowsTo();
@@ -374,10 +378,44 @@ void CommandBarFlyoutCommandBar::UpdateTemplateSettings()
         winrt::Size primaryItemsRootDesiredSize = m_primaryItemsRoot.get().DesiredSize();
         float collapsedWidth = primaryItemsRootDesiredSize.Width;
 
+        winrt::Size overflowPopupSize{};
         if (m_secondaryItemsRoot)
         {
             m_secondaryItemsRoot.get().Measure(infiniteSize);
-            auto overflowPopupSize = m_secondaryItemsRoot.get().DesiredSize();
+            overflowPopupSize = m_secondaryItemsRoot.get().DesiredSize();
+        }
+
+        // If we're currently playing the close animation, don't update the open animation positions -
+        // the animation is expecting them not to change out from under it.
+        // After the close animation has completed, the flyout will close and no further
+        // visual updates will occur, so there's no need to update these values in that case.
+        bool isPlayingCloseAnimation = false;
+
+        if (auto closingStoryboard = m_closingStoryboard.get())
+        {
+            isPlayingCloseAnimation = closingStoryboard.GetCurrentState() == winrt::ClockState::Active;
+        }
+
+        // Every template setting below is derived from these, so when none of them changed since the last
+        // update (e.g. reopening with the same commands) we skip setting the properties, each of which
+        // would invalidate the storyboards animating them.
+        TemplateSettingsInputs inputs{
+            primaryItemsRootDesiredSize,
+            overflowPopupSize,
+            Height(),
+            IsOpen(),
+            isPlayingCloseAnimation,
+            PrimaryCommands().Size() > 0 };
+
+        if (m_hasTemplateSettingsInputs && m_lastTemplateSettingsInputs == inputs)
+        {
+            return;
+        }
+        m_lastTemplateSettingsInputs = inputs;
+        m_hasTemplateSettingsInputs = true;
+
+        if (m_secondaryItemsRoot)
+        {
 
             flyoutTemplateSettings->ExpandedWidth(std::max(collapsedWidth, overflowPopupSize.Width));
             flyoutTemplateSettings->ExpandUpOverflowVerticalPosition(-overflowPopupSize.Height);
@@ -419,7 +457,7 @@ void CommandBarFlyoutCommandBar::UpdateTemplateSettings()
         flyoutTemplateSettings->WidthExpansionAnimationEndPosition(-flyoutTemplateSettings->WidthExpansionDelta());
         flyoutTemplateSettings->ContentClipRect({ 0, 0, static_cast<float>(expandedWidth), primaryItemsRootDesiredSize.Height });
 
-        if (IsOpen())
+        if (inputs.isOpen)
         {
             flyoutTemplateSettings->CurrentWidth(expandedWidth);
         }
@@ -428,20 +466,9 @@ void CommandBarFlyoutCommandBar::UpdateTemplateSettings()
             flyoutTemplateSettings->CurrentWidth(collapsedWidth);
         }
 
-        // If we're currently playing the close animation, don't update these properties -
-        // the animation is expecting them not to change out from under it.
-        // After the close animation has completed, the flyout will close and no further
-        // visual updates will occur, so there's no need to update these values in that case.
-        bool isPlayingCloseAnimation = false;
-
-        if (auto closingStoryboard = m_closingStoryboard.get())
-        {
-            isPlayingCloseAnimation = closingStoryboard.GetCurrentState() == winrt::ClockState::Active;
-        }
-
         if (!isPlayingCloseAnimation)
         {
-            if (IsOpen())
+            if (inputs.isOpen)
             {
                 flyoutTemplateSettings->OpenAnimationStartPosition(-expandedWidth / 2);
                 flyoutTemplateSettings->OpenAnimationEndPosition(0);
@@ -458,9 +485,9 @@ void CommandBarFlyoutCommandBar::UpdateTemplateSettings()
         flyoutTemplateSettings->WidthExpansionMoreButtonAnimationStartPosition(flyoutTemplateSettings->WidthExpansionDelta() / 2);
         flyoutTemplateSettings->WidthExpansionMoreButtonAnimationEndPosition(flyoutTemplateSettings->WidthExpansionDelta());
 
-        if (PrimaryCommands().Size() > 0)
+        if (inputs.hasPrimaryCommands)
         {
-            flyoutTemplateSettings->ExpandDownOverflowVerticalPosition(Height());
+            flyoutTemplateSettings->ExpandDownOverflowVerticalPosition(inputs.height);
         }
         else
         {
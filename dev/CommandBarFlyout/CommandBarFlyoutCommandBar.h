@@ -55,4 +55,28 @@ private:
     winrt::Storyboard::Completed_revoker m_closingStoryboardCompletedCallbackRevoker{};
 
     bool m_secondaryItemsRootSized{ false };
+
+    // What the current template settings were computed from, see UpdateTemplateSettings.
+    struct TemplateSettingsInputs
+    {
+        winrt::Size primaryItemsRootDesiredSize;
+        winrt::Size secondaryItemsRootDesiredSize;
+        double height;
+        bool isOpen;
+        bool isPlayingCloseAnimation;
+        bool hasPrimaryCommands;
+
+        bool operator==(TemplateSettingsInputs const& other) const
+        {
+            return primaryItemsRootDesiredSize == other.primaryItemsRootDesiredSize &&
+                secondaryItemsRootDesiredSize == other.secondaryItemsRootDesiredSize &&
+                height == other.height &&
+                isOpen == other.isOpen &&
+                isPlayingCloseAnimation == other.isPlayingCloseAnimation &&
+                hasPrimaryCommands == other.hasPrimaryCommands;
+        }
+    };
+
+    TemplateSettingsInputs m_lastTemplateSettingsInputs{};
+    bool m_hasTemplateSettingsInputs{ false };
 };
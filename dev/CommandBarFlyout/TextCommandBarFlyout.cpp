@@ -142,20 +142,22 @@ void TextCommandBarFlyout::InitializeButtonWithProperties(
 
 void TextCommandBarFlyout::UpdateButtons()
 {
-    PrimaryCommands().Clear();
-    SecondaryCommands().Clear();
+    // The buttons are created once and cached in m_buttons, so we build up the lists of commands
+    // we want and then only add or remove the ones that differ from what the flyout already has.
+    std::vector<winrt::ICommandBarElement> primaryCommands;
+    std::vector<winrt::ICommandBarElement> secondaryCommands;
 
     auto buttonsToAdd = GetButtonsToAdd();
     auto addButtonToCommandsIfPresent =
-        [buttonsToAdd, this](auto buttonType, auto commandsList)
+        [buttonsToAdd, this](auto buttonType, auto& commandsList)
         {
             if ((buttonsToAdd & buttonType) != TextControlButtons::None)
             {
-                commandsList.Append(GetButton(buttonType));
+                commandsList.push_back(GetButton(buttonType));
             }
         };
     auto addRichEditButtonToCommandsIfPresent =
-        [buttonsToAdd, this](auto buttonType, auto commandsList, auto getIsChecked)
+        [buttonsToAdd, this](auto buttonType, auto& commandsList, auto getIsChecked)
         {
             if ((buttonsToAdd & buttonType) != TextControlButtons::None)
             {
@@ -168,7 +170,7 @@ void TextCommandBarFlyout::UpdateButtons()
                     toggleButton.IsChecked(getIsChecked(selection));
                 }
 
-                commandsList.Append(toggleButton);
+                commandsList.push_back(toggleButton);
             }
         };
         
@@ -191,8 +193,11 @@ void TextCommandBarFlyout::UpdateButtons()
         
     if (shouldIncludeProofingMenu)
     {
-        m_proofingButton = winrt::AppBarButton{};
-        m_proofingButton.Label(ResourceAccessor::GetLocalizedStringResource(SR_ProofingMenuItemLabel));
+        if (!m_proofingButton)
+        {
+            m_proofingButton = winrt::AppBarButton{};
+            m_proofingButton.Label(ResourceAccessor::GetLocalizedStringResource(SR_ProofingMenuItemLabel));
+        }
         m_proofingButton.Flyout(proofingFlyout);
 
         m_proofingButtonLoadedRevoker = m_proofingButton.Loaded(winrt::auto_revoke,
@@ -275,7 +280,7 @@ void TextCommandBarFlyout::UpdateButtons()
             }
         }
 
-        SecondaryCommands().Append(m_proofingButton);
+        secondaryCommands.push_back(m_proofingButton);
     }
     else
     {
@@ -284,25 +289,78 @@ void TextCommandBarFlyout::UpdateButtons()
 
     winrt::IFlyoutBase5 thisAsFlyoutBase5 = *this;
 
-    auto commandListForCutCopyPaste =
+    auto& commandListForCutCopyPaste =
         thisAsFlyoutBase5 && thisAsFlyoutBase5.InputDevicePrefersPrimaryCommands() ?
-        PrimaryCommands() :
-        SecondaryCommands();
+        primaryCommands :
+        secondaryCommands;
     
     addButtonToCommandsIfPresent(TextControlButtons::Cut, commandListForCutCopyPaste);
     addButtonToCommandsIfPresent(TextControlButtons::Copy, commandListForCutCopyPaste);
     addButtonToCommandsIfPresent(TextControlButtons::Paste, commandListForCutCopyPaste);
 
-    addRichEditButtonToCommandsIfPresent(TextControlButtons::Bold, PrimaryCommands(),
+    addRichEditButtonToCommandsIfPresent(TextControlButtons::Bold, primaryCommands,
         [](winrt::ITextSelection textSelection) { return textSelection.CharacterFormat().Bold() == winrt::FormatEffect::On; });
-    addRichEditButtonToCommandsIfPresent(TextControlButtons::Italic, PrimaryCommands(),
+    addRichEditButtonToCommandsIfPresent(TextControlButtons::Italic, primaryCommands,
         [](winrt::ITextSelection textSelection) { return textSelection.CharacterFormat().Italic() == winrt::FormatEffect::On; });
-    addRichEditButtonToCommandsIfPresent(TextControlButtons::Underline, PrimaryCommands(),
+    addRichEditButtonToCommandsIfPresent(TextControlButtons::Underline, primaryCommands,
         [](winrt::ITextSelection textSelection) { return textSelection.CharacterFormat().Underline() != winrt::UnderlineType::None; });
 
-    addButtonToCommandsIfPresent(TextControlButtons::Undo, SecondaryCommands());
-    addButtonToCommandsIfPresent(TextControlButtons::Redo, SecondaryCommands());
-    addButtonToCommandsIfPresent(TextControlButtons::SelectAll, SecondaryCommands());
+    addButtonToCommandsIfPresent(TextControlButtons::Undo, secondaryCommands);
+    addButtonToCommandsIfPresent(TextControlButtons::Redo, secondaryCommands);
+    addButtonToCommandsIfPresent(TextControlButtons::SelectAll, secondaryCommands);
+
+    // Cut, copy and paste can move between the two lists depending on the input device,
+    // and an element can't be in both at once, so first take out everything that's going away.
+    RemoveUnwantedCommands(PrimaryCommands(), primaryCommands);
+    RemoveUnwantedCommands(SecondaryCommands(), secondaryCommands);
+    SyncCommands(PrimaryCommands(), primaryCommands);
+    SyncCommands(SecondaryCommands(), secondaryCommands);
+}
+
+void TextCommandBarFlyout::RemoveUnwantedCommands(
+    winrt::IObservableVector<winrt::ICommandBarElement> const& commands,
+    std::vector<winrt::ICommandBarElement> const& wantedCommands)
+{
+    for (int i = static_cast<int>(commands.Size()) - 1; i >= 0; i--)
+    {
+        if (std::find(wantedCommands.begin(), wantedCommands.end(), commands.GetAt(i)) == wantedCommands.end())
+        {
+            commands.RemoveAt(i);
+        }
+    }
+}
+
+void TextCommandBarFlyout::SyncCommands(
+    winrt::IObservableVector<winrt::ICommandBarElement> const& commands,
+    std::vector<winrt::ICommandBarElement> const& wantedCommands)
+{
+    uint32_t i = 0;
+
+    for (auto const& command : wantedCommands)
+    {
+        uint32_t index = 0;
+
+        if (commands.IndexOf(command, index) && index >= i)
+        {
+            // Anything in between is out of order, it gets inserted again further along.
+            while (index > i)
+            {
+                commands.RemoveAt(i);
+                index--;
+            }
+        }
+        else
+        {
+            commands.InsertAt(i, command);
+        }
+
+        i++;
+    }
+
+    while (commands.Size() > i)
+    {
+        commands.RemoveAt(commands.Size() - 1);
+    }
 }
 
 TextControlButtons TextCommandBarFlyout::GetButtonsToAdd()
@@ -33,6 +33,12 @@ public:
 
 private:
     void UpdateButtons();
+    static void RemoveUnwantedCommands(
+        winrt::IObservableVector<winrt::ICommandBarElement> const& commands,
+        std::vector<winrt::ICommandBarElement> const& wantedCommands);
+    static void SyncCommands(
+        winrt::IObservableVector<winrt::ICommandBarElement> const& commands,
+        std::vector<winrt::ICommandBarElement> const& wantedCommands);
 
     TextControlButtons GetButtonsToAdd();
     static TextControlButtons GetTextBoxButtonsToAdd(winrt::TextBox const& textBox);
@@ -244,6 +244,88 @@ Rgb HsvToRgb(const Hsv &hsv)
     return Rgb(r, g, b);
 }
 
+// Computes the same thing as RgbToHsv(), but selects its results instead of branching on them.
+static inline Hsv RgbToHsvBranchless(const Rgb &rgb)
+{
+    const double max = rgb.r >= rgb.g ? (rgb.r >= rgb.b ? rgb.r : rgb.b) : (rgb.g >= rgb.b ? rgb.g : rgb.b);
+    const double min = rgb.r <= rgb.g ? (rgb.r <= rgb.b ? rgb.r : rgb.b) : (rgb.g <= rgb.b ? rgb.g : rgb.b);
+    const double chroma = max - min;
+
+    // Greyscale colors have a hue and saturation of zero; dividing by 1 instead of by 0 keeps that lane harmless.
+    const double chromaDivisor = chroma == 0 ? 1.0 : chroma;
+    const double valueDivisor = max == 0 ? 1.0 : max;
+
+    double hue =
+        rgb.r == max ? 60 * (rgb.g - rgb.b) / chromaDivisor :
+        rgb.g == max ? 120 + 60 * (rgb.b - rgb.r) / chromaDivisor :
+        240 + 60 * (rgb.r - rgb.g) / chromaDivisor;
+    hue += hue < 0.0 ? 360.0 : 0.0;
+
+    return Hsv(
+        chroma == 0 ? 0.0 : hue,
+        chroma == 0 ? 0.0 : chroma / valueDivisor,
+        max);
+}
+
+// Computes the same thing as HsvToRgb(), without its loops or its switch on the sextant of the hue.
+// Each channel is at its maximum within 60 degrees of its own hue, at its minimum beyond 120 degrees from it,
+// and ramps linearly in between.  Offsetting the hue by 5, 3 or 1 sextants puts red, green or blue respectively
+// at the start of that pattern, which we can evaluate as min(k, 4 - k) clamped to [0, 1].
+static inline Rgb HsvToRgbBranchless(const Hsv &hsv)
+{
+    const double hue = hsv.h - 360.0 * floor(hsv.h / 360.0);
+    const double saturation = hsv.s < 0.0 ? 0.0 : (hsv.s > 1.0 ? 1.0 : hsv.s);
+    const double value = hsv.v < 0.0 ? 0.0 : (hsv.v > 1.0 ? 1.0 : hsv.v);
+    const double chroma = saturation * value;
+    const double sextant = hue / 60.0;
+
+    double k[3] = { sextant + 5.0, sextant + 3.0, sextant + 1.0 };
+    double channels[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        k[i] -= k[i] >= 6.0 ? 6.0 : 0.0;
+
+        double ramp = k[i] < 4.0 - k[i] ? k[i] : 4.0 - k[i];
+        ramp = ramp < 0.0 ? 0.0 : (ramp > 1.0 ? 1.0 : ramp);
+
+        channels[i] = value - chroma * ramp;
+    }
+
+    return Rgb(channels[0], channels[1], channels[2]);
+}
+
+void RgbToHsv(const Rgb *rgbValues, Hsv *hsvValues, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        hsvValues[i] = RgbToHsvBranchless(rgbValues[i]);
+    }
+}
+
+void HsvToRgb(const Hsv *hsvValues, Rgb *rgbValues, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        rgbValues[i] = HsvToRgbBranchless(hsvValues[i]);
+    }
+}
+
+void HsvToBgra(const Hsv *hsvValues, byte *bgraValues, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const Rgb rgb = HsvToRgbBranchless(hsvValues[i]);
+
+        // The channels are never negative, so adding 0.5 and truncating rounds the same way round() does.
+        byte *pixel = bgraValues + i * 4;
+        pixel[0] = static_cast<byte>(rgb.b * 255 + 0.5);
+        pixel[1] = static_cast<byte>(rgb.g * 255 + 0.5);
+        pixel[2] = static_cast<byte>(rgb.r * 255 + 0.5);
+        pixel[3] = 255;
+    }
+}
+
 Rgb HexToRgb(const wstring_view& input)
 {
     Rgb rgbValue;
@@ -33,6 +33,14 @@ bool TryParseInt(_In_z_ PCWSTR str, _Out_ unsigned long *outParam, int base);
 Hsv RgbToHsv(const Rgb &rgb);
 Rgb HsvToRgb(const Hsv &hsv);
 
+// Convert many colors at once, such as every pixel of a bitmap.  These give the same results as calling
+// the single-color versions on each element, but don't branch per color, so the compiler can vectorize them.
+void RgbToHsv(const Rgb *rgbValues, Hsv *hsvValues, size_t count);
+void HsvToRgb(const Hsv *hsvValues, Rgb *rgbValues, size_t count);
+
+// Writes each color as an opaque BGRA pixel, rounding every channel to the nearest byte.
+void HsvToBgra(const Hsv *hsvValues, byte *bgraValues, size_t count);
+
 Rgb HexToRgb(const wstring_view& input);
 winrt::hstring RgbToHex(const Rgb &rgb);
 
@@ -7,6 +7,7 @@
 #include "DropDownButtonAutomationPeer.h"
 #include "RuntimeProfiler.h"
 #include "ResourceAccessor.h"
+#include "StartupTrace.h"
 
 DropDownButton::DropDownButton()
 {
@@ -21,6 +22,8 @@ DropDownButton::~DropDownButton()
 
 void DropDownButton::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"DropDownButton");
+
     m_flyoutPropertyChangedRevoker = RegisterPropertyChanged(*this, winrt::Button::FlyoutProperty(), { this, &DropDownButton::OnFlyoutPropertyChanged });
 
     RegisterFlyoutEvents();
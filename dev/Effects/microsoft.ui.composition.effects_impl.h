@@ -183,22 +183,89 @@ namespace Microsoft { namespace UI { namespace Composition { namespace Effects
             GRAPHICS_EFFECT_PROPERTY_MAPPING Mapping;
         };
 
-        HRESULT GetNamedPropertyMappingImpl(
-            _In_count_(mappingCount) const NamedProperty* namedProperties,
-            UINT namedPropertyCount,
+        // Case-insensitive FNV-1a hash of a property name. Property names are ASCII, so only A-Z need folding.
+        static constexpr uint32_t HashPropertyName(const wchar_t* name)
+        {
+            uint32_t hash = 2166136261u;
+            for (; *name; ++name)
+            {
+                wchar_t c = *name;
+                if (c >= L'A' && c <= L'Z')
+                {
+                    c += L'a' - L'A';
+                }
+                hash = (hash ^ static_cast<uint32_t>(c)) * 16777619u;
+            }
+            return hash;
+        }
+
+        // Open addressing hash table over an effect's NamedProperty table, built at compile time.
+        // Keeps the table at most half full so lookups take a probe or two.
+        template <size_t Count>
+        class NamedPropertyMap
+        {
+        public:
+            constexpr NamedPropertyMap(const NamedProperty (&namedProperties)[Count]) :
+                m_namedProperties(namedProperties)
+            {
+                for (size_t i = 0; i < Count; ++i)
+                {
+                    const uint32_t hash = HashPropertyName(namedProperties[i].Name);
+                    size_t slot = hash & (c_slotCount - 1);
+                    while (m_slots[slot] != 0)
+                    {
+                        slot = (slot + 1) & (c_slotCount - 1);
+                    }
+                    m_slots[slot] = static_cast<uint8_t>(i + 1);
+                    m_hashes[slot] = hash;
+                }
+            }
+
+            const NamedProperty* Find(LPCWSTR name) const
+            {
+                const uint32_t hash = HashPropertyName(name);
+                for (size_t slot = hash & (c_slotCount - 1); m_slots[slot] != 0; slot = (slot + 1) & (c_slotCount - 1))
+                {
+                    const auto& prop = m_namedProperties[m_slots[slot] - 1];
+                    if (m_hashes[slot] == hash && _wcsicmp(name, prop.Name) == 0)
+                    {
+                        return &prop;
+                    }
+                }
+                return nullptr;
+            }
+
+        private:
+            static constexpr size_t SlotCount()
+            {
+                size_t slotCount = 1;
+                while (slotCount < 2 * Count)
+                {
+                    slotCount <<= 1;
+                }
+                return slotCount;
+            }
+
+            static constexpr size_t c_slotCount = SlotCount();
+            static_assert(Count < 255, "Slots store table indices in a byte.");
+
+            const NamedProperty* m_namedProperties;
+            uint8_t m_slots[c_slotCount]{}; // 1-based index into m_namedProperties, 0 for an empty slot
+            uint32_t m_hashes[c_slotCount]{};
+        };
+
+        template <size_t Count>
+        static HRESULT GetNamedPropertyMappingImpl(
+            const NamedPropertyMap<Count>& namedProperties,
             LPCWSTR name,
             _Out_ UINT * index,
             _Out_ GRAPHICS_EFFECT_PROPERTY_MAPPING * mapping)
         {
-            for (UINT i = 0; i < namedPropertyCount; ++i)
+            if (const auto prop = namedProperties.Find(name))
             {
-                const auto& prop = namedProperties[i];
-                if (_wcsicmp(name, prop.Name) == 0)
-                {
-                    *index = prop.Index;
-                    *mapping = prop.Mapping;
-                    return S_OK;
-                }
+                *index = prop->Index;
+                *mapping = prop->Mapping;
+                return S_OK;
             }
             return E_INVALIDARG;
         }
@@ -271,8 +338,9 @@ namespace Microsoft { namespace UI { namespace Composition { namespace Effects
     IFACEMETHODIMP GetNamedPropertyMapping(LPCWSTR name, _Out_ UINT * index, \
         _Out_ GRAPHICS_EFFECT_PROPERTY_MAPPING * mapping) override \
     { \
-        static const NamedProperty s_Properties[] = { __VA_ARGS__ }; \
-        return GetNamedPropertyMappingImpl(s_Properties, _countof(s_Properties), name, index, mapping); \
+        static constexpr NamedProperty s_Properties[] = { __VA_ARGS__ }; \
+        static constexpr NamedPropertyMap<_countof(s_Properties)> s_PropertyMap{ s_Properties }; \
+        return GetNamedPropertyMappingImpl(s_PropertyMap, name, index, mapping); \
     }
     
 
@@ -432,6 +500,62 @@ namespace Microsoft { namespace UI { namespace Composition { namespace Effects
         }
     };
 
+    // Compile-time helpers to fold constant color matrix steps into a single ColorMatrixEffect matrix.
+    // A color matrix maps [R G B A 1] to [R' G' B' A']: rows 1-4 are the channel multipliers and row 5 the offset.
+    namespace ColorMatrices
+    {
+        // Multiplies every output channel, offsets included, by factor
+        constexpr winrt::Matrix5x4 Scale(const winrt::Matrix5x4& m, float factor)
+        {
+            return {
+                m.M11 * factor, m.M12 * factor, m.M13 * factor, m.M14 * factor,
+                m.M21 * factor, m.M22 * factor, m.M23 * factor, m.M24 * factor,
+                m.M31 * factor, m.M32 * factor, m.M33 * factor, m.M34 * factor,
+                m.M41 * factor, m.M42 * factor, m.M43 * factor, m.M44 * factor,
+                m.M51 * factor, m.M52 * factor, m.M53 * factor, m.M54 * factor };
+        }
+
+        // Single matrix equivalent to applying first, then second. Both steps must use the same alpha mode and
+        // the first must not clamp its output.
+        constexpr winrt::Matrix5x4 Compose(const winrt::Matrix5x4& first, const winrt::Matrix5x4& second)
+        {
+            const float a[5][4] = {
+                { first.M11, first.M12, first.M13, first.M14 },
+                { first.M21, first.M22, first.M23, first.M24 },
+                { first.M31, first.M32, first.M33, first.M34 },
+                { first.M41, first.M42, first.M43, first.M44 },
+                { first.M51, first.M52, first.M53, first.M54 } };
+            const float b[5][4] = {
+                { second.M11, second.M12, second.M13, second.M14 },
+                { second.M21, second.M22, second.M23, second.M24 },
+                { second.M31, second.M32, second.M33, second.M34 },
+                { second.M41, second.M42, second.M43, second.M44 },
+                { second.M51, second.M52, second.M53, second.M54 } };
+
+            float r[5][4] = {};
+            for (int row = 0; row < 5; ++row)
+            {
+                for (int column = 0; column < 4; ++column)
+                {
+                    // The offset row of the first matrix goes through the second one, then picks up its offset too.
+                    float value = (row == 4) ? b[4][column] : 0.0f;
+                    for (int k = 0; k < 4; ++k)
+                    {
+                        value += a[row][k] * b[k][column];
+                    }
+                    r[row][column] = value;
+                }
+            }
+
+            return {
+                r[0][0], r[0][1], r[0][2], r[0][3],
+                r[1][0], r[1][1], r[1][2], r[1][3],
+                r[2][0], r[2][1], r[2][2], r[2][3],
+                r[3][0], r[3][1], r[3][2], r[3][3],
+                r[4][0], r[4][1], r[4][2], r[4][3] };
+        }
+    }
+
     //-----------------------------------------------------------------------------------------------------------------
 
     class ColorSourceEffect :
@@ -20,6 +20,12 @@ AcrylicBrushProperties::AcrylicBrushProperties()
 
 void AcrylicBrushProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TintTransitionDurationProperty)
+    {
+        return;
+    }
+
     if (!s_AlwaysUseFallbackProperty)
     {
         s_AlwaysUseFallbackProperty =
@@ -18,6 +18,12 @@ BitmapIconSourceProperties::BitmapIconSourceProperties()
 
 void BitmapIconSourceProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_UriSourceProperty)
+    {
+        return;
+    }
+
     IconSource::EnsureProperties();
     if (!s_ShowAsMonochromeProperty)
     {
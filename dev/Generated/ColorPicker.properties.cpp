@@ -36,6 +36,12 @@ ColorPickerProperties::ColorPickerProperties()
 
 void ColorPickerProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_PreviousColorProperty)
+    {
+        return;
+    }
+
     if (!s_ColorProperty)
     {
         s_ColorProperty =
@@ -17,6 +17,12 @@ ColorPickerSliderProperties::ColorPickerSliderProperties()
 
 void ColorPickerSliderProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ColorChannelProperty)
+    {
+        return;
+    }
+
     if (!s_ColorChannelProperty)
     {
         s_ColorChannelProperty =
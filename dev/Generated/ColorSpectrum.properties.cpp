@@ -27,6 +27,12 @@ ColorSpectrumProperties::ColorSpectrumProperties()
 
 void ColorSpectrumProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ShapeProperty)
+    {
+        return;
+    }
+
     if (!s_ColorProperty)
     {
         s_ColorProperty =
@@ -17,6 +17,12 @@ CommandBarFlyoutCommandBarProperties::CommandBarFlyoutCommandBarProperties()
 
 void CommandBarFlyoutCommandBarProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_FlyoutTemplateSettingsProperty)
+    {
+        return;
+    }
+
     if (!s_FlyoutTemplateSettingsProperty)
     {
         s_FlyoutTemplateSettingsProperty =
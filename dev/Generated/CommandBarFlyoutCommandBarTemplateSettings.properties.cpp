@@ -35,6 +35,12 @@ CommandBarFlyoutCommandBarTemplateSettingsProperties::CommandBarFlyoutCommandBar
 
 void CommandBarFlyoutCommandBarTemplateSettingsProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_WidthExpansionMoreButtonAnimationStartPositionProperty)
+    {
+        return;
+    }
+
     if (!s_CloseAnimationEndPositionProperty)
     {
         s_CloseAnimationEndPositionProperty =
@@ -20,6 +20,12 @@ FlowLayoutProperties::FlowLayoutProperties()
 
 void FlowLayoutProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_OrientationProperty)
+    {
+        return;
+    }
+
     if (!s_LineAlignmentProperty)
     {
         s_LineAlignmentProperty =
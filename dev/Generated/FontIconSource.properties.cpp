@@ -23,6 +23,12 @@ FontIconSourceProperties::FontIconSourceProperties()
 
 void FontIconSourceProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_MirroredWhenRightToLeftProperty)
+    {
+        return;
+    }
+
     IconSource::EnsureProperties();
     if (!s_FontFamilyProperty)
     {
@@ -17,6 +17,12 @@ IconSourceProperties::IconSourceProperties()
 
 void IconSourceProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ForegroundProperty)
+    {
+        return;
+    }
+
     if (!s_ForegroundProperty)
     {
         s_ForegroundProperty =
@@ -26,6 +26,12 @@ ItemsRepeaterProperties::ItemsRepeaterProperties()
 
 void ItemsRepeaterProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_VerticalCacheLengthProperty)
+    {
+        return;
+    }
+
     if (!s_AnimatorProperty)
     {
         s_AnimatorProperty =
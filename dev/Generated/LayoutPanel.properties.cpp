@@ -21,6 +21,12 @@ LayoutPanelProperties::LayoutPanelProperties()
 
 void LayoutPanelProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_PaddingProperty)
+    {
+        return;
+    }
+
     if (!s_BorderBrushProperty)
     {
         s_BorderBrushProperty =
@@ -17,6 +17,12 @@ MenuBarProperties::MenuBarProperties()
 
 void MenuBarProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ItemsProperty)
+    {
+        return;
+    }
+
     if (!s_ItemsProperty)
     {
         s_ItemsProperty =
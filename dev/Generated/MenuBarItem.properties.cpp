@@ -18,6 +18,12 @@ MenuBarItemProperties::MenuBarItemProperties()
 
 void MenuBarItemProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TitleProperty)
+    {
+        return;
+    }
+
     if (!s_ItemsProperty)
     {
         s_ItemsProperty =
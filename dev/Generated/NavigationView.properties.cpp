@@ -58,6 +58,12 @@ NavigationViewProperties::NavigationViewProperties()
 
 void NavigationViewProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TemplateSettingsProperty)
+    {
+        return;
+    }
+
     if (!s_AlwaysShowHeaderProperty)
     {
         s_AlwaysShowHeaderProperty =
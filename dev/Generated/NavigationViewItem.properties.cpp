@@ -19,6 +19,12 @@ NavigationViewItemProperties::NavigationViewItemProperties()
 
 void NavigationViewItemProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_SelectsOnInvokedProperty)
+    {
+        return;
+    }
+
     if (!s_CompactPaneLengthProperty)
     {
         s_CompactPaneLengthProperty =
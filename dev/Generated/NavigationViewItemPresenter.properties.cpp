@@ -17,6 +17,12 @@ NavigationViewItemPresenterProperties::NavigationViewItemPresenterProperties()
 
 void NavigationViewItemPresenterProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_IconProperty)
+    {
+        return;
+    }
+
     if (!s_IconProperty)
     {
         s_IconProperty =
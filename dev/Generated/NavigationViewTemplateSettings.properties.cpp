@@ -23,6 +23,12 @@ NavigationViewTemplateSettingsProperties::NavigationViewTemplateSettingsProperti
 
 void NavigationViewTemplateSettingsProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TopPaneVisibilityProperty)
+    {
+        return;
+    }
+
     if (!s_BackButtonVisibilityProperty)
     {
         s_BackButtonVisibilityProperty =
@@ -30,6 +30,12 @@ ParallaxViewProperties::ParallaxViewProperties()
 
 void ParallaxViewProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_VerticalSourceStartOffsetProperty)
+    {
+        return;
+    }
+
     if (!s_ChildProperty)
     {
         s_ChildProperty =
@@ -17,6 +17,12 @@ PathIconSourceProperties::PathIconSourceProperties()
 
 void PathIconSourceProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_DataProperty)
+    {
+        return;
+    }
+
     IconSource::EnsureProperties();
     if (!s_DataProperty)
     {
@@ -26,6 +26,12 @@ PersonPictureProperties::PersonPictureProperties()
 
 void PersonPictureProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ProfilePictureProperty)
+    {
+        return;
+    }
+
     if (!s_BadgeGlyphProperty)
     {
         s_BadgeGlyphProperty =
@@ -24,6 +24,12 @@ RadioButtonsProperties::RadioButtonsProperties()
 
 void RadioButtonsProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_SelectedItemProperty)
+    {
+        return;
+    }
+
     if (!s_HeaderProperty)
     {
         s_HeaderProperty =
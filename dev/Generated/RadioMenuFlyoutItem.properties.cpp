@@ -18,6 +18,12 @@ RadioMenuFlyoutItemProperties::RadioMenuFlyoutItemProperties()
 
 void RadioMenuFlyoutItemProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_IsCheckedProperty)
+    {
+        return;
+    }
+
     if (!s_GroupNameProperty)
     {
         s_GroupNameProperty =
@@ -25,6 +25,12 @@ RatingControlProperties::RatingControlProperties()
 
 void RatingControlProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ValueProperty)
+    {
+        return;
+    }
+
     if (!s_CaptionProperty)
     {
         s_CaptionProperty =
@@ -22,6 +22,12 @@ RatingItemFontInfoProperties::RatingItemFontInfoProperties()
 
 void RatingItemFontInfoProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_UnsetGlyphProperty)
+    {
+        return;
+    }
+
     if (!s_DisabledGlyphProperty)
     {
         s_DisabledGlyphProperty =
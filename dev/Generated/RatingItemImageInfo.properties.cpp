@@ -22,6 +22,12 @@ RatingItemImageInfoProperties::RatingItemImageInfoProperties()
 
 void RatingItemImageInfoProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_UnsetImageProperty)
+    {
+        return;
+    }
+
     if (!s_DisabledImageProperty)
     {
         s_DisabledImageProperty =
@@ -17,6 +17,12 @@ RecyclePoolProperties::RecyclePoolProperties()
 
 void RecyclePoolProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_PoolInstanceProperty)
+    {
+        return;
+    }
+
     if (!s_PoolInstanceProperty)
     {
         s_PoolInstanceProperty =
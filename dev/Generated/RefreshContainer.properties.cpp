@@ -19,6 +19,12 @@ RefreshContainerProperties::RefreshContainerProperties()
 
 void RefreshContainerProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_VisualizerProperty)
+    {
+        return;
+    }
+
     if (!s_PullDirectionProperty)
     {
         s_PullDirectionProperty =
@@ -22,6 +22,12 @@ RefreshVisualizerProperties::RefreshVisualizerProperties()
 
 void RefreshVisualizerProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_StateProperty)
+    {
+        return;
+    }
+
     if (!s_ContentProperty)
     {
         s_ContentProperty =
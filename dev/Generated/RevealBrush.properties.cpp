@@ -20,6 +20,12 @@ RevealBrushProperties::RevealBrushProperties()
 
 void RevealBrushProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TargetThemeProperty)
+    {
+        return;
+    }
+
     if (!s_AlwaysUseFallbackProperty)
     {
         s_AlwaysUseFallbackProperty =
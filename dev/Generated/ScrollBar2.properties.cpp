@@ -27,6 +27,12 @@ ScrollBar2Properties::ScrollBar2Properties()
 
 void ScrollBar2Properties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ViewportProperty)
+    {
+        return;
+    }
+
     if (!s_IndicatorModeProperty)
     {
         s_IndicatorModeProperty =
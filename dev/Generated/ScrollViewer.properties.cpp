@@ -49,6 +49,12 @@ ScrollViewerProperties::ScrollViewerProperties()
 
 void ScrollViewerProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ZoomModeProperty)
+    {
+        return;
+    }
+
     if (!s_ComputedHorizontalScrollModeProperty)
     {
         s_ComputedHorizontalScrollModeProperty =
@@ -45,6 +45,12 @@ ScrollerProperties::ScrollerProperties()
 
 void ScrollerProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ZoomModeProperty)
+    {
+        return;
+    }
+
     if (!s_BackgroundProperty)
     {
         s_BackgroundProperty =
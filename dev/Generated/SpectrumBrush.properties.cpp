@@ -19,15 +19,21 @@ SpectrumBrushProperties::SpectrumBrushProperties()
 
 void SpectrumBrushProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_MinSurfaceProperty)
+    {
+        return;
+    }
+
     if (!s_MaxSurfaceProperty)
     {
         s_MaxSurfaceProperty =
             InitializeDependencyProperty(
                 L"MaxSurface",
-                winrt::name_of<winrt::LoadedImageSurface>(),
+                winrt::name_of<winrt::ICompositionSurface>(),
                 winrt::name_of<winrt::SpectrumBrush>(),
                 false /* isAttached */,
-                ValueHelper<winrt::LoadedImageSurface>::BoxedDefaultValue(),
+                ValueHelper<winrt::ICompositionSurface>::BoxedDefaultValue(),
                 winrt::PropertyChangedCallback(&OnPropertyChanged));
     }
     if (!s_MaxSurfaceOpacityProperty)
@@ -46,10 +52,10 @@ void SpectrumBrushProperties::EnsureProperties()
         s_MinSurfaceProperty =
             InitializeDependencyProperty(
                 L"MinSurface",
-                winrt::name_of<winrt::LoadedImageSurface>(),
+                winrt::name_of<winrt::ICompositionSurface>(),
                 winrt::name_of<winrt::SpectrumBrush>(),
                 false /* isAttached */,
-                ValueHelper<winrt::LoadedImageSurface>::BoxedDefaultValue(),
+                ValueHelper<winrt::ICompositionSurface>::BoxedDefaultValue(),
                 winrt::PropertyChangedCallback(&OnPropertyChanged));
     }
 }
@@ -69,14 +75,14 @@ void SpectrumBrushProperties::OnPropertyChanged(
     winrt::get_self<SpectrumBrush>(owner)->OnPropertyChanged(args);
 }
 
-void SpectrumBrushProperties::MaxSurface(winrt::LoadedImageSurface const& value)
+void SpectrumBrushProperties::MaxSurface(winrt::ICompositionSurface const& value)
 {
-    static_cast<SpectrumBrush*>(this)->SetValue(s_MaxSurfaceProperty, ValueHelper<winrt::LoadedImageSurface>::BoxValueIfNecessary(value));
+    static_cast<SpectrumBrush*>(this)->SetValue(s_MaxSurfaceProperty, ValueHelper<winrt::ICompositionSurface>::BoxValueIfNecessary(value));
 }
 
-winrt::LoadedImageSurface SpectrumBrushProperties::MaxSurface()
+winrt::ICompositionSurface SpectrumBrushProperties::MaxSurface()
 {
-    return ValueHelper<winrt::LoadedImageSurface>::CastOrUnbox(static_cast<SpectrumBrush*>(this)->GetValue(s_MaxSurfaceProperty));
+    return ValueHelper<winrt::ICompositionSurface>::CastOrUnbox(static_cast<SpectrumBrush*>(this)->GetValue(s_MaxSurfaceProperty));
 }
 
 void SpectrumBrushProperties::MaxSurfaceOpacity(double value)
@@ -89,12 +95,12 @@ double SpectrumBrushProperties::MaxSurfaceOpacity()
     return ValueHelper<double>::CastOrUnbox(static_cast<SpectrumBrush*>(this)->GetValue(s_MaxSurfaceOpacityProperty));
 }
 
-void SpectrumBrushProperties::MinSurface(winrt::LoadedImageSurface const& value)
+void SpectrumBrushProperties::MinSurface(winrt::ICompositionSurface const& value)
 {
-    static_cast<SpectrumBrush*>(this)->SetValue(s_MinSurfaceProperty, ValueHelper<winrt::LoadedImageSurface>::BoxValueIfNecessary(value));
+    static_cast<SpectrumBrush*>(this)->SetValue(s_MinSurfaceProperty, ValueHelper<winrt::ICompositionSurface>::BoxValueIfNecessary(value));
 }
 
-winrt::LoadedImageSurface SpectrumBrushProperties::MinSurface()
+winrt::ICompositionSurface SpectrumBrushProperties::MinSurface()
 {
-    return ValueHelper<winrt::LoadedImageSurface>::CastOrUnbox(static_cast<SpectrumBrush*>(this)->GetValue(s_MinSurfaceProperty));
+    return ValueHelper<winrt::ICompositionSurface>::CastOrUnbox(static_cast<SpectrumBrush*>(this)->GetValue(s_MinSurfaceProperty));
 }
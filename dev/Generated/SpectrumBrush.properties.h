@@ -9,14 +9,14 @@ class SpectrumBrushProperties
 public:
     SpectrumBrushProperties();
 
-    void MaxSurface(winrt::LoadedImageSurface const& value);
-    winrt::LoadedImageSurface MaxSurface();
+    void MaxSurface(winrt::ICompositionSurface const& value);
+    winrt::ICompositionSurface MaxSurface();
 
     void MaxSurfaceOpacity(double value);
     double MaxSurfaceOpacity();
 
-    void MinSurface(winrt::LoadedImageSurface const& value);
-    winrt::LoadedImageSurface MinSurface();
+    void MinSurface(winrt::ICompositionSurface const& value);
+    winrt::ICompositionSurface MinSurface();
 
     static winrt::DependencyProperty MaxSurfaceProperty() { return s_MaxSurfaceProperty; }
     static winrt::DependencyProperty MaxSurfaceOpacityProperty() { return s_MaxSurfaceOpacityProperty; }
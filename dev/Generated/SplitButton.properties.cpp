@@ -20,6 +20,12 @@ SplitButtonProperties::SplitButtonProperties()
 
 void SplitButtonProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_FlyoutProperty)
+    {
+        return;
+    }
+
     if (!s_CommandProperty)
     {
         s_CommandProperty =
@@ -18,6 +18,12 @@ StackLayoutProperties::StackLayoutProperties()
 
 void StackLayoutProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_SpacingProperty)
+    {
+        return;
+    }
+
     if (!s_OrientationProperty)
     {
         s_OrientationProperty =
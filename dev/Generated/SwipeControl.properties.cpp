@@ -20,6 +20,12 @@ SwipeControlProperties::SwipeControlProperties()
 
 void SwipeControlProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TopItemsProperty)
+    {
+        return;
+    }
+
     if (!s_BottomItemsProperty)
     {
         s_BottomItemsProperty =
@@ -24,6 +24,12 @@ SwipeItemProperties::SwipeItemProperties()
 
 void SwipeItemProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TextProperty)
+    {
+        return;
+    }
+
     if (!s_BackgroundProperty)
     {
         s_BackgroundProperty =
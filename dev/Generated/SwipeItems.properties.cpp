@@ -17,6 +17,12 @@ SwipeItemsProperties::SwipeItemsProperties()
 
 void SwipeItemsProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_ModeProperty)
+    {
+        return;
+    }
+
     if (!s_ModeProperty)
     {
         s_ModeProperty =
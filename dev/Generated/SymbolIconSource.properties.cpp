@@ -17,6 +17,12 @@ SymbolIconSourceProperties::SymbolIconSourceProperties()
 
 void SymbolIconSourceProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_SymbolProperty)
+    {
+        return;
+    }
+
     IconSource::EnsureProperties();
     if (!s_SymbolProperty)
     {
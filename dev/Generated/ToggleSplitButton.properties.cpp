@@ -18,6 +18,12 @@ ToggleSplitButtonProperties::ToggleSplitButtonProperties()
 
 void ToggleSplitButtonProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_IsCheckedProperty)
+    {
+        return;
+    }
+
     SplitButton::EnsureProperties();
     if (!s_IsCheckedProperty)
     {
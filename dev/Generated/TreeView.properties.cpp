@@ -30,6 +30,12 @@ TreeViewProperties::TreeViewProperties()
 
 void TreeViewProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_SelectionModeProperty)
+    {
+        return;
+    }
+
     if (!s_CanDragItemsProperty)
     {
         s_CanDragItemsProperty =
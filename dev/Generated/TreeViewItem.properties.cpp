@@ -25,6 +25,12 @@ TreeViewItemProperties::TreeViewItemProperties()
 
 void TreeViewItemProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_TreeViewItemTemplateSettingsProperty)
+    {
+        return;
+    }
+
     if (!s_CollapsedGlyphProperty)
     {
         s_CollapsedGlyphProperty =
@@ -20,6 +20,12 @@ TreeViewItemTemplateSettingsProperties::TreeViewItemTemplateSettingsProperties()
 
 void TreeViewItemTemplateSettingsProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_IndentationProperty)
+    {
+        return;
+    }
+
     if (!s_CollapsedGlyphVisibilityProperty)
     {
         s_CollapsedGlyphVisibilityProperty =
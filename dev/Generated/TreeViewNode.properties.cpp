@@ -20,6 +20,12 @@ TreeViewNodeProperties::TreeViewNodeProperties()
 
 void TreeViewNodeProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_IsExpandedProperty)
+    {
+        return;
+    }
+
     if (!s_ContentProperty)
     {
         s_ContentProperty =
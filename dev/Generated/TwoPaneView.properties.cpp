@@ -27,6 +27,12 @@ TwoPaneViewProperties::TwoPaneViewProperties()
 
 void TwoPaneViewProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_WideModeConfigurationProperty)
+    {
+        return;
+    }
+
     if (!s_MinTallModeHeightProperty)
     {
         s_MinTallModeHeightProperty =
@@ -23,6 +23,12 @@ UniformGridLayoutProperties::UniformGridLayoutProperties()
 
 void UniformGridLayoutProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_OrientationProperty)
+    {
+        return;
+    }
+
     if (!s_ItemsJustificationProperty)
     {
         s_ItemsJustificationProperty =
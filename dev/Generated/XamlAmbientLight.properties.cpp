@@ -18,6 +18,12 @@ XamlAmbientLightProperties::XamlAmbientLightProperties()
 
 void XamlAmbientLightProperties::EnsureProperties()
 {
+    // Properties are registered in order, once the last one is they all are.
+    if (s_IsTargetProperty)
+    {
+        return;
+    }
+
     if (!s_ColorProperty)
     {
         s_ColorProperty =
@@ -63,5 +63,27 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 Verify.IsGreaterThan(supportedEvents.Count, 0);
             });
         }
+
+        [TestMethod]
+        public void ValidateUnvisitedTargetsAreIdle()
+        {
+            if (!ApiInformation.IsPropertyPresent("Windows.UI.Xaml.UIElement", "Interactions"))
+            {
+                Log.Warning("UIElement.Interactions not supported on this build.");
+                return;
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                var interaction = new ButtonInteraction();
+                var first = new Border();
+                var second = new Border();
+
+                Verify.IsFalse(interaction.IsTargetHovered(first));
+                Verify.IsFalse(interaction.IsTargetPressed(first));
+                Verify.IsFalse(interaction.IsTargetHovered(second));
+                Verify.IsFalse(interaction.IsTargetPressed(second));
+            });
+        }
     }
 }
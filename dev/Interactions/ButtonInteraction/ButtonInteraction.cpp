@@ -27,12 +27,22 @@ void ButtonInteraction::InvokeMode(winrt::ButtonInteractionInvokeMode const& val
 
 bool ButtonInteraction::IsHovering()
 {
-    return m_isHovering;
+    return m_hoveredTargetCount > 0;
 }
 
 bool ButtonInteraction::IsPressing()
 {
-    return m_isPressing;
+    return m_pressedTargetCount > 0;
+}
+
+bool ButtonInteraction::IsTargetHovered(winrt::UIElement const& target)
+{
+    return GetTargetState(target).isHovering;
+}
+
+bool ButtonInteraction::IsTargetPressed(winrt::UIElement const& target)
+{
+    return GetTargetState(target).isPressing;
 }
 
 winrt::event_token ButtonInteraction::Invoked(winrt::TypedEventHandler<winrt::ButtonInteraction, winrt::ButtonInteractionInvokedEventArgs> const& value)
@@ -62,7 +72,6 @@ winrt::IVectorView<winrt::RoutedEvent> ButtonInteraction::GetSupportedEventsCore
     // Build the list of events that we'll respond to.
     supportedEvents.push_back(winrt::UIElement::KeyDownEvent());
     supportedEvents.push_back(winrt::UIElement::KeyUpEvent());
-    supportedEvents.push_back(winrt::UIElement::PointerExitedEvent());
     supportedEvents.push_back(winrt::UIElement::PointerEnteredEvent());
     supportedEvents.push_back(winrt::UIElement::PointerExitedEvent());
     supportedEvents.push_back(winrt::UIElement::PointerPressedEvent());
@@ -75,17 +84,18 @@ winrt::IVectorView<winrt::RoutedEvent> ButtonInteraction::GetSupportedEventsCore
 
 void ButtonInteraction::OnKeyDown(winrt::UIElement const& sender, winrt::KeyRoutedEventArgs const& args)
 {
+    auto target = sender;
+
     // Only process key events if the pointer is not currently being pressed.
-    if (!m_hasPointerCapture)
+    if (!GetTargetState(target).hasPointerCapture)
     {
-        auto target = sender;
         auto keyArgs = args;
 
         switch (keyArgs.Key())
         {
         case winrt::VirtualKey::Space:
         case winrt::VirtualKey::Enter:
-            UpdateIsPressing(true);
+            UpdateIsPressing(target, true);
 
             if (m_invokeMode == winrt::ButtonInteractionInvokeMode::Press)
             {
@@ -98,17 +108,18 @@ void ButtonInteraction::OnKeyDown(winrt::UIElement const& sender, winrt::KeyRout
 
 void ButtonInteraction::OnKeyUp(winrt::UIElement const& sender, winrt::KeyRoutedEventArgs const& args)
 {
+    auto target = sender;
+
     // Only process key events if the pointer is not currently being pressed.
-    if (!m_hasPointerCapture)
+    if (!GetTargetState(target).hasPointerCapture)
     {
-        auto target = sender;
         auto keyArgs = args;
 
         switch (keyArgs.Key())
         {
         case winrt::VirtualKey::Space:
         case winrt::VirtualKey::Enter:
-            UpdateIsPressing(false);
+            UpdateIsPressing(target, false);
 
             if (m_invokeMode == winrt::ButtonInteractionInvokeMode::Release)
             {
@@ -123,13 +134,12 @@ void ButtonInteraction::OnKeyUp(winrt::UIElement const& sender, winrt::KeyRouted
 void ButtonInteraction::OnPointerEntered(winrt::UIElement const& sender, winrt::PointerRoutedEventArgs const& args)
 {
     auto target = sender;
-    auto pointerArgs = args;
 
-    UpdateIsHovering(true);
+    UpdateIsHovering(target, true);
 
     if (m_invokeMode == winrt::ButtonInteractionInvokeMode::Hover)
     {
-        UpdateIsPressing(true);
+        UpdateIsPressing(target, true);
         RaiseInvoked(target);
     }
 }
@@ -138,11 +148,11 @@ void ButtonInteraction::OnPointerExited(winrt::UIElement const& sender, winrt::P
 {
     auto target = sender;
 
-    UpdateIsHovering(false);
+    UpdateIsHovering(target, false);
 
-    if (m_invokeMode == winrt::ButtonInteractionInvokeMode::Hover || m_hasPointerCapture)
+    if (m_invokeMode == winrt::ButtonInteractionInvokeMode::Hover || GetTargetState(target).hasPointerCapture)
     {
-        UpdateIsPressing(false);
+        UpdateIsPressing(target, false);
     }
 }
 
@@ -151,14 +161,14 @@ void ButtonInteraction::OnPointerPressed(winrt::UIElement const& sender, winrt::
     auto target = sender;
     auto pointerArgs = args;
 
-    UpdateIsPressing(true);
+    UpdateIsPressing(target, true);
 
     if (m_invokeMode == winrt::ButtonInteractionInvokeMode::Press)
     {
         RaiseInvoked(target);
     }
 
-    m_hasPointerCapture = target.CapturePointer(pointerArgs.Pointer());
+    UpdateHasPointerCapture(target, target.CapturePointer(pointerArgs.Pointer()));
 }
 
 void ButtonInteraction::OnPointerReleased(winrt::UIElement const& sender, winrt::PointerRoutedEventArgs const& args)
@@ -166,16 +176,16 @@ void ButtonInteraction::OnPointerReleased(winrt::UIElement const& sender, winrt:
     auto target = sender;
     auto pointerArgs = args;
 
-    bool wasPressing = m_isPressing;
+    bool wasPressing = GetTargetState(target).isPressing;
 
-    UpdateIsPressing(false);
+    UpdateIsPressing(target, false);
 
     if (wasPressing && m_invokeMode == winrt::ButtonInteractionInvokeMode::Release)
     {
         RaiseInvoked(target);
     }
 
-    if (m_hasPointerCapture)
+    if (GetTargetState(target).hasPointerCapture)
     {
         target.ReleasePointerCapture(pointerArgs.Pointer());
     }
@@ -186,20 +196,20 @@ void ButtonInteraction::OnPointerCanceled(winrt::UIElement const& sender, winrt:
     auto target = sender;
     auto pointerArgs = args;
 
-    if (m_hasPointerCapture)
+    if (GetTargetState(target).hasPointerCapture)
     {
         target.ReleasePointerCapture(pointerArgs.Pointer());
     }
 
-    UpdateIsPressing(false);
+    UpdateIsPressing(target, false);
 }
 
 void ButtonInteraction::OnPointerCaptureLost(winrt::UIElement const& sender, winrt::PointerRoutedEventArgs const& args)
 {
     auto target = sender;
 
-    m_hasPointerCapture = false;
-    UpdateIsPressing(false);
+    UpdateHasPointerCapture(target, false);
+    UpdateIsPressing(target, false);
 }
 
 void ButtonInteraction::RaiseInvoked(winrt::UIElement target)
@@ -208,20 +218,64 @@ void ButtonInteraction::RaiseInvoked(winrt::UIElement target)
     m_invokedEventSource(*this, *eventArgs);
 }
 
-void ButtonInteraction::UpdateIsHovering(bool isHovering)
+ButtonInteraction::TargetState ButtonInteraction::GetTargetState(winrt::UIElement const& target) const
+{
+    const auto it = m_targetStates.find(winrt::get_abi(target));
+    return it != m_targetStates.end() ? it->second : TargetState{};
+}
+
+void ButtonInteraction::SetTargetState(winrt::UIElement const& target, const TargetState& state)
 {
-    if (isHovering != m_isHovering)
+    if (state.IsIdle())
+    {
+        m_targetStates.erase(winrt::get_abi(target));
+    }
+    else
     {
-        m_isHovering = isHovering;
-        m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"IsHovering"));
+        m_targetStates[winrt::get_abi(target)] = state;
+    }
+}
+
+void ButtonInteraction::UpdateIsHovering(winrt::UIElement const& target, bool isHovering)
+{
+    auto state = GetTargetState(target);
+    if (isHovering != state.isHovering)
+    {
+        const bool wasHovering = IsHovering();
+        state.isHovering = isHovering;
+        SetTargetState(target, state);
+        m_hoveredTargetCount += isHovering ? 1 : -1;
+
+        if (wasHovering != IsHovering())
+        {
+            m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"IsHovering"));
+        }
+    }
+}
+
+void ButtonInteraction::UpdateIsPressing(winrt::UIElement const& target, bool isPressing)
+{
+    auto state = GetTargetState(target);
+    if (isPressing != state.isPressing)
+    {
+        const bool wasPressing = IsPressing();
+        state.isPressing = isPressing;
+        SetTargetState(target, state);
+        m_pressedTargetCount += isPressing ? 1 : -1;
+
+        if (wasPressing != IsPressing())
+        {
+            m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"IsPressing"));
+        }
     }
 }
 
-void ButtonInteraction::UpdateIsPressing(bool isPressing)
+void ButtonInteraction::UpdateHasPointerCapture(winrt::UIElement const& target, bool hasPointerCapture)
 {
-    if (isPressing != m_isPressing)
+    auto state = GetTargetState(target);
+    if (hasPointerCapture != state.hasPointerCapture)
     {
-        m_isPressing = isPressing;
-        m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"IsPressing"));
+        state.hasPointerCapture = hasPointerCapture;
+        SetTargetState(target, state);
     }
 }
@@ -5,6 +5,10 @@
 
 #include "ButtonInteraction.g.h"
 
+// One instance can be attached to many elements, e.g. every tile of a grid, so that they share a
+// single set of event handlers. Hover and press state is kept per target in a side table that
+// only holds the targets currently being interacted with, IsHovering and IsPressing are true
+// while any target is hovered or pressed.
 class ButtonInteraction :
     public ReferenceTracker<ButtonInteraction, winrt::implementation::ButtonInteractionT>
 {
@@ -15,6 +19,8 @@ public:
 
     bool IsHovering();
     bool IsPressing();
+    bool IsTargetHovered(winrt::UIElement const& target);
+    bool IsTargetPressed(winrt::UIElement const& target);
 
     winrt::event_token Invoked(winrt::TypedEventHandler<winrt::ButtonInteraction, winrt::ButtonInteractionInvokedEventArgs> const& value);
     void Invoked(winrt::event_token const& token);
@@ -36,15 +42,31 @@ public:
     void OnPointerCaptureLost(winrt::UIElement const& sender, winrt::PointerRoutedEventArgs const& args);
 
 private:
+    struct TargetState
+    {
+        bool isHovering{ false };
+        bool isPressing{ false };
+        bool hasPointerCapture{ false };
+
+        bool IsIdle() const { return !isHovering && !isPressing && !hasPointerCapture; }
+    };
+
+    // Returns the default (idle) state for targets that are not in the table.
+    TargetState GetTargetState(winrt::UIElement const& target) const;
+    void SetTargetState(winrt::UIElement const& target, const TargetState& state);
+
     void RaiseInvoked(winrt::UIElement target);
-    void UpdateIsHovering(bool isHovering);
-    void UpdateIsPressing(bool isPressing);
+    void UpdateIsHovering(winrt::UIElement const& target, bool isHovering);
+    void UpdateIsPressing(winrt::UIElement const& target, bool isPressing);
+    void UpdateHasPointerCapture(winrt::UIElement const& target, bool hasPointerCapture);
 
     winrt::ButtonInteractionInvokeMode m_invokeMode{ winrt::ButtonInteractionInvokeMode::Release };
 
-    bool m_isHovering{ false };
-    bool m_isPressing{ false };
-    bool m_hasPointerCapture{ false };
+    // Keyed on the target's ABI pointer. Entries are removed as soon as their target is idle
+    // again, which is at the latest when it loses pointer capture or the pointer exits.
+    std::unordered_map<void*, TargetState> m_targetStates;
+    int m_hoveredTargetCount{ 0 };
+    int m_pressedTargetCount{ 0 };
 
     event_source<winrt::TypedEventHandler<winrt::ButtonInteraction, winrt::ButtonInteractionInvokedEventArgs>> m_invokedEventSource{ this };
     event_source<winrt::PropertyChangedEventHandler> m_propertyChangedEventSource{ this };
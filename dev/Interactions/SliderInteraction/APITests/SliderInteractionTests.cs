@@ -46,6 +46,7 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 Verify.AreEqual(0.0, interaction.Position);
                 Verify.AreEqual(1.0, interaction.SmallChange);
                 Verify.AreEqual(10.0, interaction.LargeChange);
+                Verify.IsFalse(interaction.IsCompositionDrivenDragEnabled);
             });
         }
 
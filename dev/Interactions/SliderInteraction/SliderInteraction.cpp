@@ -20,6 +20,7 @@ void SliderInteraction::Orientation(winrt::Orientation const& value)
     if (orientation != m_orientation)
     {
         m_orientation = orientation;
+        UpdateInteractionTrackerBounds();
         UpdateTransform();
 
         m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"Orientation"));
@@ -42,6 +43,7 @@ void SliderInteraction::Minimum(double value)
     if (value != m_minimum)
     {
         m_minimum = value;
+        UpdateInteractionTrackerBounds();
         UpdatePosition(std::max(m_minimum, m_position) - m_position);
 
         m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"Minimum"));
@@ -64,6 +66,7 @@ void SliderInteraction::Maximum(double value)
     if (value != m_maximum)
     {
         m_maximum = value;
+        UpdateInteractionTrackerBounds();
         UpdatePosition(std::min(m_maximum, m_position) - m_position);
 
         m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"Maximum"));
@@ -115,6 +118,21 @@ double SliderInteraction::LargeChange()
     return m_largeChange;
 }
 
+bool SliderInteraction::IsCompositionDrivenDragEnabled()
+{
+    return m_isCompositionDrivenDragEnabled;
+}
+
+void SliderInteraction::IsCompositionDrivenDragEnabled(bool value)
+{
+    if (value != m_isCompositionDrivenDragEnabled)
+    {
+        // Only read when the target is configured by its first interaction.
+        m_isCompositionDrivenDragEnabled = value;
+        m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"IsCompositionDrivenDragEnabled"));
+    }
+}
+
 winrt::event_token SliderInteraction::PropertyChanged(winrt::PropertyChangedEventHandler const& value)
 {
     return m_propertyChangedEventSource.add(value);
@@ -198,6 +216,24 @@ void SliderInteraction::OnPointerPressed(winrt::UIElement const& sender, winrt::
 
     ConfigureTargetElement(target);
 
+    if (IsCompositionDriven() && pointerArgs.Pointer().PointerDeviceType() == winrt::Devices::Input::PointerDeviceType::Touch)
+    {
+        try
+        {
+            m_visualInteractionSource.get().TryRedirectForManipulation(pointerArgs.GetCurrentPoint(target));
+            return;
+        }
+        catch (const winrt::hresult_error& e)
+        {
+            // Swallowing Access Denied error like SwipeControl does, the drag falls back to
+            // the UI thread below.
+            if (e.to_abi() != E_ACCESSDENIED)
+            {
+                throw;
+            }
+        }
+    }
+
     m_hasPointerCapture = target.CapturePointer(pointerArgs.Pointer());
     m_capturePosition = pointerArgs.GetCurrentPoint(target).Position();
 }
@@ -230,9 +266,80 @@ void SliderInteraction::OnPointerCaptureLost(winrt::UIElement const& sender, win
     m_capturePosition = winrt::Point();
 }
 
+#pragma region IInteractionTrackerOwner
+
+void SliderInteraction::CustomAnimationStateEntered(
+    winrt::InteractionTracker const& /*sender*/,
+    winrt::InteractionTrackerCustomAnimationStateEnteredArgs const& /*args*/)
+{
+}
+
+void SliderInteraction::RequestIgnored(
+    winrt::InteractionTracker const& /*sender*/,
+    winrt::InteractionTrackerRequestIgnoredArgs const& /*args*/)
+{
+}
+
+void SliderInteraction::IdleStateEntered(
+    winrt::InteractionTracker const& /*sender*/,
+    winrt::InteractionTrackerIdleStateEnteredArgs const& /*args*/)
+{
+    // The drag is over, report where it ended even if the last update was throttled.
+    if (m_isPositionChangePending)
+    {
+        RaisePositionChanged(false /*isThrottled*/);
+    }
+}
+
+void SliderInteraction::InteractingStateEntered(
+    winrt::InteractionTracker const& /*sender*/,
+    winrt::InteractionTrackerInteractingStateEnteredArgs const& /*args*/)
+{
+}
+
+void SliderInteraction::InertiaStateEntered(
+    winrt::InteractionTracker const& /*sender*/,
+    winrt::InteractionTrackerInertiaStateEnteredArgs const& /*args*/)
+{
+}
+
+void SliderInteraction::ValuesChanged(
+    winrt::InteractionTracker const& /*sender*/,
+    winrt::InteractionTrackerValuesChangedArgs const& args)
+{
+    // Our own TryUpdatePosition calls echo back here, m_position is already up to date for those.
+    if (args.RequestId() == m_lastTrackerRequestId)
+    {
+        return;
+    }
+
+    // The tracker moves opposite to the finger while the target follows it.
+    const auto trackerPosition = args.Position();
+    const double position = std::clamp(
+        -static_cast<double>(m_orientation == winrt::Orientation::Horizontal ? trackerPosition.x : trackerPosition.y),
+        m_minimum,
+        m_maximum);
+
+    if (position != m_position)
+    {
+        m_position = position;
+        RaisePositionChanged(true /*isThrottled*/);
+    }
+}
+
+#pragma endregion
+
 void SliderInteraction::ConfigureTargetElement(winrt::UIElement target)
 {
-    if (!m_translateTransform)
+    if (m_isCompositionDrivenDragEnabled &&
+        !m_interactionTracker &&
+        !m_translateTransform &&
+        DownlevelHelper::SetIsTranslationEnabledExists())
+    {
+        ConfigureInteractionTracker(target);
+    }
+
+    if (!m_translateTransform && !m_interactionTracker)
     {
         winrt::TranslateTransform translateTransform;
 
@@ -253,6 +360,50 @@ void SliderInteraction::ConfigureTargetElement(winrt::UIElement target)
     }
 }
 
+// The target's Translation is bound to the tracker's position so that touch drags move it
+// without involving the UI thread. The tracker is also what moves the target for keyboard
+// and mouse input in this mode, see UpdateTransform.
+void SliderInteraction::ConfigureInteractionTracker(winrt::UIElement const& target)
+{
+    auto visual = winrt::ElementCompositionPreview::GetElementVisual(target);
+    auto compositor = visual.Compositor();
+    winrt::ElementCompositionPreview::SetIsTranslationEnabled(target, true);
+
+    winrt::IInteractionTrackerOwner interactionTrackerOwner = *this;
+    auto interactionTracker = winrt::InteractionTracker::CreateWithOwner(compositor, interactionTrackerOwner);
+    auto visualInteractionSource = winrt::VisualInteractionSource::Create(visual);
+    interactionTracker.InteractionSources().Add(visualInteractionSource);
+
+    m_interactionTracker.set(interactionTracker);
+    m_visualInteractionSource.set(visualInteractionSource);
+    UpdateInteractionTrackerBounds();
+
+    auto translationAnimation = compositor.CreateExpressionAnimation(L"Vector3(-tracker.Position.X, -tracker.Position.Y, 0.0)");
+    translationAnimation.SetReferenceParameter(L"tracker", interactionTracker);
+    visual.StartAnimation(L"Translation", translationAnimation);
+
+    UpdateTransform();
+}
+
+void SliderInteraction::UpdateInteractionTrackerBounds()
+{
+    if (!IsCompositionDriven())
+    {
+        return;
+    }
+
+    const bool isHorizontal = m_orientation == winrt::Orientation::Horizontal;
+    auto visualInteractionSource = m_visualInteractionSource.get();
+    visualInteractionSource.PositionXSourceMode(isHorizontal ? winrt::InteractionSourceMode::EnabledWithoutInertia : winrt::InteractionSourceMode::Disabled);
+    visualInteractionSource.PositionYSourceMode(isHorizontal ? winrt::InteractionSourceMode::Disabled : winrt::InteractionSourceMode::EnabledWithoutInertia);
+
+    const float minimum = -static_cast<float>(m_maximum);
+    const float maximum = -static_cast<float>(m_minimum);
+    auto interactionTracker = m_interactionTracker.get();
+    interactionTracker.MinPosition(isHorizontal ? winrt::float3{ minimum, 0.0f, 0.0f } : winrt::float3{ 0.0f, minimum, 0.0f });
+    interactionTracker.MaxPosition(isHorizontal ? winrt::float3{ maximum, 0.0f, 0.0f } : winrt::float3{ 0.0f, maximum, 0.0f });
+}
+
 void SliderInteraction::UpdatePosition(double delta)
 {
     auto position = std::clamp(m_position + delta, m_minimum, m_maximum);
@@ -262,13 +413,35 @@ void SliderInteraction::UpdatePosition(double delta)
 
         UpdateTransform();
 
-        m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"Position"));
+        RaisePositionChanged(false /*isThrottled*/);
     }
 }
 
+// Position changes coming from the composition thread are reported at most every
+// c_positionUpdateIntervalInMilliseconds, the last one is flushed when the tracker goes idle.
+void SliderInteraction::RaisePositionChanged(bool isThrottled)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (isThrottled && now - m_lastPositionChangeTime < std::chrono::milliseconds(c_positionUpdateIntervalInMilliseconds))
+    {
+        m_isPositionChangePending = true;
+        return;
+    }
+
+    m_isPositionChangePending = false;
+    m_lastPositionChangeTime = now;
+    m_propertyChangedEventSource(*this, winrt::PropertyChangedEventArgs(L"Position"));
+}
+
 void SliderInteraction::UpdateTransform()
 {
-    if (m_translateTransform)
+    if (IsCompositionDriven())
+    {
+        const float trackerPosition = -static_cast<float>(m_position);
+        m_lastTrackerRequestId = m_interactionTracker.get().TryUpdatePosition(
+            m_orientation == winrt::Orientation::Horizontal ? winrt::float3{ trackerPosition, 0.0f, 0.0f } : winrt::float3{ 0.0f, trackerPosition, 0.0f });
+    }
+    else if (m_translateTransform)
     {
         if (m_orientation == winrt::Orientation::Horizontal)
         {
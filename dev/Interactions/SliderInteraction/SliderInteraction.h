@@ -6,7 +6,7 @@
 #include "SliderInteraction.g.h"
 
 class SliderInteraction :
-    public ReferenceTracker<SliderInteraction, winrt::implementation::SliderInteractionT>
+    public ReferenceTracker<SliderInteraction, winrt::implementation::SliderInteractionT, winrt::cloaked<winrt::IInteractionTrackerOwner>>
 {
 public:
     // ISliderInteraction
@@ -27,6 +27,12 @@ public:
     double LargeChange();
     void LargeChange(double value);
 
+    // When enabled, touch drags are redirected to an InteractionTracker that moves the target's
+    // visual on the composition thread. Position follows at most every c_positionUpdateIntervalInMilliseconds.
+    // Takes effect when the target is configured by its first interaction.
+    bool IsCompositionDrivenDragEnabled();
+    void IsCompositionDrivenDragEnabled(bool value);
+
     // INotifyPropertyChanged
     winrt::event_token PropertyChanged(winrt::PropertyChangedEventHandler const& value);
     void PropertyChanged(winrt::event_token const& token);
@@ -41,10 +47,42 @@ public:
     void OnPointerCanceled(winrt::UIElement const& sender, winrt::PointerRoutedEventArgs const& args);
     void OnPointerCaptureLost(winrt::UIElement const& sender, winrt::PointerRoutedEventArgs const& args);
 
+#pragma region IInteractionTrackerOwner
+    void CustomAnimationStateEntered(
+        winrt::InteractionTracker const& sender,
+        winrt::InteractionTrackerCustomAnimationStateEnteredArgs const& args);
+
+    void RequestIgnored(
+        winrt::InteractionTracker const& sender,
+        winrt::InteractionTrackerRequestIgnoredArgs const& args);
+
+    void IdleStateEntered(
+        winrt::InteractionTracker const& sender,
+        winrt::InteractionTrackerIdleStateEnteredArgs const& args);
+
+    void InteractingStateEntered(
+        winrt::InteractionTracker const& sender,
+        winrt::InteractionTrackerInteractingStateEnteredArgs const& args);
+
+    void InertiaStateEntered(
+        winrt::InteractionTracker const& sender,
+        winrt::InteractionTrackerInertiaStateEnteredArgs const& args);
+
+    void ValuesChanged(
+        winrt::InteractionTracker const& sender,
+        winrt::InteractionTrackerValuesChangedArgs const& args);
+#pragma endregion
+
 private:
     void ConfigureTargetElement(winrt::UIElement target);
+    void ConfigureInteractionTracker(winrt::UIElement const& target);
+    bool IsCompositionDriven() const { return static_cast<bool>(m_interactionTracker); }
     void UpdatePosition(double delta);
     void UpdateTransform();
+    void UpdateInteractionTrackerBounds();
+    void RaisePositionChanged(bool isThrottled);
+
+    static constexpr int64_t c_positionUpdateIntervalInMilliseconds = 50;
 
     winrt::Orientation m_orientation{ winrt::Orientation::Horizontal };
 
@@ -60,5 +98,13 @@ private:
 
     tracker_ref<winrt::TranslateTransform> m_translateTransform{ this };
 
+    bool m_isCompositionDrivenDragEnabled{ false };
+    tracker_ref<winrt::InteractionTracker> m_interactionTracker{ this };
+    tracker_ref<winrt::VisualInteractionSource> m_visualInteractionSource{ this };
+    // Request id of the last TryUpdatePosition call, to tell our own updates apart from the user's drags.
+    int m_lastTrackerRequestId{ -1 };
+    bool m_isPositionChangePending{ false };
+    std::chrono::steady_clock::time_point m_lastPositionChangeTime{};
+
     event_source<winrt::PropertyChangedEventHandler> m_propertyChangedEventSource{ this };
 };
@@ -2,6 +2,7 @@
 // Licensed under the MIT License. See LICENSE in the project root for license information.
 
 #pragma once
+#include <unordered_map>
 #include "SpotLightStateHelper.h"
 
 using namespace std::chrono_literals;
@@ -70,24 +71,77 @@ inline void AnimateTo(
     }
 }
 
+template <typename ValueType>
+struct SpotlightAnimationCacheEntry
+{
+    winrt::Compositor Compositor{ nullptr };
+    decltype(MakeAnimation<ValueType>(std::declval<winrt::Compositor>())) Animation{ nullptr };
+    winrt::CompositionEasingFunction EasingFunction{ nullptr };
+    EasingInfo EasingInfo{};
+};
+
+inline bool operator==(const EasingInfo& lhs, const EasingInfo& rhs)
+{
+    return lhs.EasingType == rhs.EasingType &&
+        lhs.EasingControlPoint1 == rhs.EasingControlPoint1 &&
+        lhs.EasingControlPoint2 == rhs.EasingControlPoint2;
+}
+
+// The state tables are shared by every hover light on the thread, so each frame gets one keyframe animation
+// per compositor that all lights reuse. StartAnimation snapshots the animation, which makes it safe to refresh
+// the duration and target keyframe in place before every start.
+template <typename ValueType>
+inline SpotlightAnimationCacheEntry<ValueType>& GetCachedSpotlightAnimation(
+    const winrt::Compositor& compositor,
+    const RevealHoverSpotlightAnimationInfo<ValueType>& targetFrame)
+{
+    thread_local std::unordered_map<const RevealHoverSpotlightAnimationInfo<ValueType>*, SpotlightAnimationCacheEntry<ValueType>> s_animationCache;
+
+    auto& entry = s_animationCache[&targetFrame];
+    if (entry.Compositor != compositor)
+    {
+        entry.Compositor = compositor;
+        entry.Animation = MakeAnimation<ValueType>(compositor);
+        entry.Animation.StopBehavior(winrt::Composition::AnimationStopBehavior::LeaveCurrentValue);
+        entry.EasingFunction = nullptr;
+        entry.EasingInfo = {};
+    }
+
+    // The tables can be edited through the test API, so the easing function is recreated whenever it changes.
+    if (!entry.EasingFunction || !(entry.EasingInfo == targetFrame.EasingInfo))
+    {
+        entry.EasingInfo = targetFrame.EasingInfo;
+
+        if (targetFrame.EasingInfo.EasingType == EasingTypes::CubicBezier)
+        {
+            entry.EasingFunction = compositor.CreateCubicBezierEasingFunction(targetFrame.EasingInfo.EasingControlPoint1, targetFrame.EasingInfo.EasingControlPoint2);
+        }
+        else if (targetFrame.EasingInfo.EasingType == EasingTypes::Linear)
+        {
+            entry.EasingFunction = compositor.CreateLinearEasingFunction();
+        }
+        else
+        {
+            entry.EasingFunction = nullptr;
+        }
+    }
+
+    return entry;
+}
+
 template <typename ValueType>
 inline void SetupAnimationAndStart(
     const winrt::CompositionObject& target,
     const RevealHoverSpotlightAnimationInfo<ValueType>& targetFrame)
 {
-    auto compositor = target.Compositor();
-    auto animation = MakeAnimation<ValueType>(compositor);
+    auto& entry = GetCachedSpotlightAnimation(target.Compositor(), targetFrame);
+    auto& animation = entry.Animation;
 
     animation.Duration(targetFrame.Duration);
-    animation.StopBehavior(winrt::Composition::AnimationStopBehavior::LeaveCurrentValue);
 
-    if (targetFrame.EasingInfo.EasingType == EasingTypes::CubicBezier)
-    {
-        animation.InsertKeyFrame(1, targetFrame.Value, compositor.CreateCubicBezierEasingFunction(targetFrame.EasingInfo.EasingControlPoint1, targetFrame.EasingInfo.EasingControlPoint2));
-    }
-    else if (targetFrame.EasingInfo.EasingType == EasingTypes::Linear)
+    if (entry.EasingFunction)
     {
-        animation.InsertKeyFrame(1, targetFrame.Value, compositor.CreateLinearEasingFunction());
+        animation.InsertKeyFrame(1, targetFrame.Value, entry.EasingFunction);
     }
     else
     {
@@ -58,6 +58,34 @@ void MaterialHelperBase::IgnoreAreEffectsFast(bool value)
     }
 }
 
+/* static */
+bool MaterialHelperBase::ShareAcrylicCompositionBrushes()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    return instance ? instance->m_shareAcrylicCompositionBrushes : false;
+}
+
+/* static */
+void MaterialHelperBase::ShareAcrylicCompositionBrushes(bool value)
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    instance->m_shareAcrylicCompositionBrushes = value;
+}
+
+/* static */
+bool MaterialHelperBase::RecycleRevealHoverLights()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    return instance ? instance->m_recycleRevealHoverLights : false;
+}
+
+/* static */
+void MaterialHelperBase::RecycleRevealHoverLights(bool value)
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    instance->m_recycleRevealHoverLights = value;
+}
+
 /* static */
 void MaterialHelperBase::OnRevealBrushConnected()
 {
@@ -124,41 +152,123 @@ winrt::CompositionEffectFactory MaterialHelperBase::GetOrCreateAcrylicBrushCompo
     bool shouldBrushBeOpaque,
     bool useWindowAcrylic,
     bool useCrossFadeEffect,
+    bool useLuminosityEffect,
+    bool useReducedQuality,
     bool useCache,
     std::function<winrt::CompositionEffectFactory()> cacheMissingCallback)
 {
     winrt::CompositionEffectFactory factory{ nullptr };
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
 
     if (useCache)
     {
-        auto instance = LifetimeHandler::GetMaterialHelperInstance();
-        instance->AssertUniqueCompositorOrUpdate(compositor);
-
-        auto key = BuildAcrylicBrushCompositionEffectFactoryKey(shouldBrushBeOpaque, useWindowAcrylic, useCrossFadeEffect);
-        auto value = instance->m_acrylicBrushCompositionEffectFactoryCache[key];
+        auto& cache = instance->GetCompositorCache(compositor);
+        auto key = BuildAcrylicBrushCompositionEffectFactoryKey(shouldBrushBeOpaque, useWindowAcrylic, useCrossFadeEffect, useLuminosityEffect, useReducedQuality);
+        auto& value = cache.acrylicBrushCompositionEffectFactories[key];
         if (value)
         {
             // hit cache
+            ++instance->m_acrylicEffectFactoryCacheHits;
             factory = static_cast<winrt::CompositionEffectFactory&>(value);
         }
         else
         {
             // miss, request to create new one and update cache
+            ++instance->m_acrylicEffectFactoryCacheMisses;
             factory = cacheMissingCallback();
-            instance->m_acrylicBrushCompositionEffectFactoryCache[key] = factory;
+            value = factory;
         }
     }
     else
     {
         // always create a new one
+        ++instance->m_acrylicEffectFactoryCacheMisses;
         factory = cacheMissingCallback();
     }
     return factory;
 }
 
+/* static */
+int MaterialHelperBase::AcrylicEffectFactoryCacheHits()
+{
+    auto instance = LifetimeHandler::TryGetMaterialHelperInstance();
+    return instance ? instance->m_acrylicEffectFactoryCacheHits : 0;
+}
+
+/* static */
+int MaterialHelperBase::AcrylicEffectFactoryCacheMisses()
+{
+    auto instance = LifetimeHandler::TryGetMaterialHelperInstance();
+    return instance ? instance->m_acrylicEffectFactoryCacheMisses : 0;
+}
+
+/* static */
+void MaterialHelperBase::ResetAcrylicEffectFactoryCacheCounters()
+{
+    if (auto instance = LifetimeHandler::TryGetMaterialHelperInstance())
+    {
+        instance->m_acrylicEffectFactoryCacheHits = 0;
+        instance->m_acrylicEffectFactoryCacheMisses = 0;
+    }
+}
+
+/* static */
+winrt::CompositionEffectBrush MaterialHelperBase::AcquireSharedAcrylicBrush(
+    const winrt::Compositor& compositor,
+    bool shouldBrushBeOpaque,
+    bool useWindowAcrylic,
+    bool useReducedQuality,
+    winrt::Color tintColor,
+    winrt::Color luminosityColor,
+    const winrt::CompositionBrush& noiseBrush,
+    std::function<winrt::CompositionEffectBrush()> cacheMissingCallback)
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+
+    // The noise brush belongs to a single Compositor, so entries never match across Compositors.
+    for (auto& entry : instance->m_sharedAcrylicBrushes)
+    {
+        if (entry.shouldBrushBeOpaque == shouldBrushBeOpaque &&
+            entry.useWindowAcrylic == useWindowAcrylic &&
+            entry.useReducedQuality == useReducedQuality &&
+            entry.tintColor == tintColor &&
+            entry.luminosityColor == luminosityColor &&
+            entry.noiseBrush == noiseBrush)
+        {
+            // hit cache
+            ++entry.refCount;
+            return entry.brush;
+        }
+    }
+
+    // miss, request to create new one and update cache
+    auto brush = cacheMissingCallback();
+    instance->m_sharedAcrylicBrushes.push_back({ shouldBrushBeOpaque, useWindowAcrylic, useReducedQuality, tintColor, luminosityColor, noiseBrush, brush, 1 });
+    return brush;
+}
+
+/* static */
+void MaterialHelperBase::ReleaseSharedAcrylicBrush(const winrt::CompositionBrush& brush)
+{
+    if (auto instance = LifetimeHandler::TryGetMaterialHelperInstance())
+    {
+        auto& sharedBrushes = instance->m_sharedAcrylicBrushes;
+        auto it = std::find_if(sharedBrushes.begin(), sharedBrushes.end(), [&brush](const auto& entry) { return entry.brush == brush; });
+        MUX_ASSERT(it != sharedBrushes.end());
+
+        if (it != sharedBrushes.end() && --it->refCount == 0)
+        {
+            // Last AcrylicBrush using it is gone, nobody else holds on to the composition brush.
+            it->brush.Close();
+            sharedBrushes.erase(it);
+        }
+    }
+}
+
 /* static */
 winrt::CompositionEffectFactory 
 MaterialHelperBase::GetOrCreateRevealBrushCompositionEffectFactoryFromCache(
+    const winrt::Compositor& compositor,
     bool isBorder,
     bool isInverted,
     bool hasBaseColor,
@@ -172,7 +282,7 @@ MaterialHelperBase::GetOrCreateRevealBrushCompositionEffectFactoryFromCache(
     key |= hasBaseColor ? static_cast<int>(RevealBrushCacheFlags::HasBaseColor) : 0;
 
     winrt::ICompositionEffectFactory &factory =
-        instance->m_revealBrushCompositionEffectFactoryCache[key];
+        instance->GetCompositorCache(compositor).revealBrushCompositionEffectFactories[key];
 
     if (!factory)
     {
@@ -187,32 +297,62 @@ MaterialHelperBase::GetOrCreateRevealBrushCompositionEffectFactoryFromCache(
 int MaterialHelperBase::BuildAcrylicBrushCompositionEffectFactoryKey(
     bool shouldBrushBeOpaque,
     bool useWindowAcrylic,
-    bool useCrossFadeEffect)
+    bool useCrossFadeEffect,
+    bool useLuminosityEffect,
+    bool useReducedQuality)
 {
     int key = 0;
     key |= shouldBrushBeOpaque ? AcrylicBrushCacheHelperParam::ShouldBrushBeOpaque : 0;
     key |= useWindowAcrylic ? AcrylicBrushCacheHelperParam::UseWindowAcrylic : 0;
     key |= useCrossFadeEffect ? AcrylicBrushCacheHelperParam::UseCrossFadeEffect : 0;
+    key |= useLuminosityEffect ? AcrylicBrushCacheHelperParam::UseLuminosityEffect : 0;
+    key |= useReducedQuality ? AcrylicBrushCacheHelperParam::UseReducedQuality : 0;
     return key;
 }
 
-void MaterialHelperBase::AssertUniqueCompositorOrUpdate(const winrt::Compositor& compositor)
+MaterialHelperBase::CompositorCache& MaterialHelperBase::GetCompositorCache(const winrt::Compositor& compositor)
+{
+    for (auto& cache : m_compositorCaches)
+    {
+        if (cache.compositor == compositor)
+        {
+            return cache;
+        }
+    }
+
+    m_compositorCaches.emplace_back();
+    m_compositorCaches.back().compositor = compositor;
+    return m_compositorCaches.back();
+}
+
+winrt::CompositionSurfaceBrush MaterialHelperBase::GetOrCreateScaledNoiseBrush(const winrt::Compositor& compositor, int dpiScale)
 {
-    if (m_acrylicCompositor)
+    winrt::CompositionSurfaceBrush noiseBrush{ nullptr };
+
+    auto& dpiScaledNoiseBrushes = GetCompositorCache(compositor).dpiScaledNoiseBrushes;
+    auto it = dpiScaledNoiseBrushes.find(dpiScale);
+    if (it != dpiScaledNoiseBrushes.end())
     {
-        MUX_ASSERT(compositor == m_acrylicCompositor);
+        noiseBrush = it->second;
     }
     else
     {
-        m_acrylicCompositor = compositor;
+        noiseBrush = CreateScaledBrush(compositor, dpiScale);
+        dpiScaledNoiseBrushes.emplace(dpiScale, noiseBrush);
     }
+
+    return noiseBrush;
 }
 
-winrt::CompositionSurfaceBrush MaterialHelperBase::CreateScaledBrush(int dpiScale)
+winrt::CompositionSurfaceBrush MaterialHelperBase::CreateScaledBrush(const winrt::Compositor& compositor, int dpiScale)
 {
-    winrt::Compositor compositor = winrt::Window::Current().Compositor();
-    winrt::LoadedImageSurface surface{ ResourceAccessor::GetImageSurface(IR_NoiseAsset_256X256_PNG, { 256, 256 }) };
-    winrt::CompositionSurfaceBrush noiseBrush = compositor.CreateSurfaceBrush(surface);
+    // The noise asset is only loaded and decoded once, brushes for other DPI scales share it with their own scale transform.
+    auto& cache = GetCompositorCache(compositor);
+    if (!cache.noiseSurface)
+    {
+        cache.noiseSurface = ResourceAccessor::GetImageSurface(IR_NoiseAsset_256X256_PNG, { 256, 256 });
+    }
+    winrt::CompositionSurfaceBrush noiseBrush = compositor.CreateSurfaceBrush(cache.noiseSurface);
 
     // Noise should never be stretched (we tile it instead)
     noiseBrush.Stretch(winrt::CompositionStretch::None);
@@ -290,28 +430,15 @@ void MaterialHelper::RevealBorderLightUnavailable(bool value)
 }
 
 /* static */
-winrt::CompositionSurfaceBrush MaterialHelper::GetNoiseBrush(int dpiScale)
+winrt::CompositionSurfaceBrush MaterialHelper::GetNoiseBrush(const winrt::Compositor& compositor, int dpiScale)
 {
     auto instance = LifetimeHandler::GetMaterialHelperInstance();
-    return instance->GetNoiseBrushImpl(dpiScale);
+    return instance->GetNoiseBrushImpl(compositor, dpiScale);
 }
 
-winrt::CompositionSurfaceBrush MaterialHelper::GetNoiseBrushImpl(int dpiScale)
+winrt::CompositionSurfaceBrush MaterialHelper::GetNoiseBrushImpl(const winrt::Compositor& compositor, int dpiScale)
 {
-    winrt::CompositionSurfaceBrush noiseBrush{ nullptr };
-
-    auto it = m_dpiScaledNoiseBrushes.find(dpiScale);
-    if (it != m_dpiScaledNoiseBrushes.end())
-    {
-        noiseBrush = it->second;
-    }
-    else
-    {
-        noiseBrush = CreateScaledBrush(dpiScale);
-        m_dpiScaledNoiseBrushes.emplace(dpiScale, noiseBrush);
-    }
-
-    return noiseBrush;
+    return GetOrCreateScaledNoiseBrush(compositor, dpiScale);
 }
 
 template <typename T>
@@ -437,6 +564,23 @@ template <typename T>
     UpdateDpiScaledNoiseBrush(instance);
 }
 
+// Brushes shared between several AcrylicBrushes can't have their noise swapped for just one of them,
+// the brush is switched to the shared brush matching the new noise instead.
+/*static*/ bool MaterialHelper::RecreateSharedBrush(AcrylicBrush* instance)
+{
+    if (instance->m_isUsingSharedBrush)
+    {
+        instance->CreateAcrylicBrush(false /* useCrossFadeEffect */);
+        return true;
+    }
+    return false;
+}
+
+/*static*/ bool MaterialHelper::RecreateSharedBrush(RevealBrush* /*instance*/)
+{
+    return false;
+}
+
 template <typename T>
 /*static*/ void MaterialHelper::BrushTemplates<T>::UpdateDpiScaledNoiseBrush(T* instance)
 {
@@ -450,12 +594,15 @@ template <typename T>
 
         if (resScaleInt != 0)
         {
-            auto dpiScaledNoiseBrush = GetNoiseBrush(resScaleInt);
+            auto dpiScaledNoiseBrush = GetNoiseBrush(instance->m_brush.Compositor(), resScaleInt);
             _ASSERT(dpiScaledNoiseBrush != instance->m_dpiScaledNoiseBrush);
 
-            winrt::CompositionEffectBrush effectBrush = instance->m_brush.try_as<winrt::CompositionEffectBrush>();
-            effectBrush.SetSourceParameter(L"Noise", dpiScaledNoiseBrush);
             instance->m_dpiScaledNoiseBrush = dpiScaledNoiseBrush;
+            if (!RecreateSharedBrush(instance))
+            {
+                winrt::CompositionEffectBrush effectBrush = instance->m_brush.try_as<winrt::CompositionEffectBrush>();
+                effectBrush.SetSourceParameter(L"Noise", dpiScaledNoiseBrush);
+            }
         }
     }
     else
@@ -686,12 +833,9 @@ MaterialHelper::MaterialHelper()
     {
         EnsureCompositionCapabilities();
         HookupDpiChangedHandler();
-        
-        // For RS2 apps, we susbscribe to VisibilityChanged to work around bug 11159685.
-        if (!SharedHelpers::IsRS3OrHigher())
-        {
-            HookupVisibilityChangedHandler();
-        }
+
+        // VisibilityChanged drives SuspendMaterialsWhileHidden, and on RS2 it also works around bug 11159685.
+        HookupVisibilityChangedHandler();
     }
     else
     {
@@ -706,10 +850,7 @@ MaterialHelper::MaterialHelper()
             strongThis->HookupDpiChangedHandler();
 
             // ... and get the CoreWindow to sign up for VisibilityChanged
-            if (!SharedHelpers::IsRS3OrHigher())
-            {
-                strongThis->HookupVisibilityChangedHandler();
-            }
+            strongThis->HookupVisibilityChangedHandler();
         });
     }
 
@@ -752,8 +893,12 @@ void MaterialHelper::HookupDpiChangedHandler()
 
 void MaterialHelper::HookupVisibilityChangedHandler()
 {
-    winrt::CoreWindow coreWindow = winrt::Window::Current().CoreWindow();
-    m_visibilityChangedRevoker = coreWindow.VisibilityChanged(winrt::auto_revoke, { this, &MaterialHelper::OnVisibilityChanged });
+    // No CoreWindow in XamlPresenter scenarios, materials then never get suspended.
+    if (winrt::CoreWindow coreWindow = winrt::Window::Current().CoreWindow())
+    {
+        m_visibilityChangedRevoker = coreWindow.VisibilityChanged(winrt::auto_revoke, { this, &MaterialHelper::OnVisibilityChanged });
+        m_isWindowHidden = !coreWindow.Visible();
+    }
 }
 
 // Only sign up for Window.SizeChanged events if there is a connected AcrylicBrush. In particular, reveal-only apps shouldn't incur the cost here.
@@ -766,6 +911,94 @@ void MaterialHelper::EnsureSizeChangedHandler()
     }
 }
 
+// Only sign up for Window.Activated once a window acrylic brush needs it.
+void MaterialHelper::EnsureWindowActivationResources()
+{
+    if (!m_windowActivationProperties)
+    {
+        if (!m_currentWindow)
+        {
+            m_currentWindow = winrt::Window::Current();
+        }
+        m_windowActivatedToken = m_currentWindow.Activated({ this, &MaterialHelper::OnWindowActivated });
+
+        // With the RS3 API CoreWindow.ActivationMode we can get the right state when the first brush connects while inactive (Bug 11657917).
+        // Unfortunately we can't fix this for RS2 or older RS3 builds.
+        if (SharedHelpers::IsCoreWindowActivationModeAvailable())
+        {
+            auto coreWindow = m_currentWindow.CoreWindow();
+            MUX_ASSERT_MSG(coreWindow, "Expecting to have a CoreWindow instance when AcrylicBrush is connected.");
+
+            if (coreWindow)
+            {
+                m_isWindowActivated = IsWindowActive(coreWindow);
+            }
+        }
+
+        auto compositor = m_currentWindow.Compositor();
+        m_windowActivationProperties = compositor.CreatePropertySet();
+        m_windowActivationProperties.InsertScalar(L"Weight", m_isWindowActivated ? 1.0f : 0.0f);
+
+        m_windowActivationWeightExpression = compositor.CreateExpressionAnimation(L"activation.Weight");
+        m_windowActivationWeightExpression.SetReferenceParameter(L"activation", m_windowActivationProperties);
+
+        // Same curve and duration as AcrylicBrush::PlayCrossFadeAnimation.
+        auto easing = compositor.CreateCubicBezierEasingFunction({ 0.5f, 0.0f }, { 0.0f, 0.9f });
+        m_windowActivatedAnimation = compositor.CreateScalarKeyFrameAnimation();
+        m_windowActivatedAnimation.InsertKeyFrame(1.0f, 1.0f, easing);
+        m_windowActivatedAnimation.Duration(std::chrono::milliseconds(167));
+        m_windowDeactivatedAnimation = compositor.CreateScalarKeyFrameAnimation();
+        m_windowDeactivatedAnimation.InsertKeyFrame(1.0f, 0.0f, easing);
+        m_windowDeactivatedAnimation.Duration(std::chrono::milliseconds(167));
+    }
+}
+
+void MaterialHelper::OnWindowActivated(const winrt::IInspectable& sender, const winrt::WindowActivatedEventArgs& args)
+{
+    bool isActivated = false;
+
+    if (SharedHelpers::IsCoreWindowActivationModeAvailable())
+    {
+        winrt::CoreWindow coreWindow = sender.try_as<winrt::Window>().CoreWindow();
+        isActivated = IsWindowActive(coreWindow);
+    }
+    else
+    {
+        isActivated = args.WindowActivationState() != winrt::CoreWindowActivationState::Deactivated;
+    }
+
+    if (m_isWindowActivated != isActivated)
+    {
+        m_isWindowActivated = isActivated;
+        m_windowActivationProperties.StartAnimation(L"Weight", isActivated ? m_windowActivatedAnimation : m_windowDeactivatedAnimation);
+    }
+}
+
+/* static */
+bool MaterialHelper::IsWindowActive(const winrt::CoreWindow& coreWindow)
+{
+    winrt::CoreWindowActivationMode activationMode = coreWindow.ActivationMode();
+
+    return activationMode == winrt::CoreWindowActivationMode::ActivatedNotForeground ||
+           activationMode == winrt::CoreWindowActivationMode::ActivatedInForeground;
+}
+
+/* static */
+void MaterialHelper::BindToWindowActivation(const winrt::CompositionBrush& brush)
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    instance->EnsureWindowActivationResources();
+    brush.StartAnimation(L"FadeInOut.Weight", instance->m_windowActivationWeightExpression);
+}
+
+/* static */
+bool MaterialHelper::IsWindowActivated()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    instance->EnsureWindowActivationResources();
+    return instance->m_isWindowActivated;
+}
+
 void MaterialHelper::EnsureCompositionCapabilities()
 {
     if (!m_compositionCapabilities && SharedHelpers::IsRS2OrHigher())
@@ -795,12 +1028,19 @@ MaterialHelper::~MaterialHelper()
         m_uiSettings.AdvancedEffectsEnabledChanged(m_advancedEffectsEnabledChangedToken);
     }
 
+    if (m_windowActivatedToken.value && m_currentWindow)
+    {
+        m_currentWindow.Activated(m_windowActivatedToken);
+        m_windowActivatedToken.value = 0;
+    }
+
     if (m_windowSizeChangedToken.value && m_currentWindow)
     {
         m_currentWindow.SizeChanged(m_windowSizeChangedToken);
-        m_currentWindow = nullptr;
         m_windowSizeChangedToken.value = 0;
     }
+
+    m_currentWindow = nullptr;
 }
 
 void MaterialHelper::OnEnergySaverStatusChanged(const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/)
@@ -808,6 +1048,11 @@ void MaterialHelper::OnEnergySaverStatusChanged(const winrt::IInspectable& /*sen
     UpdatePolicyStatus();
 }
 
+void MaterialHelper::OnBatteryStatusChanged(const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/)
+{
+    UpdatePolicyStatus();
+}
+
 void MaterialHelper::OnCompositionCapabilitiesChanged(const winrt::CompositionCapabilities& /*sender*/, const winrt::IInspectable& /*args*/)
 {
     UpdatePolicyStatus();
@@ -819,7 +1064,7 @@ void MaterialHelper::OnUISettingsChanged(const winrt::UISettings& /*sender*/, co
 }
 
 // If plateau scale changed (eg by moving between different res screens in multimon),
-// reload the noise surface to prevent noise from being scaled
+// switch to the noise brush for the new scale to prevent noise from being scaled
 void MaterialHelper::OnDpiChanged(const winrt::IInspectable& sender, const winrt::IInspectable& /*args*/)
 {
     float previousLogicalDpi = m_logicalDpi;
@@ -842,20 +1087,36 @@ void MaterialHelper::OnDpiChanged(const winrt::IInspectable& sender, const winrt
     // We also get here in case of (logical) Resolution change, ignore that case
     if (previousLogicalDpi != m_logicalDpi)
     {
-        ResetNoise();
+        // Brushes for scales seen before stay cached, so moving back and forth between monitors doesn't recreate them.
+        m_noiseBrush = nullptr;
         auto strongThis = get_strong();
         m_noiseChangedListeners(strongThis);
     }
 }
 
+// Tracks window visibility for SuspendMaterialsWhileHidden.
 // Xaml may have offered its DComp resources - particularly the Noise texture - while app window was not visible.
 // Due to a bug 11159685 (fixed in RS3), LoadedImageSurface may fail to reclaim an offered and discarded surface, 
 // resulitng in "noiseless acrylic". Reload the noise with a new LIS when app regains visibilty as a workaround.
 void MaterialHelper::OnVisibilityChanged(const winrt::CoreWindow&, const winrt::VisibilityChangedEventArgs& args)
 {
-    MUX_ASSERT(!SharedHelpers::IsRS3OrHigher());
+    if (!SharedHelpers::IsRS3OrHigher())
+    {
+        OnVisibilityChangedRS2(args.Visible());
+    }
+
+    // Done after the RS2 workaround so that brushes resuming here wait for the noise to be recreated.
+    const bool isWindowHidden = !args.Visible();
+    if (m_isWindowHidden != isWindowHidden)
+    {
+        m_isWindowHidden = isWindowHidden;
+        UpdatePolicyStatus(true /* onUIThread */);
+    }
+}
 
-    if (args.Visible())
+void MaterialHelper::OnVisibilityChangedRS2(bool isVisible)
+{
+    if (isVisible)
     {
         if (m_wasWindowHidden)
         {
@@ -908,11 +1169,27 @@ void MaterialHelper::UpdatePolicyStatus(bool onUIThread)
         bool areEffectsFast = m_compositionCapabilities ? (m_compositionCapabilities.AreEffectsFast() || m_ignoreAreEffectsFast) : false;
         bool advancedEffectsEnabled = m_uiSettings ? m_uiSettings.AdvancedEffectsEnabled() : true;
 
-        bool isDisabledByPolicy = m_simulateDisabledByPolicy || (isEnergySaverMode || !areEffectsFast || !advancedEffectsEnabled);
+        bool isSuspendedWhileHidden = m_suspendMaterialsWhileHidden && m_isWindowHidden;
 
-        if (m_isDisabledByMaterialPolicy != isDisabledByPolicy)
+        bool isDisabledByPolicy = m_simulateDisabledByPolicy || (isEnergySaverMode || !areEffectsFast || !advancedEffectsEnabled) ||
+            m_requestedMaterialQuality == MaterialQuality::Fallback || isSuspendedWhileHidden;
+
+        MaterialQuality materialQuality = m_requestedMaterialQuality;
+        if (isDisabledByPolicy)
+        {
+            materialQuality = MaterialQuality::Fallback;
+        }
+        else if (m_batteryStatusChangedRevoker && winrt::PowerManager::BatteryStatus() == winrt::BatteryStatus::Discharging)
+        {
+            materialQuality = MaterialQuality::Reduced;
+        }
+
+        m_isSuspendedWhileHidden = isSuspendedWhileHidden;
+
+        if (m_isDisabledByMaterialPolicy != isDisabledByPolicy || m_materialQuality != materialQuality)
         {
             m_isDisabledByMaterialPolicy = isDisabledByPolicy;
+            m_materialQuality = materialQuality;
             m_policyChangedListeners(strongThis, m_isDisabledByMaterialPolicy);
         }
     };
@@ -937,19 +1214,111 @@ void MaterialHelper::UpdatePolicyStatus(bool onUIThread)
     }
 }
 
-void MaterialHelper::ResetNoise()
+/* static */
+void MaterialHelper::RequestedMaterialQuality(MaterialQuality value)
 {
-    if (m_noiseSurface)
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    if (instance->m_requestedMaterialQuality != value)
     {
-        m_noiseSurface.Close();
-        m_noiseSurface = nullptr;
+        instance->m_requestedMaterialQuality = value;
+        instance->UpdatePolicyStatus();
     }
+}
 
-    if (m_noiseBrush)
+/* static */
+MaterialHelperBase::MaterialQuality MaterialHelper::RequestedMaterialQuality()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    return instance ? instance->m_requestedMaterialQuality : MaterialQuality::Full;
+}
+
+/* static */
+void MaterialHelper::ReduceMaterialQualityOnBattery(bool value)
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    if (instance->m_reduceMaterialQualityOnBattery != value)
     {
-        m_noiseBrush.Close();
-        m_noiseBrush = nullptr;
+        instance->m_reduceMaterialQualityOnBattery = value;
+
+        // Only listen to battery changes while they matter.
+        if (value)
+        {
+            try
+            {
+                instance->m_batteryStatusChangedRevoker = winrt::PowerManager::BatteryStatusChanged(winrt::auto_revoke, { instance.get(), &MaterialHelper::OnBatteryStatusChanged });
+            }
+            catch (winrt::hresult_error)
+            {
+                // Same as for EnergySaverStatusChanged, some processes can't activate PowerManager. Keep full quality there.
+            }
+        }
+        else
+        {
+            instance->m_batteryStatusChangedRevoker.revoke();
+        }
+
+        instance->UpdatePolicyStatus();
+    }
+}
+
+/* static */
+bool MaterialHelper::ReduceMaterialQualityOnBattery()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    return instance ? instance->m_reduceMaterialQualityOnBattery : false;
+}
+
+/* static */
+MaterialHelperBase::MaterialQuality MaterialHelper::EffectiveMaterialQuality()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    return instance ? instance->m_materialQuality : MaterialQuality::Fallback;
+}
+
+/* static */
+void MaterialHelper::SuspendMaterialsWhileHidden(bool value)
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    if (instance->m_suspendMaterialsWhileHidden != value)
+    {
+        instance->m_suspendMaterialsWhileHidden = value;
+        instance->UpdatePolicyStatus();
+    }
+}
+
+/* static */
+bool MaterialHelper::SuspendMaterialsWhileHidden()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    return instance ? instance->m_suspendMaterialsWhileHidden : true;
+}
+
+/* static */
+bool MaterialHelper::IsSuspendedWhileHidden()
+{
+    auto instance = LifetimeHandler::TryGetMaterialHelperInstance();
+    return instance ? instance->m_isSuspendedWhileHidden : false;
+}
+
+// Closes the noise surface and the brushes of every DPI scale, they get recreated on next use.
+void MaterialHelper::ResetNoise()
+{
+    for (auto& cache : m_compositorCaches)
+    {
+        for (auto& entry : cache.dpiScaledNoiseBrushes)
+        {
+            entry.second.Close();
+        }
+        cache.dpiScaledNoiseBrushes.clear();
+
+        if (cache.noiseSurface)
+        {
+            cache.noiseSurface.Close();
+            cache.noiseSurface = nullptr;
+        }
     }
+
+    m_noiseBrush = nullptr;
 }
 
 /* static */
@@ -984,12 +1353,7 @@ winrt::CompositionSurfaceBrush MaterialHelper::GetNoiseBrushImpl()
             // Assuming 1.0 scaling isn't correct. Xaml has internal code that handles XamlPresenter scenarios, but that isn't available through public APIs. We can fix this for WUXC but not MUX.
         }
 
-        m_noiseBrush = CreateScaledBrush(resScaleInt);
-
-        if (!SharedHelpers::IsRS3OrHigher())
-        {
-            m_noiseSurface = (m_noiseBrush.Surface()).try_as<winrt::LoadedImageSurface>();
-        }
+        m_noiseBrush = GetOrCreateScaledNoiseBrush(winrt::Window::Current().Compositor(), resScaleInt);
     }
 
     return m_noiseBrush;
@@ -1080,6 +1444,20 @@ bool MaterialHelper::IncrementAndCheckFailedToAttachLightsCount()
     return instance->FailedToAttachLights();
 }
 
+/* static */
+void MaterialHelper::IncrementAttachLightsPassCount()
+{
+    auto instance = LifetimeHandler::GetMaterialHelperInstance();
+    instance->m_attachLightsPassCount++;
+}
+
+/* static */
+int MaterialHelper::AttachLightsPassCount()
+{
+    auto instance = LifetimeHandler::TryGetMaterialHelperInstance();
+    return instance ? instance->m_attachLightsPassCount : 0;
+}
+
 bool MaterialHelper::FailedToAttachLights()
 {
     return m_failedToAttachLightsCount > sc_maxFailedToAttachLightsCount;
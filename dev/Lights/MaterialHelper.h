@@ -37,12 +37,32 @@ class MaterialHelperBase :
     public winrt::implements<MaterialHelperBase, winrt::IInspectable>
 {
 public:
+    // Tiers that materials render at, from most to least expensive. Reduced keeps acrylic and reveal on but drops the
+    // acrylic noise layer, uses a smaller blur radius and turns off the reveal border light. Fallback is the solid
+    // color state materials use when they are disabled by policy.
+    enum class MaterialQuality
+    {
+        Full,
+        Reduced,
+        Fallback,
+    };
+
     static void SimulateDisabledByPolicy(bool value);
     static bool SimulateDisabledByPolicy();
 
     static void IgnoreAreEffectsFast(bool value);
     static bool IgnoreAreEffectsFast();
 
+    // When on, AcrylicBrushes with identical effective parameters share a single CompositionEffectBrush.
+    // Only affects brushes created after the value changes.
+    static void ShareAcrylicCompositionBrushes(bool value);
+    static bool ShareAcrylicCompositionBrushes();
+
+    // When on, reveal hover and press lights are taken off containers once they fade back to Normal and are reused
+    // by the next container, so only the containers close to the pointer carry lights.
+    static void RecycleRevealHoverLights(bool value);
+    static bool RecycleRevealHoverLights();
+
     static void OnRevealBrushConnected();
     static void OnRevealBrushDisconnected();
 
@@ -53,10 +73,31 @@ public:
         bool shouldBrushBeOpaque,
         bool useWindowAcrylic,
         bool useCrossFadeEffect,
+        bool useLuminosityEffect,
+        bool useReducedQuality,
         bool useCache,
         std::function<winrt::CompositionEffectFactory()> cacheMissingCallback);
 
+    // Number of acrylic effect factory requests served from / missing the cache since the last reset
+    static int AcrylicEffectFactoryCacheHits();
+    static int AcrylicEffectFactoryCacheMisses();
+    static void ResetAcrylicEffectFactoryCacheCounters();
+
+    // Returns the non-crossfading acrylic effect brush shared by all AcrylicBrushes with these parameters, creating it with
+    // cacheMissingCallback on first use. Each call must be balanced by a call to ReleaseSharedAcrylicBrush.
+    static winrt::CompositionEffectBrush AcquireSharedAcrylicBrush(
+        const winrt::Compositor& compositor,
+        bool shouldBrushBeOpaque,
+        bool useWindowAcrylic,
+        bool useReducedQuality,
+        winrt::Color tintColor,
+        winrt::Color luminosityColor,
+        const winrt::CompositionBrush& noiseBrush,
+        std::function<winrt::CompositionEffectBrush()> cacheMissingCallback);
+    static void ReleaseSharedAcrylicBrush(const winrt::CompositionBrush& brush);
+
     static winrt::CompositionEffectFactory GetOrCreateRevealBrushCompositionEffectFactoryFromCache(
+        const winrt::Compositor& compositor,
         bool isBorder,
         bool isInverted,
         bool hasBaseColor,
@@ -74,8 +115,11 @@ public:
         ShouldBrushBeOpaque = 1,
         UseWindowAcrylic = 2,
         UseCrossFadeEffect = 4,
+        UseLuminosityEffect = 8,
+        UseReducedQuality = 16,
+        // The set of animatable properties follows from the flags above, so they fully describe the effect graph.
         // If you add more value in, please update MaxCacheSize too
-        MaxCacheSize = 8
+        MaxCacheSize = 32
     };
 
     enum class RevealBrushCacheFlags
@@ -87,33 +131,66 @@ public:
     };
 
     // Acrylic Brush
-    static int BuildAcrylicBrushCompositionEffectFactoryKey(bool shouldBrushBeOpaque, bool useWindowAcrylic, bool useCrossFadeEffect);
-    void AssertUniqueCompositorOrUpdate(const winrt::Compositor& compositor);
+    static int BuildAcrylicBrushCompositionEffectFactoryKey(bool shouldBrushBeOpaque, bool useWindowAcrylic, bool useCrossFadeEffect, bool useLuminosityEffect, bool useReducedQuality);
 
-    // cache storage for AcrylicBrushEffectory
-    std::array<winrt::ICompositionEffectFactory, AcrylicBrushCacheHelperParam::MaxCacheSize>
-        m_acrylicBrushCompositionEffectFactoryCache;
+    // Effect factories and noise brushes can't be used with a different Compositor than the one that created them.
+    // Threads hosting several windows or islands can see more than one Compositor, so each gets its own cache.
+    struct CompositorCache
+    {
+        winrt::Compositor compositor{ nullptr };
+
+        // cache storage for AcrylicBrushEffectory
+        std::array<winrt::ICompositionEffectFactory, AcrylicBrushCacheHelperParam::MaxCacheSize>
+            acrylicBrushCompositionEffectFactories;
 
-    // This is only a defensive assert to check that Compositor should be the same in the same thread
-    // m_acrylicCompositor is used keep a copy of it and then assert in each following query.
-    // If Compositor is not the same, current implementation would return wrong EffectFactory
-    winrt::Compositor m_acrylicCompositor{ nullptr };
+        // Reveal
+        std::array<winrt::ICompositionEffectFactory, (size_t)RevealBrushCacheFlags::MaxCacheSize>
+            revealBrushCompositionEffectFactories;
 
-    // Reveal
-    std::array<winrt::ICompositionEffectFactory, (size_t)RevealBrushCacheFlags::MaxCacheSize>
-        m_revealBrushCompositionEffectFactoryCache;
+        // The noise tile at its native size, shared by all the DPI scaled noise brushes
+        winrt::LoadedImageSurface noiseSurface{ nullptr };
 
-    winrt::CompositionSurfaceBrush CreateScaledBrush(int dpiScale);
+        // Noise brushes, keyed by DPI scale. Kept across DPI changes so that going back to a scale reuses its brush.
+        std::unordered_map<int, winrt::CompositionSurfaceBrush> dpiScaledNoiseBrushes;
+    };
+    CompositorCache& GetCompositorCache(const winrt::Compositor& compositor);
+
+    // Usually holds a single entry, so lookups are a linear search.
+    std::vector<CompositorCache> m_compositorCaches;
+    int m_acrylicEffectFactoryCacheHits{};
+    int m_acrylicEffectFactoryCacheMisses{};
+
+    // Acrylic effect brushes shared between AcrylicBrushes, see AcquireSharedAcrylicBrush
+    struct SharedAcrylicBrushEntry
+    {
+        bool shouldBrushBeOpaque{};
+        bool useWindowAcrylic{};
+        bool useReducedQuality{};
+        winrt::Color tintColor{};
+        winrt::Color luminosityColor{};
+        winrt::CompositionBrush noiseBrush{ nullptr };
+        winrt::CompositionEffectBrush brush{ nullptr };
+        int refCount{};
+    };
+    std::vector<SharedAcrylicBrushEntry> m_sharedAcrylicBrushes;
+
+    winrt::CompositionSurfaceBrush GetOrCreateScaledNoiseBrush(const winrt::Compositor& compositor, int dpiScale);
+    winrt::CompositionSurfaceBrush CreateScaledBrush(const winrt::Compositor& compositor, int dpiScale);
 
 protected:
     bool m_simulateDisabledByPolicy{};   // Test use only: Simulate that material is disabled by policy - for test use only
     bool m_ignoreAreEffectsFast{};       // Test use only: Ignore CompositionCapabilities.AreEffectFasts so tests can get Neon on VMs
+    bool m_shareAcrylicCompositionBrushes{};
+    bool m_recycleRevealHoverLights{};
 
 };
 
 #if BUILD_WINDOWS
 // ************************************ WUXC version of MaterialHelper *****************************************
 
+class AcrylicBrush;
+class RevealBrush;
+
 struct IslandBorderLightInfo
 {
     int m_revealBrushConnectedCount;
@@ -151,7 +228,7 @@ public:
 
     virtual ~MaterialHelper() {};
 
-    static winrt::CompositionSurfaceBrush GetNoiseBrush(int dpiScale);
+    static winrt::CompositionSurfaceBrush GetNoiseBrush(const winrt::Compositor& compositor, int dpiScale);
 
     static void RevealBorderLightUnavailable(bool value);
     static bool RevealBorderLightUnavailable();
@@ -169,10 +246,11 @@ protected:
     bool m_revealBorderLightUnavailable;
 
 private:
-    winrt::CompositionSurfaceBrush GetNoiseBrushImpl(int dpiScale);
+    winrt::CompositionSurfaceBrush GetNoiseBrushImpl(const winrt::Compositor& compositor, int dpiScale);
+    static bool RecreateSharedBrush(AcrylicBrush* instance);
+    static bool RecreateSharedBrush(RevealBrush* instance);
 
 private:
-    std::unordered_map<int, winrt::CompositionSurfaceBrush> m_dpiScaledNoiseBrushes;
     // Number of connected RevealBrushes in the tree (i.e. # of brushes that need lights) and associated lights foreach XamlIsland.
     std::map<winrt::XamlIsland, IslandBorderLightInfo> m_islandBorderLights;
 
@@ -203,6 +281,32 @@ public:
 
     void UpdatePolicyStatus(bool onUIThread = false);
 
+    // The quality the app asks materials to render at. Policy can still lower it, e.g. to Fallback in energy saver mode.
+    static void RequestedMaterialQuality(MaterialQuality value);
+    static MaterialQuality RequestedMaterialQuality();
+
+    // When on, materials render at no more than Reduced quality while the device runs on battery.
+    static void ReduceMaterialQualityOnBattery(bool value);
+    static bool ReduceMaterialQualityOnBattery();
+
+    // The quality materials should currently render at. This is Fallback whenever materials are disabled by policy.
+    // Listeners of PolicyChanged are also notified when only this value changes.
+    static MaterialQuality EffectiveMaterialQuality();
+
+    // When on (the default), materials drop to Fallback while the CoreWindow is hidden, i.e. minimized or fully occluded.
+    // That releases effect brushes and light resources until the window is visible again.
+    static void SuspendMaterialsWhileHidden(bool value);
+    static bool SuspendMaterialsWhileHidden();
+
+    // True while materials are in Fallback only because the window is hidden. Brushes use it to skip transitions nobody sees.
+    static bool IsSuspendedWhileHidden();
+
+    // Window acrylic crossfades to its fallback color while the window is inactive. Instead of every brush listening to
+    // Window.Activated, MaterialHelper animates one property set per thread and window acrylic brushes bind
+    // their "FadeInOut.Weight" to it, so an activation change costs one animation however many brushes there are.
+    static void BindToWindowActivation(const winrt::CompositionBrush& brush);
+    static bool IsWindowActivated();
+
     static void SetShouldBeginAttachingLights(bool shouldBeginAttachingLights);
     static bool ShouldBeginAttachingLights();
     static void SetShouldContinueAttachingLights(bool shouldContinueAttachingLights);
@@ -212,16 +316,25 @@ public:
     static bool IncrementAndCheckFailedToAttachLightsCount();
     static void ResetFailedToAttachLightsCount();
 
+    // Number of layout passes or frames spent waiting to attach lights
+    static void IncrementAttachLightsPassCount();
+    static int AttachLightsPassCount();
+
 private:
     void EnsureCompositionCapabilities();
     void EnsureSizeChangedHandler();
+    void EnsureWindowActivationResources();
 
     void OnEnergySaverStatusChanged(const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/);
+    void OnBatteryStatusChanged(const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/);
     void OnCompositionCapabilitiesChanged(const winrt::CompositionCapabilities& /*sender*/, const winrt::IInspectable& /*args*/);
     void OnUISettingsChanged(const winrt::UISettings& /*sender*/, const winrt::IInspectable& /*args*/);
     void OnDpiChanged(const winrt::IInspectable& sender, const winrt::IInspectable& args);
     void OnSizeChanged(const winrt::IInspectable& sender, const winrt::IInspectable& args);
+    void OnWindowActivated(const winrt::IInspectable& sender, const winrt::WindowActivatedEventArgs& args);
+    static bool IsWindowActive(const winrt::CoreWindow& coreWindow);
     void OnVisibilityChanged(const winrt::CoreWindow&, const winrt::VisibilityChangedEventArgs& args);
+    void OnVisibilityChangedRS2(bool isVisible);
 
     void HookupDpiChangedHandler();
     void HookupVisibilityChangedHandler();
@@ -232,19 +345,31 @@ private:
     bool FailedToAttachLights();
 
     bool m_isDisabledByMaterialPolicy{};
+    MaterialQuality m_materialQuality{ MaterialQuality::Full };
+    MaterialQuality m_requestedMaterialQuality{ MaterialQuality::Full };
+    bool m_reduceMaterialQualityOnBattery{};
+    bool m_suspendMaterialsWhileHidden{ true };
+    bool m_isWindowHidden{};
+    bool m_isSuspendedWhileHidden{};
+    bool m_isWindowActivated{ true };
     float m_logicalDpi{};
 
     winrt::PowerManager::EnergySaverStatusChanged_revoker m_energySaverStatusChangedRevoker{};
+    winrt::PowerManager::BatteryStatusChanged_revoker m_batteryStatusChangedRevoker{};
     winrt::event_token m_compositionCapabilitiesChangedToken{};
     winrt::event_token m_advancedEffectsEnabledChangedToken{};
     winrt::DisplayInformation::DpiChanged_revoker m_dpiChangedRevoker{};
     winrt::CoreWindow::VisibilityChanged_revoker m_visibilityChangedRevoker;
     winrt::event_token m_windowSizeChangedToken{};
+    winrt::event_token m_windowActivatedToken{};
+    winrt::CompositionPropertySet m_windowActivationProperties{ nullptr };   // "Weight" is 1 while the window is active, 0 otherwise
+    winrt::ExpressionAnimation m_windowActivationWeightExpression{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_windowActivatedAnimation{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_windowDeactivatedAnimation{ nullptr };
     winrt::CompositionCapabilities m_compositionCapabilities{ nullptr };
     winrt::IUISettings4 m_uiSettings{ nullptr };
     winrt::CoreDispatcher m_dispatcher{ nullptr };
-    winrt::CompositionSurfaceBrush m_noiseBrush{ nullptr };
-    winrt::LoadedImageSurface m_noiseSurface{ nullptr };
+    winrt::CompositionSurfaceBrush m_noiseBrush{ nullptr }; // Noise brush for the current DPI scale, owned by the compositor cache
 
     // Cache these objects for the view as they are expensive to query via GetForCurrentView() calls.
     winrt::ViewManagement::ApplicationView m_applicationView{ nullptr };
@@ -277,5 +402,6 @@ private:
     // If we retry many more times but are not successful, something else is wrong - give up and log an assert in that case.
     static const unsigned int sc_maxFailedToAttachLightsCount = 100;
     unsigned int m_failedToAttachLightsCount{0};
+    int m_attachLightsPassCount{};
 };
 #endif
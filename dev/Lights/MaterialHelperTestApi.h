@@ -15,4 +15,19 @@ public:
     static void SimulateDisabledByPolicy(bool value);
     static bool IgnoreAreEffectsFast();
     static void IgnoreAreEffectsFast(bool value);
+    static bool ShareAcrylicCompositionBrushes();
+    static void ShareAcrylicCompositionBrushes(bool value);
+    static bool RecycleRevealHoverLights();
+    static void RecycleRevealHoverLights(bool value);
+    static int AcrylicEffectFactoryCacheHits();
+    static int AcrylicEffectFactoryCacheMisses();
+    static void ResetAcrylicEffectFactoryCacheCounters();
+    static int AttachLightsPassCount();
+    static winrt::MaterialQuality RequestedMaterialQuality();
+    static void RequestedMaterialQuality(winrt::MaterialQuality value);
+    static bool ReduceMaterialQualityOnBattery();
+    static void ReduceMaterialQualityOnBattery(bool value);
+    static bool SuspendMaterialsWhileHidden();
+    static void SuspendMaterialsWhileHidden(bool value);
+    static winrt::MaterialQuality EffectiveMaterialQuality();
 };
\ No newline at end of file
@@ -25,3 +25,106 @@ void MaterialHelperTestApi::SimulateDisabledByPolicy(bool value)
 {
     MaterialHelper::SimulateDisabledByPolicy(value);
 }
+
+bool MaterialHelperTestApi::ShareAcrylicCompositionBrushes()
+{
+    return MaterialHelper::ShareAcrylicCompositionBrushes();
+}
+
+void MaterialHelperTestApi::ShareAcrylicCompositionBrushes(bool value)
+{
+    MaterialHelper::ShareAcrylicCompositionBrushes(value);
+}
+
+bool MaterialHelperTestApi::RecycleRevealHoverLights()
+{
+    return MaterialHelper::RecycleRevealHoverLights();
+}
+
+void MaterialHelperTestApi::RecycleRevealHoverLights(bool value)
+{
+    MaterialHelper::RecycleRevealHoverLights(value);
+}
+
+int MaterialHelperTestApi::AcrylicEffectFactoryCacheHits()
+{
+    return MaterialHelper::AcrylicEffectFactoryCacheHits();
+}
+
+int MaterialHelperTestApi::AcrylicEffectFactoryCacheMisses()
+{
+    return MaterialHelper::AcrylicEffectFactoryCacheMisses();
+}
+
+void MaterialHelperTestApi::ResetAcrylicEffectFactoryCacheCounters()
+{
+    MaterialHelper::ResetAcrylicEffectFactoryCacheCounters();
+}
+
+int MaterialHelperTestApi::AttachLightsPassCount()
+{
+#if BUILD_WINDOWS
+    // Lights are attached synchronously, see RevealBrush::AttachLights.
+    return 0;
+#else
+    return MaterialHelper::AttachLightsPassCount();
+#endif
+}
+
+winrt::MaterialQuality MaterialHelperTestApi::RequestedMaterialQuality()
+{
+#if BUILD_WINDOWS
+    return winrt::MaterialQuality::Full;
+#else
+    return static_cast<winrt::MaterialQuality>(MaterialHelper::RequestedMaterialQuality());
+#endif
+}
+
+void MaterialHelperTestApi::RequestedMaterialQuality(winrt::MaterialQuality value)
+{
+    // Quality tiers aren't supported on WUXC, where fallback policy is owned by MaterialProperties.
+#ifndef BUILD_WINDOWS
+    MaterialHelper::RequestedMaterialQuality(static_cast<MaterialHelper::MaterialQuality>(value));
+#endif
+}
+
+bool MaterialHelperTestApi::ReduceMaterialQualityOnBattery()
+{
+#if BUILD_WINDOWS
+    return false;
+#else
+    return MaterialHelper::ReduceMaterialQualityOnBattery();
+#endif
+}
+
+void MaterialHelperTestApi::ReduceMaterialQualityOnBattery(bool value)
+{
+#ifndef BUILD_WINDOWS
+    MaterialHelper::ReduceMaterialQualityOnBattery(value);
+#endif
+}
+
+bool MaterialHelperTestApi::SuspendMaterialsWhileHidden()
+{
+#if BUILD_WINDOWS
+    return false;
+#else
+    return MaterialHelper::SuspendMaterialsWhileHidden();
+#endif
+}
+
+void MaterialHelperTestApi::SuspendMaterialsWhileHidden(bool value)
+{
+#ifndef BUILD_WINDOWS
+    MaterialHelper::SuspendMaterialsWhileHidden(value);
+#endif
+}
+
+winrt::MaterialQuality MaterialHelperTestApi::EffectiveMaterialQuality()
+{
+#if BUILD_WINDOWS
+    return winrt::MaterialQuality::Full;
+#else
+    return static_cast<winrt::MaterialQuality>(MaterialHelper::EffectiveMaterialQuality());
+#endif
+}
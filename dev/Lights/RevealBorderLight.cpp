@@ -265,7 +265,9 @@ void RevealBorderLight::OnAdditionalMaterialPolicyChanged(const com_ptr<Material
 #else
 void RevealBorderLight::OnMaterialPolicyStatusChanged(const com_ptr<MaterialHelperBase>& sender, bool isDisabledByMaterialPolicy)
 {
-    MaterialHelper::LightPolicyChangedHelper<RevealBorderLight>(this, isDisabledByMaterialPolicy);
+    // Border light is turned off at Reduced quality, hover and ambient lights stay on.
+    const bool isReducedQuality = MaterialHelper::EffectiveMaterialQuality() == MaterialHelper::MaterialQuality::Reduced;
+    MaterialHelper::LightPolicyChangedHelper<RevealBorderLight>(this, isDisabledByMaterialPolicy || isReducedQuality);
 }
 #endif
 
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "common.h"
 #include "RevealHoverLight.h"
+#include "RevealBrush.h"
 #include "IsTargetDPHelper.h"
 #include "SpotLightStateHelper.h"
 
@@ -248,6 +249,17 @@ void RevealHoverLight::OnDisconnected(winrt::UIElement const& /*oldElement*/)
 
 }
 
+void RevealHoverLight::PrepareForReuse()
+{
+    MUX_ASSERT(!m_targetElement);
+
+    m_currentLightState = LightStates::Off;
+    m_isPressed = false;
+    m_isPointerOver = false;
+    m_shouldLightBeOn = false;
+    m_centerLight = true;
+}
+
 void RevealHoverLight::EnsureCompositionResources()
 {
     if (!m_compositionSpotLight)
@@ -582,6 +594,14 @@ void RevealHoverLight::GotoLightStateHelper(LightStates target, bool skipAnimati
     case LightStates::Off:
         {
             SwitchLight(false);
+
+            if (MaterialHelper::RecycleRevealHoverLights())
+            {
+                if (auto element = m_targetElement.get())
+                {
+                    RevealBrush::OnHoverLightTurnedOff(element);
+                }
+            }
         }
         break;
 
@@ -38,6 +38,10 @@ public:
 
     void SetIsPressLight(bool isPressLight) { m_isPressLight = isPressLight; }
     bool GetIsPressLight() { return m_isPressLight; }
+    bool IsOff() { return m_currentLightState == LightStates::Off; }
+
+    // Forgets about the previous element's pointer state before the light gets attached to another element.
+    void PrepareForReuse();
     winrt::SpotLight GetLight() { return m_compositionSpotLight; } // For test APIs
 
 public:
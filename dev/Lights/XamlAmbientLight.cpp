@@ -13,6 +13,15 @@
 
 const winrt::Color XamlAmbientLight::sc_defaultColor{ 255, 255, 255, 255 };
 
+struct SharedAmbientLightEntry
+{
+    bool m_isCurrentWindow{};
+    winrt::weak_ref<winrt::IInspectable> m_root{};
+    winrt::weak_ref<winrt::XamlAmbientLight> m_light{};
+};
+
+static thread_local std::vector<SharedAmbientLightEntry> s_sharedAmbientLights;
+
 XamlAmbientLight::XamlAmbientLight()
 {
     m_ambientLightColor = sc_defaultColor;
@@ -24,6 +33,39 @@ winrt::hstring& XamlAmbientLight::GetLightIdStatic()
     return s_XamlAmbientLightId;
 }
 
+winrt::XamlAmbientLight XamlAmbientLight::GetOrCreateSharedLight(const winrt::IInspectable& root)
+{
+    s_sharedAmbientLights.erase(
+        std::remove_if(s_sharedAmbientLights.begin(), s_sharedAmbientLights.end(), [](const auto& entry)
+        {
+            return !entry.m_light.get() || (!entry.m_isCurrentWindow && !entry.m_root.get());
+        }),
+        s_sharedAmbientLights.end());
+
+    auto entry = std::find_if(s_sharedAmbientLights.begin(), s_sharedAmbientLights.end(), [&root](const auto& candidate)
+    {
+        return root ? candidate.m_root.get() == root : candidate.m_isCurrentWindow;
+    });
+
+    if (entry != s_sharedAmbientLights.end())
+    {
+        if (auto light = entry->m_light.get())
+        {
+            return light;
+        }
+    }
+
+    winrt::XamlAmbientLight light = *winrt::make_self<XamlAmbientLight>();
+    auto& newEntry = s_sharedAmbientLights.emplace_back();
+    newEntry.m_isCurrentWindow = !root;
+    if (root)
+    {
+        newEntry.m_root = winrt::make_weak(root);
+    }
+    newEntry.m_light = winrt::make_weak(light);
+    return light;
+}
+
 winrt::hstring XamlAmbientLight::GetId()
 {
     return GetLightIdStatic();
@@ -18,6 +18,10 @@ public:
 
     static winrt::hstring& GetLightIdStatic();
 
+    // Returns the ambient light shared by every attachment point under 'root' (a XamlRoot or island), creating it
+    // on first use. A null root stands for the current window. The light lives as long as some Lights collection holds it.
+    static winrt::XamlAmbientLight GetOrCreateSharedLight(const winrt::IInspectable& root);
+
     // IXamlLightOverrides
     winrt::hstring GetId();
     void OnConnected(winrt::UIElement const& newElement);
@@ -10,6 +10,7 @@
 #include "SharedHelpers.h"
 #include "Vector.h"
 #include "RuntimeProfiler.h"
+#include "SampledPerfTrace.h"
 #if BUILD_WINDOWS
 #include <FeatureStaging-ShellViewManagement.h>
 #endif
@@ -156,12 +157,7 @@ void AcrylicBrush::OnConnected()
         m_noiseChangedToken = MaterialHelper::NoiseChanged([this](auto sender) { OnNoiseChanged(sender); });
     }
 
-    auto currentWindow = winrt::Window::Current();
-    m_currentWindow.set(currentWindow);
-    m_windowActivatedToken = currentWindow.Activated({ this, &AcrylicBrush::OnCurrentWindowActivated });
-
     m_windowSizeChangedToken = MaterialHelper::WindowSizeChanged([this](auto sender, auto args) { OnWindowSizeChanged(sender, args); });
-    UpdateWindowActivationStatus();
 
     m_isConnected = true;
     UpdateAcrylicStatus();
@@ -178,7 +174,15 @@ void AcrylicBrush::OnDisconnected()
     
     if (m_brush)
     {
-        m_brush.Close();
+        // A shared brush is closed by MaterialHelper once its last user releases it.
+        if (m_isUsingSharedBrush)
+        {
+            ReleaseSharedBrush();
+        }
+        else
+        {
+            m_brush.Close();
+        }
         m_brush = nullptr;
         CompositionBrush(nullptr);
     }
@@ -190,12 +194,6 @@ void AcrylicBrush::OnDisconnected()
         m_noiseBrush = nullptr;
     }
 
-    if (auto currentWindow = m_currentWindow.get())
-    {
-        currentWindow.Activated(m_windowActivatedToken);
-        m_currentWindow.set(nullptr);
-    }
-
     MaterialHelper::PolicyChanged(m_materialPolicyChangedToken);
     m_materialPolicyChangedToken.value = 0;
 
@@ -265,7 +263,7 @@ void AcrylicBrush::OnFallbackColorChanged(const winrt::DependencyObject& /*sende
     // If it changes dynamically and we're using the fallback brush, make sure we update it now.
     if (m_brush)
     {
-        if (m_isUsingAcrylicBrush && !m_isWaitingForFallbackAnimationComplete)
+        if (m_isUsingAcrylicBrush && !m_isWaitingForFallbackAnimationComplete && !m_isBoundToWindowActivation)
         {
             // It's AcrylicBrush but not crossfading effect, then do nothing because effect doesn't includes FallbackColor.Color 
         }
@@ -298,7 +296,13 @@ void AcrylicBrush::OnPropertyChanged(const winrt::DependencyPropertyChangedEvent
             UpdateAcrylicBrush();
         }
 
-        if (m_brush && (m_isUsingAcrylicBrush || m_isWaitingForFallbackAnimationComplete))
+        if (m_isUsingSharedBrush)
+        {
+            // Animating the shared brush would also change every other AcrylicBrush using it,
+            // so switch to the shared brush matching the new tint instead.
+            CreateAcrylicBrush(false /* useCrossFadeEffect */);
+        }
+        else if (m_brush && (m_isUsingAcrylicBrush || m_isWaitingForFallbackAnimationComplete))
         {
             if (property != s_TintLuminosityOpacityProperty)
             {
@@ -452,7 +456,7 @@ void AcrylicBrush::EnsureNoiseBrush()
     if (m_noiseChanged || !m_dpiScaledNoiseBrush)
     {
         int resScaleInt = MaterialHelper::BrushTemplates<AcrylicBrush>::GetEffectiveDpi(this);
-        m_dpiScaledNoiseBrush = MaterialHelper::GetNoiseBrush(resScaleInt);
+        m_dpiScaledNoiseBrush = MaterialHelper::GetNoiseBrush(winrt::Window::Current().Compositor(), resScaleInt);
     }
     m_noiseChanged = false;
 #else
@@ -505,51 +509,6 @@ void AcrylicBrush::OnWindowSizeChanged(const com_ptr<MaterialHelperBase>& sender
     m_isFullScreenOrTabletMode = isFullScreenOrTabletMode;
     UpdateAcrylicBrush();
 }
-
-void AcrylicBrush::OnCurrentWindowActivated(const winrt::IInspectable& sender, const winrt::WindowActivatedEventArgs& args)
-{
-    bool isActivated = false;
-
-    if (SharedHelpers::IsCoreWindowActivationModeAvailable())
-    {
-        winrt::CoreWindow coreWindow = sender.try_as<winrt::Window>().CoreWindow();
-        isActivated = IsWindowActive(coreWindow);
-    }
-    else
-    {
-        isActivated = args.WindowActivationState() != winrt::CoreWindowActivationState::Deactivated;
-    }
-
-    if (m_isActivated != isActivated)
-    {
-        m_isActivated = isActivated;
-        UpdateAcrylicBrush();
-    }
-}
-
-bool AcrylicBrush::IsWindowActive(const winrt::CoreWindow& coreWindow)
-{
-    winrt::CoreWindowActivationMode activationMode = coreWindow.ActivationMode();
-
-    return activationMode == winrt::CoreWindowActivationMode::ActivatedNotForeground ||
-           activationMode == winrt::CoreWindowActivationMode::ActivatedInForeground;
-}
-
-void AcrylicBrush::UpdateWindowActivationStatus()
-{
-    // With the new RS3 API CoreWindow.ActivationMode we can set the right activation in case brush is connected while inactive (Bug 11657917).
-    // Unfortunately we can't fix this for RS2 or older RS3 builds. 
-    if (SharedHelpers::IsCoreWindowActivationModeAvailable())
-    {
-        auto coreWindow = winrt::Window::Current().CoreWindow();
-        MUX_ASSERT_MSG(coreWindow, "Expecting to have a CoreWindow instance when AcrylicBrush is connected.");
-
-        if (coreWindow)
-        {
-            m_isActivated = IsWindowActive(coreWindow);
-        }
-    }
-}
 #endif
 
 void AcrylicBrush::OnNoiseChanged(const com_ptr<MaterialHelperBase>& sender)
@@ -577,10 +536,11 @@ winrt::CompositionEffectBrush AcrylicBrush::CreateAcrylicBrushWorker(
     winrt::Color initialLuminosityColor,
     winrt::Color initialFallbackColor,
     bool shouldBrushBeOpaque,
-    bool useCache)
+    bool useCache,
+    bool useReducedQuality)
 {
     auto effectFactory = GetOrCreateAcrylicBrushCompositionEffectFactory(
-        compositor, shouldBrushBeOpaque, useWindowAcrylic, useCrossFadeEffect, 
+        compositor, shouldBrushBeOpaque, useWindowAcrylic, useCrossFadeEffect, useReducedQuality,
         initialTintColor, initialLuminosityColor, initialFallbackColor, useCache);
 
     // Create the Comp effect Brush
@@ -784,6 +744,7 @@ winrt::CompositionEffectFactory AcrylicBrush::CreateAcrylicBrushCompositionEffec
     bool shouldBrushBeOpaque,
     bool useWindowAcrylic,
     bool useCrossFadeEffect,
+    bool useReducedQuality,
     winrt::Color initialTintColor,
     winrt::Color initialLuminosityColor,
     winrt::Color initialFallbackColor)
@@ -824,7 +785,7 @@ winrt::CompositionEffectFactory AcrylicBrush::CreateAcrylicBrushCompositionEffec
             auto gaussianBlurEffect = winrt::make_self<Microsoft::UI::Composition::Effects::GaussianBlurEffect>();
             gaussianBlurEffect->Name(L"Blur");
             gaussianBlurEffect->BorderMode(winrt::EffectBorderMode::Hard);
-            gaussianBlurEffect->BlurAmount(sc_blurRadius);
+            gaussianBlurEffect->BlurAmount(useReducedQuality ? sc_reducedQualityBlurRadius : sc_blurRadius);
             gaussianBlurEffect->Source(backdropEffectSourceParameter);
             blurredSource = *gaussianBlurEffect;
         }
@@ -834,24 +795,31 @@ winrt::CompositionEffectFactory AcrylicBrush::CreateAcrylicBrushCompositionEffec
             CombineNoiseWithTintEffect_Legacy(blurredSource, *tintColorEffect);
     }
 
-    // Create noise with alpha and wrap:
-    // Noise image BorderEffect (infinitely tiles noise image)
-    auto noiseBorderEffect = winrt::make_self<Microsoft::UI::Composition::Effects::BorderEffect>();
-    noiseBorderEffect->ExtendX(winrt::CanvasEdgeBehavior::Wrap);
-    noiseBorderEffect->ExtendY(winrt::CanvasEdgeBehavior::Wrap);
-    winrt::CompositionEffectSourceParameter noiseEffectSourceParameter{ L"Noise" };
-    noiseBorderEffect->Source(noiseEffectSourceParameter);
-    // OpacityEffect applied to wrapped noise
-    auto noiseOpacityEffect = winrt::make_self<Microsoft::UI::Composition::Effects::OpacityEffect>();
-    noiseOpacityEffect->Name(L"NoiseOpacity");
-    noiseOpacityEffect->Opacity(sc_noiseOpacity);
-    noiseOpacityEffect->Source(*noiseBorderEffect);
-
-    // Blend noise on top of tint
-    auto blendEffectOuter = winrt::make_self<Microsoft::UI::Composition::Effects::CompositeStepEffect>();
-    blendEffectOuter->Mode(winrt::CanvasComposite::SourceOver);
-    blendEffectOuter->Destination(tintOutput);
-    blendEffectOuter->Source(*noiseOpacityEffect);
+    // Reduced quality leaves out the noise layer.
+    winrt::IGraphicsEffect acrylicOutput = tintOutput;
+    if (!useReducedQuality)
+    {
+        // Create noise with alpha and wrap:
+        // Noise image BorderEffect (infinitely tiles noise image)
+        auto noiseBorderEffect = winrt::make_self<Microsoft::UI::Composition::Effects::BorderEffect>();
+        noiseBorderEffect->ExtendX(winrt::CanvasEdgeBehavior::Wrap);
+        noiseBorderEffect->ExtendY(winrt::CanvasEdgeBehavior::Wrap);
+        winrt::CompositionEffectSourceParameter noiseEffectSourceParameter{ L"Noise" };
+        noiseBorderEffect->Source(noiseEffectSourceParameter);
+        // OpacityEffect applied to wrapped noise
+        auto noiseOpacityEffect = winrt::make_self<Microsoft::UI::Composition::Effects::OpacityEffect>();
+        noiseOpacityEffect->Name(L"NoiseOpacity");
+        noiseOpacityEffect->Opacity(sc_noiseOpacity);
+        noiseOpacityEffect->Source(*noiseBorderEffect);
+
+        // Blend noise on top of tint
+        auto blendEffectOuter = winrt::make_self<Microsoft::UI::Composition::Effects::CompositeStepEffect>();
+        blendEffectOuter->Mode(winrt::CanvasComposite::SourceOver);
+        blendEffectOuter->Destination(tintOutput);
+        blendEffectOuter->Source(*noiseOpacityEffect);
+
+        acrylicOutput = *blendEffectOuter;
+    }
 
     if (useCrossFadeEffect)
     {
@@ -864,7 +832,7 @@ winrt::CompositionEffectFactory AcrylicBrush::CreateAcrylicBrushCompositionEffec
         auto fadeInOutEffect = winrt::make_self<Microsoft::UI::Composition::Effects::CrossFadeEffect>();
         fadeInOutEffect->Name(L"FadeInOut");
         fadeInOutEffect->Source1(*fallbackColorEffect);
-        fadeInOutEffect->Source2(*blendEffectOuter);
+        fadeInOutEffect->Source2(acrylicOutput);
         fadeInOutEffect->Weight(1.0f);
 
         animatedProperties.push_back(winrt::hstring{ FallbackColorColor });
@@ -873,7 +841,7 @@ winrt::CompositionEffectFactory AcrylicBrush::CreateAcrylicBrushCompositionEffec
     }
     else
     {
-        effectFactory = compositor.CreateEffectFactory(*blendEffectOuter, animatedProperties);
+        effectFactory = compositor.CreateEffectFactory(acrylicOutput, animatedProperties);
     }
 
     return effectFactory;
@@ -884,6 +852,7 @@ winrt::CompositionEffectFactory AcrylicBrush::GetOrCreateAcrylicBrushComposition
     bool shouldBrushBeOpaque, 
     bool useWindowAcrylic,
     bool useCrossFadeEffect,
+    bool useReducedQuality,
     winrt::Color initialTintColor,
     winrt::Color initialLuminosityColor,
     winrt::Color initialFallbackColor,
@@ -894,80 +863,200 @@ winrt::CompositionEffectFactory AcrylicBrush::GetOrCreateAcrylicBrushComposition
         shouldBrushBeOpaque,
         useWindowAcrylic,
         useCrossFadeEffect,
+        !shouldBrushBeOpaque && SharedHelpers::Is19H1OrHigher(), // useLuminosityEffect, see CreateAcrylicBrushCompositionEffectFactory
+        useReducedQuality,
         useCache,
         [&compositor, shouldBrushBeOpaque, useWindowAcrylic,
-        useCrossFadeEffect, initialTintColor, initialLuminosityColor,
+        useCrossFadeEffect, useReducedQuality, initialTintColor, initialLuminosityColor,
         initialFallbackColor]() { 
             return CreateAcrylicBrushCompositionEffectFactory(
                 compositor,
                 shouldBrushBeOpaque,
                 useWindowAcrylic,
                 useCrossFadeEffect,
+                useReducedQuality,
                 initialTintColor,
                 initialLuminosityColor,
                 initialFallbackColor); }
         );
 }
 
-void AcrylicBrush::CreateAcrylicBrush(bool useCrossFadeEffect, bool forceCreateAcrylicBrush)
+winrt::CompositionEffectBrush AcrylicBrush::CreateAcrylicEffectBrush(
+    const winrt::Compositor& compositor,
+    bool useCrossFadeEffect,
+    winrt::Color tintColor,
+    winrt::Color luminosityColor,
+    winrt::Color fallbackColor)
 {
-    // Forget about any pending animation state when recreating the brush.
-    CancelFallbackAnimationCompleteWait();
+    auto acrylicBrush = CreateAcrylicBrushWorker(
+        compositor,
+        m_isUsingWindowAcrylic,
+        useCrossFadeEffect,
+        tintColor,
+        luminosityColor,
+        fallbackColor,
+        m_isUsingOpaqueBrush,
+        true /* useCache */,
+        m_isUsingReducedQuality);
+
+    // Set noise image source
+    if (!m_isUsingReducedQuality)
+    {
+        acrylicBrush.SetSourceParameter(L"Noise", GetNoiseBrush());
+    }
 
-    winrt::Compositor compositor = winrt::Window::Current().Compositor();
+    acrylicBrush.Properties().InsertColor(TintColorColor, tintColor);
 
-    auto fallbackColor = FallbackColor();
-    //if forceCreateAcrylicBrush=true, m_isUsingAcrylicBrush is ignored.
-    if (forceCreateAcrylicBrush || m_isUsingAcrylicBrush )
+    if (SharedHelpers::Is19H1OrHigher() && !m_isUsingOpaqueBrush)
     {
-        EnsureNoiseBrush();
+        acrylicBrush.Properties().InsertColor(LuminosityColorColor, luminosityColor);
+    }
 
-        winrt::Color tintColor = GetEffectiveTintColor();
-        winrt::Color luminosityColor = GetEffectiveLuminosityColor();
+    if (useCrossFadeEffect)
+    {
+        acrylicBrush.Properties().InsertColor(FallbackColorColor, fallbackColor);
+    }
 
-        m_isUsingOpaqueBrush = tintColor.A == 255;
+    return acrylicBrush;
+}
 
-        // use cache for AcrylicBrushEffectFactory
-        auto acrylicBrush = CreateAcrylicBrushWorker(
+winrt::CompositionBrush AcrylicBrush::GetNoiseBrush()
+{
+#if BUILD_WINDOWS
+    MUX_ASSERT(m_dpiScaledNoiseBrush);
+    return m_dpiScaledNoiseBrush;
+#else
+    MUX_ASSERT(m_noiseBrush);
+    return m_noiseBrush;
+#endif
+}
+
+void AcrylicBrush::ReleaseSharedBrush()
+{
+    if (m_isUsingSharedBrush)
+    {
+        MaterialHelper::ReleaseSharedAcrylicBrush(m_brush);
+        m_isUsingSharedBrush = false;
+    }
+}
+
+/* static */
+void AcrylicBrush::WarmUpCompositionResources(const winrt::Compositor& compositor)
+{
+    // Only the steady state translucent brush is prepared, opaque tints and crossfading brushes are uncommon
+    // or not needed before the first frame. The colors are animatable properties and don't affect caching.
+    const winrt::Color luminosityColor = GetLuminosityColor(sc_defaultTintColor, nullptr);
+    for (bool useWindowAcrylic : { false, true })
+    {
+#if BUILD_WINDOWS
+        const bool useCrossFadeEffect = false;
+#else
+        // Steady state window acrylic keeps its crossfade to follow window activation.
+        const bool useCrossFadeEffect = useWindowAcrylic;
+#endif
+
+        GetOrCreateAcrylicBrushCompositionEffectFactory(
             compositor,
-            m_isUsingWindowAcrylic,
+            false /* shouldBrushBeOpaque */,
+            useWindowAcrylic,
             useCrossFadeEffect,
-            tintColor,
+            false /* useReducedQuality */,
+            sc_defaultTintColor,
             luminosityColor,
-            fallbackColor,
-            m_isUsingOpaqueBrush, 
+            winrt::Color{},
             true /* useCache */);
+    }
 
+    // Creating the noise brush starts decoding the noise surface.
+#if BUILD_WINDOWS
+    int resScaleInt = 100;
+    try
+    {
+        resScaleInt = static_cast<int>(winrt::DisplayInformation::GetForCurrentView().ResolutionScale());
+    }
+    catch (winrt::hresult_error)
+    {
+        // No CoreWindow on this thread, brushes will pick their own noise when they connect.
+    }
+    MaterialHelper::GetNoiseBrush(compositor, resScaleInt);
+#else
+    MaterialHelper::GetNoiseBrush();
+#endif
+}
+
+void AcrylicBrush::CreateAcrylicBrush(bool useCrossFadeEffect, bool forceCreateAcrylicBrush)
+{
+    SAMPLED_PERF_TRACE_SCOPE("AcrylicBrush.CreateBrush");
+
+    // Forget about any pending animation state when recreating the brush.
+    CancelFallbackAnimationCompleteWait();
+
+    winrt::Compositor compositor = winrt::Window::Current().Compositor();
+
+    winrt::CompositionBrush newBrush{ nullptr };
+    bool isUsingSharedBrush = false;
+
+    auto fallbackColor = FallbackColor();
 
-        // Set noise image source
 #if BUILD_WINDOWS
-        MUX_ASSERT(m_dpiScaledNoiseBrush);
-        acrylicBrush.SetSourceParameter(L"Noise", m_dpiScaledNoiseBrush);
+    const bool bindToWindowActivation = false;
 #else
-        MUX_ASSERT(m_noiseBrush);
-        acrylicBrush.SetSourceParameter(L"Noise", m_noiseBrush);
+    // Steady state window acrylic keeps the crossfade so that it can follow window activation.
+    const bool bindToWindowActivation = !useCrossFadeEffect && m_isUsingWindowAcrylic && m_isUsingAcrylicBrush;
 #endif
 
-        acrylicBrush.Properties().InsertColor(TintColorColor, tintColor);
+    //if forceCreateAcrylicBrush=true, m_isUsingAcrylicBrush is ignored.
+    if (forceCreateAcrylicBrush || m_isUsingAcrylicBrush )
+    {
+        EnsureNoiseBrush();
+
+        winrt::Color tintColor = GetEffectiveTintColor();
+        winrt::Color luminosityColor = GetEffectiveLuminosityColor();
+
+        m_isUsingOpaqueBrush = tintColor.A == 255;
 
-        if (SharedHelpers::Is19H1OrHigher() && !m_isUsingOpaqueBrush)
+        // Crossfading brushes get their own animations, so only the steady state acrylic brush can be shared.
+        // Brushes bound to window activation carry their own fallback color, so they aren't shared either.
+        if (!useCrossFadeEffect && !bindToWindowActivation && MaterialHelper::ShareAcrylicCompositionBrushes())
         {
-            acrylicBrush.Properties().InsertColor(LuminosityColorColor, luminosityColor);
+            newBrush = MaterialHelper::AcquireSharedAcrylicBrush(
+                compositor,
+                m_isUsingOpaqueBrush,
+                m_isUsingWindowAcrylic,
+                m_isUsingReducedQuality,
+                tintColor,
+                luminosityColor,
+                GetNoiseBrush(),
+                [this, &compositor, tintColor, luminosityColor, fallbackColor]()
+                {
+                    return CreateAcrylicEffectBrush(compositor, false /* useCrossFadeEffect */, tintColor, luminosityColor, fallbackColor);
+                });
+            isUsingSharedBrush = true;
         }
-
-        if (useCrossFadeEffect)
+        else
         {
-            acrylicBrush.Properties().InsertColor(FallbackColorColor, fallbackColor);
+            newBrush = CreateAcrylicEffectBrush(compositor, useCrossFadeEffect || bindToWindowActivation, tintColor, luminosityColor, fallbackColor);
         }
 
-        // Update the AcrylicBrush
-        m_brush = acrylicBrush;
+#ifndef BUILD_WINDOWS
+        if (bindToWindowActivation)
+        {
+            MaterialHelper::BindToWindowActivation(newBrush);
+        }
+#endif
     }
     else
     {
-        m_brush = compositor.CreateColorBrush(fallbackColor);
+        newBrush = compositor.CreateColorBrush(fallbackColor);
     }
 
+    // Release the previous shared brush only after acquiring the new one, so that reacquiring
+    // the same parameters doesn't close and recreate the shared brush.
+    ReleaseSharedBrush();
+    m_brush = newBrush;
+    m_isUsingSharedBrush = isUsingSharedBrush;
+    m_isBoundToWindowActivation = bindToWindowActivation;
+
     CompositionBrush(m_brush);
 #if BUILD_WINDOWS
     if (false /*xamlroot*/)
@@ -1004,6 +1093,19 @@ void AcrylicBrush::UpdateAcrylicBrush()
         bool isUsingWindowAcrylic = BackgroundSource() == winrt::AcrylicBackgroundSource::HostBackdrop;
         bool shouldUseOpaqueBrush = GetEffectiveTintColor().A == 255;
 
+#if BUILD_WINDOWS
+        bool shouldUseReducedQuality = false;
+        bool isSuspendedWhileHiddenChanged = false;
+#else
+        bool shouldUseReducedQuality = MaterialHelper::EffectiveMaterialQuality() == MaterialHelper::MaterialQuality::Reduced;
+
+        // Suspending for a hidden window and resuming from it happen out of view, so swap brushes without the crossfade.
+        // On resume the effect brush comes back from the effect factory cache.
+        bool isSuspendedWhileHidden = MaterialHelper::IsSuspendedWhileHidden();
+        bool isSuspendedWhileHiddenChanged = m_isSuspendedWhileHidden != isSuspendedWhileHidden;
+        m_isSuspendedWhileHidden = isSuspendedWhileHidden;
+#endif
+
 #if BUILD_WINDOWS
         // TODO_FluentIslands: For now the IgnoreAreEffectsFast test hook will override all MaterialProperties policy 
         //                     and enable fluent effects, since MP aggregates all policy compoenents and does not allow 
@@ -1014,7 +1116,7 @@ void AcrylicBrush::UpdateAcrylicBrush()
         if (isDisabledByMaterialPropertiesPolicy || alwaysUseFallback || m_isInterIsland)
 #else
         if (m_isDisabledByMaterialPolicy ||
-            (isUsingWindowAcrylic && (m_isFullScreenOrTabletMode || !m_isActivated)) ||
+            (isUsingWindowAcrylic && m_isFullScreenOrTabletMode) ||
              alwaysUseFallback)
 #endif
         {
@@ -1025,10 +1127,13 @@ void AcrylicBrush::UpdateAcrylicBrush()
         if (!m_brush ||                                         // Create brush for the first time
             m_noiseChanged ||                                   // Recreate brush with new noise
             (m_isUsingOpaqueBrush != shouldUseOpaqueBrush) ||   // Recreate the brush with (or without) the opaque tint optimization
-            (m_isUsingWindowAcrylic != isUsingWindowAcrylic))   // Recreate brush with new type of transparency (Backdrop vs HostBackdrop)
+            (m_isUsingWindowAcrylic != isUsingWindowAcrylic) || // Recreate brush with new type of transparency (Backdrop vs HostBackdrop)
+            (m_isUsingAcrylicBrush && isUsingAcrylicBrush && (m_isUsingReducedQuality != shouldUseReducedQuality)) || // Recreate brush at new quality tier
+            (isSuspendedWhileHiddenChanged && (m_isUsingAcrylicBrush != isUsingAcrylicBrush))) // Window got hidden or shown again
         {
             m_isUsingWindowAcrylic = isUsingWindowAcrylic;
             m_isUsingAcrylicBrush = isUsingAcrylicBrush;
+            m_isUsingReducedQuality = shouldUseReducedQuality;
 
             CreateAcrylicBrush(false /* useCrossFadeEffect */);
         }
@@ -1046,6 +1151,12 @@ void AcrylicBrush::UpdateAcrylicBrush()
                     CancelFallbackAnimationCompleteWait();
                 }
 
+                // Fade acrylic in at the current quality tier. Fading out keeps the tier the brush already has.
+                if (isUsingAcrylicBrush)
+                {
+                    m_isUsingReducedQuality = shouldUseReducedQuality;
+                }
+
                 // After cancel animation, AcrylicBrush doesn't have crossfading effects
                 // So we make a new AcrylicBrush with crosssfading effects anyway.
                 CreateAcrylicBrush(true /* useCrossFadeEffect */, true /* forceCreateAcrylicBrush */);
@@ -1057,15 +1168,22 @@ void AcrylicBrush::UpdateAcrylicBrush()
                 float acrylicStart = 0.0f;
                 float acrylicEnd = 0.0f;
 
+#if BUILD_WINDOWS
+                const float acrylicWeight = 1.0f;
+#else
+                // Window acrylic of an inactive window already shows the fallback color, see MaterialHelper::BindToWindowActivation.
+                const float acrylicWeight = (m_isUsingWindowAcrylic && !MaterialHelper::IsWindowActivated()) ? 0.0f : 1.0f;
+#endif
+
                 if (m_isUsingAcrylicBrush)
                 {
                     // Fallback -> Acrylic Transition. Create the Acrlyic Brush and animate it from fallback color to acrylic effect.
-                    acrylicEnd = 1.0f;
+                    acrylicEnd = acrylicWeight;
                 }
                 else
                 {
                     // Acrylic -> Fallback transition. Animate acrylic to the fallback color, then create the fallback brush.
-                    acrylicStart = 1.0f;
+                    acrylicStart = acrylicWeight;
                 }
 
                 CreateAnimation(m_brush,
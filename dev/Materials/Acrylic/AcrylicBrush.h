@@ -68,7 +68,12 @@ public:
         winrt::Color luminosityColor,
         winrt::Color fallbackColor,
         bool shouldBrushBeOpaque,
-        bool useCache = false);
+        bool useCache = true,
+        bool useReducedQuality = false);
+
+    // Creates the effect factories and noise brush the first AcrylicBrush of a window typically needs,
+    // so that they don't have to be created while rendering the first frame.
+    static void WarmUpCompositionResources(const winrt::Compositor& compositor);
 
     void CoerceToZeroOneRange(double& value);
     void CoerceToZeroOneRange_Nullable(winrt::IReference<double> const& value);
@@ -82,6 +87,7 @@ private:
     static constexpr auto FallbackColorColor{ L"FallbackColor.Color"sv };
 
     static constexpr float sc_blurRadius = 30.0f;
+    static constexpr float sc_reducedQualityBlurRadius = 15.0f;
     static constexpr float sc_noiseOpacity = 0.02f;
     static constexpr winrt::Color sc_exclusionColor{ 26, 255, 255, 255 };
     static constexpr float sc_saturation = 1.25f;
@@ -100,6 +106,7 @@ private:
         bool shouldBrushBeOpaque,
         bool useWindowAcrylic,
         bool useCrossFadeEffect,
+        bool useReducedQuality,
         winrt::Color initialTintColor,
         winrt::Color initialLuminosityColor,
         winrt::Color initialFallbackColor);
@@ -109,6 +116,7 @@ private:
         bool shouldBrushBeOpaque,
         bool useWindowAcrylic,
         bool useCrossFadeEffect,
+        bool useReducedQuality,
         winrt::Color initialTintColor,
         winrt::Color initialLuminosityColor,
         winrt::Color initialFallbackColor,
@@ -120,8 +128,16 @@ private:
     void EnsureNoiseBrush();
     void UpdateAcrylicBrush();
 
+    winrt::CompositionEffectBrush CreateAcrylicEffectBrush(
+        const winrt::Compositor& compositor,
+        bool useCrossFadeEffect,
+        winrt::Color tintColor,
+        winrt::Color luminosityColor,
+        winrt::Color fallbackColor);
+    winrt::CompositionBrush GetNoiseBrush();
+    void ReleaseSharedBrush();
+
     // Handle acrylic status changes
-    void OnCurrentWindowActivated(const winrt::IInspectable& sender, const winrt::WindowActivatedEventArgs& args);
     void UpdateAcrylicStatus();
 
     void OnFallbackColorChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
@@ -150,8 +166,6 @@ private:
     void PolicyStatusChangedHelper(bool isDisabledByBackdropPolicy, bool isDisabledByHostBackdropPolicy);
 #else
     void PolicyStatusChangedHelper(bool isDisabledByMaterialPolicy);
-    bool IsWindowActive(const winrt::CoreWindow& coreWindow);
-    void UpdateWindowActivationStatus();
 #endif
 
     bool m_isConnected{};
@@ -160,15 +174,18 @@ private:
     bool m_noiseChanged{};
     bool m_isUsingOpaqueBrush{};
     bool m_isWaitingForFallbackAnimationComplete{};
+    bool m_isUsingSharedBrush{};
+    bool m_isUsingReducedQuality{};
+    bool m_isBoundToWindowActivation{};
 
 #if BUILD_WINDOWS
     bool m_isDisabledByBackdropPolicy{};
     bool m_isDisabledByHostBackdropPolicy{};
     bool m_isInterIsland{};
 #else
-    bool m_isActivated{ true };
     bool m_isFullScreenOrTabletMode{};
     bool m_isDisabledByMaterialPolicy{};
+    bool m_isSuspendedWhileHidden{};
 #endif
 
     winrt::event_token m_fallbackColorChangedToken{};
@@ -188,11 +205,9 @@ private:
     winrt::CompositionIsland m_associatedCompositionIsland { nullptr };
     winrt::event_token m_additionalMaterialPolicyChangedToken{};
 #else
-    winrt::event_token m_windowActivatedToken{};
     winrt::event_token m_materialPolicyChangedToken{};
     winrt::event_token m_windowSizeChangedToken{};
     winrt::event_token m_noiseChangedToken{};
-    tracker_ref<winrt::Window> m_currentWindow{ this };
     winrt::CompositionSurfaceBrush m_noiseBrush{ nullptr };
 #endif
 };
\ No newline at end of file
@@ -62,3 +62,28 @@ winrt::CompositionEffectBrush AcrylicBrushFactory::CreateBackdropAcrylicEffectBr
         initialFallbackColor,
         willTintColorAlwaysBeOpaque);
 }
+
+bool AcrylicBrushFactory::ShareCompositionBrushes()
+{
+    return MaterialHelper::ShareAcrylicCompositionBrushes();
+}
+
+void AcrylicBrushFactory::ShareCompositionBrushes(bool value)
+{
+    MaterialHelper::ShareAcrylicCompositionBrushes(value);
+}
+
+void AcrylicBrushFactory::WarmUpCompositionResources(bool deferUntilIdle)
+{
+    if (deferUntilIdle)
+    {
+        winrt::Window::Current().Dispatcher().RunIdleAsync([](const winrt::IdleDispatchedHandlerArgs&)
+        {
+            AcrylicBrush::WarmUpCompositionResources(winrt::Window::Current().Compositor());
+        });
+    }
+    else
+    {
+        AcrylicBrush::WarmUpCompositionResources(winrt::Window::Current().Compositor());
+    }
+}
@@ -6,7 +6,7 @@
 #include "AcrylicBrush.h"
 
 class AcrylicBrushFactory
-    : public winrt::factory_implementation::AcrylicBrushT<AcrylicBrushFactory, AcrylicBrush, winrt::IAcrylicBrushStaticsPrivate>
+    : public winrt::factory_implementation::AcrylicBrushT<AcrylicBrushFactory, AcrylicBrush, winrt::IAcrylicBrushStaticsPrivate, winrt::IAcrylicBrushStaticsPrivate2>
 {
 public:
     AcrylicBrushFactory();
@@ -23,6 +23,11 @@ public:
         winrt::Color const& initialLuminosityColor,
         winrt::Color const& initialFallbackColor,
         bool willTintColorAlwaysBeOpaque);
+
+    bool ShareCompositionBrushes();
+    void ShareCompositionBrushes(bool value);
+
+    void WarmUpCompositionResources(bool deferUntilIdle);
 };
 
 CppWinRTActivatableClass(AcrylicBrush)
\ No newline at end of file
@@ -15,6 +15,8 @@
 #include "RevealBorderLight.h"
 #include "vector.h"
 #include "RuntimeProfiler.h"
+#include "SampledPerfTrace.h"
+#include "DispatcherHelper.h"
 
 CppWinRTActivatableClassWithDPFactory(RevealBackgroundBrush)
 CppWinRTActivatableClassWithDPFactory(RevealBorderBrush)
@@ -37,13 +39,6 @@ const winrt::Matrix5x4 RevealBrush::sc_colorToAlphaMatrix =
       0.0f, 0.0f, 0.0f, 0.0f,
       0.0f, 0.0f, 0.0f, 0.85f };
 
-const winrt::Matrix5x4 RevealBrush::sc_luminanceToAlphaMatrix
-    { 1.0f, 0.0f, 0.0f, 0.2125f,
-      0.0f, 1.0f, 0.0f, 0.7154f,
-      0.0f, 0.0f, 1.0f, 0.0721f,
-      0.0f, 0.0f, 0.0f, 0.0f,
-      0.0f, 0.0f, 0.0f, 0.0f };
-
 // Originally the reveal border effect was built as:
 // 0) SceneLightingEffect input
 // 1) (0) multiplied through Luminance-to-alpha color matrix with ambient contribution of 0.5 in the RGBA offset row.
@@ -63,24 +58,28 @@ const winrt::Matrix5x4 RevealBrush::sc_luminanceToAlphaMatrix
 // design wants". :)
 
 // The reveal border matrix is the luminance to alpha matrix * 2
-const winrt::Matrix5x4 sc_revealBorderColorMatrix
-    { 2.0f, 0.0f, 0.0f, 2 * 0.2125f,
-        0.0f, 2.0f, 0.0f, 2 * 0.7154f,
-        0.0f, 0.0f, 2.0f, 2 * 0.0721f,
-        0.0f, 0.0f, 0.0f, 0.0f,
-        0.0f, 0.0f, 0.0f, 0.0f };
+const winrt::Matrix5x4 RevealBrush::sc_revealBorderColorMatrix =
+    Microsoft::UI::Composition::Effects::ColorMatrices::Scale(sc_luminanceToAlphaMatrix, 2.0f);
 
 // The inverse border is the above but the colors are negated.
-const winrt::Matrix5x4 sc_revealInvertedBorderColorMatrix
-    { -2.0f,  0.0f,  0.0f,  2 * .2125f,
-        0.0f, -2.0f,  0.0f,  2 * .7154f,
-        0.0f,  0.0f, -2.0f,  2 * .0721f,
-        0.0f,  0.0f,  0.0f,  0.0f,
-        0.0f,  0.0f,  0.0f,  0.0f };
+const winrt::Matrix5x4 RevealBrush::sc_revealInvertedBorderColorMatrix =
+    Microsoft::UI::Composition::Effects::ColorMatrices::Compose(
+        Microsoft::UI::Composition::Effects::ColorMatrices::Scale(sc_luminanceToAlphaMatrix, 2.0f),
+        { -1.0f,  0.0f,  0.0f,  0.0f,
+           0.0f, -1.0f,  0.0f,  0.0f,
+           0.0f,  0.0f, -1.0f,  0.0f,
+           0.0f,  0.0f,  0.0f,  1.0f,
+           0.0f,  0.0f,  0.0f,  0.0f });
 
 
 GlobalDependencyProperty RevealBrush::s_IsContainerProperty{ nullptr };
 
+// Hover and press light pairs taken off containers while MaterialHelper::RecycleRevealHoverLights is on.
+// Lights are thread-affine like the elements they're attached to, so the pool is per thread and shared
+// by all the lists on it. Only a few containers are near the pointer at any time, so the pool stays small.
+static constexpr size_t s_maxPooledHoverLights = 8;
+static thread_local std::vector<std::pair<com_ptr<RevealHoverLight>, com_ptr<RevealHoverLight>>> s_pooledHoverLights;
+
 void RevealBrush::ClearProperties()
 {
     s_IsContainerProperty = nullptr;
@@ -471,7 +470,7 @@ void RevealBrush::EnsureNoiseBrush()
     if (m_noiseChanged || !m_dpiScaledNoiseBrush)
     {
         int resScaleInt = MaterialHelper::BrushTemplates<RevealBrush>::GetEffectiveDpi(this);
-        m_dpiScaledNoiseBrush = MaterialHelper::GetNoiseBrush(resScaleInt);
+        m_dpiScaledNoiseBrush = MaterialHelper::GetNoiseBrush(winrt::Window::Current().Compositor(), resScaleInt);
     }
     m_noiseChanged = false;
 #else
@@ -619,6 +618,7 @@ RevealBrush::GetOrCreateRevealBrushCompositionEffectFactory(
     const winrt::Compositor& compositor)
 {
     auto effectFactory = MaterialHelper::GetOrCreateRevealBrushCompositionEffectFactoryFromCache(
+        compositor,
         isBorder,
         isInverted,
         hasBaseColor,
@@ -649,6 +649,8 @@ RevealBrush::GetOrCreateRevealBrushCompositionEffectFactory(
 
 void RevealBrush::CreateRevealBrush()
 {
+    SAMPLED_PERF_TRACE_SCOPE("RevealBrush.CreateBrush");
+
     winrt::Compositor compositor = winrt::Window::Current().Compositor();
     if (!IsInFallbackMode())
     {
@@ -769,11 +771,10 @@ void RevealBrush::AttachLights()
 
             // Note that AttachLights is only called by the first RevealBrush::OnConnected. 
             // In case of the brush re-entering on same tick, ShouldBeginAttachingLights ensure we 
-            // don't generate multiple subscriptions to CT.Rerndering
-            auto renderingEventForWindowRootToken = std::make_shared<winrt::event_token>();
-            *renderingEventForWindowRootToken = winrt::Xaml::Media::CompositionTarget::Rendering(
-                [renderingEventForWindowRootToken](auto&, auto&) {
-                bool unsubscribeFromRenderingEvent = true;
+            // don't generate multiple retries.
+            // The public root only becomes reachable once the tree has gone through layout, so retry after layout passes
+            // instead of on every frame.
+            RunAfterNextLayoutPass([]() {
                 if (MaterialHelper::ShouldBeginAttachingLights())
                 {
                     if (ValidatePublicRootAncestor())
@@ -788,20 +789,56 @@ void RevealBrush::AttachLights()
                     else
                     {
                         // Keep trying...
-                        unsubscribeFromRenderingEvent = false;
+                        return false;
                     }
                 }
-
-                if (unsubscribeFromRenderingEvent)
-                {
-                    winrt::Xaml::Media::CompositionTarget::Rendering(*renderingEventForWindowRootToken);
-                }
+                return true;
             });
         }
     }
 #endif
 }
 
+#ifndef BUILD_WINDOWS
+void RevealBrush::RunAfterNextLayoutPass(const std::function<bool()>& callback)
+{
+    auto windowContent = winrt::Window::Current().Content().try_as<winrt::FrameworkElement>();
+    auto token = std::make_shared<winrt::event_token>();
+
+    if (windowContent)
+    {
+        // LayoutUpdated is raised on every element after any layout pass, so there is no need to track
+        // Window.Content changes. Unlike CompositionTarget.Rendering, listening to it doesn't request frames.
+        winrt::weak_ref<winrt::FrameworkElement> weakContent = windowContent;
+        *token = windowContent.LayoutUpdated([weakContent, token, callback](auto&, auto&) {
+            if (auto content = weakContent.get())
+            {
+                content.LayoutUpdated(*token);
+            }
+
+            MaterialHelper::IncrementAttachLightsPassCount();
+            if (!callback())
+            {
+                RunAfterNextLayoutPass(callback);
+            }
+        });
+    }
+    else
+    {
+        // On MUX + RS2 the window may not have content yet, there is no element to listen to before the next frame.
+        *token = winrt::Xaml::Media::CompositionTarget::Rendering([token, callback](auto&, auto&) {
+            winrt::Xaml::Media::CompositionTarget::Rendering(*token);
+
+            MaterialHelper::IncrementAttachLightsPassCount();
+            if (!callback())
+            {
+                RunAfterNextLayoutPass(callback);
+            }
+        });
+    }
+}
+#endif
+
 void RevealBrush::AttachLightsImpl()
 {
     // Safe to attach RootScrollViewer lights immediately
@@ -815,14 +852,9 @@ void RevealBrush::AttachLightsImpl()
     {
         MaterialHelper::SetShouldContinueAttachingLights(true);
 
-        // Defer attaching PopupRoot until next Rendering event since this requires tree manipulations 
+        // Defer attaching PopupRoot until the current layout pass is done since this requires tree manipulations 
         // and will fail if we are called while PopupRoot is undergoing Layout
-        auto renderingEventForPopupToken = std::make_shared<winrt::event_token>();
-        *renderingEventForPopupToken = winrt::Xaml::Media::CompositionTarget::Rendering(
-            [renderingEventForPopupToken](auto&, auto&) {
-            // Detach event or Rendering will keep calling us back.
-            winrt::Xaml::Media::CompositionTarget::Rendering(*renderingEventForPopupToken);
-
+        RunAfterNextLayoutPass([]() {
             // If we've removed all lights from the tree before we finished attaching all lights, then don't attach the rest.
             if (MaterialHelper::ShouldContinueAttachingLights())
             {
@@ -846,6 +878,7 @@ void RevealBrush::AttachLightsImpl()
 
                 popup.IsOpen(true);
             }
+            return true;
         });
     }
 #endif
@@ -927,18 +960,27 @@ void RevealBrush::AttachLightsToElement(const winrt::UIElement & element, bool t
         auto wideBorderDarkTheme = winrt::make_self<RevealBorderLight>();
         wideBorderDarkTheme->SetIsWideLight(true);
 
-        auto ambientLight = winrt::make_self<XamlAmbientLight>();
+        // Popups and the window content all sit under the same root, so they share one ambient light rather
+        // than each carrying an identical copy with its own target set.
+        winrt::IInspectable root{ nullptr };
+#ifdef USE_INSIDER_SDK
+        if (SharedHelpers::IsXamlRootAvailable())
+        {
+            root = element.XamlRoot();
+        }
+#endif
+        auto ambientLight = XamlAmbientLight::GetOrCreateSharedLight(root);
 
         lights.Append(*borderLightTheme);
         lights.Append(*wideBorderLightTheme);
         lights.Append(*borderDarkTheme);
         lights.Append(*wideBorderDarkTheme);
-        lights.Append(*ambientLight);
+        lights.Append(ambientLight);
 
         if (trackAsRootToDisconnectFrom)
         {
             MaterialHelper::TrackRevealLightsToRemove(lights,
-                { *borderLightTheme, *wideBorderLightTheme, *borderDarkTheme, *wideBorderDarkTheme, *ambientLight });
+                { *borderLightTheme, *wideBorderLightTheme, *borderDarkTheme, *wideBorderDarkTheme, ambientLight });
         }
     }
 }
@@ -988,18 +1030,18 @@ void RevealBrush::AttachLightsToIsland(const winrt::XamlIsland& island)
         auto wideBorderDarkTheme = winrt::make_self<RevealBorderLight>();
         wideBorderDarkTheme->SetIsWideLight(true);
 
-        auto ambientLight = winrt::make_self<XamlAmbientLight>();
+        auto ambientLight = XamlAmbientLight::GetOrCreateSharedLight(island);
 
         lights.Append(*borderLightTheme);
         lights.Append(*wideBorderLightTheme);
         lights.Append(*borderDarkTheme);
         lights.Append(*wideBorderDarkTheme);
-        lights.Append(*ambientLight);
+        lights.Append(ambientLight);
 
         MaterialHelper::TrackRevealLightsToRemoveIsland(
             island,
             lights, 
-            {*borderLightTheme, *wideBorderLightTheme, *borderDarkTheme, *wideBorderDarkTheme, *ambientLight }
+            {*borderLightTheme, *wideBorderLightTheme, *borderDarkTheme, *wideBorderDarkTheme, ambientLight }
             );
     }
 }
@@ -1054,35 +1096,90 @@ void RevealBrush::OnIsContainerPropertyChanged(
         bool isAdding = unbox_value<bool>(args.NewValue());
 
         auto lights = elementSender.Lights();
-        int i = 0;
 
         if (isAdding)
         {
+            com_ptr<RevealHoverLight> hoverLight;
+            com_ptr<RevealHoverLight> pressLight;
+
+            if (!s_pooledHoverLights.empty())
+            {
+                std::tie(hoverLight, pressLight) = s_pooledHoverLights.back();
+                s_pooledHoverLights.pop_back();
+                hoverLight->PrepareForReuse();
+                pressLight->PrepareForReuse();
+            }
+            else
+            {
+                hoverLight = winrt::make_self<RevealHoverLight>();
+                pressLight = winrt::make_self<RevealHoverLight>();
+                pressLight->SetIsPressLight(true);
+            }
+
             // add the hover light
-            auto hoverLight = winrt::make_self<RevealHoverLight>();
             lights.Append(*hoverLight);
 
             // add the press light
-            auto pressLight = winrt::make_self<RevealHoverLight>();
-            pressLight->SetIsPressLight(true);
             lights.Append(*pressLight);
         }
         else
         {
-            // Step through all of the lights
-            for (auto light : lights)
+            com_ptr<RevealHoverLight> hoverLight;
+            com_ptr<RevealHoverLight> pressLight;
+
+            // Step through all of the lights backwards so that removing doesn't skip any
+            for (int i = static_cast<int>(lights.Size()) - 1; i >= 0; i--)
             {
-                if (auto self = light.try_as<winrt::RevealHoverLight>())
+                if (auto light = lights.GetAt(i).try_as<winrt::RevealHoverLight>())
                 {
                     // if we are in remove mode, remove all hover lights
                     lights.RemoveAt(i);
+
+                    auto internalLight = winrt::get_self<RevealHoverLight>(light);
+                    (internalLight->GetIsPressLight() ? pressLight : hoverLight).copy_from(internalLight);
                 }
-                i++;
+            }
+
+            if (hoverLight && pressLight &&
+                MaterialHelper::RecycleRevealHoverLights() &&
+                s_pooledHoverLights.size() < s_maxPooledHoverLights)
+            {
+                s_pooledHoverLights.emplace_back(hoverLight, pressLight);
             }
         }
     }
 }
 
+void RevealBrush::OnHoverLightTurnedOff(const winrt::UIElement& element)
+{
+    // The light is in the middle of a state transition, take the lights off the element once it is done.
+    DispatcherHelper dispatcherHelper{ element };
+    dispatcherHelper.RunAsync([weakElement = winrt::make_weak(element)]()
+    {
+        if (auto element = weakElement.get())
+        {
+            if (auto uiElement = element.try_as<winrt::IUIElement5>())
+            {
+                // Both the hover and the press light need to have faded out, and the element may have been
+                // hovered again in the meantime.
+                bool areLightsOff = uiElement.Lights().Size() > 0;
+                for (auto light : uiElement.Lights())
+                {
+                    if (auto hoverLight = light.try_as<winrt::RevealHoverLight>())
+                    {
+                        areLightsOff = areLightsOff && winrt::get_self<RevealHoverLight>(hoverLight)->IsOff();
+                    }
+                }
+
+                if (areLightsOff && unbox_value<bool>(element.GetValue(s_IsContainerProperty)))
+                {
+                    element.SetValue(s_IsContainerProperty, box_value(false));
+                }
+            }
+        }
+    });
+}
+
 void RevealBrush::OnStatePropertyChanged(
     const winrt::DependencyObject& sender,
     const winrt::DependencyPropertyChangedEventArgs& args)
@@ -1110,8 +1207,9 @@ void RevealBrush::OnStatePropertyChanged(
             }
 
             // Transition the Hover Light and the Pressed Light
+            // (they may already have been recycled if the element went back to Normal)
             auto lights = uiElement.Lights();
-            MUX_ASSERT(lights.Size() == 2);
+            MUX_ASSERT(lights.Size() == 2 || (lights.Size() == 0 && targetState == winrt::RevealBrushState::Normal));
 
             for (auto light : lights)
             {
@@ -119,7 +119,14 @@ protected:
     static const float sc_specularAmountBorder;
     static const float sc_specularShineBorder;
     static const winrt::Matrix5x4 sc_colorToAlphaMatrix;    // Converts the RGB in the noise texture into an alpha mask
-    static const winrt::Matrix5x4 sc_luminanceToAlphaMatrix;
+    static constexpr winrt::Matrix5x4 sc_luminanceToAlphaMatrix
+        { 1.0f, 0.0f, 0.0f, 0.2125f,
+          0.0f, 1.0f, 0.0f, 0.7154f,
+          0.0f, 0.0f, 1.0f, 0.0721f,
+          0.0f, 0.0f, 0.0f, 0.0f,
+          0.0f, 0.0f, 0.0f, 0.0f };
+    static const winrt::Matrix5x4 sc_revealBorderColorMatrix;
+    static const winrt::Matrix5x4 sc_revealInvertedBorderColorMatrix;
 
 
 private:
@@ -133,6 +140,9 @@ public:
         const winrt::DependencyObject& sender,
         const winrt::DependencyPropertyChangedEventArgs& args);
 
+    // Called by RevealHoverLight when MaterialHelper::RecycleRevealHoverLights is on.
+    static void OnHoverLightTurnedOff(const winrt::UIElement& element);
+
 private:
     void EnsureNoiseBrush();
     winrt::CompositionEffectFactory GetOrCreateRevealBrushCompositionEffectFactory(
@@ -150,6 +160,10 @@ private:
     static winrt::UIElement GetAncestor(const winrt::UIElement & root);
     static void AttachLightsToElement(const winrt::UIElement & element, bool trackAsRootToDisconnectFrom);
     static void AttachLightsImpl();
+#ifndef BUILD_WINDOWS
+    // Calls callback after the next layout pass, and again after each following one until it returns true.
+    static void RunAfterNextLayoutPass(const std::function<bool()>& callback);
+#endif
 
     winrt::CompositionSurfaceBrush m_noiseBrush{ nullptr };
 };
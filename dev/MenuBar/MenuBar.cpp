@@ -8,6 +8,7 @@
 #include "Vector.h"
 #include "VectorIterator.h"
 #include "MenuBarAutomationPeer.h"
+#include "StartupTrace.h"
 
 MenuBar::MenuBar()
 {
@@ -29,6 +30,8 @@ winrt::AutomationPeer MenuBar::OnCreateAutomationPeer()
 
 void MenuBar::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"MenuBar");
+
     SetUpTemplateParts();
     
     for (auto const& menuBarItem : Items())
@@ -9,6 +9,7 @@
 #include "Vector.h"
 #include "VectorIterator.h"
 #include "MenuBarItemAutomationPeer.h"
+#include "StartupTrace.h"
 
 MenuBarItem::MenuBarItem()
 {   
@@ -34,6 +35,8 @@ winrt::AutomationPeer MenuBarItem::OnCreateAutomationPeer()
 // IFramework Override
 void MenuBarItem::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"MenuBarItem");
+
     m_button.set(GetTemplateChildT<winrt::Button>(L"ContentButton", *this));
 
     PopulateContent();
@@ -49,7 +52,27 @@ void MenuBarItem::OnApplyTemplate()
 
 void MenuBarItem::PopulateContent()
 {
-    // Create flyout
+    if (auto button = m_button.get())
+    {
+        button.IsAccessKeyScope(true);
+
+        // The flyout is created the first time it is needed, see EnsureFlyout.
+        if (auto flyout = m_flyout.get())
+        {
+            button.ContextFlyout(flyout);
+        }
+    }
+}
+
+// A menu bar can have many items whose menus are never opened, so the flyout and its items are only
+// built when the menu is about to be shown, or when the pointer enters the item to get ahead of a click.
+winrt::MenuBarItemFlyout MenuBarItem::EnsureFlyout()
+{
+    if (auto existingFlyout = m_flyout.get())
+    {
+        return existingFlyout;
+    }
+
     winrt::MenuBarItemFlyout flyout;
 
     for (winrt::MenuFlyoutItemBase const& flyoutItem : Items())
@@ -70,9 +93,13 @@ void MenuBarItem::PopulateContent()
 
     if (auto button = m_button.get())
     {
-        button.IsAccessKeyScope(true);
         button.ContextFlyout(flyout);
     }
+
+    m_flyoutClosedRevoker = flyout.Closed(winrt::auto_revoke, { this, &MenuBarItem::OnFlyoutClosed });
+    m_flyoutOpeningRevoker = flyout.Opening(winrt::auto_revoke, { this, &MenuBarItem::OnFlyoutOpening });
+
+    return flyout;
 }
 
 void MenuBarItem::AttachEventHandlers()
@@ -124,6 +151,8 @@ void MenuBarItem::DetachEventHandlers(bool useSafeGet)
 // Event Handlers
 void MenuBarItem::OnMenuBarItemPointerEntered(winrt::IInspectable const& sender, winrt::PointerRoutedEventArgs const& args)
 {
+    EnsureFlyout();
+
     if (auto menuBar = m_menuBar.get())
     {
         auto flyoutOpen = (winrt::get_self<MenuBar>(menuBar)->IsFlyoutOpen());
@@ -214,6 +243,7 @@ void MenuBarItem::ShowMenuFlyout()
 {
     if (auto button = m_button.get())
     {
+        auto const flyout = EnsureFlyout();
         auto width = static_cast<float>(button.ActualWidth());
         auto height = static_cast<float>(button.ActualHeight());
 
@@ -225,22 +255,25 @@ void MenuBarItem::ShowMenuFlyout()
             options.Position(winrt::Point(0, height));
             options.Placement(winrt::FlyoutPlacementMode::Bottom);
             options.ExclusionRect(winrt::Rect(0, 0, width, height));
-            m_flyout.get().ShowAt(button, options);
+            flyout.ShowAt(button, options);
         }
         else
         {
-            m_flyout.get().ShowAt(button, winrt::Point(0, height));
+            flyout.ShowAt(button, winrt::Point(0, height));
         }
 
         // Attach keyboard event handler
-        auto presenter = winrt::get_self<MenuBarItemFlyout>(m_flyout.get())->m_presenter.get();
+        auto presenter = winrt::get_self<MenuBarItemFlyout>(flyout)->m_presenter.get();
         m_presenterKeyDownRevoker = presenter.KeyDown(winrt::auto_revoke, { this,  &MenuBarItem::OnPresenterKeyDown });
     }
 }
 
 void MenuBarItem::CloseMenuFlyout()
 {
-    m_flyout.get().Hide();
+    if (auto flyout = m_flyout.get())
+    {
+        flyout.Hide();
+    }
 }
 
 void MenuBarItem::OpenFlyoutFrom(FlyoutLocation location)
@@ -36,6 +36,7 @@ public:
 private:
 
     void PopulateContent();
+    winrt::MenuBarItemFlyout EnsureFlyout();
     void AttachEventHandlers();
     void DetachEventHandlers(bool useSafeGet = false);
     void OpenFlyoutFrom(FlyoutLocation location);
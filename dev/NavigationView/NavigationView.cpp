@@ -19,6 +19,7 @@
 #include "NavigationViewList.h"
 #include "Utils.h"
 #include "TraceLogging.h"
+#include "StartupTrace.h"
 
 static constexpr auto c_togglePaneButtonName = L"TogglePaneButton"sv;
 static constexpr auto c_paneTitleTextBlock = L"PaneTitleTextBlock"sv;
@@ -120,7 +121,7 @@ NavigationView::NavigationView()
     SetDefaultStyleKey(this);
 
     SizeChanged({ this, &NavigationView::OnSizeChanged });
-    auto items = winrt::make<Vector<winrt::IInspectable>>();
+    auto items = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Observable, VectorFlag::DependencyObjectBase, VectorFlag::HashedIndexOf>()>>();
     SetValue(s_MenuItemsProperty, items);
 
     auto weakThis = get_weak();
@@ -138,6 +139,8 @@ NavigationView::NavigationView()
 
 void NavigationView::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"NavigationView");
+
     // Stop update anything because of PropertyChange during OnApplyTemplate. Update them all together at the end of this function
     m_appliedTemplate = false;
 
@@ -319,9 +322,8 @@ void NavigationView::OnApplyTemplate()
 
         auto searchButtonName = ResourceAccessor::GetLocalizedStringResource(SR_NavigationViewSearchButtonName);
         winrt::AutomationProperties::SetName(button, searchButtonName);
-        auto toolTip = winrt::ToolTip();
-        toolTip.Content(box_value(searchButtonName));
-        winrt::ToolTipService::SetToolTip(button, toolTip);
+        // ToolTipService only creates the ToolTip for plain content the first time it is shown
+        winrt::ToolTipService::SetToolTip(button, box_value(searchButtonName));
     }
 
     if (auto backButton = GetTemplateChildT<winrt::Button>(c_navViewBackButton, controlProtected))
@@ -398,6 +400,12 @@ void NavigationView::OnApplyTemplate()
 // Hook up the Settings Item Invoked event listener
 void NavigationView::CreateAndHookEventsToSettings(std::wstring_view settingsName)
 {
+    // The settings item is hooked up the first time it becomes visible, see OnPropertyChanged
+    if (!IsSettingsVisible())
+    {
+        return;
+    }
+
     winrt::IControlProtected controlProtected = *this;
     auto settingsItem = GetTemplateChildT<winrt::NavigationViewItem>(settingsName, controlProtected);
     if (settingsItem && settingsItem != m_settingsItem.get())
@@ -769,6 +777,8 @@ void NavigationView::UpdateIsClosedCompact()
             winrt::VisualStateManager::GoToState(*this, m_isClosedCompact ? L"ListSizeCompact" : L"ListSizeFull", true /*useTransitions*/);
         }
 
+        PropagateIsClosedCompactToItems();
+
         UpdateTitleBarPadding();
         UpdateBackButtonVisibility();
         UpdatePaneTitleMargins();
@@ -776,6 +786,23 @@ void NavigationView::UpdateIsClosedCompact()
     }
 }
 
+// Items used to watch SplitView.IsPaneOpen and DisplayMode themselves, so opening or closing the pane ran one
+// property changed callback and visual state update per item. Push the new state from here in a single pass instead.
+void NavigationView::PropagateIsClosedCompactToItems()
+{
+    PropagateChangeToNavigationViewLists(NavigationViewPropagateTarget::LeftListView,
+        [isClosedCompact = m_isClosedCompact](NavigationViewList* list)
+            {
+                list->SetIsClosedCompact(isClosedCompact);
+            }
+        );
+
+    if (auto settingsItem = m_settingsItem.get())
+    {
+        winrt::get_self<NavigationViewItem>(settingsItem)->SetIsClosedCompact(m_isClosedCompact);
+    }
+}
+
 void NavigationView::OnBackButtonClicked(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args)
 {
     auto eventArgs = winrt::make_self<NavigationViewBackRequestedEventArgs>();
@@ -839,9 +866,7 @@ void NavigationView::SetPaneToggleButtonAutomationName()
     if (auto paneToggleButton = m_paneToggleButton.get())
     {
         winrt::AutomationProperties::SetName(paneToggleButton, navigationName);
-        auto toolTip = winrt::ToolTip();
-        toolTip.Content(box_value(navigationName));
-        winrt::ToolTipService::SetToolTip(paneToggleButton, toolTip);
+        winrt::ToolTipService::SetToolTip(paneToggleButton, box_value(navigationName));
     }
 }
 
@@ -855,10 +880,9 @@ void NavigationView::UpdateSettingsItemToolTip()
         }
         else
         {
+            // ToolTipService only creates the ToolTip for plain content the first time it is shown
             auto localizedSettingsName = ResourceAccessor::GetLocalizedStringResource(SR_SettingsButtonName);
-            auto toolTip = winrt::ToolTip();
-            toolTip.Content(box_value(localizedSettingsName));
-            winrt::ToolTipService::SetToolTip(settingsItem, toolTip);
+            winrt::ToolTipService::SetToolTip(settingsItem, box_value(localizedSettingsName));
         }
     }
 }
@@ -1018,10 +1042,66 @@ void NavigationView::AnimateSelectionChanged(const winrt::IInspectable& prevItem
     }
 }
 
+void NavigationView::EnsureIndicatorAnimations(const winrt::Compositor& compositor)
+{
+    if (m_indicatorAnimationsCompositor == compositor)
+    {
+        return;
+    }
+    m_indicatorAnimationsCompositor = compositor;
+
+    winrt::StepEasingFunction singleStep = compositor.CreateStepEasingFunction();
+    singleStep.IsFinalStepSingleFrame(true);
+    auto frame1Easing = compositor.CreateCubicBezierEasingFunction(c_frame1point1, c_frame1point2);
+    auto frame2Easing = compositor.CreateCubicBezierEasingFunction(c_frame2point1, c_frame2point2);
+
+    // fade the outgoing indicator so it looks nice when animating over the scroll area
+    m_outgoingIndicatorOpacityAnimation = compositor.CreateScalarKeyFrameAnimation();
+    m_outgoingIndicatorOpacityAnimation.InsertKeyFrame(0.0f, 1.0);
+    m_outgoingIndicatorOpacityAnimation.InsertKeyFrame(0.333f, 1.0, singleStep);
+    m_outgoingIndicatorOpacityAnimation.InsertKeyFrame(1.0f, 0.0, frame2Easing);
+    m_outgoingIndicatorOpacityAnimation.Duration(600ms);
+
+    for (auto animations : { &m_outgoingIndicatorAnimations, &m_incomingIndicatorAnimations })
+    {
+        auto parameters = compositor.CreatePropertySet();
+        parameters.InsertScalar(L"PositionBegin", 0.0f);
+        parameters.InsertScalar(L"PositionEnd", 0.0f);
+        parameters.InsertScalar(L"ScaleBegin", 1.0f);
+        parameters.InsertScalar(L"ScalePeak", 1.0f);
+        parameters.InsertScalar(L"ScaleEnd", 1.0f);
+        parameters.InsertScalar(L"CenterPointBegin", 0.0f);
+        parameters.InsertScalar(L"CenterPointEnd", 0.0f);
+        animations->parameters = parameters;
+
+        auto position = compositor.CreateScalarKeyFrameAnimation();
+        position.SetReferenceParameter(L"p", parameters);
+        position.InsertExpressionKeyFrame(0.0f, L"p.PositionBegin");
+        position.InsertExpressionKeyFrame(0.333f, L"p.PositionEnd", singleStep);
+        position.Duration(600ms);
+        animations->position = position;
+
+        auto scale = compositor.CreateScalarKeyFrameAnimation();
+        scale.SetReferenceParameter(L"p", parameters);
+        scale.InsertExpressionKeyFrame(0.0f, L"p.ScaleBegin");
+        scale.InsertExpressionKeyFrame(0.333f, L"p.ScalePeak", frame1Easing);
+        scale.InsertExpressionKeyFrame(1.0f, L"p.ScaleEnd", frame2Easing);
+        scale.Duration(600ms);
+        animations->scale = scale;
+
+        auto centerPoint = compositor.CreateScalarKeyFrameAnimation();
+        centerPoint.SetReferenceParameter(L"p", parameters);
+        centerPoint.InsertExpressionKeyFrame(0.0f, L"p.CenterPointBegin");
+        centerPoint.InsertExpressionKeyFrame(1.0f, L"p.CenterPointEnd", singleStep);
+        centerPoint.Duration(200ms);
+        animations->centerPoint = centerPoint;
+    }
+}
+
 void NavigationView::PlayIndicatorAnimations(const winrt::UIElement& indicator, float from, float to, winrt::Size beginSize, winrt::Size endSize, bool isOutgoing)
 {
     winrt::Visual visual = winrt::ElementCompositionPreview::GetElementVisual(indicator);
-    winrt::Compositor comp = visual.Compositor();
+    EnsureIndicatorAnimations(visual.Compositor());
 
     winrt::Size size = indicator.RenderSize();
     float dimension = IsTopNavigationView() ? size.Width : size.Height;
@@ -1034,48 +1114,33 @@ void NavigationView::PlayIndicatorAnimations(const winrt::UIElement& indicator,
         endScale = endSize.Width / size.Width;
     }
 
-    winrt::StepEasingFunction singleStep = comp.CreateStepEasingFunction();
-    singleStep.IsFinalStepSingleFrame(true);
-
     if (isOutgoing)
     {
-        // fade the outgoing indicator so it looks nice when animating over the scroll area
-        winrt::ScalarKeyFrameAnimation opacityAnim = comp.CreateScalarKeyFrameAnimation();
-        opacityAnim.InsertKeyFrame(0.0f, 1.0);
-        opacityAnim.InsertKeyFrame(0.333f, 1.0, singleStep);
-        opacityAnim.InsertKeyFrame(1.0f, 0.0, comp.CreateCubicBezierEasingFunction(c_frame2point1, c_frame2point2));
-        opacityAnim.Duration(600ms);
-
-        visual.StartAnimation(L"Opacity", opacityAnim);
+        visual.StartAnimation(L"Opacity", m_outgoingIndicatorOpacityAnimation);
     }
 
-    winrt::ScalarKeyFrameAnimation posAnim = comp.CreateScalarKeyFrameAnimation();
-    posAnim.InsertKeyFrame(0.0f, from < to ? from : (from + (dimension * (beginScale - 1))));
-    posAnim.InsertKeyFrame(0.333f, from < to ? (to + (dimension * (endScale - 1))) : to, singleStep);
-    posAnim.Duration(600ms);
-
-    winrt::ScalarKeyFrameAnimation scaleAnim = comp.CreateScalarKeyFrameAnimation();
-    scaleAnim.InsertKeyFrame(0.0f, beginScale);
-    scaleAnim.InsertKeyFrame(0.333f, abs(to - from) / dimension + (from < to ? endScale : beginScale), comp.CreateCubicBezierEasingFunction(c_frame1point1, c_frame1point2));
-    scaleAnim.InsertKeyFrame(1.0f, endScale, comp.CreateCubicBezierEasingFunction(c_frame2point1, c_frame2point2));
-    scaleAnim.Duration(600ms);
-
-    winrt::ScalarKeyFrameAnimation centerAnim = comp.CreateScalarKeyFrameAnimation();
-    centerAnim.InsertKeyFrame(0.0f, from < to ? 0.0f : dimension);
-    centerAnim.InsertKeyFrame(1.0f, from < to ? dimension : 0.0f, singleStep);
-    centerAnim.Duration(200ms);
+    // Only the keyframe values change between selections, the animations themselves are shared.
+    auto& animations = isOutgoing ? m_outgoingIndicatorAnimations : m_incomingIndicatorAnimations;
+    auto parameters = animations.parameters;
+    parameters.InsertScalar(L"PositionBegin", from < to ? from : (from + (dimension * (beginScale - 1))));
+    parameters.InsertScalar(L"PositionEnd", from < to ? (to + (dimension * (endScale - 1))) : to);
+    parameters.InsertScalar(L"ScaleBegin", beginScale);
+    parameters.InsertScalar(L"ScalePeak", abs(to - from) / dimension + (from < to ? endScale : beginScale));
+    parameters.InsertScalar(L"ScaleEnd", endScale);
+    parameters.InsertScalar(L"CenterPointBegin", from < to ? 0.0f : dimension);
+    parameters.InsertScalar(L"CenterPointEnd", from < to ? dimension : 0.0f);
 
     if (IsTopNavigationView())
     {
-        visual.StartAnimation(L"Offset.X", posAnim);
-        visual.StartAnimation(L"Scale.X", scaleAnim);
-        visual.StartAnimation(L"CenterPoint.X", centerAnim);
+        visual.StartAnimation(L"Offset.X", animations.position);
+        visual.StartAnimation(L"Scale.X", animations.scale);
+        visual.StartAnimation(L"CenterPoint.X", animations.centerPoint);
     }
     else
     {
-        visual.StartAnimation(L"Offset.Y", posAnim);
-        visual.StartAnimation(L"Scale.Y", scaleAnim);
-        visual.StartAnimation(L"CenterPoint.Y", centerAnim);
+        visual.StartAnimation(L"Offset.Y", animations.position);
+        visual.StartAnimation(L"Scale.Y", animations.scale);
+        visual.StartAnimation(L"CenterPoint.Y", animations.centerPoint);
     }
 }
 
@@ -2241,16 +2306,27 @@ void NavigationView::HandleTopNavigationMeasureOverrideOverflow(const winrt::Win
     }
     else if (desiredWidth < availableSize.Width)
     {
+        m_topDataProvider.InvalidWidthCacheIfOverflowItemContentChanged();
+
         auto fullyRecoverWidth = m_topDataProvider.WidthRequiredToRecoveryAllItemsToPrimary();
         if (availableSize.Width >= desiredWidth + fullyRecoverWidth + m_topNavigationRecoveryGracePeriodWidth)
         {
-            // It's possible to recover from Overflow to Normal state, so we restart the MeasureOverride from first step
-            ContinueHandleTopNavigationMeasureOverride(TopNavigationViewLayoutState::InitStep1, availableSize);
+            if (m_topDataProvider.HasMeasuredWidthForAllOverflowItems())
+            {
+                // The cached widths already tell us that everything fits, so recover in this pass instead of
+                // restarting from InitStep1, which takes two more measure passes to get back to Normal.
+                m_topDataProvider.MoveAllItemsToPrimaryList();
+                SetOverflowButtonVisibility(winrt::Visibility::Collapsed);
+                SetTopNavigationViewNextMode(TopNavigationViewLayoutState::Normal);
+            }
+            else
+            {
+                // It's possible to recover from Overflow to Normal state, so we restart the MeasureOverride from first step
+                ContinueHandleTopNavigationMeasureOverride(TopNavigationViewLayoutState::InitStep1, availableSize);
+            }
         }
         else
         {
-            m_topDataProvider.InvalidWidthCacheIfOverflowItemContentChanged();
-
             auto movableItems = FindMovableItemsRecoverToPrimaryList(availableSize.Width- desiredWidth, {}/*includeItems*/);
             m_topDataProvider.MoveItemsToPrimaryList(movableItems);
             if (m_topDataProvider.HasInvalidWidth(movableItems))
@@ -2427,30 +2503,34 @@ std::vector<int> NavigationView::FindMovableItemsRecoverToPrimaryList(float avai
         availableWidth -= width;
     }
 
-    int i = 0;
-    while (i < size && availableWidth > 0)
+    if (availableWidth > 0)
     {
-        if (!m_topDataProvider.IsItemInPrimaryList(i) && !CollectionHelper::contains(includeItems, i))
+        // All overflow items before the one that reaches availableWidth fit, only that one can go either way
+        int end = m_topDataProvider.FindFirstOverflowItemReachingWidth(availableWidth, includeItems);
+
+        int i = 0;
+        for (; i < end; i++)
         {
-            auto width = m_topDataProvider.GetWidthForItem(i);
-            if (availableWidth >= width)
+            if (!m_topDataProvider.IsItemInPrimaryList(i) && !CollectionHelper::contains(includeItems, i))
             {
                 toBeMoved.push_back(i);
-                availableWidth -= width;
-            }
-            else
-            {
-                break;
+                availableWidth -= m_topDataProvider.GetWidthForItem(i);
             }
         }
-        i++;
-    }
-    // Keep at one item is not in primary list. Two possible reason: 
-    //  1, Most likely it's caused by m_topNavigationRecoveryGracePeriod
-    //  2, virtualization and it doesn't have cached width
-    if (i == size && !toBeMoved.empty())
-    {
-        toBeMoved.pop_back();
+
+        if (i < size && availableWidth >= m_topDataProvider.GetWidthForItem(i))
+        {
+            toBeMoved.push_back(i);
+            i++;
+        }
+
+        // Keep at one item is not in primary list. Two possible reason: 
+        //  1, Most likely it's caused by m_topNavigationRecoveryGracePeriod
+        //  2, virtualization and it doesn't have cached width
+        if (i == size && !toBeMoved.empty())
+        {
+            toBeMoved.pop_back();
+        }
     }
     return toBeMoved;
 }
@@ -2672,6 +2752,10 @@ void NavigationView::OnPropertyChanged(const winrt::DependencyPropertyChangedEve
     }
     else if (property == s_IsSettingsVisibleProperty)
     {
+        if (m_appliedTemplate)
+        {
+            CreateAndHookEventsToSettings(IsTopNavigationView() ? c_settingsNameTopNav : c_settingsName);
+        }
         UpdateVisualState();
     }        
 }
@@ -193,6 +193,7 @@ private:
     void AnimateSelectionChanged(const winrt::IInspectable& lastItem, const winrt::IInspectable& currentItem);
     void AnimateSelectionChangedToItem(const winrt::IInspectable& selectedItem);
     void PlayIndicatorAnimations(const winrt::UIElement& indicator, float yFrom, float yTo, winrt::Size beginSize, winrt::Size endSize, bool isOutgoing);
+    void EnsureIndicatorAnimations(const winrt::Compositor& compositor);
     void OnAnimationComplete(const winrt::IInspectable& sender, const winrt::CompositionBatchCompletedEventArgs& args);
     void ResetElementAnimationProperties(const winrt::UIElement& element, float desiredOpacity);
     winrt::NavigationViewItem NavigationViewItemOrSettingsContentFromData(const winrt::IInspectable& data);
@@ -247,6 +248,7 @@ private:
     void OnSplitViewPaneOpened(const winrt::DependencyObject& sender, const winrt::IInspectable& obj);
     void OnSplitViewPaneOpening(const winrt::DependencyObject& sender, const winrt::IInspectable& obj);
     void UpdateIsClosedCompact();
+    void PropagateIsClosedCompactToItems();
 
     void OnBackButtonClicked(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
 
@@ -280,6 +282,20 @@ private:
     tracker_ref<winrt::UIElement> m_prevIndicator{ this };
     tracker_ref<winrt::UIElement> m_nextIndicator{ this };
 
+    // The selection indicator animations are built once and reused for every selection change.
+    // Their keyframes read from the parameters property set, which PlayIndicatorAnimations fills in.
+    struct IndicatorAnimations
+    {
+        winrt::CompositionPropertySet parameters{ nullptr };
+        winrt::ScalarKeyFrameAnimation position{ nullptr };
+        winrt::ScalarKeyFrameAnimation scale{ nullptr };
+        winrt::ScalarKeyFrameAnimation centerPoint{ nullptr };
+    };
+    winrt::Compositor m_indicatorAnimationsCompositor{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_outgoingIndicatorOpacityAnimation{ nullptr };
+    IndicatorAnimations m_outgoingIndicatorAnimations{};
+    IndicatorAnimations m_incomingIndicatorAnimations{};
+
     tracker_ref<winrt::FrameworkElement> m_togglePaneTopPadding{ this };
     tracker_ref<winrt::FrameworkElement> m_contentPaneTopPadding{ this };
     tracker_ref<winrt::FrameworkElement> m_topPadding{ this };
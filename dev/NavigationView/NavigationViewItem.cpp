@@ -8,6 +8,7 @@
 #include "NavigationViewItem.h"
 #include "NavigationViewItemAutomationPeer.h"
 #include "Utils.h"
+#include "StartupTrace.h"
 
 
 static constexpr wstring_view c_navigationViewItemPresenterName = L"NavigationViewItemPresenter"sv;
@@ -33,6 +34,8 @@ NavigationViewItem::~NavigationViewItem()
 
 void NavigationViewItem::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"NavigationViewItem");
+
     // Stop UpdateVisualState before template is applied. Otherwise the visual may not the same as we expect
     m_appliedTemplate = false;
  
@@ -46,12 +49,9 @@ void NavigationViewItem::OnApplyTemplate()
 
     m_toolTip.set(GetTemplateChildT<winrt::ToolTip>(L"ToolTip"sv, controlProtected));
 
+    // IsPaneOpen and DisplayMode changes are pushed by NavigationView, see SetIsClosedCompact.
     if (auto splitView = GetSplitView())
     {
-        m_splitViewIsPaneOpenChangedRevoker = RegisterPropertyChanged(splitView,
-            winrt::SplitView::IsPaneOpenProperty(), { this, &NavigationViewItem::OnSplitViewPropertyChanged });
-        m_splitViewDisplayModeChangedRevoker = RegisterPropertyChanged(splitView,
-            winrt::SplitView::DisplayModeProperty(), { this, &NavigationViewItem::OnSplitViewPropertyChanged });
         m_splitViewCompactPaneLengthChangedRevoker = RegisterPropertyChanged(splitView,
             winrt::SplitView::CompactPaneLengthProperty(), { this, &NavigationViewItem::OnSplitViewPropertyChanged });
 
@@ -82,11 +82,6 @@ void NavigationViewItem::OnSplitViewPropertyChanged(const winrt::DependencyObjec
     {
         UpdateCompactPaneLength();
     }
-    else if (args == winrt::SplitView::IsPaneOpenProperty() ||
-        args == winrt::SplitView::DisplayModeProperty())
-    {
-        UpdateIsClosedCompact();
-    }
 }
 
 void NavigationViewItem::UpdateCompactPaneLength()
@@ -107,6 +102,15 @@ void NavigationViewItem::UpdateIsClosedCompact()
     }
 }
 
+void NavigationViewItem::SetIsClosedCompact(bool isClosedCompact)
+{
+    if (m_isClosedCompact != isClosedCompact)
+    {
+        m_isClosedCompact = isClosedCompact;
+        UpdateVisualState(true /*useTransitions*/);
+    }
+}
+
 void NavigationViewItem::UpdateNavigationViewItemToolTip()
 {
     auto toolTipContent = winrt::ToolTipService::GetToolTip(*this);
@@ -43,6 +43,9 @@ public:
     // NavigationViewItemPresenter. But NavigationViewItemPresenter is created after NavigationViewItem. 
     // It provides a chance for NavigationViewItemPresenter to request visualstate refresh
     void UpdateVisualStateNoTransition();
+
+    // NavigationViewItemBase
+    void SetIsClosedCompact(bool isClosedCompact) override;
     
     bool IsContentChangeHandlingDelayedForTopNav() { return m_isContentChangeHandlingDelayedForTopNav; }
     void ClearIsContentChangeHandlingDelayedForTopNavFlag() { m_isContentChangeHandlingDelayedForTopNav = false; }
@@ -72,8 +75,6 @@ private:
     
     NavigationViewItemPresenter * GetPresenter();
 
-    PropertyChanged_revoker m_splitViewIsPaneOpenChangedRevoker{};
-    PropertyChanged_revoker m_splitViewDisplayModeChangedRevoker{};
     PropertyChanged_revoker m_splitViewCompactPaneLengthChangedRevoker{};
 
     tracker_ref<winrt::ToolTip> m_toolTip{ this };
@@ -42,6 +42,9 @@ public:
 
     virtual void OnNavigationViewListPositionChanged() {}
 
+    // Pushed by NavigationView through NavigationViewList when the pane opens, closes or changes display mode.
+    virtual void SetIsClosedCompact(bool /*isClosedCompact*/) {}
+
     NavigationViewListPosition Position();
     void Position(NavigationViewListPosition value);
     
@@ -5,6 +5,7 @@
 #include "common.h"
 #include "NavigationViewItemHeader.h"
 #include "NavigationView.h"
+#include "StartupTrace.h"
 
 CppWinRTActivatableClassWithBasicFactory(NavigationViewItemHeader);
 
@@ -19,15 +20,10 @@ NavigationViewItemHeader::~NavigationViewItemHeader()
 
 void NavigationViewItemHeader::OnApplyTemplate()
 {
-    if (auto splitView = GetSplitView())
-    {
-        m_splitViewIsPaneOpenChangedRevoker = RegisterPropertyChanged(splitView,
-            winrt::SplitView::IsPaneOpenProperty(), { this, &NavigationViewItemHeader::OnSplitViewPropertyChanged });
-        m_splitViewDisplayModeChangedRevoker = RegisterPropertyChanged(splitView,
-            winrt::SplitView::DisplayModeProperty(), { this, &NavigationViewItemHeader::OnSplitViewPropertyChanged });
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"NavigationViewItemHeader");
 
-        UpdateIsClosedCompact();
-    }
+    // Later IsPaneOpen and DisplayMode changes are pushed by NavigationView, see SetIsClosedCompact.
+    UpdateIsClosedCompact();
 
     UpdateVisualState(false /*useTransitions*/);
 
@@ -35,12 +31,12 @@ void NavigationViewItemHeader::OnApplyTemplate()
     NavigationView::CreateAndAttachHeaderAnimation(visual);
 }
 
-void NavigationViewItemHeader::OnSplitViewPropertyChanged(const winrt::DependencyObject& /*sender*/, const winrt::DependencyProperty& args)
+void NavigationViewItemHeader::SetIsClosedCompact(bool isClosedCompact)
 {
-    if (args == winrt::SplitView::IsPaneOpenProperty() ||
-        args == winrt::SplitView::DisplayModeProperty())
+    if (m_isClosedCompact != isClosedCompact)
     {
-        UpdateIsClosedCompact();
+        m_isClosedCompact = isClosedCompact;
+        UpdateVisualState(true /*useTransitions*/);
     }
 }
 
@@ -18,15 +18,14 @@ public:
     // IFrameworkElementOverrides
     void OnApplyTemplate() override;
 
+    // NavigationViewItemBase
+    void SetIsClosedCompact(bool isClosedCompact) override;
+
 private:
-    void OnSplitViewPropertyChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
     void UpdateIsClosedCompact();
 
     void UpdateVisualState(bool useTransitions);
 
     bool m_isClosedCompact{ false };
 
-    PropertyChanged_revoker m_splitViewIsPaneOpenChangedRevoker{};
-    PropertyChanged_revoker m_splitViewDisplayModeChangedRevoker{};
-
 };
@@ -6,6 +6,7 @@
 #include "NavigationViewItemPresenter.h"
 #include "NavigationViewItem.h"
 #include "SharedHelpers.h"
+#include "StartupTrace.h"
 
 NavigationViewItemPresenter::NavigationViewItemPresenter()
 {
@@ -14,6 +15,8 @@ NavigationViewItemPresenter::NavigationViewItemPresenter()
 
 void NavigationViewItemPresenter::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"NavigationViewItemPresenter");
+
     // Retrieve pointers to stable controls 
     m_helper.Init(*this);
     if (auto navigationViewItem = GetNavigationViewItem())
@@ -5,6 +5,7 @@
 #include "common.h"
 #include "NavigationViewItemSeparator.h"
 #include "Utils.h"
+#include "StartupTrace.h"
 
 CppWinRTActivatableClassWithBasicFactory(NavigationViewItemSeparator);
 
@@ -26,6 +27,8 @@ void NavigationViewItemSeparator::UpdateVisualState(bool useTransitions)
 
 void NavigationViewItemSeparator::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"NavigationViewItemSeparator");
+
     // Stop UpdateVisualState before template is applied. Otherwise the visual may not the same as we expect
     m_appliedTemplate = false;
     __super::OnApplyTemplate();
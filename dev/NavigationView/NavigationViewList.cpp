@@ -58,7 +58,9 @@ void NavigationViewList::PrepareContainerForItemOverride(winrt::DependencyObject
 {
     if (auto itemContainer = element.try_as<winrt::NavigationViewItemBase>())
     {
-        winrt::get_self<NavigationViewItemBase>(itemContainer)->Position(m_navigationViewListPosition);
+        auto itemContainerImpl = winrt::get_self<NavigationViewItemBase>(itemContainer);
+        itemContainerImpl->Position(m_navigationViewListPosition);
+        itemContainerImpl->SetIsClosedCompact(m_isClosedCompact);
     }
     if (auto itemContainer = element.try_as<winrt::NavigationViewItem>())
     {
@@ -89,6 +91,16 @@ void NavigationViewList::SetShowFocusVisual(bool showFocus)
     });
 }
 
+void NavigationViewList::SetIsClosedCompact(bool isClosedCompact)
+{
+    m_isClosedCompact = isClosedCompact;
+    PropagateChangeToAllContainers<winrt::NavigationViewItemBase>(
+        [isClosedCompact](const winrt::NavigationViewItemBase& container)
+    {
+        winrt::get_self<NavigationViewItemBase>(container)->SetIsClosedCompact(isClosedCompact);
+    });
+}
+
 void NavigationViewList::SetNavigationViewParent(winrt::NavigationView const& navigationView)
 {
     m_navigationView = winrt::make_weak(navigationView);
@@ -124,22 +136,18 @@ winrt::NavigationViewItemBase NavigationViewList::GetLastItemCalledInIsItemItsOw
     return m_lastItemCalledInIsItemItsOwnContainerOverride.get();
 }
 
+// Only realized containers live in the items panel. Containers realized later pick up the
+// current state in PrepareContainerForItemOverride, so there's no need to visit every item.
 template<typename T> 
 void NavigationViewList::PropagateChangeToAllContainers(std::function<void(typename T& container)> function)
 {
-    if (auto items = Items())
+    if (auto panel = ItemsPanelRoot())
     {
-        auto size = static_cast<int>(items.Size());
-        for (int i = 0; i < size; i++)
+        for (auto const& child : panel.Children())
         {
-            auto container = ContainerFromIndex(i);
-            if (container)
+            if (auto itemContainer = child.try_as<typename T>())
             {
-                auto itemContainer = container.try_as<typename T>();
-                if (itemContainer)
-                {
-                    function(itemContainer);
-                }
+                function(itemContainer);
             }
         }
     }
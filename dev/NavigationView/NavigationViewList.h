@@ -19,6 +19,7 @@ public:
 
     void SetNavigationViewListPosition(NavigationViewListPosition navigationViewListPosition);
     void SetShowFocusVisual(bool showFocus);
+    void SetIsClosedCompact(bool isClosedCompact);
 
     // In overflow, NavigationViewItem can't reach to NavigationView from visual tree by iterating all parents since it's a popup.
     // As a workaround, we make NavigationViewList keep a weakref of NavigationView.
@@ -33,6 +34,7 @@ public:
 private:
     NavigationViewListPosition m_navigationViewListPosition{ NavigationViewListPosition::LeftNav };
     bool m_showFocusVisual{ true };
+    bool m_isClosedCompact{ false };
     template<typename T> void PropagateChangeToAllContainers(std::function<void(typename T& container)> function);
     winrt::weak_ref<winrt::NavigationView> m_navigationView{ nullptr };
 
@@ -347,6 +347,31 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void VerifySettingsItemIsHookedUpWhenFirstShown()
+        {
+            NavigationView navView = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                navView = new NavigationView();
+                navView.IsSettingsVisible = false;
+                MUXControlsTestApp.App.TestContentRoot = navView;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsNull(navView.SettingsItem, "Verify settings item is not hooked up while it is hidden");
+
+                navView.IsSettingsVisible = true;
+                Verify.IsNotNull(navView.SettingsItem, "Verify settings item is hooked up once it is shown");
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
 #if BUILD_WINDOWS
         [TestMethod]
         [TestProperty("BUG", "RS3:12705080")]
@@ -15,6 +15,7 @@
 //  We never Add/Delete A,B and C Vector directly, but change the flag.
 //  If flag for Homes is changed from A to B, it asks A to remove it by indexInRawData first, then insert the new data to B vector with indexInRawData
 // SplitVector itself maintained the mapping between indexInRawData and indexInSplitVector.
+// It keeps the mapping in both directions, so finding an item by its indexInRawData doesn't search the vector.
 template<typename T, typename SplitVectorID>
 class SplitVector
 {
@@ -51,18 +52,27 @@ public:
             }
         };
 
+        if (indexInOriginalVector < static_cast<int>(m_indexesInSplitVector.size()))
+        {
+            m_indexesInSplitVector.erase(m_indexesInSplitVector.begin() + indexInOriginalVector);
+        }
     }
 
     void OnRawDataInsert(int preferIndex, int indexInOriginalVector, typename T const& value, SplitVectorID vectorID)
     {
         for (auto& v : m_indexesInOriginalVector)
         {
-            if (v > indexInOriginalVector)
+            if (v >= indexInOriginalVector)
             {
                 v++;
             }
         };
 
+        if (indexInOriginalVector < static_cast<int>(m_indexesInSplitVector.size()))
+        {
+            m_indexesInSplitVector.insert(m_indexesInSplitVector.begin() + indexInOriginalVector, -1);
+        }
+
         if (m_vectorID == vectorID)
         {
             InsertAt(preferIndex, indexInOriginalVector, value);
@@ -75,6 +85,12 @@ public:
         MUX_ASSERT(indexInOriginalVector >= 0);
         m_vector.get().InsertAt(preferIndex, value);
         m_indexesInOriginalVector.insert(m_indexesInOriginalVector.begin()+preferIndex, indexInOriginalVector);
+
+        if (indexInOriginalVector >= static_cast<int>(m_indexesInSplitVector.size()))
+        {
+            m_indexesInSplitVector.resize(indexInOriginalVector + 1, -1);
+        }
+        UpdateIndexesInSplitVector(preferIndex);
     }
 
     void Replace(int indexInOriginalVector, typename T const& value)
@@ -91,6 +107,7 @@ public:
     {
         m_vector.get().Clear();
         m_indexesInOriginalVector.clear();
+        m_indexesInSplitVector.clear();
     }
 
     void RemoveAt(int indexInOriginalVector)
@@ -100,6 +117,9 @@ public:
         MUX_ASSERT(index < m_indexesInOriginalVector.size());
         m_vector.get().RemoveAt(index);
         m_indexesInOriginalVector.erase(m_indexesInOriginalVector.begin() + index);
+
+        m_indexesInSplitVector[indexInOriginalVector] = -1;
+        UpdateIndexesInSplitVector(index);
     }
 
     int IndexOf(const typename T& value)
@@ -116,20 +136,38 @@ public:
 
     int IndexFromIndexInOriginalVector(int indexInOriginalVector)
     {
-        auto pos = std::find(m_indexesInOriginalVector.begin(), m_indexesInOriginalVector.end(), indexInOriginalVector);
-        if (pos != m_indexesInOriginalVector.end())
+        if (indexInOriginalVector >= 0 && indexInOriginalVector < static_cast<int>(m_indexesInSplitVector.size()))
         {
-            return static_cast<int>(std::distance(m_indexesInOriginalVector.begin(), pos));
+            return m_indexesInSplitVector[indexInOriginalVector];
         }
         return -1;
     }
+
+    // Items are kept in the same order as in the original vector, so this is where an item with
+    // indexInOriginalVector goes when it's inserted.
+    int InsertIndexForIndexInOriginalVector(int indexInOriginalVector)
+    {
+        auto pos = std::lower_bound(m_indexesInOriginalVector.begin(), m_indexesInOriginalVector.end(), indexInOriginalVector);
+        return static_cast<int>(std::distance(m_indexesInOriginalVector.begin(), pos));
+    }
 private:
     int Size() { return  static_cast<int>(m_indexesInOriginalVector.size()); }
 
+    void UpdateIndexesInSplitVector(int startIndex)
+    {
+        for (int i = startIndex; i < Size(); i++)
+        {
+            m_indexesInSplitVector[m_indexesInOriginalVector[i]] = i;
+        }
+    }
+
 private:
     SplitVectorID m_vectorID;
     tracker_ref<winrt::IVector<typename T>> m_vector;
     std::vector<int> m_indexesInOriginalVector{ };
+    // Reverse of m_indexesInOriginalVector, -1 for the items which are not in this vector.
+    // Items past the end of it are not in this vector either.
+    std::vector<int> m_indexesInSplitVector{ };
     std::function<int(typename T const& value)> m_indexFunctionFromDataSource{ };
 };
 
@@ -354,6 +392,10 @@ private:
 
     int GetPreferIndex(int index, SplitVectorID vectorID)
     {
+        if (auto &vector = m_splitVectors[vectorID])
+        {
+            return vector->InsertIndexForIndexInOriginalVector(index);
+        }
         return RangeCount(0, index, vectorID);
     }
 
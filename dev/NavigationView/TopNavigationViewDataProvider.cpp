@@ -114,6 +114,7 @@ void TopNavigationViewDataProvider::MoveAllItemsToPrimaryList()
     {
         MoveItemToVector(i, PrimaryList);
     }
+    InvalidateOverflowWidthTree();
 }
 
 std::vector<int> TopNavigationViewDataProvider::ConvertPrimaryIndexToIndex(std::vector<int> const& indexesInPrimary)
@@ -149,7 +150,9 @@ void TopNavigationViewDataProvider::MoveItemsToList(std::vector<int> const& inde
 {
     for (auto &index : indexes)
     {
+        auto oldWidth = OverflowWidthForItem(index);
         MoveItemToVector(index, vectorID);
+        UpdateOverflowWidthTree(index, OverflowWidthForItem(index) - oldWidth);
     };
 }
 
@@ -196,18 +199,60 @@ void TopNavigationViewDataProvider::UpdateWidthForPrimaryItem(int indexInPrimary
 
 float TopNavigationViewDataProvider::WidthRequiredToRecoveryAllItemsToPrimary()
 {
+    EnsureOverflowWidthTree();
+
     auto width = 0.f;
-    for (int i=0; i<Size(); i++)
+    for (int i = static_cast<int>(m_overflowWidthTree.size()) - 1; i > 0; i -= i & -i)
     {
-        if (!IsItemInPrimaryList(i))
-        {
-            width += GetWidthForItem(i);
-        }
+        width += m_overflowWidthTree[i];
     }
     width -= m_overflowButtonCachedWidth;
     return std::max(0.f, width);
 }
 
+int TopNavigationViewDataProvider::FindFirstOverflowItemReachingWidth(float width, std::vector<int> const& excludeItems)
+{
+    EnsureOverflowWidthTree();
+
+    int size = static_cast<int>(m_overflowWidthTree.size()) - 1;
+    int highestStep = 1;
+    while (highestStep * 2 <= size)
+    {
+        highestStep *= 2;
+    }
+
+    // Walk down the tree to the longest run of items whose total width stays below width.
+    auto findFirstReaching = [this, size, highestStep](float width)
+    {
+        int count = 0;
+        for (int step = highestStep; step > 0; step /= 2)
+        {
+            int next = count + step;
+            if (next <= size && m_overflowWidthTree[next] < width)
+            {
+                count = next;
+                width -= m_overflowWidthTree[next];
+            }
+        }
+        return count;
+    };
+
+    int index = findFirstReaching(width);
+
+    // An excluded item at or before the result doesn't count, so search again with its width added back.
+    auto sortedExcludeItems = excludeItems;
+    std::sort(sortedExcludeItems.begin(), sortedExcludeItems.end());
+    for (auto excludeItem : sortedExcludeItems)
+    {
+        if (excludeItem >= 0 && excludeItem <= index && excludeItem < size)
+        {
+            width += OverflowWidthForItem(excludeItem);
+            index = findFirstReaching(width);
+        }
+    }
+    return index;
+}
+
 bool TopNavigationViewDataProvider::HasInvalidWidth(std::vector<int> & items)
 {
     bool hasInvalidWidth = false;
@@ -247,6 +292,17 @@ void TopNavigationViewDataProvider::InvalidWidthCache()
     ResetAttachedData(-1.0f);
 }
 
+void TopNavigationViewDataProvider::ResetAttachedData()
+{
+    ResetAttachedData(DefaultAttachedData());
+}
+
+void TopNavigationViewDataProvider::ResetAttachedData(float width)
+{
+    SplitDataSourceT::ResetAttachedData(width);
+    InvalidateOverflowWidthTree();
+}
+
 float TopNavigationViewDataProvider::OverflowButtonWidth()
 {
     return m_overflowButtonCachedWidth;
@@ -297,6 +353,8 @@ void TopNavigationViewDataProvider::OnDataSourceChanged(const winrt::IInspectabl
             break;
         }
     }
+    InvalidateOverflowWidthTree();
+
     if (m_dataChangeCallback)
     {
         m_dataChangeCallback(args);
@@ -314,9 +372,26 @@ bool TopNavigationViewDataProvider::IsValidWidthForItem(int index)
     return IsValidWidth(width);
 }
 
+bool TopNavigationViewDataProvider::HasMeasuredWidthForAllOverflowItems()
+{
+    for (int i = 0; i < Size(); i++)
+    {
+        if (!IsItemInPrimaryList(i))
+        {
+            // DefaultAttachedData is a placeholder that lets an item be recovered before it was measured
+            auto width = AttachedData(i);
+            if (!IsValidWidth(width) || width == DefaultAttachedData())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void TopNavigationViewDataProvider::InvalidWidthCacheIfOverflowItemContentChanged()
 {
-    bool shouldRefreshCache = false;
+    // Only the items whose content changed need to be measured again, the other cached widths are still good.
     for (int i = 0; i < Size(); i++)
     {
         if (!IsItemInPrimaryList(i))
@@ -327,26 +402,69 @@ void TopNavigationViewDataProvider::InvalidWidthCacheIfOverflowItemContentChange
                 if (itemPointer->IsContentChangeHandlingDelayedForTopNav())
                 {
                     itemPointer->ClearIsContentChangeHandlingDelayedForTopNavFlag();
-                    shouldRefreshCache = true;
+                    SetAttachedWidth(i, -1.0f);
                 }
             }
         }
     }
+}
 
-    if (shouldRefreshCache)
+void TopNavigationViewDataProvider::SetWidthForItem(int index, float width)
+{
+    if (IsValidWidth(width))
     {
-        InvalidWidthCache();
+        SetAttachedWidth(index, width);
     }
 }
 
-void TopNavigationViewDataProvider::SetWidthForItem(int index, float width)
+void TopNavigationViewDataProvider::SetAttachedWidth(int index, float width)
 {
-    if (IsValidWidth(width))
+    auto oldWidth = OverflowWidthForItem(index);
+    AttachedData(index, width);
+    UpdateOverflowWidthTree(index, OverflowWidthForItem(index) - oldWidth);
+}
+
+float TopNavigationViewDataProvider::OverflowWidthForItem(int index)
+{
+    return IsItemInPrimaryList(index) ? 0.f : GetWidthForItem(index);
+}
+
+void TopNavigationViewDataProvider::EnsureOverflowWidthTree()
+{
+    if (!m_isOverflowWidthTreeValid)
+    {
+        int size = RawDataSize();
+        m_overflowWidthTree.assign(size + 1, 0.f);
+        for (int i = 1; i <= size; i++)
+        {
+            m_overflowWidthTree[i] += OverflowWidthForItem(i - 1);
+            int parent = i + (i & -i);
+            if (parent <= size)
+            {
+                m_overflowWidthTree[parent] += m_overflowWidthTree[i];
+            }
+        }
+        m_isOverflowWidthTreeValid = true;
+    }
+}
+
+void TopNavigationViewDataProvider::UpdateOverflowWidthTree(int index, float delta)
+{
+    if (m_isOverflowWidthTreeValid && delta != 0.f)
     {
-        AttachedData(index, width);
+        int size = static_cast<int>(m_overflowWidthTree.size()) - 1;
+        for (int i = index + 1; i <= size; i += i & -i)
+        {
+            m_overflowWidthTree[i] += delta;
+        }
     }
 }
 
+void TopNavigationViewDataProvider::InvalidateOverflowWidthTree()
+{
+    m_isOverflowWidthTreeValid = false;
+}
+
 void TopNavigationViewDataProvider::ChangeDataSource(winrt::ItemsSourceView newValue)
 {
     auto oldValue = m_dataSource.get();
@@ -360,6 +478,7 @@ void TopNavigationViewDataProvider::ChangeDataSource(winrt::ItemsSourceView newV
         }
 
         Clear();
+        InvalidateOverflowWidthTree();
 
         m_dataSource.set(newValue);
         SyncAndInitVectorFlagsWithID(NotInitialized, DefaultAttachedData());
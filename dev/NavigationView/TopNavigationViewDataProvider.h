@@ -53,6 +53,10 @@ public:
 
     void UpdateWidthForPrimaryItem(int indexInPrimary, float width);
     float WidthRequiredToRecoveryAllItemsToPrimary();
+    // Returns the first item outside of the primary list at which the widths of the items outside of the
+    // primary list, summed in index order, reach width. Returns Size() if their total stays below width.
+    // excludeItems are left out of the sum.
+    int FindFirstOverflowItemReachingWidth(float width, std::vector<int> const& excludeItems);
     float CalculateWidthForItems(std::vector<int> &items);
     float GetWidthForItem(int index);
     void InvalidWidthCache();
@@ -61,9 +65,15 @@ public:
     bool IsItemInPrimaryList(int index);
     bool HasInvalidWidth(std::vector<int> & items);
     bool IsValidWidthForItem(int index);
+    // True if every item outside of the primary list has a width that was actually measured
+    bool HasMeasuredWidthForAllOverflowItems();
 
     void InvalidWidthCacheIfOverflowItemContentChanged();
 
+    // Hide SplitDataSourceBase::ResetAttachedData so the overflow width tree is rebuilt afterwards
+    void ResetAttachedData();
+    void ResetAttachedData(float width);
+
     // If value is not in the raw data set or can't be move to primarylist, then return false
     bool IsItemSelectableInPrimaryList(const winrt::IInspectable& value);
 protected:
@@ -72,6 +82,11 @@ protected:
 private:
     bool IsValidWidth(float width);
     void SetWidthForItem(int index, float width);
+    void SetAttachedWidth(int index, float width);
+    float OverflowWidthForItem(int index);
+    void EnsureOverflowWidthTree();
+    void UpdateOverflowWidthTree(int index, float delta);
+    void InvalidateOverflowWidthTree();
     void ChangeDataSource(winrt::ItemsSourceView dataSource);
     bool IsContainerNavigationViewItem(int index);
     bool IsContainerNavigationViewHeader(int index);
@@ -83,5 +98,10 @@ private:
     winrt::event_token m_dataSourceChanged{};
     std::function<void(const winrt::NotifyCollectionChangedEventArgs& args)> m_dataChangeCallback;
     float m_overflowButtonCachedWidth{};
+
+    // Fenwick tree over the item indexes which holds the cached width of every item that is not in the
+    // primary list. It is rebuilt lazily when the items or the whole width cache change.
+    std::vector<float> m_overflowWidthTree{};
+    bool m_isOverflowWidthTreeValid{ false };
 };
 
@@ -333,7 +333,8 @@ void ParallaxView::UpdateChild(const winrt::UIElement& oldChild, const winrt::UI
     }
 }
 
-// Sets up the internal composition property set that tracks the animated source start & end offsets.
+// Sets up the internal composition property sets that track the animated source start & end offsets,
+// and the tunable values consumed by the expression animations.
 void ParallaxView::EnsureAnimatedVariables()
 {
     if (!m_animatedVariables && m_targetVisual)
@@ -343,12 +344,73 @@ void ParallaxView::EnsureAnimatedVariables()
         m_animatedVariables.InsertScalar(L"HorizontalSourceEndOffset", 0.0f);
         m_animatedVariables.InsertScalar(L"VerticalSourceStartOffset", 0.0f);
         m_animatedVariables.InsertScalar(L"VerticalSourceEndOffset", 0.0f);
+
+        m_expressionParameters = m_targetVisual.Compositor().CreatePropertySet();
+    }
+}
+
+// Returns the name of a tunable value inside m_expressionParameters, like "HorizontalShift".
+std::wstring ParallaxView::GetExpressionParameterName(winrt::Orientation orientation, wstring_view name)
+{
+    return (orientation == winrt::Orientation::Horizontal ? L"Horizontal" : L"Vertical") + static_cast<std::wstring>(name);
+}
+
+// Returns the reference to a tunable value used in expression strings, like "parameters.HorizontalShift".
+std::wstring ParallaxView::GetExpressionParameterReference(winrt::Orientation orientation, wstring_view name)
+{
+    return L"parameters." + GetExpressionParameterName(orientation, name);
+}
+
+// Updates a tunable value. Running expression animations pick it up without being restarted.
+void ParallaxView::SetExpressionParameter(winrt::Orientation orientation, wstring_view name, float value)
+{
+    m_expressionParameters.InsertScalar(GetExpressionParameterName(orientation, name), value);
+}
+
+// Records the source property set referenced by the expression animations. When it changed,
+// the animations need to be restarted since reference parameters are captured at start time.
+void ParallaxView::UpdateExpressionSource()
+{
+    winrt::CompositionPropertySet sourcePropertySet = m_scrollInputHelper ? m_scrollInputHelper->SourcePropertySet() : nullptr;
+
+    if (m_expressionSource != sourcePropertySet)
+    {
+        m_expressionSource = sourcePropertySet;
+        m_isHorizontalSourceStartOffsetAnimationStarted = m_isHorizontalSourceEndOffsetAnimationStarted = false;
+        m_isVerticalSourceStartOffsetAnimationStarted = m_isVerticalSourceEndOffsetAnimationStarted = false;
+        m_isHorizontalParallaxExpressionStale = m_isVerticalParallaxExpressionStale = true;
+    }
+}
+
+// Starts the provided animation on m_animatedVariables, only when its expression or source changed since it was last started.
+void ParallaxView::StartOffsetAnimation(
+    const winrt::ExpressionAnimation& offsetExpressionAnimation,
+    const std::wstring& offsetExpression,
+    wstring_view animatedVariableName,
+    bool& isAnimationStarted)
+{
+    if (offsetExpressionAnimation.Expression() != offsetExpression)
+    {
+        offsetExpressionAnimation.Expression(offsetExpression);
+        isAnimationStarted = false;
+    }
+
+    if (!isAnimationStarted)
+    {
+        offsetExpressionAnimation.SetReferenceParameter(L"source", m_scrollInputHelper->SourcePropertySet());
+        offsetExpressionAnimation.SetReferenceParameter(L"parameters", m_expressionParameters);
+
+        m_animatedVariables.StopAnimation(animatedVariableName);
+        m_animatedVariables.StartAnimation(animatedVariableName, offsetExpressionAnimation);
+        isAnimationStarted = true;
     }
 }
 
 // Updates the composition animation for the source start offset.
 void ParallaxView::UpdateStartOffsetExpression(winrt::Orientation orientation)
 {
+    UpdateExpressionSource();
+
     if (m_scrollInputHelper && m_scrollInputHelper->SourcePropertySet() && m_animatedVariables &&
         ((orientation == winrt::Orientation::Horizontal && HorizontalShift() != 0.0) ||
         (orientation == winrt::Orientation::Vertical && VerticalShift() != 0.0)))
@@ -372,40 +434,41 @@ void ParallaxView::UpdateStartOffsetExpression(winrt::Orientation orientation)
             startOffsetExpressionAnimation = m_verticalSourceStartOffsetExpression;
         }
 
+        // The expression only depends on the offset kind and on the target being inside the source or not.
+        // All other values are fed through m_expressionParameters so that they can be updated without
+        // re-parsing and restarting the animation.
+        const std::wstring scale = L"source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName());
+        const std::wstring startOffset = GetExpressionParameterReference(orientation, L"SourceStartOffset");
+        const std::wstring maxUnderpanOffset = GetExpressionParameterReference(orientation, L"MaxUnderpanOffset");
         std::wstring startOffsetExpression;
-        float startOffset = static_cast<float>(orientation == winrt::Orientation::Horizontal ? HorizontalSourceStartOffset() : VerticalSourceStartOffset());
 
-        startOffsetExpressionAnimation.SetScalarParameter(L"startOffset", startOffset);
+        SetExpressionParameter(orientation, L"SourceStartOffset", static_cast<float>(orientation == winrt::Orientation::Horizontal ? HorizontalSourceStartOffset() : VerticalSourceStartOffset()));
 
         if ((orientation == winrt::Orientation::Horizontal && HorizontalSourceOffsetKind() == winrt::ParallaxSourceOffsetKind::Relative) ||
             (orientation == winrt::Orientation::Vertical && VerticalSourceOffsetKind() == winrt::ParallaxSourceOffsetKind::Relative))
         {
             // Horizontal/VerticalSourceStartOffset is added to automatic value
 
-            float maxUnderpanOffset = static_cast<float>(m_scrollInputHelper->GetMaxUnderpanOffset(orientation));
-
-            startOffsetExpressionAnimation.SetScalarParameter(L"maxUnderpanOffset", maxUnderpanOffset);
+            SetExpressionParameter(orientation, L"MaxUnderpanOffset", static_cast<float>(m_scrollInputHelper->GetMaxUnderpanOffset(orientation)));
 
             if (m_scrollInputHelper->IsTargetElementInSource())
             {
                 // Target is inside the scroller.
 
                 // startOffset = (ParallaxViewOffset + HorizontalSourceStartOffset) * ZoomFactor - ViewportWidth - MaxUnderpanOffset
-                float parallaxViewOffset = static_cast<float>(m_scrollInputHelper->GetOffsetFromScrollContentElement(*this, orientation));
-                float viewportSize = static_cast<float>(m_scrollInputHelper->GetViewportSize(orientation));
+                const std::wstring parallaxViewOffset = GetExpressionParameterReference(orientation, L"ParallaxViewOffset");
+                const std::wstring viewportSize = GetExpressionParameterReference(orientation, L"ViewportSize");
 
-                startOffsetExpression = L"(parallaxViewOffset + startOffset) * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L" - viewportSize - maxUnderpanOffset";
-                startOffsetExpressionAnimation.SetScalarParameter(L"parallaxViewOffset", static_cast<float>(parallaxViewOffset));
-                startOffsetExpressionAnimation.SetScalarParameter(L"viewportSize", static_cast<float>(viewportSize));
-                startOffsetExpressionAnimation.SetReferenceParameter(L"source", m_scrollInputHelper->SourcePropertySet());
+                startOffsetExpression = L"(" + parallaxViewOffset + L" + " + startOffset + L") * " + scale + L" - " + viewportSize + L" - " + maxUnderpanOffset;
+                SetExpressionParameter(orientation, L"ParallaxViewOffset", static_cast<float>(m_scrollInputHelper->GetOffsetFromScrollContentElement(*this, orientation)));
+                SetExpressionParameter(orientation, L"ViewportSize", static_cast<float>(m_scrollInputHelper->GetViewportSize(orientation)));
             }
             else
             {
                 // Target is outside the scroller.
 
                 // startOffset = HorizontalSourceStartOffset * ZoomFactor - MaxUnderpanOffset
-                startOffsetExpression = L"startOffset * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L" - maxUnderpanOffset";
-                startOffsetExpressionAnimation.SetReferenceParameter(L"source", m_scrollInputHelper->SourcePropertySet());
+                startOffsetExpression = startOffset + L" * " + scale + L" - " + maxUnderpanOffset;
             }
         }
         else
@@ -416,30 +479,22 @@ void ParallaxView::UpdateStartOffsetExpression(winrt::Orientation orientation)
             //   startOffset = HorizontalSourceStartOffset
             // Else
             //   startOffset = HorizontalSourceStartOffset * ZoomFactor
-            if (startOffset > 0.0f)
-            {
-                startOffsetExpression = L"startOffset * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName());
-                startOffsetExpressionAnimation.SetReferenceParameter(L"source", m_scrollInputHelper->SourcePropertySet());
-            }
-            else
-            {
-                startOffsetExpression = L"startOffset";
-            }
+            startOffsetExpression = L"(" + startOffset + L" > 0.0f) ? " + startOffset + L" * " + scale + L" : " + startOffset;
         }
 
-        if (startOffsetExpressionAnimation.Expression() != startOffsetExpression)
-        {
-            startOffsetExpressionAnimation.Expression(startOffsetExpression);
-        }
-
-        m_animatedVariables.StopAnimation((orientation == winrt::Orientation::Horizontal) ? L"HorizontalSourceStartOffset" : L"VerticalSourceStartOffset");
-        m_animatedVariables.StartAnimation((orientation == winrt::Orientation::Horizontal) ? L"HorizontalSourceStartOffset" : L"VerticalSourceStartOffset", startOffsetExpressionAnimation);
+        StartOffsetAnimation(
+            startOffsetExpressionAnimation,
+            startOffsetExpression,
+            (orientation == winrt::Orientation::Horizontal) ? L"HorizontalSourceStartOffset" : L"VerticalSourceStartOffset",
+            (orientation == winrt::Orientation::Horizontal) ? m_isHorizontalSourceStartOffsetAnimationStarted : m_isVerticalSourceStartOffsetAnimationStarted);
     }
 }
 
 // Updates the composition animation for the source end offset.
 void ParallaxView::UpdateEndOffsetExpression(winrt::Orientation orientation)
 {
+    UpdateExpressionSource();
+
     if (m_scrollInputHelper && m_scrollInputHelper->SourcePropertySet() && m_animatedVariables &&
         ((orientation == winrt::Orientation::Horizontal && HorizontalShift() != 0.0) ||
         (orientation == winrt::Orientation::Vertical && VerticalShift() != 0.0)))
@@ -463,53 +518,51 @@ void ParallaxView::UpdateEndOffsetExpression(winrt::Orientation orientation)
             endOffsetExpressionAnimation = m_verticalSourceEndOffsetExpression;
         }
 
+        // Like for the start offset, the expression only depends on the offset kind and on the target
+        // being inside the source or not. All other values are fed through m_expressionParameters.
+        const std::wstring scale = L"source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName());
+        const std::wstring endOffset = GetExpressionParameterReference(orientation, L"SourceEndOffset");
+        const std::wstring viewportSize = GetExpressionParameterReference(orientation, L"ViewportSize");
+        const std::wstring contentSize = GetExpressionParameterReference(orientation, L"ContentSize");
         std::wstring endOffsetExpression;
-        float endOffset = static_cast<float>(orientation == winrt::Orientation::Horizontal ? HorizontalSourceEndOffset() : VerticalSourceEndOffset());
 
-        endOffsetExpressionAnimation.SetScalarParameter(L"endOffset", endOffset);
-        endOffsetExpressionAnimation.SetReferenceParameter(L"source", m_scrollInputHelper->SourcePropertySet());
+        SetExpressionParameter(orientation, L"SourceEndOffset", static_cast<float>(orientation == winrt::Orientation::Horizontal ? HorizontalSourceEndOffset() : VerticalSourceEndOffset()));
 
         if ((orientation == winrt::Orientation::Horizontal && HorizontalSourceOffsetKind() == winrt::ParallaxSourceOffsetKind::Relative) ||
             (orientation == winrt::Orientation::Vertical && VerticalSourceOffsetKind() == winrt::ParallaxSourceOffsetKind::Relative))
         {
             // Horizontal/VerticalSourceEndOffset is added to automatic value
 
-            float maxOverpanOffset = static_cast<float>(m_scrollInputHelper->GetMaxOverpanOffset(orientation));
+            const std::wstring maxOverpanOffset = GetExpressionParameterReference(orientation, L"MaxOverpanOffset");
 
-            endOffsetExpressionAnimation.SetScalarParameter(L"maxOverpanOffset", maxOverpanOffset);
+            SetExpressionParameter(orientation, L"MaxOverpanOffset", static_cast<float>(m_scrollInputHelper->GetMaxOverpanOffset(orientation)));
 
             if (m_scrollInputHelper->IsTargetElementInSource())
             {
                 // Target is inside the scroller.
 
                 // endOffset = (ParallaxViewOffset + ParallaxViewWidth + HorizontalSourceEndOffset) * ZoomFactor + MaxOverpanOffset
-                float parallaxViewOffset = static_cast<float>(m_scrollInputHelper->GetOffsetFromScrollContentElement(*this, orientation));
-                float parallaxViewSize = static_cast<float>(orientation == winrt::Orientation::Horizontal ? ActualWidth() : ActualHeight());
+                const std::wstring parallaxViewOffset = GetExpressionParameterReference(orientation, L"ParallaxViewOffset");
+                const std::wstring parallaxViewSize = GetExpressionParameterReference(orientation, L"ParallaxViewSize");
 
-                endOffsetExpression = L"(parallaxViewOffset + parallaxViewSize + endOffset) * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L" + maxOverpanOffset";
-                endOffsetExpressionAnimation.SetScalarParameter(L"parallaxViewOffset", parallaxViewOffset);
-                endOffsetExpressionAnimation.SetScalarParameter(L"parallaxViewSize", parallaxViewSize);
+                endOffsetExpression = L"(" + parallaxViewOffset + L" + " + parallaxViewSize + L" + " + endOffset + L") * " + scale + L" + " + maxOverpanOffset;
+                SetExpressionParameter(orientation, L"ParallaxViewOffset", static_cast<float>(m_scrollInputHelper->GetOffsetFromScrollContentElement(*this, orientation)));
+                SetExpressionParameter(orientation, L"ParallaxViewSize", static_cast<float>(orientation == winrt::Orientation::Horizontal ? ActualWidth() : ActualHeight()));
             }
             else
             {
                 // Target is outside the scroller.
 
-                float viewportSize = static_cast<float>(m_scrollInputHelper->GetViewportSize(orientation));
-                float contentSize = static_cast<float>(m_scrollInputHelper->GetContentSize(orientation));
-
                 // endOffset = Max(0, (ContentWidth + HorizontalSourceEndOffset) * ZoomFactor - ViewportWidth) + MaxOverpanOffset
-                endOffsetExpression = L"Max(0.0f, (contentSize + endOffset) * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L" - viewportSize) + maxOverpanOffset";
-                endOffsetExpressionAnimation.SetScalarParameter(L"viewportSize", viewportSize);
-                endOffsetExpressionAnimation.SetScalarParameter(L"contentSize", contentSize);
+                endOffsetExpression = L"Max(0.0f, (" + contentSize + L" + " + endOffset + L") * " + scale + L" - " + viewportSize + L") + " + maxOverpanOffset;
+                SetExpressionParameter(orientation, L"ViewportSize", static_cast<float>(m_scrollInputHelper->GetViewportSize(orientation)));
+                SetExpressionParameter(orientation, L"ContentSize", static_cast<float>(m_scrollInputHelper->GetContentSize(orientation)));
             }
         }
         else
         {
             // Horizontal/VerticalSourceEndOffset is an absolute value
 
-            float viewportSize = static_cast<float>(m_scrollInputHelper->GetViewportSize(orientation));
-            float contentSize = static_cast<float>(m_scrollInputHelper->GetContentSize(orientation));
-
             // If (ContentWidth > ViewportWidth) Then
             //   If (HorizontalSourceEndOffset <= ContentWidth - ViewportWidth) Then
             //     endOffset = Max(0, HorizontalSourceEndOffset * ZoomFactor)
@@ -520,41 +573,24 @@ void ParallaxView::UpdateEndOffsetExpression(winrt::Orientation orientation)
             //     endOffset = Max(0, (ContentWith + HorizontalSourceEndOffset) * ZoomFactor - ViewportWidth)
             //   Else
             //     endOffset = Max(0, ContentWidth * ZoomFactor - ViewportWidth) + HorizontalSourceEndOffset
-            if (contentSize > viewportSize)
-            {
-                if (endOffset <= contentSize - viewportSize)
-                {
-                    endOffsetExpression = L"Max(0.0f, endOffset * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L")";
-                }
-                else
-                {
-                    endOffsetExpression = L"Max(0.0f, (contentSize - viewportSize) * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L") + endOffset - contentSize + viewportSize";
-                    endOffsetExpressionAnimation.SetScalarParameter(L"contentSize", contentSize);
-                    endOffsetExpressionAnimation.SetScalarParameter(L"viewportSize", viewportSize);
-                }
-            }
-            else
-            {
-                if (endOffset <= 0.0f)
-                {
-                    endOffsetExpression = L"Max(0.0f, (contentSize + endOffset) * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L" - viewportSize)";
-                }
-                else
-                {
-                    endOffsetExpression = L"Max(0.0f, contentSize * source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceScalePropertyName()) + L" - viewportSize) + endOffset";
-                }
-                endOffsetExpressionAnimation.SetScalarParameter(L"contentSize", contentSize);
-                endOffsetExpressionAnimation.SetScalarParameter(L"viewportSize", viewportSize);
-            }
-        }
-
-        if (endOffsetExpressionAnimation.Expression() != endOffsetExpression)
-        {
-            endOffsetExpressionAnimation.Expression(endOffsetExpression);
+            // The conditions are evaluated by the expression itself so that size changes do not alter it.
+            endOffsetExpression =
+                L"(" + contentSize + L" > " + viewportSize + L") ? " +
+                    L"((" + endOffset + L" <= " + contentSize + L" - " + viewportSize + L") ? " +
+                        L"Max(0.0f, " + endOffset + L" * " + scale + L") : " +
+                        L"Max(0.0f, (" + contentSize + L" - " + viewportSize + L") * " + scale + L") + " + endOffset + L" - " + contentSize + L" + " + viewportSize + L") : " +
+                    L"((" + endOffset + L" <= 0.0f) ? " +
+                        L"Max(0.0f, (" + contentSize + L" + " + endOffset + L") * " + scale + L" - " + viewportSize + L") : " +
+                        L"Max(0.0f, " + contentSize + L" * " + scale + L" - " + viewportSize + L") + " + endOffset + L")";
+            SetExpressionParameter(orientation, L"ViewportSize", static_cast<float>(m_scrollInputHelper->GetViewportSize(orientation)));
+            SetExpressionParameter(orientation, L"ContentSize", static_cast<float>(m_scrollInputHelper->GetContentSize(orientation)));
         }
 
-        m_animatedVariables.StopAnimation((orientation == winrt::Orientation::Horizontal) ? L"HorizontalSourceEndOffset" : L"VerticalSourceEndOffset");
-        m_animatedVariables.StartAnimation((orientation == winrt::Orientation::Horizontal) ? L"HorizontalSourceEndOffset" : L"VerticalSourceEndOffset", endOffsetExpressionAnimation);
+        StartOffsetAnimation(
+            endOffsetExpressionAnimation,
+            endOffsetExpression,
+            (orientation == winrt::Orientation::Horizontal) ? L"HorizontalSourceEndOffset" : L"VerticalSourceEndOffset",
+            (orientation == winrt::Orientation::Horizontal) ? m_isHorizontalSourceEndOffsetAnimationStarted : m_isVerticalSourceEndOffsetAnimationStarted);
     }
 }
 
@@ -573,6 +609,7 @@ void ParallaxView::UpdateExpressionAnimation(winrt::Orientation orientation)
         if (m_targetVisual != targetVisual)
         {
             m_targetVisual = targetVisual;
+            m_isHorizontalParallaxExpressionStale = m_isVerticalParallaxExpressionStale = true;
             if (IsVisualTranslationPropertyAvailable())
             {
                 winrt::ElementCompositionPreview::SetIsTranslationEnabled(m_scrollInputHelper->TargetElement(), true);
@@ -663,9 +700,16 @@ void ParallaxView::UpdateExpressionAnimation(winrt::Orientation orientation)
             std::wstring source = L"source." + static_cast<std::wstring>(m_scrollInputHelper->GetSourceOffsetPropertyName(orientation));
             std::wstring startOffset = (orientation == winrt::Orientation::Horizontal) ? L"animatedVariables.HorizontalSourceStartOffset" : L"animatedVariables.VerticalSourceStartOffset";
             std::wstring endOffset = (orientation == winrt::Orientation::Horizontal) ? L"animatedVariables.HorizontalSourceEndOffset" : L"animatedVariables.VerticalSourceEndOffset";
+            const std::wstring maxRatio = GetExpressionParameterReference(orientation, L"MaxRatio");
+            const std::wstring shiftParameter = GetExpressionParameterReference(orientation, L"Shift");
             std::wstring parallaxExpression;
             float shift = (float)(orientation == winrt::Orientation::Horizontal ? HorizontalShift() : VerticalShift());
 
+            // The shift and max ratio values are read from m_expressionParameters so that changing them does not
+            // require restarting the animation, unless the sign of the shift changes.
+            SetExpressionParameter(orientation, L"MaxRatio", static_cast<float>(max(0.0, (orientation == winrt::Orientation::Horizontal ? MaxHorizontalShiftRatio() : MaxVerticalShiftRatio()))));
+            SetExpressionParameter(orientation, L"Shift", shift);
+
             if ((orientation == winrt::Orientation::Horizontal && IsHorizontalShiftClamped()) ||
                 (orientation == winrt::Orientation::Vertical && IsVerticalShiftClamped()))
             {
@@ -678,21 +722,21 @@ void ParallaxView::UpdateExpressionAnimation(winrt::Orientation orientation)
 
                     // startOffset < X < endOffset --> P(X) = -Min(MaxRatio, shift / (endOffset - startOffset)) * (X - startOffset)
                     parallaxExpression += L"((-" + static_cast<std::wstring>(source) + L" < " + static_cast<std::wstring>(endOffset) + L") ? ";
-                    parallaxExpression += L"(-Min(maxRatio, (shift / (" + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L"))) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(startOffset) + L")) : ";
+                    parallaxExpression += L"(-Min(" + maxRatio + L", (" + shiftParameter + L" / (" + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L"))) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(startOffset) + L")) : ";
 
                     // X >= endOffset --> P(X) = -Min(MaxRatio * Max(0 , endOffset - startOffset), shift)
-                    parallaxExpression += L"-Min(maxRatio * Max(0.0f, " + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L"), shift))";
+                    parallaxExpression += L"-Min(" + maxRatio + L" * Max(0.0f, " + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L"), " + shiftParameter + L"))";
                 }
                 else
                 {
                     // shift < 0.0
 
                     // X <= startOffset --> P(X) = -Min(MaxRatio * Max(0 , endOffset - startOffset), -shift)
-                    parallaxExpression = L"(-" + static_cast<std::wstring>(source) + L" <= " + static_cast<std::wstring>(startOffset) + L") ? -Min(maxRatio * Max(0.0f, " + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L"), -shift) : ";
+                    parallaxExpression = L"(-" + static_cast<std::wstring>(source) + L" <= " + static_cast<std::wstring>(startOffset) + L") ? -Min(" + maxRatio + L" * Max(0.0f, " + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L"), -" + shiftParameter + L") : ";
 
                     // startOffset < X < endOffset --> P(X) = Min(MaxRatio, shift / (startOffset - endOffset)) * (X - endOffset)
                     parallaxExpression += L"((-" + static_cast<std::wstring>(source) + L" < " + static_cast<std::wstring>(endOffset) + L") ? ";
-                    parallaxExpression += L"(Min(maxRatio, (shift / (" + static_cast<std::wstring>(startOffset) + L" - " + static_cast<std::wstring>(endOffset) + L"))) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(endOffset) + L")) : ";
+                    parallaxExpression += L"(Min(" + maxRatio + L", (" + shiftParameter + L" / (" + static_cast<std::wstring>(startOffset) + L" - " + static_cast<std::wstring>(endOffset) + L"))) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(endOffset) + L")) : ";
 
                     // X >= endOffset --> P(X) = 0
                     parallaxExpression += L"0.0f)";
@@ -708,7 +752,7 @@ void ParallaxView::UpdateExpressionAnimation(winrt::Orientation orientation)
                     parallaxExpression = L"(" + static_cast<std::wstring>(startOffset) + L" == " + static_cast<std::wstring>(endOffset) + L") ? 0.0f : ";
 
                     // startOffset != endOffset --> P(X) = -Min(MaxRatio, shift / (endOffset - startOffset)) * (X - startOffset)
-                    parallaxExpression += L"-Min(maxRatio, shift / (" + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L")) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(startOffset) + L")";
+                    parallaxExpression += L"-Min(" + maxRatio + L", " + shiftParameter + L" / (" + static_cast<std::wstring>(endOffset) + L" - " + static_cast<std::wstring>(startOffset) + L")) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(startOffset) + L")";
                 }
                 else
                 {
@@ -716,10 +760,12 @@ void ParallaxView::UpdateExpressionAnimation(winrt::Orientation orientation)
                     parallaxExpression = L"(" + static_cast<std::wstring>(startOffset) + L" == " + static_cast<std::wstring>(endOffset) + L") ? 0.0f : ";
 
                     // startOffset != endOffset --> P(X) = Min(MaxRatio, shift / (startOffset - endOffset)) * (X - endOffset)
-                    parallaxExpression += L"Min(maxRatio, shift / (" + static_cast<std::wstring>(startOffset) + L" - " + static_cast<std::wstring>(endOffset) + L")) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(endOffset) + L")";
+                    parallaxExpression += L"Min(" + maxRatio + L", " + shiftParameter + L" / (" + static_cast<std::wstring>(startOffset) + L" - " + static_cast<std::wstring>(endOffset) + L")) * (-" + static_cast<std::wstring>(source) + L" - " + static_cast<std::wstring>(endOffset) + L")";
                 }
             }
 
+            bool& isParallaxExpressionStale = (orientation == winrt::Orientation::Horizontal) ? m_isHorizontalParallaxExpressionStale : m_isVerticalParallaxExpressionStale;
+
             if (!parallaxExpressionInternal)
             {
                 parallaxExpressionInternal = m_targetVisual.Compositor().CreateExpressionAnimation(parallaxExpression);
@@ -731,16 +777,27 @@ void ParallaxView::UpdateExpressionAnimation(winrt::Orientation orientation)
                 {
                     m_verticalParallaxExpressionInternal = parallaxExpressionInternal;
                 }
+                isParallaxExpressionStale = true;
             }
             else if (parallaxExpressionInternal.Expression() != parallaxExpression)
             {
                 parallaxExpressionInternal.Expression(parallaxExpression);
+                isParallaxExpressionStale = true;
+            }
+
+            // When only parameter values changed, the running animation already reflects them.
+            if (orientation == winrt::Orientation::Horizontal ? m_isHorizontalAnimationStarted : m_isVerticalAnimationStarted)
+            {
+                if (!isParallaxExpressionStale)
+                {
+                    return;
+                }
             }
 
             parallaxExpressionInternal.SetReferenceParameter(L"source", m_scrollInputHelper->SourcePropertySet());
             parallaxExpressionInternal.SetReferenceParameter(L"animatedVariables", m_animatedVariables);
-            parallaxExpressionInternal.SetScalarParameter(L"maxRatio", static_cast<float>(max(0.0, (orientation == winrt::Orientation::Horizontal ? MaxHorizontalShiftRatio() : MaxVerticalShiftRatio()))));
-            parallaxExpressionInternal.SetScalarParameter(L"shift", shift);
+            parallaxExpressionInternal.SetReferenceParameter(L"parameters", m_expressionParameters);
+            isParallaxExpressionStale = false;
 
             if (orientation == winrt::Orientation::Horizontal)
             {
@@ -37,8 +37,17 @@ public:
 private:
     static bool IsVisualTranslationPropertyAvailable();
     static wstring_view GetVisualTargetedPropertyName(winrt::Orientation orientation);
+    static std::wstring GetExpressionParameterName(winrt::Orientation orientation, wstring_view name);
+    static std::wstring GetExpressionParameterReference(winrt::Orientation orientation, wstring_view name);
 
     void EnsureAnimatedVariables();
+    void SetExpressionParameter(winrt::Orientation orientation, wstring_view name, float value);
+    void UpdateExpressionSource();
+    void StartOffsetAnimation(
+        const winrt::ExpressionAnimation& offsetExpressionAnimation,
+        const std::wstring& offsetExpression,
+        wstring_view animatedVariableName,
+        bool& isAnimationStarted);
     void UpdateStartOffsetExpression(winrt::Orientation orientation);
     void UpdateEndOffsetExpression(winrt::Orientation orientation);
     void UpdateExpressionAnimation(winrt::Orientation orientation);
@@ -58,6 +67,8 @@ private:
     std::shared_ptr<ScrollInputHelper> m_scrollInputHelper{ nullptr };
     winrt::Visual m_targetVisual{ nullptr };
     winrt::CompositionPropertySet m_animatedVariables{ nullptr };
+    winrt::CompositionPropertySet m_expressionParameters{ nullptr };
+    winrt::CompositionPropertySet m_expressionSource{ nullptr };
     winrt::ExpressionAnimation m_horizontalSourceStartOffsetExpression{ nullptr };
     winrt::ExpressionAnimation m_horizontalSourceEndOffsetExpression{ nullptr };
     winrt::ExpressionAnimation m_verticalSourceStartOffsetExpression{ nullptr };
@@ -66,6 +77,12 @@ private:
     winrt::ExpressionAnimation m_verticalParallaxExpressionInternal{ nullptr };
     bool m_isHorizontalAnimationStarted{ false };
     bool m_isVerticalAnimationStarted{ false };
+    bool m_isHorizontalSourceStartOffsetAnimationStarted{ false };
+    bool m_isHorizontalSourceEndOffsetAnimationStarted{ false };
+    bool m_isVerticalSourceStartOffsetAnimationStarted{ false };
+    bool m_isVerticalSourceEndOffsetAnimationStarted{ false };
+    bool m_isHorizontalParallaxExpressionStale{ false };
+    bool m_isVerticalParallaxExpressionStale{ false };
 
     // Event Tokens
     winrt::event_token m_loadedToken{ 0 };
@@ -0,0 +1,1499 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ScrollInputSource.h"
+#include "ScrollInputHelper.h"
+#include "Scroller.h"
+
+PCWSTR ScrollInputSource::s_horizontalOffsetPropertyName = L"TranslationX";
+PCWSTR ScrollInputSource::s_verticalOffsetPropertyName = L"TranslationY";
+PCWSTR ScrollInputSource::s_scalePropertyName = L"Scale";
+
+// Sources currently used by ScrollInputHelper instances on this UI thread. An entry expires when the last consumer of that source goes away.
+static thread_local std::vector<std::weak_ptr<ScrollInputSource>> s_scrollInputSources;
+
+ScrollInputSource::ScrollInputSource(const winrt::UIElement& sourceElement)
+{
+    MUX_ASSERT(sourceElement);
+
+    m_sourceElement = winrt::make_weak(sourceElement);
+
+    winrt::Control sourceAsControl = sourceElement.try_as<winrt::Control>();
+    winrt::FxScrollViewer sourceAsScrollViewer = sourceElement.try_as<winrt::FxScrollViewer>();
+
+    if (sourceAsControl && !sourceAsScrollViewer)
+    {
+        HookSourceControlTemplateChanged();
+    }
+
+    ProcessSourceElementChange(true /*allowSourceElementLoadedHookup*/);
+}
+
+ScrollInputSource::~ScrollInputSource()
+{
+    MUX_ASSERT(m_consumers.empty());
+
+    UnhookScrollerPropertyChanged();
+    UnhookScrollerContentPropertyChanged();
+    UnhookScrollViewerPropertyChanged();
+    UnhookScrollViewerContentPropertyChanged();
+    UnhookScrollViewerDirectManipulationStarted();
+    UnhookScrollViewerDirectManipulationCompleted();
+    UnhookRichEditBoxTextChanged();
+    UnhookSourceControlTemplateChanged();
+    UnhookSourceElementLoaded();
+    UnhookLayoutUpdated();
+}
+
+std::shared_ptr<ScrollInputSource> ScrollInputSource::GetForSourceElement(const winrt::UIElement& sourceElement)
+{
+    MUX_ASSERT(sourceElement);
+
+    auto& sources = s_scrollInputSources;
+
+    sources.erase(
+        std::remove_if(sources.begin(), sources.end(), [](const std::weak_ptr<ScrollInputSource>& source) { return source.expired(); }),
+        sources.end());
+
+    for (const auto& weakSource : sources)
+    {
+        if (auto source = weakSource.lock())
+        {
+            if (source->SourceElement() == sourceElement)
+            {
+                return source;
+            }
+        }
+    }
+
+    auto source = std::make_shared<ScrollInputSource>(sourceElement);
+    sources.push_back(source);
+    return source;
+}
+
+void ScrollInputSource::AddConsumer(ScrollInputHelper* consumer)
+{
+    MUX_ASSERT(std::find(m_consumers.begin(), m_consumers.end(), consumer) == m_consumers.end());
+
+    m_consumers.push_back(consumer);
+}
+
+void ScrollInputSource::RemoveConsumer(ScrollInputHelper* consumer)
+{
+    m_consumers.erase(std::remove(m_consumers.begin(), m_consumers.end(), consumer), m_consumers.end());
+}
+
+winrt::UIElement ScrollInputSource::SourceElement() const
+{
+    return m_sourceElement.get();
+}
+
+winrt::FxScrollViewer ScrollInputSource::GetScrollViewer() const
+{
+    return m_scrollViewer.get();
+}
+
+winrt::Scroller ScrollInputSource::GetScroller() const
+{
+    return m_scroller.get();
+}
+
+// Returns the property set shared by all consumers, or null when no inner ScrollViewer or Scroller was found yet.
+winrt::CompositionPropertySet ScrollInputSource::SourcePropertySet() const
+{
+    return (m_scroller.get() || m_scrollViewer.get()) ? m_internalSourcePropertySet : nullptr;
+}
+
+// Returns the offset of the scrolled element in relation to its owning source.
+double ScrollInputSource::GetOffsetFromScrollContentElement(const winrt::UIElement& element, winrt::Orientation orientation) const
+{
+    winrt::UIElement scrollContentElement = GetScrollContentElement();
+
+    if (!scrollContentElement)
+    {
+        return 0.0;
+    }
+
+    winrt::GeneralTransform gt = element.TransformToVisual(scrollContentElement);
+    winrt::Windows::Foundation::Point elementOffset = gt.TransformPoint(winrt::Windows::Foundation::Point(0, 0));
+
+    return orientation == winrt::Orientation::Horizontal ? elementOffset.X : elementOffset.Y;
+}
+
+double ScrollInputSource::GetMaxUnderpanOffset(winrt::Orientation orientation) const
+{
+    return (orientation == winrt::Orientation::Horizontal) ? m_outOfBoundsPanSize.Width : m_outOfBoundsPanSize.Height;
+}
+
+double ScrollInputSource::GetMaxOverpanOffset(winrt::Orientation orientation) const
+{
+    return (orientation == winrt::Orientation::Horizontal) ? m_outOfBoundsPanSize.Width : m_outOfBoundsPanSize.Height;
+}
+
+double ScrollInputSource::GetContentSize(winrt::Orientation orientation) const
+{
+    return (orientation == winrt::Orientation::Horizontal) ? m_contentSize.Width : m_contentSize.Height;
+}
+
+double ScrollInputSource::GetViewportSize(winrt::Orientation orientation) const
+{
+    return (orientation == winrt::Orientation::Horizontal) ? m_viewportSize.Width : m_viewportSize.Height;
+}
+
+void ScrollInputSource::SetScrollViewer(const winrt::FxScrollViewer& scrollViewer)
+{
+    if (scrollViewer != m_scrollViewer.get())
+    {
+        if (m_scrollViewer.get())
+        {
+            UnhookScrollViewerPropertyChanged();
+            UnhookScrollViewerDirectManipulationStarted();
+            UnhookScrollViewerDirectManipulationCompleted();
+            UnhookRichEditBoxTextChanged();
+
+            m_richEditBox = nullptr;
+            m_scrollViewerPropertySet = nullptr;
+            m_isScrollViewerInDirectManipulation = false;
+        }
+
+        m_scrollViewer = scrollViewer ? winrt::make_weak(scrollViewer) : nullptr;
+
+        if (scrollViewer)
+        {
+            // Check if the ScrollViewer belongs to a RichEditBox so content size changes can be detected 
+            // via its TextChanged event.
+            winrt::RichEditBox richEditBox = ScrollInputSource::GetRichEditBoxParent(scrollViewer);
+            m_richEditBox = richEditBox ? winrt::make_weak(richEditBox) : nullptr;
+
+            HookScrollViewerPropertyChanged();
+            HookScrollViewerDirectManipulationStarted();
+            HookScrollViewerDirectManipulationCompleted();
+            HookRichEditBoxTextChanged();
+
+            m_scrollViewerPropertySet = winrt::ElementCompositionPreview::GetScrollViewerManipulationPropertySet(scrollViewer);
+        }
+
+        ProcessScrollViewerContentChange();
+    }
+}
+
+void ScrollInputSource::SetScroller(const winrt::Scroller& scroller)
+{
+    if (scroller != m_scroller.get())
+    {
+        if (m_scroller.get())
+        {
+            UnhookScrollerPropertyChanged();
+        }
+
+        m_scroller = scroller ? winrt::make_weak(scroller) : nullptr;
+
+        if (scroller)
+        {
+            HookScrollerPropertyChanged();
+        }
+
+        ProcessScrollerContentChange();
+    }
+}
+
+// Returns the parent RichEditBox if any.
+winrt::RichEditBox ScrollInputSource::GetRichEditBoxParent(const winrt::DependencyObject& childElement)
+{
+    if (childElement)
+    {
+        winrt::DependencyObject parent = winrt::VisualTreeHelper::GetParent(childElement);
+        if (parent)
+        {
+            winrt::RichEditBox richEditBoxParent = parent.try_as<winrt::RichEditBox>();
+            if (richEditBoxParent)
+            {
+                return richEditBoxParent;
+            }
+            return ScrollInputSource::GetRichEditBoxParent(parent);
+        }
+    }
+
+    return nullptr;
+}
+
+// Returns the inner ScrollViewer or Scroller if any.
+void ScrollInputSource::GetChildScrollerOrScrollViewer(
+    const winrt::DependencyObject& rootElement,
+    _Out_ winrt::Scroller* scroller,
+    _Out_ winrt::FxScrollViewer* scrollViewer)
+{
+    *scroller = nullptr;
+    *scrollViewer = nullptr;
+
+    if (rootElement)
+    {
+        int childCount = winrt::VisualTreeHelper::GetChildrenCount(rootElement);
+        for (int i = 0; i < childCount; i++)
+        {
+            winrt::DependencyObject current = winrt::VisualTreeHelper::GetChild(rootElement, i);
+            *scrollViewer = current.try_as<winrt::FxScrollViewer>();
+            if (*scrollViewer)
+            {
+                return;
+            }
+            *scroller = current.try_as<winrt::Scroller>();
+            if (*scroller)
+            {
+                return;
+            }
+        }
+
+        for (int i = 0; i < childCount; i++)
+        {
+            winrt::DependencyObject current = winrt::VisualTreeHelper::GetChild(rootElement, i);
+            ScrollInputSource::GetChildScrollerOrScrollViewer(
+                current,
+                scroller,
+                scrollViewer);
+            if (*scroller)
+            {
+                return;
+            }
+            if (*scrollViewer)
+            {
+                return;
+            }
+        }
+    }
+}
+
+// Returns the ScrollViewer content as a UIElement, if any. Or Scroller.Content, if any.
+winrt::UIElement ScrollInputSource::GetScrollContentElement() const
+{
+    if (auto scrollViewer = m_scrollViewer.get())
+    {
+        winrt::IInspectable content = scrollViewer.Content();
+        if (content)
+        {
+            return content.try_as<winrt::UIElement>();
+        }
+    }
+    else if (auto scroller = m_scroller.get())
+    {
+        return scroller.Content();
+    }
+    return nullptr;
+}
+
+// Returns the effective horizontal alignment of the ScrollViewer content.
+winrt::HorizontalAlignment ScrollInputSource::GetEffectiveHorizontalAlignment() const
+{
+    if (m_isScrollViewerInDirectManipulation)
+    {
+        return m_manipulationHorizontalAlignment;
+    }
+    else
+    {
+        return ComputeHorizontalContentAlignment();
+    }
+}
+
+// Returns the effective vertical alignment of the ScrollViewer content.
+winrt::VerticalAlignment ScrollInputSource::GetEffectiveVerticalAlignment() const
+{
+    if (m_isScrollViewerInDirectManipulation)
+    {
+        return m_manipulationVerticalAlignment;
+    }
+    else
+    {
+        return ComputeVerticalContentAlignment();
+    }
+}
+
+// Returns the effective zoom mode of the ScrollViewer.
+winrt::FxZoomMode ScrollInputSource::GetEffectiveZoomMode() const
+{
+    if (m_isScrollViewerInDirectManipulation)
+    {
+        return m_manipulationZoomMode;
+    }
+    else
+    {
+        return ComputeZoomMode();
+    }
+}
+
+// Updates the m_outOfBoundsPanSize field based on the viewport size and zoom mode.
+void ScrollInputSource::UpdateOutOfBoundsPanSize()
+{
+    if (m_scroller.get() || m_scrollViewer.get())
+    {
+        double viewportWith = GetViewportSize(winrt::Orientation::Horizontal);
+        double viewportHeight = GetViewportSize(winrt::Orientation::Vertical);
+
+        if (m_scrollViewer.get() && GetEffectiveZoomMode() == winrt::FxZoomMode::Disabled)
+        {
+            // A ScrollViewer can under/overpan up to 10% of its viewport size
+            m_outOfBoundsPanSize.Width = static_cast<float>(0.1 * viewportWith);
+            m_outOfBoundsPanSize.Height = static_cast<float>(0.1 * viewportHeight);
+        }
+        else
+        {
+            // When zooming is allowed for a ScrollViewer, or in general for the Scroller,
+            // the content can be pushed all the way to the edge of the screen with two fingers,
+            // but we limit the offset to one viewport size.
+            // Note that if in the future, the Scroller's underpan & overpan limits become customizable,
+            // its ExpressionAnimationSources property set will have to expose those custom limits.
+            // The values would then be consumed here for a more accurate ParallaxView behavior.
+            m_outOfBoundsPanSize.Width = static_cast<float>(viewportWith);
+            m_outOfBoundsPanSize.Height = static_cast<float>(viewportHeight);
+        }
+    }
+    else
+    {
+        m_outOfBoundsPanSize.Width = m_outOfBoundsPanSize.Height = 0.0f;
+    }
+}
+
+// Updates the m_contentSize field.
+void ScrollInputSource::UpdateContentSize()
+{
+    m_contentSize.Width = m_contentSize.Height = 0.0f;
+    auto scroller = m_scroller.get();
+
+    if (!scroller && !m_scrollViewer.get())
+    {
+        return;
+    }
+
+    if (scroller)
+    {
+        winrt::CompositionPropertySet scrollerPropertySet = scroller.ExpressionAnimationSources();
+        winrt::float2 extent{};
+
+        winrt::CompositionGetValueStatus status = scrollerPropertySet.TryGetVector2(Scroller::s_extentSourcePropertyName, extent);
+        if (status == winrt::CompositionGetValueStatus::Succeeded)
+        {
+            m_contentSize.Width = extent.x;
+            m_contentSize.Height = extent.y;
+        }
+        return;
+    }
+    auto scrollViewer = m_scrollViewer.get();
+    float extentWidth = static_cast<float>(scrollViewer.ExtentWidth());
+    float extentHeight = static_cast<float>(scrollViewer.ExtentHeight());
+
+    winrt::UIElement scrollContentElement = GetScrollContentElement();
+    winrt::ItemsPresenter itemsPresenter = scrollContentElement ? (scrollContentElement.try_as<winrt::ItemsPresenter>()) : nullptr;
+
+    if (!scrollContentElement || !itemsPresenter)
+    {
+        m_contentSize.Width = extentWidth;
+        m_contentSize.Height = extentHeight;
+        return;
+    }
+
+    int childrenCount = winrt::VisualTreeHelper::GetChildrenCount(itemsPresenter);
+
+    if (childrenCount > 0)
+    {
+        winrt::DependencyObject child = winrt::VisualTreeHelper::GetChild(itemsPresenter, childrenCount == 1 ? 0 : 1);
+
+        if (child)
+        {
+            winrt::VirtualizingStackPanel virtualizingStackPanel = child.try_as<winrt::VirtualizingStackPanel>();
+
+            if (virtualizingStackPanel)
+            {
+                // VirtualizingStackPanel are handled specially because the ScrollViewer.ExtentWidth/ExtentHeight is unit-based instead
+                // of pixel-based in the virtualized dimension. The computed size accounts for the potential margins, header and footer.
+                double virtualizingSize = 0.0;
+                winrt::Thickness vspMargin = virtualizingStackPanel.Margin();
+                winrt::Thickness itMargin = itemsPresenter.Margin();
+
+                if (virtualizingStackPanel.Orientation() == winrt::Orientation::Horizontal)
+                {
+                    virtualizingSize = virtualizingStackPanel.ExtentWidth() * virtualizingStackPanel.ActualWidth() / virtualizingStackPanel.ViewportWidth() +
+                        vspMargin.Left + vspMargin.Right + itMargin.Left + itMargin.Right;
+                }
+                else
+                {
+                    virtualizingSize = virtualizingStackPanel.ExtentHeight() * virtualizingStackPanel.ActualHeight() / virtualizingStackPanel.ViewportHeight() +
+                        vspMargin.Top + vspMargin.Bottom + itMargin.Top + itMargin.Bottom;
+                }
+
+                if (childrenCount > 1)
+                {
+                    child = winrt::VisualTreeHelper::GetChild(itemsPresenter, 0);
+
+                    if (child)
+                    {
+                        winrt::FrameworkElement headerChild = child.try_as<winrt::FrameworkElement>();
+
+                        if (headerChild)
+                        {
+                            virtualizingSize += virtualizingStackPanel.Orientation() == winrt::Orientation::Horizontal ? headerChild.ActualWidth() : headerChild.ActualHeight();
+                        }
+                    }
+                }
+
+                if (childrenCount > 2)
+                {
+                    child = winrt::VisualTreeHelper::GetChild(itemsPresenter, 2);
+
+                    if (child)
+                    {
+                        winrt::FrameworkElement footerChild = child.try_as<winrt::FrameworkElement>();
+
+                        if (footerChild)
+                        {
+                            virtualizingSize += virtualizingStackPanel.Orientation() == winrt::Orientation::Horizontal ? footerChild.ActualWidth() : footerChild.ActualHeight();
+                        }
+                    }
+                }
+
+                if (virtualizingStackPanel.Orientation() == winrt::Orientation::Horizontal)
+                {
+                    m_contentSize.Width = static_cast<float>(virtualizingSize);
+                    m_contentSize.Height = extentHeight;
+                }
+                else
+                {
+                    m_contentSize.Width = extentWidth;
+                    m_contentSize.Height = static_cast<float>(virtualizingSize);
+                }
+
+                return;
+            }
+        }
+    }
+
+    m_contentSize.Width = extentWidth;
+    m_contentSize.Height = extentHeight;
+}
+
+// Updates the m_viewportSize field.
+void ScrollInputSource::UpdateViewportSize()
+{
+    auto scroller = m_scroller.get();
+    if (scroller)
+    {
+        winrt::CompositionPropertySet scrollerPropertySet = scroller.ExpressionAnimationSources();
+        winrt::float2 viewport{};
+
+        winrt::CompositionGetValueStatus status = scrollerPropertySet.TryGetVector2(Scroller::s_viewportSourcePropertyName, viewport);
+        if (status == winrt::CompositionGetValueStatus::Succeeded)
+        {
+            m_viewportSize.Width = viewport.x;
+            m_viewportSize.Height = viewport.y;
+        }
+        return;
+    }
+
+    if (m_scrollViewer.get())
+    {
+        auto scrollViewer = m_scrollViewer.get();
+        winrt::UIElement scrollContentElement = GetScrollContentElement();
+
+        if (scrollContentElement)
+        {
+            winrt::ItemsPresenter itemsPresenter = scrollContentElement.try_as<winrt::ItemsPresenter>();
+
+            if (itemsPresenter)
+            {
+                int childrenCount = winrt::VisualTreeHelper::GetChildrenCount(itemsPresenter);
+
+                if (childrenCount > 0)
+                {
+                    winrt::DependencyObject child = winrt::VisualTreeHelper::GetChild(itemsPresenter, childrenCount == 1 ? 0 : 1);
+
+                    if (child)
+                    {
+                        winrt::VirtualizingStackPanel virtualizingStackPanel = child.try_as<winrt::VirtualizingStackPanel>();
+
+                        if (virtualizingStackPanel)
+                        {
+                            // VirtualizingStackPanel are handled specially because the ScrollViewer.ViewportWidth/ViewportHeight is unit-based instead
+                            // of pixel-based in the virtualized dimension. The computed size accounts for the potential margins.
+                            winrt::Thickness itMargin = itemsPresenter.Margin();
+
+                            if (virtualizingStackPanel.Orientation() == winrt::Orientation::Horizontal)
+                            {
+                                m_viewportSize.Width = static_cast<float>(itemsPresenter.ActualWidth() + itMargin.Left + itMargin.Right);
+                                m_viewportSize.Height = static_cast<float>(scrollViewer.ViewportHeight());
+                            }
+                            else
+                            {
+                                m_viewportSize.Width = static_cast<float>(scrollViewer.ViewportWidth());
+                                m_viewportSize.Height = static_cast<float>(itemsPresenter.ActualHeight() + itMargin.Top + itMargin.Bottom);
+                            }
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+        m_viewportSize.Width = static_cast<float>(scrollViewer.ViewportWidth());
+        m_viewportSize.Height = static_cast<float>(scrollViewer.ViewportHeight());
+    }
+    else
+    {
+        m_viewportSize.Width = m_viewportSize.Height = 0.0f;
+    }
+}
+
+// Updates all the fields dependent on the ScrollViewer source. Stops/starts
+// the internal composition animations.
+void ScrollInputSource::UpdateSource(bool allowSourceElementLoadedHookup)
+{
+    winrt::Scroller scroller = nullptr;
+    winrt::FxScrollViewer scrollViewer = nullptr;
+    auto sourceElement = m_sourceElement.get();
+    if (sourceElement)
+    {
+        scroller = sourceElement.try_as<winrt::Scroller>();
+        scrollViewer = sourceElement.try_as<winrt::FxScrollViewer>();
+    }
+
+    if (scroller || scrollViewer)
+    {
+        SetScroller(scroller);
+        SetScrollViewer(scrollViewer);
+    }
+    else if (sourceElement)
+    {
+        ScrollInputSource::GetChildScrollerOrScrollViewer(
+            sourceElement,
+            &scroller,
+            &scrollViewer);
+        SetScroller(scroller);
+        SetScrollViewer(scrollViewer);
+    }
+    else
+    {
+        SetScroller(nullptr);
+        SetScrollViewer(nullptr);
+    }
+
+    if (allowSourceElementLoadedHookup && 
+        !scroller &&
+        !m_scrollViewer.get())
+    {
+        HookSourceElementLoaded();
+    }
+
+    if (!scroller && !m_scrollViewer.get())
+    {
+        StopInternalExpressionAnimations();
+    }
+    else
+    {
+        StartInternalExpressionAnimations(m_scrollViewer.get() ? m_scrollViewerPropertySet : scroller.ExpressionAnimationSources());
+    }
+
+    UpdateContentSize();
+    UpdateViewportSize();
+    UpdateOutOfBoundsPanSize();
+}
+
+// Updates the m_manipulationZoomMode field.
+void ScrollInputSource::UpdateManipulationZoomMode()
+{
+    m_manipulationZoomMode = ComputeZoomMode();
+}
+
+// Updates the m_manipulationHorizontalAlignment/m_manipulationVerticalAlignment fields.
+void ScrollInputSource::UpdateManipulationAlignments()
+{
+    m_manipulationHorizontalAlignment = ComputeHorizontalContentAlignment();
+    m_manipulationVerticalAlignment = ComputeVerticalContentAlignment();
+}
+
+// Updates the internal composition animations that account for the alignment portions in the ScrollViewer's manipulation property set (m_scrollViewerPropertySet).
+// The offsets exposed by m_internalSourcePropertySet exclude those alignment portions.
+void ScrollInputSource::UpdateInternalExpressionAnimations(bool horizontalInfoChanged, bool verticalInfoChanged, bool zoomInfoChanged)
+{
+    bool restartAnimations = false;
+ 
+    if (m_scrollViewer.get())
+    {
+        if (horizontalInfoChanged && m_internalTranslationXExpressionAnimation)
+        {
+            switch (GetEffectiveHorizontalAlignment())
+            {
+            case winrt::HorizontalAlignment::Left:
+                m_internalTranslationXExpressionAnimation.Expression(L"source.Translation.X");
+                break;
+
+            case winrt::HorizontalAlignment::Stretch:
+            case winrt::HorizontalAlignment::Center:
+                m_internalTranslationXExpressionAnimation.Expression(
+                    L"source.Translation.X + ((contentWidth * source.Scale.X - viewportWidth) < 0.0f ? (contentWidth * source.Scale.X - viewportWidth) / 2.0f : 0.0f)");
+                m_internalTranslationXExpressionAnimation.SetScalarParameter(L"contentWidth", static_cast<float>(GetContentSize(winrt::Orientation::Horizontal)));
+                m_internalTranslationXExpressionAnimation.SetScalarParameter(L"viewportWidth", static_cast<float>(GetViewportSize(winrt::Orientation::Horizontal)));
+                break;
+
+            case winrt::HorizontalAlignment::Right:
+                m_internalTranslationXExpressionAnimation.Expression(L"source.Translation.X + ((contentWidth * source.Scale.X - viewportWidth) < 0.0f ? (contentWidth * source.Scale.X - viewportWidth) : 0.0f)");
+                m_internalTranslationXExpressionAnimation.SetScalarParameter(L"contentWidth", static_cast<float>(GetContentSize(winrt::Orientation::Horizontal)));
+                m_internalTranslationXExpressionAnimation.SetScalarParameter(L"viewportWidth", static_cast<float>(GetViewportSize(winrt::Orientation::Horizontal)));
+                break;
+            }
+            restartAnimations = true;
+        }
+
+        if (verticalInfoChanged && m_internalTranslationYExpressionAnimation)
+        {
+            switch (GetEffectiveVerticalAlignment())
+            {
+            case winrt::VerticalAlignment::Top:
+                m_internalTranslationYExpressionAnimation.Expression(L"source.Translation.Y");
+                break;
+
+            case winrt::VerticalAlignment::Stretch:
+            case winrt::VerticalAlignment::Center:
+                m_internalTranslationYExpressionAnimation.Expression(
+                    L"source.Translation.Y + ((contentWidth * source.Scale.Y - viewportWidth) < 0.0f ? (contentWidth * source.Scale.Y - viewportWidth) / 2.0f : 0.0f)");
+                m_internalTranslationYExpressionAnimation.SetScalarParameter(L"contentWidth", static_cast<float>(GetContentSize(winrt::Orientation::Vertical)));
+                m_internalTranslationYExpressionAnimation.SetScalarParameter(L"viewportWidth", static_cast<float>(GetViewportSize(winrt::Orientation::Vertical)));
+                break;
+
+            case winrt::VerticalAlignment::Bottom:
+                m_internalTranslationYExpressionAnimation.Expression(
+                    L"source.Translation.Y + ((contentWidth * source.Scale.Y - viewportWidth) < 0.0f ? (contentWidth * source.Scale.Y - viewportWidth) : 0.0f)");
+                m_internalTranslationYExpressionAnimation.SetScalarParameter(L"contentWidth", static_cast<float>(GetContentSize(winrt::Orientation::Vertical)));
+                m_internalTranslationYExpressionAnimation.SetScalarParameter(L"viewportWidth", static_cast<float>(GetViewportSize(winrt::Orientation::Vertical)));
+                break;
+            }
+            restartAnimations = true;
+        }
+
+        if (zoomInfoChanged && m_internalScaleExpressionAnimation)
+        {
+            m_internalScaleExpressionAnimation.Expression(L"source.Scale.X");
+            restartAnimations = true;
+        }
+
+        if (restartAnimations)
+        {
+            StartInternalExpressionAnimations(m_scrollViewerPropertySet);
+        }
+    }
+    else if (auto scroller = m_scroller.get())
+    {
+        if (horizontalInfoChanged && m_internalTranslationXExpressionAnimation)
+        {
+            m_internalTranslationXExpressionAnimation.Expression(L"source.MinPosition.X - source.Position.X");
+            restartAnimations = true;
+        }
+        if (verticalInfoChanged && m_internalTranslationYExpressionAnimation)
+        {
+            m_internalTranslationYExpressionAnimation.Expression(L"source.MinPosition.Y - source.Position.Y");
+            restartAnimations = true;
+        }
+
+        if (zoomInfoChanged && m_internalScaleExpressionAnimation)
+        {
+            m_internalScaleExpressionAnimation.Expression(L"source.ZoomFactor");
+            restartAnimations = true;
+        }
+
+        if (restartAnimations)
+        {
+            StartInternalExpressionAnimations(scroller.ExpressionAnimationSources());
+        }
+    }
+}
+
+// Returns the ScrollViewer's content horizontal alignment.
+winrt::HorizontalAlignment ScrollInputSource::ComputeHorizontalContentAlignment() const
+{
+    // Panels that implement XAML's internal IScrollInfo interface: OrientedVirtualizingPanel, CarouselPanel, TextBoxView for TextBox, RichTextBox and PasswordBox.
+
+    winrt::HorizontalAlignment horizontalAlignment = winrt::HorizontalAlignment::Stretch;
+
+    // First access the ScrollViewer's HorizontalContentAlignment
+    if (m_scrollViewer.get())
+    {
+        horizontalAlignment = m_scrollViewer.get().HorizontalContentAlignment();
+
+        // Determine whether the ScrollContentPresenter is the IScrollInfo implementer or not
+        if (IsScrollContentPresenterIScrollInfoProvider())
+        {
+            // When the ScrollContentPresenter is the IScrollInfo implementer,
+            // use the horizontal alignment of the manipulated element by default.
+            winrt::UIElement scrollContentElement = GetScrollContentElement();
+
+            if (scrollContentElement)
+            {
+                winrt::FrameworkElement contentAsFrameworkElement = scrollContentElement.try_as<winrt::FrameworkElement>();
+
+                if (contentAsFrameworkElement)
+                {
+                    horizontalAlignment = contentAsFrameworkElement.HorizontalAlignment();
+                }
+            }
+        }
+    }
+
+    return horizontalAlignment;
+}
+
+// Returns the ScrollViewer's content vertical alignment.
+winrt::VerticalAlignment ScrollInputSource::ComputeVerticalContentAlignment() const
+{
+    // Panels that implement XAML's internal IScrollInfo interface: OrientedVirtualizingPanel, CarouselPanel, TextBoxView for TextBox, RichTextBox and PasswordBox.
+
+    winrt::VerticalAlignment verticalAlignment = winrt::VerticalAlignment::Stretch;
+
+    // First access the ScrollViewer's VerticalContentAlignment
+    if (m_scrollViewer.get())
+    {
+        verticalAlignment = m_scrollViewer.get().VerticalContentAlignment();
+
+        // Determine whether the ScrollContentPresenter is the IScrollInfo implementer or not
+        if (IsScrollContentPresenterIScrollInfoProvider())
+        {
+            // When the ScrollContentPresenter is the IScrollInfo implementer,
+            // use the vertical alignment of the manipulated element by default.
+            winrt::UIElement scrollContentElement = GetScrollContentElement();
+
+            if (scrollContentElement)
+            {
+                winrt::FrameworkElement contentAsFrameworkElement = scrollContentElement.try_as<winrt::FrameworkElement>();
+
+                if (contentAsFrameworkElement)
+                {
+                    verticalAlignment = contentAsFrameworkElement.VerticalAlignment();
+                }
+            }
+        }
+    }
+
+    return verticalAlignment;
+}
+
+winrt::FxZoomMode ScrollInputSource::ComputeZoomMode() const
+{
+    return m_scrollViewer.get() ? m_scrollViewer.get().ZoomMode() : winrt::FxZoomMode::Disabled;
+}
+
+// Determines whether the ScrollViewer's ScrollContentPresenter is the IScrollInfo implementer used by the ScrollViewer.
+bool ScrollInputSource::IsScrollContentPresenterIScrollInfoProvider() const
+{
+    if (m_scrollViewer.get())
+    {
+        winrt::UIElement scrollContentElement = GetScrollContentElement();
+
+        if (scrollContentElement)
+        {
+            winrt::ItemsPresenter itemsPresenter = scrollContentElement.try_as<winrt::ItemsPresenter>();
+
+            if (itemsPresenter)
+            {
+                int childrenCount = winrt::VisualTreeHelper::GetChildrenCount(itemsPresenter);
+
+                if (childrenCount > 0)
+                {
+                    winrt::DependencyObject child = winrt::VisualTreeHelper::GetChild(itemsPresenter, childrenCount == 1 ? 0 : 1);
+
+                    if (child)
+                    {
+                        winrt::OrientedVirtualizingPanel itemsPanelAsOrientedVirtualizingPanel = child.try_as<winrt::OrientedVirtualizingPanel>();
+                        winrt::CarouselPanel itemsPanelAsCarouselPanel = child.try_as<winrt::CarouselPanel>();
+
+                        if (itemsPanelAsOrientedVirtualizingPanel || itemsPanelAsCarouselPanel)
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+// Creates the internal composition property set, m_internalSourcePropertySet, that filters out the alignment portions of the ScrollViewer manipulation property set.
+void ScrollInputSource::EnsureInternalSourcePropertySetAndExpressionAnimations(const winrt::Compositor& compositor)
+{
+    if (!m_internalSourcePropertySet && compositor)
+    {
+        m_internalSourcePropertySet = compositor.CreatePropertySet();
+        m_internalSourcePropertySet.InsertScalar(s_horizontalOffsetPropertyName, 0.0f);
+        m_internalSourcePropertySet.InsertScalar(s_verticalOffsetPropertyName, 0.0f);
+        m_internalSourcePropertySet.InsertScalar(s_scalePropertyName, 1.0f);
+
+        auto scrollViewer = m_scrollViewer.get();
+        m_internalTranslationXExpressionAnimation = compositor.CreateExpressionAnimation(scrollViewer ? L"source.Translation.X" : L"source.MinPosition.X - source.Position.X");
+        m_internalTranslationYExpressionAnimation = compositor.CreateExpressionAnimation(scrollViewer ? L"source.Translation.Y" : L"source.MinPosition.Y - source.Position.Y");
+        m_internalScaleExpressionAnimation = compositor.CreateExpressionAnimation(scrollViewer ? L"source.Scale.X" : L"source.ZoomFactor");
+
+        // Account for the current alignments and start the animations when the source is already known.
+        UpdateInternalExpressionAnimations(true /*horizontalInfoChanged*/, true /*verticalInfoChanged*/, true /*zoomInfoChanged*/);
+    }
+}
+
+// Starts the animations targeting the properties inside m_internalSourcePropertySet.
+void ScrollInputSource::StartInternalExpressionAnimations(const winrt::CompositionPropertySet& source)
+{
+    if (m_internalSourcePropertySet && source)
+    {
+        m_internalTranslationXExpressionAnimation.SetReferenceParameter(L"source", source);
+        m_internalTranslationYExpressionAnimation.SetReferenceParameter(L"source", source);
+        m_internalScaleExpressionAnimation.SetReferenceParameter(L"source", source);
+
+        m_internalSourcePropertySet.StopAnimation(s_horizontalOffsetPropertyName);
+        m_internalSourcePropertySet.StopAnimation(s_verticalOffsetPropertyName);
+        m_internalSourcePropertySet.StopAnimation(s_scalePropertyName);
+
+        m_internalSourcePropertySet.StartAnimation(s_horizontalOffsetPropertyName, m_internalTranslationXExpressionAnimation);
+        m_internalSourcePropertySet.StartAnimation(s_verticalOffsetPropertyName, m_internalTranslationYExpressionAnimation);
+        m_internalSourcePropertySet.StartAnimation(s_scalePropertyName, m_internalScaleExpressionAnimation);
+    }
+}
+
+// Stops the animations targeting the properties inside m_internalSourcePropertySet.
+void ScrollInputSource::StopInternalExpressionAnimations()
+{
+    if (m_internalSourcePropertySet)
+    {
+        m_internalSourcePropertySet.StopAnimation(s_horizontalOffsetPropertyName);
+        m_internalSourcePropertySet.StopAnimation(s_verticalOffsetPropertyName);
+        m_internalSourcePropertySet.StopAnimation(s_scalePropertyName);
+
+        m_internalSourcePropertySet.InsertScalar(s_horizontalOffsetPropertyName, 0.0f);
+        m_internalSourcePropertySet.InsertScalar(s_verticalOffsetPropertyName, 0.0f);
+        m_internalSourcePropertySet.InsertScalar(s_scalePropertyName, 1.0f);
+    }
+}
+
+void ScrollInputSource::ProcessSourceElementChange(bool allowSourceElementLoadedHookup)
+{
+    winrt::CompositionPropertySet oldSourcePropertySet = SourcePropertySet();
+    winrt::FxScrollViewer oldScrollViewer = m_scrollViewer.get();
+    winrt::Scroller oldScroller = m_scroller.get();
+    double oldViewportWidth = GetViewportSize(winrt::Orientation::Horizontal);
+    double oldViewportHeight = GetViewportSize(winrt::Orientation::Vertical);
+    double oldContentWidth = GetContentSize(winrt::Orientation::Horizontal);
+    double oldContentHeight = GetContentSize(winrt::Orientation::Vertical);
+    double oldUnderpanWidth = GetMaxUnderpanOffset(winrt::Orientation::Horizontal);
+    double oldUnderpanHeight = GetMaxUnderpanOffset(winrt::Orientation::Vertical);
+    double oldOverpanWidth = GetMaxOverpanOffset(winrt::Orientation::Horizontal);
+    double oldOverpanHeight = GetMaxOverpanOffset(winrt::Orientation::Vertical);
+
+    UnhookSourceElementLoaded();
+
+    UpdateSource(allowSourceElementLoadedHookup);
+
+    if (SourcePropertySet() != oldSourcePropertySet ||
+        m_scrollViewer.get() != oldScrollViewer ||
+        m_scroller.get() != oldScroller)
+    {
+        OnSourceInfoChanged(true /*horizontalInfoChanged*/, true /*verticalInfoChanged*/, true /*zoomInfoChanged*/);
+    }
+    else
+    {
+        bool horizontalInfoChanged =
+            oldViewportWidth != GetViewportSize(winrt::Orientation::Horizontal) ||
+            oldContentWidth != GetContentSize(winrt::Orientation::Horizontal) ||
+            oldUnderpanWidth != GetMaxUnderpanOffset(winrt::Orientation::Horizontal) ||
+            oldOverpanWidth != GetMaxOverpanOffset(winrt::Orientation::Horizontal);
+
+        bool verticalInfoChanged =
+            oldViewportHeight != GetViewportSize(winrt::Orientation::Vertical) ||
+            oldContentHeight != GetContentSize(winrt::Orientation::Vertical) ||
+            oldUnderpanHeight != GetMaxUnderpanOffset(winrt::Orientation::Vertical) ||
+            oldOverpanHeight != GetMaxOverpanOffset(winrt::Orientation::Vertical);
+
+        if (horizontalInfoChanged || verticalInfoChanged)
+        {
+            OnSourceInfoChanged(horizontalInfoChanged, verticalInfoChanged, true /*zoomInfoChanged*/);
+        }
+    }
+}
+
+// Invoked when the ScrollViewer.Content or Scroller.Content size changed.
+void ScrollInputSource::ProcessContentSizeChange()
+{
+    double oldContentWidth = GetContentSize(winrt::Orientation::Horizontal);
+    double oldContentHeight = GetContentSize(winrt::Orientation::Vertical);
+
+    UpdateContentSize();
+
+    double newContentWidth = GetContentSize(winrt::Orientation::Horizontal);
+    double newContentHeight = GetContentSize(winrt::Orientation::Vertical);
+
+    if (oldContentWidth != newContentWidth || oldContentHeight != newContentHeight)
+    {
+        OnSourceInfoChanged(oldContentWidth != newContentWidth, oldContentHeight != newContentHeight, false /*zoomInfoChanged*/);
+    }
+}
+
+// Invoked when the source is a Control other than a ScrollViewer, and its Template property changed.
+void ScrollInputSource::ProcessSourceControlTemplateChange()
+{
+    // Wait for the next layout pass so the new control template gets applied and the potential inner ScrollViewer can be set.
+    if (auto sourceElement = m_sourceElement.get())
+    {
+        HookLayoutUpdated(sourceElement.try_as<winrt::FrameworkElement>());
+    }
+}
+
+// Invoked when a source characteristic influencing the composition animations changed.
+void ScrollInputSource::OnSourceInfoChanged(bool horizontalInfoChanged, bool verticalInfoChanged, bool zoomInfoChanged)
+{
+    MUX_ASSERT(horizontalInfoChanged || verticalInfoChanged);
+
+    if (m_scroller.get() || m_scrollViewer.get())
+    {
+        UpdateInternalExpressionAnimations(horizontalInfoChanged, verticalInfoChanged, zoomInfoChanged);
+    }
+
+    // Let the ScrollInputHelper consumers know about the characteristic change too. A copy of the
+    // consumers is iterated over since they may unregister while handling the notification.
+    const std::vector<ScrollInputHelper*> consumers = m_consumers;
+
+    for (ScrollInputHelper* consumer : consumers)
+    {
+        if (std::find(m_consumers.begin(), m_consumers.end(), consumer) != m_consumers.end())
+        {
+            consumer->OnSourceInfoChanged(horizontalInfoChanged, verticalInfoChanged);
+        }
+    }
+}
+
+void ScrollInputSource::OnSourceElementLoaded(const winrt::IInspectable& /*sender*/, const winrt::RoutedEventArgs& /*args*/)
+{
+    UnhookSourceElementLoaded();
+    ProcessSourceElementChange(false /*allowSourceElementLoadedHookup*/);
+}
+
+void ScrollInputSource::OnSourceElementPropertyChanged(const winrt::DependencyObject& /*sender*/, const winrt::DependencyProperty& args)
+{
+    if (args == winrt::Control::TemplateProperty())
+    {
+        ProcessSourceControlTemplateChange();
+    }
+}
+
+void ScrollInputSource::ProcessScrollViewerContentChange()
+{
+    UnhookScrollViewerContentPropertyChanged();
+    
+    m_sourceContent = nullptr;
+
+    auto scrollViewer = m_scrollViewer.get();
+    if (scrollViewer)
+    {
+        winrt::IInspectable newContent = scrollViewer.Content();
+        winrt::FrameworkElement newContentAsFrameworkElement = newContent ? newContent.try_as<winrt::FrameworkElement>() : nullptr;
+
+        if (newContentAsFrameworkElement)
+        {
+            m_sourceContent = winrt::make_weak(newContentAsFrameworkElement);
+
+            HookScrollViewerContentPropertyChanged();
+        }
+    }
+
+    OnSourceInfoChanged(true /*horizontalInfoChanged*/, true /*verticalInfoChanged*/, true /*zoomInfoChanged*/);
+}
+
+void ScrollInputSource::ProcessScrollerContentChange()
+{
+    auto scroller = m_scroller.get();
+    UnhookScrollerContentPropertyChanged();
+
+    m_sourceContent = nullptr;
+
+    if (scroller)
+    {
+        winrt::UIElement newContent = scroller.Content();
+        winrt::FrameworkElement newContentAsFrameworkElement = newContent ? newContent.try_as<winrt::FrameworkElement>() : nullptr;
+
+        if (newContentAsFrameworkElement)
+        {
+            m_sourceContent = winrt::make_weak(newContentAsFrameworkElement);
+
+            HookScrollerContentPropertyChanged();
+        }
+    }
+
+    OnSourceInfoChanged(true /*horizontalInfoChanged*/, true /*verticalInfoChanged*/, true /*zoomInfoChanged*/);
+}
+
+void ScrollInputSource::ProcessScrollViewerZoomModeChange()
+{
+    UpdateOutOfBoundsPanSize();
+    OnSourceInfoChanged(true /*horizontalInfoChanged*/, true /*verticalInfoChanged*/, false /*zoomInfoChanged*/);
+}
+
+void ScrollInputSource::OnSourceSizeChanged(const winrt::IInspectable& /*sender*/, const winrt::SizeChangedEventArgs& /*args*/)
+{
+    double oldViewportWidth = GetViewportSize(winrt::Orientation::Horizontal);
+    double oldViewportHeight = GetViewportSize(winrt::Orientation::Vertical);
+    double oldUnderpanWidth = GetMaxUnderpanOffset(winrt::Orientation::Horizontal);
+    double oldUnderpanHeight = GetMaxUnderpanOffset(winrt::Orientation::Vertical);
+    double oldOverpanWidth = GetMaxOverpanOffset(winrt::Orientation::Horizontal);
+    double oldOverpanHeight = GetMaxOverpanOffset(winrt::Orientation::Vertical);
+
+    UpdateViewportSize();
+    UpdateOutOfBoundsPanSize();
+
+    bool horizontalInfoChanged =
+        oldViewportWidth != GetViewportSize(winrt::Orientation::Horizontal) ||
+        oldUnderpanWidth != GetMaxUnderpanOffset(winrt::Orientation::Horizontal) ||
+        oldOverpanWidth != GetMaxOverpanOffset(winrt::Orientation::Horizontal);
+
+    bool verticalInfoChanged =
+        oldViewportHeight != GetViewportSize(winrt::Orientation::Vertical) ||
+        oldUnderpanHeight != GetMaxUnderpanOffset(winrt::Orientation::Vertical) ||
+        oldOverpanHeight != GetMaxOverpanOffset(winrt::Orientation::Vertical);
+
+    if (horizontalInfoChanged || verticalInfoChanged)
+    {
+        OnSourceInfoChanged(horizontalInfoChanged, verticalInfoChanged, false /*zoomInfoChanged*/);
+    }
+}
+
+void ScrollInputSource::OnScrollViewerDirectManipulationStarted(const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/)
+{
+    // Alignment and zoom mode changes during a manipulation are ignored until the end of that manipulation.
+
+    m_isScrollViewerInDirectManipulation = true;
+
+    UpdateManipulationAlignments();
+    UpdateManipulationZoomMode();
+}
+
+void ScrollInputSource::OnScrollViewerDirectManipulationCompleted(const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/)
+{
+    // Alignment and zoom mode changes that occurred during this completed manipulation are now taken into account.
+
+    const winrt::HorizontalAlignment oldEffectiveHorizontalAlignment = GetEffectiveHorizontalAlignment();
+    const winrt::VerticalAlignment oldEffectiveVerticalAlignment = GetEffectiveVerticalAlignment();
+    const winrt::FxZoomMode oldZoomMode = GetEffectiveZoomMode();
+
+    m_isScrollViewerInDirectManipulation = false;
+
+    winrt::FxZoomMode newZoomMode = GetEffectiveZoomMode();
+
+    if (oldZoomMode != newZoomMode)
+    {
+        ProcessScrollViewerZoomModeChange();
+    }
+
+    winrt::HorizontalAlignment newEffectiveHorizontalAlignment = GetEffectiveHorizontalAlignment();
+    winrt::VerticalAlignment newEffectiveVerticalAlignment = GetEffectiveVerticalAlignment();
+
+    if (oldEffectiveHorizontalAlignment != newEffectiveHorizontalAlignment || oldEffectiveVerticalAlignment != newEffectiveVerticalAlignment)
+    {
+        UpdateInternalExpressionAnimations(
+            oldEffectiveHorizontalAlignment != newEffectiveHorizontalAlignment,
+            oldEffectiveVerticalAlignment != newEffectiveVerticalAlignment,
+            false /*zoomInfoChanged*/);
+    }
+}
+
+void ScrollInputSource::OnRichEditBoxTextChanged(const winrt::IInspectable& /*sender*/, const winrt::RoutedEventArgs& /*args*/)
+{
+    ProcessContentSizeChange();
+
+    // The ScrollViewer extent only reflects the new text after the next layout pass.
+    HookLayoutUpdated(m_richEditBox.get());
+}
+
+void ScrollInputSource::OnLayoutUpdated(const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/)
+{
+    // Unhook the LayoutUpdated event handler and attempt to find the potential new inner ScrollViewer,
+    // as well as its updated content and viewport sizes.
+    UnhookLayoutUpdated();
+    ProcessSourceElementChange(false /*allowSourceElementLoadedHookup*/);
+}
+
+void ScrollInputSource::OnSourceContentSizeChanged(const winrt::IInspectable& /*sender*/, const winrt::SizeChangedEventArgs& /*args*/)
+{
+    ProcessContentSizeChange();
+}
+
+// Invoked when a tracked dependency property changes for the ScrollViewer dependency object.
+void ScrollInputSource::OnScrollViewerPropertyChanged(const winrt::DependencyObject& /*sender*/, const winrt::DependencyProperty& args)
+{
+    if (args == winrt::ContentControl::ContentProperty())
+    {
+        ProcessScrollViewerContentChange();
+    }
+    else if (args == winrt::FxScrollViewer::ZoomModeProperty())
+    {
+        if (!m_isScrollViewerInDirectManipulation)
+        {
+            ProcessScrollViewerZoomModeChange();
+        }
+    }
+    else if (args == winrt::Control::HorizontalContentAlignmentProperty())
+    {
+        if (!m_isScrollViewerInDirectManipulation)
+        {
+            UpdateInternalExpressionAnimations(true /*horizontalInfoChanged*/, false /*verticalInfoChanged*/, false /*zoomInfoChanged*/);
+        }
+    }
+    else if (args == winrt::Control::VerticalContentAlignmentProperty())
+    {
+        if (!m_isScrollViewerInDirectManipulation)
+        {
+            UpdateInternalExpressionAnimations(false /*horizontalInfoChanged*/, true /*verticalInfoChanged*/, false /*zoomInfoChanged*/);
+        }
+    }
+}
+
+// Invoked when a tracked dependency property changes for the Scroller dependency object.
+void ScrollInputSource::OnScrollerPropertyChanged(const winrt::DependencyObject& /*sender*/, const winrt::DependencyProperty& args)
+{
+    if (args == winrt::Scroller::ContentProperty())
+    {
+        ProcessScrollerContentChange();
+    }
+}
+
+// Invoked when a tracked dependency property changes for the ScrollViewer.Content dependency object.
+void ScrollInputSource::OnScrollViewerContentPropertyChanged(const winrt::DependencyObject& /*sender*/, const winrt::DependencyProperty& args)
+{
+    if (args == winrt::FrameworkElement::HorizontalAlignmentProperty())
+    {
+        if (!m_isScrollViewerInDirectManipulation)
+        {
+            UpdateInternalExpressionAnimations(true /*horizontalInfoChanged*/, false /*verticalInfoChanged*/, false /*zoomInfoChanged*/);
+        }
+    }
+    else if (args == winrt::FrameworkElement::VerticalAlignmentProperty())
+    {
+        if (!m_isScrollViewerInDirectManipulation)
+        {
+            UpdateInternalExpressionAnimations(false /*horizontalInfoChanged*/, true /*verticalInfoChanged*/, false /*zoomInfoChanged*/);
+        }
+    }
+}
+
+void ScrollInputSource::HookSourceElementLoaded()
+{
+    auto sourceElement = m_sourceElement.get();
+    if (sourceElement && m_sourceElementLoadedToken.value == 0)
+    {
+        winrt::FrameworkElement sourceElementAsFrameworkElement = sourceElement.try_as<winrt::FrameworkElement>();
+
+        if (sourceElementAsFrameworkElement)
+        {
+            m_sourceElementLoadedToken = sourceElementAsFrameworkElement.Loaded({ this, &ScrollInputSource::OnSourceElementLoaded });
+        }
+    }
+}
+
+void ScrollInputSource::UnhookSourceElementLoaded()
+{
+    auto sourceElement = m_sourceElement.get();
+    if (sourceElement && m_sourceElementLoadedToken.value != 0)
+    {
+        winrt::FrameworkElement sourceElementAsFrameworkElement = sourceElement.try_as<winrt::FrameworkElement>();
+
+        if (sourceElementAsFrameworkElement)
+        {
+            sourceElementAsFrameworkElement.Loaded(m_sourceElementLoadedToken);
+            m_sourceElementLoadedToken.value = 0;
+        }
+    }
+}
+
+void ScrollInputSource::HookSourceControlTemplateChanged()
+{
+    auto sourceElement = m_sourceElement.get();
+    if (sourceElement && m_sourceControlTemplateChangedToken.value == 0)
+    {
+        m_sourceControlTemplateChangedToken.value = sourceElement.RegisterPropertyChangedCallback(
+            winrt::Control::TemplateProperty(), { this, &ScrollInputSource::OnSourceElementPropertyChanged });
+    }
+}
+
+void ScrollInputSource::UnhookSourceControlTemplateChanged()
+{
+    auto sourceElement = m_sourceElement.get();
+    if (sourceElement && m_sourceControlTemplateChangedToken.value != 0)
+    {
+        sourceElement.UnregisterPropertyChangedCallback(winrt::Control::TemplateProperty(), m_sourceControlTemplateChangedToken.value);
+        m_sourceControlTemplateChangedToken.value = 0;
+    }
+}
+
+void ScrollInputSource::HookScrollViewerPropertyChanged()
+{
+    auto scrollViewer = m_scrollViewer.get();
+    if (scrollViewer)
+    {
+        MUX_ASSERT(m_scrollViewerContentChangedToken.value == 0);
+        MUX_ASSERT(m_scrollViewerHorizontalContentAlignmentChangedToken.value == 0);
+        MUX_ASSERT(m_scrollViewerVerticalContentAlignmentChangedToken.value == 0);
+        MUX_ASSERT(m_scrollViewerZoomModeChangedToken.value == 0);
+        MUX_ASSERT(m_sourceSizeChangedToken.value == 0);
+
+        m_scrollViewerContentChangedToken.value = scrollViewer.RegisterPropertyChangedCallback(
+            winrt::ContentControl::ContentProperty(), { this, &ScrollInputSource::OnScrollViewerPropertyChanged });
+        m_scrollViewerHorizontalContentAlignmentChangedToken.value = scrollViewer.RegisterPropertyChangedCallback(
+            winrt::Control::HorizontalContentAlignmentProperty(), { this, &ScrollInputSource::OnScrollViewerPropertyChanged });
+        m_scrollViewerVerticalContentAlignmentChangedToken.value = scrollViewer.RegisterPropertyChangedCallback(
+            winrt::Control::VerticalContentAlignmentProperty(), { this, &ScrollInputSource::OnScrollViewerPropertyChanged });
+        m_scrollViewerZoomModeChangedToken.value = scrollViewer.RegisterPropertyChangedCallback(
+            winrt::FxScrollViewer::ZoomModeProperty(), { this, &ScrollInputSource::OnScrollViewerPropertyChanged });
+        m_sourceSizeChangedToken = scrollViewer.SizeChanged({ this, &ScrollInputSource::OnSourceSizeChanged });
+    }
+}
+
+void ScrollInputSource::HookScrollerPropertyChanged()
+{
+    auto scroller = m_scroller.get();
+
+    if (scroller)
+    {
+        MUX_ASSERT(m_scrollerContentChangedToken.value == 0);
+        MUX_ASSERT(m_sourceSizeChangedToken.value == 0);
+
+        m_scrollerContentChangedToken.value = scroller.RegisterPropertyChangedCallback(
+            winrt::Scroller::ContentProperty(), { this, &ScrollInputSource::OnScrollerPropertyChanged });
+        m_sourceSizeChangedToken = scroller.SizeChanged({ this, &ScrollInputSource::OnSourceSizeChanged });
+    }
+}
+
+// The tokens are reset even when the ScrollViewer is already gone, since its handlers went away with it.
+void ScrollInputSource::UnhookScrollViewerPropertyChanged()
+{
+    auto scrollViewer = m_scrollViewer.get();
+
+    if (m_scrollViewerContentChangedToken.value != 0)
+    {
+        if (scrollViewer)
+        {
+            scrollViewer.UnregisterPropertyChangedCallback(winrt::ContentControl::ContentProperty(), m_scrollViewerContentChangedToken.value);
+        }
+        m_scrollViewerContentChangedToken.value = 0;
+    }
+    if (m_scrollViewerHorizontalContentAlignmentChangedToken.value != 0)
+    {
+        if (scrollViewer)
+        {
+            scrollViewer.UnregisterPropertyChangedCallback(winrt::Control::HorizontalContentAlignmentProperty(), m_scrollViewerHorizontalContentAlignmentChangedToken.value);
+        }
+        m_scrollViewerHorizontalContentAlignmentChangedToken.value = 0;
+    }
+    if (m_scrollViewerVerticalContentAlignmentChangedToken.value != 0)
+    {
+        if (scrollViewer)
+        {
+            scrollViewer.UnregisterPropertyChangedCallback(winrt::Control::VerticalContentAlignmentProperty(), m_scrollViewerVerticalContentAlignmentChangedToken.value);
+        }
+        m_scrollViewerVerticalContentAlignmentChangedToken.value = 0;
+    }
+    if (m_scrollViewerZoomModeChangedToken.value != 0)
+    {
+        if (scrollViewer)
+        {
+            scrollViewer.UnregisterPropertyChangedCallback(winrt::FxScrollViewer::ZoomModeProperty(), m_scrollViewerZoomModeChangedToken.value);
+        }
+        m_scrollViewerZoomModeChangedToken.value = 0;
+    }
+    if (m_sourceSizeChangedToken.value != 0)
+    {
+        if (scrollViewer)
+        {
+            scrollViewer.SizeChanged(m_sourceSizeChangedToken);
+        }
+        m_sourceSizeChangedToken.value = 0;
+    }
+}
+
+void ScrollInputSource::UnhookScrollerPropertyChanged()
+{
+    auto scroller = m_scroller.get();
+
+    if (m_scrollerContentChangedToken.value != 0)
+    {
+        if (scroller)
+        {
+            scroller.UnregisterPropertyChangedCallback(winrt::Scroller::ContentProperty(), m_scrollerContentChangedToken.value);
+        }
+        m_scrollerContentChangedToken.value = 0;
+    }
+    if (m_sourceSizeChangedToken.value != 0)
+    {
+        if (scroller)
+        {
+            scroller.SizeChanged(m_sourceSizeChangedToken);
+        }
+        m_sourceSizeChangedToken.value = 0;
+    }
+}
+
+void ScrollInputSource::HookScrollViewerContentPropertyChanged()
+{
+    auto sourceContent = m_sourceContent.get();
+    if (sourceContent)
+    {
+        if (m_scrollViewerContentHorizontalAlignmentChangedToken.value == 0)
+        {
+            m_scrollViewerContentHorizontalAlignmentChangedToken.value = sourceContent.RegisterPropertyChangedCallback(
+                winrt::FrameworkElement::HorizontalAlignmentProperty(), { this, &ScrollInputSource::OnScrollViewerContentPropertyChanged });
+        }
+        if (m_scrollViewerContentVerticalAlignmentChangedToken.value == 0)
+        {
+            m_scrollViewerContentVerticalAlignmentChangedToken.value = sourceContent.RegisterPropertyChangedCallback(
+                winrt::FrameworkElement::VerticalAlignmentProperty(), { this, &ScrollInputSource::OnScrollViewerContentPropertyChanged });
+        }
+        if (m_sourceContentSizeChangedToken.value == 0)
+        {
+            m_sourceContentSizeChangedToken = sourceContent.SizeChanged({ this, &ScrollInputSource::OnSourceContentSizeChanged });
+        }
+    }
+}
+
+void ScrollInputSource::HookScrollerContentPropertyChanged()
+{
+    auto sourceContent = m_sourceContent.get();
+
+    if (sourceContent)
+    {
+        if (m_sourceContentSizeChangedToken.value == 0)
+        {
+            m_sourceContentSizeChangedToken = sourceContent.SizeChanged({ this, &ScrollInputSource::OnSourceContentSizeChanged });
+        }
+    }
+}
+
+void ScrollInputSource::UnhookScrollViewerContentPropertyChanged()
+{
+    auto sourceContent = m_sourceContent.get();
+
+    if (m_scrollViewerContentHorizontalAlignmentChangedToken.value != 0)
+    {
+        if (sourceContent)
+        {
+            sourceContent.UnregisterPropertyChangedCallback(winrt::FrameworkElement::HorizontalAlignmentProperty(), m_scrollViewerContentHorizontalAlignmentChangedToken.value);
+        }
+        m_scrollViewerContentHorizontalAlignmentChangedToken.value = 0;
+    }
+    if (m_scrollViewerContentVerticalAlignmentChangedToken.value != 0)
+    {
+        if (sourceContent)
+        {
+            sourceContent.UnregisterPropertyChangedCallback(winrt::FrameworkElement::VerticalAlignmentProperty(), m_scrollViewerContentVerticalAlignmentChangedToken.value);
+        }
+        m_scrollViewerContentVerticalAlignmentChangedToken.value = 0;
+    }
+    UnhookScrollerContentPropertyChanged();
+}
+
+// Note that if in the future the Scroller supports a virtual mode where the extent does not
+// correspond to its Content size, the Scroller will need to raise an event when its virtual extent
+// changes so that the Scroller.ExpressionAnimationSources's Extent composition property can
+// be read. This should replace hooking up the SizeChanged event on the Scroller.Content altogether.
+void ScrollInputSource::UnhookScrollerContentPropertyChanged()
+{
+    if (m_sourceContentSizeChangedToken.value != 0)
+    {
+        if (auto sourceContent = m_sourceContent.get())
+        {
+            sourceContent.SizeChanged(m_sourceContentSizeChangedToken);
+        }
+        m_sourceContentSizeChangedToken.value = 0;
+    }
+}
+
+void ScrollInputSource::HookScrollViewerDirectManipulationStarted()
+{
+    auto scrollViewer = m_scrollViewer.get();
+    if (scrollViewer)
+    {
+        MUX_ASSERT(m_scrollViewerDirectManipulationStartedToken.value == 0);
+
+        m_scrollViewerDirectManipulationStartedToken = scrollViewer.DirectManipulationStarted({ this, &ScrollInputSource::OnScrollViewerDirectManipulationStarted });
+    }
+}
+
+void ScrollInputSource::UnhookScrollViewerDirectManipulationStarted()
+{
+    if (m_scrollViewerDirectManipulationStartedToken.value != 0)
+    {
+        if (auto scrollViewer = m_scrollViewer.get())
+        {
+            scrollViewer.DirectManipulationStarted(m_scrollViewerDirectManipulationStartedToken);
+        }
+        m_scrollViewerDirectManipulationStartedToken.value = 0;
+    }
+}
+
+void ScrollInputSource::HookScrollViewerDirectManipulationCompleted()
+{
+    auto scrollViewer = m_scrollViewer.get();
+    if (scrollViewer)
+    {
+        MUX_ASSERT(m_scrollViewerDirectManipulationCompletedToken.value == 0);
+
+        m_scrollViewerDirectManipulationCompletedToken = scrollViewer.DirectManipulationCompleted({ this, &ScrollInputSource::OnScrollViewerDirectManipulationCompleted });
+    }
+}
+
+void ScrollInputSource::UnhookScrollViewerDirectManipulationCompleted()
+{
+    if (m_scrollViewerDirectManipulationCompletedToken.value != 0)
+    {
+        if (auto scrollViewer = m_scrollViewer.get())
+        {
+            scrollViewer.DirectManipulationCompleted(m_scrollViewerDirectManipulationCompletedToken);
+        }
+        m_scrollViewerDirectManipulationCompletedToken.value = 0;
+    }
+}
+
+void ScrollInputSource::HookRichEditBoxTextChanged()
+{
+    auto richEditBox = m_richEditBox.get();
+    if (richEditBox)
+    {
+        MUX_ASSERT(m_richEditBoxTextChangedToken.value == 0);
+
+        m_richEditBoxTextChangedToken = richEditBox.TextChanged({ this, &ScrollInputSource::OnRichEditBoxTextChanged });
+    }
+}
+
+void ScrollInputSource::UnhookRichEditBoxTextChanged()
+{
+    if (m_richEditBoxTextChangedToken.value != 0)
+    {
+        if (auto richEditBox = m_richEditBox.get())
+        {
+            richEditBox.TextChanged(m_richEditBoxTextChangedToken);
+        }
+        m_richEditBoxTextChangedToken.value = 0;
+    }
+}
+
+// Hooks a one-time LayoutUpdated handler. Unlike CompositionTarget.Rendering, it does not cause
+// frames to be rendered and it is only raised when a layout pass actually occurs.
+void ScrollInputSource::HookLayoutUpdated(const winrt::FrameworkElement& element)
+{
+    if (element && m_layoutUpdatedToken.value == 0)
+    {
+        m_layoutUpdatedElement = winrt::make_weak(element);
+        m_layoutUpdatedToken = element.LayoutUpdated({ this, &ScrollInputSource::OnLayoutUpdated });
+    }
+}
+
+void ScrollInputSource::UnhookLayoutUpdated()
+{
+    if (m_layoutUpdatedToken.value != 0)
+    {
+        if (auto layoutUpdatedElement = m_layoutUpdatedElement.get())
+        {
+            layoutUpdatedElement.LayoutUpdated(m_layoutUpdatedToken);
+        }
+        m_layoutUpdatedElement = nullptr;
+        m_layoutUpdatedToken.value = 0;
+    }
+}
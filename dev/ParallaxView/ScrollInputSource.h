@@ -0,0 +1,156 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class ScrollInputHelper;
+
+// Tracks a ScrollViewer/Scroller source on behalf of all the ScrollInputHelper instances that use
+// the same source element. Its event hooks, composition property set and expression animations
+// are shared by all those consumers.
+// Only weak references to the XAML elements are kept because instances are not owned by a
+// reference tracker: the consumers' ParallaxView.Source values keep the source element alive.
+class ScrollInputSource
+{
+public:
+    explicit ScrollInputSource(const winrt::UIElement& sourceElement);
+    ~ScrollInputSource();
+
+    // Returns the instance shared by all consumers of the provided source element, creating it when needed.
+    static std::shared_ptr<ScrollInputSource> GetForSourceElement(const winrt::UIElement& sourceElement);
+
+    void AddConsumer(ScrollInputHelper* consumer);
+    void RemoveConsumer(ScrollInputHelper* consumer);
+
+    winrt::UIElement SourceElement() const;
+    winrt::FxScrollViewer GetScrollViewer() const;
+    winrt::Scroller GetScroller() const;
+    winrt::CompositionPropertySet SourcePropertySet() const;
+
+    double GetOffsetFromScrollContentElement(const winrt::UIElement& element, winrt::Orientation orientation) const;
+    double GetMaxUnderpanOffset(winrt::Orientation orientation) const;
+    double GetMaxOverpanOffset(winrt::Orientation orientation) const;
+    double GetContentSize(winrt::Orientation orientation) const;
+    double GetViewportSize(winrt::Orientation orientation) const;
+
+    // Creates the shared composition property set, using the compositor of the first consumer that has a target element.
+    void EnsureInternalSourcePropertySetAndExpressionAnimations(const winrt::Compositor& compositor);
+
+    // Property names inside the composition property set returned by SourcePropertySet.
+    static PCWSTR s_horizontalOffsetPropertyName;
+    static PCWSTR s_verticalOffsetPropertyName;
+    static PCWSTR s_scalePropertyName;
+
+private:
+    static winrt::RichEditBox GetRichEditBoxParent(const winrt::DependencyObject& childElement);
+    static void GetChildScrollerOrScrollViewer(
+        const winrt::DependencyObject& rootElement,
+        _Out_ winrt::Scroller* scroller,
+        _Out_ winrt::FxScrollViewer* scrollViewer);
+    winrt::UIElement GetScrollContentElement() const;
+    winrt::HorizontalAlignment GetEffectiveHorizontalAlignment() const;
+    winrt::VerticalAlignment GetEffectiveVerticalAlignment() const;
+    winrt::FxZoomMode GetEffectiveZoomMode() const;
+
+    void SetScrollViewer(const winrt::FxScrollViewer& scrollViewer);
+    void SetScroller(const winrt::Scroller& scroller);
+
+    void UpdateOutOfBoundsPanSize();
+    void UpdateContentSize();
+    void UpdateViewportSize();
+    void UpdateSource(bool allowSourceElementLoadedHookup);
+    void UpdateManipulationZoomMode();
+    void UpdateManipulationAlignments();
+    void UpdateInternalExpressionAnimations(bool horizontalInfoChanged, bool verticalInfoChanged, bool zoomInfoChanged);
+
+    winrt::HorizontalAlignment ComputeHorizontalContentAlignment() const;
+    winrt::VerticalAlignment ComputeVerticalContentAlignment() const;
+    winrt::FxZoomMode ComputeZoomMode() const;
+
+    bool IsScrollContentPresenterIScrollInfoProvider() const;
+
+    void StartInternalExpressionAnimations(const winrt::CompositionPropertySet& source);
+    void StopInternalExpressionAnimations();
+
+    void ProcessSourceElementChange(bool allowSourceElementLoadedHookup);
+    void ProcessSourceControlTemplateChange();
+    void ProcessContentSizeChange();
+    void ProcessScrollViewerContentChange();
+    void ProcessScrollerContentChange();
+    void ProcessScrollViewerZoomModeChange();
+
+    void OnSourceInfoChanged(bool horizontalInfoChanged, bool verticalInfoChanged, bool zoomInfoChanged);
+
+    // Event handlers
+    void OnSourceElementLoaded(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
+    void OnSourceElementPropertyChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
+    void OnSourceSizeChanged(const winrt::IInspectable& sender, const winrt::SizeChangedEventArgs& args);
+    void OnSourceContentSizeChanged(const winrt::IInspectable& sender, const winrt::SizeChangedEventArgs& args);
+    void OnScrollViewerPropertyChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
+    void OnScrollerPropertyChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
+    void OnScrollViewerContentPropertyChanged(const winrt::DependencyObject& sender, const winrt::DependencyProperty& args);
+    void OnScrollViewerDirectManipulationStarted(const winrt::IInspectable& sender, const winrt::IInspectable& args);
+    void OnScrollViewerDirectManipulationCompleted(const winrt::IInspectable& sender, const winrt::IInspectable& args);
+    void OnRichEditBoxTextChanged(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
+    void OnLayoutUpdated(const winrt::IInspectable& sender, const winrt::IInspectable& args);
+
+    void HookSourceElementLoaded();
+    void UnhookSourceElementLoaded();
+    void HookSourceControlTemplateChanged();
+    void UnhookSourceControlTemplateChanged();
+    void HookScrollerPropertyChanged();
+    void UnhookScrollerPropertyChanged();
+    void HookScrollerContentPropertyChanged();
+    void UnhookScrollerContentPropertyChanged();
+    void HookScrollViewerPropertyChanged();
+    void UnhookScrollViewerPropertyChanged();
+    void HookScrollViewerContentPropertyChanged();
+    void UnhookScrollViewerContentPropertyChanged();
+    void HookScrollViewerDirectManipulationStarted();
+    void UnhookScrollViewerDirectManipulationStarted();
+    void HookScrollViewerDirectManipulationCompleted();
+    void UnhookScrollViewerDirectManipulationCompleted();
+    void HookRichEditBoxTextChanged();
+    void UnhookRichEditBoxTextChanged();
+    void HookLayoutUpdated(const winrt::FrameworkElement& element);
+    void UnhookLayoutUpdated();
+
+private:
+    std::vector<ScrollInputHelper*> m_consumers;
+
+    winrt::weak_ref<winrt::UIElement> m_sourceElement{ nullptr };
+    winrt::weak_ref<winrt::FxScrollViewer> m_scrollViewer{ nullptr };
+    winrt::weak_ref<winrt::Scroller> m_scroller{ nullptr };
+    winrt::weak_ref<winrt::FrameworkElement> m_sourceContent{ nullptr };
+    winrt::weak_ref<winrt::RichEditBox> m_richEditBox{ nullptr };
+    winrt::weak_ref<winrt::FrameworkElement> m_layoutUpdatedElement{ nullptr };
+    winrt::CompositionPropertySet m_internalSourcePropertySet{ nullptr };
+    winrt::CompositionPropertySet m_scrollViewerPropertySet{ nullptr };
+    winrt::ExpressionAnimation m_internalTranslationXExpressionAnimation{ nullptr };
+    winrt::ExpressionAnimation m_internalTranslationYExpressionAnimation{ nullptr };
+    winrt::ExpressionAnimation m_internalScaleExpressionAnimation{ nullptr };
+    winrt::FxZoomMode m_manipulationZoomMode{ winrt::FxZoomMode::Disabled };
+    winrt::HorizontalAlignment m_manipulationHorizontalAlignment{ winrt::HorizontalAlignment::Stretch };
+    winrt::VerticalAlignment m_manipulationVerticalAlignment{ winrt::VerticalAlignment::Stretch };
+    winrt::Size m_viewportSize{ 0.0f, 0.0f };
+    winrt::Size m_contentSize{ 0.0f, 0.0f };
+    winrt::Size m_outOfBoundsPanSize{ 0.0f, 0.0f };
+    bool m_isScrollViewerInDirectManipulation{ false };
+
+    // Event Tokens
+    winrt::event_token m_sourceElementLoadedToken{ 0 };
+    winrt::event_token m_sourceControlTemplateChangedToken{ 0 };
+    winrt::event_token m_sourceSizeChangedToken{ 0 };
+    winrt::event_token m_sourceContentSizeChangedToken{ 0 };
+    winrt::event_token m_scrollViewerContentHorizontalAlignmentChangedToken{ 0 };
+    winrt::event_token m_scrollViewerContentVerticalAlignmentChangedToken{ 0 };
+    winrt::event_token m_scrollViewerContentChangedToken{ 0 };
+    winrt::event_token m_scrollerContentChangedToken{ 0 };
+    winrt::event_token m_scrollViewerHorizontalContentAlignmentChangedToken{ 0 };
+    winrt::event_token m_scrollViewerVerticalContentAlignmentChangedToken{ 0 };
+    winrt::event_token m_scrollViewerZoomModeChangedToken{ 0 };
+    winrt::event_token m_scrollViewerDirectManipulationStartedToken{ 0 };
+    winrt::event_token m_scrollViewerDirectManipulationCompletedToken{ 0 };
+    winrt::event_token m_richEditBoxTextChangedToken{ 0 };
+    winrt::event_token m_layoutUpdatedToken{ 0 };
+};
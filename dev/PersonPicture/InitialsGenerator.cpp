@@ -5,8 +5,27 @@
 #include "common.h"
 #include "InitialsGenerator.h"
 #include <wctype.h>
-#include <sstream>
 #include <algorithm>
+#include <array>
+
+namespace
+{
+    // PersonPictures in a list tend to rebind to the same handful of names, so keep the
+    // initials of the most recently seen display names around, most recent first.
+    struct InitialsCacheEntry
+    {
+        winrt::hstring displayName;
+        winrt::hstring initials;
+    };
+
+    constexpr size_t c_initialsCacheSize = 16;
+    thread_local std::array<InitialsCacheEntry, c_initialsCacheSize> s_initialsCache;
+    thread_local size_t s_initialsCacheCount = 0;
+
+    // Same limit as the getline loop this replaced: only the first 25 space separated
+    // tokens are looked at, empty ones included.
+    constexpr int c_maxWordTokens = 25;
+}
 
 /// <summary>
 /// Helper function which takes in a Contact object and produces initials
@@ -35,22 +54,16 @@ winrt::hstring InitialsGenerator::InitialsFromContactObject(const winrt::Contact
 
     // Optimal case is we have a clearly defined First and Last name. If
     // available, that is the data which should be used.
-    if (!contact.FirstName().empty() && !contact.LastName().empty())
+    const winrt::hstring firstName = contact.FirstName();
+    const winrt::hstring lastName = contact.LastName();
+    if (!firstName.empty() && !lastName.empty())
     {
-        CharacterType type = GetCharacterType(contact.FirstName());
+        CharacterType type = GetCharacterType(firstName);
 
         // We'll attempt to make initials only if we recognize a name in the Standard character set.
         if (type == CharacterType::Standard)
         {
-            std::wstring firstName = static_cast<std::wstring>(contact.FirstName());
-            std::wstring lastName = static_cast<std::wstring>(contact.LastName());
-
-            std::wstring result = GetFirstFullCharacter(firstName.data());
-            result.append(GetFirstFullCharacter(lastName.data()));
-
-            std::transform(result.begin(), result.end(), result.begin(), ::towupper);
-
-            return winrt::hstring(result);
+            return ToUpperInitials(GetFirstFullCharacter(firstName), GetFirstFullCharacter(lastName));
         }
         else
         {
@@ -61,9 +74,10 @@ winrt::hstring InitialsGenerator::InitialsFromContactObject(const winrt::Contact
 
     // If the supplied object does not contain granular name data, then we must
     // extract the correct initials from the DisplayName.
-    if (!contact.DisplayName().empty())
+    const winrt::hstring displayName = contact.DisplayName();
+    if (!displayName.empty())
     {
-        return InitialsFromDisplayName(contact.DisplayName());
+        return InitialsFromDisplayName(displayName);
     }
 
     // Return empty string. In our code-behind we will produce a generic glyph as a result.
@@ -71,48 +85,89 @@ winrt::hstring InitialsGenerator::InitialsFromContactObject(const winrt::Contact
 }
 
 winrt::hstring InitialsGenerator::InitialsFromDisplayName(const wstring_view &contactDisplayName)
+{
+    if (contactDisplayName.empty())
+    {
+        return winrt::hstring(L"");
+    }
+
+    const auto cacheBegin = s_initialsCache.begin();
+    for (size_t i = 0; i < s_initialsCacheCount; i++)
+    {
+        if (std::wstring_view(s_initialsCache[i].displayName) == contactDisplayName)
+        {
+            std::rotate(cacheBegin, cacheBegin + i, cacheBegin + i + 1);
+            return s_initialsCache[0].initials;
+        }
+    }
+
+    winrt::hstring result = GenerateInitialsFromDisplayName(contactDisplayName);
+
+    // Overwrite the least recently used entry and move it to the front.
+    const size_t slot = std::min(s_initialsCacheCount, c_initialsCacheSize - 1);
+    if (s_initialsCacheCount < c_initialsCacheSize)
+    {
+        s_initialsCacheCount++;
+    }
+    s_initialsCache[slot] = { winrt::hstring(contactDisplayName), result };
+    std::rotate(cacheBegin, cacheBegin + slot, cacheBegin + slot + 1);
+
+    return result;
+}
+
+winrt::hstring InitialsGenerator::GenerateInitialsFromDisplayName(const wstring_view &contactDisplayName)
 {
     CharacterType type = GetCharacterType(contactDisplayName);
 
     // We'll attempt to make initials only if we recognize a name in the Standard character set.
     if (type == CharacterType::Standard)
     {
-        std::wstring displayName(contactDisplayName.data());
+        const std::wstring_view displayName = StripTrailingBrackets(contactDisplayName);
 
-        StripTrailingBrackets(displayName);
+        std::wstring_view firstWord;
+        std::wstring_view lastWord;
+        int wordCount = 0;
+        int tokenCount = 0;
 
-        std::vector<std::wstring> words = Split(displayName, L' ');
-
-        if (words.size() == 1)
+        // Walk the space separated words, only the first and the last one are needed.
+        size_t tokenStart = 0;
+        while (tokenStart < displayName.size() && tokenCount < c_maxWordTokens)
         {
-            // If there's only a single long word, we'll show one initial.
-            std::wstring firstWord = words.front();
+            size_t tokenEnd = displayName.find(L' ', tokenStart);
+            if (tokenEnd == std::wstring_view::npos)
+            {
+                tokenEnd = displayName.size();
+            }
 
-            std::wstring result = GetFirstFullCharacter(firstWord);
+            if (tokenEnd > tokenStart)
+            {
+                lastWord = displayName.substr(tokenStart, tokenEnd - tokenStart);
+                if (wordCount++ == 0)
+                {
+                    firstWord = lastWord;
+                }
+            }
 
-            std::transform(result.begin(), result.end(), result.begin(), ::towupper);
+            tokenCount++;
+            tokenStart = tokenEnd + 1;
+        }
 
-            return winrt::hstring(result);
+        if (wordCount == 1)
+        {
+            // If there's only a single long word, we'll show one initial.
+            return ToUpperInitials(GetFirstFullCharacter(firstWord), {});
         }
-        else if (words.size() > 1)
+        else if (wordCount > 1)
         {
             // If there's at least two words, we'll show two initials.
             // 
             // NOTE: Based on current implementation, we could be showing punctuation.
             // For example, "John -Smith" would be "J-".
-            std::wstring firstWord = words.front();
-            std::wstring lastWord = words.back();
-
-            std::wstring result = GetFirstFullCharacter(firstWord);
-            result.append(GetFirstFullCharacter(lastWord));
-
-            std::transform(result.begin(), result.end(), result.begin(), ::towupper);
-
-            return winrt::hstring(result);
+            return ToUpperInitials(GetFirstFullCharacter(firstWord), GetFirstFullCharacter(lastWord));
         }
         else
         {
-            // If there's only spaces in the name, we'll get a Vector size of 0.
+            // If there's only spaces in the name, we won't find any words.
             return winrt::hstring(L"");
         }
     }
@@ -123,14 +178,31 @@ winrt::hstring InitialsGenerator::InitialsFromDisplayName(const wstring_view &co
     }
 }
 
-std::wstring InitialsGenerator::GetFirstFullCharacter(const std::wstring &str)
+winrt::hstring InitialsGenerator::ToUpperInitials(const std::wstring_view &first, const std::wstring_view &second)
+{
+    std::wstring result;
+    result.reserve(first.size() + second.size());
+    result.append(first);
+    result.append(second);
+
+    std::transform(result.begin(), result.end(), result.begin(), ::towupper);
+
+    return winrt::hstring(result);
+}
+
+std::wstring_view InitialsGenerator::GetFirstFullCharacter(const std::wstring_view &str)
 {
+    if (str.empty())
+    {
+        return str;
+    }
+
     // Index should begin at the first desireable character.
-    unsigned int start = 0;
+    size_t start = 0;
 
     while (start < str.size())
     {
-        wchar_t character = str.at(start);
+        wchar_t character = str[start];
 
         // Omit ! " # $ % & ' ( ) * + , - . /
         if ((character >= 0x0021) && (character <= 0x002F))
@@ -165,11 +237,11 @@ std::wstring InitialsGenerator::GetFirstFullCharacter(const std::wstring &str)
 
     // Combining characters begin only after the first character, so we should start
     // looking 1 after the start character.
-    unsigned int index = start + 1;
+    size_t index = start + 1;
 
     while (index < str.size())
     {
-        wchar_t character = str.at(index);
+        wchar_t character = str[index];
 
         // Combining Diacritical Marks -- Official Unicode character block
         if ((character < 0x0300) || (character > 0x036F))
@@ -181,36 +253,10 @@ std::wstring InitialsGenerator::GetFirstFullCharacter(const std::wstring &str)
     }
 
     // Determine number of diacritics by adjusting for our initial offset.
-    unsigned int strLength = index - start;
-
-    std::wstring result(&str.at(start), strLength);
-    return result;
+    return str.substr(start, index - start);
 }
 
-std::vector<std::wstring> InitialsGenerator::Split(const std::wstring &source, wchar_t delim, int maxIterations)
-{
-    std::vector<std::wstring> result;
-
-    std::wistringstream buffer(source);
-
-    int i = 0;
-
-    for (std::wstring token; std::getline(buffer, token, delim);)
-    {
-        if (!token.empty())
-        {
-            result.push_back(token);
-        }
-        if (++i >= maxIterations)
-        {
-            break;
-        }
-    }
-
-    return result;
-}
-
-void InitialsGenerator::StripTrailingBrackets(std::wstring &source)
+std::wstring_view InitialsGenerator::StripTrailingBrackets(const std::wstring_view &source)
 {
     // Guidance from the world readiness team is that text within a final set of brackets
     // can be removed for the purposes of calculating initials. ex. John Smith (OSG)
@@ -218,7 +264,7 @@ void InitialsGenerator::StripTrailingBrackets(std::wstring &source)
 
     if (source.empty())
     {
-        return;
+        return source;
     }
 
     for (auto delimiter : delimiters)
@@ -229,14 +275,15 @@ void InitialsGenerator::StripTrailingBrackets(std::wstring &source)
         }
 
         auto start = source.find_last_of(delimiter[0]);
-        if (start == std::string::npos)
+        if (start == std::wstring_view::npos)
         {
             continue;
         }
 
-        source.erase(start);
-        return;
+        return source.substr(0, start);
     }
+
+    return source;
 }
 
 CharacterType InitialsGenerator::GetCharacterType(const wstring_view &str)
@@ -247,7 +294,7 @@ CharacterType InitialsGenerator::GetCharacterType(const wstring_view &str)
     // by truncating to one or two.
     CharacterType result = CharacterType::Other;
 
-    for (int i = 0; i < 3; i++)
+    for (size_t i = 0; i < 3 && i < str.size(); i++)
     {
         // Break on null character. 0xFEFF is a terminating character which appears as null.
         if ((str.data()[i] == '\0') || (str.data()[i] == 0xFEFF))
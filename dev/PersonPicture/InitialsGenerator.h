@@ -75,25 +75,33 @@ public:
 
 private:
     /// <summary>
-    /// Helper function which takes in a string and returns a vector of pieces, separated by delimiter.
+    /// Uncached implementation of InitialsFromDisplayName.
     /// </summary>
-    /// <param name="source">String on which to perform the split operation.</param>
-    /// <param name="delim">String on which to perform the split operation.</param>
-    /// <param name="maxIterations">Maximum number of times to perform a <code>getline</code> loop.</param>
-    /// <returns>A vector of pieces from the source string, separated by delimiter</returns>
-    static std::vector<std::wstring> Split(const std::wstring &source, wchar_t delim, int maxIterations = 25);
+    /// <param name="contactDisplayName>The DisplayName of the person</param>
+    /// <returns>
+    /// String containing the initials representation of the given DisplayName.
+    /// </returns>
+    static winrt::hstring GenerateInitialsFromDisplayName(const wstring_view &contactDisplayName);
+
+    /// <summary>
+    /// Helper function which concatenates the given characters and converts them to upper case.
+    /// </summary>
+    /// <param name="first">First initial.</param>
+    /// <param name="second">Second initial, may be empty.</param>
+    /// <returns>The initials in upper case.</returns>
+    static winrt::hstring ToUpperInitials(const std::wstring_view &first, const std::wstring_view &second);
 
     /// <summary>
     /// Helper function to remove bracket qualifier from the end of a display name if present.
     /// </summary>
     /// <param name="source">String on which to perform the operation.</param>
-    /// <returns>A string with the content within brackets removed.</returns>
-    static void StripTrailingBrackets(std::wstring &source);
+    /// <returns>A view of the string with the content within brackets removed.</returns>
+    static std::wstring_view StripTrailingBrackets(const std::wstring_view &source);
 
     /// <summary>
     /// Extracts the first full character from a given string, including any diacritics or combining characters.
     /// </summary>
     /// <param name="str">String from which to extract the character.</param>
-    /// <returns>A wstring which represents a given character.</returns>
-    static std::wstring GetFirstFullCharacter(const std::wstring &str);
+    /// <returns>A view of the given string which represents a given character.</returns>
+    static std::wstring_view GetFirstFullCharacter(const std::wstring_view &str);
 };
@@ -9,6 +9,21 @@
 #include "ResourceAccessor.h"
 #include "Utils.h"
 #include "RuntimeProfiler.h"
+#include "StartupTrace.h"
+
+namespace
+{
+    // Contact pictures loaded on this thread, keyed by contact id and size, so that PersonPictures
+    // showing the same contact share one decoded BitmapImage. The cache doesn't keep images alive.
+    thread_local std::map<std::wstring, winrt::weak_ref<winrt::BitmapImage>> s_contactImageCache;
+    constexpr size_t c_contactImageCachePruneSize = 256;
+
+    // Size and Height are NaN unless set by the app or the style, which means no decode constraint.
+    int ToDecodePixelSize(double size)
+    {
+        return std::isfinite(size) && size > 0 ? static_cast<int>(std::ceil(size)) : 0;
+    }
+}
 
 PersonPicture::PersonPicture()
 {
@@ -22,6 +37,7 @@ PersonPicture::PersonPicture()
 
 void PersonPicture::LoadImageAsync(
     std::shared_ptr<winrt::IRandomAccessStreamReference> thumbStreamReference,
+    int decodePixelHeight,
     std::function<void(winrt::BitmapImage)> completedFunction)
 {
     com_ptr<PersonPicture> strongThis = get_strong();
@@ -34,10 +50,20 @@ void PersonPicture::LoadImageAsync(
                 winrt::AsyncStatus asyncStatus)
     {
         strongThis->m_dispatcherHelper.RunAsync(
-            [strongThis, asyncStatus, completedFunction, operation]()
+            [strongThis, asyncStatus, completedFunction, operation, decodePixelHeight]()
         {
             winrt::BitmapImage bitmap;
 
+            // Decode straight to the displayed size rather than the full resolution of the contact
+            // photo. Logical pixels are scaled by the display's DPI. Most photos are square or wider
+            // than tall, for which the height is the side to constrain; completedFunction corrects
+            // the others once the pixel size is known.
+            bitmap.DecodePixelType(winrt::DecodePixelType::Logical);
+            if (decodePixelHeight > 0)
+            {
+                bitmap.DecodePixelHeight(decodePixelHeight);
+            }
+
             // Handle the failure case here to ensure we are on the UI thread.
             if (asyncStatus != winrt::AsyncStatus::Completed)
             {
@@ -88,6 +114,8 @@ winrt::AutomationPeer PersonPicture::OnCreateAutomationPeer()
 
 void PersonPicture::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"PersonPicture");
+
     // Retrieve pointers to stable controls
     winrt::IControlProtected thisAsControlProtected = *this;
 
@@ -429,6 +457,24 @@ winrt::hstring PersonPicture::GetLocalizedPluralBadgeItemStringResource(unsigned
     return value;
 }
 
+std::wstring PersonPicture::GetContactImageCacheKey(winrt::Contact const& contact)
+{
+    // Contacts that aren't from a contact store have no id, and nothing to share the image with.
+    const winrt::hstring id = contact.Id();
+    if (id.empty())
+    {
+        return {};
+    }
+
+    std::wstring key{ id };
+    key += L'|';
+    key += std::to_wstring(ToDecodePixelSize(Width()));
+    key += L'x';
+    key += std::to_wstring(ToDecodePixelSize(Height()));
+    key += PreferSmallImage() ? L"|small" : L"|large";
+    return key;
+}
+
 void PersonPicture::UpdateControlForContact(bool isNewContact)
 {
     winrt::Contact contact = Contact();
@@ -453,6 +499,22 @@ void PersonPicture::UpdateControlForContact(bool isNewContact)
 
     m_contactDisplayNameInitials.set(InitialsGenerator::InitialsFromContactObject(contact));
 
+    const std::wstring cacheKey = GetContactImageCacheKey(contact);
+    if (!cacheKey.empty())
+    {
+        auto cached = s_contactImageCache.find(cacheKey);
+        if (cached != s_contactImageCache.end())
+        {
+            if (auto bitmap = cached->second.get())
+            {
+                m_contactImageSource.set(winrt::ImageSource(bitmap));
+                UpdateIfReady();
+                return;
+            }
+            s_contactImageCache.erase(cached);
+        }
+    }
+
     // Order of preference (but all work): Large, Small, Source, Thumbnail
     std::shared_ptr<winrt::IRandomAccessStreamReference> thumbStreamReference = std::make_shared<winrt::IRandomAccessStreamReference>();
 
@@ -496,19 +558,31 @@ void PersonPicture::UpdateControlForContact(bool isNewContact)
 
             LoadImageAsync(
                 thumbStreamReference,
-                [strongThis](winrt::BitmapImage profileBitmap)
+                ToDecodePixelSize(Height()),
+                [strongThis, cacheKey](winrt::BitmapImage profileBitmap)
             {
-                profileBitmap.DecodePixelType(winrt::DecodePixelType::Logical);
-
                 // We want to constrain the shorter side to the same dimension as the control, allowing the decoder to
                 // choose the other dimension without distorting the image.
                 if (profileBitmap.PixelHeight() < profileBitmap.PixelWidth())
                 {
-                    profileBitmap.DecodePixelHeight(static_cast<int>(strongThis->Height()));
+                    profileBitmap.DecodePixelHeight(ToDecodePixelSize(strongThis->Height()));
                 }
                 else
                 {
-                    profileBitmap.DecodePixelWidth(static_cast<int>(strongThis->Width()));
+                    profileBitmap.DecodePixelHeight(0);
+                    profileBitmap.DecodePixelWidth(ToDecodePixelSize(strongThis->Width()));
+                }
+
+                if (!cacheKey.empty())
+                {
+                    if (s_contactImageCache.size() >= c_contactImageCachePruneSize)
+                    {
+                        for (auto it = s_contactImageCache.begin(); it != s_contactImageCache.end();)
+                        {
+                            it = it->second.get() ? std::next(it) : s_contactImageCache.erase(it);
+                        }
+                    }
+                    s_contactImageCache[cacheKey] = winrt::make_weak(profileBitmap);
                 }
 
                 strongThis->m_contactImageSource.set(winrt::ImageSource(profileBitmap));
@@ -80,8 +80,11 @@ private:
     // Helper functions
     void LoadImageAsync(
         std::shared_ptr<winrt::IRandomAccessStreamReference> thumbStreamReference,
+        int decodePixelHeight,
         std::function<void(winrt::BitmapImage)> completedFunction);
 
+    std::wstring GetContactImageCacheKey(winrt::Contact const& contact);
+
     winrt::hstring PersonPicture::GetLocalizedPluralBadgeItemStringResource(unsigned int numericValue);
 
     /// <summary>
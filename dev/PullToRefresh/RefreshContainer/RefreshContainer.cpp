@@ -10,6 +10,7 @@
 #include "RefreshVisualizerEventArgs.h"
 #include "RuntimeProfiler.h"
 #include "PTRTracing.h"
+#include "StartupTrace.h"
 
 #include <DoubleUtil.h>
 
@@ -68,6 +69,8 @@ RefreshContainer::RefreshContainer()
 
 void RefreshContainer::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"RefreshContainer");
+
     PTR_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
     // BEGIN: Populate template children
     winrt::IControlProtected thisAsControlProtected = *this;
@@ -8,6 +8,7 @@
 #include "RefreshVisualizerEventArgs.h"
 #include "RuntimeProfiler.h"
 #include "PTRTracing.h"
+#include "StartupTrace.h"
 
 
 //The Opacity of the progress indicator in the non-pending non-executing states
@@ -45,6 +46,8 @@ RefreshVisualizer::RefreshVisualizer()
 
 void RefreshVisualizer::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"RefreshVisualizer");
+
     PTR_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
     // BEGIN: Populate template children
     winrt::IControlProtected thisAsControlProtected = *this;
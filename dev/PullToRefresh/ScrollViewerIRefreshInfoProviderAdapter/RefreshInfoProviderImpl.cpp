@@ -37,6 +37,37 @@ RefreshInfoProviderImpl::RefreshInfoProviderImpl(const winrt::RefreshPullDirecti
     m_refreshPullDirection = refreshPullDirection;
     m_refreshVisualizerSize = refreshVisualizerSize;
     m_compositionProperties = compositor.CreatePropertySet();
+    m_compositionProperties.InsertScalar(m_interactionRatioCompositionProperty, 0.0f);
+}
+
+// Drives the published interaction ratio from the tracker's position on the composition thread, so that
+// animations built on CompositionProperties keep up with the finger while the UI thread is busy.
+// ValuesChanged still raises InteractionRatioChanged for the state changes.
+void RefreshInfoProviderImpl::SetInteractionTracker(const winrt::InteractionTracker& interactionTracker)
+{
+    PTR_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
+    const bool isVertical = m_refreshPullDirection == winrt::RefreshPullDirection::TopToBottom || m_refreshPullDirection == winrt::RefreshPullDirection::BottomToTop;
+    const float refreshVisualizerSize = isVertical ? m_refreshVisualizerSize.Height : m_refreshVisualizerSize.Width;
+
+    if (!interactionTracker || refreshVisualizerSize == 0)
+    {
+        m_isInteractionRatioAnimated = false;
+        return;
+    }
+
+    std::wstring position = isVertical ? L"tracker.Position.Y" : L"tracker.Position.X";
+    if (m_refreshPullDirection == winrt::RefreshPullDirection::TopToBottom || m_refreshPullDirection == winrt::RefreshPullDirection::LeftToRight)
+    {
+        position = L"-" + position;
+    }
+
+    winrt::ExpressionAnimation interactionRatioAnimation = m_compositionProperties.Compositor().CreateExpressionAnimation(
+        L"Min(1.0f, " + position + L" / refreshVisualizerSize)");
+    interactionRatioAnimation.SetReferenceParameter(L"tracker", interactionTracker);
+    interactionRatioAnimation.SetScalarParameter(L"refreshVisualizerSize", refreshVisualizerSize);
+
+    m_compositionProperties.StartAnimation(m_interactionRatioCompositionProperty, interactionRatioAnimation);
+    m_isInteractionRatioAnimated = true;
 }
 
 void RefreshInfoProviderImpl::UpdateIsInteractingForRefresh(bool value)
@@ -193,7 +224,11 @@ void RefreshInfoProviderImpl::RaiseInteractionRatioChanged(double interactionRat
 {
     PTR_TRACE_INFO(nullptr, TRACE_MSG_METH_DBL, METH_NAME, this, interactionRatio);
 
-    m_compositionProperties.InsertScalar(m_interactionRatioCompositionProperty, static_cast<float>(interactionRatio));
+    // Inserting the value would stop the animation started by SetInteractionTracker.
+    if (!m_isInteractionRatioAnimated)
+    {
+        m_compositionProperties.InsertScalar(m_interactionRatioCompositionProperty, static_cast<float>(interactionRatio));
+    }
 
     if (m_interactionRatioChangedCount == 0 || AreClose(interactionRatio, 0.0) || AreClose(interactionRatio, m_executionRatio))
     {
@@ -17,6 +17,7 @@ public:
     ~RefreshInfoProviderImpl();
     RefreshInfoProviderImpl(const winrt::RefreshPullDirection& refreshPullDirection, const winrt::Size& refreshVisualizerSize, const winrt::Compositor& compositor);
     void UpdateIsInteractingForRefresh(bool value);
+    void SetInteractionTracker(const winrt::InteractionTracker& interactionTracker);
 
     //IInteractionTrackerOwner;
     void ValuesChanged(const winrt::InteractionTracker& sender, const winrt::InteractionTrackerValuesChangedArgs& args);
@@ -58,6 +59,7 @@ private:
     int m_interactionRatioChangedCount{ 0 };
     winrt::CompositionPropertySet m_compositionProperties{ nullptr };
     PCWSTR m_interactionRatioCompositionProperty = L"InteractionRatio";
+    bool m_isInteractionRatioAnimated{ false };
     double m_executionRatio{ DEFAULT_EXECUTION_RATIO };
     bool m_peeking{ false };
 
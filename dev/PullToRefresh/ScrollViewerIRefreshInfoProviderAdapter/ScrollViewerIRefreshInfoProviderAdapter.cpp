@@ -146,6 +146,8 @@ winrt::IRefreshInfoProvider ScrollViewerIRefreshInfoProviderAdapter::Adapt(winrt
     m_interactionTracker.get().MinScale(1.0f);
     m_interactionTracker.get().MaxScale(1.0f);
 
+    m_infoProvider.get()->SetInteractionTracker(m_interactionTracker.get());
+
     if (m_visualInteractionSource.get())
     {
         m_interactionTracker.get().InteractionSources().Add(m_visualInteractionSource.get());
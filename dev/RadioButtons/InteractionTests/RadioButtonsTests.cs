@@ -128,8 +128,8 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
         {
             using (var setup = new TestSetupHelper("RadioButtons Tests"))
             {
-                ListViewItem item0 = FindElement.ByName<ListViewItem>("Red");
-                ListViewItem item1 = FindElement.ByName<ListViewItem>("Orange");
+                UIObject item0 = FindElement.ByName("Red");
+                UIObject item1 = FindElement.ByName("Orange");
                 
                 Log.Comment("Verify Orange is to the right of Red");
                 Verify.AreEqual(item1.BoundingRectangle.Top, item0.BoundingRectangle.Top);
@@ -150,7 +150,7 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
             using (var setup = new TestSetupHelper("RadioButtons Tests"))
             {
                 Log.Comment("Verify ItemsSource items exist");
-                ListViewItem item = FindElement.ByName<ListViewItem>("Middle");
+                UIObject item = FindElement.ByName("Middle");
                 Verify.IsNotNull(item);
             }
         }
@@ -158,7 +158,7 @@ namespace Windows.UI.Xaml.Tests.MUXControls.InteractionTests
         public void Select(string itemString)
         {
             Log.Comment("Clicking on item '" + itemString + "'");
-            ListViewItem item = FindElement.ByName<ListViewItem>(itemString);
+            UIObject item = FindElement.ByName(itemString);
             item.Click();
             Wait.ForIdle();
         }
@@ -4,9 +4,12 @@
 #include "pch.h"
 #include "common.h"
 #include "RadioButtons.h"
+#include "RadioButtonsGridLayout.h"
+#include "InspectingDataSource.h"
 #include "Vector.h"
 #include "RuntimeProfiler.h"
 #include "ResourceAccessor.h"
+#include "StartupTrace.h"
 
 RadioButtons::RadioButtons()
 {
@@ -16,52 +19,97 @@ RadioButtons::RadioButtons()
     SetValue(s_ItemsProperty, items);
 
     SetDefaultStyleKey(this);
+
+    m_elementFactory = winrt::make_self<RadioButtonsElementFactory>();
 }
 
 void RadioButtons::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"RadioButtons");
+
     winrt::IControlProtected controlProtected{ *this };
-    
-    m_listView.set(GetTemplateChildT<winrt::ListView>(L"InnerListView", controlProtected));
-    if (auto listView = m_listView.get())
+
+    m_childCheckedRevokers.clear();
+
+    m_repeater.set(GetTemplateChildT<winrt::ItemsRepeater>(L"InnerRepeater", controlProtected));
+    if (auto repeater = m_repeater.get())
     {
-        m_listViewLoadedRevoker = listView.Loaded(winrt::auto_revoke, { this, &RadioButtons::OnListViewLoaded });
-        m_listViewSelectionChangedRevoker = listView.SelectionChanged(winrt::auto_revoke, { this, &RadioButtons::OnListViewSelectionChanged });
+        auto layout = winrt::make<RadioButtonsGridLayout>();
+        layout.MaximumColumns(MaximumColumns());
+        repeater.Layout(layout);
+
+        UpdateItemTemplate();
+        repeater.ItemTemplate(m_elementFactory.as<winrt::IElementFactoryShim>());
+
+        m_repeaterElementPreparedRevoker = repeater.ElementPrepared(winrt::auto_revoke, { this, &RadioButtons::OnRepeaterElementPrepared });
+        m_repeaterElementClearingRevoker = repeater.ElementClearing(winrt::auto_revoke, { this, &RadioButtons::OnRepeaterElementClearing });
+        m_repeaterElementIndexChangedRevoker = repeater.ElementIndexChanged(winrt::auto_revoke, { this, &RadioButtons::OnRepeaterElementIndexChanged });
+
+        // Override normal up/down behavior -- down should always go to the next item and up to the previous.
+        m_repeaterKeyDownRevoker = repeater.KeyDown(winrt::auto_revoke, { this, &RadioButtons::OnRepeaterKeyDown });
+        m_repeaterKeyUpRevoker = repeater.KeyUp(winrt::auto_revoke, { this, &RadioButtons::OnRepeaterKeyUp });
     }
 
+    m_selectedIndex = -1;
     UpdateItemsSource();
+
+    // SelectedItem or SelectedIndex may have been set before there were items to select.
+    if (SelectedItem())
+    {
+        UpdateSelectedItem();
+    }
+    else
+    {
+        UpdateSelectedIndex();
+    }
 }
 
-void RadioButtons::OnListViewLoaded(const winrt::IInspectable& /*sender*/, const winrt::RoutedEventArgs& args)
+void RadioButtons::OnRepeaterElementPrepared(const winrt::ItemsRepeater& /*sender*/, const winrt::ItemsRepeaterElementPreparedEventArgs& args)
 {
-    if (auto listView = m_listView.get())
+    if (auto const toggleButton = args.Element().try_as<winrt::ToggleButton>())
     {
-        m_itemsWrapGrid.set(SharedHelpers::FindInVisualTreeByType<winrt::ItemsWrapGrid>(listView));
-        if (auto itemsWrapGrid = m_itemsWrapGrid.get())
-        {
-            // Override normal up/down behavior -- down should always go to the next item and up to the previous.
-            m_listViewKeyDownRevoker = itemsWrapGrid.KeyDown(winrt::auto_revoke, { this, &RadioButtons::OnListViewKeyDown });
-            m_listViewKeyUpRevoker = itemsWrapGrid.KeyUp(winrt::auto_revoke, { this, &RadioButtons::OnListViewKeyUp });
+        m_childCheckedRevokers[winrt::get_abi(toggleButton)] = toggleButton.Checked(winrt::auto_revoke, { this, &RadioButtons::OnChildChecked });
 
-            UpdateSelectedIndex();
-            UpdateSelectedItem();
-            UpdateMaximumColumns();
+        // Setting IsChecked to true raises Checked, which finds the element already selected.
+        toggleButton.IsChecked(args.Index() == m_selectedIndex);
+    }
+}
+
+void RadioButtons::OnRepeaterElementClearing(const winrt::ItemsRepeater& /*sender*/, const winrt::ItemsRepeaterElementClearingEventArgs& args)
+{
+    if (auto const toggleButton = args.Element().try_as<winrt::ToggleButton>())
+    {
+        m_childCheckedRevokers.erase(winrt::get_abi(toggleButton));
+
+        // All items are realized, so an element is only cleared when its item goes away.
+        if (toggleButton.IsChecked() && toggleButton.IsChecked().Value())
+        {
+            toggleButton.IsChecked(false);
+            m_selectedIndex = -1;
+            SetSelectionProperties(-1, nullptr);
         }
     }
 }
 
-void RadioButtons::OnListViewSelectionChanged(const winrt::IInspectable& sender, const winrt::SelectionChangedEventArgs& args)
+void RadioButtons::OnRepeaterElementIndexChanged(const winrt::ItemsRepeater& /*sender*/, const winrt::ItemsRepeaterElementIndexChangedEventArgs& args)
 {
-    if (auto listView = m_listView.get())
+    // Items were inserted or removed in front of the selected one.
+    if (args.OldIndex() == m_selectedIndex)
     {
-        SelectedIndex(listView.SelectedIndex());
-        SelectedItem(listView.SelectedItem());
+        m_selectedIndex = args.NewIndex();
+        SetSelectionProperties(m_selectedIndex, SelectedItem());
     }
+}
 
-    m_selectionChangedEventSource(sender, args);
+void RadioButtons::OnChildChecked(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& /*args*/)
+{
+    if (auto repeater = m_repeater.get())
+    {
+        Select(repeater.GetElementIndex(sender.as<winrt::UIElement>()));
+    }
 }
 
-void RadioButtons::OnListViewKeyDown(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args)
+void RadioButtons::OnRepeaterKeyDown(const winrt::IInspectable& /*sender*/, const winrt::KeyRoutedEventArgs& args)
 {
     if (args.Key() == winrt::VirtualKey::Control)
     {
@@ -77,7 +125,7 @@ void RadioButtons::OnListViewKeyDown(const winrt::IInspectable& sender, const wi
     }
 }
 
-void RadioButtons::OnListViewKeyUp(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args)
+void RadioButtons::OnRepeaterKeyUp(const winrt::IInspectable& /*sender*/, const winrt::KeyRoutedEventArgs& args)
 {
     if (args.Key() == winrt::VirtualKey::Control)
     {
@@ -89,44 +137,32 @@ bool RadioButtons::MoveSelection(int direction)
 {
     bool found = false;
 
-    if (auto listView = m_listView.get())
+    if (auto repeater = m_repeater.get())
     {
-        if (auto focusedElement = winrt::FocusManager::GetFocusedElement())
+        if (auto focusedElement = winrt::FocusManager::GetFocusedElement().try_as<winrt::UIElement>())
         {
-            auto dpElement = focusedElement.as<winrt::DependencyObject>();
-            int focusedIndex = listView.IndexFromContainer(dpElement);
-            
+            int focusedIndex = repeater.GetElementIndex(focusedElement);
+
             if (focusedIndex >= 0)
             {
                 focusedIndex += direction;
 
-                int itemCount = listView.Items().Size();
+                const int itemCount = repeater.ItemsSourceView().Count();
 
                 while (focusedIndex >= 0 && focusedIndex < itemCount)
                 {
-                    if (auto item = listView.Items().GetAt(focusedIndex))
+                    if (auto itemContainerAsControl = repeater.TryGetElement(focusedIndex).try_as<winrt::Control>())
                     {
-                        if (auto itemContainer = listView.ContainerFromItem(item))
+                        if (itemContainerAsControl.IsEnabled())
                         {
-                            if (auto itemContainerAsControl = itemContainer.as<winrt::Control>())
+                            itemContainerAsControl.Focus(winrt::FocusState::Keyboard);
+                            if (!m_isControlDown)
                             {
-                                if (itemContainerAsControl.IsEnabled())
-                                {
-                                    if (m_isControlDown)
-                                    {
-                                        // only move focus
-                                        itemContainerAsControl.Focus(winrt::Windows::UI::Xaml::FocusState::Keyboard);
-                                        found = true;
-                                    }
-                                    else
-                                    {
-                                        // change selection
-                                        listView.SelectedIndex(focusedIndex);
-                                        found = true;
-                                    }
-                                    break;
-                                }
+                                // change selection, otherwise only move focus
+                                Select(focusedIndex);
                             }
+                            found = true;
+                            break;
                         }
                     }
 
@@ -147,10 +183,18 @@ void RadioButtons::OnPropertyChanged(const winrt::DependencyPropertyChangedEvent
     {
         UpdateItemsSource();
     }
+    else if (property == s_ItemTemplateProperty)
+    {
+        UpdateItemTemplate();
+    }
     else if (property == s_MaximumColumnsProperty)
     {
         UpdateMaximumColumns();
     }
+    else if (m_isSettingSelectionProperties)
+    {
+        // Selection properties following m_selectedIndex.
+    }
     else if (property == s_SelectedIndexProperty)
     {
         UpdateSelectedIndex();
@@ -163,63 +207,188 @@ void RadioButtons::OnPropertyChanged(const winrt::DependencyPropertyChangedEvent
 
 void RadioButtons::UpdateItemsSource()
 {
-    if (auto listView = m_listView.get())
+    if (auto repeater = m_repeater.get())
     {
         if (ItemsSource())
         {
-            listView.ItemsSource(ItemsSource());
+            repeater.ItemsSource(ItemsSource());
         }
         else
         {
-            listView.ItemsSource(Items());
+            repeater.ItemsSource(Items());
         }
     }
 }
 
-void RadioButtons::UpdateMaximumColumns()
+void RadioButtons::UpdateItemTemplate()
 {
-    if (auto itemsWrapGrid = m_itemsWrapGrid.get())
+    const auto itemTemplate = ItemTemplate();
+    m_elementFactory->ItemTemplate(itemTemplate);
+
+    // Elements the factory already made keep presenting their item, just with the new template.
+    if (auto repeater = m_repeater.get())
     {
-        itemsWrapGrid.MaximumRowsOrColumns(MaximumColumns());
+        if (auto itemsSourceView = repeater.ItemsSourceView())
+        {
+            const int itemCount = itemsSourceView.Count();
+            for (int i = 0; i < itemCount; i++)
+            {
+                if (auto radioButton = repeater.TryGetElement(i).try_as<winrt::RadioButton>())
+                {
+                    if (radioButton != itemsSourceView.GetAt(i))
+                    {
+                        radioButton.ContentTemplate(itemTemplate);
+                    }
+                }
+            }
+        }
     }
 }
 
-void RadioButtons::UpdateSelectedItem()
+void RadioButtons::UpdateMaximumColumns()
 {
-    if (auto listView = m_listView.get())
+    if (auto repeater = m_repeater.get())
     {
-        // Setting ListView.SelectedItem will not work here in all cases.
-        // The reason why that doesn't work but this does is unknown.
-        auto container = listView.ContainerFromItem(SelectedItem());
-        if (auto lvi = container.as<winrt::ListViewItem>())
+        if (auto layout = repeater.Layout().try_as<winrt::RadioButtonsGridLayout>())
         {
-            lvi.IsSelected(true);
+            layout.MaximumColumns(MaximumColumns());
         }
     }
 }
 
+void RadioButtons::UpdateSelectedItem()
+{
+    if (m_repeater)
+    {
+        Select(IndexOfItem(SelectedItem()));
+    }
+}
+
 void RadioButtons::UpdateSelectedIndex()
 {
-    if (auto listView = m_listView.get())
+    if (m_repeater)
     {
-        listView.SelectedIndex(SelectedIndex());
+        Select(SelectedIndex());
     }
 }
 
-winrt::DependencyObject RadioButtons::ContainerFromItem(winrt::IInspectable const& item)
+void RadioButtons::Select(int index)
 {
-    if (auto listView = m_listView.get())
+    auto repeater = m_repeater.get();
+    auto itemsSourceView = repeater ? repeater.ItemsSourceView() : nullptr;
+    if (!itemsSourceView)
     {
-        return listView.ContainerFromItem(item);
+        return;
     }
-    return nullptr;
+
+    const int itemCount = itemsSourceView.Count();
+    if (index < 0 || index >= itemCount)
+    {
+        index = -1;
+    }
+
+    if (index == m_selectedIndex)
+    {
+        // Nothing changed, but SelectedIndex or SelectedItem could have been set to another item that isn't there.
+        SetSelectionProperties(m_selectedIndex, m_selectedIndex >= 0 ? itemsSourceView.GetAt(m_selectedIndex) : nullptr);
+        return;
+    }
+
+    auto removedItems = winrt::make<Vector<winrt::IInspectable>>();
+    auto addedItems = winrt::make<Vector<winrt::IInspectable>>();
+
+    const int previousIndex = m_selectedIndex;
+    m_selectedIndex = index;
+
+    if (previousIndex >= 0 && previousIndex < itemCount)
+    {
+        removedItems.Append(itemsSourceView.GetAt(previousIndex));
+        if (auto toggleButton = repeater.TryGetElement(previousIndex).try_as<winrt::ToggleButton>())
+        {
+            toggleButton.IsChecked(false);
+        }
+    }
+
+    winrt::IInspectable selectedItem{ nullptr };
+    if (index >= 0)
+    {
+        selectedItem = itemsSourceView.GetAt(index);
+        addedItems.Append(selectedItem);
+        if (auto toggleButton = repeater.TryGetElement(index).try_as<winrt::ToggleButton>())
+        {
+            toggleButton.IsChecked(true);
+        }
+    }
+
+    SetSelectionProperties(index, selectedItem);
+
+    m_selectionChangedEventSource(*this, winrt::SelectionChangedEventArgs(removedItems, addedItems));
+}
+
+void RadioButtons::SetSelectionProperties(int index, winrt::IInspectable const& item)
+{
+    auto scopeGuard = gsl::finally([this, wasSetting = m_isSettingSelectionProperties]()
+    {
+        m_isSettingSelectionProperties = wasSetting;
+    });
+    m_isSettingSelectionProperties = true;
+
+    SelectedIndex(index);
+    SelectedItem(item);
+}
+
+int RadioButtons::IndexOfItem(winrt::IInspectable const& item)
+{
+    if (!item)
+    {
+        return -1;
+    }
+
+    if (auto repeater = m_repeater.get())
+    {
+        if (auto itemsSourceView = repeater.ItemsSourceView())
+        {
+            auto inspectingDataSource = static_cast<InspectingDataSource*>(winrt::get_self<ItemsSourceView>(itemsSourceView));
+            const int index = inspectingDataSource->IndexOf(item);
+            if (index >= 0)
+            {
+                return index;
+            }
+
+            // Strings are usually boxed again on their way in, compare them by value.
+            auto itemAsPropertyValue = item.try_as<winrt::IPropertyValue>();
+            if (itemAsPropertyValue && itemAsPropertyValue.Type() == winrt::PropertyType::String)
+            {
+                const auto itemAsString = itemAsPropertyValue.GetString();
+                const int itemCount = itemsSourceView.Count();
+                for (int i = 0; i < itemCount; i++)
+                {
+                    auto candidate = itemsSourceView.GetAt(i).try_as<winrt::IPropertyValue>();
+                    if (candidate && candidate.Type() == winrt::PropertyType::String && candidate.GetString() == itemAsString)
+                    {
+                        return i;
+                    }
+                }
+            }
+        }
+    }
+
+    return -1;
+}
+
+winrt::DependencyObject RadioButtons::ContainerFromItem(winrt::IInspectable const& item)
+{
+    return ContainerFromIndex(IndexOfItem(item));
 }
 
 winrt::DependencyObject RadioButtons::ContainerFromIndex(int index)
 {
-    if (auto listView = m_listView.get())
+    if (auto repeater = m_repeater.get())
     {
-        return listView.ContainerFromIndex(index);
+        if (index >= 0)
+        {
+            return repeater.TryGetElement(index);
+        }
     }
     return nullptr;
 }
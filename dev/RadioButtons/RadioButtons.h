@@ -8,6 +8,7 @@
 
 #include "RadioButtons.g.h"
 #include "RadioButtons.properties.h"
+#include "RadioButtonsElementFactory.h"
 
 class RadioButtons :
     public ReferenceTracker<RadioButtons, winrt::implementation::RadioButtonsT>,
@@ -27,26 +28,40 @@ public:
     void OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
 
 private:
-    void OnListViewLoaded(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
-    void OnListViewSelectionChanged(const winrt::IInspectable& sender, const winrt::SelectionChangedEventArgs& args);
-    void OnListViewKeyDown(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args);
-    void OnListViewKeyUp(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args);
+    void OnRepeaterElementPrepared(const winrt::ItemsRepeater& sender, const winrt::ItemsRepeaterElementPreparedEventArgs& args);
+    void OnRepeaterElementClearing(const winrt::ItemsRepeater& sender, const winrt::ItemsRepeaterElementClearingEventArgs& args);
+    void OnRepeaterElementIndexChanged(const winrt::ItemsRepeater& sender, const winrt::ItemsRepeaterElementIndexChangedEventArgs& args);
+    void OnRepeaterKeyDown(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args);
+    void OnRepeaterKeyUp(const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args);
+    void OnChildChecked(const winrt::IInspectable& sender, const winrt::RoutedEventArgs& args);
 
     void UpdateItemsSource();
+    void UpdateItemTemplate();
     void UpdateMaximumColumns();
 
     void UpdateSelectedItem();
     void UpdateSelectedIndex();
+    void Select(int index);
+    void SetSelectionProperties(int index, winrt::IInspectable const& item);
+    int IndexOfItem(winrt::IInspectable const& item);
 
     bool MoveSelection(int direction);
 
     bool m_isControlDown{ false };
 
-    tracker_ref<winrt::ListView> m_listView{ this };
-    tracker_ref<winrt::ItemsWrapGrid> m_itemsWrapGrid{ this };
+    // Index of the item whose RadioButton is checked, SelectedIndex follows it.
+    int m_selectedIndex{ -1 };
+    bool m_isSettingSelectionProperties{ false };
 
-    winrt::Control::Loaded_revoker m_listViewLoadedRevoker{};
-    winrt::Selector::SelectionChanged_revoker m_listViewSelectionChangedRevoker{};
-    winrt::Control::KeyDown_revoker m_listViewKeyDownRevoker{};
-    winrt::Control::KeyUp_revoker m_listViewKeyUpRevoker{};
+    tracker_ref<winrt::ItemsRepeater> m_repeater{ this };
+    winrt::com_ptr<RadioButtonsElementFactory> m_elementFactory{ nullptr };
+
+    winrt::ItemsRepeater::ElementPrepared_revoker m_repeaterElementPreparedRevoker{};
+    winrt::ItemsRepeater::ElementClearing_revoker m_repeaterElementClearingRevoker{};
+    winrt::ItemsRepeater::ElementIndexChanged_revoker m_repeaterElementIndexChangedRevoker{};
+    winrt::UIElement::KeyDown_revoker m_repeaterKeyDownRevoker{};
+    winrt::UIElement::KeyUp_revoker m_repeaterKeyUpRevoker{};
+
+    // Keyed by the element, the children of the repeater come and go with the items.
+    std::map<void*, winrt::ToggleButton::Checked_revoker> m_childCheckedRevokers;
 };
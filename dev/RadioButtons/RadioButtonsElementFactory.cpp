@@ -0,0 +1,43 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "RadioButtonsElementFactory.h"
+
+void RadioButtonsElementFactory::ItemTemplate(winrt::DataTemplate const& itemTemplate)
+{
+    m_itemTemplate = itemTemplate;
+}
+
+#pragma region IElementFactory
+
+winrt::UIElement RadioButtonsElementFactory::GetElement(winrt::ElementFactoryGetArgs const& args)
+{
+    auto const data = args.Data();
+    if (auto const radioButton = data.try_as<winrt::RadioButton>())
+    {
+        return radioButton;
+    }
+
+    winrt::RadioButton radioButton;
+    radioButton.Content(data);
+    radioButton.ContentTemplate(m_itemTemplate);
+    return radioButton;
+}
+
+void RadioButtonsElementFactory::RecycleElement(winrt::ElementFactoryRecycleArgs const& args)
+{
+    // Nothing is pooled, RadioButtons keeps all of its few items realized and only
+    // lets go of an element when its item is removed.
+    if (auto const parent = args.Parent().try_as<winrt::Panel>())
+    {
+        uint32_t childIndex = 0;
+        if (parent.Children().IndexOf(args.Element(), childIndex))
+        {
+            parent.Children().RemoveAt(childIndex);
+        }
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,26 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "common.h"
+
+// Element factory of the ItemsRepeater in the RadioButtons template. Items that are
+// RadioButtons already are used as they are, anything else gets a RadioButton which
+// presents the item with the control's ItemTemplate.
+class RadioButtonsElementFactory :
+    public winrt::implements<RadioButtonsElementFactory, winrt::IElementFactoryShim>
+{
+public:
+    RadioButtonsElementFactory() {}
+
+    void ItemTemplate(winrt::DataTemplate const& itemTemplate);
+
+#pragma region IElementFactory
+    winrt::UIElement GetElement(winrt::ElementFactoryGetArgs const& args);
+    void RecycleElement(winrt::ElementFactoryRecycleArgs const& args);
+#pragma endregion
+
+private:
+    winrt::DataTemplate m_itemTemplate{ nullptr };
+};
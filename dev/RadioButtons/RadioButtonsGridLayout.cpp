@@ -0,0 +1,83 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "RadioButtonsGridLayout.h"
+
+CppWinRTActivatableClassWithBasicFactory(RadioButtonsGridLayout);
+
+int RadioButtonsGridLayout::MaximumColumns()
+{
+    return m_maximumColumns;
+}
+
+void RadioButtonsGridLayout::MaximumColumns(int value)
+{
+    const int maximumColumns = std::max(1, value);
+    if (m_maximumColumns != maximumColumns)
+    {
+        m_maximumColumns = maximumColumns;
+        InvalidateMeasure();
+    }
+}
+
+#pragma region IVirtualizingLayoutOverrides
+
+winrt::Size RadioButtonsGridLayout::MeasureOverride(
+    winrt::VirtualizingLayoutContext const& context,
+    winrt::Size const& availableSize)
+{
+    const int itemCount = context.ItemCount();
+    const int columnCount = GetColumnCount(itemCount);
+    const int rowCount = (itemCount + columnCount - 1) / columnCount;
+
+    const winrt::Size itemAvailableSize{
+        std::isinf(availableSize.Width) ? availableSize.Width : availableSize.Width / columnCount,
+        std::numeric_limits<float>::infinity() };
+
+    m_largestItemSize = {};
+    for (int i = 0; i < itemCount; i++)
+    {
+        auto element = context.GetOrCreateElementAt(i);
+        element.Measure(itemAvailableSize);
+
+        const auto desiredSize = element.DesiredSize();
+        m_largestItemSize.Width = std::max(m_largestItemSize.Width, desiredSize.Width);
+        m_largestItemSize.Height = std::max(m_largestItemSize.Height, desiredSize.Height);
+    }
+
+    return {
+        m_largestItemSize.Width * columnCount,
+        m_largestItemSize.Height * rowCount };
+}
+
+winrt::Size RadioButtonsGridLayout::ArrangeOverride(
+    winrt::VirtualizingLayoutContext const& context,
+    winrt::Size const& finalSize)
+{
+    const int itemCount = context.ItemCount();
+    const int columnCount = GetColumnCount(itemCount);
+
+    for (int i = 0; i < itemCount; i++)
+    {
+        const int row = i / columnCount;
+        const int column = i % columnCount;
+
+        auto element = context.GetOrCreateElementAt(i);
+        element.Arrange({
+            column * m_largestItemSize.Width,
+            row * m_largestItemSize.Height,
+            m_largestItemSize.Width,
+            m_largestItemSize.Height });
+    }
+
+    return finalSize;
+}
+
+#pragma endregion
+
+int RadioButtonsGridLayout::GetColumnCount(int itemCount)
+{
+    return std::max(1, std::min(m_maximumColumns, itemCount));
+}
@@ -0,0 +1,35 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "VirtualizingLayout.h"
+#include "RadioButtonsGridLayout.g.h"
+
+// Arranges the items of a RadioButtons in rows of at most MaximumColumns cells, every cell
+// as large as the largest item. This matches the ItemsWrapGrid the control used to host.
+// RadioButtons only ever holds a handful of items, so all of them are realized.
+class RadioButtonsGridLayout :
+    public ReferenceTracker<RadioButtonsGridLayout, winrt::implementation::RadioButtonsGridLayoutT, VirtualizingLayout>
+{
+public:
+    RadioButtonsGridLayout() {}
+
+    int MaximumColumns();
+    void MaximumColumns(int value);
+
+#pragma region IVirtualizingLayoutOverrides
+    winrt::Size MeasureOverride(
+        winrt::VirtualizingLayoutContext const& context,
+        winrt::Size const& availableSize);
+    winrt::Size ArrangeOverride(
+        winrt::VirtualizingLayoutContext const& context,
+        winrt::Size const& finalSize);
+#pragma endregion
+
+private:
+    int GetColumnCount(int itemCount);
+
+    int m_maximumColumns{ 1 };
+    winrt::Size m_largestItemSize{};
+};
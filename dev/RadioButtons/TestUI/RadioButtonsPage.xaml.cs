@@ -39,7 +39,7 @@ namespace MUXControlsTestApp
 
         private void RadioButtonsLoaded(object sender, RoutedEventArgs e)
         {
-            ((ListViewItem)RadioButtons.ContainerFromIndex(2)).IsEnabled = false;
+            ((Control)RadioButtons.ContainerFromIndex(2)).IsEnabled = false;
         }
 
         private void SelectItemBlue_Click(object sender, RoutedEventArgs e)
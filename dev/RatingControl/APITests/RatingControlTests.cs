@@ -11,6 +11,7 @@ using MUXControlsTestApp.Utilities;
 
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Controls;
+using Windows.UI.Xaml.Media;
 using Windows.UI.Xaml.Media.Imaging;
 using Common;
 
@@ -132,5 +133,59 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 Verify.AreEqual(ratingControl.Value, 1.0, "Should coerce set Value above MaxRating back to MaxRating");
             });
         }
+
+        [TestMethod]
+        public void VerifyReadOnlyGlyphsUseSingleItemPerLayer()
+        {
+            RatingControl ratingControl = null;
+            RunOnUIThread.Execute(() =>
+            {
+                ratingControl = new RatingControl();
+                ratingControl.IsReadOnly = true;
+                ratingControl.Value = 3.5;
+                MUXControlsTestApp.App.TestContentRoot = ratingControl;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                var backgroundStackPanel = (StackPanel)FindVisualChildByName(ratingControl, "RatingBackgroundStackPanel");
+                var foregroundStackPanel = (StackPanel)FindVisualChildByName(ratingControl, "RatingForegroundStackPanel");
+                Verify.AreEqual(1, backgroundStackPanel.Children.Count);
+                Verify.AreEqual(1, foregroundStackPanel.Children.Count);
+                Verify.AreEqual(ratingControl.MaxRating, ((TextBlock)foregroundStackPanel.Children[0]).Text.Length);
+
+                ratingControl.IsReadOnly = false;
+                Verify.AreEqual(ratingControl.MaxRating, backgroundStackPanel.Children.Count);
+                Verify.AreEqual(ratingControl.MaxRating, foregroundStackPanel.Children.Count);
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
+        private static DependencyObject FindVisualChildByName(FrameworkElement parent, string name)
+        {
+            if (parent.Name == name)
+            {
+                return parent;
+            }
+
+            int childrenCount = VisualTreeHelper.GetChildrenCount(parent);
+            for (int i = 0; i < childrenCount; i++)
+            {
+                FrameworkElement childAsFE = VisualTreeHelper.GetChild(parent, i) as FrameworkElement;
+                if (childAsFE != null)
+                {
+                    DependencyObject result = FindVisualChildByName(childAsFE, name);
+                    if (result != null)
+                    {
+                        return result;
+                    }
+                }
+            }
+
+            return null;
+        }
     }
 }
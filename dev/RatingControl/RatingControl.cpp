@@ -6,6 +6,7 @@
 #include "RatingControl.h"
 #include "RatingControlAutomationPeer.h"
 #include "RuntimeProfiler.h"
+#include "StartupTrace.h"
 
 #include <RatingItemFontInfo.h>
 #include <RatingItemImageInfo.h>
@@ -48,6 +49,8 @@ float RatingControl::ActualRatingFontSize()
 
 void RatingControl::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"RatingControl");
+
     RecycleEvents();
 
     // Retrieve pointers to stable controls 
@@ -145,6 +148,12 @@ void RatingControl::StampOutRatingItems()
         return;
     }
 
+    // A read-only control never scales its stars, so when they're glyphs a single TextBlock per layer
+    // can draw all of them. Item spacing then comes from CharacterSpacing and the foreground can be cut
+    // with one clip, rather than stamping out MaxRating elements per layer. This matters in lists and
+    // grids that show many ratings at once.
+    m_isCompactRendering = IsReadOnly() && IsItemInfoPresentAndFontInfo();
+
     // Background initialization:
 
     m_backgroundStackPanel.get().Children().Clear();
@@ -233,6 +242,32 @@ void RatingControl::UpdateRatingItemsAppearance()
             CustomizeStackPanel(m_foregroundStackPanel.get(), RatingControlStates::Disabled);
         }
 
+        if (m_isCompactRendering)
+        {
+            // The glyphs are laid out at their actual size, (rating size + item spacing) apart.
+            const double wholeStars = floor(value);
+            const double clipWidth = value > 0.0 ?
+                (wholeStars * (ActualRatingFontSize() + c_itemSpacing)) + ((value - wholeStars) * ActualRatingFontSize()) :
+                0.0;
+
+            winrt::Rect rect;
+            rect.X = 0;
+            rect.Y = 0;
+            rect.Height = RenderingRatingFontSize();
+            rect.Width = static_cast<float>(clipWidth);
+
+            winrt::RectangleGeometry rg;
+            rg.Rect(rect);
+
+            for (const auto& uiElement : m_foregroundStackPanel.get().Children())
+            {
+                uiElement.as<winrt::UIElement>().Clip(rg);
+            }
+
+            ResetControlWidth();
+            return;
+        }
+
         unsigned int i = 0;
         for (const auto& uiElement : m_foregroundStackPanel.get().Children())
         {
@@ -297,13 +332,17 @@ void RatingControl::PopulateStackPanelWithItems(wstring_view templateName, winrt
     winrt::IInspectable lookup = winrt::Application::Current().Resources().Lookup(box_value(templateName));
     auto dt = lookup.as<winrt::DataTemplate>();
 
-    for (int i = 0; i < MaxRating(); i++)
+    const int itemCount = m_isCompactRendering ? 1 : MaxRating();
+    for (int i = 0; i < itemCount; i++)
     {
         if (auto ui = safe_cast<winrt::UIElement>(dt.LoadContent()))
         {
             CustomizeRatingItem(ui, state);
             stackPanel.Children().Append(ui);
-            ApplyScaleExpressionAnimation(ui, i);
+            if (!m_isCompactRendering)
+            {
+                ApplyScaleExpressionAnimation(ui, i);
+            }
         }
     }
 }
@@ -315,7 +354,14 @@ void RatingControl::CustomizeRatingItem(winrt::UIElement ui, RatingControlStates
         if (auto textBlock = ui.as<winrt::TextBlock>())
         {
             textBlock.FontFamily(FontFamily());
-            textBlock.Text(GetAppropriateGlyph(type));
+            if (m_isCompactRendering)
+            {
+                CustomizeCompactRatingItem(textBlock, type);
+            }
+            else
+            {
+                textBlock.Text(GetAppropriateGlyph(type));
+            }
         }
     }
     else if (IsItemInfoPresentAndImageInfo())
@@ -334,6 +380,31 @@ void RatingControl::CustomizeRatingItem(winrt::UIElement ui, RatingControlStates
 
 }
 
+void RatingControl::CustomizeCompactRatingItem(const winrt::TextBlock& textBlock, RatingControlStates type)
+{
+    const winrt::hstring glyph = GetAppropriateGlyph(type);
+    std::wstring glyphs;
+    glyphs.reserve(glyph.size() * MaxRating());
+    for (int i = 0; i < MaxRating(); i++)
+    {
+        glyphs.append(glyph);
+    }
+    textBlock.Text(glyphs);
+
+    // The template items are rendered at double size and scaled down by the scale expression,
+    // here the text is drawn at its actual size instead. RenderingRatingFontSize already accounts
+    // for the text scale factor, so it must not be applied again.
+    const float fontSize = ActualRatingFontSize();
+    textBlock.IsTextScaleFactorEnabled(false);
+    textBlock.FontSize(fontSize);
+    textBlock.CharacterSpacing(static_cast<int32_t>(1000 * c_itemSpacing / fontSize)); // in 1/1000 em
+
+    // Puts the glyphs where the resting scale of 0.5 around the animation center point puts the template items.
+    const double templateItemOffset = -8.0;
+    const double topOffset = templateItemOffset + (c_defaultRatingFontSizeForRendering * c_verticalScaleAnimationCenterPoint * 0.5);
+    textBlock.Margin({ 0, topOffset, 0, 0 });
+}
+
 void RatingControl::CustomizeStackPanel(winrt::StackPanel stackPanel, RatingControlStates state)
 {
     for (winrt::UIElement child : stackPanel.Children())
@@ -604,7 +675,8 @@ void RatingControl::OnFontFamilyChanged(const winrt::DependencyObject& /*sender*
 {
     if (m_backgroundStackPanel) // We don't want to do this for the initial property set
     {
-        for (int i = 0; i < MaxRating(); i++)
+        const int itemCount = static_cast<int>(m_backgroundStackPanel.get().Children().Size());
+        for (int i = 0; i < itemCount; i++)
         {
             // FUTURE: handle image rating items
             if (auto backgroundTB = safe_cast<winrt::TextBlock>(m_backgroundStackPanel.get().Children().GetAt(i)))
@@ -635,6 +707,11 @@ void RatingControl::OnIsClearEnabledChanged(const winrt::DependencyPropertyChang
 void RatingControl::OnIsReadOnlyChanged(const winrt::DependencyPropertyChangedEventArgs& /*args*/)
 {
     // TODO: Colour changes - see spec
+
+    if (m_isCompactRendering != (IsReadOnly() && IsItemInfoPresentAndFontInfo()))
+    {
+        StampOutRatingItems();
+    }
 }
 
 void RatingControl::OnItemInfoChanged(const winrt::DependencyPropertyChangedEventArgs& /*args*/)
@@ -668,11 +745,8 @@ void RatingControl::OnItemInfoChanged(const winrt::DependencyPropertyChangedEven
     // Or if we just stamped them out
     if (m_backgroundStackPanel && !changedType)
     {
-        for (int i = 0; i < MaxRating(); i++)
-        {
-            CustomizeRatingItem(m_backgroundStackPanel.get().Children().GetAt(i), RatingControlStates::Unset);
-            CustomizeRatingItem(m_foregroundStackPanel.get().Children().GetAt(i), RatingControlStates::Set);
-        }
+        CustomizeStackPanel(m_backgroundStackPanel.get(), RatingControlStates::Unset);
+        CustomizeStackPanel(m_foregroundStackPanel.get(), RatingControlStates::Set);
     }
 
     UpdateRatingItemsAppearance();
@@ -88,6 +88,7 @@ private:
     void ApplyScaleExpressionAnimation(const winrt::UIElement& uiElement, int starIndex);
     void PopulateStackPanelWithItems(wstring_view templateName, winrt::StackPanel stackPanel, RatingControlStates state);
     void CustomizeRatingItem(winrt::UIElement ui, RatingControlStates type);
+    void CustomizeCompactRatingItem(const winrt::TextBlock& textBlock, RatingControlStates type);
     void CustomizeStackPanel(winrt::StackPanel stackPanel, RatingControlStates state);
     inline bool IsItemInfoPresentAndFontInfo()
     {
@@ -140,6 +141,9 @@ private:
 
     RatingInfoType m_infoType{ RatingInfoType::Font };
 
+    // All glyphs of a layer are drawn by a single TextBlock, see StampOutRatingItems.
+    bool m_isCompactRendering{ false };
+
     // Holds the value of the Rating control at the moment of engagement,
     // used to handle cancel-disengagements where we reset the value.
     double m_preEngagementValue{ 0.0 };
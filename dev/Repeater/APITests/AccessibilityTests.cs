@@ -12,6 +12,7 @@ using Windows.Foundation;
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Automation;
 using Windows.UI.Xaml.Automation.Peers;
+using Windows.UI.Xaml.Automation.Provider;
 using Windows.UI.Xaml.Controls;
 using Common;
 
@@ -31,6 +32,7 @@ using ItemsSourceView = Microsoft.UI.Xaml.Controls.ItemsSourceView;
 using ElementFactory = Microsoft.UI.Xaml.Controls.ElementFactory;
 using VirtualizingLayoutContext = Microsoft.UI.Xaml.Controls.VirtualizingLayoutContext;
 using RepeaterAutomationPeer = Microsoft.UI.Xaml.Controls.RepeaterAutomationPeer;
+using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 #endif
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -94,6 +96,91 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateChildrenPeersStayInIndexOrderAfterInsert()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<string>(Enumerable.Range(0, 2).Select(i => string.Format("Item #{0}", i)));
+                var dataSource = MockItemsSource.CreateDataSource(data, supportsUniqueIds: false);
+
+                var mapping = new Dictionary<int, UIElement>
+                {
+                    { 0, new ListViewItem() },
+                    { 1, new ListViewItem() },
+                };
+                var firstElement = mapping[0];
+                var secondElement = mapping[1];
+
+                var elementFactory = MockElementFactory.CreateElementFactory(mapping);
+                var layout = new MockVirtualizingLayout
+                {
+                    MeasureLayoutFunc = (availableSize, context) =>
+                    {
+                        var ctx = (VirtualizingLayoutContext)context;
+
+                        // Realize the elements from the last to the first.
+                        for (int i = ctx.ItemCount - 1; i >= 0; --i)
+                        {
+                            ctx.GetOrCreateElementAt(i);
+                        }
+
+                        return default(Size);
+                    }
+                };
+
+                var repeater = CreateRepeater(dataSource, elementFactory, layout);
+
+                Content = repeater;
+                repeater.UpdateLayout();
+
+                // The existing elements move to indices 1 and 2, the new item gets a new element.
+                var insertedElement = new ListViewItem();
+                mapping[0] = insertedElement;
+                data.Insert(0, "Inserted item");
+                repeater.UpdateLayout();
+
+                var peer = FrameworkElementAutomationPeer.CreatePeerForElement(repeater);
+                var children = peer.GetChildren().Select(p => ((FrameworkElementAutomationPeer)p).Owner).ToList();
+
+                Verify.AreEqual(3, children.Count);
+                Verify.AreEqual(insertedElement, children[0]);
+                Verify.AreEqual(firstElement, children[1]);
+                Verify.AreEqual(secondElement, children[2]);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateFindItemByPropertyRealizesOnlyTheFoundItem()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<string>(Enumerable.Range(0, 1000).Select(i => string.Format("Item #{0}", i)));
+                var dataSource = MockItemsSource.CreateDataSource(data, supportsUniqueIds: false);
+                var elementFactory = new MockElementFactory
+                {
+                    GetElementFunc = (index, owner) => new TextBlock { Text = data[index], Height = 50 }
+                };
+
+                var repeater = CreateRepeater(dataSource, elementFactory, new StackLayout());
+                Content = new ScrollViewer { Content = repeater, Height = 200 };
+                Content.UpdateLayout();
+
+                Verify.IsNull(repeater.TryGetElement(500));
+
+                var peer = FrameworkElementAutomationPeer.CreatePeerForElement(repeater);
+                var itemContainer = (IItemContainerProvider)peer.GetPattern(PatternInterface.ItemContainer);
+                Verify.IsNotNull(itemContainer);
+
+                var found = itemContainer.FindItemByProperty(null, AutomationElementIdentifiers.NameProperty, "Item #500");
+                Verify.IsNotNull(found);
+                Verify.IsNotNull(repeater.TryGetElement(500));
+                Verify.IsNull(repeater.TryGetElement(499));
+
+                Verify.IsNull(itemContainer.FindItemByProperty(null, AutomationElementIdentifiers.NameProperty, "Not an item"));
+            });
+        }
+
         private ItemsRepeater CreateRepeater(object dataSource, object elementFactory, VirtualizingLayout layout = null)
         {
             var repeater = new ItemsRepeater
@@ -0,0 +1,95 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using System;
+using System.Collections.Generic;
+using Windows.Foundation;
+using Windows.UI.Xaml;
+using Windows.UI.Xaml.Controls;
+
+#if !BUILD_WINDOWS
+using ElementRealizationOptions = Microsoft.UI.Xaml.Controls.ElementRealizationOptions;
+using VirtualizingLayoutContext = Microsoft.UI.Xaml.Controls.VirtualizingLayoutContext;
+#endif
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common.Mocks
+{
+    // A layout context that is not backed by an ItemsRepeater. Elements are plain
+    // Borders sized by ElementSizeFunc and recycled into a local pool, which lets
+    // tests drive a layout's Measure/Arrange directly without a visual tree.
+    class MockVirtualizingLayoutContext : VirtualizingLayoutContext
+    {
+        private readonly Stack<Border> _recycledElements = new Stack<Border>();
+        private Point _layoutOrigin;
+
+        public int Count { get; set; }
+        public Rect RealizationWindow { get; set; }
+        public int AnchorIndex { get; set; } = -1;
+        public Func<int, Size> ElementSizeFunc { get; set; }
+
+        public int ElementsCreated { get; private set; }
+        public int ElementsRealized { get; private set; }
+        public int ElementsRecycled { get; private set; }
+        public int LastRealizedIndex { get; private set; } = -1;
+
+        public void ResetCounters()
+        {
+            ElementsRealized = 0;
+            ElementsRecycled = 0;
+        }
+
+        protected override int ItemCountCore()
+        {
+            return Count;
+        }
+
+        protected override object GetItemAtCore(int index)
+        {
+            return index;
+        }
+
+        protected override Rect RealizationRectCore()
+        {
+            return RealizationWindow;
+        }
+
+        protected override UIElement GetElementAtCore(int index, ElementRealizationOptions options)
+        {
+            Border element;
+            if (_recycledElements.Count > 0)
+            {
+                element = _recycledElements.Pop();
+            }
+            else
+            {
+                element = new Border();
+                ++ElementsCreated;
+            }
+
+            var size = ElementSizeFunc != null ? ElementSizeFunc(index) : new Size(100, 100);
+            element.Width = size.Width;
+            element.Height = size.Height;
+            element.Tag = index;
+            ++ElementsRealized;
+            LastRealizedIndex = index;
+            return element;
+        }
+
+        protected override void RecycleElementCore(UIElement element)
+        {
+            _recycledElements.Push((Border)element);
+            ++ElementsRecycled;
+        }
+
+        protected override int RecommendedAnchorIndexCore
+        {
+            get { return AnchorIndex; }
+        }
+
+        protected override Point LayoutOriginCore
+        {
+            get { return _layoutOrigin; }
+            set { _layoutOrigin = value; }
+        }
+    }
+}
@@ -0,0 +1,92 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using MUXControlsTestApp.Utilities;
+using System;
+using System.Collections.Generic;
+using System.Collections.Specialized;
+using System.Linq;
+using System.Threading;
+using Common;
+
+#if USING_TAEF
+using WEX.TestExecution;
+using WEX.TestExecution.Markup;
+using WEX.Logging.Interop;
+#else
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
+#endif
+
+#if !BUILD_WINDOWS
+using DiffingItemsSourceView = Microsoft.UI.Xaml.Controls.DiffingItemsSourceView;
+#endif
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
+{
+    [TestClass]
+    public class DiffingItemsSourceViewTests
+    {
+        [TestMethod]
+        public void ValidateSnapshotsAreAppliedAsRangeChanges()
+        {
+            DiffingItemsSourceView dataSource = null;
+            var recordedArgs = new List<NotifyCollectionChangedEventArgs>();
+            var updateApplied = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                dataSource = new DiffingItemsSourceView(item => (string)item);
+                dataSource.CollectionChanged += (sender, args) => recordedArgs.Add(args);
+                dataSource.UpdateApplied += (sender, args) => updateApplied.Set();
+
+                // The first snapshot has nothing to diff against and is added right away.
+                dataSource.UpdateItems(new List<object> { "a", "b", "c", "d", "e" });
+                Verify.IsFalse(dataSource.IsUpdatePending);
+                Verify.AreEqual(5, dataSource.Count);
+                Verify.AreEqual(1, recordedArgs.Count);
+                Verify.AreEqual(NotifyCollectionChangedAction.Add, recordedArgs[0].Action);
+                Verify.AreEqual(5, recordedArgs[0].NewItems.Count);
+                recordedArgs.Clear();
+
+                // 'b' is removed, 'e' moves to the front and 'f' is added.
+                dataSource.UpdateItems(new List<object> { "e", "a", "c", "d", "f" });
+                Verify.IsTrue(dataSource.IsUpdatePending);
+            });
+
+            Verify.IsTrue(updateApplied.WaitOne(TimeSpan.FromSeconds(5)), "Waiting for the snapshot to be applied.");
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsFalse(dataSource.IsUpdatePending);
+                Verify.AreEqual("e,a,c,d,f", string.Join(",", Enumerable.Range(0, dataSource.Count).Select(i => (string)dataSource.GetAt(i))));
+                Verify.AreEqual(2, dataSource.IndexFromKey("c"));
+                Verify.AreEqual("f", dataSource.KeyFromIndex(4));
+
+                // Removes first (back to front), then adds (front to back). No reset.
+                Verify.AreEqual(4, recordedArgs.Count);
+                Verify.AreEqual(NotifyCollectionChangedAction.Remove, recordedArgs[0].Action);
+                Verify.AreEqual(4, recordedArgs[0].OldStartingIndex);
+                Verify.AreEqual(NotifyCollectionChangedAction.Remove, recordedArgs[1].Action);
+                Verify.AreEqual(1, recordedArgs[1].OldStartingIndex);
+                Verify.AreEqual(NotifyCollectionChangedAction.Add, recordedArgs[2].Action);
+                Verify.AreEqual(0, recordedArgs[2].NewStartingIndex);
+                Verify.AreEqual(NotifyCollectionChangedAction.Add, recordedArgs[3].Action);
+                Verify.AreEqual(4, recordedArgs[3].NewStartingIndex);
+                recordedArgs.Clear();
+
+                // Duplicate keys can't be diffed.
+                dataSource.UpdateItems(new List<object> { "a", "a" });
+            });
+
+            Verify.IsTrue(updateApplied.WaitOne(TimeSpan.FromSeconds(5)), "Waiting for the snapshot to be applied.");
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(1, recordedArgs.Count);
+                Verify.AreEqual(NotifyCollectionChangedAction.Reset, recordedArgs[0].Action);
+                Verify.AreEqual(2, dataSource.Count);
+            });
+        }
+    }
+}
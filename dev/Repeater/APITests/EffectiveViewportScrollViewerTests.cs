@@ -564,6 +564,76 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             ValidateRealizedRange(repeater, 19, 26); 
         }
 
+        [TestMethod]
+        public void CanScrollToIndexWithoutRealizingIntermediateItems()
+        {
+            if (!PlatformConfiguration.IsOsVersionGreaterThanOrEqual(OSVersion.Redstone5))
+            {
+                Log.Warning("Skipping since version is less than RS5 and effective viewport is not available below RS5");
+                return;
+            }
+
+            ScrollViewer scroller = null;
+            ItemsRepeater repeater = null;
+            int maxRealizedIndex = -1;
+            var rootLoadedEvent = new AutoResetEvent(initialState: false);
+            var viewChangeCompletedEvent = new AutoResetEvent(initialState: false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 10000),
+                    ItemTemplate = (DataTemplate)XamlReader.Load(
+                        @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'>
+                            <TextBlock Height='50' Text='{Binding}' />
+                        </DataTemplate>"),
+                    Layout = new StackLayout(),
+                    HorizontalCacheLength = 0,
+                    VerticalCacheLength = 0,
+                };
+
+                scroller = new ScrollViewer() { Width = 400, Height = 500, Content = repeater };
+                scroller.ViewChanged += (o, e) =>
+                {
+                    if (!e.IsIntermediate)
+                    {
+                        viewChangeCompletedEvent.Set();
+                    }
+                };
+                repeater.ElementPrepared += (o, e) =>
+                {
+                    if (e.Index < 8000)
+                    {
+                        maxRealizedIndex = Math.Max(maxRealizedIndex, e.Index);
+                    }
+                };
+                scroller.Loaded += delegate { rootLoadedEvent.Set(); };
+                Content = scroller;
+            });
+
+            Verify.IsTrue(rootLoadedEvent.WaitOne(DefaultWaitTimeInMS));
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                repeater.ScrollToIndex(8000, 0.0);
+                repeater.UpdateLayout();
+            });
+
+            Verify.IsTrue(viewChangeCompletedEvent.WaitOne(DefaultWaitTimeInMS));
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(8000 * 50.0, scroller.VerticalOffset);
+                Verify.IsNotNull(repeater.TryGetElement(8000));
+
+                // Only the items of the first page and the destination get realized.
+                Verify.IsLessThan(maxRealizedIndex, 100);
+            });
+        }
+
         private void ValidateRealizedRange(
             ItemsRepeater repeater,
             int expectedFirstItemIndex,
@@ -5,6 +5,7 @@ using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common;
 using MUXControlsTestApp.Utilities;
 using System.Collections.Generic;
 using System.Collections.ObjectModel;
+using System;
 using System.Linq;
 using Windows.Foundation;
 using Windows.UI.Xaml;
@@ -13,6 +14,7 @@ using Windows.UI.Xaml.Markup;
 using System.Threading.Tasks;
 using System.Threading;
 using Windows.UI.Xaml.Media;
+using Windows.UI.Xaml.Hosting;
 using Common;
 
 #if USING_TAEF
@@ -31,6 +33,7 @@ using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 using ScrollAnchorProvider = Microsoft.UI.Xaml.Controls.ScrollAnchorProvider;
 using AnimationContext = Microsoft.UI.Xaml.Controls.AnimationContext;
+using CompositionElementAnimator = Microsoft.UI.Xaml.Controls.CompositionElementAnimator;
 #endif
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -164,6 +167,66 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             Verify.AreEqual(0, boundsChangeCalls.Count);
         }
 
+        [TestMethod]
+        public void ValidateCompositionElementAnimatorHidesRemovedElements()
+        {
+            ItemsRepeater repeater = null;
+            CompositionElementAnimator animator = null;
+            var data = new ObservableCollection<string>(Enumerable.Range(0, 10).Select(i => string.Format("Item #{0}", i)));
+            var hideCompleted = new ManualResetEvent(false);
+            UIElement removedElement = null;
+            UIElement hiddenElement = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                animator = new CompositionElementAnimator();
+                Verify.IsTrue(animator.HasShowAnimation(new Grid(), AnimationContext.CollectionChangeAdd));
+                Verify.IsFalse(animator.HasShowAnimation(new Grid(), AnimationContext.LayoutTransition));
+                Verify.IsTrue(animator.HasHideAnimation(new Grid(), AnimationContext.CollectionChangeRemove));
+                Verify.IsFalse(animator.HasBoundsChangeAnimation(new Grid(), AnimationContext.CollectionChangeAdd, new Rect(0, 0, 10, 10), new Rect(0, 0, 20, 20)));
+
+                animator.HideAnimationCompleted += (sender, element) =>
+                {
+                    hiddenElement = element;
+                    hideCompleted.Set();
+                };
+
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = data,
+                    ItemTemplate = (DataTemplate)XamlReader.Load(
+                        @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'> 
+                              <TextBlock Text='{Binding}' Height='50' />
+                          </DataTemplate>"),
+                    Animator = animator
+                };
+
+                Content = new ScrollViewer
+                {
+                    Width = 400,
+                    Height = 800,
+                    Content = repeater
+                };
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                removedElement = repeater.TryGetElement(0);
+                data.RemoveAt(0);
+            });
+
+            Verify.IsTrue(hideCompleted.WaitOne(TimeSpan.FromSeconds(5)), "Waiting for the hide animation to complete");
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreSame(removedElement, hiddenElement);
+                Verify.AreEqual(1.0f, ElementCompositionPreview.GetElementVisual(hiddenElement).Opacity);
+            });
+        }
+
         struct CallInfo
         {
             public CallInfo(int index, AnimationContext context)
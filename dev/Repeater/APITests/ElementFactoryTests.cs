@@ -275,6 +275,56 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateOverriddenTemplateKeySelectionSkipsEvent()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var evenTemplate = (DataTemplate)XamlReader.Load(
+                        @"<DataTemplate  xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'>
+                            <TextBlock Text='even' />
+                        </DataTemplate>");
+                var oddTemplate = (DataTemplate)XamlReader.Load(
+                        @"<DataTemplate  xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'>
+                            <TextBlock Text='odd' />
+                        </DataTemplate>");
+                ItemsRepeater repeater = null;
+                const int numItems = 10;
+                int selectCount = 0;
+                var elementFactory = new RecyclingElementFactoryDerived()
+                {
+                    Templates = { { "even", evenTemplate }, { "odd", oddTemplate } },
+                    RecyclePool = new RecyclePool(),
+                    SelectTemplateIdFunc = (object data, UIElement owner) =>
+                    {
+                        ++selectCount;
+                        return (int)data % 2 == 0 ? "even" : "odd";
+                    }
+                };
+
+                elementFactory.SelectTemplateKey += delegate (RecyclingElementFactory sender, SelectTemplateEventArgs args)
+                {
+                    Verify.Fail("SelectTemplateKey event should not be raised when OnSelectTemplateKeyCore is overridden");
+                };
+
+                Content = CreateAndInitializeRepeater
+                (
+                   itemsSource: Enumerable.Range(0, numItems),
+                   elementFactory: elementFactory,
+                   layout: new StackLayout(),
+                   repeater: ref repeater
+                );
+
+                Content.UpdateLayout();
+                Verify.AreEqual(numItems, selectCount);
+                for (int i = 0; i < numItems; i++)
+                {
+                    var element = (TextBlock)repeater.TryGetElement(i);
+                    Verify.AreEqual(i % 2 == 0 ? "even" : "odd", element.Text);
+                }
+            });
+        }
+
         [TestMethod]
         public void ValidateDataTemplateAsItemTemplate()
         {
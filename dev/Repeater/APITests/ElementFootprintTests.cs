@@ -0,0 +1,113 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using MUXControlsTestApp.Utilities;
+using System;
+using System.Linq;
+using Windows.UI.Xaml.Controls;
+using Windows.UI.Xaml.Markup;
+using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common;
+
+#if USING_TAEF
+using WEX.TestExecution;
+using WEX.TestExecution.Markup;
+using WEX.Logging.Interop;
+#else
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
+#endif
+
+#if !BUILD_WINDOWS
+using FlowLayout = Microsoft.UI.Xaml.Controls.FlowLayout;
+using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
+using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
+using UniformGridLayout = Microsoft.UI.Xaml.Controls.UniformGridLayout;
+using VirtualizingLayout = Microsoft.UI.Xaml.Controls.VirtualizingLayout;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
+#endif
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
+{
+    // Realizes a small and a large window of elements under each built-in layout and
+    // logs the memory the repeater keeps per realized element for its own bookkeeping
+    // (VirtualizationInfo, the view manager's tables, the layout's realized range...).
+    // The difference between the two windows leaves out the fixed cost of the repeater
+    // itself. Bookkeeping growing past the budget means a regression in one of those
+    // structures.
+    [TestClass]
+    public class ElementFootprintTests : TestsBase
+    {
+        private const int ItemCount = 10000;
+        private const double SmallViewportHeight = 200;
+        private const double LargeViewportHeight = 2000;
+        private const long BookkeepingBytesPerElementBudget = 512;
+
+        [TestMethod]
+        public void MeasureStackLayoutBookkeepingPerElement()
+        {
+            MeasureBookkeepingPerElement("StackLayout", () => new StackLayout());
+        }
+
+        [TestMethod]
+        public void MeasureUniformGridLayoutBookkeepingPerElement()
+        {
+            MeasureBookkeepingPerElement("UniformGridLayout", () => new UniformGridLayout() { MinItemWidth = 100, MinItemHeight = 40 });
+        }
+
+        [TestMethod]
+        public void MeasureFlowLayoutBookkeepingPerElement()
+        {
+            MeasureBookkeepingPerElement("FlowLayout", () => new FlowLayout());
+        }
+
+        private void MeasureBookkeepingPerElement(string layoutName, Func<VirtualizingLayout> createLayout)
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                int smallCount;
+                long smallBytes = RealizeElements(createLayout(), SmallViewportHeight, out smallCount);
+                int largeCount;
+                long largeBytes = RealizeElements(createLayout(), LargeViewportHeight, out largeCount);
+
+                Verify.IsGreaterThan(largeCount, smallCount);
+                long bytesPerElement = (largeBytes - smallBytes) / (largeCount - smallCount);
+                Log.Comment(string.Format(
+                    "{0}: {1} bytes for {2} elements, {3} bytes for {4} elements, {5} bytes per element",
+                    layoutName,
+                    smallBytes,
+                    smallCount,
+                    largeBytes,
+                    largeCount,
+                    bytesPerElement));
+
+                Verify.IsLessThanOrEqual(bytesPerElement, BookkeepingBytesPerElementBudget);
+            });
+        }
+
+        private long RealizeElements(VirtualizingLayout layout, double viewportHeight, out int elementCount)
+        {
+            var repeater = new ItemsRepeater()
+            {
+                ItemsSource = Enumerable.Range(0, ItemCount).ToList(),
+                Layout = layout,
+                ItemTemplate = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'>
+                        <TextBlock Text='{Binding}' Width='100' Height='40' />
+                    </DataTemplate>")
+            };
+
+            Content = new ScrollViewer()
+            {
+                Width = 400,
+                Height = viewportHeight,
+                Content = repeater
+            };
+            Content.UpdateLayout();
+
+            elementCount = repeater.Children.Count;
+            long bytes = RepeaterTestHooks.GetRepeaterEstimatedBookkeepingBytes(repeater);
+            Content = null;
+            return bytes;
+        }
+    }
+}
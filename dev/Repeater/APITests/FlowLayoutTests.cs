@@ -34,6 +34,7 @@ using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
 using ElementFactory = Microsoft.UI.Xaml.Controls.ElementFactory;
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
+using IItemSizeProvider = Microsoft.UI.Xaml.Controls.IItemSizeProvider;
 using FlowLayout = Microsoft.UI.Xaml.Controls.FlowLayout;
 using UniformGridLayout = Microsoft.UI.Xaml.Controls.UniformGridLayout;
 using ScrollAnchorProvider = Microsoft.UI.Xaml.Controls.ScrollAnchorProvider;
@@ -1034,6 +1035,125 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateStackLayoutMeasuredSizeCacheGivesExactExtent()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // The first items are much larger than the rest, so an average based
+                // estimate of the extent is far off once only the first items are realized.
+                var heights = Enumerable.Range(0, 150).Select(i => i < 50 ? 100.0 : 10.0).ToList();
+                var repeater = new ItemsRepeater()
+                {
+                    ItemsSource = heights,
+                    ItemTemplate = GetDataTemplate("<Border Height='{Binding}' />"),
+                    Layout = new StackLayout() { IsMeasuredSizeCacheEnabled = true },
+                    HorizontalCacheLength = 0,
+                    VerticalCacheLength = 0,
+                };
+
+                var scrollViewer = new ScrollViewer()
+                {
+                    Content = repeater,
+                    Height = 10000
+                };
+
+                Content = new ScrollAnchorProvider()
+                {
+                    Width = 400,
+                    Content = scrollViewer
+                };
+
+                // Realize (and measure) all the items first.
+                Content.UpdateLayout();
+                Verify.AreEqual(heights.Sum(), repeater.DesiredSize.Height);
+
+                scrollViewer.Height = 400;
+                Content.UpdateLayout();
+                Verify.AreEqual(heights.Sum(), repeater.DesiredSize.Height);
+
+                ((StackLayout)repeater.Layout).IsMeasuredSizeCacheEnabled = false;
+                Content.UpdateLayout();
+                Verify.AreNotEqual(heights.Sum(), repeater.DesiredSize.Height);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateStackLayoutItemSizeProviderGivesExactExtent()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var heights = Enumerable.Range(0, 1000).Select(i => i % 10 == 0 ? 100.0 : 10.0).ToList();
+                var sizeProvider = new TestItemSizeProvider(heights);
+                var repeater = new ItemsRepeater()
+                {
+                    ItemsSource = heights,
+                    ItemTemplate = GetDataTemplate("<Border Height='{Binding}' />"),
+                    Layout = new StackLayout() { ItemSizeProvider = sizeProvider },
+                    HorizontalCacheLength = 0,
+                    VerticalCacheLength = 0,
+                };
+
+                var scrollViewer = new ScrollViewer()
+                {
+                    Content = repeater,
+                    Height = 400
+                };
+
+                Content = new ScrollAnchorProvider()
+                {
+                    Width = 400,
+                    Content = scrollViewer
+                };
+
+                // Only the first items are realized, but the extent accounts for every item.
+                Content.UpdateLayout();
+                Verify.AreEqual(heights.Sum(), repeater.DesiredSize.Height);
+                Verify.IsLessThan(repeater.Children.Count, 100);
+                Verify.AreEqual(1, sizeProvider.RequestCount);
+
+                // Replacing the source drops the known sizes and asks for them again.
+                heights.AddRange(Enumerable.Repeat(20.0, 10));
+                repeater.ItemsSource = null;
+                repeater.ItemsSource = heights;
+                Content.UpdateLayout();
+                Verify.AreEqual(heights.Sum(), repeater.DesiredSize.Height);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateRestoredLayoutStateKeepsMeasuredSizes()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var heights = Enumerable.Range(0, 150).Select(i => i < 50 ? 100.0 : 10.0).ToList();
+                Func<ItemsRepeater> createRepeater = () => new ItemsRepeater()
+                {
+                    ItemsSource = heights,
+                    ItemTemplate = GetDataTemplate("<Border Height='{Binding}' />"),
+                    Layout = new StackLayout() { IsMeasuredSizeCacheEnabled = true },
+                    HorizontalCacheLength = 0,
+                    VerticalCacheLength = 0,
+                };
+
+                // Realize (and measure) all the items.
+                var repeater = createRepeater();
+                Content = new ScrollViewer() { Width = 400, Height = 10000, Content = repeater };
+                Content.UpdateLayout();
+                var snapshot = repeater.SaveLayoutState();
+                Verify.AreEqual(0, snapshot.AnchorIndex);
+
+                // A new repeater that only realizes the first items knows the exact extent
+                // right away when it starts from the snapshot.
+                var restoredRepeater = createRepeater();
+                restoredRepeater.RestoreLayoutState(snapshot);
+                Content = new ScrollViewer() { Width = 400, Height = 400, Content = restoredRepeater };
+                Content.UpdateLayout();
+                Verify.IsLessThan(restoredRepeater.Children.Count, 50);
+                Verify.AreEqual(heights.Sum(), restoredRepeater.DesiredSize.Height);
+            });
+        }
+
         #region Private Helpers
 
         private enum LayoutChoice
@@ -1610,6 +1730,24 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
 
         private int DefaultWaitTime = 2000;
 
+        private class TestItemSizeProvider : IItemSizeProvider
+        {
+            public TestItemSizeProvider(List<double> sizes)
+            {
+                m_sizes = sizes;
+            }
+
+            public int RequestCount { get; private set; }
+
+            public IReadOnlyList<double> GetItemSizes(int startIndex, int count)
+            {
+                RequestCount++;
+                return m_sizes.GetRange(startIndex, count);
+            }
+
+            private List<double> m_sizes;
+        }
+
         #endregion
     }
 }
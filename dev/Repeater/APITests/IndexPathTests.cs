@@ -4,6 +4,7 @@
 using Windows.UI.Xaml.Controls;
 using MUXControlsTestApp.Utilities;
 using Common;
+using System.Collections.Generic;
 
 #if USING_TAEF
 using WEX.TestExecution;
@@ -59,5 +60,25 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 Verify.AreEqual(1, path12.CompareTo(path1));
             });
         }
+
+        [TestMethod]
+        public void ValidateDeepIndexPath()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // Deeper than the paths SelectionModel stores inline.
+                var deepPath = IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3, 4, 5 });
+                Verify.AreEqual(6, deepPath.GetSize());
+                for (int i = 0; i < 6; i++)
+                {
+                    Verify.AreEqual(i, deepPath.GetAt(i));
+                }
+
+                Verify.AreEqual("R.0.1.2.3.4.5", deepPath.ToString());
+                Verify.AreEqual(0, deepPath.CompareTo(IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3, 4, 5 })));
+                Verify.AreEqual(-1, deepPath.CompareTo(IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3, 4, 6 })));
+                Verify.AreEqual(1, deepPath.CompareTo(IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3 })));
+            });
+        }
     }
 }
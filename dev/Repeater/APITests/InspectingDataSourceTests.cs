@@ -113,6 +113,70 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void VerifyGetAtTracksCollectionChanges()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new WinRTObservableVector(Enumerable.Range(0, 200).Select(i => string.Format("Item #{0}", i)));
+                var dataSource = new ItemsSourceView(data);
+
+                // Walk forwards and backwards so that items come from more than one prefetched block.
+                for (int i = 0; i < 200; ++i)
+                {
+                    Verify.AreEqual(string.Format("Item #{0}", i), (string)dataSource.GetAt(i));
+                }
+                for (int i = 199; i >= 0; --i)
+                {
+                    Verify.AreEqual(string.Format("Item #{0}", i), (string)dataSource.GetAt(i));
+                }
+
+                data.Insert(10, "Inserted Item");
+                Verify.AreEqual("Inserted Item", (string)dataSource.GetAt(10));
+                Verify.AreEqual("Item #10", (string)dataSource.GetAt(11));
+
+                data.RemoveAt(0);
+                Verify.AreEqual("Item #1", (string)dataSource.GetAt(0));
+
+                data[20] = "Replaced Item";
+                Verify.AreEqual("Replaced Item", (string)dataSource.GetAt(20));
+
+                data.Add("Appended Item");
+                Verify.AreEqual(201, dataSource.Count);
+                Verify.AreEqual("Appended Item", (string)dataSource.GetAt(200));
+            });
+        }
+
+        [TestMethod]
+        public void VerifyIndexFromKeyTracksCollectionChanges()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableStringsWithUniqueIds(Enumerable.Range(0, 100).Select(i => string.Format("Item #{0}", i)));
+                var dataSource = new ItemsSourceView(data);
+                Verify.AreEqual(50, dataSource.IndexFromKey("Item #50"));
+
+                data.Insert(0, "Inserted Item");
+                Verify.AreEqual(0, dataSource.IndexFromKey("Inserted Item"));
+                Verify.AreEqual(51, dataSource.IndexFromKey("Item #50"));
+
+                data.Add("Appended Item");
+                Verify.AreEqual(101, dataSource.IndexFromKey("Appended Item"));
+                Verify.AreEqual(51, dataSource.IndexFromKey("Item #50"));
+
+                data.RemoveAt(0);
+                Verify.AreEqual(50, dataSource.IndexFromKey("Item #50"));
+                Verify.AreEqual(-1, dataSource.IndexFromKey("Inserted Item"));
+
+                data[50] = "Replaced Item";
+                Verify.AreEqual(50, dataSource.IndexFromKey("Replaced Item"));
+                Verify.AreEqual(-1, dataSource.IndexFromKey("Item #50"));
+
+                data.Clear();
+                Verify.AreEqual(-1, dataSource.IndexFromKey("Replaced Item"));
+            });
+        }
+
         private static void VerifyRecordedCollectionChanges(NotifyCollectionChangedEventArgs[] expected, List<NotifyCollectionChangedEventArgs> actual)
         {
             Verify.AreEqual(expected.Length, actual.Count);
@@ -252,6 +316,21 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             }
         }
 
+        class ObservableStringsWithUniqueIds : ObservableCollection<string>, IKeyIndexMapping
+        {
+            public ObservableStringsWithUniqueIds(IEnumerable<string> data) : base(data) { }
+
+            public string KeyFromIndex(int index)
+            {
+                return this[index];
+            }
+
+            public int IndexFromKey(string id)
+            {
+                return IndexOf(id);
+            }
+        }
+
         class ObservableVectorWithUniqueIds : ObservableCollection<int>, IKeyIndexMapping
         {
             public ObservableVectorWithUniqueIds(IEnumerable<int> data) : base(data) { }
@@ -0,0 +1,232 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using MUXControlsTestApp.Utilities;
+using System;
+using System.Collections.Specialized;
+using System.Diagnostics;
+using Windows.Foundation;
+using Windows.UI.Xaml.Controls;
+using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common;
+using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common.Mocks;
+
+#if USING_TAEF
+using WEX.TestExecution;
+using WEX.TestExecution.Markup;
+using WEX.Logging.Interop;
+#else
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
+#endif
+
+#if !BUILD_WINDOWS
+using FlowLayout = Microsoft.UI.Xaml.Controls.FlowLayout;
+using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
+using UniformGridLayout = Microsoft.UI.Xaml.Controls.UniformGridLayout;
+using VirtualizingLayout = Microsoft.UI.Xaml.Controls.VirtualizingLayout;
+using VirtualizingLayoutContext = Microsoft.UI.Xaml.Controls.VirtualizingLayoutContext;
+#endif
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
+{
+    // Drives the built-in layouts directly through a synthetic layout context so that
+    // the cost of the layout algorithm can be measured without an ItemsRepeater,
+    // a scroll viewer or the rest of the visual tree. Each scenario logs the average
+    // time per Measure/Arrange pass and per realized item.
+    [TestClass]
+    public class LayoutBenchmarkTests : TestsBase
+    {
+        private static readonly int[] ItemCounts = { 1000, 100000, 1000000 };
+        private const int PassesPerScenario = 50;
+        private const double ViewportWidth = 400;
+        private const double ViewportHeight = 600;
+
+        [TestMethod]
+        public void BenchmarkStackLayout()
+        {
+            RunBenchmarks("StackLayout", () => new BenchmarkStackLayout());
+        }
+
+        [TestMethod]
+        public void BenchmarkUniformGridLayout()
+        {
+            RunBenchmarks("UniformGridLayout", () => new BenchmarkUniformGridLayout());
+        }
+
+        [TestMethod]
+        public void BenchmarkFlowLayout()
+        {
+            RunBenchmarks("FlowLayout", () => new BenchmarkFlowLayout());
+        }
+
+        private void RunBenchmarks(string layoutName, Func<IBenchmarkLayout> createLayout)
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                foreach (bool variableSizes in new[] { false, true })
+                {
+                    foreach (int itemCount in ItemCounts)
+                    {
+                        var layout = createLayout();
+                        var context = new MockVirtualizingLayoutContext()
+                        {
+                            Count = itemCount,
+                            RealizationWindow = new Rect(0, 0, ViewportWidth, ViewportHeight),
+                            ElementSizeFunc = variableSizes ? (Func<int, Size>)GetVariableElementSize : GetFixedElementSize
+                        };
+
+                        var benchmark = new LayoutBenchmark(
+                            string.Format("{0} {1} sizes, {2} items", layoutName, variableSizes ? "variable" : "fixed", itemCount),
+                            layout,
+                            context);
+
+                        benchmark.Run();
+
+                        // Virtualization must hold regardless of how many items there are.
+                        Verify.IsLessThan(context.ElementsCreated, 1000);
+                    }
+                }
+            });
+        }
+
+        private static Size GetFixedElementSize(int index)
+        {
+            return new Size(100, 40);
+        }
+
+        private static Size GetVariableElementSize(int index)
+        {
+            return new Size(50 + (index * 37) % 100, 20 + (index * 13) % 60);
+        }
+
+        private class LayoutBenchmark
+        {
+            private readonly string _name;
+            private readonly IBenchmarkLayout _layout;
+            private readonly MockVirtualizingLayoutContext _context;
+            private readonly Random _random = new Random(0);
+            private readonly Stopwatch _measureTimer = new Stopwatch();
+            private readonly Stopwatch _arrangeTimer = new Stopwatch();
+            private Size _extent;
+            private long _itemsRealized;
+
+            public LayoutBenchmark(string name, IBenchmarkLayout layout, MockVirtualizingLayoutContext context)
+            {
+                _name = name;
+                _layout = layout;
+                _context = context;
+            }
+
+            public void Run()
+            {
+                _layout.Layout.InitializeForContext(_context);
+
+                RunScenario("Initial", 1, pass => { });
+                RunScenario("Scroll", PassesPerScenario, pass => ScrollBy(ViewportHeight / 4));
+                RunScenario("RandomJump", PassesPerScenario, pass => ScrollTo(_random.NextDouble() * Math.Max(0, _extent.Height - ViewportHeight)));
+                RunScenario("Insert", PassesPerScenario, pass => InsertAt(Math.Max(0, _context.LastRealizedIndex)));
+                RunScenario("Reset", PassesPerScenario, pass => _layout.NotifyItemsChanged(_context, new NotifyCollectionChangedEventArgs(NotifyCollectionChangedAction.Reset)));
+
+                _layout.Layout.UninitializeForContext(_context);
+                Verify.IsTrue(_extent.Height > 0);
+            }
+
+            private void RunScenario(string scenario, int passes, Action<int> prepare)
+            {
+                _measureTimer.Reset();
+                _arrangeTimer.Reset();
+                _itemsRealized = 0;
+
+                for (int pass = 0; pass < passes; pass++)
+                {
+                    prepare(pass);
+                    _context.ResetCounters();
+
+                    _measureTimer.Start();
+                    _extent = _layout.Layout.Measure(_context, new Size(ViewportWidth, double.PositiveInfinity));
+                    _measureTimer.Stop();
+
+                    _arrangeTimer.Start();
+                    _layout.Layout.Arrange(_context, _extent);
+                    _arrangeTimer.Stop();
+
+                    _itemsRealized += _context.ElementsRealized;
+                }
+
+                double measureNs = ToNanoseconds(_measureTimer.ElapsedTicks);
+                double arrangeNs = ToNanoseconds(_arrangeTimer.ElapsedTicks);
+                Log.Comment(string.Format(
+                    "{0} [{1}]: Measure {2:F0} ns/pass, Arrange {3:F0} ns/pass, {4:F0} ns/realized item ({5} items realized)",
+                    _name,
+                    scenario,
+                    measureNs / passes,
+                    arrangeNs / passes,
+                    (measureNs + arrangeNs) / Math.Max(1, _itemsRealized),
+                    _itemsRealized));
+            }
+
+            private void ScrollBy(double delta)
+            {
+                double maxOffset = Math.Max(0, _extent.Height - ViewportHeight);
+                double offset = _context.RealizationWindow.Y + delta;
+                ScrollTo(offset > maxOffset ? 0 : offset);
+            }
+
+            private void ScrollTo(double offset)
+            {
+                _context.RealizationWindow = new Rect(0, offset, ViewportWidth, ViewportHeight);
+            }
+
+            private void InsertAt(int index)
+            {
+                _context.Count++;
+                _layout.NotifyItemsChanged(
+                    _context,
+                    CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Add, -1, 0, index, 1));
+            }
+
+            private static double ToNanoseconds(long ticks)
+            {
+                return ticks * (1000000000.0 / Stopwatch.Frequency);
+            }
+        }
+
+        // OnItemsChangedCore is protected, so the benchmark layouts expose it to forward
+        // the synthetic collection changes the same way ItemsRepeater would.
+        private interface IBenchmarkLayout
+        {
+            VirtualizingLayout Layout { get; }
+            void NotifyItemsChanged(VirtualizingLayoutContext context, NotifyCollectionChangedEventArgs args);
+        }
+
+        private class BenchmarkStackLayout : StackLayout, IBenchmarkLayout
+        {
+            public VirtualizingLayout Layout { get { return this; } }
+
+            public void NotifyItemsChanged(VirtualizingLayoutContext context, NotifyCollectionChangedEventArgs args)
+            {
+                OnItemsChangedCore(context, null, args);
+            }
+        }
+
+        private class BenchmarkUniformGridLayout : UniformGridLayout, IBenchmarkLayout
+        {
+            public VirtualizingLayout Layout { get { return this; } }
+
+            public void NotifyItemsChanged(VirtualizingLayoutContext context, NotifyCollectionChangedEventArgs args)
+            {
+                OnItemsChangedCore(context, null, args);
+            }
+        }
+
+        private class BenchmarkFlowLayout : FlowLayout, IBenchmarkLayout
+        {
+            public VirtualizingLayout Layout { get { return this; } }
+
+            public void NotifyItemsChanged(VirtualizingLayoutContext context, NotifyCollectionChangedEventArgs args)
+            {
+                OnItemsChangedCore(context, null, args);
+            }
+        }
+    }
+}
@@ -0,0 +1,170 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using MUXControlsTestApp.Utilities;
+using System;
+using System.Collections.Generic;
+using System.Collections.Specialized;
+using System.Linq;
+using System.Threading.Tasks;
+using Windows.Foundation;
+using Common;
+
+#if USING_TAEF
+using WEX.TestExecution;
+using WEX.TestExecution.Markup;
+using WEX.Logging.Interop;
+#else
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
+#endif
+
+#if !BUILD_WINDOWS
+using IPagedItemsSource = Microsoft.UI.Xaml.Controls.IPagedItemsSource;
+using PagedItemsSourceView = Microsoft.UI.Xaml.Controls.PagedItemsSourceView;
+#endif
+
+namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
+{
+    [TestClass]
+    public class PagedItemsSourceViewTests
+    {
+        [TestMethod]
+        public void ValidatePlaceholdersAreReplacedWhenPageLoads()
+        {
+            TestPagedItemsSource source = null;
+            PagedItemsSourceView dataSource = null;
+            var recordedArgs = new List<NotifyCollectionChangedEventArgs>();
+
+            RunOnUIThread.Execute(() =>
+            {
+                source = new TestPagedItemsSource(100);
+                dataSource = new PagedItemsSourceView(source) { PageSize = 10, Placeholder = "Placeholder" };
+                dataSource.CollectionChanged += (sender, args) => recordedArgs.Add(args);
+
+                Verify.AreEqual(100, dataSource.Count);
+                Verify.AreEqual("Placeholder", (string)dataSource.GetAt(5));
+                Verify.IsFalse(dataSource.IsItemLoaded(5));
+                Verify.AreEqual(1, source.Requests.Count);
+                Verify.AreEqual(0, source.Requests[0].StartIndex);
+                Verify.AreEqual(10, source.Requests[0].Count);
+
+                // Reading the same page again does not issue another request.
+                dataSource.GetAt(6);
+                Verify.AreEqual(1, source.Requests.Count);
+
+                source.Requests[0].Complete();
+
+                // Completion is always deferred to the dispatcher.
+                Verify.IsFalse(dataSource.IsItemLoaded(5));
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsTrue(dataSource.IsItemLoaded(5));
+                Verify.AreEqual("Item #5", (string)dataSource.GetAt(5));
+                Verify.AreEqual(1, recordedArgs.Count);
+                Verify.AreEqual(NotifyCollectionChangedAction.Replace, recordedArgs[0].Action);
+                Verify.AreEqual(0, recordedArgs[0].NewStartingIndex);
+                Verify.AreEqual(10, recordedArgs[0].NewItems.Count);
+
+                // Getting close to the end of a page requests the next one.
+                dataSource.GetAt(9);
+                Verify.AreEqual(2, source.Requests.Count);
+                Verify.AreEqual(10, source.Requests[1].StartIndex);
+
+                // Pages that were requested before a refresh are ignored.
+                dataSource.Refresh();
+                Verify.AreEqual(2, recordedArgs.Count);
+                Verify.AreEqual(NotifyCollectionChangedAction.Reset, recordedArgs[1].Action);
+                Verify.IsFalse(dataSource.IsItemLoaded(5));
+                source.Requests[1].Complete();
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsFalse(dataSource.IsItemLoaded(15));
+                Verify.AreEqual(2, recordedArgs.Count);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateLeastRecentlyUsedPagesAreEvicted()
+        {
+            TestPagedItemsSource source = null;
+            PagedItemsSourceView dataSource = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                source = new TestPagedItemsSource(100);
+                dataSource = new PagedItemsSourceView(source) { PageSize = 10, MaxLoadedPages = 2 };
+
+                // Read from the middle of each page so that neighbouring pages are not requested.
+                dataSource.GetAt(5);
+                dataSource.GetAt(15);
+                dataSource.GetAt(25);
+                Verify.AreEqual(3, source.Requests.Count);
+
+                foreach (var request in source.Requests)
+                {
+                    request.Complete();
+                }
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsFalse(dataSource.IsItemLoaded(5));
+                Verify.IsTrue(dataSource.IsItemLoaded(15));
+                Verify.IsTrue(dataSource.IsItemLoaded(25));
+                Verify.IsNull(dataSource.GetAt(5));
+                Verify.AreEqual(4, source.Requests.Count);
+            });
+        }
+
+        private class TestPagedItemsSource : IPagedItemsSource
+        {
+            public TestPagedItemsSource(int count)
+            {
+                Count = count;
+            }
+
+            public int Count { get; private set; }
+
+            public List<PendingRequest> Requests { get; } = new List<PendingRequest>();
+
+            public IAsyncOperation<IReadOnlyList<object>> LoadItemsAsync(int startIndex, int count)
+            {
+                var request = new PendingRequest(startIndex, count);
+                Requests.Add(request);
+                return request.Task.AsAsyncOperation();
+            }
+        }
+
+        private class PendingRequest
+        {
+            private readonly TaskCompletionSource<IReadOnlyList<object>> _completionSource = new TaskCompletionSource<IReadOnlyList<object>>();
+
+            public PendingRequest(int startIndex, int count)
+            {
+                StartIndex = startIndex;
+                Count = count;
+            }
+
+            public int StartIndex { get; private set; }
+            public int Count { get; private set; }
+            public Task<IReadOnlyList<object>> Task { get { return _completionSource.Task; } }
+
+            public void Complete()
+            {
+                _completionSource.SetResult(
+                    Enumerable.Range(StartIndex, Count).Select(i => (object)string.Format("Item #{0}", i)).ToList());
+            }
+        }
+    }
+}
@@ -124,6 +124,23 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             }
         }
 
+        [TestMethod]
+        public void ValidatePhasingBudget()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var repeater = new ItemsRepeater();
+                Verify.AreEqual(0.0, repeater.PhasingBudget);
+
+                repeater.PhasingBudget = 8.0;
+                Verify.AreEqual(8.0, repeater.PhasingBudget);
+                Verify.AreEqual(8.0, (double)repeater.GetValue(ItemsRepeater.PhasingBudgetProperty));
+
+                Verify.Throws<ArgumentException>(() => { repeater.PhasingBudget = -1.0; });
+                Verify.AreEqual(8.0, repeater.PhasingBudget);
+            });
+        }
+
         [TestMethod]
         public void ValidateXBindWithoutPhasing()
         {
@@ -25,6 +25,7 @@ using Microsoft.VisualStudio.TestTools.UnitTesting.Logging;
 #if !BUILD_WINDOWS
 using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 using ScrollAnchorProvider = Microsoft.UI.Xaml.Controls.ScrollAnchorProvider;
 #endif
@@ -104,6 +105,80 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        // Validate that elements recycled by the requested owner are preferred over
+        // elements that were recycled without an owner.
+        [TestMethod]
+        public void ValidateOwnedElementsArePreferredOverUnownedElements()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                RecyclePool pool = new RecyclePool();
+                var owner = new StackPanel();
+                var ownedChild = new Button();
+                var unownedChild = new Button();
+                owner.Children.Add(ownedChild);
+                pool.PutElement(ownedChild, "Key", owner);
+                pool.PutElement(unownedChild, "Key");
+
+                Verify.AreSame(ownedChild, pool.TryGetElement("Key", owner));
+                Verify.AreSame(unownedChild, pool.TryGetElement("Key", owner));
+                Verify.IsNull(pool.TryGetElement("Key", owner));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSizeLimitsEvictLeastRecentlyRecycledElements()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                RecyclePool pool = new RecyclePool();
+                pool.MaxElementsPerKey = 2;
+                pool.MaxElements = 3;
+
+                var buttons = Enumerable.Range(0, 3).Select(i => new Button()).ToArray();
+                var textBlock = new TextBlock();
+                foreach (var button in buttons)
+                {
+                    pool.PutElement(button, "ButtonKey");
+                }
+
+                // The oldest button is evicted by the per key limit.
+                Verify.AreEqual(2, RepeaterTestHooks.GetRecyclePoolElementCount(pool));
+                Verify.AreEqual(1, RepeaterTestHooks.GetRecyclePoolEvictionCount(pool));
+
+                // The next oldest button is evicted by the global limit.
+                pool.PutElement(textBlock, "TextBlockKey");
+                pool.PutElement(new TextBlock(), "TextBlockKey");
+                Verify.AreEqual(3, RepeaterTestHooks.GetRecyclePoolElementCount(pool));
+
+                Verify.AreSame(buttons[2], pool.TryGetElement("ButtonKey"));
+                Verify.IsNull(pool.TryGetElement("ButtonKey"));
+                Verify.AreEqual(1, RepeaterTestHooks.GetRecyclePoolHitCount(pool));
+                Verify.AreEqual(1, RepeaterTestHooks.GetRecyclePoolMissCount(pool));
+
+                pool.Trim();
+                Verify.AreEqual(0, RepeaterTestHooks.GetRecyclePoolElementCount(pool));
+                Verify.AreEqual(0, RepeaterTestHooks.GetRecyclePoolEstimatedBytes(pool));
+                Verify.IsNull(pool.TryGetElement("TextBlockKey"));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateEvictedElementsAreRemovedFromOwner()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                RecyclePool pool = new RecyclePool();
+                var owner = new StackPanel();
+                var child = new Button();
+                owner.Children.Add(child);
+                pool.PutElement(child, "Key", owner);
+                pool.Trim();
+
+                Verify.AreEqual(0, owner.Children.Count);
+            });
+        }
+
         // Validate that if the pool has an element for the requested owner,
         // then that is given preference over other elements.
         [TestMethod]
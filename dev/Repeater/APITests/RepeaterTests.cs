@@ -3,6 +3,7 @@
 
 using MUXControlsTestApp.Utilities;
 using System;
+using System.Collections.ObjectModel;
 using System.Linq;
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Controls;
@@ -24,6 +25,7 @@ using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
 using ItemsSourceView = Microsoft.UI.Xaml.Controls.ItemsSourceView;
 using RecyclingElementFactory = Microsoft.UI.Xaml.Controls.RecyclingElementFactory;
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 using ScrollAnchorProvider = Microsoft.UI.Xaml.Controls.ScrollAnchorProvider;
 #endif
@@ -114,6 +116,139 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateCoalescedCollectionChanges()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<string>(Enumerable.Range(0, 10).Select(i => string.Format("Item #{0}", i)));
+                var repeater = new ItemsRepeater()
+                {
+                    ItemsSource = data,
+                    IsCollectionChangeCoalescingEnabled = true,
+                };
+
+                Content = new ScrollAnchorProvider()
+                {
+                    Width = 400,
+                    Height = 800,
+                    Content = new ScrollViewer
+                    {
+                        Content = repeater
+                    }
+                };
+
+                Content.UpdateLayout();
+
+                // Adjacent inserts and removes are merged and applied before the element is looked up.
+                data.Insert(2, "Inserted #0");
+                data.Insert(3, "Inserted #1");
+                data.RemoveAt(0);
+                data.RemoveAt(0);
+
+                var element = repeater.TryGetElement(0);
+                Verify.IsNotNull(element);
+                Verify.AreEqual(0, repeater.GetElementIndex(element));
+
+                Content.UpdateLayout();
+
+                for (int i = 0; i < data.Count; i++)
+                {
+                    element = repeater.TryGetElement(i);
+                    Verify.IsNotNull(element);
+                    Verify.AreEqual(data[i], ((TextBlock)element).Text);
+                    Verify.AreEqual(i, repeater.GetElementIndex(element));
+                }
+            });
+        }
+
+        [TestMethod]
+        public void ValidateElementIndicesAfterInsertsWithoutIndexChangedHandler()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<string>(Enumerable.Range(0, 10).Select(i => string.Format("Item #{0}", i)));
+                var repeater = new ItemsRepeater()
+                {
+                    ItemsSource = data,
+                };
+
+                Content = new ScrollAnchorProvider()
+                {
+                    Width = 400,
+                    Height = 800,
+                    Content = new ScrollViewer
+                    {
+                        Content = repeater
+                    }
+                };
+
+                Content.UpdateLayout();
+
+                // With no ElementIndexChanged handler the index shifts are applied lazily.
+                var first = repeater.TryGetElement(0);
+                for (int i = 0; i < 40; i++)
+                {
+                    data.Insert(0, string.Format("Inserted #{0}", i));
+                }
+                Verify.AreEqual(40, repeater.GetElementIndex(first));
+
+                data.Insert(20, "Inserted in the middle");
+                data.RemoveAt(0);
+                Verify.AreEqual(40, repeater.GetElementIndex(first));
+
+                Content.UpdateLayout();
+
+                for (int i = 0; i < data.Count; i++)
+                {
+                    var element = repeater.TryGetElement(i);
+                    if (element != null)
+                    {
+                        Verify.AreEqual(data[i], ((TextBlock)element).Text);
+                        Verify.AreEqual(i, repeater.GetElementIndex(element));
+                    }
+                }
+            });
+        }
+
+        [TestMethod]
+        public void ValidatePerfCounters()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<string>(Enumerable.Range(0, 10).Select(i => string.Format("Item #{0}", i)));
+                var repeater = new ItemsRepeater()
+                {
+                    ItemsSource = data,
+                };
+
+                Content = new ScrollAnchorProvider()
+                {
+                    Width = 400,
+                    Height = 800,
+                    Content = new ScrollViewer
+                    {
+                        Content = repeater
+                    }
+                };
+
+                Content.UpdateLayout();
+
+                Verify.AreEqual(10L, RepeaterTestHooks.GetRepeaterElementsCreatedCount(repeater));
+                Verify.AreEqual(0L, RepeaterTestHooks.GetRepeaterElementsRecycledCount(repeater));
+                Verify.IsGreaterThan(RepeaterTestHooks.GetRepeaterMeasureCount(repeater), 0L);
+                Verify.IsGreaterThan(RepeaterTestHooks.GetRepeaterArrangeCount(repeater), 0L);
+                Verify.AreEqual(0, RepeaterTestHooks.GetRepeaterPhasingBacklog(repeater));
+
+                RepeaterTestHooks.ResetRepeaterCounters(repeater);
+                data.RemoveAt(0);
+                Content.UpdateLayout();
+
+                Verify.AreEqual(1L, RepeaterTestHooks.GetRepeaterElementsRecycledCount(repeater));
+                Verify.IsGreaterThan(RepeaterTestHooks.GetRepeaterMeasureCount(repeater), 0L);
+            });
+        }
+
         [TestMethod]
         [TestProperty("Bug", "12042052")]
         public void CanSetItemsSource()
@@ -8,6 +8,7 @@ using System.Linq;
 using System;
 using System.Collections.ObjectModel;
 using System.Text;
+using System.Runtime.InteropServices;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Data;
 using Common;
@@ -26,6 +27,7 @@ using SelectionModel = Microsoft.UI.Xaml.Controls.SelectionModel;
 using IndexPath = Microsoft.UI.Xaml.Controls.IndexPath;
 using SelectionModelSelectionChangedEventArgs = Microsoft.UI.Xaml.Controls.SelectionModelSelectionChangedEventArgs;
 using SelectionModelChildrenRequestedEventArgs = Microsoft.UI.Xaml.Controls.SelectionModelChildrenRequestedEventArgs;
+using SelectionModelSnapshot = Microsoft.UI.Xaml.Controls.SelectionModelSnapshot;
 #endif
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -83,6 +85,83 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateBatchedSelectionChangedEvent()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                SelectionModel selectionModel = new SelectionModel();
+                selectionModel.Source = Enumerable.Range(0, 10).ToList();
+                Select(selectionModel, 1, true);
+
+                int selectionChangedFiredCount = 0;
+                SelectionModelSelectionChangedEventArgs lastArgs = null;
+                selectionModel.SelectionChanged += delegate (SelectionModel sender, SelectionModelSelectionChangedEventArgs args)
+                {
+                    selectionChangedFiredCount++;
+                    lastArgs = args;
+                };
+
+                Log.Comment("Batch several selection changes");
+                selectionModel.BeginBatch();
+                selectionModel.Select(4);
+                selectionModel.Select(5);
+                selectionModel.Select(6);
+                selectionModel.BeginBatch();
+                selectionModel.Deselect(1);
+                selectionModel.EndBatch();
+                Verify.AreEqual(0, selectionChangedFiredCount);
+                selectionModel.EndBatch();
+
+                Verify.AreEqual(1, selectionChangedFiredCount);
+                Verify.AreEqual(1, lastArgs.AddedRanges.Count);
+                Verify.AreEqual(0, Path(4).CompareTo(lastArgs.AddedRanges[0].Start));
+                Verify.AreEqual(0, Path(6).CompareTo(lastArgs.AddedRanges[0].End));
+                Verify.AreEqual(1, lastArgs.RemovedRanges.Count);
+                Verify.AreEqual(0, Path(1).CompareTo(lastArgs.RemovedRanges[0].Start));
+                Verify.AreEqual(0, Path(1).CompareTo(lastArgs.RemovedRanges[0].End));
+
+                Log.Comment("Changes outside a batch carry their own delta");
+                selectionModel.Deselect(5);
+                Verify.AreEqual(2, selectionChangedFiredCount);
+                Verify.AreEqual(0, lastArgs.AddedRanges.Count);
+                Verify.AreEqual(1, lastArgs.RemovedRanges.Count);
+                Verify.AreEqual(0, Path(5).CompareTo(lastArgs.RemovedRanges[0].Start));
+
+                Verify.Throws<COMException>(() => selectionModel.EndBatch());
+            });
+        }
+
+        [TestMethod]
+        public void ValidateSnapshotCanBeReadOffTheUIThread()
+        {
+            SelectionModelSnapshot snapshot = null;
+            RunOnUIThread.Execute(() =>
+            {
+                SelectionModel selectionModel = new SelectionModel();
+                selectionModel.Source = Enumerable.Range(0, 10).ToList();
+                selectionModel.SelectRange(Path(2), Path(4));
+                selectionModel.Select(8);
+
+                snapshot = selectionModel.CreateSnapshot();
+
+                Log.Comment("Changes after the snapshot was taken are not reflected in it");
+                selectionModel.ClearSelection();
+                selectionModel.Select(0);
+            });
+
+            // The test runs off the UI thread, the snapshot must not need it.
+            Verify.AreEqual(4L, snapshot.SelectedCount);
+            Verify.AreEqual(2, snapshot.SelectedRanges.Count);
+            Verify.AreEqual(0, Path(2).CompareTo(snapshot.SelectedRanges[0].Start));
+            Verify.AreEqual(0, Path(4).CompareTo(snapshot.SelectedRanges[0].End));
+            Verify.AreEqual(0, Path(8).CompareTo(snapshot.SelectedRanges[1].Start));
+            Verify.AreEqual(0, Path(8).CompareTo(snapshot.SelectedRanges[1].End));
+            Verify.IsTrue(snapshot.IsSelectedAt(Path(3)));
+            Verify.IsFalse(snapshot.IsSelectedAt(Path(0)));
+            Verify.IsFalse(snapshot.IsSelectedAt(Path(1, 3)));
+        }
+
         [TestMethod]
         public void ValidateCanSetSelectedIndex()
         {
@@ -494,6 +573,52 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateLargeRangeSelection()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const int itemCount = 1000000;
+                var data = new ObservableCollection<int>(Enumerable.Range(0, itemCount));
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = data;
+
+                Log.Comment("Select everything, then deselect a few items");
+                selectionModel.SetAnchorIndex(0);
+                selectionModel.SelectRangeFromAnchor(itemCount - 1);
+                selectionModel.Deselect(10);
+                selectionModel.Deselect(500000);
+                selectionModel.Deselect(itemCount - 1);
+                Verify.AreEqual(itemCount - 3, selectionModel.SelectedIndices.Count);
+                Verify.IsTrue(selectionModel.IsSelected(9).Value);
+                Verify.IsFalse(selectionModel.IsSelected(10).Value);
+                Verify.IsTrue(selectionModel.IsSelected(11).Value);
+                Verify.IsFalse(selectionModel.IsSelected(500000).Value);
+                Verify.IsFalse(selectionModel.IsSelected(itemCount - 1).Value);
+                Verify.AreEqual(itemCount - 3, selectionModel.SelectedItems.Count);
+                Verify.AreEqual(11, selectionModel.SelectedIndices[10].GetAt(0));
+                Verify.AreEqual(500001, (int)selectionModel.SelectedItems[499999]);
+                Verify.AreEqual(itemCount - 2, (int)selectionModel.SelectedItems[itemCount - 4]);
+
+                Log.Comment("Reselecting an overlapping range merges it back");
+                selectionModel.SetAnchorIndex(5);
+                selectionModel.SelectRangeFromAnchor(20);
+                Verify.AreEqual(itemCount - 2, selectionModel.SelectedIndices.Count);
+                Verify.IsTrue(selectionModel.IsSelected(10).Value);
+
+                Log.Comment("Insert and remove around the deselected item");
+                data.Insert(500000, -1);
+                Verify.IsFalse(selectionModel.IsSelected(500000).Value);
+                Verify.IsFalse(selectionModel.IsSelected(500001).Value);
+                Verify.IsTrue(selectionModel.IsSelected(500002).Value);
+                data.RemoveAt(499999);
+                Verify.IsTrue(selectionModel.IsSelected(499998).Value);
+                Verify.IsFalse(selectionModel.IsSelected(499999).Value);
+                Verify.IsFalse(selectionModel.IsSelected(500000).Value);
+                Verify.AreEqual(itemCount - 3, selectionModel.SelectedIndices.Count);
+            });
+        }
+
         [TestMethod]
         public void ValidateRemoves()
         {
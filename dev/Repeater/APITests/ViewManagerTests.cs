@@ -36,6 +36,7 @@ using RecyclingElementFactory = Microsoft.UI.Xaml.Controls.RecyclingElementFacto
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
 using ScrollAnchorProvider = Microsoft.UI.Xaml.Controls.ScrollAnchorProvider;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 #endif
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -583,6 +584,81 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidatePrewarmElementCountFillsRecyclePool()
+        {
+            RecyclingElementFactory elementFactory = null;
+            ManualResetEvent buildTreeCompleted = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                elementFactory = new RecyclingElementFactory();
+                elementFactory.RecyclePool = new RecyclePool();
+                elementFactory.Templates["Item"] = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'><TextBlock Text='{Binding}' /></DataTemplate>");
+                elementFactory.Templates["Header"] = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'><Button Content='{Binding}' /></DataTemplate>");
+
+                RepeaterTestHooks.BuildTreeCompleted += (sender, args) =>
+                {
+                    buildTreeCompleted.Set();
+                };
+
+                Content = new ItemsRepeater()
+                {
+#if BUILD_WINDOWS
+                    ItemTemplate = (Windows.UI.Xaml.IElementFactory)elementFactory,
+#else
+                    ItemTemplate = elementFactory,
+#endif
+                    PrewarmElementCount = 3
+                };
+            });
+
+            Verify.IsTrue(buildTreeCompleted.WaitOne(DefaultWaitTime), "Waiting for prewarm to complete");
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(6, RepeaterTestHooks.GetRecyclePoolElementCount(elementFactory.RecyclePool));
+                Verify.IsNotNull(elementFactory.RecyclePool.TryGetElement("Item") as TextBlock);
+                Verify.IsNotNull(elementFactory.RecyclePool.TryGetElement("Header") as Button);
+            });
+        }
+
+        [TestMethod]
+        public void ValidatePrewarmTemplatesFillsRecyclePool()
+        {
+            RecyclingElementFactory elementFactory = null;
+            ManualResetEvent buildTreeCompleted = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                elementFactory = new RecyclingElementFactory();
+                elementFactory.Templates["Item"] = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'><TextBlock Text='{Binding}' /></DataTemplate>");
+                elementFactory.Templates["Header"] = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'><Button Content='{Binding}' /></DataTemplate>");
+
+                RepeaterTestHooks.BuildTreeCompleted += (sender, args) =>
+                {
+                    buildTreeCompleted.Set();
+                };
+
+                // No repeater uses the factory yet, and no RecyclePool was set.
+                elementFactory.PrewarmTemplates(2);
+                Verify.IsNotNull(elementFactory.RecyclePool);
+            });
+
+            Verify.IsTrue(buildTreeCompleted.WaitOne(DefaultWaitTime), "Waiting for prewarm to complete");
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(4, RepeaterTestHooks.GetRecyclePoolElementCount(elementFactory.RecyclePool));
+                Verify.IsNotNull(elementFactory.RecyclePool.TryGetElement("Item") as TextBlock);
+                Verify.IsNotNull(elementFactory.RecyclePool.TryGetElement("Header") as Button);
+            });
+        }
+
         [TestMethod]
         public void ValidateFocusMoveOnElementCleared()
         {
@@ -684,6 +760,52 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                     () => { ValidateCurrentFocus(repeater, 0 /*expectedIndex */, "3" /* expectedContent */); }
                 });
         }
+
+        [TestMethod]
+        public void CanSkipRebindingWhenRecycledElementComesBackForSameItem()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<object> { new object(), new object() };
+                var elementFactory = new RecyclingElementFactory()
+                {
+                    RecyclePool = new RecyclePool(),
+                };
+                elementFactory.Templates["Item"] = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'>
+                          <ContentControl Content='{Binding}' />
+                      </DataTemplate>");
+
+                UIElement first = null;
+                UIElement second = null;
+                var layout = new MockVirtualizingLayout
+                {
+                    MeasureLayoutFunc = (availableSize, context) =>
+                    {
+                        var ctx = (VirtualizingLayoutContext)context;
+                        first = ctx.GetOrCreateElementAt(0);
+                        ctx.RecycleElement(first);
+                        second = ctx.GetOrCreateElementAt(0);
+                        return default(Size);
+                    }
+                };
+
+                var repeater = new ItemsRepeater()
+                {
+                    ItemsSource = data,
+                    ItemTemplate = elementFactory,
+                    Layout = layout,
+                };
+
+                Content = repeater;
+                Content.UpdateLayout();
+
+                Verify.AreSame(first, second);
+                Verify.AreSame(data[0], ((FrameworkElement)second).DataContext);
+                Verify.IsGreaterThan(RepeaterTestHooks.GetRepeaterElementsRebindSkippedCount(repeater), 0L);
+            });
+        }
+
         private void MoveFocusToIndex(ItemsRepeater repeater, int index)
         {
             var element = repeater.TryGetElement(index) as Control;
@@ -20,6 +20,10 @@ public:
     void OnElementBoundsChanged(const winrt::UIElement& element, winrt::Rect oldBounds, winrt::Rect newBounds);
     void OnOwnerArranged();
 
+    // Lets callers skip the per-element calls above entirely
+    // when there is no animator to forward them to.
+    bool HasAnimator() const { return static_cast<bool>(m_animator); }
+
 private:
     void OnHideAnimationCompleted(const winrt::ElementAnimator& sender, const winrt::UIElement& element);
 
@@ -7,39 +7,96 @@
 #include "BuildTreeScheduler.h"
 #include "RepeaterTestHooks.h"
 
-double BuildTreeScheduler::m_budgetInMs = 40.0;
+thread_local double BuildTreeScheduler::m_budgetInMs = 40.0;
+thread_local double BuildTreeScheduler::m_averageFrameIntervalInMs = 40.0 / s_budgetToFrameIntervalRatio;
 thread_local QPCTimer BuildTreeScheduler::m_timer{};
-thread_local std::vector<WorkInfo> BuildTreeScheduler::m_pendingWork{};
+thread_local std::vector<BuildTreeScheduler::WorkInfo> BuildTreeScheduler::m_pendingWork{};
+thread_local BuildTreeWorkToken BuildTreeScheduler::m_lastToken{ 0u };
 thread_local winrt::event_token BuildTreeScheduler::m_renderingToken{};
 
-void BuildTreeScheduler::RegisterWork(int priority, const std::function<void()>& workFunc)
+BuildTreeWorkToken BuildTreeScheduler::RegisterWork(BuildTreeWorkLane lane, int priority, BuildTreeWorkCallback callback, void* context)
 {
     MUX_ASSERT(priority >= 0);
-    MUX_ASSERT(workFunc != nullptr);
+    MUX_ASSERT(callback != nullptr);
 
     QueueTick();
-    m_pendingWork.push_back(WorkInfo(priority, workFunc));
+    const auto token = ++m_lastToken;
+    m_pendingWork.push_back(WorkInfo{ lane, priority, token, callback, context });
+    std::push_heap(m_pendingWork.begin(), m_pendingWork.end(), &BuildTreeScheduler::RunsAfter);
+    return token;
+}
+
+void BuildTreeScheduler::CancelWork(BuildTreeWorkToken token)
+{
+    auto it = std::find_if(m_pendingWork.begin(), m_pendingWork.end(), [token](const WorkInfo& work) { return work.token == token; });
+    if (it != m_pendingWork.end())
+    {
+        *it = m_pendingWork.back();
+        m_pendingWork.pop_back();
+        std::make_heap(m_pendingWork.begin(), m_pendingWork.end(), &BuildTreeScheduler::RunsAfter);
+    }
+}
+
+/* static */
+bool BuildTreeScheduler::RunsAfter(const WorkInfo& lhs, const WorkInfo& rhs)
+{
+    if (lhs.lane != rhs.lane)
+    {
+        return lhs.lane > rhs.lane;
+    }
+
+    if (lhs.priority != rhs.priority)
+    {
+        return lhs.priority > rhs.priority;
+    }
+
+    // First come first served within the same lane and priority.
+    return lhs.token > rhs.token;
 }
 
 bool BuildTreeScheduler::ShouldYield()
 {
-    return m_timer.DurationInMilliSeconds() > m_budgetInMs;
+    return ShouldYield(m_budgetInMs);
+}
+
+bool BuildTreeScheduler::ShouldYield(double budgetInMs)
+{
+    return m_timer.DurationInMilliSeconds() > budgetInMs;
+}
+
+void BuildTreeScheduler::UpdateBudget(int frameIntervalInMs)
+{
+    if (frameIntervalInMs > 0 && frameIntervalInMs <= s_maxFrameIntervalSampleInMs)
+    {
+        // Exponential moving average so a single long frame does not swing the budget.
+        m_averageFrameIntervalInMs += (frameIntervalInMs - m_averageFrameIntervalInMs) * 0.1;
+        m_budgetInMs = std::clamp(m_averageFrameIntervalInMs * s_budgetToFrameIntervalRatio, s_minBudgetInMs, s_maxBudgetInMs);
+    }
 }
 
 void BuildTreeScheduler::OnRendering(const winrt::IInspectable&, const winrt::IInspectable&)
 {
-      bool budgetReached = ShouldYield();
+    // The timer was reset at the end of the previous tick, so this is the time between the two ticks.
+    UpdateBudget(m_timer.DurationInMilliSeconds());
+
+    bool budgetReached = ShouldYield();
     if (!budgetReached && m_pendingWork.size() > 0)
     {
-        // Sort in descending order of priority and work from the end of the list to avoid moving around during erase.
-        std::sort(m_pendingWork.begin(), m_pendingWork.end(), [](const auto& lhs, const auto& rhs) { return lhs.Priority() > rhs.Priority(); });
-        int currentIndex = static_cast<int>(m_pendingWork.size()) - 1;
-
+        // Work registered while this tick runs waits for the next tick, otherwise work that
+        // re-registers itself without yielding would keep this loop going forever.
+        const auto lastTokenOfTick = m_lastToken;
         do
         {
-            m_pendingWork[currentIndex].InvokeWorkFunc();
-            m_pendingWork.erase(m_pendingWork.begin() + currentIndex);
-        } while (--currentIndex >= 0 && !ShouldYield());
+            const auto next = m_pendingWork.front();
+            if (next.token > lastTokenOfTick)
+            {
+                break;
+            }
+
+            std::pop_heap(m_pendingWork.begin(), m_pendingWork.end(), &BuildTreeScheduler::RunsAfter);
+            m_pendingWork.pop_back();
+            next.callback(next.context);
+        } while (!m_pendingWork.empty() && !ShouldYield());
     }
 
     if (m_pendingWork.empty())
@@ -3,35 +3,67 @@
 
 #pragma once
 
-struct WorkInfo
+// Work in a lower lane always runs before work in a higher one.
+enum class BuildTreeWorkLane
 {
-    WorkInfo(int priority, const std::function<void()>& workFunc) :
-        m_priority(priority),
-        m_workFunc(workFunc)
-    {}
-
-    int Priority() const { return m_priority; }
-    void InvokeWorkFunc() const { m_workFunc(); }
-
-private:
-    int m_priority;
-    std::function<void()> m_workFunc;
+    // Phasing of elements that intersect the visible window.
+    VisiblePhasing,
+    // Phasing of elements in the cache buffer and other work that fills the cache.
+    CacheBuild,
+    // Speculative work such as prewarming recycle pools.
+    Prewarm
 };
 
+// Identifies queued work so it can be cancelled. Zero is never handed out.
+using BuildTreeWorkToken = uint64_t;
+// A plain function pointer and context, so registering work does not allocate.
+using BuildTreeWorkCallback = void(*)(void* context);
+
 // High performance time management using QueryPerformanceCounter
 class BuildTreeScheduler final
 {
 public:
-    static void RegisterWork(int priority, const std::function<void()>& workFunc);
+    // The context has to stay valid until the work runs or is cancelled.
+    static BuildTreeWorkToken RegisterWork(BuildTreeWorkLane lane, int priority, BuildTreeWorkCallback callback, void* context);
+    // Cancelling work that already ran or was already cancelled is a no-op.
+    static void CancelWork(BuildTreeWorkToken token);
+    // Yields once the adaptive budget for the current frame is used up.
     static bool ShouldYield();
+    // Yields once budgetInMs has passed since the last rendering tick.
+    static bool ShouldYield(double budgetInMs);
 
 private:
+    struct WorkInfo
+    {
+        BuildTreeWorkLane lane;
+        int priority;
+        BuildTreeWorkToken token;
+        BuildTreeWorkCallback callback;
+        void* context;
+    };
+
+    // Heap comparison, the work to run next is at the front.
+    static bool RunsAfter(const WorkInfo& lhs, const WorkInfo& rhs);
+
     static void OnRendering(const winrt::IInspectable& sender, const winrt::IInspectable& args);
     static void QueueTick();
+    static void UpdateBudget(int frameIntervalInMs);
+
+    // The budget is a multiple of the measured frame interval, so shorter frames on high
+    // refresh rate displays get less work per frame and slow devices get more time before
+    // deferring to the next one. The factor keeps the historical 40ms budget at 60 frames per second.
+    static constexpr double s_budgetToFrameIntervalRatio = 2.4;
+    static constexpr double s_minBudgetInMs = 8.0;
+    static constexpr double s_maxBudgetInMs = 100.0;
+    // Intervals longer than this are gaps between bursts of work rather than frames.
+    static constexpr int s_maxFrameIntervalSampleInMs = 250;
 
-    static double m_budgetInMs;
+    static thread_local double m_budgetInMs;
+    static thread_local double m_averageFrameIntervalInMs;
 
     static thread_local QPCTimer m_timer;
+    // Binary heap ordered by RunsAfter.
     static thread_local std::vector<WorkInfo> m_pendingWork;
+    static thread_local BuildTreeWorkToken m_lastToken;
     static thread_local winrt::event_token m_renderingToken;
 };
\ No newline at end of file
@@ -20,22 +20,14 @@ ChildrenInTabFocusOrderIterable::First()
 
 ChildrenInTabFocusOrderIterable::ChildrenInTabFocusOrderIterator::ChildrenInTabFocusOrderIterator(const winrt::ItemsRepeater& repeater)
 {
-    auto children = repeater.as<winrt::Panel>().Children();
-    m_realizedChildren.reserve(children.Size());
-
-    // Filter out unrealized children.
-    for (unsigned i = 0u; i < children.Size(); ++i)
+    // The view manager already keeps the realized children in index order. Take a
+    // snapshot since the iterator can outlive the next layout pass.
+    const auto& realizedElements = winrt::get_self<ItemsRepeater>(repeater)->ViewManager().RealizedElementsInIndexOrder();
+    m_realizedChildren.reserve(realizedElements.size());
+    for (const auto& elementInfo : realizedElements)
     {
-        auto element = children.GetAt(i);
-        auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-        if (virtInfo->IsRealized())
-        {
-            m_realizedChildren.push_back(std::make_pair(virtInfo->Index(), element));
-        }
+        m_realizedChildren.push_back(elementInfo.Element());
     }
-
-    // Sort children by index.
-    std::sort(m_realizedChildren.begin(), m_realizedChildren.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
 }
 
 winrt::DependencyObject
@@ -43,7 +35,7 @@ ChildrenInTabFocusOrderIterable::ChildrenInTabFocusOrderIterator::Current()
 {
     if (m_index < static_cast<int>(m_realizedChildren.size()))
     {
-        return m_realizedChildren[m_index].second.as<winrt::DependencyObject>();
+        return m_realizedChildren[m_index].as<winrt::DependencyObject>();
     }
     else
     {
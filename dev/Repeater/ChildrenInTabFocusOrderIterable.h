@@ -63,7 +63,7 @@ private:
 #pragma endregion
 
     private:
-        std::vector<std::pair<int /* index */, winrt::UIElement>> m_realizedChildren;
+        std::vector<winrt::UIElement> m_realizedChildren;
         int m_index = 0;
     };
 
@@ -0,0 +1,155 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include "ItemsRepeater.common.h"
+#include "CompositionElementAnimator.h"
+
+CppWinRTActivatableClassWithBasicFactory(CompositionElementAnimator);
+
+#pragma region IElementAnimatorOverrides
+
+bool CompositionElementAnimator::HasShowAnimationCore(
+    winrt::UIElement const& /*element*/,
+    winrt::AnimationContext const& context)
+{
+    return (context & (winrt::AnimationContext::CollectionChangeAdd | winrt::AnimationContext::CollectionChangeReset)) != winrt::AnimationContext::None;
+}
+
+bool CompositionElementAnimator::HasHideAnimationCore(
+    winrt::UIElement const& /*element*/,
+    winrt::AnimationContext const& context)
+{
+    return (context & (winrt::AnimationContext::CollectionChangeRemove | winrt::AnimationContext::CollectionChangeReset)) != winrt::AnimationContext::None;
+}
+
+bool CompositionElementAnimator::HasBoundsChangeAnimationCore(
+    winrt::UIElement const& /*element*/,
+    winrt::AnimationContext const& context,
+    winrt::Rect const& oldBounds,
+    winrt::Rect const& newBounds)
+{
+    // Only moves caused by items being added or removed are animated, and only when
+    // the Translation property is available to animate without fighting layout.
+    return (context & (winrt::AnimationContext::CollectionChangeAdd | winrt::AnimationContext::CollectionChangeRemove)) != winrt::AnimationContext::None &&
+        (oldBounds.X != newBounds.X || oldBounds.Y != newBounds.Y) &&
+        DownlevelHelper::SetIsTranslationEnabledExists();
+}
+
+void CompositionElementAnimator::StartShowAnimation(
+    winrt::UIElement const& element,
+    winrt::AnimationContext const& /*context*/)
+{
+    auto visual = GetVisualAndEnsureAnimations(element);
+    visual.StartAnimation(L"Opacity", m_showAnimation);
+    m_shownElements.push_back(element);
+}
+
+void CompositionElementAnimator::StartHideAnimation(
+    winrt::UIElement const& element,
+    winrt::AnimationContext const& /*context*/)
+{
+    auto visual = GetVisualAndEnsureAnimations(element);
+    visual.StartAnimation(L"Opacity", m_hideAnimation);
+    m_hiddenElements.push_back(element);
+}
+
+void CompositionElementAnimator::StartBoundsChangeAnimation(
+    winrt::UIElement const& element,
+    winrt::AnimationContext const& /*context*/,
+    winrt::Rect const& oldBounds,
+    winrt::Rect const& newBounds)
+{
+    auto visual = GetVisualAndEnsureAnimations(element);
+
+    // Layout has already moved the element to its new bounds. Offset it back to where
+    // it was and let the shared animation bring the translation down to zero.
+    winrt::ElementCompositionPreview::SetIsTranslationEnabled(element, true);
+    visual.Properties().InsertVector3(
+        L"Translation",
+        winrt::float3(oldBounds.X - newBounds.X, oldBounds.Y - newBounds.Y, 0.0f));
+    visual.StartAnimation(L"Translation", m_boundsChangeAnimation);
+    m_movedElements.push_back(element);
+}
+
+#pragma endregion
+
+void CompositionElementAnimator::OnAnimationsStarted()
+{
+    if (m_batch)
+    {
+        auto batch = std::exchange(m_batch, nullptr);
+        batch.End();
+
+        auto strongThis = get_strong();
+        batch.Completed(
+            [strongThis,
+            shownElements = std::move(m_shownElements),
+            hiddenElements = std::move(m_hiddenElements),
+            movedElements = std::move(m_movedElements)](auto const&, auto const&)
+        {
+            strongThis->OnBatchCompleted(shownElements, hiddenElements, movedElements);
+        });
+
+        m_shownElements.clear();
+        m_hiddenElements.clear();
+        m_movedElements.clear();
+    }
+}
+
+winrt::Visual CompositionElementAnimator::GetVisualAndEnsureAnimations(const winrt::UIElement& element)
+{
+    auto visual = winrt::ElementCompositionPreview::GetElementVisual(element);
+
+    if (!m_compositor)
+    {
+        m_compositor = visual.Compositor();
+
+        m_showAnimation = m_compositor.CreateScalarKeyFrameAnimation();
+        m_showAnimation.InsertKeyFrame(0.0f, 0.0f);
+        m_showAnimation.InsertKeyFrame(1.0f, 1.0f);
+        m_showAnimation.Duration(s_showHideDuration);
+
+        m_hideAnimation = m_compositor.CreateScalarKeyFrameAnimation();
+        m_hideAnimation.InsertKeyFrame(0.0f, 1.0f);
+        m_hideAnimation.InsertKeyFrame(1.0f, 0.0f);
+        m_hideAnimation.Duration(s_showHideDuration);
+
+        m_boundsChangeAnimation = m_compositor.CreateVector3KeyFrameAnimation();
+        m_boundsChangeAnimation.InsertExpressionKeyFrame(0.0f, L"this.StartingValue");
+        m_boundsChangeAnimation.InsertKeyFrame(1.0f, winrt::float3::zero());
+        m_boundsChangeAnimation.Duration(s_boundsChangeDuration);
+    }
+
+    if (!m_batch)
+    {
+        m_batch = m_compositor.CreateScopedBatch(winrt::CompositionBatchTypes::Animation);
+    }
+
+    return visual;
+}
+
+void CompositionElementAnimator::OnBatchCompleted(
+    const std::vector<winrt::UIElement>& shownElements,
+    const std::vector<winrt::UIElement>& hiddenElements,
+    const std::vector<winrt::UIElement>& movedElements)
+{
+    for (const auto& element : hiddenElements)
+    {
+        // The element goes back to the element factory and may be reused,
+        // so it must not stay transparent.
+        winrt::ElementCompositionPreview::GetElementVisual(element).Opacity(1.0f);
+        OnHideAnimationCompleted(element);
+    }
+
+    for (const auto& element : movedElements)
+    {
+        OnBoundsChangeAnimationCompleted(element);
+    }
+
+    for (const auto& element : shownElements)
+    {
+        OnShowAnimationCompleted(element);
+    }
+}
@@ -0,0 +1,74 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ElementAnimator.h"
+#include "CompositionElementAnimator.g.h"
+
+// ElementAnimator that fades elements in and out and slides them to their new
+// position using composition animations. The animations are created once and
+// started on every element's visual, so queuing a large number of elements does
+// not allocate any per-element animation objects. Completion is tracked with a
+// single scoped batch per rendering pass.
+class CompositionElementAnimator :
+    public ReferenceTracker<CompositionElementAnimator, winrt::implementation::CompositionElementAnimatorT, ElementAnimator>
+{
+public:
+#pragma region IElementAnimatorOverrides
+
+    bool HasShowAnimationCore(
+        winrt::UIElement const& element,
+        winrt::AnimationContext const& context);
+
+    bool HasHideAnimationCore(
+        winrt::UIElement const& element,
+        winrt::AnimationContext const& context);
+
+    bool HasBoundsChangeAnimationCore(
+        winrt::UIElement const& element,
+        winrt::AnimationContext const& context,
+        winrt::Rect const& oldBounds,
+        winrt::Rect const& newBounds);
+
+    void StartShowAnimation(
+        winrt::UIElement const& element,
+        winrt::AnimationContext const& context);
+
+    void StartHideAnimation(
+        winrt::UIElement const& element,
+        winrt::AnimationContext const& context);
+
+    void StartBoundsChangeAnimation(
+        winrt::UIElement const& element,
+        winrt::AnimationContext const& context,
+        winrt::Rect const& oldBounds,
+        winrt::Rect const& newBounds);
+
+#pragma endregion
+
+protected:
+    void OnAnimationsStarted() override;
+
+private:
+    winrt::Visual GetVisualAndEnsureAnimations(const winrt::UIElement& element);
+    void OnBatchCompleted(
+        const std::vector<winrt::UIElement>& shownElements,
+        const std::vector<winrt::UIElement>& hiddenElements,
+        const std::vector<winrt::UIElement>& movedElements);
+
+    static constexpr std::chrono::milliseconds s_showHideDuration{ 250 };
+    static constexpr std::chrono::milliseconds s_boundsChangeDuration{ 300 };
+
+    // Shared by every element this animator animates.
+    winrt::Compositor m_compositor{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_showAnimation{ nullptr };
+    winrt::ScalarKeyFrameAnimation m_hideAnimation{ nullptr };
+    winrt::Vector3KeyFrameAnimation m_boundsChangeAnimation{ nullptr };
+
+    // State for the current rendering pass.
+    winrt::CompositionScopedBatch m_batch{ nullptr };
+    std::vector<winrt::UIElement> m_shownElements;
+    std::vector<winrt::UIElement> m_hiddenElements;
+    std::vector<winrt::UIElement> m_movedElements;
+};
@@ -0,0 +1,452 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include <Vector.h>
+#include "ItemsRepeater.common.h"
+#include "DiffingItemsSourceView.h"
+
+CppWinRTActivatableClassWithBasicFactory(DiffingItemsSourceView);
+
+namespace
+{
+    winrt::IVector<winrt::IInspectable> MakeItemsVector()
+    {
+        return winrt::make<Vector<winrt::IInspectable>>();
+    }
+
+    // Items of a range, for the collection changed args.
+    winrt::IBindableVector CopyRange(const winrt::IVector<winrt::IInspectable>& items, int startIndex, int count)
+    {
+        auto range = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Bindable>()>>();
+        for (int i = 0; i < count; ++i)
+        {
+            range.Append(items.GetAt(static_cast<uint32_t>(startIndex + i)));
+        }
+        return range.as<winrt::IBindableVector>();
+    }
+}
+
+DiffingItemsSourceView::DiffingItemsSourceView(const winrt::ItemKeySelector& keySelector)
+{
+    if (!keySelector)
+    {
+        throw winrt::hresult_invalid_argument(L"Argument 'keySelector' is null.");
+    }
+
+    m_keySelector = keySelector;
+    m_items.set(MakeItemsVector());
+}
+
+DiffingItemsSourceView::~DiffingItemsSourceView()
+{
+    CancelPendingUpdate();
+}
+
+#pragma region IDiffingItemsSourceView
+
+void DiffingItemsSourceView::UpdateItems(winrt::IIterable<winrt::IInspectable> const& items)
+{
+    if (!items)
+    {
+        throw winrt::hresult_invalid_argument(L"Argument 'items' is null.");
+    }
+
+    // Keys are read here rather than on the background thread, items are not
+    // necessarily agile and neither is the selector.
+    auto newItems = MakeItemsVector();
+    std::vector<winrt::hstring> newKeys;
+    for (auto const& item : items)
+    {
+        newItems.Append(item);
+        newKeys.push_back(m_keySelector(item));
+    }
+
+    CancelPendingUpdate();
+    ++m_generation;
+
+    if (m_keys.empty() || newKeys.empty())
+    {
+        // Nothing worth diffing, the whole list is either added or reset.
+        ReplaceAllItems(newItems, std::move(newKeys));
+        m_updateAppliedEventSource(*this, nullptr);
+        return;
+    }
+
+    auto work = std::make_shared<DiffWork>();
+    auto const currentItems = m_items.get();
+    work->OldKeys = m_keys;
+    work->OldIdentities.reserve(m_keys.size());
+    for (auto const& item : currentItems)
+    {
+        work->OldIdentities.push_back(winrt::get_abi(item));
+    }
+    work->NewIdentities.reserve(newKeys.size());
+    for (auto const& item : newItems)
+    {
+        work->NewIdentities.push_back(winrt::get_abi(item));
+    }
+    work->NewKeys = std::move(newKeys);
+
+    m_pendingItems.set(newItems);
+    m_diffAction = winrt::ThreadPool::RunAsync(winrt::WorkItemHandler(
+        [work](const winrt::IAsyncAction& /*action*/)
+    {
+        ComputeChanges(*work);
+    }));
+
+    auto strongThis = get_strong();
+    const auto generation = m_generation;
+    m_diffAction.Completed(winrt::AsyncActionCompletedHandler(
+        [strongThis, work, generation](const winrt::IAsyncAction& /*action*/, winrt::AsyncStatus status)
+    {
+        if (status != winrt::AsyncStatus::Completed)
+        {
+            return;
+        }
+
+        strongThis->m_dispatcherHelper.RunAsync(
+            [strongThis, work, generation]()
+        {
+            strongThis->ApplyChanges(generation, *work);
+        });
+    }));
+}
+
+bool DiffingItemsSourceView::IsUpdatePending()
+{
+    return static_cast<bool>(m_pendingItems);
+}
+
+winrt::event_token DiffingItemsSourceView::UpdateApplied(winrt::TypedEventHandler<winrt::DiffingItemsSourceView, winrt::IInspectable> const& value)
+{
+    return m_updateAppliedEventSource.add(value);
+}
+
+void DiffingItemsSourceView::UpdateApplied(winrt::event_token const& token)
+{
+    m_updateAppliedEventSource.remove(token);
+}
+
+#pragma endregion
+
+#pragma region IDataSourceOverrides
+
+int32_t DiffingItemsSourceView::GetSizeCore()
+{
+    return static_cast<int32_t>(m_keys.size());
+}
+
+winrt::IInspectable DiffingItemsSourceView::GetAtCore(int index)
+{
+    if (index < 0 || index >= static_cast<int>(m_keys.size()))
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
+    return m_items.get().GetAt(static_cast<uint32_t>(index));
+}
+
+bool DiffingItemsSourceView::HasKeyIndexMappingCore()
+{
+    return true;
+}
+
+winrt::hstring DiffingItemsSourceView::KeyFromIndexCore(int index)
+{
+    if (index < 0 || index >= static_cast<int>(m_keys.size()))
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
+    return m_keys[index];
+}
+
+int DiffingItemsSourceView::IndexFromKeyCore(winrt::hstring const& id)
+{
+    if (!m_isIndexFromKeyValid)
+    {
+        m_indexFromKey.clear();
+        m_indexFromKey.reserve(m_keys.size());
+        for (int i = 0; i < static_cast<int>(m_keys.size()); ++i)
+        {
+            m_indexFromKey.emplace(m_keys[i], i);
+        }
+        m_isIndexFromKeyValid = true;
+    }
+
+    auto const it = m_indexFromKey.find(id);
+    return it != m_indexFromKey.end() ? it->second : -1;
+}
+
+#pragma endregion
+
+/* static */
+void DiffingItemsSourceView::ComputeChanges(DiffWork& work)
+{
+    const int oldCount = static_cast<int>(work.OldKeys.size());
+    const int newCount = static_cast<int>(work.NewKeys.size());
+
+    std::unordered_map<winrt::hstring, int> newIndexFromKey;
+    newIndexFromKey.reserve(newCount);
+    for (int i = 0; i < newCount; ++i)
+    {
+        if (!newIndexFromKey.emplace(work.NewKeys[i], i).second)
+        {
+            work.IsReset = true;
+            return;
+        }
+    }
+
+    // Where each old item ends up, or -1 if it is gone.
+    std::vector<int> newIndexFromOldIndex(oldCount, -1);
+    std::vector<int> oldIndexFromNewIndex(newCount, -1);
+    for (int i = 0; i < oldCount; ++i)
+    {
+        auto const it = newIndexFromKey.find(work.OldKeys[i]);
+        if (it != newIndexFromKey.end())
+        {
+            if (oldIndexFromNewIndex[it->second] != -1)
+            {
+                // Duplicate key in the current snapshot.
+                work.IsReset = true;
+                return;
+            }
+
+            newIndexFromOldIndex[i] = it->second;
+            oldIndexFromNewIndex[it->second] = i;
+        }
+    }
+
+    // The longest run of surviving items that are already in the right relative order
+    // stays in place. Every other surviving item is moved, i.e. removed and added back.
+    std::vector<int> tails;         // Old index ending the best increasing run of each length.
+    std::vector<int> previous(oldCount, -1);
+    for (int i = 0; i < oldCount; ++i)
+    {
+        const int newIndex = newIndexFromOldIndex[i];
+        if (newIndex != -1)
+        {
+            auto const position = std::lower_bound(
+                tails.begin(),
+                tails.end(),
+                newIndex,
+                [&newIndexFromOldIndex](int oldIndex, int value) { return newIndexFromOldIndex[oldIndex] < value; });
+            previous[i] = position != tails.begin() ? *(position - 1) : -1;
+            if (position == tails.end())
+            {
+                tails.push_back(i);
+            }
+            else
+            {
+                *position = i;
+            }
+        }
+    }
+
+    std::vector<bool> isOldKept(oldCount, false);
+    std::vector<bool> isNewKept(newCount, false);
+    for (int i = tails.empty() ? -1 : tails.back(); i != -1; i = previous[i])
+    {
+        isOldKept[i] = true;
+        isNewKept[newIndexFromOldIndex[i]] = true;
+    }
+
+    // Removes go from the back so that the indices of the ranges still to be removed
+    // don't move. What is left afterwards is the kept items, in their final order.
+    for (int i = oldCount - 1; i >= 0;)
+    {
+        if (isOldKept[i])
+        {
+            --i;
+            continue;
+        }
+
+        const int end = i;
+        while (i >= 0 && !isOldKept[i])
+        {
+            --i;
+        }
+        work.Changes.push_back({ winrt::NotifyCollectionChangedAction::Remove, i + 1, end - i, -1 });
+    }
+
+    // Adds go from the front, by the time a range is added everything before it is final.
+    for (int i = 0; i < newCount;)
+    {
+        if (isNewKept[i])
+        {
+            ++i;
+            continue;
+        }
+
+        const int start = i;
+        while (i < newCount && !isNewKept[i])
+        {
+            ++i;
+        }
+        work.Changes.push_back({ winrt::NotifyCollectionChangedAction::Add, start, i - start, start });
+    }
+
+    // Kept items whose key stayed but whose item did not get their realized elements
+    // re-prepared with the new item.
+    for (int i = 0; i < newCount;)
+    {
+        auto const isReplaced = [&](int index)
+        {
+            return isNewKept[index] && work.NewIdentities[index] != work.OldIdentities[oldIndexFromNewIndex[index]];
+        };
+
+        if (!isReplaced(i))
+        {
+            ++i;
+            continue;
+        }
+
+        const int start = i;
+        while (i < newCount && isReplaced(i))
+        {
+            ++i;
+        }
+        work.Changes.push_back({ winrt::NotifyCollectionChangedAction::Replace, start, i - start, start });
+    }
+}
+
+void DiffingItemsSourceView::ApplyChanges(uint32_t generation, const DiffWork& work)
+{
+    if (generation != m_generation)
+    {
+        return;
+    }
+
+    auto const newItems = m_pendingItems.get();
+    m_pendingItems.set(nullptr);
+    m_diffAction = nullptr;
+
+    if (work.IsReset)
+    {
+        auto newKeys = work.NewKeys;
+        ReplaceAllItems(newItems, std::move(newKeys));
+        m_updateAppliedEventSource(*this, nullptr);
+        return;
+    }
+
+    auto const items = m_items.get();
+    for (auto const& change : work.Changes)
+    {
+        m_isIndexFromKeyValid = false;
+
+        switch (change.Action)
+        {
+        case winrt::NotifyCollectionChangedAction::Remove:
+        {
+            auto oldItems = CopyRange(items, change.Index, change.Count);
+            for (int i = change.Index + change.Count - 1; i >= change.Index; --i)
+            {
+                items.RemoveAt(static_cast<uint32_t>(i));
+            }
+            m_keys.erase(m_keys.begin() + change.Index, m_keys.begin() + change.Index + change.Count);
+
+            OnDataSourceChanged(
+                winrt::NotifyCollectionChangedEventArgs(
+                    winrt::NotifyCollectionChangedAction::Remove,
+                    nullptr /* newItems */,
+                    oldItems,
+                    -1 /* newIndex */,
+                    change.Index));
+            break;
+        }
+
+        case winrt::NotifyCollectionChangedAction::Add:
+        {
+            auto addedItems = CopyRange(newItems, change.SourceIndex, change.Count);
+            for (int i = 0; i < change.Count; ++i)
+            {
+                items.InsertAt(static_cast<uint32_t>(change.Index + i), addedItems.GetAt(static_cast<uint32_t>(i)));
+            }
+            m_keys.insert(
+                m_keys.begin() + change.Index,
+                work.NewKeys.begin() + change.SourceIndex,
+                work.NewKeys.begin() + change.SourceIndex + change.Count);
+
+            OnDataSourceChanged(
+                winrt::NotifyCollectionChangedEventArgs(
+                    winrt::NotifyCollectionChangedAction::Add,
+                    addedItems,
+                    nullptr /* oldItems */,
+                    change.Index,
+                    -1 /* oldIndex */));
+            break;
+        }
+
+        case winrt::NotifyCollectionChangedAction::Replace:
+        {
+            auto oldItems = CopyRange(items, change.Index, change.Count);
+            auto replacingItems = CopyRange(newItems, change.SourceIndex, change.Count);
+            for (int i = 0; i < change.Count; ++i)
+            {
+                items.SetAt(static_cast<uint32_t>(change.Index + i), replacingItems.GetAt(static_cast<uint32_t>(i)));
+            }
+
+            OnDataSourceChanged(
+                winrt::NotifyCollectionChangedEventArgs(
+                    winrt::NotifyCollectionChangedAction::Replace,
+                    replacingItems,
+                    oldItems,
+                    change.Index,
+                    change.Index));
+            break;
+        }
+        }
+    }
+
+    MUX_ASSERT(m_keys == work.NewKeys);
+    m_updateAppliedEventSource(*this, nullptr);
+}
+
+void DiffingItemsSourceView::ReplaceAllItems(const winrt::IVector<winrt::IInspectable>& newItems, std::vector<winrt::hstring>&& newKeys)
+{
+    const bool wasEmpty = m_keys.empty();
+    const bool isEmpty = newKeys.empty();
+
+    m_items.set(newItems);
+    m_keys = std::move(newKeys);
+    m_isIndexFromKeyValid = false;
+
+    if (wasEmpty && isEmpty)
+    {
+        return;
+    }
+
+    // Going from or to nothing is a single range, anything else is a Reset.
+    if (wasEmpty)
+    {
+        OnDataSourceChanged(
+            winrt::NotifyCollectionChangedEventArgs(
+                winrt::NotifyCollectionChangedAction::Add,
+                CopyRange(newItems, 0, static_cast<int>(m_keys.size())),
+                nullptr /* oldItems */,
+                0 /* newIndex */,
+                -1 /* oldIndex */));
+    }
+    else
+    {
+        OnDataSourceChanged(
+            winrt::NotifyCollectionChangedEventArgs(
+                winrt::NotifyCollectionChangedAction::Reset,
+                nullptr /* newItems */,
+                nullptr /* oldItems */,
+                -1 /* newIndex */,
+                -1 /* oldIndex */));
+    }
+}
+
+void DiffingItemsSourceView::CancelPendingUpdate()
+{
+    if (m_diffAction)
+    {
+        m_diffAction.Cancel();
+        m_diffAction = nullptr;
+    }
+    m_pendingItems.set(nullptr);
+}
@@ -0,0 +1,85 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ItemsSourceView.h"
+#include "DiffingItemsSourceView.g.h"
+#include "DispatcherHelper.h"
+
+// ItemsSourceView over a sequence of snapshots. Each new snapshot is compared with the
+// current one by key on a background thread and the difference is raised as batched
+// Remove, Add and Replace notifications on the UI thread, so that realized elements for
+// items that are still there survive a refresh instead of being torn down by a Reset.
+// Keys are expected to be unique within a snapshot, a snapshot with duplicate keys is
+// applied with a Reset.
+class DiffingItemsSourceView :
+    public ReferenceTracker<DiffingItemsSourceView, winrt::implementation::DiffingItemsSourceViewT, ItemsSourceView>
+{
+public:
+    DiffingItemsSourceView(const winrt::ItemKeySelector& keySelector);
+    ~DiffingItemsSourceView();
+
+#pragma region IDiffingItemsSourceView
+    void UpdateItems(winrt::IIterable<winrt::IInspectable> const& items);
+    bool IsUpdatePending();
+
+    winrt::event_token UpdateApplied(winrt::TypedEventHandler<winrt::DiffingItemsSourceView, winrt::IInspectable> const& value);
+    void UpdateApplied(winrt::event_token const& token);
+#pragma endregion
+
+#pragma region IDataSourceOverrides
+    int32_t GetSizeCore() override;
+    winrt::IInspectable GetAtCore(int index) override;
+    bool HasKeyIndexMappingCore() override;
+    winrt::hstring KeyFromIndexCore(int index) override;
+    int IndexFromKeyCore(winrt::hstring const& id) override;
+#pragma endregion
+
+private:
+    // A range change, in the order in which it has to be applied. For Add and Replace,
+    // SourceIndex is where the items start in the new snapshot.
+    struct Change
+    {
+        winrt::NotifyCollectionChangedAction Action;
+        int Index;
+        int Count;
+        int SourceIndex;
+    };
+
+    // What the background thread works with. Only keys and item identities so that the
+    // items themselves are never touched off the UI thread.
+    struct DiffWork
+    {
+        std::vector<winrt::hstring> OldKeys;
+        std::vector<void*> OldIdentities;
+        std::vector<winrt::hstring> NewKeys;
+        std::vector<void*> NewIdentities;
+
+        std::vector<Change> Changes;
+        bool IsReset{ false };
+    };
+
+    static void ComputeChanges(DiffWork& work);
+    void ApplyChanges(uint32_t generation, const DiffWork& work);
+    void ReplaceAllItems(const winrt::IVector<winrt::IInspectable>& newItems, std::vector<winrt::hstring>&& newKeys);
+    void CancelPendingUpdate();
+
+    winrt::ItemKeySelector m_keySelector{ nullptr };
+
+    tracker_ref<winrt::IVector<winrt::IInspectable>> m_items{ this };
+    std::vector<winrt::hstring> m_keys;
+    // Built on first use after a change.
+    std::unordered_map<winrt::hstring, int> m_indexFromKey;
+    bool m_isIndexFromKeyValid{ false };
+
+    // The snapshot being diffed, applied once the diff comes back.
+    tracker_ref<winrt::IVector<winrt::IInspectable>> m_pendingItems{ this };
+    winrt::IAsyncAction m_diffAction{ nullptr };
+    // Bumped by every UpdateItems so that diffs against older snapshots are dropped.
+    uint32_t m_generation{ 0 };
+
+    event_source<winrt::TypedEventHandler<winrt::DiffingItemsSourceView, winrt::IInspectable>> m_updateAppliedEventSource{ this };
+
+    DispatcherHelper m_dispatcherHelper;
+};
@@ -221,6 +221,7 @@ void ElementAnimator::OnRendering(winrt::IInspectable const& /*sender*/, winrt::
 
     auto resetState = gsl::finally([this]()
     {
+        OnAnimationsStarted();
         ResetState();
     });
 
@@ -110,6 +110,11 @@ public:
 
 #pragma endregion
 
+protected:
+    // Called once per rendering pass after the Start*Animation overrides have been
+    // invoked for every queued element, so derived classes can batch the work.
+    virtual void OnAnimationsStarted() {}
+
 private:
     void QueueElementForAnimation(ElementInfo elementInfo);
     void OnRendering(const winrt::IInspectable& sender, const winrt::IInspectable& args);
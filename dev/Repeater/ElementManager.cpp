@@ -35,7 +35,7 @@ void ElementManager::OnBeginMeasure(const ScrollOrientation& orientation)
                 // Make sure there is enough space for the bounds.
                 // Note: We could optimize when the count becomes smaller, but keeping
                 // it always up to date is the simplest option for now.
-                m_realizedElementLayoutBounds.resize(count, winrt::Rect());
+                m_realizedElementLayoutBounds.Resize(count);
             }
         }
     }
@@ -84,7 +84,7 @@ void ElementManager::Add(const winrt::UIElement& element, int dataIndex)
     }
 
     m_realizedElements.emplace_back(tracker_ref<winrt::UIElement>{ m_owner, element });
-    m_realizedElementLayoutBounds.emplace_back(winrt::Rect());
+    m_realizedElementLayoutBounds.PushBack(winrt::Rect());
 }
 
 void ElementManager::Insert(int realizedIndex, int dataIndex, const winrt::UIElement& element)
@@ -95,9 +95,18 @@ void ElementManager::Insert(int realizedIndex, int dataIndex, const winrt::UIEle
         m_firstRealizedDataIndex = dataIndex;
     }
 
-    m_realizedElements.insert(m_realizedElements.begin() + realizedIndex, tracker_ref<winrt::UIElement>{ m_owner, element });
     // Set bounds to an invalid rect since we do not know it yet.
-    m_realizedElementLayoutBounds.insert(m_realizedElementLayoutBounds.begin() + realizedIndex, winrt::Rect{ -1.f, -1.f, -1.f, -1.f });
+    const winrt::Rect invalidBounds{ -1.f, -1.f, -1.f, -1.f };
+    if (realizedIndex == 0)
+    {
+        m_realizedElements.emplace_front(tracker_ref<winrt::UIElement>{ m_owner, element });
+        m_realizedElementLayoutBounds.PushFront(invalidBounds);
+    }
+    else
+    {
+        m_realizedElements.insert(m_realizedElements.begin() + realizedIndex, tracker_ref<winrt::UIElement>{ m_owner, element });
+        m_realizedElementLayoutBounds.Insert(realizedIndex, invalidBounds);
+    }
 }
 
 void ElementManager::ClearRealizedRange(int realizedIndex, int count)
@@ -108,7 +117,8 @@ void ElementManager::ClearRealizedRange(int realizedIndex, int count)
         // Clear from the edges so that ItemsRepeater can optimize on maintaining 
         // realized indices without walking through all the children every time.
         int index = realizedIndex == 0 ? realizedIndex + i : (realizedIndex + count - 1) - i;
-        if (auto elementRef = m_realizedElements[index])
+        auto const& elementRef = m_realizedElements[index];
+        if (elementRef)
         {
             m_context.RecycleElement(elementRef.get());
         }
@@ -116,7 +126,7 @@ void ElementManager::ClearRealizedRange(int realizedIndex, int count)
 
     int endIndex = realizedIndex + count;
     m_realizedElements.erase(m_realizedElements.begin() + realizedIndex, m_realizedElements.begin() + endIndex);
-    m_realizedElementLayoutBounds.erase(m_realizedElementLayoutBounds.begin() + realizedIndex, m_realizedElementLayoutBounds.begin() + endIndex);
+    m_realizedElementLayoutBounds.Erase(realizedIndex, count);
 
     if (realizedIndex == 0)
     {
@@ -156,24 +166,24 @@ void ElementManager::ClearRealizedRange()
 winrt::Rect ElementManager::GetLayoutBoundsForDataIndex(int dataIndex) const
 {
     int realizedIndex = GetRealizedRangeIndexFromDataIndex(dataIndex);
-    return m_realizedElementLayoutBounds[realizedIndex];
+    return m_realizedElementLayoutBounds.Get(realizedIndex);
 }
 
 void ElementManager::SetLayoutBoundsForDataIndex(int dataIndex, const winrt::Rect& bounds)
 {
     int realizedIndex = GetRealizedRangeIndexFromDataIndex(dataIndex);
-    m_realizedElementLayoutBounds[realizedIndex] = bounds;
+    m_realizedElementLayoutBounds.Set(realizedIndex, bounds);
 }
 
 
 winrt::Rect ElementManager::GetLayoutBoundsForRealizedIndex(int realizedIndex) const
 {
-    return m_realizedElementLayoutBounds[realizedIndex];
+    return m_realizedElementLayoutBounds.Get(realizedIndex);
 }
 
 void ElementManager::SetLayoutBoundsForRealizedIndex(int realizedIndex, const winrt::Rect& bounds)
 {
-    m_realizedElementLayoutBounds[realizedIndex] = bounds;
+    m_realizedElementLayoutBounds.Set(realizedIndex, bounds);
 }
 
 
@@ -223,7 +233,7 @@ void ElementManager::EnsureElementRealized(bool forward, int dataIndex, const ws
         }
 
         MUX_ASSERT(IsDataIndexRealized(dataIndex));
-        REPEATER_TRACE_INFO(L"%ls: \tCreated element for index %d. \n", layoutId.data(), dataIndex);
+        REPEATER_TRACE_ELEMENT("Created", layoutId.data(), dataIndex);
     }
 }
 
@@ -342,9 +352,14 @@ void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, con
     int frontCutoffIndex = -1;
     int backCutoffIndex = realizedRangeSize;
 
+    const auto& starts = m_realizedElementLayoutBounds.Starts(orientation);
+    const auto& sizes = m_realizedElementLayoutBounds.Sizes(orientation);
+    const float windowStart = orientation == ScrollOrientation::Vertical ? window.Y : window.X;
+    const float windowEnd = windowStart + (orientation == ScrollOrientation::Vertical ? window.Height : window.Width);
+
     for (int i = 0;
         i < realizedRangeSize &&
-        !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
+        !Intersects(windowStart, windowEnd, starts[i], sizes[i]);
         ++i)
     {
         ++frontCutoffIndex;
@@ -352,7 +367,7 @@ void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, con
 
     for (int i = realizedRangeSize - 1;
         i >= 0 &&
-        !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
+        !Intersects(windowStart, windowEnd, starts[i], sizes[i]);
         --i)
     {
         --backCutoffIndex;
@@ -370,16 +385,55 @@ void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, con
 }
 
 /* static */
-bool ElementManager::Intersects(const winrt::Rect& lhs, const winrt::Rect& rhs, const ScrollOrientation& orientation)
+bool ElementManager::Intersects(float windowStart, float windowEnd, float start, float size)
 {
-    auto lhsStart = orientation == ScrollOrientation::Vertical ? lhs.Y : lhs.X;
-    auto lhsEnd = orientation == ScrollOrientation::Vertical ? lhs.Y + lhs.Height : lhs.X + lhs.Width;
-    auto rhsStart = orientation == ScrollOrientation::Vertical ? rhs.Y : rhs.X;
-    auto rhsEnd = orientation == ScrollOrientation::Vertical ? rhs.Y + rhs.Height : rhs.X + rhs.Width;
+    return windowEnd >= start && windowStart <= start + size;
+}
+
+#pragma region LayoutBoundsStore
 
-    return lhsEnd >= rhsStart && lhsStart <= rhsEnd;
+void ElementManager::LayoutBoundsStore::PushBack(const winrt::Rect& bounds)
+{
+    m_x.push_back(bounds.X);
+    m_y.push_back(bounds.Y);
+    m_width.push_back(bounds.Width);
+    m_height.push_back(bounds.Height);
 }
 
+void ElementManager::LayoutBoundsStore::PushFront(const winrt::Rect& bounds)
+{
+    m_x.push_front(bounds.X);
+    m_y.push_front(bounds.Y);
+    m_width.push_front(bounds.Width);
+    m_height.push_front(bounds.Height);
+}
+
+void ElementManager::LayoutBoundsStore::Insert(size_t index, const winrt::Rect& bounds)
+{
+    m_x.insert(m_x.begin() + index, bounds.X);
+    m_y.insert(m_y.begin() + index, bounds.Y);
+    m_width.insert(m_width.begin() + index, bounds.Width);
+    m_height.insert(m_height.begin() + index, bounds.Height);
+}
+
+void ElementManager::LayoutBoundsStore::Erase(size_t index, size_t count)
+{
+    m_x.erase(m_x.begin() + index, m_x.begin() + index + count);
+    m_y.erase(m_y.begin() + index, m_y.begin() + index + count);
+    m_width.erase(m_width.begin() + index, m_width.begin() + index + count);
+    m_height.erase(m_height.begin() + index, m_height.begin() + index + count);
+}
+
+void ElementManager::LayoutBoundsStore::Resize(size_t count)
+{
+    m_x.resize(count);
+    m_y.resize(count);
+    m_width.resize(count);
+    m_height.resize(count);
+}
+
+#pragma endregion
+
 void ElementManager::OnItemsAdded(int index, int count)
 {
     // Using the old indices here (before it was updated by the collection change)
@@ -48,11 +48,56 @@ public:
     int GetElementDataIndex(const winrt::UIElement& suggestedAnchor) const;
     int GetDataIndexFromRealizedRangeIndex(int rangeIndex) const;
 
+    // Memory held for the realized range, not counting the elements themselves.
+    size_t EstimatedBytes() const
+    {
+        return m_realizedElements.size() * sizeof(tracker_ref<winrt::UIElement>) +
+            m_realizedElementLayoutBounds.size() * 4 * sizeof(float);
+    }
+
 private:
+    // Layout bounds of the realized elements, stored as one array per component.
+    // Scans along the scrolling direction (e.g. finding the elements outside the
+    // realization window) then only walk the start and size arrays they need
+    // instead of striding over whole rects.
+    class LayoutBoundsStore final
+    {
+    public:
+        size_t size() const { return m_x.size(); }
+
+        winrt::Rect Get(size_t index) const
+        {
+            return winrt::Rect{ m_x[index], m_y[index], m_width[index], m_height[index] };
+        }
+
+        void Set(size_t index, const winrt::Rect& bounds)
+        {
+            m_x[index] = bounds.X;
+            m_y[index] = bounds.Y;
+            m_width[index] = bounds.Width;
+            m_height[index] = bounds.Height;
+        }
+
+        void PushBack(const winrt::Rect& bounds);
+        void PushFront(const winrt::Rect& bounds);
+        void Insert(size_t index, const winrt::Rect& bounds);
+        void Erase(size_t index, size_t count);
+        void Resize(size_t count);
+
+        const std::deque<float>& Starts(ScrollOrientation orientation) const { return orientation == ScrollOrientation::Vertical ? m_y : m_x; }
+        const std::deque<float>& Sizes(ScrollOrientation orientation) const { return orientation == ScrollOrientation::Vertical ? m_height : m_width; }
+
+    private:
+        std::deque<float> m_x;
+        std::deque<float> m_y;
+        std::deque<float> m_width;
+        std::deque<float> m_height;
+    };
+
     int GetRealizedRangeIndexFromDataIndex(int dataIndex) const;
 
     void DiscardElementsOutsideWindow(const winrt::Rect& window, const ScrollOrientation& orientation);
-    static bool Intersects(const winrt::Rect& lhs, const winrt::Rect& rhs, const ScrollOrientation& orientation);
+    static bool Intersects(float windowStart, float windowEnd, float start, float size);
 
     void OnItemsAdded(int index, int count);
     void OnItemsRemoved(int index, int count);
@@ -61,8 +106,11 @@ private:
 
     const ITrackerHandleManager* m_owner;
 
-    std::vector<tracker_ref<winrt::UIElement>> m_realizedElements;
-    std::vector<winrt::Rect> m_realizedElementLayoutBounds;
+    // The realized range grows and shrinks at both ends (backward generation, items
+    // added before the first realized item, discarding elements outside the window),
+    // so keep it in containers that do not shift memory on push/pop at the front.
+    std::deque<tracker_ref<winrt::UIElement>> m_realizedElements;
+    LayoutBoundsStore m_realizedElementLayoutBounds;
     int m_firstRealizedDataIndex{ -1 };
     winrt::VirtualizingLayoutContext m_context{ nullptr };
 };
\ No newline at end of file
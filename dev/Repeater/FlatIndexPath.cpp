@@ -0,0 +1,113 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include "FlatIndexPath.h"
+
+FlatIndexPath::FlatIndexPath(int index)
+{
+    Append(index);
+}
+
+FlatIndexPath::FlatIndexPath(int groupIndex, int itemIndex)
+{
+    Append(groupIndex);
+    Append(itemIndex);
+}
+
+int FlatIndexPath::GetAt(int index) const
+{
+    MUX_ASSERT(index >= 0 && index < m_size);
+    return Data()[index];
+}
+
+void FlatIndexPath::Append(int index)
+{
+    if (m_size < InlineCapacity)
+    {
+        m_inline[m_size] = index;
+    }
+    else
+    {
+        if (m_size == InlineCapacity)
+        {
+            m_overflow.assign(m_inline.begin(), m_inline.end());
+        }
+        m_overflow.push_back(index);
+    }
+
+    ++m_size;
+}
+
+FlatIndexPath FlatIndexPath::CloneWithChildIndex(int childIndex) const
+{
+    FlatIndexPath result = *this;
+    result.Append(childIndex);
+    return result;
+}
+
+FlatIndexPath FlatIndexPath::Prefix(int length) const
+{
+    MUX_ASSERT(length >= 0 && length <= m_size);
+    FlatIndexPath result;
+    for (int i = 0; i < length; i++)
+    {
+        result.Append(GetAt(i));
+    }
+
+    return result;
+}
+
+bool FlatIndexPath::StartsWith(const FlatIndexPath& prefix) const
+{
+    return prefix.m_size <= m_size &&
+        std::equal(prefix.begin(), prefix.end(), begin());
+}
+
+int FlatIndexPath::CompareTo(const FlatIndexPath& rhs) const
+{
+    int compareResult = 0;
+    const int lhsCount = m_size;
+    const int rhsCount = rhs.m_size;
+
+    if (lhsCount == 0 || rhsCount == 0)
+    {
+        // one of the paths are empty, compare based on size
+        compareResult = (lhsCount - rhsCount);
+    }
+    else
+    {
+        // both paths are non-empty, but can be of different size
+        const int* lhsData = Data();
+        const int* rhsData = rhs.Data();
+        for (int i = 0; i < std::min(lhsCount, rhsCount); i++)
+        {
+            if (lhsData[i] < rhsData[i])
+            {
+                compareResult = -1;
+                break;
+            }
+            else if (lhsData[i] > rhsData[i])
+            {
+                compareResult = 1;
+                break;
+            }
+        }
+
+        // if both match upto min(lhsCount, rhsCount), compare based on size
+        compareResult = compareResult == 0 ? (lhsCount - rhsCount) : compareResult;
+    }
+
+    if (compareResult != 0)
+    {
+        compareResult = compareResult > 0 ? 1 : -1;
+    }
+
+    return compareResult;
+}
+
+bool FlatIndexPath::IsValid() const
+{
+    return std::all_of(begin(), end(), [](int index) { return index >= 0; });
+}
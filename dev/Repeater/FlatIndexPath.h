@@ -0,0 +1,41 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Value type used by SelectionModel to work with index paths internally. Paths up to
+// InlineCapacity deep are stored inline so building and copying them while walking the
+// selection tree does not allocate. IndexPath wraps one of these and is only created
+// where a path is handed out through the API.
+class FlatIndexPath
+{
+public:
+    FlatIndexPath() {}
+    explicit FlatIndexPath(int index);
+    FlatIndexPath(int groupIndex, int itemIndex);
+
+    int GetSize() const { return m_size; }
+    int GetAt(int index) const;
+    const int* begin() const { return Data(); }
+    const int* end() const { return Data() + m_size; }
+
+    void Append(int index);
+    FlatIndexPath CloneWithChildIndex(int childIndex) const;
+    // The first 'length' indices of this path.
+    FlatIndexPath Prefix(int length) const;
+    bool StartsWith(const FlatIndexPath& prefix) const;
+
+    // Returns -1, 0 or 1 like IndexPath.CompareTo.
+    int CompareTo(const FlatIndexPath& rhs) const;
+    bool IsValid() const;
+
+private:
+    static constexpr int InlineCapacity = 4;
+
+    const int* Data() const { return m_size <= InlineCapacity ? m_inline.data() : m_overflow.data(); }
+
+    std::array<int, InlineCapacity> m_inline{};
+    // Holds the whole path once it no longer fits in m_inline.
+    std::vector<int> m_overflow;
+    int m_size{ 0 };
+};
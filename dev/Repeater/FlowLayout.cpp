@@ -90,7 +90,10 @@ winrt::Size FlowLayout::MeasureOverride(
     winrt::VirtualizingLayoutContext const& context,
     winrt::Size const& availableSize)
 {
-    auto desiredSize = GetFlowAlgorithm(context).Measure(
+    const auto flowState = GetAsFlowState(context.LayoutState());
+    flowState->LineIndex().EnsureLayoutParameters(availableSize.*Minor(), MinItemSpacing(), OrientationBasedMeasures::GetScrollOrientation());
+
+    auto desiredSize = flowState->FlowAlgorithm().Measure(
         availableSize,
         context,
         true, /* isWrapping*/
@@ -98,6 +101,8 @@ winrt::Size FlowLayout::MeasureOverride(
         LineSpacing(),
         OrientationBasedMeasures::GetScrollOrientation(),
         LayoutId());
+
+    flowState->LineIndex().OnLayoutPassCompleted();
     return desiredSize;
 }
 
@@ -120,6 +125,7 @@ void FlowLayout::OnItemsChangedCore(
     winrt::NotifyCollectionChangedEventArgs const& args)
 {
     GetFlowAlgorithm(context).OnDataSourceChanged(source, args, context);
+    GetAsFlowState(context.LayoutState())->LineIndex().OnItemsChanged(args);
     // Always invalidate layout to keep the view accurate.
     InvalidateLayout();
 }
@@ -176,12 +182,24 @@ winrt::FlowLayoutAnchorInfo FlowLayout::GetAnchorForRealizationRect(
             DoesRealizationWindowOverlapExtent(realizationRect, MinorMajorRect(lastExtent.*MinorStart(), lastExtent.*MajorStart(), availableSize.*Minor(), static_cast<float>(extentMajorSize))))
         {
             const double realizationWindowStartWithinExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
-            const int lineIndex = std::max(0, (int)(realizationWindowStartWithinExtent / averageLineSize));
-            anchorIndex = (int)(lineIndex * averageItemsPerLine);
+            auto& lineIndex = flowState->LineIndex();
+            const int indexedLine = lineIndex.LineFromOffset(std::max(0.0, realizationWindowStartWithinExtent), LineSpacing());
+            if (indexedLine >= 0)
+            {
+                anchorIndex = lineIndex.FirstItemIndex(indexedLine);
+                offset = lineIndex.LineOffset(indexedLine, LineSpacing()) + lastExtent.*MajorStart();
+            }
+            else
+            {
+                // Past the indexed lines, estimate from where they end.
+                const double indexedSize = lineIndex.TotalSize(LineSpacing());
+                const int estimatedLine = std::max(0, (int)((realizationWindowStartWithinExtent - indexedSize) / averageLineSize));
+                anchorIndex = lineIndex.ItemCount() + (int)(estimatedLine * averageItemsPerLine);
+                offset = indexedSize + estimatedLine * averageLineSize + lastExtent.*MajorStart();
+            }
 
             // Clamp it to be within valid range
             anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
-            offset = lineIndex * averageLineSize + lastExtent.*MajorStart();
         }
     }
 
@@ -204,8 +222,16 @@ winrt::FlowLayoutAnchorInfo FlowLayout::GetAnchorForTargetElement(
         auto flowState = GetAsFlowState(state);
         double averageItemsPerLine = 0;
         const double averageLineSize = GetAverageLineInfo(availableSize, context, flowState, averageItemsPerLine) + LineSpacing();
-        const int lineIndex = (int)(targetIndex / averageItemsPerLine);
-        offset = lineIndex * averageLineSize + flowState->FlowAlgorithm().LastExtent().*MajorStart();
+
+        // If we know the line the target was laid out in, anchor on the start of that line.
+        auto& lineIndex = flowState->LineIndex();
+        const int indexedLine = lineIndex.LineFromItemIndex(targetIndex);
+        if (indexedLine >= 0)
+        {
+            index = lineIndex.FirstItemIndex(indexedLine);
+        }
+
+        offset = GetLineOffsetForItem(targetIndex, averageLineSize, averageItemsPerLine, flowState) + flowState->FlowAlgorithm().LastExtent().*MajorStart();
     }
 
     return { index, offset };
@@ -239,12 +265,9 @@ winrt::Rect FlowLayout::GetExtent(
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
-            const int linesBeforeFirst = static_cast<int>(firstRealizedItemIndex / averageItemsPerLine);
-            const double extentMajorStart = firstRealizedLayoutBounds.*MajorStart() - linesBeforeFirst * averageLineSize;
+            const double extentMajorStart = firstRealizedLayoutBounds.*MajorStart() - GetLineOffsetForItem(firstRealizedItemIndex, averageLineSize, averageItemsPerLine, flowState);
             extent.*MajorStart() = static_cast<float>(extentMajorStart);
-            const int remainingItems = itemsCount - lastRealizedItemIndex - 1;
-            const int remainingLinesAfterLast = static_cast<int>((remainingItems / averageItemsPerLine));
-            const double extentMajorSize = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + remainingLinesAfterLast * averageLineSize;
+            const double extentMajorSize = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + GetSizeOfLinesAfterItem(lastRealizedItemIndex, itemsCount, averageLineSize, averageItemsPerLine, flowState);
             extent.*MajorSize() = static_cast<float>(extentMajorSize);
 
             // If the available size is infinite, we will have realized all the items in one line.
@@ -392,6 +415,8 @@ void FlowLayout::Algorithm_OnLineArranged(
     double lineSize,
     const winrt::VirtualizingLayoutContext & context)
 {
+    GetAsFlowState(context.LayoutState())->LineIndex().OnLineArranged(startIndex, countInLine, lineSize, context.ItemCount());
+
     return overridable().OnLineArranged(
         startIndex,
         countInLine,
@@ -459,4 +484,42 @@ double FlowLayout::GetAverageLineInfo(
     return avgLineSize;
 }
 
+double FlowLayout::GetLineOffsetForItem(
+    int itemIndex,
+    double averageLineSize,
+    double averageItemsPerLine,
+    const winrt::com_ptr<FlowLayoutState>& flowState)
+{
+    auto& lineIndex = flowState->LineIndex();
+    const int indexedLine = lineIndex.LineFromItemIndex(itemIndex);
+    if (indexedLine >= 0)
+    {
+        return lineIndex.LineOffset(indexedLine, LineSpacing());
+    }
+
+    const int estimatedLinesBefore = static_cast<int>((itemIndex - lineIndex.ItemCount()) / averageItemsPerLine);
+    return lineIndex.TotalSize(LineSpacing()) + estimatedLinesBefore * averageLineSize;
+}
+
+double FlowLayout::GetSizeOfLinesAfterItem(
+    int itemIndex,
+    int itemsCount,
+    double averageLineSize,
+    double averageItemsPerLine,
+    const winrt::com_ptr<FlowLayoutState>& flowState)
+{
+    auto& lineIndex = flowState->LineIndex();
+    const int indexedLine = lineIndex.LineFromItemIndex(itemIndex);
+    if (indexedLine >= 0)
+    {
+        const double indexedSizeAfter = lineIndex.TotalSize(LineSpacing()) - lineIndex.LineOffset(indexedLine + 1, LineSpacing());
+        const int estimatedLinesAfter = static_cast<int>((itemsCount - lineIndex.ItemCount()) / averageItemsPerLine);
+        return indexedSizeAfter + estimatedLinesAfter * averageLineSize;
+    }
+
+    const int remainingItems = itemsCount - itemIndex - 1;
+    const int remainingLinesAfterLast = static_cast<int>((remainingItems / averageItemsPerLine));
+    return remainingLinesAfterLast * averageLineSize;
+}
+
 #pragma endregion
@@ -161,6 +161,21 @@ private:
         return GetAsFlowState(context.LayoutState())->FlowAlgorithm();
     }
 
+    // Offset of the line containing itemIndex from the start of the extent, and the size of the
+    // lines after the one containing itemIndex. Exact for the lines in the line index and
+    // estimated from the average line info past them.
+    double GetLineOffsetForItem(
+        int itemIndex,
+        double averageLineSize,
+        double averageItemsPerLine,
+        const winrt::com_ptr<FlowLayoutState>& flowState);
+    double GetSizeOfLinesAfterItem(
+        int itemIndex,
+        int itemsCount,
+        double averageLineSize,
+        double averageItemsPerLine,
+        const winrt::com_ptr<FlowLayoutState>& flowState);
+
     bool DoesRealizationWindowOverlapExtent(const winrt::Rect& realizationWindow, const winrt::Rect& extent)
     {
         return MajorEnd(realizationWindow) >= extent.*MajorStart() && realizationWindow.*MajorStart() <= MajorEnd(extent);
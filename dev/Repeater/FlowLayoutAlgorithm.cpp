@@ -37,9 +37,7 @@ winrt::Size FlowLayoutAlgorithm::Measure(
 {
     SetScrollOrientation(orientation);
     const auto realizationRect = RealizationRect();
-    REPEATER_TRACE_INFO(L"%ls: \tMeasureLayout Realization(%.0f,%.0f,%.0f,%.0f)\n",
-        layoutId.data(),
-        realizationRect.X, realizationRect.Y, realizationRect.Width, realizationRect.Height);
+    REPEATER_TRACE_LAYOUT_PASS("Measure", layoutId.data(), realizationRect);
 
     auto suggestedAnchorIndex = m_context.get().RecommendedAnchorIndex();
     if (m_elementManager.IsIndexValidInData(suggestedAnchorIndex))
@@ -79,7 +77,7 @@ winrt::Size FlowLayoutAlgorithm::Arrange(
     FlowLayoutAlgorithm::LineAlignment lineAlignment,
     const wstring_view& layoutId)
 {
-    REPEATER_TRACE_INFO(L"%ls: \tArrangeLayout \n", layoutId.data());
+    REPEATER_TRACE_LAYOUT_PASS("Arrange", layoutId.data(), RealizationRect());
     ArrangeVirtualizingLayout(finalSize, lineAlignment, layoutId);
 
     return winrt::Size
@@ -127,8 +125,10 @@ winrt::Size FlowLayoutAlgorithm::MeasureElement(
 {
     auto measureSize = m_algorithmCallbacks->Algorithm_GetMeasureSize(index, availableSize, context);
     element.Measure(measureSize);
-    auto provisionalArrangeSize = m_algorithmCallbacks->Algorithm_GetProvisionalArrangeSize(index, measureSize, element.DesiredSize(), context);
-    m_algorithmCallbacks->Algorithm_OnElementMeasured(element, index, availableSize, measureSize, element.DesiredSize(), provisionalArrangeSize, context);
+    // DesiredSize is a call into the framework, the callbacks can share one read.
+    auto const desiredSize = element.DesiredSize();
+    auto provisionalArrangeSize = m_algorithmCallbacks->Algorithm_GetProvisionalArrangeSize(index, measureSize, desiredSize, context);
+    m_algorithmCallbacks->Algorithm_OnElementMeasured(element, index, availableSize, measureSize, desiredSize, provisionalArrangeSize, context);
 
     return provisionalArrangeSize; 
 }
@@ -333,10 +333,7 @@ void FlowLayoutAlgorithm::Generate(
 
             m_elementManager.SetLayoutBoundsForDataIndex(currentIndex, currentBounds);
 
-            REPEATER_TRACE_INFO(L"%ls: \tLayout bounds of element %d are (%.0f,%.0f,%.0f,%.0f). \n",
-                layoutId.data(),
-                currentIndex,
-                currentBounds.X, currentBounds.Y, currentBounds.Width, currentBounds.Height);
+            REPEATER_TRACE_ELEMENT_BOUNDS("Measured", layoutId.data(), currentIndex, currentBounds);
             previousIndex = currentIndex;
             currentIndex += step;
         }
@@ -520,69 +517,80 @@ void FlowLayoutAlgorithm::PerformLineAlignment(
     FlowLayoutAlgorithm::LineAlignment lineAlignment,
     const wstring_view& layoutId)
 {
-    for (int rangeIndex = lineStartIndex; rangeIndex < lineStartIndex + countInLine; ++rangeIndex)
+    // The offset of the n-th element in the line (n = 0, 1, ...) is
+    // startAdjustment + interItemSpace * (n * interItemScale + interItemBias).
+    // Work out the coefficients once per line instead of once per element.
+    float startAdjustment = 0.0f;
+    float interItemSpace = 0.0f;
+    float interItemScale = 0.0f;
+    float interItemBias = 0.0f;
+
+    // Note: Space at start could potentially be negative
+    if (spaceAtLineStart != 0 || spaceAtLineEnd != 0)
     {
-        auto bounds = m_elementManager.GetLayoutBoundsForRealizedIndex(rangeIndex);
-
-        // Note: Space at start could potentially be negative
-        if (spaceAtLineStart != 0 || spaceAtLineEnd != 0)
+        float totalSpace = spaceAtLineStart + spaceAtLineEnd;
+        switch (lineAlignment)
         {
-            float totalSpace = spaceAtLineStart + spaceAtLineEnd;
-            switch (lineAlignment)
+        case FlowLayoutAlgorithm::LineAlignment::Start:
             {
-            case FlowLayoutAlgorithm::LineAlignment::Start:
-                {
-                    bounds.*MinorStart() -= spaceAtLineStart;
-                    break;
-                }
+                startAdjustment = -spaceAtLineStart;
+                break;
+            }
 
-            case FlowLayoutAlgorithm::LineAlignment::End:
-                {
-                    bounds.*MinorStart() += spaceAtLineEnd;
-                    break;
-                }
+        case FlowLayoutAlgorithm::LineAlignment::End:
+            {
+                startAdjustment = spaceAtLineEnd;
+                break;
+            }
 
-            case FlowLayoutAlgorithm::LineAlignment::Center:
-                {
-                    bounds.*MinorStart() -= spaceAtLineStart;
-                    bounds.*MinorStart() += totalSpace / 2;
-                    break;
-                }
-            
-            case FlowLayoutAlgorithm::LineAlignment::SpaceAround:
-                {
-                    float interItemSpace = countInLine >= 1 ? totalSpace / (countInLine * 2) : 0;
-                    bounds.*MinorStart() -= spaceAtLineStart;
-                    bounds.*MinorStart() += interItemSpace * ((rangeIndex - lineStartIndex + 1)*2 - 1);
-                    break;
-                }
+        case FlowLayoutAlgorithm::LineAlignment::Center:
+            {
+                startAdjustment = -spaceAtLineStart;
+                interItemSpace = totalSpace / 2;
+                interItemBias = 1.0f;
+                break;
+            }
 
-            case FlowLayoutAlgorithm::LineAlignment::SpaceBetween:
-                {
-                    float interItemSpace = countInLine > 1 ? totalSpace / (countInLine - 1) : 0;
-                    bounds.*MinorStart() -= spaceAtLineStart;
-                    bounds.*MinorStart() += interItemSpace * (rangeIndex - lineStartIndex);
-                    break;
-                }
+        case FlowLayoutAlgorithm::LineAlignment::SpaceAround:
+            {
+                startAdjustment = -spaceAtLineStart;
+                interItemSpace = countInLine >= 1 ? totalSpace / (countInLine * 2) : 0;
+                interItemScale = 2.0f;
+                interItemBias = 1.0f;
+                break;
+            }
 
-            case FlowLayoutAlgorithm::LineAlignment::SpaceEvenly:
-                {
-                    float interItemSpace = countInLine >= 1 ? totalSpace / (countInLine + 1) : 0;
-                    bounds.*MinorStart() -= spaceAtLineStart;
-                    bounds.*MinorStart() += interItemSpace * (rangeIndex - lineStartIndex + 1);
-                    break;
-                }
+        case FlowLayoutAlgorithm::LineAlignment::SpaceBetween:
+            {
+                startAdjustment = -spaceAtLineStart;
+                interItemSpace = countInLine > 1 ? totalSpace / (countInLine - 1) : 0;
+                interItemScale = 1.0f;
+                break;
+            }
+
+        case FlowLayoutAlgorithm::LineAlignment::SpaceEvenly:
+            {
+                startAdjustment = -spaceAtLineStart;
+                interItemSpace = countInLine >= 1 ? totalSpace / (countInLine + 1) : 0;
+                interItemScale = 1.0f;
+                interItemBias = 1.0f;
+                break;
             }
         }
+    }
+
+    for (int rangeIndex = lineStartIndex; rangeIndex < lineStartIndex + countInLine; ++rangeIndex)
+    {
+        auto bounds = m_elementManager.GetLayoutBoundsForRealizedIndex(rangeIndex);
+        const int indexInLine = rangeIndex - lineStartIndex;
+        bounds.*MinorStart() += startAdjustment;
+        bounds.*MinorStart() += interItemSpace * (indexInLine * interItemScale + interItemBias);
 
         bounds.X -= m_lastExtent.X;
         bounds.Y -= m_lastExtent.Y;
         auto element = m_elementManager.GetAt(rangeIndex);
 
-        REPEATER_TRACE_INFO(L"%ls: \tArranging element %d at (%.0f,%.0f,%.0f,%.0f). \n",
-            layoutId.data(),
-            m_elementManager.GetDataIndexFromRealizedRangeIndex(rangeIndex),
-            bounds.X, bounds.Y, bounds.Width, bounds.Height);
+        REPEATER_TRACE_ELEMENT_BOUNDS("Arranged", layoutId.data(), m_elementManager.GetDataIndexFromRealizedRangeIndex(rangeIndex), bounds);
         element.Arrange(bounds);
     }
 }
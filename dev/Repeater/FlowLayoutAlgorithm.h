@@ -29,6 +29,7 @@ public:
 
     // Methods
     winrt::Rect LastExtent() const { return m_lastExtent; }
+    winrt::Size LastAvailableSize() const { return m_lastAvailableSize; }
 
     void InitializeForContext(const winrt::VirtualizingLayoutContext& context, IFlowLayoutAlgorithmDelegates* callbacks);
     void UninitializeForContext(const winrt::VirtualizingLayoutContext& context);
@@ -60,6 +61,8 @@ public:
     winrt::UIElement GetElementIfRealized(int dataindex);
     bool TryAddElement0(winrt::UIElement const& element);
 
+    size_t EstimatedBytes() const { return m_elementManager.EstimatedBytes(); }
+
 private:
     // Types
     enum class GenerateDirection
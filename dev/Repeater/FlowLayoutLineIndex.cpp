@@ -0,0 +1,146 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include "FlowLayoutLineIndex.h"
+
+void FlowLayoutLineIndex::EnsureLayoutParameters(float availableMinorSize, double minItemSpacing, ScrollOrientation orientation)
+{
+    if (availableMinorSize != m_availableMinorSize ||
+        minItemSpacing != m_minItemSpacing ||
+        orientation != m_orientation)
+    {
+        Clear();
+        m_availableMinorSize = availableMinorSize;
+        m_minItemSpacing = minItemSpacing;
+        m_orientation = orientation;
+    }
+}
+
+void FlowLayoutLineIndex::OnLineArranged(int startIndex, int countInLine, double lineSize, int itemsCount)
+{
+    if (m_pendingStartIndex >= 0 &&
+        m_pendingStartIndex + m_pendingCount == startIndex)
+    {
+        // This line starts right where the pending one ends, so the pending one was complete.
+        CommitLine(m_pendingStartIndex, m_pendingCount, m_pendingSize);
+    }
+
+    if (startIndex + countInLine == itemsCount)
+    {
+        // Nothing can follow the last item.
+        CommitLine(startIndex, countInLine, lineSize);
+        ClearPendingLine();
+    }
+    else
+    {
+        m_pendingStartIndex = startIndex;
+        m_pendingCount = countInLine;
+        m_pendingSize = lineSize;
+    }
+}
+
+void FlowLayoutLineIndex::OnLayoutPassCompleted()
+{
+    // The last line of a pass might have been cut off at the end of the realization window.
+    ClearPendingLine();
+}
+
+void FlowLayoutLineIndex::OnItemsChanged(const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    ClearPendingLine();
+
+    int changeIndex = -1;
+    switch (args.Action())
+    {
+    case winrt::NotifyCollectionChangedAction::Add:
+        changeIndex = args.NewStartingIndex();
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Replace:
+    case winrt::NotifyCollectionChangedAction::Remove:
+        changeIndex = args.OldStartingIndex();
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Reset:
+    case winrt::NotifyCollectionChangedAction::Move:
+        Clear();
+        return;
+    }
+
+    // Lines before the one containing the change keep their breaks. Items added right
+    // after the run could still fit in its last line, so that one goes too.
+    if (changeIndex >= 0 && changeIndex <= m_itemCount && LineCount() > 0)
+    {
+        TruncateAt(LineFromItemIndex(std::min(changeIndex, m_itemCount - 1)));
+    }
+}
+
+void FlowLayoutLineIndex::Clear()
+{
+    m_lineStarts.clear();
+    m_lineSizes.Clear();
+    m_itemCount = 0;
+    ClearPendingLine();
+}
+
+int FlowLayoutLineIndex::LineFromItemIndex(int itemIndex) const
+{
+    if (itemIndex < 0 || itemIndex >= m_itemCount)
+    {
+        return -1;
+    }
+
+    auto it = std::upper_bound(m_lineStarts.begin(), m_lineStarts.end(), itemIndex);
+    return static_cast<int>(std::distance(m_lineStarts.begin(), it)) - 1;
+}
+
+int FlowLayoutLineIndex::LineFromOffset(double offset, double lineSpacing) const
+{
+    if (LineCount() == 0 || offset >= TotalSize(lineSpacing))
+    {
+        return -1;
+    }
+
+    return m_lineSizes.IndexFromOffset(offset, 0.0, lineSpacing);
+}
+
+void FlowLayoutLineIndex::CommitLine(int startIndex, int countInLine, double lineSize)
+{
+    if (startIndex < m_itemCount)
+    {
+        const int line = LineFromItemIndex(startIndex);
+        if (m_lineStarts[line] != startIndex)
+        {
+            // The items broke differently this time (e.g. an item changed size),
+            // everything from this line onwards is stale.
+            TruncateAt(line);
+            return;
+        }
+
+        const int lineEnd = line + 1 < LineCount() ? m_lineStarts[line + 1] : m_itemCount;
+        if (startIndex + countInLine == lineEnd)
+        {
+            m_lineSizes.SetSize(line, lineSize);
+            return;
+        }
+
+        TruncateAt(line);
+    }
+
+    if (startIndex == m_itemCount)
+    {
+        m_lineSizes.SetSize(LineCount(), lineSize);
+        m_lineStarts.push_back(startIndex);
+        m_itemCount = startIndex + countInLine;
+    }
+}
+
+void FlowLayoutLineIndex::TruncateAt(int line)
+{
+    MUX_ASSERT(line >= 0 && line < LineCount());
+    m_itemCount = m_lineStarts[line];
+    m_lineSizes.Remove(line, LineCount() - line);
+    m_lineStarts.resize(line);
+}
@@ -0,0 +1,57 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "MeasuredSizeIndex.h"
+#include "OrientationBasedMeasures.h"
+
+// Remembers where FlowLayout broke lines for a contiguous run of items starting at item 0,
+// along with the size of each of those lines. Estimating line boundaries from averages makes
+// the anchor index drift when scrolling away and back because the lines are re-derived
+// differently each time; with this index, items within the run map back to the exact line
+// (and line offset) they were laid out in, in O(log lines).
+// Lines are only recorded once their end is known (i.e. the next line was arranged
+// right after them, or they end with the last item).
+class FlowLayoutLineIndex final
+{
+public:
+    int LineCount() const { return static_cast<int>(m_lineStarts.size()); }
+    // Number of items covered by the indexed lines.
+    int ItemCount() const { return m_itemCount; }
+
+    // The line breaks depend on these, drop everything when one of them changes.
+    void EnsureLayoutParameters(float availableMinorSize, double minItemSpacing, ScrollOrientation orientation);
+
+    void OnLineArranged(int startIndex, int countInLine, double lineSize, int itemsCount);
+    void OnLayoutPassCompleted();
+    void OnItemsChanged(const winrt::NotifyCollectionChangedEventArgs& args);
+    void Clear();
+
+    // Returns -1 if the item or offset is past the indexed lines.
+    int LineFromItemIndex(int itemIndex) const;
+    int LineFromOffset(double offset, double lineSpacing) const;
+
+    int FirstItemIndex(int line) const { return m_lineStarts[line]; }
+    // Every line is followed by lineSpacing.
+    double LineOffset(int line, double lineSpacing) const { return m_lineSizes.OffsetFromIndex(line, 0.0, lineSpacing); }
+    double TotalSize(double lineSpacing) const { return LineOffset(LineCount(), lineSpacing); }
+
+private:
+    void CommitLine(int startIndex, int countInLine, double lineSize);
+    void TruncateAt(int line);
+    void ClearPendingLine() { m_pendingStartIndex = -1; }
+
+    std::vector<int> m_lineStarts;
+    MeasuredSizeIndex m_lineSizes;
+    int m_itemCount{};
+
+    // The last line arranged, waiting for the next one to confirm where it ends.
+    int m_pendingStartIndex{ -1 };
+    int m_pendingCount{};
+    double m_pendingSize{};
+
+    float m_availableMinorSize{ -1.0f };
+    double m_minItemSpacing{};
+    ScrollOrientation m_orientation{ ScrollOrientation::Vertical };
+};
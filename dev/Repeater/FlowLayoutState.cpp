@@ -29,6 +29,17 @@ void FlowLayoutState::UninitializeForContext(const winrt::VirtualizingLayoutCont
     m_flowAlgorithm.UninitializeForContext(context);
 }
 
+void FlowLayoutState::CopyEstimatesFrom(const FlowLayoutState& other)
+{
+    m_lineSizeEstimationBuffer = other.m_lineSizeEstimationBuffer;
+    m_itemsPerLineEstimationBuffer = other.m_itemsPerLineEstimationBuffer;
+    m_totalLineSize = other.m_totalLineSize;
+    m_totalLinesMeasured = other.m_totalLinesMeasured;
+    m_totalItemsPerLine = other.m_totalItemsPerLine;
+    m_specialElementDesiredSize = other.m_specialElementDesiredSize;
+    m_lineIndex = other.m_lineIndex;
+}
+
 void FlowLayoutState::OnLineArranged(int startIndex, int countInLine, double lineSize, const winrt::VirtualizingLayoutContext& context)
 {
     // If we do not have any estimation information, use the line for estimation. 
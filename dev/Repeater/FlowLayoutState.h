@@ -5,6 +5,7 @@
 
 #include "FlowLayoutState.g.h"
 #include "FlowLayoutAlgorithm.h"
+#include "FlowLayoutLineIndex.h"
 
 class FlowLayoutState :
     public ReferenceTracker<FlowLayoutState, winrt::implementation::FlowLayoutStateT, winrt::composing>
@@ -15,11 +16,14 @@ public:
         IFlowLayoutAlgorithmDelegates* callbacks);
     void UninitializeForContext(const winrt::VirtualizingLayoutContext& context);
     void OnLineArranged(int startIndex, int countInLine, double lineSize, const winrt::VirtualizingLayoutContext& context);
+    // Takes over what another state learned about line sizes, see ItemsRepeater::RestoreLayoutState.
+    void CopyEstimatesFrom(const FlowLayoutState& other);
 
     ::FlowLayoutAlgorithm& FlowAlgorithm() { return m_flowAlgorithm; }
     double TotalLineSize() const { return m_totalLineSize; }
     int TotalLinesMeasured() const { return m_totalLinesMeasured; }
     double TotalItemsPerLine() const { return m_totalItemsPerLine; }
+    FlowLayoutLineIndex& LineIndex() { return m_lineIndex; }
 
     winrt::Size SpecialElementDesiredSize() const { return m_specialElementDesiredSize; }
     void SpecialElementDesiredSize(winrt::Size value) { m_specialElementDesiredSize = value; }
@@ -32,5 +36,6 @@ private:
     int m_totalLinesMeasured{};
     double m_totalItemsPerLine{};
     winrt::Size m_specialElementDesiredSize{};
+    FlowLayoutLineIndex m_lineIndex{};
     static const int BufferSize = 100;
 };
\ No newline at end of file
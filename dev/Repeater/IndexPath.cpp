@@ -8,15 +8,14 @@
 
 CppWinRTActivatableClassWithBasicFactory(IndexPath);
 
-IndexPath::IndexPath(int index)
+IndexPath::IndexPath(int index) :
+    m_path(index)
 {
-    m_path.emplace_back(index);
 }
 
-IndexPath::IndexPath(int groupIndex, int itemIndex)
+IndexPath::IndexPath(int groupIndex, int itemIndex) :
+    m_path(groupIndex, itemIndex)
 {
-    m_path.emplace_back(groupIndex);
-    m_path.emplace_back(itemIndex);
 }
 
 IndexPath::IndexPath(const winrt::IVector<int>& indices)
@@ -25,7 +24,7 @@ IndexPath::IndexPath(const winrt::IVector<int>& indices)
     {
         for (auto i = 0u; i < indices.Size(); i++)
         {
-            m_path.emplace_back(indices.GetAt(i));
+            m_path.Append(indices.GetAt(i));
         }
     }
 }
@@ -34,61 +33,35 @@ IndexPath::IndexPath(const std::vector<int>& indices)
 {
     for (auto i = 0u; i < indices.size(); i++)
     {
-        m_path.emplace_back(indices[i]);
+        m_path.Append(indices[i]);
     }
 }
 
+IndexPath::IndexPath(FlatIndexPath path) :
+    m_path(std::move(path))
+{
+}
+
 #pragma region IIndexPath
 
 int32_t IndexPath::GetSize()
 {
-    return static_cast<int>(m_path.size());
+    return m_path.GetSize();
 }
 
 int32_t IndexPath::GetAt(int index)
 {
-    return m_path.at(index);
-}
-
-int32_t IndexPath::CompareTo(winrt::IndexPath const& rhs)
-{
-    auto rhsPath = winrt::get_self<IndexPath>(rhs);
-    int compareResult = 0;
-    int lhsCount = static_cast<int>(m_path.size());
-    int rhsCount = static_cast<int>(rhsPath->m_path.size());
-
-    if (lhsCount == 0 || rhsCount == 0)
+    if (index < 0 || index >= m_path.GetSize())
     {
-        // one of the paths are empty, compare based on size
-        compareResult = (lhsCount - rhsCount);
+        throw winrt::hresult_out_of_bounds();
     }
-    else
-    {
-        // both paths are non-empty, but can be of different size
-        for (int i = 0; i < std::min(lhsCount, rhsCount); i++)
-        {
-            if (m_path[i] < rhsPath->m_path[i])
-            {
-                compareResult = -1;
-                break;
-            }
-            else if (m_path[i] > rhsPath->m_path[i])
-            {
-                compareResult = 1;
-                break;
-            }
-        }
 
-        // if both match upto min(lhsCount, rhsCount), compare based on size
-        compareResult = compareResult == 0 ? (lhsCount - rhsCount) : compareResult;
-    }
-
-    if (compareResult != 0)
-    {
-        compareResult = compareResult > 0 ? 1 : -1;
-    }
+    return m_path.GetAt(index);
+}
 
-    return compareResult;
+int32_t IndexPath::CompareTo(winrt::IndexPath const& rhs)
+{
+    return m_path.CompareTo(GetPath(rhs));
 }
 
 #pragma endregion
@@ -108,25 +81,3 @@ hstring IndexPath::ToString()
 }
 
 #pragma endregion
-
-bool IndexPath::IsValid() const
-{
-    bool isValid = true;
-    for (int i = 0; i < static_cast<int>(m_path.size()); i++)
-    {
-        if (m_path[i] < 0)
-        {
-            isValid = false;
-            break;
-        }
-    }
-
-    return isValid;
-}
-
-winrt::IndexPath IndexPath::CloneWithChildIndex(int childIndex) const
-{
-    auto newPath = std::vector<int>(m_path);
-    newPath.emplace_back(childIndex);
-    return winrt::make<IndexPath>(newPath);
-}
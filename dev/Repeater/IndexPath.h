@@ -4,6 +4,7 @@
 #pragma once
 
 #include "IndexPath.g.h"
+#include "FlatIndexPath.h"
 
 class IndexPath : public winrt::implementation::IndexPathT<IndexPath>
 {
@@ -12,6 +13,7 @@ public:
     IndexPath(int groupIndex, int itemIndex);
     IndexPath(const winrt::IVector<int>& indices);
     IndexPath(const std::vector<int>& indices);
+    IndexPath(FlatIndexPath path);
 
     template <typename ... Args>
     static winrt::IndexPath CreateFrom(Args&& ... args)
@@ -35,9 +37,14 @@ public:
     hstring ToString();
 #pragma endregion
 
-    bool IsValid() const;
-    winrt::IndexPath CloneWithChildIndex(int childIndex) const;
+    const FlatIndexPath& Path() const { return m_path; }
+
+    // The internal path of an IndexPath passed in through the API.
+    static const FlatIndexPath& GetPath(winrt::IndexPath const& indexPath)
+    {
+        return winrt::get_self<IndexPath>(indexPath)->m_path;
+    }
 
 private:
-    std::vector<int> m_path;
+    FlatIndexPath m_path;
 };
\ No newline at end of file
@@ -0,0 +1,237 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "IndexRangeSet.h"
+
+bool IndexRangeSet::Contains(int index) const
+{
+    auto it = m_ranges.upper_bound(index);
+    if (it == m_ranges.begin())
+    {
+        return false;
+    }
+
+    return (--it)->second >= index;
+}
+
+bool IndexRangeSet::Intersects(const IndexRange& range) const
+{
+    // The last range that begins at or before the end of the
+    // given range is the only candidate that can overlap it.
+    auto it = m_ranges.upper_bound(range.End());
+    if (it == m_ranges.begin())
+    {
+        return false;
+    }
+
+    return (--it)->second >= range.Begin();
+}
+
+int IndexRangeSet::IndexAt(int position) const
+{
+    if (position < 0 || position >= m_count)
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
+    if (!m_cursorIsValid || position < m_cursorPosition)
+    {
+        m_cursor = m_ranges.begin();
+        m_cursorPosition = 0;
+        m_cursorIsValid = true;
+    }
+
+    int rangeCount = m_cursor->second - m_cursor->first + 1;
+    while (position >= m_cursorPosition + rangeCount)
+    {
+        m_cursorPosition += rangeCount;
+        ++m_cursor;
+        rangeCount = m_cursor->second - m_cursor->first + 1;
+    }
+
+    return m_cursor->first + (position - m_cursorPosition);
+}
+
+int IndexRangeSet::Add(const IndexRange& range)
+{
+    InvalidateCursor();
+    int begin = range.Begin();
+    int end = range.End();
+    int coveredCount = 0;
+
+    // Start at the range before the new one if it overlaps or touches it so
+    // that they get merged.
+    auto it = m_ranges.upper_bound(begin);
+    if (it != m_ranges.begin())
+    {
+        auto previous = std::prev(it);
+        if (previous->second >= begin - 1)
+        {
+            it = previous;
+        }
+    }
+
+    while (it != m_ranges.end() && it->first <= end + 1)
+    {
+        coveredCount += std::max(0, std::min(it->second, end) - std::max(it->first, begin) + 1);
+        begin = std::min(begin, it->first);
+        end = std::max(end, it->second);
+        it = m_ranges.erase(it);
+    }
+
+    m_ranges.emplace_hint(it, begin, end);
+
+    const int addedCount = (range.End() - range.Begin() + 1) - coveredCount;
+    m_count += addedCount;
+    return addedCount;
+}
+
+int IndexRangeSet::Remove(const IndexRange& range)
+{
+    InvalidateCursor();
+    const int begin = range.Begin();
+    const int end = range.End();
+    int removedCount = 0;
+
+    auto it = m_ranges.upper_bound(begin);
+    if (it != m_ranges.begin())
+    {
+        auto previous = std::prev(it);
+        if (previous->second >= begin)
+        {
+            it = previous;
+        }
+    }
+
+    while (it != m_ranges.end() && it->first <= end)
+    {
+        const int rangeBegin = it->first;
+        const int rangeEnd = it->second;
+        removedCount += std::min(rangeEnd, end) - std::max(rangeBegin, begin) + 1;
+        it = m_ranges.erase(it);
+
+        // Keep whatever sticks out on either side of the removed range.
+        if (rangeBegin < begin)
+        {
+            m_ranges.emplace_hint(it, rangeBegin, begin - 1);
+        }
+
+        if (rangeEnd > end)
+        {
+            it = m_ranges.emplace_hint(it, end + 1, rangeEnd);
+        }
+    }
+
+    m_count -= removedCount;
+    return removedCount;
+}
+
+void IndexRangeSet::Clear()
+{
+    m_ranges.clear();
+    m_count = 0;
+    InvalidateCursor();
+}
+
+std::vector<IndexRange> IndexRangeSet::Difference(const IndexRangeSet& other) const
+{
+    std::vector<IndexRange> difference;
+
+    // Both sets are ordered, so a single merge-like walk over them is enough.
+    auto otherIt = other.m_ranges.begin();
+    for (const auto& range : m_ranges)
+    {
+        int begin = range.first;
+        const int end = range.second;
+
+        while (otherIt != other.m_ranges.end() && otherIt->second < begin)
+        {
+            ++otherIt;
+        }
+
+        // The last range of the other set that overlaps this range may overlap
+        // the next one too, so walk a copy of the iterator.
+        for (auto it = otherIt; it != other.m_ranges.end() && it->first <= end && begin <= end; ++it)
+        {
+            if (it->first > begin)
+            {
+                difference.emplace_back(begin, it->first - 1);
+            }
+
+            begin = it->second + 1;
+        }
+
+        if (begin <= end)
+        {
+            difference.emplace_back(begin, end);
+        }
+    }
+
+    return difference;
+}
+
+bool IndexRangeSet::OnItemsInserted(int index, int count)
+{
+    InvalidateCursor();
+    bool changed = false;
+
+    // A range that spans the insertion point gets split, the right part
+    // moves along with the ranges after it.
+    auto it = m_ranges.lower_bound(index);
+    if (it != m_ranges.begin())
+    {
+        auto previous = std::prev(it);
+        if (previous->second >= index)
+        {
+            const int end = previous->second;
+            previous->second = index - 1;
+            it = m_ranges.emplace_hint(it, index, end);
+        }
+    }
+
+    if (it != m_ranges.end())
+    {
+        ShiftRanges(index, count);
+        changed = true;
+    }
+
+    return changed;
+}
+
+bool IndexRangeSet::OnItemsRemoved(int index, int count)
+{
+    InvalidateCursor();
+    const bool changed = Remove(IndexRange(index, index + count - 1)) > 0 || m_ranges.lower_bound(index) != m_ranges.end();
+    ShiftRanges(index + count, -count);
+
+    // The ranges on both sides of the removed items may now touch.
+    auto it = m_ranges.find(index);
+    if (it != m_ranges.end() && it != m_ranges.begin())
+    {
+        auto previous = std::prev(it);
+        if (previous->second == index - 1)
+        {
+            previous->second = it->second;
+            m_ranges.erase(it);
+        }
+    }
+
+    return changed;
+}
+
+void IndexRangeSet::ShiftRanges(int fromIndex, int delta)
+{
+    auto first = m_ranges.lower_bound(fromIndex);
+    if (first != m_ranges.end() && delta != 0)
+    {
+        // Keys are immutable, so the shifted tail is rebuilt. The relative order
+        // of the ranges does not change, so every insert is at the end.
+        std::vector<std::pair<int, int>> shifted(first, m_ranges.end());
+        m_ranges.erase(first, m_ranges.end());
+        for (const auto& range : shifted)
+        {
+            m_ranges.emplace_hint(m_ranges.end(), range.first + delta, range.second + delta);
+        }
+    }
+}
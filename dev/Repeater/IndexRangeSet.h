@@ -0,0 +1,71 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+#include "IndexRange.h"
+
+// Ordered set of disjoint, non-adjacent index ranges keyed by their begin index.
+// Lookups are O(log n) and range edits are O(log n + k) where n is the number of
+// ranges and k the number of ranges touched, independent of how many indices the
+// ranges cover. Collection changes shift every range past the change point.
+class IndexRangeSet final
+{
+public:
+    using const_iterator = std::map<int, int>::const_iterator;
+
+    IndexRangeSet() = default;
+    IndexRangeSet(IndexRangeSet&&) = default;
+    IndexRangeSet& operator=(IndexRangeSet&&) = default;
+    // Copies do not share the lookup cursor, it points into the source's map.
+    IndexRangeSet(const IndexRangeSet& other) : m_ranges(other.m_ranges), m_count(other.m_count) {}
+    IndexRangeSet& operator=(const IndexRangeSet& other)
+    {
+        m_ranges = other.m_ranges;
+        m_count = other.m_count;
+        InvalidateCursor();
+        return *this;
+    }
+
+    const_iterator begin() const { return m_ranges.begin(); }
+    const_iterator end() const { return m_ranges.end(); }
+
+    bool Empty() const { return m_ranges.empty(); }
+    int RangeCount() const { return static_cast<int>(m_ranges.size()); }
+    // Total number of indices covered by all the ranges.
+    int Count() const { return m_count; }
+
+    bool Contains(int index) const;
+    bool Intersects(const IndexRange& range) const;
+    // Returns the index at the given position in the flattened, ordered set of indices.
+    // Walks the ranges from the last position that was looked up, so sequential access
+    // is O(1) amortized and no storage proportional to Count() is needed.
+    int IndexAt(int position) const;
+
+    // Returns the number of indices that were not in the set before.
+    int Add(const IndexRange& range);
+    // Returns the number of indices that were in the set before.
+    int Remove(const IndexRange& range);
+    void Clear();
+
+    // Ranges of the indices that are in this set but not in the other one.
+    std::vector<IndexRange> Difference(const IndexRangeSet& other) const;
+
+    // Adjust the ranges for items inserted into or removed from the source.
+    // Returns true if any range was moved, split or trimmed.
+    bool OnItemsInserted(int index, int count);
+    bool OnItemsRemoved(int index, int count);
+
+private:
+    void ShiftRanges(int fromIndex, int delta);
+    void InvalidateCursor() { m_cursorIsValid = false; }
+
+    // begin -> end (inclusive).
+    std::map<int, int> m_ranges;
+    int m_count{ 0 };
+
+    // Range that the last IndexAt lookup landed in and the number
+    // of indices in the ranges before it.
+    mutable const_iterator m_cursor{};
+    mutable int m_cursorPosition{ 0 };
+    mutable bool m_cursorIsValid{ false };
+};
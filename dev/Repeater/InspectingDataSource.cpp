@@ -18,6 +18,7 @@ InspectingDataSource::InspectingDataSource(const winrt::IInspectable& source)
     if (vector)
     {
         m_vector.set(vector);
+        m_isGetManySupported = true;
         ListenToCollectionChanges();
     }
     else
@@ -36,6 +37,8 @@ InspectingDataSource::InspectingDataSource(const winrt::IInspectable& source)
             if (iterable)
             {
                 m_vector.set(WrapIterable(iterable));
+                m_canCacheItems = true;
+                m_isGetManySupported = true;
             }
             else
             {
@@ -43,6 +46,8 @@ InspectingDataSource::InspectingDataSource(const winrt::IInspectable& source)
                 if (bindableIterable)
                 {
                     m_vector.set(WrapIterable(reinterpret_cast<const winrt::IIterable<winrt::IInspectable> &>(bindableIterable)));
+                    m_canCacheItems = true;
+                    m_isGetManySupported = true;
                 }
                 else
                 {
@@ -69,6 +74,20 @@ int32_t InspectingDataSource::GetSizeCore()
 
 winrt::IInspectable InspectingDataSource::GetAtCore(int index)
 {
+    if (m_canCacheItems && m_isGetManySupported)
+    {
+        if (index < m_prefetchedStart || index >= m_prefetchedStart + m_prefetchedCount)
+        {
+            PrefetchItems(index);
+        }
+
+        if (index >= m_prefetchedStart && index < m_prefetchedStart + m_prefetchedCount)
+        {
+            return m_prefetchedItems[index - m_prefetchedStart].get();
+        }
+    }
+
+    // Out of range indices end up here too so that the source reports the error.
     return m_vector.get().GetAt(static_cast<unsigned>(index));
 }
 
@@ -93,6 +112,17 @@ int InspectingDataSource::IndexFromKeyCore(winrt::hstring const& id)
 {
     if (m_uniqueIdMaping)
     {
+        if (EnsureKeyIndexLookup())
+        {
+            auto it = m_keyIndexLookup.find(id);
+            if (it != m_keyIndexLookup.end())
+            {
+                return it->second;
+            }
+        }
+
+        // Not in the lookup, let the mapping decide. This also covers
+        // keys that only compare equal under the mapping's own rules.
         return m_uniqueIdMaping.IndexFromKey(id);
     }
     else
@@ -108,6 +138,17 @@ int InspectingDataSource::IndexOf(winrt::IInspectable const& value)
     int index = -1;
     if (m_vector && value)
     {
+        if (EnsureItemIndexLookup())
+        {
+            auto it = m_itemIndexLookup.find(GetIdentity(value));
+            if (it != m_itemIndexLookup.end())
+            {
+                return it->second;
+            }
+        }
+
+        // Items that are equal without being the same object are only found
+        // by the collection's own IndexOf.
         uint32_t v = static_cast<uint32_t>(-1);
         if (m_vector.get().IndexOf(value, v))
         {
@@ -156,6 +197,7 @@ void InspectingDataSource::ListenToCollectionChanges()
     {
         m_eventToken = incc.CollectionChanged({ this, &InspectingDataSource::OnCollectionChanged });
         m_notifyCollectionChanged.set(incc);
+        m_canCacheItems = true;
     }
     else
     {
@@ -164,6 +206,7 @@ void InspectingDataSource::ListenToCollectionChanges()
         {
             m_eventToken = observableVector.VectorChanged({ this, &InspectingDataSource::OnVectorChanged });
             m_observableVector.set(observableVector);
+            m_canCacheItems = true;
         }
         else
         {
@@ -173,6 +216,7 @@ void InspectingDataSource::ListenToCollectionChanges()
                 m_eventToken = reinterpret_cast<const winrt::IObservableVector<winrt::IInspectable>&>(bindableObservableVector)
                     .VectorChanged({ this, &InspectingDataSource::OnVectorChanged });
                 m_bindableObservableVector.set(bindableObservableVector);
+                m_canCacheItems = true;
             }
         }
     }
@@ -182,6 +226,9 @@ void InspectingDataSource::OnCollectionChanged(
     const winrt::IInspectable& /*sender*/,
     const winrt::NotifyCollectionChangedEventArgs& e)
 {
+    auto const newItems = e.NewItems();
+    InvalidatePrefetchedItems();
+    UpdateIndexLookups(e.Action(), e.NewStartingIndex(), newItems ? static_cast<int>(newItems.Size()) : 0);
     OnDataSourceChanged(e);
 }
 
@@ -230,6 +277,8 @@ void InspectingDataSource::OnVectorChanged(
         break;
     }
 
+    InvalidatePrefetchedItems();
+    UpdateIndexLookups(action, newStartingIndex, static_cast<int>(newItems.Size()));
     OnDataSourceChanged(
         winrt::NotifyCollectionChangedEventArgs(
             action,
@@ -237,4 +286,196 @@ void InspectingDataSource::OnVectorChanged(
             oldItems,
             newStartingIndex,
             oldStartingIndex));
-}
\ No newline at end of file
+}
+
+void InspectingDataSource::UpdateIndexLookups(winrt::NotifyCollectionChangedAction action, int newStartingIndex, int newItemsCount)
+{
+    const auto newSize = static_cast<int>(m_vector.get().Size());
+    const bool isAppend =
+        action == winrt::NotifyCollectionChangedAction::Add &&
+        newItemsCount > 0 &&
+        newStartingIndex + newItemsCount == newSize;
+
+    if (isAppend && m_itemIndexLookupCount == newStartingIndex)
+    {
+        AddToItemIndexLookup(newStartingIndex, newSize);
+    }
+    else
+    {
+        m_itemIndexLookup.clear();
+        m_itemIndexLookupCount = -1;
+        m_isItemIndexLookupSupported = true;
+    }
+
+    if (isAppend && m_keyIndexLookupCount == newStartingIndex)
+    {
+        AddToKeyIndexLookup(newStartingIndex, newSize);
+    }
+    else
+    {
+        m_keyIndexLookup.clear();
+        m_keyIndexLookupCount = -1;
+    }
+}
+
+bool InspectingDataSource::EnsureItemIndexLookup()
+{
+    if (!m_canCacheItems || !m_isItemIndexLookupSupported)
+    {
+        return false;
+    }
+
+    if (m_itemIndexLookupCount == -1)
+    {
+        const auto size = static_cast<int>(m_vector.get().Size());
+        if (size < c_minSizeForIndexLookups)
+        {
+            return false;
+        }
+
+        m_itemIndexLookup.reserve(size);
+        m_itemIndexLookupCount = 0;
+        AddToItemIndexLookup(0, size);
+    }
+
+    return m_isItemIndexLookupSupported;
+}
+
+bool InspectingDataSource::EnsureKeyIndexLookup()
+{
+    if (!m_canCacheItems)
+    {
+        return false;
+    }
+
+    if (m_keyIndexLookupCount == -1)
+    {
+        const auto size = static_cast<int>(m_vector.get().Size());
+        if (size < c_minSizeForIndexLookups)
+        {
+            return false;
+        }
+
+        m_keyIndexLookup.reserve(size);
+        m_keyIndexLookupCount = 0;
+        AddToKeyIndexLookup(0, size);
+    }
+
+    return true;
+}
+
+void InspectingDataSource::AddToItemIndexLookup(int begin, int end)
+{
+    MUX_ASSERT(m_itemIndexLookupCount == begin);
+    std::vector<winrt::IInspectable> items(std::min(c_prefetchBlockSize, end - begin));
+    for (int blockStart = begin; blockStart < end && m_isItemIndexLookupSupported;)
+    {
+        const auto blockSize = std::min(static_cast<int>(items.size()), end - blockStart);
+        const auto fetched = static_cast<int>(FetchItems(blockStart, { items.data(), static_cast<uint32_t>(blockSize) }));
+        if (fetched == 0)
+        {
+            break;
+        }
+
+        for (int i = 0; i < fetched && m_isItemIndexLookupSupported; ++i)
+        {
+            if (auto const& item = items[i])
+            {
+                if (item.try_as<winrt::IPropertyValue>())
+                {
+                    m_itemIndexLookup.clear();
+                    m_isItemIndexLookupSupported = false;
+                }
+                else
+                {
+                    // Keep the first index for items that are in the collection more than once.
+                    m_itemIndexLookup.emplace(GetIdentity(item), blockStart + i);
+                }
+            }
+        }
+
+        std::fill_n(items.begin(), fetched, nullptr);
+        blockStart += fetched;
+    }
+    m_itemIndexLookupCount = end;
+}
+
+void InspectingDataSource::AddToKeyIndexLookup(int begin, int end)
+{
+    MUX_ASSERT(m_keyIndexLookupCount == begin);
+    for (int i = begin; i < end; ++i)
+    {
+        m_keyIndexLookup.emplace(m_uniqueIdMaping.KeyFromIndex(i), i);
+    }
+    m_keyIndexLookupCount = end;
+}
+
+void* InspectingDataSource::GetIdentity(winrt::IInspectable const& value)
+{
+    return winrt::get_abi(value.as<winrt::Windows::Foundation::IUnknown>());
+}
+
+uint32_t InspectingDataSource::FetchItems(int startIndex, winrt::array_view<winrt::IInspectable> items)
+{
+    auto const vector = m_vector.get();
+    if (m_isGetManySupported)
+    {
+        return vector.GetMany(static_cast<uint32_t>(startIndex), items);
+    }
+
+    const auto size = static_cast<int>(vector.Size());
+    const auto count = static_cast<uint32_t>(std::max(0, std::min(static_cast<int>(items.size()), size - startIndex)));
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        items[i] = vector.GetAt(static_cast<uint32_t>(startIndex) + i);
+    }
+    return count;
+}
+
+void InspectingDataSource::PrefetchItems(int index)
+{
+    const int size = Count();
+    if (index < 0 || index >= size)
+    {
+        return;
+    }
+
+    // Read ahead in the direction we are moving. Walking backwards past the start
+    // of the current window fetches the block that ends at the requested index.
+    int start = index;
+    if (m_prefetchedCount > 0 && index < m_prefetchedStart)
+    {
+        start = std::max(0, index - c_prefetchBlockSize + 1);
+    }
+    const int count = std::min(c_prefetchBlockSize, size - start);
+
+    std::vector<winrt::IInspectable> items(count);
+    const auto fetched = static_cast<int>(FetchItems(start, { items.data(), static_cast<uint32_t>(count) }));
+
+    if (m_prefetchedItems.empty())
+    {
+        m_prefetchedItems.reserve(c_prefetchBlockSize);
+        for (int i = 0; i < c_prefetchBlockSize; ++i)
+        {
+            m_prefetchedItems.emplace_back(this);
+        }
+    }
+
+    // Reuse the tracker handles, only the values change.
+    for (int i = 0; i < c_prefetchBlockSize; ++i)
+    {
+        m_prefetchedItems[i].set(i < fetched ? items[i] : nullptr);
+    }
+    m_prefetchedStart = start;
+    m_prefetchedCount = fetched;
+}
+
+void InspectingDataSource::InvalidatePrefetchedItems()
+{
+    for (int i = 0; i < m_prefetchedCount; ++i)
+    {
+        m_prefetchedItems[i].set(nullptr);
+    }
+    m_prefetchedStart = 0;
+    m_prefetchedCount = 0;
+}
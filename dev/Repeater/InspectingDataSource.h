@@ -40,6 +40,22 @@ private:
         const winrt::Collections::IObservableVector<winrt::IInspectable>& sender,
         const winrt::Collections::IVectorChangedEventArgs& e);
 
+    // Item to index and key to index lookups. These are built lazily on the first
+    // lookup and kept up to date from the collection change notifications. Appends
+    // extend them in place, any other change drops them until they are needed again.
+    void UpdateIndexLookups(winrt::NotifyCollectionChangedAction action, int newStartingIndex, int newItemsCount);
+    bool EnsureItemIndexLookup();
+    bool EnsureKeyIndexLookup();
+    void AddToItemIndexLookup(int begin, int end);
+    void AddToKeyIndexLookup(int begin, int end);
+    static void* GetIdentity(winrt::IInspectable const& value);
+
+    // Reads a block of items starting at startIndex with as few calls into the source as
+    // possible. Returns the number of items read.
+    uint32_t FetchItems(int startIndex, winrt::array_view<winrt::IInspectable> items);
+    void PrefetchItems(int index);
+    void InvalidatePrefetchedItems();
+
     tracker_ref<winrt::Collections::IVector<winrt::IInspectable>> m_vector{ this };
 
     // To unhook event from data source
@@ -48,4 +64,37 @@ private:
     tracker_ref<winrt::IBindableObservableVector> m_bindableObservableVector{ this };
     winrt::event_token m_eventToken{ };
     winrt::IKeyIndexMapping m_uniqueIdMaping{ nullptr };
+
+    struct KeyHash
+    {
+        size_t operator()(winrt::hstring const& key) const { return std::hash<std::wstring_view>{}(key); }
+    };
+
+    // Items and lookups are only cached for sources that tell us when they change (or
+    // that we copied ourselves), otherwise an entry could go stale without us knowing.
+    bool m_canCacheItems{ false };
+    // The bindable interfaces we reinterpret as IVector<IInspectable> have no GetMany.
+    bool m_isGetManySupported{ false };
+
+    // A window of items read with a single GetMany around the last requested index. For
+    // sources on the other side of the ABI (e.g. a C# ObservableCollection) this saves one
+    // call per realized item while scrolling.
+    std::vector<tracker_ref<winrt::IInspectable>> m_prefetchedItems;
+    int m_prefetchedStart{ 0 };
+    int m_prefetchedCount{ 0 };
+    static constexpr int c_prefetchBlockSize = 64;
+
+    // Keyed on the identity (IUnknown) pointer of the item. The items are kept alive by
+    // the collection and the lookup is dropped whenever anything is removed from it.
+    std::unordered_map<void*, int> m_itemIndexLookup;
+    int m_itemIndexLookupCount{ -1 };
+    // Boxed values get a new identity every time they are read from the collection
+    // so they cannot be looked up by identity.
+    bool m_isItemIndexLookupSupported{ true };
+
+    std::unordered_map<winrt::hstring, int, KeyHash> m_keyIndexLookup;
+    int m_keyIndexLookupCount{ -1 };
+
+    // Below this size a linear search is as cheap as maintaining the lookups.
+    static constexpr int c_minSizeForIndexLookups = 32;
 };
\ No newline at end of file
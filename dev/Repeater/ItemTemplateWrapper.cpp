@@ -24,6 +24,7 @@ winrt::DataTemplate ItemTemplateWrapper::Template()
 void ItemTemplateWrapper::Template(winrt::DataTemplate const& value)
 {
     m_dataTemplate = value;
+    m_cachedRecyclePool = nullptr;
 }
 
 winrt::DataTemplateSelector ItemTemplateWrapper::TemplateSelector()
@@ -40,6 +41,19 @@ void ItemTemplateWrapper::TemplateSelector(winrt::DataTemplateSelector const& va
 
 winrt::UIElement ItemTemplateWrapper::GetElement(winrt::ElementFactoryGetArgs const& args)
 {
+    if (m_dataTemplate)
+    {
+        EnsureCachedRecyclePool();
+        winrt::UIElement element = TryGetElementFromCachedPool(args.Parent());
+        if (!element)
+        {
+            element = m_dataTemplate.LoadContent().as<winrt::FrameworkElement>();
+            element.SetValue(RecyclePool::GetOriginTemplateProperty(), m_dataTemplate);
+        }
+
+        return element;
+    }
+
     auto selectedTemplate = m_dataTemplate ? m_dataTemplate : m_dataTemplateSelector.SelectTemplate(args.Data());
     auto recyclePool = winrt::RecyclePool::GetPoolInstance(selectedTemplate);
     winrt::UIElement element = nullptr;
@@ -65,18 +79,76 @@ winrt::UIElement ItemTemplateWrapper::GetElement(winrt::ElementFactoryGetArgs co
 void ItemTemplateWrapper::RecycleElement(winrt::ElementFactoryRecycleArgs const& args)
 {
     auto element = args.Element();
-    winrt::DataTemplate selectedTemplate = m_dataTemplate? 
-        m_dataTemplate:
-        element.GetValue(RecyclePool::GetOriginTemplateProperty()).as<winrt::DataTemplate>();
-    auto recyclePool = CachedVisualTreeHelpers::GetPoolInstance(selectedTemplate);
+    if (m_dataTemplate)
+    {
+        EnsureCachedRecyclePool();
+        if (m_isCachedRecyclePoolBuiltIn)
+        {
+            winrt::get_self<RecyclePool>(m_cachedRecyclePool)->PutElementCore(element, m_reuseKey, args.Parent());
+        }
+        else
+        {
+            m_cachedRecyclePool.PutElement(element, L"" /* key */, args.Parent());
+        }
+        return;
+    }
+
+    winrt::DataTemplate selectedTemplate = element.GetValue(RecyclePool::GetOriginTemplateProperty()).as<winrt::DataTemplate>();
+    auto recyclePool = EnsureRecyclePool(selectedTemplate);
+    recyclePool.PutElement(args.Element(), L"" /* key */, args.Parent());
+}
+
+#pragma endregion
+
+bool ItemTemplateWrapper::PrewarmElement(int countPerKey)
+{
+    // With a selector we cannot know up front which templates will be used.
+    if (!m_dataTemplate)
+    {
+        return false;
+    }
+
+    EnsureCachedRecyclePool();
+    auto pool = winrt::get_self<RecyclePool>(m_cachedRecyclePool);
+    if (pool->ShouldPrewarm(m_reuseKey, countPerKey))
+    {
+        auto element = m_dataTemplate.LoadContent().as<winrt::FrameworkElement>();
+        element.SetValue(RecyclePool::GetOriginTemplateProperty(), m_dataTemplate);
+        pool->PutElementCore(element, m_reuseKey, nullptr /* owner */);
+        return true;
+    }
+
+    return false;
+}
+
+winrt::RecyclePool ItemTemplateWrapper::EnsureRecyclePool(winrt::DataTemplate const& dataTemplate)
+{
+    auto recyclePool = CachedVisualTreeHelpers::GetPoolInstance(dataTemplate);
     if (!recyclePool)
     {
         // No Recycle pool in the template, create one.
         recyclePool = winrt::make<RecyclePool>();
-        CachedVisualTreeHelpers::SetPoolInstance(selectedTemplate, recyclePool);
+        CachedVisualTreeHelpers::SetPoolInstance(dataTemplate, recyclePool);
     }
 
-    recyclePool.PutElement(args.Element(), L"" /* key */, args.Parent());
+    return recyclePool;
 }
 
-#pragma endregion
\ No newline at end of file
+void ItemTemplateWrapper::EnsureCachedRecyclePool()
+{
+    if (!m_cachedRecyclePool)
+    {
+        m_cachedRecyclePool = EnsureRecyclePool(m_dataTemplate);
+        m_isCachedRecyclePoolBuiltIn = !winrt::get_self<RecyclePool>(m_cachedRecyclePool)->IsComposed();
+    }
+}
+
+winrt::UIElement ItemTemplateWrapper::TryGetElementFromCachedPool(winrt::UIElement const& owner)
+{
+    if (m_isCachedRecyclePoolBuiltIn)
+    {
+        return winrt::get_self<RecyclePool>(m_cachedRecyclePool)->TryGetElementCore(m_reuseKey, owner);
+    }
+
+    return safe_cast<winrt::FrameworkElement>(m_cachedRecyclePool.TryGetElement(L"" /* key */, owner));
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "common.h"
+#include "RecyclePool.h"
 
 class ItemTemplateWrapper :
     public winrt::implements<ItemTemplateWrapper, winrt::IElementFactoryShim>
@@ -23,7 +24,24 @@ public:
     void RecycleElement(winrt::ElementFactoryRecycleArgs const& args);
 #pragma endregion
 
+    // Creates one element into the template's recycle pool if it holds fewer than
+    // countPerKey elements. Returns false when there is nothing left to create.
+    bool PrewarmElement(int countPerKey);
+
 private:
+    static winrt::RecyclePool EnsureRecyclePool(winrt::DataTemplate const& dataTemplate);
+
+    // Single template fast path: the template's pool is resolved once instead of on
+    // every realization.
+    void EnsureCachedRecyclePool();
+    winrt::UIElement TryGetElementFromCachedPool(winrt::UIElement const& owner);
+
     winrt::DataTemplate m_dataTemplate{ nullptr };
     winrt::DataTemplateSelector m_dataTemplateSelector{ nullptr };
+
+    winrt::RecyclePool m_cachedRecyclePool{ nullptr };
+    // True when m_cachedRecyclePool is our own RecyclePool rather than
+    // an app provided one that may override TryGetElementCore.
+    bool m_isCachedRecyclePoolBuiltIn{};
+    const RecyclePool::ReuseKeyHandle m_reuseKey{ L"" };
 };
\ No newline at end of file
@@ -9,6 +9,15 @@
 #undef min
 #undef max
 
+// Rough heap footprint of a node based hash map: one node per entry plus the bucket array.
+// Only used to report the memory the repeater's bookkeeping structures hold on to.
+template <typename Map>
+size_t EstimateHashMapBytes(const Map& map)
+{
+    return map.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void*)) +
+        map.bucket_count() * sizeof(void*);
+}
+
 // We cache these factories for perf reasons
 class CachedVisualTreeHelpers : 
     public winrt::implements<CachedVisualTreeHelpers, winrt::IInspectable>
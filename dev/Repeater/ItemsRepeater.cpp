@@ -10,9 +10,18 @@
 #include "ChildrenInTabFocusOrderIterable.h"
 #include "SharedHelpers.h"
 #include "RepeaterAutomationPeer.h"
+#include "SampledPerfTrace.h"
 #include "ViewportManagerWithPlatformFeatures.h"
 #include "ViewportManagerDownlevel.h"
 #include "RuntimeProfiler.h"
+#include "Vector.h"
+#include "layout.h"
+#include "StackLayout.h"
+#include "StackLayoutState.h"
+#include "FlowLayoutState.h"
+#include "UniformGridLayoutState.h"
+#include "ItemsRepeaterLayoutSnapshot.h"
+#include <unordered_map>
 
 #ifndef BUILD_WINDOWS
 #include "ItemTemplateWrapper.h"
@@ -24,6 +33,7 @@ winrt::Rect ItemsRepeater::InvalidRect = { -1.f, -1.f, -1.f, -1.f };
 ItemsRepeater::ItemsRepeater()
 {
     __RP_Marker_ClassById(RuntimeProfiler::ProfId_ItemsRepeater);
+    __RP_Marker_ClassInstanceCreated(RuntimeProfiler::ProfId_ItemsRepeater);
 
     if (SharedHelpers::IsRS5OrHigher())
     {
@@ -52,6 +62,8 @@ ItemsRepeater::ItemsRepeater()
 
 ItemsRepeater::~ItemsRepeater()
 {
+    __RP_Marker_ClassInstanceDestroyed(RuntimeProfiler::ProfId_ItemsRepeater);
+
     if (m_layout)
     {
         if (m_measureInvalidated)
@@ -97,6 +109,9 @@ void ItemsRepeater::OnBringIntoViewRequested(winrt::BringIntoViewRequestedEventA
 
 winrt::Size ItemsRepeater::MeasureOverride(winrt::Size const& availableSize)
 {
+    __RP_Marker_ClassMemberById(RuntimeProfiler::ProfId_ItemsRepeater, RuntimeProfiler::ProfMemberId_ItemsRepeater_MeasureOverride);
+    SAMPLED_PERF_TRACE_SCOPE("ItemsRepeater.Measure");
+
     if (m_isLayoutInProgress)
     {
         throw winrt::hresult_error(E_FAIL, L"Reentrancy detected during layout.");
@@ -107,8 +122,13 @@ winrt::Size ItemsRepeater::MeasureOverride(winrt::Size const& availableSize)
         throw winrt::hresult_error(E_FAIL, L"Cannot run layout in the middle of a collection change.");
     }
 
+    // Apply the collection changes that were queued since the last measure
+    // before anything looks at the realized elements.
+    ProcessPendingDataSourceChanges();
+
     m_viewportManager->OnOwnerMeasuring();
 
+    QPCTimer measureTimer;
     m_isLayoutInProgress = true;
     auto layoutInProgress = gsl::finally([this]()
     {
@@ -121,34 +141,72 @@ winrt::Size ItemsRepeater::MeasureOverride(winrt::Size const& availableSize)
 
     if (m_layout)
     {
-        desiredSize = m_layout.Measure(GetLayoutContext(), availableSize);
+        auto layoutContext = GetLayoutContext();
+        auto repeaterLayoutContext = static_cast<RepeaterLayoutContext*>(winrt::get_self<VirtualizingLayoutContext>(layoutContext));
+        repeaterLayoutContext->BeginLayoutPass();
+        auto endLayoutPass = gsl::finally([repeaterLayoutContext]()
+        {
+            repeaterLayoutContext->EndLayoutPass();
+        });
+
+        ApplyRestoredLayoutSnapshot();
+        auto clearRestoredAnchor = gsl::finally([this]()
+        {
+            m_restoredAnchorIndex = -1;
+        });
+
+        desiredSize = m_layout.Measure(layoutContext, availableSize);
         extent = winrt::Rect{ m_layoutOrigin.X, m_layoutOrigin.Y, desiredSize.Width, desiredSize.Height };
 
         // Clear auto recycle candidate elements that have not been kept alive by layout - i.e layout did not
-        // call GetElementAt(index).
-        auto children = Children();
-        for (unsigned i = 0u; i < children.Size(); ++i)
+        // call GetElementAt(index). Layouts that always suppress auto recycling (all of the built-in ones)
+        // never create candidates, so the walk over the children is skipped for them.
+        if (m_viewManager.HasAutoRecycleCandidates())
         {
-            auto element = children.GetAt(i);
-            auto virtInfo = GetVirtualizationInfo(element);
-
-            if (virtInfo->Owner() == ElementOwner::Layout &&
-                virtInfo->AutoRecycleCandidate() &&
-                !virtInfo->KeepAlive())
+            bool hasRemainingCandidates = false;
+            auto children = Children();
+            for (unsigned i = 0u; i < children.Size(); ++i)
             {
-                REPEATER_TRACE_INFO(L"AutoClear - %d \n", virtInfo->Index());
-                ClearElementImpl(element);
+                auto element = children.GetAt(i);
+                auto virtInfo = GetVirtualizationInfo(element);
+
+                if (virtInfo->Owner() == ElementOwner::Layout &&
+                    virtInfo->AutoRecycleCandidate())
+                {
+                    if (virtInfo->KeepAlive())
+                    {
+                        hasRemainingCandidates = true;
+                    }
+                    else
+                    {
+                        REPEATER_TRACE_ELEMENT("AutoCleared", LayoutIdForTracing().data(), virtInfo->Index());
+                        ClearElementImpl(element);
+                    }
+                }
             }
+
+            m_viewManager.HasAutoRecycleCandidates(hasRemainingCandidates);
         }
     }
 
     m_viewportManager->SetLayoutExtent(extent);
     m_lastAvailableSize = availableSize;
+
+    ++m_perfCounters.measureCount;
+    m_perfCounters.measureTimeInMicroseconds += measureTimer.DurationInMicroSeconds();
+    REPEATER_TRACE_PERF_COUNTERS(
+        this,
+        LayoutIdForTracing().data(),
+        m_perfCounters,
+        PhasingBacklog());
+
     return desiredSize;
 }
 
 winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
 {
+    SAMPLED_PERF_TRACE_SCOPE("ItemsRepeater.Arrange");
+
     if (m_isLayoutInProgress)
     {
         throw winrt::hresult_error(E_FAIL, L"Reentrancy detected during layout.");
@@ -169,7 +227,15 @@ winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
 
     if (m_layout)
     {
-        arrangeSize = m_layout.Arrange(GetLayoutContext(), finalSize);
+        auto layoutContext = GetLayoutContext();
+        auto repeaterLayoutContext = static_cast<RepeaterLayoutContext*>(winrt::get_self<VirtualizingLayoutContext>(layoutContext));
+        repeaterLayoutContext->BeginLayoutPass();
+        auto endLayoutPass = gsl::finally([repeaterLayoutContext]()
+        {
+            repeaterLayoutContext->EndLayoutPass();
+        });
+
+        arrangeSize = m_layout.Arrange(layoutContext, finalSize);
     }
 
     // The view manager might clear elements during this call.
@@ -177,6 +243,8 @@ winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
     // off screen.
     m_viewManager.OnOwnerArranged();
 
+    const bool hasAnimator = m_animationManager.HasAnimator();
+    const bool hasStickyHeaders = ::StickyHeaderManager::IsInUse();
     auto children = Children();
     for (unsigned i = 0u; i < children.Size(); ++i)
     {
@@ -184,7 +252,15 @@ winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
         auto virtInfo = GetVirtualizationInfo(element);
         virtInfo->KeepAlive(false);
 
-        if (virtInfo->Owner() == ElementOwner::ElementFactory ||
+        if (hasStickyHeaders &&
+            virtInfo->Owner() == ElementOwner::PinnedPool &&
+            m_stickyHeaderManager.IsCurrentHeader(element))
+        {
+            // The current sticky header is kept where it was, its group may still be in view.
+            element.Arrange(virtInfo->ArrangeBounds());
+            m_stickyHeaderManager.OnHeaderArranged(element, virtInfo->ArrangeBounds());
+        }
+        else if (virtInfo->Owner() == ElementOwner::ElementFactory ||
             virtInfo->Owner() == ElementOwner::PinnedPool)
         {
             // Toss it away. And arrange it with size 0 so that XYFocus won't use it.
@@ -198,18 +274,26 @@ winrt::Size ItemsRepeater::ArrangeOverride(winrt::Size const& finalSize)
         {
             const auto newBounds = CachedVisualTreeHelpers::GetLayoutSlot(element.as<winrt::FrameworkElement>());
 
-            if (virtInfo->ArrangeBounds() != ItemsRepeater::InvalidRect &&
+            if (hasAnimator &&
+                virtInfo->ArrangeBounds() != ItemsRepeater::InvalidRect &&
                 newBounds != virtInfo->ArrangeBounds())
             {
                 m_animationManager.OnElementBoundsChanged(element, virtInfo->ArrangeBounds(), newBounds);
             }
 
             virtInfo->ArrangeBounds(newBounds);
+
+            if (hasStickyHeaders && GetIsStickyHeader(element))
+            {
+                m_stickyHeaderManager.OnHeaderArranged(element, newBounds);
+            }
         }
     }
 
     m_viewportManager->OnOwnerArranged();
     m_animationManager.OnOwnerArranged();
+    m_stickyHeaderManager.OnOwnerArranged();
+    ++m_perfCounters.arrangeCount;
 
     return arrangeSize;
 }
@@ -263,6 +347,61 @@ void ItemsRepeater::Animator(winrt::ElementAnimator const& value)
     SetValue(s_animatorProperty, value);
 }
 
+int ItemsRepeater::PrewarmElementCount()
+{
+    return auto_unbox(GetValue(s_prewarmElementCountProperty));
+}
+
+void ItemsRepeater::PrewarmElementCount(int value)
+{
+    SetValue(s_prewarmElementCountProperty, box_value(value));
+}
+
+bool ItemsRepeater::IsCollectionChangeCoalescingEnabled()
+{
+    return m_isCollectionChangeCoalescingEnabled;
+}
+
+void ItemsRepeater::IsCollectionChangeCoalescingEnabled(bool value)
+{
+    SetValue(s_isCollectionChangeCoalescingEnabledProperty, box_value(value));
+}
+
+double ItemsRepeater::PhasingBudget()
+{
+    return m_phasingBudget;
+}
+
+void ItemsRepeater::PhasingBudget(double value)
+{
+    if (value < 0.0 || std::isnan(value))
+    {
+        throw winrt::hresult_invalid_argument(L"PhasingBudget must be a non-negative number.");
+    }
+
+    SetValue(s_phasingBudgetProperty, box_value(value));
+}
+
+winrt::hstring ItemsRepeater::LayoutIdForTracing()
+{
+    if (m_layout)
+    {
+        return m_layout.as<::Layout>()->LayoutId();
+    }
+
+    return winrt::hstring{};
+}
+
+bool ItemsRepeater::IsDirectionalCacheEnabled()
+{
+    return m_viewportManager->IsDirectionalCacheEnabled();
+}
+
+void ItemsRepeater::IsDirectionalCacheEnabled(bool value)
+{
+    SetValue(s_isDirectionalCacheEnabledProperty, box_value(value));
+}
+
 double ItemsRepeater::HorizontalCacheLength()
 {
     return m_viewportManager->HorizontalCacheLength();
@@ -295,11 +434,13 @@ void ItemsRepeater::Background(winrt::Brush const& value)
 
 int32_t ItemsRepeater::GetElementIndex(winrt::UIElement const& element)
 {
+    ProcessPendingDataSourceChanges();
     return GetElementIndexImpl(element);
 }
 
 winrt::UIElement ItemsRepeater::TryGetElement(int index)
 {
+    ProcessPendingDataSourceChanges();
     return GetElementFromIndexImpl(index);
 }
 
@@ -315,9 +456,105 @@ void ItemsRepeater::UnpinElement(winrt::UIElement const& element)
 
 winrt::UIElement ItemsRepeater::GetOrCreateElement(int index)
 {
+    ProcessPendingDataSourceChanges();
     return GetOrCreateElementImpl(index);
 }
 
+winrt::ItemsRepeaterLayoutSnapshot ItemsRepeater::SaveLayoutState()
+{
+    auto snapshot = winrt::make_self<ItemsRepeaterLayoutSnapshot>();
+
+    // The first item that is visible is what the restored layout starts from.
+    const auto visibleWindow = VisibleWindow();
+    int anchorIndex = -1;
+    auto children = Children();
+    for (unsigned i = 0u; i < children.Size(); ++i)
+    {
+        auto virtInfo = TryGetVirtualizationInfo(children.GetAt(i));
+        if (virtInfo &&
+            virtInfo->IsHeldByLayout() &&
+            virtInfo->ArrangeBounds() != ItemsRepeater::InvalidRect &&
+            SharedHelpers::DoRectsIntersect(virtInfo->ArrangeBounds(), visibleWindow))
+        {
+            const int index = virtInfo->Index();
+            anchorIndex = anchorIndex == -1 ? index : std::min(anchorIndex, index);
+        }
+    }
+    snapshot->AnchorIndex(anchorIndex);
+
+    // Copy the estimates into a detached state so that the snapshot does not hold on
+    // to realized elements and keeps its values if this layout goes on measuring.
+    if (auto layoutState = m_layoutState.get())
+    {
+        if (auto stackState = layoutState.try_as<winrt::StackLayoutState>())
+        {
+            auto estimates = winrt::make_self<StackLayoutState>();
+            estimates->CopyEstimatesFrom(*winrt::get_self<StackLayoutState>(stackState));
+            snapshot->LayoutEstimates(*estimates);
+        }
+        else if (auto flowState = layoutState.try_as<winrt::FlowLayoutState>())
+        {
+            auto estimates = winrt::make_self<FlowLayoutState>();
+            estimates->CopyEstimatesFrom(*winrt::get_self<FlowLayoutState>(flowState));
+            snapshot->LayoutEstimates(*estimates);
+        }
+    }
+
+    return *snapshot;
+}
+
+void ItemsRepeater::RestoreLayoutState(winrt::ItemsRepeaterLayoutSnapshot const& snapshot)
+{
+    if (!snapshot)
+    {
+        throw winrt::hresult_invalid_argument(L"Argument 'snapshot' is null.");
+    }
+
+    // Applied by the next measure, the layout state may not exist yet.
+    m_restoredLayoutSnapshot.set(snapshot);
+    InvalidateMeasure();
+}
+
+void ItemsRepeater::ScrollToIndex(int index, double alignmentRatio)
+{
+    auto const itemsSourceView = ItemsSourceView();
+    if (!itemsSourceView || index < 0 || index >= itemsSourceView.Count())
+    {
+        throw winrt::hresult_invalid_argument(L"Argument 'index' is out of range.");
+    }
+
+    if (!(alignmentRatio >= 0.0 && alignmentRatio <= 1.0))
+    {
+        throw winrt::hresult_invalid_argument(L"Argument 'alignmentRatio' must be between 0 and 1.");
+    }
+
+    winrt::BringIntoViewOptions options;
+    options.AnimationDesired(false);
+    options.HorizontalAlignmentRatio(alignmentRatio);
+    options.VerticalAlignmentRatio(alignmentRatio);
+
+    if (auto element = TryGetElement(index))
+    {
+        element.StartBringIntoView(options);
+        return;
+    }
+
+    auto const stackLayout = m_layout.try_as<winrt::StackLayout>();
+    if (stackLayout && m_layoutState)
+    {
+        // Scroll to where the layout expects the item and have the next measure start from
+        // it, instead of realizing the item first and correcting the extent around it.
+        options.TargetRect(winrt::get_self<StackLayout>(stackLayout)->GetEstimatedItemBounds(index, GetLayoutContext()));
+        m_restoredAnchorIndex = index;
+        InvalidateMeasure();
+        StartBringIntoView(options);
+    }
+    else
+    {
+        GetOrCreateElement(index).StartBringIntoView(options);
+    }
+}
+
 winrt::event_token ItemsRepeater::ElementPrepared(winrt::TypedEventHandler<winrt::ItemsRepeater, winrt::ItemsRepeaterElementPreparedEventArgs> const& value)
 {
     return m_elementPreparedEventSource.add(value);
@@ -369,6 +606,7 @@ void ItemsRepeater::ClearElementImpl(const winrt::UIElement& element)
 
     m_viewManager.ClearElement(element, isClearedDueToCollectionChange);
     m_viewportManager->OnElementCleared(element);
+    m_stickyHeaderManager.OnElementCleared(element);
 }
 
 int ItemsRepeater::GetElementIndexImpl(const winrt::UIElement& element)
@@ -427,11 +665,130 @@ winrt::UIElement ItemsRepeater::GetOrCreateElementImpl(int index)
     return element;
 }
 
+namespace
+{
+    // Element -> VirtualizationInfo side table so that the per child lookups done in
+    // measure, arrange, focus and automation don't have to go through GetValue.
+    // Elements are thread affine, so each UI thread gets its own table.
+    thread_local std::unordered_map<void*, VirtualizationInfo*> s_virtualizationInfos;
+
+    // Stored in the element's VirtualizationInfo property. Nothing else holds on to it,
+    // so it goes away with the element and takes the side table entry along before the
+    // element's address can be reused. The VirtualizationInfo itself may outlive both.
+    class VirtualizationInfoHolder : public winrt::implements<VirtualizationInfoHolder, winrt::IInspectable>
+    {
+    public:
+        VirtualizationInfoHolder(void* elementKey, const winrt::com_ptr<VirtualizationInfo>& virtInfo)
+            : m_elementKey(elementKey)
+            , m_virtInfo(virtInfo)
+        {
+            s_virtualizationInfos[m_elementKey] = m_virtInfo.get();
+        }
+
+        ~VirtualizationInfoHolder()
+        {
+            s_virtualizationInfos.erase(m_elementKey);
+        }
+
+    private:
+        void* m_elementKey;
+        winrt::com_ptr<VirtualizationInfo> m_virtInfo;
+    };
+}
+
+void ItemsRepeater::ApplyRestoredLayoutSnapshot()
+{
+    auto snapshot = m_restoredLayoutSnapshot.get();
+    if (!snapshot)
+    {
+        return;
+    }
+
+    m_restoredLayoutSnapshot.set(nullptr);
+    auto const snapshotImpl = winrt::get_self<ItemsRepeaterLayoutSnapshot>(snapshot);
+
+    const int anchorIndex = snapshotImpl->AnchorIndex();
+    auto const itemsSourceView = ItemsSourceView();
+    m_restoredAnchorIndex = itemsSourceView && anchorIndex < itemsSourceView.Count() ? anchorIndex : -1;
+
+    // Estimates only carry over to a layout that keeps the same kind of state.
+    auto const estimates = snapshotImpl->LayoutEstimates();
+    auto const layoutState = m_layoutState.get();
+    if (estimates && layoutState)
+    {
+        if (auto stackState = layoutState.try_as<winrt::StackLayoutState>())
+        {
+            if (auto savedState = estimates.try_as<winrt::StackLayoutState>())
+            {
+                winrt::get_self<StackLayoutState>(stackState)->CopyEstimatesFrom(*winrt::get_self<StackLayoutState>(savedState));
+            }
+        }
+        else if (auto flowState = layoutState.try_as<winrt::FlowLayoutState>())
+        {
+            if (auto savedState = estimates.try_as<winrt::FlowLayoutState>())
+            {
+                winrt::get_self<FlowLayoutState>(flowState)->CopyEstimatesFrom(*winrt::get_self<FlowLayoutState>(savedState));
+            }
+        }
+    }
+}
+
+winrt::ItemsRepeater ItemsRepeater::FindOuterRepeater() const
+{
+    auto parent = CachedVisualTreeHelpers::GetParent(*this);
+    while (parent)
+    {
+        if (auto repeater = parent.try_as<winrt::ItemsRepeater>())
+        {
+            return repeater;
+        }
+        parent = CachedVisualTreeHelpers::GetParent(parent);
+    }
+
+    return nullptr;
+}
+
+void ItemsRepeater::SaveNestedLayoutState(const winrt::IInspectable& itemsSource, const winrt::ItemsRepeaterLayoutSnapshot& snapshot)
+{
+    TakeNestedLayoutState(itemsSource);
+
+    if (m_nestedLayoutStates.size() >= MaxNestedLayoutStates)
+    {
+        m_nestedLayoutStates.erase(m_nestedLayoutStates.begin());
+    }
+
+    m_nestedLayoutStates.emplace_back(this, itemsSource, snapshot);
+}
+
+winrt::ItemsRepeaterLayoutSnapshot ItemsRepeater::TakeNestedLayoutState(const winrt::IInspectable& itemsSource)
+{
+    winrt::ItemsRepeaterLayoutSnapshot snapshot = nullptr;
+    auto const it = std::find_if(
+        m_nestedLayoutStates.begin(),
+        m_nestedLayoutStates.end(),
+        [&itemsSource](const NestedLayoutState& state) { return state.ItemsSource.get() == itemsSource; });
+    if (it != m_nestedLayoutStates.end())
+    {
+        snapshot = it->Snapshot.get();
+        m_nestedLayoutStates.erase(it);
+    }
+
+    return snapshot;
+}
+
 /*static*/
 winrt::com_ptr<VirtualizationInfo> ItemsRepeater::TryGetVirtualizationInfo(const winrt::UIElement& element)
 {
-    auto value = element.GetValue(GetVirtualizationInfoProperty());
-    return winrt::get_self<VirtualizationInfo>(value)->get_strong();
+    winrt::com_ptr<VirtualizationInfo> result;
+    if (element)
+    {
+        const auto it = s_virtualizationInfos.find(winrt::get_abi(element));
+        if (it != s_virtualizationInfos.end())
+        {
+            result.copy_from(it->second);
+        }
+    }
+    return result;
 }
 
 /*static*/
@@ -447,12 +804,48 @@ winrt::com_ptr<VirtualizationInfo> ItemsRepeater::GetVirtualizationInfo(const wi
     return result;
 }
 
+int64_t ItemsRepeater::EstimatedBookkeepingBytes()
+{
+    size_t bytes = m_viewManager.EstimatedBytes();
+
+    // Every child carries a VirtualizationInfo, the holder in its attached property
+    // and an entry in the side table.
+    constexpr size_t perChildBytes = sizeof(VirtualizationInfoHolder) +
+        sizeof(decltype(s_virtualizationInfos)::value_type) + 2 * sizeof(void*);
+    auto children = Children();
+    for (unsigned i = 0u; i < children.Size(); ++i)
+    {
+        if (auto virtInfo = TryGetVirtualizationInfo(children.GetAt(i)))
+        {
+            bytes += virtInfo->EstimatedBytes() + perChildBytes;
+        }
+    }
+
+    if (auto layoutState = m_layoutState.get())
+    {
+        if (auto stackState = layoutState.try_as<winrt::StackLayoutState>())
+        {
+            bytes += winrt::get_self<StackLayoutState>(stackState)->FlowAlgorithm().EstimatedBytes();
+        }
+        else if (auto flowState = layoutState.try_as<winrt::FlowLayoutState>())
+        {
+            bytes += winrt::get_self<FlowLayoutState>(flowState)->FlowAlgorithm().EstimatedBytes();
+        }
+        else if (auto gridState = layoutState.try_as<winrt::UniformGridLayoutState>())
+        {
+            bytes += winrt::get_self<UniformGridLayoutState>(gridState)->FlowAlgorithm().EstimatedBytes();
+        }
+    }
+
+    return static_cast<int64_t>(bytes);
+}
+
 /* static */
 winrt::com_ptr<VirtualizationInfo> ItemsRepeater::CreateAndInitializeVirtualizationInfo(const winrt::UIElement& element)
 {
     MUX_ASSERT(!TryGetVirtualizationInfo(element));
     auto result = winrt::make_self<VirtualizationInfo>();
-    element.SetValue(GetVirtualizationInfoProperty(), result.as<winrt::IInspectable>());
+    element.SetValue(GetVirtualizationInfoProperty(), winrt::make<VirtualizationInfoHolder>(winrt::get_abi(element), result));
     return result;
 }
 
@@ -469,7 +862,26 @@ void ItemsRepeater::OnPropertyChanged(const winrt::DependencyPropertyChangedEven
             newDataSource = winrt::ItemsSourceView(newValue);
         }
 
+        auto const outerRepeater = FindOuterRepeater();
+        auto const oldValue = args.OldValue();
+        if (outerRepeater && oldValue && m_layoutState)
+        {
+            auto snapshot = SaveLayoutState();
+            // Where the group comes back into view has nothing to do with where it left,
+            // only the size estimates are worth keeping.
+            winrt::get_self<ItemsRepeaterLayoutSnapshot>(snapshot)->AnchorIndex(-1);
+            winrt::get_self<ItemsRepeater>(outerRepeater)->SaveNestedLayoutState(oldValue, snapshot);
+        }
+
         OnDataSourcePropertyChanged(m_dataSource.get(), newDataSource);
+
+        if (outerRepeater && newValue)
+        {
+            if (auto snapshot = winrt::get_self<ItemsRepeater>(outerRepeater)->TakeNestedLayoutState(newValue))
+            {
+                RestoreLayoutState(snapshot);
+            }
+        }
     }
     else if (property == s_itemTemplateProperty)
     {
@@ -483,6 +895,26 @@ void ItemsRepeater::OnPropertyChanged(const winrt::DependencyPropertyChangedEven
     {
         OnAnimatorChanged(safe_cast<winrt::ElementAnimator>(args.OldValue()), safe_cast<winrt::ElementAnimator>(args.NewValue()));
     }
+    else if (property == s_prewarmElementCountProperty)
+    {
+        m_viewManager.SchedulePrewarm();
+    }
+    else if (property == s_isCollectionChangeCoalescingEnabledProperty)
+    {
+        m_isCollectionChangeCoalescingEnabled = unbox_value<bool>(args.NewValue());
+        if (!m_isCollectionChangeCoalescingEnabled)
+        {
+            ProcessPendingDataSourceChanges();
+        }
+    }
+    else if (property == s_phasingBudgetProperty)
+    {
+        m_phasingBudget = unbox_value<double>(args.NewValue());
+    }
+    else if (property == s_isDirectionalCacheEnabledProperty)
+    {
+        m_viewportManager->IsDirectionalCacheEnabled(unbox_value<bool>(args.NewValue()));
+    }
     else if (property == s_horizontalCacheLengthProperty)
     {
         m_viewportManager->HorizontalCacheLength(unbox_value<double>(args.NewValue()));
@@ -555,6 +987,8 @@ void ItemsRepeater::OnLoaded(const winrt::IInspectable& /*sender*/, const winrt:
         m_viewportManager->ResetScrollers();
     }
     ++_loadedCounter;
+
+    m_viewManager.OnOwnerLoaded();
 }
 
 void ItemsRepeater::OnUnloaded(const winrt::IInspectable& /*sender*/, const winrt::RoutedEventArgs& /*args*/)
@@ -564,6 +998,8 @@ void ItemsRepeater::OnUnloaded(const winrt::IInspectable& /*sender*/, const winr
     if (_unloadedCounter == _loadedCounter)
     {
         m_viewportManager->ResetScrollers();
+        m_stickyHeaderManager.ResetScrollSource();
+        m_viewManager.OnOwnerUnloaded();
     }
 }
 
@@ -574,6 +1010,8 @@ void ItemsRepeater::OnDataSourcePropertyChanged(const winrt::ItemsSourceView& ol
         throw winrt::hresult_error(E_FAIL, L"Cannot set ItemsSourceView during layout.");
     }
 
+    // Queued changes describe the old data source, the reset below covers them.
+    m_pendingDataSourceChanges.clear();
     m_dataSource.set(newValue);
 
     if (oldValue)
@@ -631,6 +1069,8 @@ void ItemsRepeater::OnItemTemplateChanged(const winrt::IElementFactory&  oldValu
         }
     }
 #endif
+
+    m_viewManager.SchedulePrewarm();
 }
 
 void ItemsRepeater::OnLayoutChanged(const winrt::VirtualizingLayout& oldValue, const winrt::VirtualizingLayout& newValue)
@@ -640,6 +1080,9 @@ void ItemsRepeater::OnLayoutChanged(const winrt::VirtualizingLayout& oldValue, c
         throw winrt::hresult_error(E_FAIL, L"Layout cannot be changed during layout.");
     }
 
+    // The old layout needs to see the queued changes before it lets go of its elements.
+    ProcessPendingDataSourceChanges();
+
     m_viewManager.OnLayoutChanging();
     m_animationManager.OnLayoutChanging();
 
@@ -695,6 +1138,143 @@ void ItemsRepeater::OnDataSourceChanged(const winrt::IInspectable& sender, const
         throw winrt::hresult_error(E_FAIL, L"Changes in the data source are not allowed during another change in the data source.");
     }
 
+    if (m_isCollectionChangeCoalescingEnabled)
+    {
+        if (!m_pendingDataSourceChanges.empty())
+        {
+            if (auto merged = TryMergeDataSourceChanges(m_pendingDataSourceChanges.back().get(), args))
+            {
+                m_pendingDataSourceChanges.back() = tracker_ref<winrt::NotifyCollectionChangedEventArgs>(this, merged);
+                return;
+            }
+        }
+
+        m_pendingDataSourceChanges.emplace_back(tracker_ref<winrt::NotifyCollectionChangedEventArgs>(this, args));
+        InvalidateMeasure();
+        return;
+    }
+
+    ProcessDataSourceChange(sender, args);
+}
+
+void ItemsRepeater::ProcessPendingDataSourceChanges()
+{
+    if (m_pendingDataSourceChanges.empty())
+    {
+        return;
+    }
+
+    auto pendingChanges = std::move(m_pendingDataSourceChanges);
+    m_pendingDataSourceChanges.clear();
+
+    // A reset anywhere in the batch means the data has to be re-read anyway,
+    // so a single reset covers every change in the batch.
+    const bool hasReset = std::any_of(pendingChanges.begin(), pendingChanges.end(), [](const auto& change)
+    {
+        return change.get().Action() == winrt::NotifyCollectionChangedAction::Reset;
+    });
+
+    const auto source = m_dataSource.get();
+    if (hasReset)
+    {
+        ProcessDataSourceChange(source, winrt::NotifyCollectionChangedEventArgs(
+            winrt::NotifyCollectionChangedAction::Reset,
+            nullptr /* newItems */,
+            nullptr /* oldItems */,
+            -1 /* newIndex */,
+            -1 /* oldIndex */));
+    }
+    else
+    {
+        for (const auto& change : pendingChanges)
+        {
+            ProcessDataSourceChange(source, change.get());
+        }
+    }
+}
+
+/* static */
+winrt::NotifyCollectionChangedEventArgs ItemsRepeater::TryMergeDataSourceChanges(
+    const winrt::NotifyCollectionChangedEventArgs& first,
+    const winrt::NotifyCollectionChangedEventArgs& second)
+{
+    const auto action = first.Action();
+    if (action != second.Action())
+    {
+        return nullptr;
+    }
+
+    // Returns the items of 'outer' with the items of 'inner' inserted at 'position'.
+    auto combineItems = [](const winrt::IBindableVector& outer, const winrt::IBindableVector& inner, int position)
+    {
+        auto items = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Bindable>()>>();
+        const int outerCount = static_cast<int>(outer.Size());
+        for (int i = 0; i <= outerCount; ++i)
+        {
+            if (i == position)
+            {
+                for (unsigned j = 0u; j < inner.Size(); ++j)
+                {
+                    items.Append(inner.GetAt(j));
+                }
+            }
+
+            if (i < outerCount)
+            {
+                items.Append(outer.GetAt(i));
+            }
+        }
+        return items.as<winrt::IBindableVector>();
+    };
+
+    if (action == winrt::NotifyCollectionChangedAction::Add)
+    {
+        // The second insert lands inside (or at either end of) the range inserted by the first one.
+        const int firstStart = first.NewStartingIndex();
+        const int firstCount = static_cast<int>(first.NewItems().Size());
+        const int secondStart = second.NewStartingIndex();
+        if (secondStart >= firstStart && secondStart <= firstStart + firstCount)
+        {
+            return winrt::NotifyCollectionChangedEventArgs(
+                action,
+                combineItems(first.NewItems(), second.NewItems(), secondStart - firstStart),
+                nullptr /* oldItems */,
+                firstStart,
+                -1 /* oldIndex */);
+        }
+    }
+    else if (action == winrt::NotifyCollectionChangedAction::Remove)
+    {
+        const int firstStart = first.OldStartingIndex();
+        const int secondStart = second.OldStartingIndex();
+        const int secondCount = static_cast<int>(second.OldItems().Size());
+        if (secondStart == firstStart)
+        {
+            // Removing forward from the same index.
+            return winrt::NotifyCollectionChangedEventArgs(
+                action,
+                nullptr /* newItems */,
+                combineItems(first.OldItems(), second.OldItems(), static_cast<int>(first.OldItems().Size())),
+                -1 /* newIndex */,
+                firstStart);
+        }
+        else if (secondStart + secondCount == firstStart)
+        {
+            // Removing backward, right before the previously removed range.
+            return winrt::NotifyCollectionChangedEventArgs(
+                action,
+                nullptr /* newItems */,
+                combineItems(first.OldItems(), second.OldItems(), 0),
+                -1 /* newIndex */,
+                secondStart);
+        }
+    }
+
+    return nullptr;
+}
+
+void ItemsRepeater::ProcessDataSourceChange(const winrt::IInspectable& sender, const winrt::NotifyCollectionChangedEventArgs& args)
+{
     m_processingDataSourceChange.set(args);
     auto processingChange = gsl::finally([this]()
     {
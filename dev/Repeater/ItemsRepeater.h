@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AnimationManager.h"
+#include "StickyHeaderManager.h"
 #include "ViewManager.h"
 #include "VirtualizationInfo.h"
 #include "ItemsRepeaterElementPreparedEventArgs.h"
@@ -66,6 +67,21 @@ public:
     winrt::ElementAnimator Animator();
     void Animator(winrt::ElementAnimator const& value);
 
+    int PrewarmElementCount();
+    void PrewarmElementCount(int value);
+
+    bool IsCollectionChangeCoalescingEnabled();
+    void IsCollectionChangeCoalescingEnabled(bool value);
+
+    // Time in milliseconds since the start of the frame that phasing of this repeater
+    // may run to. Zero (the default) uses the adaptive budget of BuildTreeScheduler.
+    double PhasingBudget();
+    void PhasingBudget(double value);
+
+    // Biases the cache buffer toward the scroll direction while scrolling.
+    bool IsDirectionalCacheEnabled();
+    void IsDirectionalCacheEnabled(bool value);
+
     double HorizontalCacheLength();
     void HorizontalCacheLength(double value);
 
@@ -80,6 +96,15 @@ public:
     winrt::UIElement TryGetElement(int index);
     winrt::UIElement GetOrCreateElement(int index);
 
+    // Layout state for back navigation.
+    winrt::ItemsRepeaterLayoutSnapshot SaveLayoutState();
+    void RestoreLayoutState(winrt::ItemsRepeaterLayoutSnapshot const& snapshot);
+
+    // Brings the item into view, alignmentRatio gives where in the viewport it ends up (0 for the
+    // start, 1 for the end). With a StackLayout the target is computed from the layout's size
+    // estimates and only the items around it get realized.
+    void ScrollToIndex(int index, double alignmentRatio);
+
     // Element events
     winrt::event_token ElementPrepared(winrt::TypedEventHandler<winrt::ItemsRepeater, winrt::ItemsRepeaterElementPreparedEventArgs> const& value);
     void ElementPrepared(winrt::event_token const& token);
@@ -119,6 +144,8 @@ public:
     winrt::Rect VisibleWindow() const { return m_viewportManager->GetLayoutVisibleWindow(); }
     winrt::Rect RealizationWindow() const { return m_viewportManager->GetLayoutRealizationWindow(); }
     winrt::UIElement SuggestedAnchor() const { return m_viewportManager->SuggestedAnchor(); }
+    // Anchor to start from during the first measure after RestoreLayoutState or ScrollToIndex, or -1.
+    int RestoredAnchorIndex() const { return m_restoredAnchorIndex; }
     winrt::UIElement MadeAnchor() const { return m_viewportManager->MadeAnchor(); }
     winrt::Point LayoutOrigin() const { return m_layoutOrigin; }
     void LayoutOrigin(winrt::Point value) { m_layoutOrigin = value; }
@@ -132,6 +159,15 @@ public:
     void OnElementPrepared(const winrt::UIElement& element, int index);
     void OnElementClearing(const winrt::UIElement& element);
     void OnElementIndexChanged(const winrt::UIElement& element, int oldIndex, int newIndex);
+    bool HasElementIndexChangedHandlers() { return static_cast<bool>(m_elementIndexChangedEventSource); }
+
+    RepeaterPerfCounters& PerfCounters() { return m_perfCounters; }
+    // Only meant to tag trace events, it is empty when there is no layout.
+    winrt::hstring LayoutIdForTracing();
+    int PhasingBacklog() const { return m_viewManager.PhasingBacklog(); }
+    // Memory the repeater and its layout state hold on behalf of the current children,
+    // not counting the elements themselves. See RepeaterTestHooks::GetRepeaterEstimatedBookkeepingBytes.
+    int64_t EstimatedBookkeepingBytes();
 
     static winrt::DependencyProperty GetVirtualizationInfoProperty()
     {
@@ -142,18 +178,31 @@ public:
     static winrt::DependencyProperty ItemTemplateProperty() { return s_itemTemplateProperty; }
     static winrt::DependencyProperty LayoutProperty() { return s_layoutProperty; }
     static winrt::DependencyProperty AnimatorProperty() { return s_animatorProperty; }
+    static winrt::DependencyProperty PrewarmElementCountProperty() { return s_prewarmElementCountProperty; }
+    static winrt::DependencyProperty IsCollectionChangeCoalescingEnabledProperty() { return s_isCollectionChangeCoalescingEnabledProperty; }
+    static winrt::DependencyProperty PhasingBudgetProperty() { return s_phasingBudgetProperty; }
+    static winrt::DependencyProperty IsDirectionalCacheEnabledProperty() { return s_isDirectionalCacheEnabledProperty; }
 
     static winrt::DependencyProperty HorizontalCacheLengthProperty() { return s_horizontalCacheLengthProperty; }
     static winrt::DependencyProperty VerticalCacheLengthProperty() { return s_verticalCacheLengthProperty; }
 
     static winrt::DependencyProperty BackgroundProperty() { return winrt::Panel::BackgroundProperty(); }
 
+    static winrt::DependencyProperty IsStickyHeaderProperty() { return s_isStickyHeaderProperty; }
+    static bool GetIsStickyHeader(winrt::UIElement const& element);
+    static void SetIsStickyHeader(winrt::UIElement const& element, bool value);
+
     static GlobalDependencyProperty s_itemsSourceProperty;
     static GlobalDependencyProperty s_itemTemplateProperty;
     static GlobalDependencyProperty s_layoutProperty;
     static GlobalDependencyProperty s_animatorProperty;
+    static GlobalDependencyProperty s_prewarmElementCountProperty;
+    static GlobalDependencyProperty s_isCollectionChangeCoalescingEnabledProperty;
+    static GlobalDependencyProperty s_phasingBudgetProperty;
+    static GlobalDependencyProperty s_isDirectionalCacheEnabledProperty;
     static GlobalDependencyProperty s_horizontalCacheLengthProperty;
     static GlobalDependencyProperty s_verticalCacheLengthProperty;
+    static GlobalDependencyProperty s_isStickyHeaderProperty;
 
     static void EnsureProperties();
     static void ClearProperties();
@@ -162,6 +211,9 @@ private:
     static void ItemsRepeater::OnPropertyChanged(
         const winrt::DependencyObject& sender,
         const winrt::DependencyPropertyChangedEventArgs& args);
+    static void OnIsStickyHeaderPropertyChanged(
+        const winrt::DependencyObject& sender,
+        const winrt::DependencyPropertyChangedEventArgs& args);
 
     static GlobalDependencyProperty s_VirtualizationInfoProperty;
 
@@ -172,8 +224,21 @@ private:
     void OnItemTemplateChanged(const winrt::IElementFactory& oldValue, const winrt::IElementFactory& newValue);
     void OnLayoutChanged(const winrt::VirtualizingLayout& oldValue, const winrt::VirtualizingLayout& newValue);
     void OnAnimatorChanged(const winrt::ElementAnimator& oldValue, const winrt::ElementAnimator& newValue);
+    void ApplyRestoredLayoutSnapshot();
+
+    // Nested repeaters, e.g. the items of a group in a grouped list, park the layout state
+    // of the items source they were showing on the closest repeater above them when their
+    // container gets recycled for another group, and pick it up again when they show it again.
+    winrt::ItemsRepeater FindOuterRepeater() const;
+    void SaveNestedLayoutState(const winrt::IInspectable& itemsSource, const winrt::ItemsRepeaterLayoutSnapshot& snapshot);
+    winrt::ItemsRepeaterLayoutSnapshot TakeNestedLayoutState(const winrt::IInspectable& itemsSource);
 
     void OnDataSourceChanged(const winrt::IInspectable& sender, const winrt::NotifyCollectionChangedEventArgs& args);
+    void ProcessDataSourceChange(const winrt::IInspectable& sender, const winrt::NotifyCollectionChangedEventArgs& args);
+    void ProcessPendingDataSourceChanges();
+    static winrt::NotifyCollectionChangedEventArgs TryMergeDataSourceChanges(
+        const winrt::NotifyCollectionChangedEventArgs& first,
+        const winrt::NotifyCollectionChangedEventArgs& second);
     void InvalidateMeasureForLayout(winrt::Layout const& sender, winrt::IInspectable const& args);
     void InvalidateArrangeForLayout(winrt::Layout const& sender, winrt::IInspectable const& args);
 
@@ -183,6 +248,7 @@ private:
     winrt::IIterable<winrt::DependencyObject> CreateChildrenInTabFocusOrderIterable();
 
     ::AnimationManager m_animationManager{ this };
+    ::StickyHeaderManager m_stickyHeaderManager{ this };
     ::ViewManager m_viewManager{ this };
     std::shared_ptr<::ViewportManager> m_viewportManager{ nullptr };
 
@@ -198,8 +264,32 @@ private:
 
     tracker_ref<winrt::VirtualizingLayoutContext> m_layoutContext{ this };
     tracker_ref<winrt::IInspectable> m_layoutState{ this };
+    // Set by RestoreLayoutState and ScrollToIndex, applied by the next measure.
+    tracker_ref<winrt::ItemsRepeaterLayoutSnapshot> m_restoredLayoutSnapshot{ this };
+    int m_restoredAnchorIndex{ -1 };
+
+    struct NestedLayoutState
+    {
+        NestedLayoutState(const ITrackerHandleManager* owner, const winrt::IInspectable& itemsSource, const winrt::ItemsRepeaterLayoutSnapshot& snapshot) :
+            ItemsSource(owner, itemsSource), Snapshot(owner, snapshot) {}
+
+        tracker_ref<winrt::IInspectable> ItemsSource;
+        tracker_ref<winrt::ItemsRepeaterLayoutSnapshot> Snapshot;
+    };
+
+    // Oldest first.
+    std::vector<NestedLayoutState> m_nestedLayoutStates;
+    static constexpr size_t MaxNestedLayoutStates = 64;
     // Value is different from null only while we are on the OnDataSourceChanged call stack.
     tracker_ref<winrt::NotifyCollectionChangedEventArgs> m_processingDataSourceChange{ this };
+    // Collection changes waiting for the next measure when IsCollectionChangeCoalescingEnabled is true.
+    // Adjacent changes are merged as they are queued.
+    std::vector<tracker_ref<winrt::NotifyCollectionChangedEventArgs>> m_pendingDataSourceChanges;
+    bool m_isCollectionChangeCoalescingEnabled{ false };
+    // Cached value of PhasingBudget, read by the phaser on every element it processes.
+    double m_phasingBudget{ 0.0 };
+
+    RepeaterPerfCounters m_perfCounters{};
 
     winrt::Size m_lastAvailableSize{};
     bool m_isLayoutInProgress{ false };
@@ -0,0 +1,27 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ItemsRepeaterLayoutSnapshot.g.h"
+
+// What ItemsRepeater.SaveLayoutState captures: the first item that was visible and a
+// copy of what the layout learned about item sizes, held in a detached instance of
+// the layout's state type (StackLayoutState or FlowLayoutState).
+class ItemsRepeaterLayoutSnapshot :
+    public ReferenceTracker<ItemsRepeaterLayoutSnapshot, winrt::implementation::ItemsRepeaterLayoutSnapshotT, winrt::composable, winrt::composing>
+{
+public:
+#pragma region IItemsRepeaterLayoutSnapshot
+    int32_t AnchorIndex() { return m_anchorIndex; }
+#pragma endregion
+
+    void AnchorIndex(int value) { m_anchorIndex = value; }
+
+    winrt::IInspectable LayoutEstimates() const { return m_layoutEstimates.get(); }
+    void LayoutEstimates(const winrt::IInspectable& value) { m_layoutEstimates.set(value); }
+
+private:
+    int m_anchorIndex{ -1 };
+    tracker_ref<winrt::IInspectable> m_layoutEstimates{ this };
+};
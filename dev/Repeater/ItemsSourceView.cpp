@@ -57,7 +57,41 @@ void ItemsSourceView::CollectionChanged(winrt::event_token const& token)
 
 void ItemsSourceView::OnDataSourceChanged(winrt::NotifyCollectionChangedEventArgs const& args)
 {
-    m_cachedSize = GetSizeCore();
+    // The cached size is authoritative between notifications. Keep it up to date from
+    // the change itself instead of asking the source again, which for most sources
+    // means a call across the ABI. Only a reset needs a fresh read.
+    if (m_cachedSize != -1)
+    {
+        auto const itemsCount = [](const winrt::IBindableVector& items) { return items ? static_cast<int>(items.Size()) : -1; };
+        const int newCount = itemsCount(args.NewItems());
+        const int oldCount = itemsCount(args.OldItems());
+
+        switch (args.Action())
+        {
+        case winrt::NotifyCollectionChangedAction::Add:
+            m_cachedSize = newCount >= 0 ? m_cachedSize + newCount : -1;
+            break;
+        case winrt::NotifyCollectionChangedAction::Remove:
+            m_cachedSize = oldCount >= 0 ? m_cachedSize - oldCount : -1;
+            break;
+        case winrt::NotifyCollectionChangedAction::Replace:
+            m_cachedSize = newCount >= 0 && oldCount >= 0 ? m_cachedSize + newCount - oldCount : -1;
+            break;
+        case winrt::NotifyCollectionChangedAction::Move:
+            break;
+        default:
+            m_cachedSize = -1;
+            break;
+        }
+
+        if (m_cachedSize == -1)
+        {
+            m_cachedSize = GetSizeCore();
+        }
+
+        MUX_ASSERT(m_cachedSize == GetSizeCore());
+    }
+
     m_collectionChangedEventSource(*this, args);
 }
 
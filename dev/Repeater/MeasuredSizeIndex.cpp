@@ -0,0 +1,244 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include "MeasuredSizeIndex.h"
+
+bool MeasuredSizeIndex::IsMeasured(int index) const
+{
+    return index >= 0 && index < Count() && m_sizes[index] >= 0;
+}
+
+void MeasuredSizeIndex::SetSize(int index, double size)
+{
+    MUX_ASSERT(index >= 0);
+    MUX_ASSERT(size >= 0);
+
+    EnsureCount(index + 1);
+    const double oldSize = m_sizes[index];
+    if (oldSize != size)
+    {
+        const bool wasMeasured = oldSize >= 0;
+        AddToTree(index, size - (wasMeasured ? oldSize : 0.0), wasMeasured ? 0 : 1);
+        m_sizes[index] = size;
+    }
+}
+
+void MeasuredSizeIndex::SetSizes(int startIndex, const std::vector<double>& sizes)
+{
+    MUX_ASSERT(startIndex >= 0);
+
+    if (!sizes.empty())
+    {
+        const int endIndex = startIndex + static_cast<int>(sizes.size());
+        if (startIndex == Count() || sizes.size() > 1u)
+        {
+            // One rebuild is cheaper than updating the trees for every item of a large range.
+            m_sizes.resize(std::max(Count(), endIndex), -1.0);
+            std::copy(sizes.begin(), sizes.end(), m_sizes.begin() + startIndex);
+            Rebuild();
+        }
+        else
+        {
+            SetSize(startIndex, sizes[0]);
+        }
+    }
+}
+
+int MeasuredSizeIndex::MeasuredCount() const
+{
+    int measuredCount = 0;
+    for (int i = Count(); i > 0; i -= i & -i)
+    {
+        measuredCount += m_countTree[i];
+    }
+    return measuredCount;
+}
+
+double MeasuredSizeIndex::MeasuredTotal() const
+{
+    double measuredSize = 0.0;
+    for (int i = Count(); i > 0; i -= i & -i)
+    {
+        measuredSize += m_sizeTree[i];
+    }
+    return measuredSize;
+}
+
+int MeasuredSizeIndex::NextUnmeasured(int index, int endIndex) const
+{
+    while (index < endIndex && IsMeasured(index))
+    {
+        ++index;
+    }
+    return index;
+}
+
+int MeasuredSizeIndex::NextMeasured(int index, int endIndex) const
+{
+    while (index < endIndex && !IsMeasured(index))
+    {
+        ++index;
+    }
+    return index;
+}
+
+void MeasuredSizeIndex::Insert(int index, int count)
+{
+    // Nothing to shift if the items are added past the ones we know about.
+    if (index < Count() && count > 0)
+    {
+        m_sizes.insert(m_sizes.begin() + index, count, -1.0);
+        Rebuild();
+    }
+}
+
+void MeasuredSizeIndex::Remove(int index, int count)
+{
+    if (index < Count() && count > 0)
+    {
+        const int endIndex = std::min(Count(), index + count);
+        m_sizes.erase(m_sizes.begin() + index, m_sizes.begin() + endIndex);
+        if (endIndex == static_cast<int>(m_sizeTree.size()) - 1)
+        {
+            // Nodes only cover items before them, so dropping the tail keeps the rest valid.
+            m_sizeTree.resize(index + 1);
+            m_countTree.resize(index + 1);
+        }
+        else
+        {
+            Rebuild();
+        }
+    }
+}
+
+void MeasuredSizeIndex::Clear()
+{
+    m_sizes.clear();
+    Rebuild();
+}
+
+double MeasuredSizeIndex::OffsetFromIndex(int index, double estimatedSize, double spacing) const
+{
+    const int count = Count();
+    const int knownIndex = std::max(0, std::min(index, count));
+
+    double measuredSize = 0.0;
+    int measuredCount = 0;
+    for (int i = knownIndex; i > 0; i -= i & -i)
+    {
+        measuredSize += m_sizeTree[i];
+        measuredCount += m_countTree[i];
+    }
+
+    // Anything past the items we know about is estimated.
+    return measuredSize +
+        (knownIndex - measuredCount) * estimatedSize +
+        knownIndex * spacing +
+        std::max(0, index - knownIndex) * (estimatedSize + spacing);
+}
+
+int MeasuredSizeIndex::IndexFromOffset(double offset, double estimatedSize, double spacing) const
+{
+    if (offset <= 0)
+    {
+        return 0;
+    }
+
+    // Walk down the tree looking for the last item that ends at or before offset.
+    const int count = Count();
+    int position = 0;
+    double positionOffset = 0.0;
+    int step = 1;
+    while (step * 2 <= count)
+    {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2)
+    {
+        const int next = position + step;
+        if (next <= count)
+        {
+            // The node at 'next' covers exactly 'step' items.
+            const double nodeSize =
+                m_sizeTree[next] +
+                (step - m_countTree[next]) * estimatedSize +
+                step * spacing;
+            if (positionOffset + nodeSize <= offset)
+            {
+                position = next;
+                positionOffset += nodeSize;
+            }
+        }
+    }
+
+    if (position == count)
+    {
+        // Past the end of the known items, extrapolate with the estimate.
+        const double estimatedItemSize = estimatedSize + spacing;
+        if (estimatedItemSize > 0)
+        {
+            position += static_cast<int>((offset - positionOffset) / estimatedItemSize);
+        }
+    }
+
+    return position;
+}
+
+void MeasuredSizeIndex::EnsureCount(int count)
+{
+    const int oldCount = Count();
+    if (count > oldCount)
+    {
+        // Items are usually discovered one at a time as layout generates forward,
+        // so append the new nodes instead of rebuilding the trees.
+        m_sizes.resize(count, -1.0);
+        m_sizeTree.resize(count + 1, 0.0);
+        m_countTree.resize(count + 1, 0);
+        for (int i = oldCount + 1; i <= count; ++i)
+        {
+            // Node i covers the items (i - lowbit(i), i]. The new item is not measured,
+            // so the node is the sum of the nodes covering the rest of that range.
+            for (int j = i - 1; j > i - (i & -i); j -= j & -j)
+            {
+                m_sizeTree[i] += m_sizeTree[j];
+                m_countTree[i] += m_countTree[j];
+            }
+        }
+    }
+}
+
+void MeasuredSizeIndex::Rebuild()
+{
+    // O(n) construction: each node pushes its sum to its parent.
+    const int count = Count();
+    m_sizeTree.assign(count + 1, 0.0);
+    m_countTree.assign(count + 1, 0);
+    for (int i = 1; i <= count; ++i)
+    {
+        const double size = m_sizes[i - 1];
+        if (size >= 0)
+        {
+            m_sizeTree[i] += size;
+            m_countTree[i] += 1;
+        }
+
+        const int parent = i + (i & -i);
+        if (parent <= count)
+        {
+            m_sizeTree[parent] += m_sizeTree[i];
+            m_countTree[parent] += m_countTree[i];
+        }
+    }
+}
+
+void MeasuredSizeIndex::AddToTree(int index, double size, int count)
+{
+    for (int i = index + 1; i < static_cast<int>(m_sizeTree.size()); i += i & -i)
+    {
+        m_sizeTree[i] += size;
+        m_countTree[i] += count;
+    }
+}
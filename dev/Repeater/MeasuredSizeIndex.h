@@ -0,0 +1,48 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Keeps the measured size (in the virtualizing direction) of every item that has
+// been measured so far and answers offset <-> index queries in O(log n) using a
+// Fenwick tree. Items that have not been measured yet are assumed to have the
+// estimated size passed to the queries, so the index can be used before all the
+// items have been seen.
+// Every item is followed by 'spacing', i.e. OffsetFromIndex(i) is the start of item i.
+class MeasuredSizeIndex final
+{
+public:
+    int Count() const { return static_cast<int>(m_sizes.size()); }
+    bool IsMeasured(int index) const;
+
+    void SetSize(int index, double size);
+    // Sets the sizes of a range of items at once, e.g. sizes that are known up front.
+    void SetSizes(int startIndex, const std::vector<double>& sizes);
+
+    int MeasuredCount() const;
+    double MeasuredTotal() const;
+    // First index in [index, endIndex) that is (not) measured, or endIndex if there is none.
+    int NextUnmeasured(int index, int endIndex) const;
+    int NextMeasured(int index, int endIndex) const;
+
+    // Collection change notifications. Inserted items start out unmeasured.
+    void Insert(int index, int count);
+    void Remove(int index, int count);
+    void Clear();
+
+    double OffsetFromIndex(int index, double estimatedSize, double spacing) const;
+    // Returns the index of the item that contains offset. The result is not clamped
+    // to the item count since items beyond Count() are extrapolated with the estimate.
+    int IndexFromOffset(double offset, double estimatedSize, double spacing) const;
+
+private:
+    void EnsureCount(int count);
+    void Rebuild();
+    void AddToTree(int index, double size, int count);
+
+    // Measured size of each item, or -1 if the item has not been measured.
+    std::vector<double> m_sizes;
+    // 1-based Fenwick trees over the measured sizes and the number of measured items.
+    std::vector<double> m_sizeTree{ 0.0 };
+    std::vector<int> m_countTree{ 0 };
+};
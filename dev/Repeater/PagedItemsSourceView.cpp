@@ -0,0 +1,256 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include <Vector.h>
+#include "ItemsRepeater.common.h"
+#include "PagedItemsSourceView.h"
+
+CppWinRTActivatableClassWithBasicFactory(PagedItemsSourceView);
+
+PagedItemsSourceView::PagedItemsSourceView(const winrt::IPagedItemsSource& source)
+{
+    if (!source)
+    {
+        throw winrt::hresult_invalid_argument(L"Argument 'source' is null.");
+    }
+
+    m_source.set(source);
+    m_count = std::max(0, source.Count());
+}
+
+#pragma region IPagedItemsSourceView
+
+int32_t PagedItemsSourceView::PageSize()
+{
+    return m_pageSize;
+}
+
+void PagedItemsSourceView::PageSize(int32_t value)
+{
+    if (value <= 0)
+    {
+        throw winrt::hresult_invalid_argument(L"PageSize must be greater than zero.");
+    }
+
+    if (m_pageSize != value)
+    {
+        // Page boundaries move, so nothing we have loaded can be reused.
+        m_pageSize = value;
+        Refresh();
+    }
+}
+
+int32_t PagedItemsSourceView::MaxLoadedPages()
+{
+    return m_maxLoadedPages;
+}
+
+void PagedItemsSourceView::MaxLoadedPages(int32_t value)
+{
+    if (value < 0)
+    {
+        throw winrt::hresult_invalid_argument(L"MaxLoadedPages must be a non-negative number.");
+    }
+
+    m_maxLoadedPages = value;
+    EvictPages();
+}
+
+winrt::IInspectable PagedItemsSourceView::Placeholder()
+{
+    return m_placeholder.get();
+}
+
+void PagedItemsSourceView::Placeholder(winrt::IInspectable const& value)
+{
+    m_placeholder.set(value);
+}
+
+bool PagedItemsSourceView::IsItemLoaded(int32_t index)
+{
+    if (index < 0 || index >= m_count)
+    {
+        return false;
+    }
+
+    auto it = m_loadedPages.find(index / m_pageSize);
+    return it != m_loadedPages.end() && static_cast<uint32_t>(index % m_pageSize) < it->second.Items.get().Size();
+}
+
+void PagedItemsSourceView::Refresh()
+{
+    CancelPendingLoads();
+    m_loadedPages.clear();
+    ++m_generation;
+    m_count = std::max(0, m_source.get().Count());
+
+    OnDataSourceChanged(
+        winrt::NotifyCollectionChangedEventArgs(
+            winrt::NotifyCollectionChangedAction::Reset,
+            nullptr /* newItems */,
+            nullptr /* oldItems */,
+            -1 /* newIndex */,
+            -1 /* oldIndex */));
+}
+
+#pragma endregion
+
+#pragma region IDataSourceOverrides
+
+int32_t PagedItemsSourceView::GetSizeCore()
+{
+    return m_count;
+}
+
+winrt::IInspectable PagedItemsSourceView::GetAtCore(int index)
+{
+    if (index < 0 || index >= m_count)
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
+    const int pageIndex = index / m_pageSize;
+    const int indexInPage = index % m_pageSize;
+
+    winrt::IInspectable item = nullptr;
+    auto it = m_loadedPages.find(pageIndex);
+    if (it != m_loadedPages.end())
+    {
+        it->second.LastAccess = ++m_accessCount;
+        auto const items = it->second.Items.get();
+        // The source is allowed to return a short page. The rest stays a placeholder.
+        item = static_cast<uint32_t>(indexInPage) < items.Size() ? items.GetAt(static_cast<uint32_t>(indexInPage)) : m_placeholder.get();
+    }
+    else
+    {
+        EnsurePageRequested(pageIndex);
+        item = m_placeholder.get();
+    }
+
+    // Ask for the neighbouring page when we get close to the edge of this one so that
+    // it is usually there by the time the user scrolls into it.
+    const int lookAhead = m_pageSize / 4;
+    if (indexInPage >= m_pageSize - lookAhead && (pageIndex + 1) * m_pageSize < m_count)
+    {
+        EnsurePageRequested(pageIndex + 1);
+    }
+    else if (indexInPage < lookAhead && pageIndex > 0)
+    {
+        EnsurePageRequested(pageIndex - 1);
+    }
+
+    return item;
+}
+
+bool PagedItemsSourceView::HasKeyIndexMappingCore()
+{
+    return false;
+}
+
+#pragma endregion
+
+void PagedItemsSourceView::EnsurePageRequested(int pageIndex)
+{
+    if (m_loadedPages.find(pageIndex) != m_loadedPages.end() ||
+        m_pendingLoads.find(pageIndex) != m_pendingLoads.end())
+    {
+        return;
+    }
+
+    const int startIndex = pageIndex * m_pageSize;
+    const int count = std::min(m_pageSize, m_count - startIndex);
+    auto operation = m_source.get().LoadItemsAsync(startIndex, count);
+    if (!operation)
+    {
+        return;
+    }
+
+    m_pendingLoads.emplace(pageIndex, operation);
+
+    auto strongThis = get_strong();
+    const auto generation = m_generation;
+    operation.Completed(
+        winrt::AsyncOperationCompletedHandler<ItemsView>(
+            [strongThis, pageIndex, generation](const LoadOperation& asyncOperation, winrt::AsyncStatus asyncStatus)
+    {
+        // Always go through the dispatcher, even if we are already on the UI thread. A source
+        // that completes synchronously would otherwise change the data in the middle of the
+        // GetAt call that requested the page, which is usually during layout.
+        strongThis->m_dispatcherHelper.RunAsync(
+            [strongThis, pageIndex, generation, asyncOperation, asyncStatus]()
+        {
+            strongThis->OnPageLoaded(pageIndex, generation, asyncOperation, asyncStatus);
+        });
+    }));
+}
+
+void PagedItemsSourceView::OnPageLoaded(int pageIndex, uint32_t generation, const LoadOperation& operation, winrt::AsyncStatus status)
+{
+    if (generation != m_generation)
+    {
+        return;
+    }
+
+    m_pendingLoads.erase(pageIndex);
+
+    // A failed or canceled page is requested again the next time one of its items is read.
+    if (status != winrt::AsyncStatus::Completed)
+    {
+        return;
+    }
+
+    auto const items = operation.GetResults();
+    if (!items)
+    {
+        return;
+    }
+
+    const int startIndex = pageIndex * m_pageSize;
+    const int count = std::min(static_cast<int>(items.Size()), std::min(m_pageSize, m_count - startIndex));
+    m_loadedPages.emplace(pageIndex, LoadedPage(this, items, ++m_accessCount));
+    EvictPages();
+
+    if (count > 0)
+    {
+        auto oldItems = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Bindable>()>>();
+        auto newItems = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Bindable>()>>();
+        for (int i = 0; i < count; ++i)
+        {
+            oldItems.Append(m_placeholder.get());
+            newItems.Append(items.GetAt(static_cast<uint32_t>(i)));
+        }
+
+        OnDataSourceChanged(
+            winrt::NotifyCollectionChangedEventArgs(
+                winrt::NotifyCollectionChangedAction::Replace,
+                newItems,
+                oldItems,
+                startIndex,
+                startIndex));
+    }
+}
+
+void PagedItemsSourceView::EvictPages()
+{
+    // Evicted pages are dropped without a notification. Elements that are still realized keep
+    // their data and the page is loaded again if one of its items is read.
+    while (m_maxLoadedPages > 0 && static_cast<int>(m_loadedPages.size()) > m_maxLoadedPages)
+    {
+        auto leastRecentlyUsed = std::min_element(
+            m_loadedPages.begin(),
+            m_loadedPages.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second.LastAccess < rhs.second.LastAccess; });
+        m_loadedPages.erase(leastRecentlyUsed);
+    }
+}
+
+void PagedItemsSourceView::CancelPendingLoads()
+{
+    for (auto& pending : m_pendingLoads)
+    {
+        pending.second.Cancel();
+    }
+    m_pendingLoads.clear();
+}
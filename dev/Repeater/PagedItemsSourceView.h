@@ -0,0 +1,73 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "ItemsSourceView.h"
+#include "PagedItemsSourceView.g.h"
+#include "DispatcherHelper.h"
+
+// ItemsSourceView over a source that hands out its items asynchronously, a page at a
+// time. Count is known up front. Items that have not arrived yet are reported as the
+// Placeholder, and a page that arrives is announced as a Replace of its range so that
+// a repeater re-realizes the affected elements with the real data.
+class PagedItemsSourceView :
+    public ReferenceTracker<PagedItemsSourceView, winrt::implementation::PagedItemsSourceViewT, ItemsSourceView>
+{
+public:
+    PagedItemsSourceView(const winrt::IPagedItemsSource& source);
+
+#pragma region IPagedItemsSourceView
+    int32_t PageSize();
+    void PageSize(int32_t value);
+
+    int32_t MaxLoadedPages();
+    void MaxLoadedPages(int32_t value);
+
+    winrt::IInspectable Placeholder();
+    void Placeholder(winrt::IInspectable const& value);
+
+    bool IsItemLoaded(int32_t index);
+    void Refresh();
+#pragma endregion
+
+#pragma region IDataSourceOverrides
+    int32_t GetSizeCore() override;
+    winrt::IInspectable GetAtCore(int index) override;
+    bool HasKeyIndexMappingCore() override;
+#pragma endregion
+
+private:
+    using ItemsView = winrt::IVectorView<winrt::IInspectable>;
+    using LoadOperation = winrt::IAsyncOperation<ItemsView>;
+
+    struct LoadedPage
+    {
+        LoadedPage(const ITrackerHandleManager* owner, const ItemsView& items, uint64_t lastAccess) :
+            Items(owner, items), LastAccess(lastAccess) {}
+
+        tracker_ref<ItemsView> Items;
+        uint64_t LastAccess;
+    };
+
+    void EnsurePageRequested(int pageIndex);
+    void OnPageLoaded(int pageIndex, uint32_t generation, const LoadOperation& operation, winrt::AsyncStatus status);
+    void EvictPages();
+    void CancelPendingLoads();
+
+    tracker_ref<winrt::IPagedItemsSource> m_source{ this };
+    tracker_ref<winrt::IInspectable> m_placeholder{ this };
+    int m_count{ 0 };
+    int m_pageSize{ 50 };
+    // 0 means no limit.
+    int m_maxLoadedPages{ 0 };
+
+    std::unordered_map<int /* pageIndex */, LoadedPage> m_loadedPages;
+    std::unordered_map<int /* pageIndex */, LoadOperation> m_pendingLoads;
+    uint64_t m_accessCount{ 0 };
+
+    // Bumped by Refresh so that pages requested before it are dropped when they arrive.
+    uint32_t m_generation{ 0 };
+
+    DispatcherHelper m_dispatcherHelper;
+};
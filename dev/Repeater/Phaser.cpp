@@ -16,6 +16,12 @@ Phaser::Phaser(ItemsRepeater* owner) :
     // ItemsRepeater is not fully constructed yet. Don't interact with it.
 }
 
+Phaser::~Phaser()
+{
+    // The scheduler holds a raw pointer to this instance.
+    CancelCallback();
+}
+
 void Phaser::PhaseElement(
     const winrt::UIElement& element,
     const winrt::com_ptr<VirtualizationInfo>& virtInfo)
@@ -62,9 +68,10 @@ void Phaser::PhaseElement(
 
     if (shouldPhase)
     {
-        // Insert at the top since we remove from bottom during DoPhasedWorkCallback. This keeps the ordering of items
-        // the same as the order in which items are realized.
-        m_pendingElements.insert(m_pendingElements.begin(), ElementInfo(element, virtInfo));
+        // Ties are broken by sequence, which keeps the ordering of items the same as the order
+        // in which items are realized.
+        PushPendingElement(ElementInfo(element, virtInfo));
+        m_pendingElementsNeedRebuild = true;
         RegisterForCallback();
     }
 }
@@ -75,11 +82,14 @@ void Phaser::StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<V
     // since it will get updated when the element gets recycled.
     if (virtInfo->DataTemplateComponent())
     {
-        auto it = std::find_if(m_pendingElements.begin(), m_pendingElements.end(), [&element](const ElementInfo& info) { return info.Element() == element; });
+        auto it = std::find_if(m_pendingElements.begin(), m_pendingElements.end(), [&element](const PendingElement& pending) { return pending.info.Element() == element; });
 
         if (it != m_pendingElements.end())
         {
-            m_pendingElements.erase(it);
+            // Move the last entry into the hole and restore the heap.
+            *it = std::move(m_pendingElements.back());
+            m_pendingElements.pop_back();
+            std::make_heap(m_pendingElements.begin(), m_pendingElements.end(), &Phaser::HasLowerPriority);
         }
     }
 
@@ -91,97 +101,161 @@ void Phaser::DoPhasedWorkCallback()
 {
     MarkCallbackRecieved();
 
-    if (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield())
+    if (!m_pendingElements.empty() && !ShouldYield())
     {
+        // The heap only has to be rebuilt when the cached visibility may be stale. Otherwise
+        // each processed element costs a pop and possibly a push instead of a full sort.
         const auto visibleWindow = m_owner->VisibleWindow();
-        SortElements(visibleWindow);
-        int currentIndex = static_cast<int>(m_pendingElements.size()) - 1;
+        if (m_pendingElementsNeedRebuild || visibleWindow != m_pendingElementsWindow)
+        {
+            RebuildPendingElements(visibleWindow);
+        }
+
         do
         {
-            auto info = m_pendingElements[currentIndex];
-            auto element = info.Element();
-            auto virtInfo = info.VirtInfo();
-            auto dataIndex = virtInfo->Index();
+            ProcessNextPhaseBatch();
+        } while (!m_pendingElements.empty() && !ShouldYield());
+    }
 
-            int currentPhase = virtInfo->Phase();
-            if (currentPhase > 0)
-            {
-                int nextPhase = VirtualizationInfo::PhaseReachedEnd;
-                virtInfo->DataTemplateComponent().ProcessBindings(virtInfo->Data(), -1 /* item index unused */, currentPhase, nextPhase);
-                ValidatePhaseOrdering(currentPhase, nextPhase);
-
-                auto previousAvailableSize = winrt::LayoutInformation::GetAvailableSize(element);
-                element.Measure(previousAvailableSize);
-
-                if (nextPhase > 0)
-                {
-                    virtInfo->Phase(nextPhase);
-                    // If we are the first item or 
-                    // If the current items phase is higher than the next items phase, then move to the next item.
-                    if (currentIndex == 0 ||
-                        virtInfo->Phase() > m_pendingElements[currentIndex - 1].VirtInfo()->Phase())
-                    {
-                        currentIndex--;
-                    }
-                }
-                else
-                {
-                    m_pendingElements.erase(m_pendingElements.begin() + currentIndex);
-                    currentIndex--;
-                }
-            }
-            else
-            {
-                throw winrt::hresult_error(E_FAIL, L"Cleared element found in pending list which is not expected");
-            }
+    if (!m_pendingElements.empty())
+    {
+        RegisterForCallback();
+    }
+}
 
-            auto pendingCount = static_cast<int>(m_pendingElements.size());
-            if (currentIndex == -1)
-            {
-                // Reached the top, start from the bottom again
-                currentIndex = pendingCount - 1;
-            }
-            else if (currentIndex > -1 && currentIndex < pendingCount - 1)
+void Phaser::ProcessNextPhaseBatch()
+{
+    // Take every element at the front priority level, i.e. the same visibility and phase,
+    // so that one phase is processed for all of them before any moves on to the next one.
+    MUX_ASSERT(m_phaseBatch.empty());
+    const bool batchIsVisible = m_pendingElements.front().isVisible;
+    const int batchPhase = m_pendingElements.front().phase;
+    while (!m_pendingElements.empty() &&
+        m_pendingElements.front().isVisible == batchIsVisible &&
+        m_pendingElements.front().phase == batchPhase)
+    {
+        std::pop_heap(m_pendingElements.begin(), m_pendingElements.end(), &Phaser::HasLowerPriority);
+        m_phaseBatch.push_back(std::move(m_pendingElements.back()));
+        m_pendingElements.pop_back();
+    }
+
+    auto clearBatch = gsl::finally([this]()
+    {
+        m_phaseBatch.clear();
+    });
+
+    size_t processedCount = 0;
+    while (processedCount < m_phaseBatch.size())
+    {
+        auto& pending = m_phaseBatch[processedCount];
+        auto virtInfo = pending.info.VirtInfo();
+
+        const int currentPhase = virtInfo->Phase();
+        if (currentPhase <= 0)
+        {
+            throw winrt::hresult_error(E_FAIL, L"Cleared element found in pending list which is not expected");
+        }
+
+        int nextPhase = VirtualizationInfo::PhaseReachedEnd;
+        virtInfo->DataTemplateComponent().ProcessBindings(virtInfo->Data(), -1 /* item index unused */, currentPhase, nextPhase);
+        ValidatePhaseOrdering(currentPhase, nextPhase);
+
+        // The batch entry now carries the phase the element moves to.
+        pending.phase = nextPhase;
+        ++processedCount;
+
+        if (ShouldYield())
+        {
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < m_phaseBatch.size(); ++i)
+    {
+        auto& pending = m_phaseBatch[i];
+        if (i < processedCount)
+        {
+            auto element = pending.info.Element();
+            auto previousAvailableSize = winrt::LayoutInformation::GetAvailableSize(element);
+            element.Measure(previousAvailableSize);
+
+            if (pending.phase > 0)
             {
-                // If the next element is oustide the visible window and there are elements in the visible window
-                // go back to the visible window.
-                bool nextItemIsVisible = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[currentIndex].VirtInfo()->ArrangeBounds());
-                if (!nextItemIsVisible)
-                {
-                    bool haveVisibleItems = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[pendingCount - 1].VirtInfo()->ArrangeBounds());
-                    if (haveVisibleItems)
-                    {
-                        currentIndex = pendingCount - 1;
-                    }
-                }
+                pending.info.VirtInfo()->Phase(pending.phase);
+                PushPendingElement(pending.info);
             }
-        } while (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield());
+        }
+        else
+        {
+            // We ran out of time, the rest keep their place for the next callback.
+            m_pendingElements.push_back(std::move(pending));
+            std::push_heap(m_pendingElements.begin(), m_pendingElements.end(), &Phaser::HasLowerPriority);
+        }
     }
+}
 
+void Phaser::OnOwnerLoaded()
+{
+    m_isSuspended = false;
     if (!m_pendingElements.empty())
     {
         RegisterForCallback();
     }
 }
 
+void Phaser::OnOwnerUnloaded()
+{
+    m_isSuspended = true;
+    CancelCallback();
+}
+
 void Phaser::RegisterForCallback()
 {
-    if (!m_registeredForCallback)
+    MUX_ASSERT(!m_pendingElements.empty());
+    if (m_isSuspended)
     {
-        MUX_ASSERT(!m_pendingElements.empty());
-        m_registeredForCallback = true;
-        BuildTreeScheduler::RegisterWork(
-            m_pendingElements[m_pendingElements.size() - 1].VirtInfo()->Phase(), // Use the phase of the last one in the sorted list
-            [this]()
-        {
-            DoPhasedWorkCallback();
-        });
+        return;
+    }
+
+    const auto lane = NextWorkLane();
+    if (m_callbackToken != 0u && lane < m_callbackLane)
+    {
+        // Visible elements showed up, move to the faster lane.
+        CancelCallback();
+    }
+
+    if (m_callbackToken == 0u)
+    {
+        m_callbackLane = lane;
+        m_callbackToken = BuildTreeScheduler::RegisterWork(
+            lane,
+            m_pendingElements.front().phase, // Use the phase of the next element to be phased
+            [](void* context) { static_cast<Phaser*>(context)->DoPhasedWorkCallback(); },
+            this);
     }
 }
 
 void Phaser::MarkCallbackRecieved()
 {
-    m_registeredForCallback = false;
+    m_callbackToken = 0u;
+}
+
+void Phaser::CancelCallback()
+{
+    if (m_callbackToken != 0u)
+    {
+        BuildTreeScheduler::CancelWork(m_callbackToken);
+        m_callbackToken = 0u;
+    }
+}
+
+BuildTreeWorkLane Phaser::NextWorkLane() const
+{
+    // Elements pushed since the last rebuild were just realized and have not been
+    // arranged yet, most of them end up in the visible window.
+    return m_pendingElementsNeedRebuild || m_pendingElements.front().isVisible ?
+        BuildTreeWorkLane::VisiblePhasing :
+        BuildTreeWorkLane::CacheBuild;
 }
 
 /* static */
@@ -194,34 +268,51 @@ void Phaser::ValidatePhaseOrdering(int currentPhase, int nextPhase)
     }
 }
 
-void Phaser::SortElements(const winrt::Rect& visibleWindow)
+bool Phaser::ShouldYield() const
+{
+    const double budget = m_owner->PhasingBudget();
+    return budget > 0.0 ?
+        BuildTreeScheduler::ShouldYield(budget) :
+        BuildTreeScheduler::ShouldYield();
+}
+
+void Phaser::PushPendingElement(const ElementInfo& info)
 {
-    // Sort in descending order (inVisibleWindow, phase)
-    std::sort(
-        m_pendingElements.begin(),
-        m_pendingElements.end(),
-        [visibleWindow](const auto& lhs, const auto& rhs)
+    const auto virtInfo = info.VirtInfo();
+    m_pendingElements.push_back(PendingElement{
+        info,
+        virtInfo->Phase(),
+        SharedHelpers::DoRectsIntersect(virtInfo->ArrangeBounds(), m_pendingElementsWindow),
+        m_nextSequence++ });
+    std::push_heap(m_pendingElements.begin(), m_pendingElements.end(), &Phaser::HasLowerPriority);
+}
+
+void Phaser::RebuildPendingElements(const winrt::Rect& visibleWindow)
+{
+    for (auto& pending : m_pendingElements)
     {
-        const auto lhsBounds = lhs.VirtInfo()->ArrangeBounds();
-        const auto lhsIntersects = SharedHelpers::DoRectsIntersect(lhsBounds, visibleWindow);
-        const auto rhsBounds = rhs.VirtInfo()->ArrangeBounds();
-        const auto rhsIntersects = SharedHelpers::DoRectsIntersect(rhsBounds, visibleWindow);
+        pending.isVisible = SharedHelpers::DoRectsIntersect(pending.info.VirtInfo()->ArrangeBounds(), visibleWindow);
+    }
 
-        if ((lhsIntersects && rhsIntersects) ||
-            (!lhsIntersects && !rhsIntersects))
-        {
-            // Both are in the visible window or both are not
-            return lhs.VirtInfo()->Phase() < rhs.VirtInfo()->Phase();
-        }
-        else if (lhsIntersects)
-        {
-            // Left is in visible window
-            return false;
-        }
-        else
-        {
-            return true;
-        }
+    std::make_heap(m_pendingElements.begin(), m_pendingElements.end(), &Phaser::HasLowerPriority);
+    m_pendingElementsWindow = visibleWindow;
+    m_pendingElementsNeedRebuild = false;
+}
+
+/* static */
+bool Phaser::HasLowerPriority(const PendingElement& lhs, const PendingElement& rhs)
+{
+    // Elements in the visible window go first, then lower phases, then the
+    // elements that have been waiting the longest.
+    if (lhs.isVisible != rhs.isVisible)
+    {
+        return !lhs.isVisible;
     }
-    );
-}
\ No newline at end of file
+
+    if (lhs.phase != rhs.phase)
+    {
+        return lhs.phase > rhs.phase;
+    }
+
+    return lhs.sequence > rhs.sequence;
+}
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+
 class ItemsRepeater;
 
 struct ElementInfo
@@ -23,17 +26,53 @@ class Phaser final
 {
 public:
     Phaser(ItemsRepeater* owner);
+    ~Phaser();
     void PhaseElement(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
     void StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
 
+    // Phasing is suspended while the owner is not in the live tree.
+    void OnOwnerLoaded();
+    void OnOwnerUnloaded();
+
+    int PendingElementCount() const { return static_cast<int>(m_pendingElements.size()); }
+    size_t EstimatedBytes() const { return (m_pendingElements.capacity() + m_phaseBatch.capacity()) * sizeof(PendingElement); }
+
 private:
+    // An element waiting for its next phase. Visibility and phase are captured when the entry
+    // is pushed so the heap ordering stays consistent until the next rebuild.
+    struct PendingElement
+    {
+        ElementInfo info;
+        int phase;
+        bool isVisible;
+        uint64_t sequence;
+    };
+
     void DoPhasedWorkCallback();
+    void ProcessNextPhaseBatch();
     void RegisterForCallback();
     void MarkCallbackRecieved();
-    void SortElements(const winrt::Rect& visibleWindow);
+    void CancelCallback();
+    BuildTreeWorkLane NextWorkLane() const;
+    bool ShouldYield() const;
+    void PushPendingElement(const ElementInfo& info);
+    void RebuildPendingElements(const winrt::Rect& visibleWindow);
+    static bool HasLowerPriority(const PendingElement& lhs, const PendingElement& rhs);
     static void ValidatePhaseOrdering(int currentPhase, int nextPhase);
 
     ItemsRepeater* m_owner{ nullptr };
-    std::vector<ElementInfo> m_pendingElements{};
-    bool m_registeredForCallback{ false };
+    // Binary heap ordered by HasLowerPriority, the next element to phase is at the front.
+    std::vector<PendingElement> m_pendingElements{};
+    // Elements popped from m_pendingElements that are being processed for the same phase.
+    // Kept as a member so the storage is reused across callbacks.
+    std::vector<PendingElement> m_phaseBatch{};
+    // Window the cached visibility of m_pendingElements was computed against.
+    winrt::Rect m_pendingElementsWindow{};
+    // Elements pushed since the last rebuild have not been arranged yet, so their
+    // visibility has to be computed again on the next callback.
+    bool m_pendingElementsNeedRebuild{ false };
+    uint64_t m_nextSequence{ 0u };
+    BuildTreeWorkToken m_callbackToken{ 0u };
+    BuildTreeWorkLane m_callbackLane{ BuildTreeWorkLane::VisiblePhasing };
+    bool m_isSuspended{ false };
 };
\ No newline at end of file
@@ -39,4 +39,18 @@ int QPCTimer::DurationInMilliSeconds() const
     }
 
     return elapsedMilliSeconds;
+}
+
+int64_t QPCTimer::DurationInMicroSeconds() const
+{
+    LARGE_INTEGER now;
+    int64_t elapsedMicroSeconds = 0;
+
+    // See DurationInMilliSeconds for why failures are reported as no time elapsed.
+    if (QueryPerformanceCounter(&now))
+    {
+        elapsedMicroSeconds = (now.QuadPart - m_start.QuadPart) * 1000000 / m_frequency.QuadPart;
+    }
+
+    return elapsedMicroSeconds;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ public:
     QPCTimer();
     void Reset();
     int DurationInMilliSeconds() const;
+    int64_t DurationInMicroSeconds() const;
 
 private:
     LARGE_INTEGER m_start;
@@ -6,8 +6,49 @@
 #include "ItemsRepeater.common.h"
 #include "RecyclePool.h"
 
+// Rough cost of a single element in a recycled subtree. We only use this to give
+// a ballpark of how much memory a pool is holding on to.
+static constexpr int64_t c_estimatedBytesPerVisual = 1024;
+
 #pragma region IRecyclePool
 
+void RecyclePool::MaxElementsPerKey(int value)
+{
+    m_maxElementsPerKey = value;
+    for (auto& [key, bucket] : m_elements)
+    {
+        EnforceLimits(bucket);
+    }
+}
+
+void RecyclePool::MaxElements(int value)
+{
+    m_maxElements = value;
+    if (!m_elements.empty())
+    {
+        EnforceLimits(m_elements.begin()->second);
+    }
+}
+
+void RecyclePool::Trim()
+{
+    for (auto& [key, bucket] : m_elements)
+    {
+        for (auto& [owner, elements] : bucket.ElementsByOwner)
+        {
+            for (auto& elementInfo : elements)
+            {
+                RemoveFromOwner(elementInfo, nullptr /* newOwner */);
+                ++m_evictionCount;
+            }
+        }
+    }
+
+    m_elements.clear();
+    m_elementCount = 0;
+    m_estimatedBytes = 0;
+}
+
 void RecyclePool::PutElement(
     winrt::UIElement const& element,
     winrt::hstring const& key)
@@ -45,79 +86,222 @@ void RecyclePool::PutElementCore(
     winrt::hstring const& key,
     winrt::UIElement const& owner)
 {
+    PutElementCore(element, ReuseKeyHandle{ key }, owner);
+}
+
+winrt::UIElement RecyclePool::TryGetElementCore(
+    winrt::hstring const& key,
+    winrt::UIElement const& owner)
+{
+    return TryGetElementCore(ReuseKeyHandle{ key }, owner);
+}
 
-    const auto winrtKey = key;
-    auto iterator = m_elements.find(winrtKey);
-    auto winrtOwner = owner;
-    auto winrtOwnerAsPanel = EnsureOwnerIsPanelOrNull(winrtOwner);
+#pragma endregion
 
-    ElementInfo elementInfo{ this /* refManager */, element, winrtOwnerAsPanel };
+void RecyclePool::PutElementCore(
+    winrt::UIElement const& element,
+    ReuseKeyHandle const& key,
+    winrt::UIElement const& owner)
+{
+    auto winrtOwnerAsPanel = EnsureOwnerIsPanelOrNull(owner);
 
-    if (iterator != m_elements.end())
+    // operator[] default constructs the key and owner buckets the first time we see them.
+    auto& bucket = m_elements[key];
+    if (bucket.EstimatedBytesPerElement < 0)
     {
-        iterator->second.emplace_back(std::move(elementInfo));
-    }
-    else
-    {
-        std::vector<ElementInfo> pool;
-        pool.emplace_back(elementInfo);
-        m_elements.emplace(winrtKey, std::move(pool));
+        bucket.EstimatedBytesPerElement = EstimateElementSize(element);
     }
+
+    bucket.ElementsByOwner[winrt::get_abi(winrtOwnerAsPanel)].emplace_back(this /* refManager */, element, winrtOwnerAsPanel, ++m_sequence);
+    ++bucket.Count;
+    ++m_elementCount;
+    m_estimatedBytes += bucket.EstimatedBytesPerElement;
+
+    EnforceLimits(bucket);
 }
 
 winrt::UIElement RecyclePool::TryGetElementCore(
-    winrt::hstring const& key,
+    ReuseKeyHandle const& key,
     winrt::UIElement const& owner)
 {
     auto iterator = m_elements.find(key);
     if (iterator != m_elements.end())
     {
-        auto& elements = iterator->second;
-        if (elements.size() > 0)
+        auto& bucket = iterator->second;
+        auto& elementsByOwner = bucket.ElementsByOwner;
+        const auto ownerAsPanel = EnsureOwnerIsPanelOrNull(owner);
+
+        // Prefer an element from the same owner, then one with no owner so that we don't
+        // incur the enter/leave cost during recycling. Only when neither exists do we
+        // steal an element from another owner.
+        auto ownerIterator = elementsByOwner.find(winrt::get_abi(ownerAsPanel));
+        if (ownerIterator == elementsByOwner.end() && ownerAsPanel)
         {
-            ElementInfo elementInfo{ this /* refManager */, nullptr, nullptr };
-            // Prefer an element from the same owner or with no owner so that we don't incur
-            // the enter/leave cost during recycling.
-            // TODO: prioritize elements with the same owner to those without an owner.
-            const auto winrtOwner = owner;
-            auto iter = std::find_if(
-                elements.begin(),
-                elements.end(),
-                [&winrtOwner](const ElementInfo& elemInfo) { return elemInfo.Owner() == winrtOwner || !elemInfo.Owner(); });
-
-            if (iter != elements.end())
-            {
-                elementInfo = *iter;
-                elements.erase(iter);
-            }
-            else
+            ownerIterator = elementsByOwner.find(nullptr);
+        }
+
+        if (ownerIterator == elementsByOwner.end())
+        {
+            ownerIterator = elementsByOwner.begin();
+        }
+
+        if (ownerIterator != elementsByOwner.end())
+        {
+            auto& elements = ownerIterator->second;
+            MUX_ASSERT(!elements.empty());
+
+            ElementInfo elementInfo = elements.back();
+            elements.pop_back();
+
+            // Drop empty owner buckets so the lookups above only ever see owners
+            // that actually have elements to give.
+            if (elements.empty())
             {
-                elementInfo = elements.back();
-                elements.pop_back();
+                elementsByOwner.erase(ownerIterator);
             }
 
-            auto ownerAsPanel = EnsureOwnerIsPanelOrNull(winrtOwner);
-            if (elementInfo.Owner() && elementInfo.Owner() != ownerAsPanel)
+            RemoveFromBucket(bucket, elementInfo);
+            RemoveFromOwner(elementInfo, ownerAsPanel);
+            ++m_hitCount;
+
+            return elementInfo.Element();
+        }
+    }
+
+    ++m_missCount;
+    return nullptr;
+}
+
+bool RecyclePool::ShouldPrewarm(ReuseKeyHandle const& key, int targetCount) const
+{
+    const int limit = m_maxElementsPerKey >= 0 ? std::min(targetCount, m_maxElementsPerKey) : targetCount;
+    if (m_maxElements >= 0 && m_elementCount >= m_maxElements)
+    {
+        return false;
+    }
+
+    const auto iterator = m_elements.find(key);
+    const int count = iterator != m_elements.end() ? iterator->second.Count : 0;
+    return count < limit;
+}
+
+void RecyclePool::ResetCounters()
+{
+    m_hitCount = 0;
+    m_missCount = 0;
+    m_evictionCount = 0;
+}
+
+void RecyclePool::EnforceLimits(KeyBucket& bucket)
+{
+    if (m_maxElementsPerKey >= 0)
+    {
+        while (bucket.Count > m_maxElementsPerKey)
+        {
+            EvictOldestElement(bucket);
+        }
+    }
+
+    if (m_maxElements >= 0)
+    {
+        while (m_elementCount > m_maxElements)
+        {
+            // Find the key holding the least recently recycled element. The oldest
+            // element of each owner list is at its front.
+            KeyBucket* oldestBucket = nullptr;
+            uint64_t oldestSequence = std::numeric_limits<uint64_t>::max();
+            for (auto& [key, candidate] : m_elements)
             {
-                // Element is still under its parent. remove it from its parent.
-                auto panel = elementInfo.Owner();
-                if (panel)
+                for (auto& [owner, elements] : candidate.ElementsByOwner)
                 {
-                    unsigned int childIndex = 0;
-                    MUX_ASSERT(panel.Children().IndexOf(elementInfo.Element(), childIndex));
-                    panel.Children().RemoveAt(childIndex);
+                    if (elements.front().Sequence() < oldestSequence)
+                    {
+                        oldestSequence = elements.front().Sequence();
+                        oldestBucket = &candidate;
+                    }
                 }
             }
 
-            return elementInfo.Element();
+            MUX_ASSERT(oldestBucket);
+            EvictOldestElement(*oldestBucket);
         }
     }
+}
 
-    return nullptr;
+void RecyclePool::EvictOldestElement(KeyBucket& bucket)
+{
+    auto& elementsByOwner = bucket.ElementsByOwner;
+    auto oldest = elementsByOwner.end();
+    for (auto iterator = elementsByOwner.begin(); iterator != elementsByOwner.end(); ++iterator)
+    {
+        if (oldest == elementsByOwner.end() ||
+            iterator->second.front().Sequence() < oldest->second.front().Sequence())
+        {
+            oldest = iterator;
+        }
+    }
+
+    MUX_ASSERT(oldest != elementsByOwner.end());
+    ElementInfo elementInfo = oldest->second.front();
+    oldest->second.pop_front();
+    if (oldest->second.empty())
+    {
+        elementsByOwner.erase(oldest);
+    }
+
+    RemoveFromBucket(bucket, elementInfo);
+    // The element is not coming back, so make sure it does not linger in its
+    // owner's visual tree.
+    RemoveFromOwner(elementInfo, nullptr /* newOwner */);
+    ++m_evictionCount;
 }
 
+void RecyclePool::RemoveFromBucket(KeyBucket& bucket, const ElementInfo& /*elementInfo*/)
+{
+    --bucket.Count;
+    --m_elementCount;
+    m_estimatedBytes -= bucket.EstimatedBytesPerElement;
+}
 
-#pragma endregion
+/* static */
+void RecyclePool::RemoveFromOwner(const ElementInfo& elementInfo, const winrt::Panel& newOwner)
+{
+    if (auto panel = elementInfo.Owner())
+    {
+        if (panel != newOwner)
+        {
+            // Element is still under its parent. remove it from its parent.
+            unsigned int childIndex = 0;
+            if (panel.Children().IndexOf(elementInfo.Element(), childIndex))
+            {
+                panel.Children().RemoveAt(childIndex);
+            }
+        }
+    }
+}
+
+/* static */
+int64_t RecyclePool::EstimateElementSize(const winrt::UIElement& element)
+{
+    // Walk the subtree once per key. Elements recycled under the same key come from
+    // the same template so they are expected to be about the same size.
+    int64_t visualCount = 0;
+    std::vector<winrt::DependencyObject> pending{ element };
+    while (!pending.empty())
+    {
+        auto current = pending.back();
+        pending.pop_back();
+        ++visualCount;
+
+        const int childCount = winrt::VisualTreeHelper::GetChildrenCount(current);
+        for (int i = 0; i < childCount; ++i)
+        {
+            pending.push_back(winrt::VisualTreeHelper::GetChild(current, i));
+        }
+    }
+
+    return visualCount * c_estimatedBytesPerVisual;
+}
 
 winrt::Panel RecyclePool::EnsureOwnerIsPanelOrNull(const winrt::UIElement& owner)
 {
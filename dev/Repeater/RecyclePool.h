@@ -10,6 +10,14 @@ class RecyclePool :
 {
 public:
 #pragma region IRecyclePool
+    int MaxElementsPerKey() const { return m_maxElementsPerKey; }
+    void MaxElementsPerKey(int value);
+
+    int MaxElements() const { return m_maxElements; }
+    void MaxElements(int value);
+
+    void Trim();
+
     void PutElement(
         winrt::UIElement const& element,
         winrt::hstring const& key);
@@ -50,6 +58,41 @@ public:
     /* internal */
     static winrt::DependencyProperty GetOriginTemplateProperty() { return s_originTemplateProperty; };
 
+    // A reuse key along with its precomputed hash. Internal callers that recycle
+    // many elements under the same key can create the handle once and avoid
+    // rehashing the key string on every put/get.
+    struct ReuseKeyHandle
+    {
+        explicit ReuseKeyHandle(winrt::hstring const& key) :
+            Key(key), Hash(std::hash<std::wstring_view>{}(key)) {}
+
+        winrt::hstring Key;
+        size_t Hash;
+    };
+
+    void PutElementCore(
+        winrt::UIElement const& element,
+        ReuseKeyHandle const& key,
+        winrt::UIElement const& owner);
+    winrt::UIElement TryGetElementCore(
+        ReuseKeyHandle const& key,
+        winrt::UIElement const& owner);
+
+    // True when an app type derives from RecyclePool and may override the Core methods.
+    bool IsComposed() { return outer() != nullptr; }
+
+    // Returns true if the pool holds fewer than targetCount elements for the key and
+    // adding one more would not immediately get it evicted by the pool limits.
+    bool ShouldPrewarm(ReuseKeyHandle const& key, int targetCount) const;
+
+    // Counters surfaced through RepeaterTestHooks to help size pools.
+    int ElementCount() const { return m_elementCount; }
+    int64_t EstimatedBytes() const { return m_estimatedBytes; }
+    int HitCount() const { return m_hitCount; }
+    int MissCount() const { return m_missCount; }
+    int EvictionCount() const { return m_evictionCount; }
+    void ResetCounters();
+
 private:
     static GlobalDependencyProperty s_reuseKeyProperty;
     static GlobalDependencyProperty s_poolInstanceProperty;
@@ -59,16 +102,68 @@ private:
 
     struct ElementInfo
     {
-        ElementInfo(const ITrackerHandleManager* refManager, const winrt::UIElement& element, const winrt::Panel& owner)
-            :m_element(refManager, element), m_owner(refManager, owner) {}
+        ElementInfo(const ITrackerHandleManager* refManager, const winrt::UIElement& element, const winrt::Panel& owner, uint64_t sequence)
+            :m_element(refManager, element), m_owner(refManager, owner), m_sequence(sequence) {}
 
         winrt::UIElement Element() const { return m_element.get(); };
         winrt::Panel Owner() const { return m_owner.get(); };
+        // Monotonically increasing stamp of when the element was put in the pool.
+        // Smaller values were recycled longer ago.
+        uint64_t Sequence() const { return m_sequence; };
 
     private:
         tracker_ref<winrt::UIElement> m_element;
         tracker_ref<winrt::Panel> m_owner;
+        uint64_t m_sequence{};
+    };
+
+    struct ReuseKeyHash
+    {
+        size_t operator()(ReuseKeyHandle const& key) const { return key.Hash; }
+    };
+
+    struct ReuseKeyEqual
+    {
+        bool operator()(ReuseKeyHandle const& lhs, ReuseKeyHandle const& rhs) const
+        {
+            // Keys coming from the same ReuseKey value share the same underlying
+            // string handle so we can usually skip the string compare.
+            return lhs.Hash == rhs.Hash &&
+                (winrt::get_abi(lhs.Key) == winrt::get_abi(rhs.Key) || lhs.Key == rhs.Key);
+        }
     };
 
-    std::map<winrt::hstring /*key*/, std::vector<ElementInfo>> m_elements;
+    // Within a key, elements are bucketed by the panel that owned them when they were
+    // recycled (nullptr for elements without an owner) so that owner-matched retrieval
+    // does not need to resolve the tracker refs of unrelated elements.
+    // Each owner list is ordered from least to most recently recycled, so we hand out
+    // elements from the back and evict from the front.
+    struct KeyBucket
+    {
+        std::unordered_map<void* /*owner*/, std::deque<ElementInfo>> ElementsByOwner;
+        int Count{};
+        // Computed from the first element recycled under this key.
+        int64_t EstimatedBytesPerElement{ -1 };
+    };
+
+    using KeyBuckets = std::unordered_map<ReuseKeyHandle, KeyBucket, ReuseKeyHash, ReuseKeyEqual>;
+
+    void EnforceLimits(KeyBucket& bucket);
+    void EvictOldestElement(KeyBucket& bucket);
+    void RemoveFromBucket(KeyBucket& bucket, const ElementInfo& elementInfo);
+    static void RemoveFromOwner(const ElementInfo& elementInfo, const winrt::Panel& newOwner);
+    static int64_t EstimateElementSize(const winrt::UIElement& element);
+
+    KeyBuckets m_elements;
+
+    // A negative value means the pool is unbounded.
+    int m_maxElementsPerKey{ -1 };
+    int m_maxElements{ -1 };
+
+    uint64_t m_sequence{};
+    int m_elementCount{};
+    int64_t m_estimatedBytes{};
+    int m_hitCount{};
+    int m_missCount{};
+    int m_evictionCount{};
 };
\ No newline at end of file
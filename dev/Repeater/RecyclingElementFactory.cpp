@@ -17,6 +17,14 @@ RecyclingElementFactory::RecyclingElementFactory()
     m_templates.set(winrt::make<HashMap<winrt::hstring, winrt::DataTemplate>>());
 }
 
+RecyclingElementFactory::~RecyclingElementFactory()
+{
+    if (m_prewarmWorkToken != 0u)
+    {
+        BuildTreeScheduler::CancelWork(m_prewarmWorkToken);
+    }
+}
+
 #pragma region IRecyclingElementFactory
 
 winrt::RecyclePool RecyclingElementFactory::RecyclePool()
@@ -49,6 +57,32 @@ void RecyclingElementFactory::SelectTemplateKey(winrt::event_token const& token)
     m_selectTemplateKeyEventSource.remove(token);
 }
 
+void RecyclingElementFactory::PrewarmTemplates(int countPerKey)
+{
+    if (countPerKey < 0)
+    {
+        throw winrt::hresult_invalid_argument(L"countPerKey cannot be negative.");
+    }
+
+    if (!m_recyclePool)
+    {
+        m_recyclePool.set(winrt::RecyclePool());
+    }
+
+    m_prewarmCountPerKey = countPerKey;
+    m_prewarmedCountPerKey = 0;
+
+    if (countPerKey > 0)
+    {
+        SchedulePrewarm();
+    }
+    else if (m_prewarmWorkToken != 0u)
+    {
+        BuildTreeScheduler::CancelWork(m_prewarmWorkToken);
+        m_prewarmWorkToken = 0u;
+    }
+}
+
 #pragma endregion
 
 #pragma region IRecyclingElementFactoryOverrides
@@ -57,17 +91,40 @@ winrt::hstring RecyclingElementFactory::OnSelectTemplateKeyCore(
     winrt::IInspectable const& dataContext, 
     winrt::UIElement const& owner)
 {
-    if (!m_args)
+    // The args are reused across calls. A handler that ends up realizing another
+    // element from this factory gets its own args so it can't clobber ours.
+    winrt::SelectTemplateEventArgs winrtArgs{ nullptr };
+    if (m_isSelectingTemplateKey)
+    {
+        winrtArgs = winrt::make<SelectTemplateEventArgs>();
+    }
+    else
     {
-        m_args.set(winrt::make<SelectTemplateEventArgs>());
+        if (!m_args)
+        {
+            m_args.set(winrt::make<SelectTemplateEventArgs>());
+        }
+        winrtArgs = m_args.get();
     }
 
-    auto args = winrt::get_self<SelectTemplateEventArgs>(m_args.get());
+    auto args = winrt::get_self<SelectTemplateEventArgs>(winrtArgs);
     args->TemplateKey({});
     args->DataContext(dataContext);
     args->Owner(owner);
-    
-    m_selectTemplateKeyEventSource(*this, *args);
+
+    {
+        const bool wasSelectingTemplateKey = m_isSelectingTemplateKey;
+        m_isSelectingTemplateKey = true;
+        auto restoreSelecting = gsl::finally([this, wasSelectingTemplateKey, args]()
+        {
+            m_isSelectingTemplateKey = wasSelectingTemplateKey;
+            // Don't keep the last item and its owner alive through the cached args.
+            args->DataContext(nullptr);
+            args->Owner(nullptr);
+        });
+
+        m_selectTemplateKeyEventSource(*this, winrtArgs);
+    }
 
     auto templateKey = args->TemplateKey();
     if (templateKey.empty())
@@ -90,10 +147,12 @@ winrt::UIElement RecyclingElementFactory::GetElementCore(winrt::ElementFactoryGe
     }
 
     const auto winrtOwner = args.Parent();
+    // Go through the overridable so that a derived factory can pick the key directly,
+    // without the SelectTemplateKey event and its args.
     const auto templateKey =
         m_templates.get().Size() == 1 ?
         m_templates.get().First().Current().Key() :
-        OnSelectTemplateKeyCore(args.Data(), winrtOwner);
+        overridable().OnSelectTemplateKeyCore(args.Data(), winrtOwner);
 
     if (templateKey.empty())
     {
@@ -132,4 +191,63 @@ void RecyclingElementFactory::RecycleElementCore(winrt::ElementFactoryRecycleArg
     m_recyclePool.get().PutElement(element, key, args.Parent());
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+void RecyclingElementFactory::SchedulePrewarm()
+{
+    if (m_prewarmWorkToken == 0u)
+    {
+        // Same lane as ItemsRepeater.PrewarmElementCount, behind phasing and cache building.
+        // The destructor cancels the work, so no reference is held while it is queued.
+        m_prewarmWorkToken = BuildTreeScheduler::RegisterWork(
+            BuildTreeWorkLane::Prewarm,
+            0 /* priority */,
+            [](void* context) { static_cast<RecyclingElementFactory*>(context)->OnPrewarmCallback(); },
+            this);
+    }
+}
+
+void RecyclingElementFactory::OnPrewarmCallback()
+{
+    m_prewarmWorkToken = 0u;
+
+    while (m_prewarmedCountPerKey < m_prewarmCountPerKey && !BuildTreeScheduler::ShouldYield())
+    {
+        // Give every template its first element before any of them gets a second one, so
+        // that all of them are parsed as early as possible.
+        if (!PrewarmElement(m_prewarmedCountPerKey + 1))
+        {
+            ++m_prewarmedCountPerKey;
+        }
+    }
+
+    if (m_prewarmedCountPerKey < m_prewarmCountPerKey)
+    {
+        SchedulePrewarm();
+    }
+}
+
+bool RecyclingElementFactory::PrewarmElement(int countPerKey)
+{
+    const auto recyclePool = m_recyclePool.get();
+    const auto templates = m_templates.get();
+    if (!recyclePool || !templates)
+    {
+        return false;
+    }
+
+    auto pool = winrt::get_self<::RecyclePool>(recyclePool);
+    for (auto const& entry : templates)
+    {
+        const RecyclePool::ReuseKeyHandle key{ entry.Key() };
+        if (pool->ShouldPrewarm(key, countPerKey))
+        {
+            auto element = entry.Value().LoadContent().as<winrt::FrameworkElement>();
+            RecyclePool::SetReuseKey(element, key.Key);
+            pool->PutElementCore(element, key, nullptr /* owner */);
+            return true;
+        }
+    }
+
+    return false;
+}
\ No newline at end of file
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "ElementFactory.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
 #include "RecyclingElementFactory.g.h"
 
 class RecyclingElementFactory :
@@ -11,6 +13,7 @@ class RecyclingElementFactory :
 {
 public:
     RecyclingElementFactory();
+    ~RecyclingElementFactory();
 
 #pragma region IRecyclingElementFactory
     winrt::RecyclePool RecyclePool();
@@ -21,6 +24,11 @@ public:
 
     winrt::event_token SelectTemplateKey(winrt::TypedEventHandler<winrt::RecyclingElementFactory, winrt::SelectTemplateEventArgs> const& value);
     void SelectTemplateKey(winrt::event_token const& token);
+
+    // Uses the idle time left in frames to create up to countPerKey elements of every
+    // template into the recycle pool, so the first realization of each template kind
+    // does not pay for parsing it. Zero cancels pending work.
+    void PrewarmTemplates(int countPerKey);
 #pragma endregion
 
 #pragma region IRecyclingElementFactoryOverrides
@@ -32,9 +40,22 @@ public:
     void RecycleElementCore(winrt::ElementFactoryRecycleArgs const& args);
 #pragma endregion
 
+    // Creates one element into the recycle pool for the first template whose key
+    // has fewer than countPerKey pooled elements. Returns false when there is
+    // nothing left to create.
+    bool PrewarmElement(int countPerKey);
+
 private:
+    void SchedulePrewarm();
+    void OnPrewarmCallback();
+
     tracker_ref<winrt::RecyclePool> m_recyclePool{ this };
     tracker_ref<winrt::IMap<winrt::hstring, winrt::DataTemplate>> m_templates{ this };
     tracker_ref<winrt::SelectTemplateEventArgs> m_args{ this };
+    bool m_isSelectingTemplateKey{ false };
+    // Set by PrewarmTemplates. m_prewarmedCountPerKey is the count every template already reached.
+    int m_prewarmCountPerKey{ 0 };
+    int m_prewarmedCountPerKey{ 0 };
+    BuildTreeWorkToken m_prewarmWorkToken{ 0u };
     event_source<winrt::TypedEventHandler<winrt::RecyclingElementFactory, winrt::SelectTemplateEventArgs>> m_selectTemplateKeyEventSource{ this };
 };
\ No newline at end of file
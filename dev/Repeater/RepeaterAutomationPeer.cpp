@@ -25,35 +25,33 @@ winrt::IVector<winrt::AutomationPeer> RepeaterAutomationPeer::GetChildrenCore()
     auto childrenPeers = GetInner().as<winrt::IAutomationPeerOverrides>().GetChildrenCore();
     unsigned peerCount = childrenPeers.Size();
 
-    std::vector<std::pair<int /* index */, winrt::AutomationPeer>> realizedPeers;
-    realizedPeers.reserve(static_cast<int>(peerCount));
-
-    // Filter out unrealized peers.
+    // Group the peers by the repeater child they came from. A child without a peer of its
+    // own can contribute several peers of its descendants, keep those in their tree order.
+    std::unordered_map<void*, std::vector<winrt::AutomationPeer>> peersByChild;
+    peersByChild.reserve(peerCount);
+    for (unsigned i = 0u; i < peerCount; ++i)
     {
-        for (unsigned i = 0u; i < peerCount; ++i)
+        auto childPeer = childrenPeers.GetAt(i);
+        if (auto childElement = GetElement(childPeer, repeater))
         {
-            auto childPeer = childrenPeers.GetAt(i);
-            if (auto childElement = GetElement(childPeer, repeater))
-            {
-                auto virtInfo = ItemsRepeater::GetVirtualizationInfo(childElement);
-                if (virtInfo->IsRealized())
-                {
-                    realizedPeers.push_back(std::make_pair(virtInfo->Index(), childPeer));
-                }
-            }
+            peersByChild[winrt::get_abi(childElement)].push_back(childPeer);
         }
     }
 
-    // Sort peers by index.
-    std::sort(realizedPeers.begin(), realizedPeers.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
-
-    // Select peers.
+    // Select the peers of realized children, in index order.
     {
         auto peers = winrt::make<Vector<winrt::AutomationPeer, MakeVectorParam<VectorFlag::DependencyObjectBase>()>>(
-            static_cast<int>(realizedPeers.size()) /* capacity */);
-        for (auto& entry : realizedPeers)
+            static_cast<int>(peerCount) /* capacity */);
+        for (const auto& elementInfo : winrt::get_self<ItemsRepeater>(repeater)->ViewManager().RealizedElementsInIndexOrder())
         {
-            peers.Append(entry.second);
+            auto entry = peersByChild.find(winrt::get_abi(elementInfo.Element()));
+            if (entry != peersByChild.end())
+            {
+                for (auto& peer : entry->second)
+                {
+                    peers.Append(peer);
+                }
+            }
         }
         return peers;
     }
@@ -64,8 +62,99 @@ winrt::AutomationControlType RepeaterAutomationPeer::GetAutomationControlTypeCor
     return winrt::AutomationControlType::Group;
 }
 
+winrt::IInspectable RepeaterAutomationPeer::GetPatternCore(winrt::PatternInterface const& patternInterface)
+{
+    if (patternInterface == winrt::PatternInterface::ItemContainer)
+    {
+        return *this;
+    }
+
+    return __super::GetPatternCore(patternInterface);
+}
+
 #pragma endregion
 
+#pragma region IItemContainerProvider
+
+winrt::IRawElementProviderSimple RepeaterAutomationPeer::FindItemByProperty(
+    winrt::IRawElementProviderSimple const& startAfter,
+    winrt::AutomationProperty const& automationProperty,
+    winrt::IInspectable const& value)
+{
+    const bool matchesAnyItem = !automationProperty;
+    const bool matchesName = automationProperty == winrt::AutomationElementIdentifiers::NameProperty();
+    const bool matchesAutomationId = automationProperty == winrt::AutomationElementIdentifiers::AutomationIdProperty();
+    if (!matchesAnyItem && !matchesName && !matchesAutomationId)
+    {
+        throw winrt::hresult_invalid_argument(L"Only the Name and AutomationId properties are supported.");
+    }
+
+    auto repeater = safe_cast<winrt::ItemsRepeater>(Owner());
+    auto itemsSourceView = repeater.ItemsSourceView();
+    if (!itemsSourceView)
+    {
+        return nullptr;
+    }
+
+    int startIndex = 0;
+    if (startAfter)
+    {
+        auto startAfterElement = GetElement(PeerFromProvider(startAfter), repeater);
+        const int startAfterIndex = startAfterElement ? repeater.GetElementIndex(startAfterElement) : -1;
+        if (startAfterIndex < 0)
+        {
+            throw winrt::hresult_invalid_argument(L"startAfter is not an item of this ItemsRepeater.");
+        }
+        startIndex = startAfterIndex + 1;
+    }
+
+    const auto valueAsString = matchesAnyItem ? winrt::hstring{} : winrt::unbox_value_or<winrt::hstring>(value, winrt::hstring{});
+    const int count = itemsSourceView.Count();
+    for (int index = startIndex; index < count; ++index)
+    {
+        auto element = repeater.TryGetElement(index);
+        if (element)
+        {
+            // Realized items answer for themselves, their template may set any name or id.
+            if (auto peer = winrt::FrameworkElementAutomationPeer::CreatePeerForElement(element))
+            {
+                if (matchesAnyItem ||
+                    (matchesName && peer.GetName() == valueAsString) ||
+                    (matchesAutomationId && peer.GetAutomationId() == valueAsString))
+                {
+                    return ProviderFromPeer(peer);
+                }
+            }
+        }
+        else if (matchesAnyItem || (matchesName && GetItemText(itemsSourceView.GetAt(index)) == valueAsString))
+        {
+            // An AutomationId comes from the item template, so unrealized items can't match one
+            // without realizing all of them.
+            element = repeater.GetOrCreateElement(index);
+            if (auto peer = winrt::FrameworkElementAutomationPeer::CreatePeerForElement(element))
+            {
+                return ProviderFromPeer(peer);
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+#pragma endregion
+
+// The text an item would show with the default template, used as the name of items that aren't realized.
+/* static */
+winrt::hstring RepeaterAutomationPeer::GetItemText(const winrt::IInspectable& item)
+{
+    if (auto stringable = item.try_as<winrt::IStringable>())
+    {
+        return stringable.ToString();
+    }
+
+    return winrt::unbox_value_or<winrt::hstring>(item, winrt::hstring{});
+}
+
 // Get the immediate child element of repeater under which this childPeer came from. 
 winrt::UIElement RepeaterAutomationPeer::GetElement(const winrt::AutomationPeer& childPeer, const winrt::ItemsRepeater& repeater)
 {
@@ -6,7 +6,10 @@
 #include "RepeaterAutomationPeer.g.h"
 
 class RepeaterAutomationPeer :
-    public ReferenceTracker<RepeaterAutomationPeer, winrt::implementation::RepeaterAutomationPeerT>
+    public ReferenceTracker<
+        RepeaterAutomationPeer,
+        winrt::implementation::RepeaterAutomationPeerT,
+        winrt::IItemContainerProvider>
 {
 public:
     RepeaterAutomationPeer(winrt::ItemsRepeater const& owner);
@@ -15,9 +18,22 @@ public:
 
     winrt::IVector<winrt::AutomationPeer> GetChildrenCore();
     winrt::AutomationControlType GetAutomationControlTypeCore();
+    winrt::IInspectable GetPatternCore(winrt::PatternInterface const& patternInterface);
+
+#pragma endregion
+
+#pragma region IItemContainerProvider
+
+    // Searches the whole data source, not just the realized children. Unrealized items are
+    // matched on their data and only the item that is found gets realized.
+    winrt::IRawElementProviderSimple FindItemByProperty(
+        winrt::IRawElementProviderSimple const& startAfter,
+        winrt::AutomationProperty const& automationProperty,
+        winrt::IInspectable const& value);
 
 #pragma endregion
 
 private:
     winrt::UIElement GetElement(const winrt::AutomationPeer& peer, const winrt::ItemsRepeater& repeater);
+    static winrt::hstring GetItemText(const winrt::IInspectable& item);
 };
\ No newline at end of file
@@ -12,8 +12,13 @@ GlobalDependencyProperty ItemsRepeater::s_itemsSourceProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeater::s_itemTemplateProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeater::s_layoutProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeater::s_animatorProperty{ nullptr };
+GlobalDependencyProperty ItemsRepeater::s_prewarmElementCountProperty{ nullptr };
+GlobalDependencyProperty ItemsRepeater::s_isCollectionChangeCoalescingEnabledProperty{ nullptr };
+GlobalDependencyProperty ItemsRepeater::s_phasingBudgetProperty{ nullptr };
+GlobalDependencyProperty ItemsRepeater::s_isDirectionalCacheEnabledProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeater::s_horizontalCacheLengthProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeater::s_verticalCacheLengthProperty{ nullptr };
+GlobalDependencyProperty ItemsRepeater::s_isStickyHeaderProperty{ nullptr };
 
 /* static */
 void ItemsRepeater::EnsureProperties()
@@ -78,6 +83,54 @@ void ItemsRepeater::EnsureProperties()
                 winrt::PropertyChangedCallback(&ItemsRepeater::OnPropertyChanged));
     }
 
+    if (!s_prewarmElementCountProperty)
+    {
+        s_prewarmElementCountProperty =
+            InitializeDependencyProperty(
+                L"PrewarmElementCount",
+                winrt::name_of<int>(),
+                winrt::name_of<winrt::ItemsRepeater>(),
+                false /* isAttached */,
+                box_value(0) /* defaultValue */,
+                winrt::PropertyChangedCallback(&ItemsRepeater::OnPropertyChanged));
+    }
+
+    if (!s_isCollectionChangeCoalescingEnabledProperty)
+    {
+        s_isCollectionChangeCoalescingEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsCollectionChangeCoalescingEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::ItemsRepeater>(),
+                false /* isAttached */,
+                box_value(false) /* defaultValue */,
+                winrt::PropertyChangedCallback(&ItemsRepeater::OnPropertyChanged));
+    }
+
+    if (!s_phasingBudgetProperty)
+    {
+        s_phasingBudgetProperty =
+            InitializeDependencyProperty(
+                L"PhasingBudget",
+                winrt::name_of<double>(),
+                winrt::name_of<winrt::ItemsRepeater>(),
+                false /* isAttached */,
+                box_value(0.0) /* defaultValue */,
+                winrt::PropertyChangedCallback(&ItemsRepeater::OnPropertyChanged));
+    }
+
+    if (!s_isDirectionalCacheEnabledProperty)
+    {
+        s_isDirectionalCacheEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsDirectionalCacheEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::ItemsRepeater>(),
+                false /* isAttached */,
+                box_value(false) /* defaultValue */,
+                winrt::PropertyChangedCallback(&ItemsRepeater::OnPropertyChanged));
+    }
+
     if (!s_horizontalCacheLengthProperty)
     {
         s_horizontalCacheLengthProperty =
@@ -101,6 +154,18 @@ void ItemsRepeater::EnsureProperties()
                 nullptr /* defaultValue */,
                 winrt::PropertyChangedCallback(&ItemsRepeater::OnPropertyChanged));
     }
+
+    if (!s_isStickyHeaderProperty)
+    {
+        s_isStickyHeaderProperty =
+            InitializeDependencyProperty(
+                L"IsStickyHeader",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::ItemsRepeater>(),
+                true /* isAttached */,
+                box_value(false) /* defaultValue */,
+                winrt::PropertyChangedCallback(&ItemsRepeater::OnIsStickyHeaderPropertyChanged));
+    }
 }
 
 /*static*/
@@ -110,8 +175,23 @@ void ItemsRepeater::ClearProperties()
     s_itemTemplateProperty = nullptr;
     s_layoutProperty = nullptr;
     s_animatorProperty = nullptr;
+    s_prewarmElementCountProperty = nullptr;
+    s_isCollectionChangeCoalescingEnabledProperty = nullptr;
+    s_phasingBudgetProperty = nullptr;
+    s_isDirectionalCacheEnabledProperty = nullptr;
     s_horizontalCacheLengthProperty = nullptr;
     s_verticalCacheLengthProperty = nullptr;
+    s_isStickyHeaderProperty = nullptr;
+}
+
+bool ItemsRepeater::GetIsStickyHeader(winrt::UIElement const& element)
+{
+    return auto_unbox(element.GetValue(s_isStickyHeaderProperty));
+}
+
+void ItemsRepeater::SetIsStickyHeader(winrt::UIElement const& element, bool value)
+{
+    element.SetValue(s_isStickyHeaderProperty, box_value(value));
 }
 
 void ItemsRepeater::OnPropertyChanged(
@@ -119,4 +199,20 @@ void ItemsRepeater::OnPropertyChanged(
     const winrt::DependencyPropertyChangedEventArgs& args)
 {
     winrt::get_self<ItemsRepeater>(sender.as<winrt::ItemsRepeater>())->OnPropertyChanged(args);
+}
+
+void ItemsRepeater::OnIsStickyHeaderPropertyChanged(
+    const winrt::DependencyObject& sender,
+    const winrt::DependencyPropertyChangedEventArgs& /*args*/)
+{
+    ::StickyHeaderManager::OnIsStickyHeaderChanged();
+
+    // Headers are picked up by the arrange pass of their repeater.
+    if (auto parent = CachedVisualTreeHelpers::GetParent(sender))
+    {
+        if (auto repeater = parent.try_as<winrt::ItemsRepeater>())
+        {
+            repeater.InvalidateArrange();
+        }
+    }
 }
\ No newline at end of file
@@ -14,8 +14,28 @@ RepeaterLayoutContext::RepeaterLayoutContext(const winrt::ItemsRepeater& owner)
 
 #pragma region ILayoutContext
 
+void RepeaterLayoutContext::BeginLayoutPass()
+{
+    MUX_ASSERT(!m_isInLayoutPass);
+    m_layoutPassDataSource = GetOwner().ItemsSourceView();
+    m_layoutPassItemCount = m_layoutPassDataSource ? m_layoutPassDataSource.Count() : 0;
+    m_isInLayoutPass = true;
+}
+
+void RepeaterLayoutContext::EndLayoutPass()
+{
+    m_isInLayoutPass = false;
+    m_layoutPassDataSource = nullptr;
+    m_layoutPassItemCount = 0;
+}
+
 int32_t RepeaterLayoutContext::ItemCountCore()
 {
+    if (m_isInLayoutPass)
+    {
+        return m_layoutPassItemCount;
+    }
+
     auto dataSource = GetOwner().ItemsSourceView();
     if (dataSource)
     {
@@ -48,13 +68,18 @@ void RepeaterLayoutContext::LayoutStateCore(winrt::IInspectable const& value)
 winrt::IInspectable RepeaterLayoutContext::GetItemAtCore(
     int index)
 {
+    if (m_isInLayoutPass)
+    {
+        return m_layoutPassDataSource.GetAt(index);
+    }
+
     return GetOwner().ItemsSourceView().GetAt(index);
 }
 
 void RepeaterLayoutContext::RecycleElementCore(winrt::UIElement const& element)
 {
     auto owner = winrt::get_self<ItemsRepeater>(GetOwner());
-    REPEATER_TRACE_INFO(L"RepeaterLayout - RecycleElement: %d \n", owner->GetElementIndex(element));
+    REPEATER_TRACE_ELEMENT("Recycled", owner->LayoutIdForTracing().data(), owner->GetElementIndex(element));
     owner->ClearElementImpl(element);
 }
 
@@ -72,6 +97,11 @@ int32_t RepeaterLayoutContext::RecommendedAnchorIndexCore()
     {
         anchorIndex = repeater->GetElementIndex(anchor);
     }
+    else
+    {
+        // Right after RestoreLayoutState, start from where the saved layout was.
+        anchorIndex = repeater->RestoredAnchorIndex();
+    }
 
     return anchorIndex;
 }
@@ -11,6 +11,12 @@ class RepeaterLayoutContext :
 public:
     RepeaterLayoutContext(const winrt::ItemsRepeater& owner);
 
+    // The data can't change while the repeater is running layout, so for the duration of
+    // a Measure or Arrange we hold on to the data source and its count instead of going
+    // through the weak owner reference and the data source on every call the layout makes.
+    void BeginLayoutPass();
+    void EndLayoutPass();
+
     // Explicitly implement GetRuntimeClassName because winrt::implements chooses the first interface
     // as our name and we want the concrete VirtualizingLayoutContext as our name.
     hstring GetRuntimeClassName() const
@@ -48,4 +54,8 @@ private:
     // We hold a weak reference to prevent a leaking reference
     // cycle between the ItemsRepeater and its layout.
     winrt::weak_ref<winrt::ItemsRepeater> m_owner;
+
+    bool m_isInLayoutPass{ false };
+    winrt::ItemsSourceView m_layoutPassDataSource{ nullptr };
+    int m_layoutPassItemCount{ 0 };
 };
\ No newline at end of file
@@ -25,12 +25,56 @@ if(IsRepeaterTracingEnabled()) \
     RepeaterTrace::TraceInfo(message, __VA_ARGS__); \
 } \
 
+// Typed events for the per-element and per-pass paths. They cost a few field writes
+// instead of formatting a message, and keep every value as its own field.
+#define REPEATER_TRACE_ELEMENT(action, layoutId, index) \
+if(IsRepeaterTracingEnabled()) \
+{ \
+    RepeaterTrace::TraceElement(action, layoutId, index); \
+} \
+
+#define REPEATER_TRACE_ELEMENT_BOUNDS(action, layoutId, index, bounds) \
+if(IsRepeaterTracingEnabled()) \
+{ \
+    RepeaterTrace::TraceElementBounds(action, layoutId, index, bounds); \
+} \
+
+#define REPEATER_TRACE_LAYOUT_PASS(pass, layoutId, realizationRect) \
+if(IsRepeaterTracingEnabled()) \
+{ \
+    RepeaterTrace::TraceLayoutPass(pass, layoutId, realizationRect); \
+} \
+
 #define REPEATER_TRACE_PERF(info) \
 if(IsRepeaterPerfTracingEnabled()) \
 { \
     RepeaterTrace::TracePerfInfo(info); \
 } \
 
+#define REPEATER_TRACE_PERF_COUNTERS(repeater, layoutId, counters, phasingBacklog) \
+if(IsRepeaterPerfTracingEnabled()) \
+{ \
+    RepeaterTrace::TracePerfCounters(repeater, layoutId, counters, phasingBacklog); \
+} \
+
+// Running totals kept by each ItemsRepeater. They are read through RepeaterTestHooks
+// and written as typed fields to the perf provider after every measure pass.
+struct RepeaterPerfCounters
+{
+    // Elements handed out and taken back by the element factory.
+    int64_t elementsCreated{};
+    int64_t elementsRecycled{};
+    // Elements that came back from the element factory for the item they were
+    // already bound to, and kept their bindings.
+    int64_t elementsRebindSkipped{};
+    // Elements that moved to the pinned pool instead of being recycled.
+    int64_t elementsPinned{};
+    int64_t measureCount{};
+    int64_t arrangeCount{};
+    int64_t measureTimeInMicroseconds{};
+    int64_t elementFactoryTimeInMicroseconds{};
+};
+
 class RepeaterTrace
 {
 public:
@@ -38,7 +82,7 @@ public:
     {
         va_list args;
         va_start(args, message);
-        WCHAR buffer[128]{};
+        WCHAR buffer[256]{};
         if (SUCCEEDED(StringCchVPrintfW(buffer, ARRAYSIZE(buffer), message, args)))
         {
             // TraceViewers
@@ -56,6 +100,70 @@ public:
         va_end(args);
     }
 
+    // 'action' and 'pass' are expected to be string literals such as "Created" or "Measure".
+    static void TraceElement(PCSTR action, PCWSTR layoutId, int index) noexcept
+    {
+        TraceLoggingWrite(
+            g_hLoggingProvider,
+            "RepeaterElement" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_REPEATER),
+            TraceLoggingString(action, "Action"),
+            TraceLoggingWideString(layoutId, "LayoutId"),
+            TraceLoggingInt32(index, "Index"));
+    }
+
+    static void TraceElementBounds(PCSTR action, PCWSTR layoutId, int index, const winrt::Rect& bounds) noexcept
+    {
+        TraceLoggingWrite(
+            g_hLoggingProvider,
+            "RepeaterElementBounds" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_REPEATER),
+            TraceLoggingString(action, "Action"),
+            TraceLoggingWideString(layoutId, "LayoutId"),
+            TraceLoggingInt32(index, "Index"),
+            TraceLoggingFloat32(bounds.X, "X"),
+            TraceLoggingFloat32(bounds.Y, "Y"),
+            TraceLoggingFloat32(bounds.Width, "Width"),
+            TraceLoggingFloat32(bounds.Height, "Height"));
+    }
+
+    static void TraceLayoutPass(PCSTR pass, PCWSTR layoutId, const winrt::Rect& realizationRect) noexcept
+    {
+        TraceLoggingWrite(
+            g_hLoggingProvider,
+            "RepeaterLayoutPass" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_REPEATER),
+            TraceLoggingString(pass, "Pass"),
+            TraceLoggingWideString(layoutId, "LayoutId"),
+            TraceLoggingFloat32(realizationRect.X, "RealizationX"),
+            TraceLoggingFloat32(realizationRect.Y, "RealizationY"),
+            TraceLoggingFloat32(realizationRect.Width, "RealizationWidth"),
+            TraceLoggingFloat32(realizationRect.Height, "RealizationHeight"));
+    }
+
+    static void TracePerfCounters(const void* repeater, PCWSTR layoutId, const RepeaterPerfCounters& counters, int phasingBacklog) noexcept
+    {
+        TraceLoggingWrite(
+            g_hPerfProvider,
+            "RepeaterCounters" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_REPEATER),
+            TraceLoggingPointer(repeater, "Repeater"),
+            TraceLoggingWideString(layoutId, "LayoutId"),
+            TraceLoggingInt64(counters.elementsCreated, "ElementsCreated"),
+            TraceLoggingInt64(counters.elementsRecycled, "ElementsRecycled"),
+            TraceLoggingInt64(counters.elementsRebindSkipped, "ElementsRebindSkipped"),
+            TraceLoggingInt64(counters.elementsPinned, "ElementsPinned"),
+            TraceLoggingInt64(counters.measureCount, "MeasureCount"),
+            TraceLoggingInt64(counters.arrangeCount, "ArrangeCount"),
+            TraceLoggingInt64(counters.measureTimeInMicroseconds, "MeasureTimeInMicroseconds"),
+            TraceLoggingInt64(counters.elementFactoryTimeInMicroseconds, "ElementFactoryTimeInMicroseconds"),
+            TraceLoggingInt32(phasingBacklog, "PhasingBacklog"));
+    }
+
     static void TracePerfInfo(PCWSTR info) noexcept
     {
         // TraceViewers
@@ -59,6 +59,7 @@ winrt::Size ScrollAnchorProvider::ArrangeOverride(winrt::Size const& finalSize)
         }
 
         m_candidates.clear();
+        m_candidatePositions.clear();
         m_isAnchorElementDirty = true;
 
         m_postArrange(*this);
@@ -164,34 +165,35 @@ void ScrollAnchorProvider::RegisterAnchorCandidate(winrt::UIElement const& eleme
         const auto scrollViewer = TryGetScrollViewer();
         if (scrollViewer)
         {
-
-#ifdef _DEBUG
-            // We should not be registring the same element twice. Even through it is functionally ok,
-            // we will end up spending more time during arrange than we must.
-            // However checking if an element is already in the list every time a new element is registered is worse for perf.
-            // So, I'm leaving an assert here to catch regression in our code but in release builds we run without the check.
-            const auto elem = element;
-            const auto it = std::find_if(m_candidates.cbegin(), m_candidates.cend(), [&elem](const CandidateInfo& c) { return c.Element() == elem; });
-            if (it != m_candidates.cend())
+            // We should not be registering the same element twice. It would be functionally ok, but
+            // we would end up spending more time during arrange than we must.
+            const bool inserted = m_candidatePositions.emplace(winrt::get_abi(element), m_candidates.size()).second;
+            MUX_ASSERT(inserted);
+            if (inserted)
             {
-                MUX_ASSERT(false);
+                m_candidates.push_back(CandidateInfo(this /* owner */, element));
+                m_isAnchorElementDirty = true;
             }
-#endif // _DEBUG
-
-            m_candidates.push_back(CandidateInfo(this /* owner */, element));
-            m_isAnchorElementDirty = true;
         }
     }
 }
 
 void ScrollAnchorProvider::UnregisterAnchorCandidate(winrt::UIElement const& element)
 {
-    const auto elem = element;
-    const auto it = std::find_if(m_candidates.cbegin(), m_candidates.cend(), [&elem](const CandidateInfo& c) { return c.Element() == elem; });
-    if (it != m_candidates.cend())
+    const auto it = m_candidatePositions.find(winrt::get_abi(element));
+    if (it != m_candidatePositions.end())
     {
-        REPEATER_TRACE_INFO(L"Unregistered candidate %d\n", it - m_candidates.begin());
-        m_candidates.erase(it);
+        const size_t position = it->second;
+        REPEATER_TRACE_INFO(L"Unregistered candidate %d\n", static_cast<int>(position));
+        m_candidatePositions.erase(it);
+
+        // The order of the candidates doesn't matter, move the last one into the hole.
+        if (position != m_candidates.size() - 1)
+        {
+            m_candidates[position] = std::move(m_candidates.back());
+            m_candidatePositions[winrt::get_abi(m_candidates[position].Element())] = position;
+        }
+        m_candidates.pop_back();
         m_isAnchorElementDirty = true;
     }
 }
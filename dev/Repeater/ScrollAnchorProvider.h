@@ -149,7 +149,11 @@ private:
         winrt::Point m_changeViewOffset{};
     };
 
+    // Unordered, see UnregisterAnchorCandidate.
     std::vector<CandidateInfo> m_candidates;
+    // Maps each candidate element to its position in m_candidates. Every realized repeater
+    // element registers on prepare and unregisters on clear, so this keeps both O(1).
+    std::unordered_map<void* /* element */, size_t /* position */> m_candidatePositions;
 
     tracker_ref<winrt::FxScrollViewer> m_scrollViewer{ this };
     tracker_ref<winrt::UIElement> m_anchorElement{ this };
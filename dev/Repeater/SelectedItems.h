@@ -51,9 +51,21 @@ public:
         winrt::throw_hresult(E_NOTIMPL);
     }
 
-    uint32_t GetMany(uint32_t startIndex, winrt::array_view<T> const& values) noexcept
+    uint32_t GetMany(uint32_t startIndex, winrt::array_view<T> const& values)
     {
-        winrt::throw_hresult(E_NOTIMPL);
+        // Page through the selection without materializing it, each
+        // item is resolved from the selected ranges on demand.
+        uint32_t howMany = 0;
+        if (startIndex < m_totalCount)
+        {
+            howMany = std::min(values.size(), m_totalCount - startIndex);
+            for (uint32_t i = 0; i < howMany; i++)
+            {
+                values[i] = m_getAtImpl(m_infos, startIndex + i);
+            }
+        }
+
+        return howMany;
     }
 
 #pragma endregion
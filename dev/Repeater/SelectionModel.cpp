@@ -9,6 +9,8 @@
 #include "SelectionTreeHelper.h"
 #include "IndexPath.h"
 #include "SelectionModelSelectionChangedEventArgs.h"
+#include "SelectionModelIndexRange.h"
+#include "SelectionModelSnapshot.h"
 #include "SelectionModelChildrenRequestedEventArgs.h"
 #include "Vector.h"
 #include "SelectedItems.h"
@@ -38,6 +40,13 @@ SelectionModel::~SelectionModel()
 
 winrt::event_token SelectionModel::SelectionChanged(winrt::TypedEventHandler<winrt::SelectionModel, winrt::SelectionModelSelectionChangedEventArgs> const& value)
 {
+    if (!m_selectionChangedEventSource)
+    {
+        // Nobody was listening, so there is no up to date snapshot to diff against.
+        m_selectionSnapshot = TakeSelectionSnapshot();
+        m_isSelectionSnapshotValid = true;
+    }
+
     return m_selectionChangedEventSource.add(value);
 }
 
@@ -86,7 +95,7 @@ void SelectionModel::SingleSelect(bool value)
             // one selected item.
             auto firstSelectionIndexPath = selectedIndices.GetAt(0);
             ClearSelection(true /* resetAnchor */, false /*raiseSelectionChanged */);
-            SelectWithPathImpl(firstSelectionIndexPath, true /* select */, false /* raiseSelectionChanged */);
+            SelectWithPathImpl(IndexPath::GetPath(firstSelectionIndexPath), true /* select */, false /* raiseSelectionChanged */);
             // Setting SelectedIndex will raise SelectionChanged event.
             SelectedIndex(firstSelectionIndexPath);
         }
@@ -100,15 +109,7 @@ winrt::IndexPath SelectionModel::AnchorIndex()
     winrt::IndexPath anchor = nullptr;
     if (m_rootNode->AnchorIndex() >= 0)
     {
-        std::vector<int> path;
-        auto current = m_rootNode;
-        while (current && current->AnchorIndex() >= 0)
-        {
-            path.emplace_back(current->AnchorIndex());
-            current = current->GetAt(current->AnchorIndex(), false);
-        }
-
-        anchor = winrt::make<IndexPath>(path);
+        anchor = IndexPath::CreateFrom(AnchorPath());
     }
 
     return anchor;
@@ -118,22 +119,12 @@ void SelectionModel::AnchorIndex(winrt::IndexPath const& value)
 {
     if (value)
     {
-        SelectionTreeHelper::TraverseIndexPath(
-            m_rootNode,
-            value,
-            true, /* realizeChildren */
-            [](std::shared_ptr<SelectionNode> currentNode, const winrt::IndexPath& path, int depth, int childIndex)
-        {
-            currentNode->AnchorIndex(path.GetAt(depth));
-        }
-        );
+        SetAnchorPath(IndexPath::GetPath(value));
     }
     else
     {
-        m_rootNode->AnchorIndex(-1);
+        ClearAnchor();
     }
-
-    RaisePropertyChanged(L"AnchorIndex");
 }
 
 winrt::IndexPath SelectionModel::SelectedIndex()
@@ -150,11 +141,12 @@ winrt::IndexPath SelectionModel::SelectedIndex()
 
 void SelectionModel::SelectedIndex(winrt::IndexPath const& value)
 {
-    auto isSelected = IsSelectedAt(value);
+    const auto& path = IndexPath::GetPath(value);
+    auto isSelected = IsSelectedAtPath(path);
     if (!isSelected || !isSelected.Value())
     {
         ClearSelection(true /* resetAnchor */, false /*raiseSelectionChanged */);
-        SelectWithPathImpl(value, true /* select */, false /* raiseSelectionChanged */);
+        SelectWithPathImpl(path, true /* select */, false /* raiseSelectionChanged */);
         OnSelectionChanged();
     }
 }
@@ -208,7 +200,7 @@ winrt::IVectorView<winrt::IInspectable> SelectionModel::SelectedItems()
                     unsigned int currentCount = node->SelectedCount();
                     if (index >= currentIndex && index < currentIndex + currentCount)
                     {
-                        int targetIndex = node->SelectedIndices().at(index - currentIndex);
+                        int targetIndex = node->SelectedIndexAt(index - currentIndex);
                         item = node->ItemsSourceView().GetAt(targetIndex);
                         break;
                     }
@@ -263,8 +255,8 @@ winrt::IVectorView<winrt::IndexPath> SelectionModel::SelectedIndices()
                     unsigned int currentCount = node->SelectedCount();
                     if (index >= currentIndex && index < currentIndex + currentCount)
                     {
-                        int targetIndex = node->SelectedIndices().at(index - currentIndex);
-                        path = winrt::get_self<IndexPath>(info.Path)->CloneWithChildIndex(targetIndex);
+                        int targetIndex = node->SelectedIndexAt(index - currentIndex);
+                        path = IndexPath::CreateFrom(info.Path.CloneWithChildIndex(targetIndex));
                         break;
                     }
 
@@ -286,12 +278,12 @@ winrt::IVectorView<winrt::IndexPath> SelectionModel::SelectedIndices()
 
 void SelectionModel::SetAnchorIndex(int32_t index)
 {
-    AnchorIndex(winrt::make<IndexPath>(index));
+    SetAnchorPath(FlatIndexPath(index));
 }
 
 void SelectionModel::SetAnchorIndex(int groupIndex, int itemIndex)
 {
-    AnchorIndex(winrt::make<IndexPath>(groupIndex, itemIndex));
+    SetAnchorPath(FlatIndexPath(groupIndex, itemIndex));
 }
 
 void SelectionModel::Select(int32_t index)
@@ -306,7 +298,7 @@ void SelectionModel::Select(int groupIndex, int itemIndex)
 
 void SelectionModel::SelectAt(winrt::IndexPath const& index)
 {
-    SelectWithPathImpl(index, true /* select */, true /* raiseSelectionChanged */);
+    SelectWithPathImpl(IndexPath::GetPath(index), true /* select */, true /* raiseSelectionChanged */);
 }
 
 void SelectionModel::Deselect(int32_t index)
@@ -321,7 +313,7 @@ void SelectionModel::Deselect(int groupIndex, int itemIndex)
 
 void SelectionModel::DeselectAt(winrt::IndexPath const& index)
 {
-    SelectWithPathImpl(index, false /* select */, true /* raiseSelectionChanged */);
+    SelectWithPathImpl(IndexPath::GetPath(index), false /* select */, true /* raiseSelectionChanged */);
 }
 
 winrt::IReference<bool> SelectionModel::IsSelected(int index)
@@ -346,8 +338,12 @@ winrt::IReference<bool> SelectionModel::IsSelected(int groupIndex, int itemIndex
 
 winrt::IReference<bool> SelectionModel::IsSelectedAt(winrt::IndexPath const& index)
 {
-    auto path = index;
-    MUX_ASSERT(winrt::get_self<IndexPath>(path)->IsValid());
+    return IsSelectedAtPath(IndexPath::GetPath(index));
+}
+
+winrt::IReference<bool> SelectionModel::IsSelectedAtPath(const FlatIndexPath& path)
+{
+    MUX_ASSERT(path.IsValid());
     bool isRealized = true;
     auto node = m_rootNode;
     for (int i = 0; i < path.GetSize() - 1; i++)
@@ -390,7 +386,7 @@ void SelectionModel::SelectRangeFromAnchor(int endGroupIndex, int endItemIndex)
 
 void SelectionModel::SelectRangeFromAnchorTo(winrt::IndexPath const& index)
 {
-    SelectRangeImpl(AnchorIndex(), index, true /* select */);
+    SelectRangeImpl(AnchorPath(), IndexPath::GetPath(index), true /* select */);
 }
 
 void SelectionModel::DeselectRangeFromAnchor(int32_t index)
@@ -405,18 +401,18 @@ void SelectionModel::DeselectRangeFromAnchor(int endGroupIndex, int endItemIndex
 
 void SelectionModel::DeselectRangeFromAnchorTo(winrt::IndexPath const& index)
 {
-    SelectRangeImpl(AnchorIndex(), index, false /* select */);
+    SelectRangeImpl(AnchorPath(), IndexPath::GetPath(index), false /* select */);
 }
 
 
 void SelectionModel::SelectRange(winrt::IndexPath const& start, winrt::IndexPath const& end)
 {
-    SelectRangeImpl(start, end, true /* select */);
+    SelectRangeImpl(IndexPath::GetPath(start), IndexPath::GetPath(end), true /* select */);
 }
 
 void SelectionModel::DeselectRange(winrt::IndexPath const& start, winrt::IndexPath const& end)
 {
-    SelectRangeImpl(start, end, false /* select */);
+    SelectRangeImpl(IndexPath::GetPath(start), IndexPath::GetPath(end), false /* select */);
 }
 
 void SelectionModel::SelectAll()
@@ -440,6 +436,36 @@ void SelectionModel::ClearSelection()
     ClearSelection(true /*resetAnchor*/, true /* raiseSelectionChanged */);
 }
 
+void SelectionModel::BeginBatch()
+{
+    m_batchDepth++;
+}
+
+void SelectionModel::EndBatch()
+{
+    if (m_batchDepth == 0)
+    {
+        throw winrt::hresult_error(E_FAIL, L"EndBatch called without a matching BeginBatch.");
+    }
+
+    if (--m_batchDepth == 0 && m_isSelectionChangePending)
+    {
+        m_isSelectionChangePending = false;
+        RaiseSelectionChanged();
+    }
+}
+
+winrt::SelectionModelSnapshot SelectionModel::CreateSnapshot()
+{
+    std::vector<SelectionModelSnapshot::Entry> entries;
+    for (auto& entry : TakeSelectionSnapshot())
+    {
+        entries.push_back(SelectionModelSnapshot::Entry{ std::move(entry.Path), std::move(entry.Ranges) });
+    }
+
+    return winrt::make<SelectionModelSnapshot>(std::move(entries));
+}
+
 #pragma endregion
 
 #pragma region ICustomPropertyProvider
@@ -514,6 +540,9 @@ void SelectionModel::RaisePropertyChanged(std::wstring_view const& name)
 
 void SelectionModel::OnSelectionInvalidatedDueToCollectionChange()
 {
+    // The indices in the snapshot no longer line up with the source, so
+    // this change is reported without a delta.
+    m_isSelectionSnapshotValid = false;
     OnSelectionChanged();
 }
 
@@ -566,7 +595,7 @@ void SelectionModel::ClearSelection(bool resetAnchor, bool raiseSelectionChanged
 
     if (resetAnchor)
     {
-        AnchorIndex(nullptr);
+        ClearAnchor();
     }
 
     if (raiseSelectionChanged)
@@ -580,15 +609,22 @@ void SelectionModel::OnSelectionChanged()
     m_selectedIndicesCached = nullptr;
     m_selectedItemsCached = nullptr;
 
+    if (m_batchDepth > 0)
+    {
+        m_isSelectionChangePending = true;
+    }
+    else
+    {
+        RaiseSelectionChanged();
+    }
+}
+
+void SelectionModel::RaiseSelectionChanged()
+{
     // Raise SelectionChanged event
     if (m_selectionChangedEventSource)
     {
-        if (!m_selectionChangedEventArgs)
-        {
-            m_selectionChangedEventArgs = tracker_ref<winrt::SelectionModelSelectionChangedEventArgs>(this, winrt::make<SelectionModelSelectionChangedEventArgs>());
-        }
-
-        m_selectionChangedEventSource(*this, m_selectionChangedEventArgs.get());
+        m_selectionChangedEventSource(*this, CreateSelectionChangedEventArgs());
     }
 
     RaisePropertyChanged(L"SelectedIndex");
@@ -600,6 +636,130 @@ void SelectionModel::OnSelectionChanged()
     }
 }
 
+std::vector<SelectionModel::SelectionSnapshotEntry> SelectionModel::TakeSelectionSnapshot()
+{
+    // Traverse visits the nodes in increasing IndexPath order, which lets
+    // two snapshots be compared with a single merge-like walk.
+    std::vector<SelectionSnapshotEntry> snapshot;
+    SelectionTreeHelper::Traverse(
+        m_rootNode,
+        false, /* realizeChildren */
+        [&snapshot](const SelectionTreeHelper::TreeWalkNodeInfo& currentInfo)
+    {
+        if (currentInfo.Node->SelectedCount() > 0)
+        {
+            snapshot.emplace_back(SelectionSnapshotEntry{ currentInfo.Path, currentInfo.Node->SelectedRanges() });
+        }
+    });
+
+    return snapshot;
+}
+
+winrt::SelectionModelSelectionChangedEventArgs SelectionModel::CreateSelectionChangedEventArgs()
+{
+    auto snapshot = TakeSelectionSnapshot();
+    winrt::SelectionModelSelectionChangedEventArgs args{ nullptr };
+
+    if (m_isSelectionSnapshotValid)
+    {
+        auto addedRanges = winrt::make<Vector<winrt::SelectionModelIndexRange>>();
+        auto removedRanges = winrt::make<Vector<winrt::SelectionModelIndexRange>>();
+        const auto appendRanges = [](const winrt::IVector<winrt::SelectionModelIndexRange>& target, const FlatIndexPath& parentPath, const std::vector<IndexRange>& ranges)
+        {
+            for (const auto& range : ranges)
+            {
+                target.Append(winrt::make<SelectionModelIndexRange>(
+                    IndexPath::CreateFrom(parentPath.CloneWithChildIndex(range.Begin())),
+                    IndexPath::CreateFrom(parentPath.CloneWithChildIndex(range.End()))));
+            }
+        };
+
+        const IndexRangeSet empty;
+        auto oldIt = m_selectionSnapshot.begin();
+        auto newIt = snapshot.begin();
+        while (oldIt != m_selectionSnapshot.end() || newIt != snapshot.end())
+        {
+            int compare = 0;
+            if (oldIt == m_selectionSnapshot.end())
+            {
+                compare = 1;
+            }
+            else if (newIt == snapshot.end())
+            {
+                compare = -1;
+            }
+            else
+            {
+                compare = oldIt->Path.CompareTo(newIt->Path);
+            }
+
+            if (compare < 0)
+            {
+                // Node no longer has a selection.
+                appendRanges(removedRanges, oldIt->Path, oldIt->Ranges.Difference(empty));
+                ++oldIt;
+            }
+            else if (compare > 0)
+            {
+                // Node did not have a selection before.
+                appendRanges(addedRanges, newIt->Path, newIt->Ranges.Difference(empty));
+                ++newIt;
+            }
+            else
+            {
+                appendRanges(addedRanges, newIt->Path, newIt->Ranges.Difference(oldIt->Ranges));
+                appendRanges(removedRanges, oldIt->Path, oldIt->Ranges.Difference(newIt->Ranges));
+                ++oldIt;
+                ++newIt;
+            }
+        }
+
+        args = winrt::make<SelectionModelSelectionChangedEventArgs>(addedRanges.GetView(), removedRanges.GetView());
+    }
+    else
+    {
+        args = winrt::make<SelectionModelSelectionChangedEventArgs>();
+    }
+
+    m_selectionSnapshot = std::move(snapshot);
+    m_isSelectionSnapshotValid = true;
+    return args;
+}
+
+FlatIndexPath SelectionModel::AnchorPath()
+{
+    FlatIndexPath path;
+    auto current = m_rootNode;
+    while (current && current->AnchorIndex() >= 0)
+    {
+        path.Append(current->AnchorIndex());
+        current = current->GetAt(current->AnchorIndex(), false);
+    }
+
+    return path;
+}
+
+void SelectionModel::SetAnchorPath(const FlatIndexPath& path)
+{
+    SelectionTreeHelper::TraverseIndexPath(
+        m_rootNode,
+        path,
+        true, /* realizeChildren */
+        [](std::shared_ptr<SelectionNode> currentNode, const FlatIndexPath& /*path*/, int /*depth*/, int childIndex)
+    {
+        currentNode->AnchorIndex(childIndex);
+    }
+    );
+
+    RaisePropertyChanged(L"AnchorIndex");
+}
+
+void SelectionModel::ClearAnchor()
+{
+    m_rootNode->AnchorIndex(-1);
+    RaisePropertyChanged(L"AnchorIndex");
+}
+
 void SelectionModel::SelectImpl(int index, bool select)
 {
     if (m_singleSelect)
@@ -610,7 +770,7 @@ void SelectionModel::SelectImpl(int index, bool select)
     auto selected = m_rootNode->Select(index, select);
     if (selected)
     {
-        AnchorIndex(winrt::make<IndexPath>(index));
+        SetAnchorPath(FlatIndexPath(index));
     }
 
     OnSelectionChanged();
@@ -627,13 +787,13 @@ void SelectionModel::SelectWithGroupImpl(int groupIndex, int itemIndex, bool sel
     auto selected = childNode->Select(itemIndex, select);
     if (selected)
     {
-        AnchorIndex(winrt::make<IndexPath>(groupIndex, itemIndex));
+        SetAnchorPath(FlatIndexPath(groupIndex, itemIndex));
     }
 
     OnSelectionChanged();
 }
 
-void SelectionModel::SelectWithPathImpl(const winrt::IndexPath& index, bool select, bool raiseSelectionChanged)
+void SelectionModel::SelectWithPathImpl(const FlatIndexPath& index, bool select, bool raiseSelectionChanged)
 {
     bool selected = false;
     if (m_singleSelect)
@@ -645,7 +805,7 @@ void SelectionModel::SelectWithPathImpl(const winrt::IndexPath& index, bool sele
         m_rootNode,
         index,
         true, /* realizeChildren */
-        [&selected, &select](std::shared_ptr<SelectionNode> currentNode, const winrt::IndexPath& path, int depth, int childIndex)
+        [&selected, &select](std::shared_ptr<SelectionNode> currentNode, const FlatIndexPath& path, int depth, int childIndex)
         {
             if (depth == path.GetSize() - 1)
             {
@@ -656,7 +816,7 @@ void SelectionModel::SelectWithPathImpl(const winrt::IndexPath& index, bool sele
 
     if (selected)
     {
-        AnchorIndex(index);
+        SetAnchorPath(index);
     }
 
     if (raiseSelectionChanged)
@@ -668,8 +828,8 @@ void SelectionModel::SelectWithPathImpl(const winrt::IndexPath& index, bool sele
 void SelectionModel::SelectRangeFromAnchorImpl(int index, bool select)
 {
     int anchorIndex = 0;
-    auto anchor = AnchorIndex();
-    if (anchor)
+    const auto anchor = AnchorPath();
+    if (anchor.GetSize() > 0)
     {
         MUX_ASSERT(anchor.GetSize() == 1);
         anchorIndex = anchor.GetAt(0);
@@ -686,8 +846,8 @@ void SelectionModel::SelectRangeFromAnchorWithGroupImpl(int endGroupIndex, int e
 {
     int startGroupIndex = 0;
     int startItemIndex = 0;
-    auto anchorIndex = AnchorIndex();
-    if (anchorIndex)
+    const auto anchorIndex = AnchorPath();
+    if (anchorIndex.GetSize() > 0)
     {
         MUX_ASSERT(anchorIndex.GetSize() == 2);
         startGroupIndex = anchorIndex.GetAt(0);
@@ -721,24 +881,18 @@ void SelectionModel::SelectRangeFromAnchorWithGroupImpl(int endGroupIndex, int e
     }
 }
 
-void SelectionModel::SelectRangeImpl(const winrt::IndexPath& start, const winrt::IndexPath& end, bool select)
+void SelectionModel::SelectRangeImpl(const FlatIndexPath& start, const FlatIndexPath& end, bool select)
 {
-    auto winrtStart = start;
-    auto winrtEnd = end;
-
     // Make sure start <= end 
-    if (winrtEnd.CompareTo(winrtStart) == -1)
-    {
-        auto temp = winrtStart;
-        winrtStart = winrtEnd;
-        winrtEnd = temp;
-    }
+    const bool isReversed = end.CompareTo(start) == -1;
+    const auto& rangeStart = isReversed ? end : start;
+    const auto& rangeEnd = isReversed ? start : end;
 
     // Note: Since we do not know the depth of the tree, we have to walk to each leaf
     SelectionTreeHelper::TraverseRangeRealizeChildren(
         m_rootNode,
-        winrtStart,
-        winrtEnd,
+        rangeStart,
+        rangeEnd,
         [select](const SelectionTreeHelper::TreeWalkNodeInfo& info)
     {
         if (info.Node->DataCount() == 0)
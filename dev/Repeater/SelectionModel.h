@@ -4,11 +4,13 @@
 #pragma once
 
 #include "SelectionModel.g.h"
+#include "IndexRangeSet.h"
+#include "FlatIndexPath.h"
 
 struct SelectedItemInfo
 {
     std::weak_ptr<SelectionNode> Node;
-    winrt::IndexPath Path;
+    FlatIndexPath Path;
 };
 
 class SelectionModel :
@@ -70,6 +72,11 @@ public:
     void SelectAll(void);
     void ClearSelection(void);
 
+    void BeginBatch();
+    void EndBatch();
+
+    winrt::SelectionModelSnapshot CreateSnapshot();
+
 #pragma endregion
 
 #pragma region ICustomPropertyProvider
@@ -96,13 +103,29 @@ private:
     void RaisePropertyChanged(std::wstring_view const& name);
     void ClearSelection(bool resetAnchor, bool raiseSelectionChanged);
     void OnSelectionChanged();
+    void RaiseSelectionChanged();
+
+    struct SelectionSnapshotEntry
+    {
+        FlatIndexPath Path;
+        IndexRangeSet Ranges;
+    };
+
+    std::vector<SelectionSnapshotEntry> TakeSelectionSnapshot();
+    winrt::SelectionModelSelectionChangedEventArgs CreateSelectionChangedEventArgs();
 
     void SelectImpl(int index, bool select);
     void SelectWithGroupImpl(int groupIndex, int itemIndex, bool select);
-    void SelectWithPathImpl(const winrt::IndexPath& index, bool select, bool raiseSelectionChanged);
+    // The anchor as an internal path, empty when there is no anchor.
+    FlatIndexPath AnchorPath();
+    void SetAnchorPath(const FlatIndexPath& path);
+    void ClearAnchor();
+    winrt::IReference<bool> IsSelectedAtPath(const FlatIndexPath& path);
+
+    void SelectWithPathImpl(const FlatIndexPath& index, bool select, bool raiseSelectionChanged);
     void SelectRangeFromAnchorImpl(int index, bool select);
     void SelectRangeFromAnchorWithGroupImpl(int groupIndex, int itemIndex, bool select);
-    void SelectRangeImpl(const winrt::IndexPath& start, const winrt::IndexPath& end, bool select);
+    void SelectRangeImpl(const FlatIndexPath& start, const FlatIndexPath& end, bool select);
 
     std::shared_ptr<SelectionNode> m_rootNode{ nullptr };
     bool m_singleSelect{ false };
@@ -116,7 +139,14 @@ private:
 
     // Cached Event args to avoid creation cost every time
     tracker_ref<winrt::SelectionModelChildrenRequestedEventArgs> m_childrenRequestedEventArgs{ this };
-    tracker_ref<winrt::SelectionModelSelectionChangedEventArgs> m_selectionChangedEventArgs{ this };
+
+    // SelectionChanged is deferred while a batch is open and raised once when the
+    // outermost batch ends. The added/removed ranges it reports are the difference
+    // between the selection now and the snapshot taken when it was last raised.
+    int m_batchDepth{ 0 };
+    bool m_isSelectionChangePending{ false };
+    bool m_isSelectionSnapshotValid{ false };
+    std::vector<SelectionSnapshotEntry> m_selectionSnapshot;
 
     // use just one instance of a leaf node to avoid creating a bunch of these.
     std::shared_ptr<SelectionNode> m_leafNode;
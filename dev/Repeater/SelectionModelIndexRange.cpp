@@ -0,0 +1,26 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ItemsRepeater.common.h"
+#include "SelectionModelIndexRange.h"
+
+SelectionModelIndexRange::SelectionModelIndexRange(const winrt::IndexPath& start, const winrt::IndexPath& end) :
+    m_start(start), m_end(end)
+{
+}
+
+#pragma region ISelectionModelIndexRange
+
+winrt::IndexPath SelectionModelIndexRange::Start()
+{
+    return m_start;
+}
+
+winrt::IndexPath SelectionModelIndexRange::End()
+{
+    return m_end;
+}
+
+#pragma endregion
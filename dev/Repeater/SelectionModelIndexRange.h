@@ -0,0 +1,23 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "SelectionModelIndexRange.g.h"
+
+// Inclusive range of sibling index paths [Start, End] that differ only in the last index.
+class SelectionModelIndexRange :
+    public winrt::implementation::SelectionModelIndexRangeT<SelectionModelIndexRange>
+{
+public:
+    SelectionModelIndexRange(const winrt::IndexPath& start, const winrt::IndexPath& end);
+
+#pragma region ISelectionModelIndexRange
+    winrt::IndexPath Start();
+    winrt::IndexPath End();
+#pragma endregion
+
+private:
+    winrt::IndexPath m_start{ nullptr };
+    winrt::IndexPath m_end{ nullptr };
+};
@@ -5,7 +5,35 @@
 #include "common.h"
 #include "ItemsRepeater.common.h"
 #include "SelectionModelSelectionChangedEventArgs.h"
+#include "Vector.h"
+
+SelectionModelSelectionChangedEventArgs::SelectionModelSelectionChangedEventArgs(
+    const winrt::IVectorView<winrt::SelectionModelIndexRange>& addedRanges,
+    const winrt::IVectorView<winrt::SelectionModelIndexRange>& removedRanges) :
+    m_addedRanges(addedRanges), m_removedRanges(removedRanges)
+{
+}
 
 #pragma region ISelectionModelSelectionChangedEventArgs
 
-#pragma endregion
\ No newline at end of file
+winrt::IVectorView<winrt::SelectionModelIndexRange> SelectionModelSelectionChangedEventArgs::AddedRanges()
+{
+    if (!m_addedRanges)
+    {
+        m_addedRanges = winrt::make<Vector<winrt::SelectionModelIndexRange>>().GetView();
+    }
+
+    return m_addedRanges;
+}
+
+winrt::IVectorView<winrt::SelectionModelIndexRange> SelectionModelSelectionChangedEventArgs::RemovedRanges()
+{
+    if (!m_removedRanges)
+    {
+        m_removedRanges = winrt::make<Vector<winrt::SelectionModelIndexRange>>().GetView();
+    }
+
+    return m_removedRanges;
+}
+
+#pragma endregion
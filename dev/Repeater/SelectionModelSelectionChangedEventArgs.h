@@ -9,4 +9,17 @@ class SelectionModelSelectionChangedEventArgs :
     public winrt::implementation::SelectionModelSelectionChangedEventArgsT<SelectionModelSelectionChangedEventArgs>
 {
 public:
-};
\ No newline at end of file
+    SelectionModelSelectionChangedEventArgs() = default;
+    SelectionModelSelectionChangedEventArgs(
+        const winrt::IVectorView<winrt::SelectionModelIndexRange>& addedRanges,
+        const winrt::IVectorView<winrt::SelectionModelIndexRange>& removedRanges);
+
+#pragma region ISelectionModelSelectionChangedEventArgs
+    winrt::IVectorView<winrt::SelectionModelIndexRange> AddedRanges();
+    winrt::IVectorView<winrt::SelectionModelIndexRange> RemovedRanges();
+#pragma endregion
+
+private:
+    winrt::IVectorView<winrt::SelectionModelIndexRange> m_addedRanges{ nullptr };
+    winrt::IVectorView<winrt::SelectionModelIndexRange> m_removedRanges{ nullptr };
+};
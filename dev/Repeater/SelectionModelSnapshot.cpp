@@ -0,0 +1,65 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "ItemsRepeater.common.h"
+#include "IndexPath.h"
+#include "SelectionModelIndexRange.h"
+#include "SelectionModelSnapshot.h"
+
+SelectionModelSnapshot::SelectionModelSnapshot(std::vector<Entry>&& entries) :
+    m_entries(std::move(entries))
+{
+    // Everything is created up front: the cost is proportional to the number of
+    // ranges, not to the number of selected items, and later reads don't have to
+    // synchronize with each other.
+    std::vector<winrt::SelectionModelIndexRange> ranges;
+    for (const auto& entry : m_entries)
+    {
+        for (const auto& range : entry.Ranges)
+        {
+            ranges.push_back(winrt::make<SelectionModelIndexRange>(
+                IndexPath::CreateFrom(entry.Path.CloneWithChildIndex(range.first)),
+                IndexPath::CreateFrom(entry.Path.CloneWithChildIndex(range.second))));
+        }
+        m_selectedCount += entry.Ranges.Count();
+    }
+    m_selectedRanges = winrt::single_threaded_vector(std::move(ranges)).GetView();
+}
+
+#pragma region ISelectionModelSnapshot
+
+winrt::IVectorView<winrt::SelectionModelIndexRange> SelectionModelSnapshot::SelectedRanges()
+{
+    return m_selectedRanges;
+}
+
+int64_t SelectionModelSnapshot::SelectedCount()
+{
+    return m_selectedCount;
+}
+
+bool SelectionModelSnapshot::IsSelectedAt(winrt::IndexPath const& index)
+{
+    if (!index)
+    {
+        throw winrt::hresult_invalid_argument(L"index");
+    }
+
+    const auto& path = IndexPath::GetPath(index);
+    if (path.GetSize() == 0)
+    {
+        return false;
+    }
+
+    const auto parentPath = path.Prefix(path.GetSize() - 1);
+    const auto it = std::lower_bound(m_entries.begin(), m_entries.end(), parentPath,
+        [](const Entry& entry, const FlatIndexPath& value) { return entry.Path.CompareTo(value) < 0; });
+
+    return it != m_entries.end() &&
+        it->Path.CompareTo(parentPath) == 0 &&
+        it->Ranges.Contains(path.GetAt(path.GetSize() - 1));
+}
+
+#pragma endregion
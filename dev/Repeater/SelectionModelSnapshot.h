@@ -0,0 +1,37 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "FlatIndexPath.h"
+#include "IndexRangeSet.h"
+
+#include "SelectionModelSnapshot.g.h"
+
+// Immutable copy of the selected index ranges of a SelectionModel. It does not reference the
+// source or the selection nodes and nothing in it changes after construction, so it can be
+// handed to and read from any thread.
+class SelectionModelSnapshot :
+    public winrt::implementation::SelectionModelSnapshotT<SelectionModelSnapshot>
+{
+public:
+    struct Entry
+    {
+        FlatIndexPath Path;
+        IndexRangeSet Ranges;
+    };
+
+    // Entries have to be in increasing Path order.
+    SelectionModelSnapshot(std::vector<Entry>&& entries);
+
+#pragma region ISelectionModelSnapshot
+    winrt::IVectorView<winrt::SelectionModelIndexRange> SelectedRanges();
+    int64_t SelectedCount();
+    bool IsSelectedAt(winrt::IndexPath const& index);
+#pragma endregion
+
+private:
+    std::vector<Entry> m_entries;
+    winrt::IVectorView<winrt::SelectionModelIndexRange> m_selectedRanges{ nullptr };
+    int64_t m_selectedCount{ 0 };
+};
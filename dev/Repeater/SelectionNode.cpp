@@ -43,7 +43,6 @@ void SelectionNode::Source(const winrt::IInspectable& value)
         m_dataSource.set(newDataSource);
 
         HookupCollectionChangedHandler();
-        OnSelectionChanged();
     }
 }
 
@@ -59,12 +58,12 @@ int SelectionNode::DataCount()
 
 int SelectionNode::ChildrenNodeCount()
 {
-    return static_cast<int>(m_childrenNodes.size());
+    return m_childrenNodes.Size();
 }
 
 int SelectionNode::RealizedChildrenNodeCount()
 {
-    return m_realizedChildrenNodeCount;
+    return m_childrenNodes.RealizedCount();
 }
 
 int SelectionNode::AnchorIndex()
@@ -80,27 +79,25 @@ void SelectionNode::AnchorIndex(int value)
 // For a genuine tree view, we dont know which node is leaf until we 
 // actually walk to it, so currently the tree builds up to the leaf. I don't 
 // create a bunch of leaf node instances - instead i use the same instance m_leafNode to avoid 
-// an explosion of node objects. However, I'm still creating the m_childrenNodes 
-// collection unfortunately.
+// an explosion of node objects. m_childrenNodes only stores the children that have
+// been realized, so unrealized slots do not cost anything.
 std::shared_ptr<SelectionNode> SelectionNode::GetAt(int index, bool realizeChild)
 {
     std::shared_ptr<SelectionNode> child = nullptr;
     if (realizeChild)
     {
-        if (m_childrenNodes.size() == 0)
+        if (m_childrenNodes.Size() == 0)
         {
             if (m_dataSource != nullptr)
             {
-                for (int i = 0; i < m_dataSource.get().Count(); i++)
-                {
-                    m_childrenNodes.emplace_back(nullptr);
-                }
+                m_childrenNodes.Initialize(m_dataSource.get().Count());
             }
         }
 
-        MUX_ASSERT(0 <= index && index <= static_cast<int>(m_childrenNodes.size()));
+        MUX_ASSERT(0 <= index && index < m_childrenNodes.Size());
 
-        if (m_childrenNodes.at(index) == nullptr)
+        child = m_childrenNodes.Get(index);
+        if (child == nullptr)
         {
             auto childData = m_dataSource.get().GetAt(index);
             if (childData != nullptr)
@@ -121,21 +118,12 @@ std::shared_ptr<SelectionNode> SelectionNode::GetAt(int index, bool realizeChild
                 child = m_manager->SharedLeafNode();
             }
 
-            m_childrenNodes[index] = child;
-            m_realizedChildrenNodeCount++;
-        }
-        else
-        {
-            child = m_childrenNodes[index];
+            m_childrenNodes.Set(index, child);
         }
     }
     else
     {
-        if (m_childrenNodes.size() > 0)
-        {
-            MUX_ASSERT(0 <= index && index <= static_cast<int>(m_childrenNodes.size()));
-            child = m_childrenNodes[index];
-        }
+        child = m_childrenNodes.Get(index);
     }
 
     return child;
@@ -143,22 +131,12 @@ std::shared_ptr<SelectionNode> SelectionNode::GetAt(int index, bool realizeChild
 
 int SelectionNode::SelectedCount()
 {
-    return m_selectedCount;
+    return m_selected.Count();
 }
 
 bool SelectionNode::IsSelected(int index)
 {
-    bool isSelected = false;
-    for (auto& range : m_selected)
-    {
-        if (range.Contains(index))
-        {
-            isSelected = true;
-            break;
-        }
-    }
-
-    return isSelected;
+    return m_selected.Contains(index);
 }
 
 // True  -> Selected
@@ -169,11 +147,9 @@ winrt::IReference<bool> SelectionNode::IsSelectedWithPartial()
     auto isSelected = winrt::PropertyValue::CreateBoolean(false).as<winrt::IReference<bool>>();
     if (m_parent)
     {
-        auto parentsChildren = m_parent->m_childrenNodes;
-        const auto it = std::find_if(parentsChildren.cbegin(), parentsChildren.cend(), [this](const std::shared_ptr<SelectionNode>& node) { return node.get() == this; });
-        if (it != parentsChildren.end())
+        const int myIndexInParent = m_parent->m_childrenNodes.IndexOf(this);
+        if (myIndexInParent != -1)
         {
-            auto myIndexInParent = static_cast<int>(it - parentsChildren.begin());
             isSelected = m_parent->IsSelectedWithPartial(myIndexInParent);
         }
     }
@@ -189,10 +165,9 @@ winrt::IReference<bool> SelectionNode::IsSelectedWithPartial(int index)
     SelectionState selectionState = SelectionState::NotSelected;
     MUX_ASSERT(index >= 0);
 
-    if (m_childrenNodes.size() == 0 || // no nodes realized
-        static_cast<int>(m_childrenNodes.size()) <= index || // target node is not realized 
-        !m_childrenNodes[index] || // target node is not realized
-        m_childrenNodes[index] == m_manager->SharedLeafNode())  // target node is a leaf node.
+    auto targetNode = m_childrenNodes.Get(index);
+    if (!targetNode || // target node is not realized
+        targetNode == m_manager->SharedLeafNode())  // target node is a leaf node.
     {
         // Ask parent if the target node is selected.
         selectionState = IsSelected(index) ? SelectionState::Selected : SelectionState::NotSelected;
@@ -202,7 +177,6 @@ winrt::IReference<bool> SelectionNode::IsSelectedWithPartial(int index)
         // targetNode is the node representing the index. This node is the parent. 
         // targetNode is a non-leaf node, containing one or many children nodes. Evaluate 
         // based on children of targetNode.
-        auto targetNode = m_childrenNodes[index];
         selectionState = targetNode->EvaluateIsSelectedBasedOnChildrenNodes();
     }
 
@@ -211,7 +185,7 @@ winrt::IReference<bool> SelectionNode::IsSelectedWithPartial(int index)
 
 int SelectionNode::SelectedIndex()
 {
-    return SelectedCount() > 0 ? SelectedIndices().at(0) : -1;
+    return m_selected.Empty() ? -1 : m_selected.begin()->first;
 }
 
 void SelectionNode::SelectedIndex(int value)
@@ -227,33 +201,36 @@ void SelectionNode::SelectedIndex(int value)
     }
 }
 
-std::vector<int> SelectionNode::SelectedIndices()
+int SelectionNode::SelectedIndexAt(int position)
+{
+    return m_selected.IndexAt(position);
+}
+
+bool SelectionNode::Select(int index, bool select)
 {
-    if (!m_selectedIndicesCacheIsValid)
+    if (IsValidIndex(index))
     {
-        m_selectedIndicesCacheIsValid = true;
-        for (auto& range : m_selected)
+        // Ignore duplicate selection calls
+        if (IsSelected(index) == select)
         {
-            for (int index = range.Begin(); index <= range.End(); index++)
-            {
-                // Avoid duplicates
-                if (std::find(m_selectedIndicesCached.begin(), m_selectedIndicesCached.end(), index) == m_selectedIndicesCached.end())
-                {
-                    m_selectedIndicesCached.emplace_back(index);
-                }
-            }
+            return true;
         }
 
-        // Sort the list for easy consumption
-        std::sort(m_selectedIndicesCached.begin(), m_selectedIndicesCached.end());
-    }
+        auto range = IndexRange(index, index);
 
-    return m_selectedIndicesCached;
-}
+        if (select)
+        {
+            AddRange(range);
+        }
+        else
+        {
+            RemoveRange(range);
+        }
 
-bool SelectionNode::Select(int index, bool select)
-{
-    return Select(index, select, true /* raiseOnSelectionChanged */);
+        return true;
+    }
+
+    return false;
 }
 
 bool SelectionNode::ToggleSelect(int index)
@@ -284,11 +261,11 @@ bool SelectionNode::SelectRange(const IndexRange& range, bool select)
     {
         if (select)
         {
-            AddRange(range, true /* raiseOnSelectionChanged */);
+            AddRange(range);
         }
         else
         {
-            RemoveRange(range, true /* raiseOnSelectionChanged */);
+            RemoveRange(range);
         }
 
         return true;
@@ -318,154 +295,29 @@ bool SelectionNode::IsValidIndex(int index)
     return (ItemsSourceView() == nullptr || (index >= 0 && index < ItemsSourceView().Count()));
 }
 
-void SelectionNode::AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged)
+void SelectionNode::AddRange(const IndexRange& addRange)
 {
-    // TODO: Check for duplicates (Task 14107720)
-    // TODO: Optimize by merging adjacent ranges (Task 14107720)
-
-    int oldCount = SelectedCount();
-
-    for (int i = addRange.Begin(); i <= addRange.End(); i++)
-    {
-        if (!IsSelected(i))
-        {
-            m_selectedCount++;
-        }
-    }
-
-    if (oldCount != m_selectedCount)
-    {
-        m_selected.emplace_back(addRange);
-
-        if (raiseOnSelectionChanged)
-        {
-            OnSelectionChanged();
-        }
-    }
+    // Overlapping and adjacent ranges are merged, so the cost is per range
+    // no matter how many indices it covers.
+    m_selected.Add(addRange);
 }
 
-void SelectionNode::RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged)
+void SelectionNode::RemoveRange(const IndexRange& removeRange)
 {
-    int oldCount = m_selectedCount;
-
-    // TODO: Prevent overlap of Ranges in _selected (Task 14107720)
-    for (int i = removeRange.Begin(); i <= removeRange.End(); i++)
-    {
-        if (IsSelected(i))
-        {
-            m_selectedCount--;
-        }
-    }
-
-    if (oldCount != m_selectedCount)
-    {
-        // Build up a both a list of Ranges to remove and ranges to add
-        std::vector<IndexRange> toRemove;
-        std::vector<IndexRange> toAdd;
-
-        for (IndexRange& range : m_selected)
-        {
-            // If this range intersects the remove range, we have to do something
-            if (removeRange.Intersects(range))
-            {
-                IndexRange before(-1, -1);
-                IndexRange cut(-1, -1);
-                IndexRange after(-1, -1);
-
-                // Intersection with the beginning of the range
-                //  Anything to the left of the point (exclusive) stays
-                //  Anything to the right of the point (inclusive) gets clipped
-                if (range.Contains(removeRange.Begin() - 1))
-                {
-                    range.Split(removeRange.Begin() - 1, before, cut);
-                    toAdd.emplace_back(before);
-                }
-
-                // Intersection with the end of the range
-                //  Anything to the left of the point (inclusive) gets clipped
-                //  Anything to the right of the point (exclusive) stays
-                if (range.Contains(removeRange.End()))
-                {
-                    if (range.Split(removeRange.End(), cut, after))
-                    {
-                        toAdd.emplace_back(after);
-                    }
-                }
-
-                // Remove this Range from the collection
-                // New ranges will be added for any remaining subsections
-                toRemove.emplace_back(range);
-            }
-        }
-
-        bool change = ((toRemove.size() > 0) || (toAdd.size() > 0));
-
-        if (change)
-        {
-            // Remove tagged ranges
-            for (IndexRange& remove : toRemove)
-            {
-                auto iter = std::find(m_selected.begin(), m_selected.end(), remove);
-                m_selected.erase(iter);
-            }
-
-            // Add new ranges
-            for (IndexRange& add : toAdd)
-            {
-                m_selected.emplace_back(add);
-            }
-
-            if (raiseOnSelectionChanged)
-            {
-                OnSelectionChanged();
-            }
-        }
-    }
+    // Ranges that straddle the removed range are trimmed or split in place.
+    m_selected.Remove(removeRange);
 }
 
 void SelectionNode::ClearSelection()
 {
     // Deselect all items
-    if (m_selected.size() > 0)
-    {
-        m_selected.clear();
-        OnSelectionChanged();
-    }
-
-    m_selectedCount = 0;
+    m_selected.Clear();
     AnchorIndex(-1);
 
     // This will throw away all the children SelectionNodes
     // causing them to be unhooked from their data source. This
     // essentially cleans up the tree.
-    m_childrenNodes.clear();
-}
-
-bool SelectionNode::Select(int index, bool select, bool raiseOnSelectionChanged)
-{
-    if (IsValidIndex(index))
-    {
-        // Ignore duplicate selection calls
-        if (IsSelected(index) == select)
-        {
-            return true;
-        }
-
-        auto range = IndexRange(index, index);
-
-        if (select)
-        {
-            AddRange(range, raiseOnSelectionChanged);
-        }
-        else
-        {
-            RemoveRange(range, raiseOnSelectionChanged);
-        }
-
-        return true;
-    }
-
-    return false;
+    m_childrenNodes.Clear();
 }
 
 void SelectionNode::OnSourceListChanged(const winrt::IInspectable& dataSource, const winrt::NotifyCollectionChangedEventArgs& args)
@@ -502,57 +354,21 @@ void SelectionNode::OnSourceListChanged(const winrt::IInspectable& dataSource, c
 
     if (selectionInvalidated)
     {
-        OnSelectionChanged();
         m_manager->OnSelectionInvalidatedDueToCollectionChange();
     }
 }
 
 bool SelectionNode::OnItemsAdded(int index, int count)
 {
-    bool selectionInvalidated = false;
-    // Update ranges for leaf items
-    std::vector<IndexRange> toAdd;
-    for (int i = 0; i < static_cast<int>(m_selected.size()); i++)
-    {
-        auto range = m_selected[i];
-
-        // The range is after the inserted items, need to shift the range right
-        if (range.End() >= index)
-        {
-            int begin = range.Begin();
-            // If the index left of newIndex is inside the range,
-            // Split the range and remember the left piece to add later
-            if (range.Contains(index - 1))
-            {
-                IndexRange before(-1, -1), after(-1, -1);
-                range.Split(index - 1, before, after);
-                toAdd.emplace_back(before);
-                begin = index;
-            }
-
-            // Shift the range to the right
-            m_selected[i] = IndexRange(begin + count, range.End() + count);
-            selectionInvalidated = true;
-        }
-    }
-
-    if (toAdd.size() > 0)
-    {
-        // Add the left sides of the split ranges
-        for (auto& add : toAdd)
-        {
-            m_selected.emplace_back(add);
-        }
-    }
+    // Update ranges for leaf items. Any range after the inserted items
+    // shifts right, a range spanning the insertion point is split.
+    bool selectionInvalidated = m_selected.OnItemsInserted(index, count);
 
     // Update for non-leaf if we are tracking non-leaf nodes
-    if (m_childrenNodes.size() > 0)
+    if (m_childrenNodes.Size() > 0)
     {
         selectionInvalidated = true;
-        for (int i = 0; i < count; i++)
-        {
-            m_childrenNodes.insert(m_childrenNodes.begin() + index, nullptr);
-        }
+        m_childrenNodes.Insert(index, count);
     }
 
     //Adjust the anchor
@@ -591,49 +407,15 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
     // Remove the items from the selection for leaf
     if (ItemsSourceView().Count() > 0)
     {
-        bool isSelected = false;
-        for (int i = index; i <= index + count - 1; i++)
-        {
-            if (IsSelected(i))
-            {
-                isSelected = true;
-                break;
-            }
-        }
-
-        if (isSelected)
-        {
-            RemoveRange(IndexRange(index, index + count - 1), false /* raiseOnSelectionChanged */);
-            selectionInvalidated = true;
-        }
-
-        for (int i = 0; i < static_cast<int>(m_selected.size()); i++)
-        {
-            auto range = m_selected[i];
-
-            // The range is after the removed items, need to shift the range left
-            if (range.End() > index)
-            {
-                MUX_ASSERT(!range.Contains(index));
-
-                // Shift the range to the left
-                m_selected[i] = IndexRange(range.Begin() - count, range.End() - count);
-                selectionInvalidated = true;
-            }
-        }
+        // Drop the removed items from the selection and shift the ranges
+        // after them to the left.
+        selectionInvalidated = m_selected.OnItemsRemoved(index, count);
 
         // Update for non-leaf if we are tracking non-leaf nodes
-        if (m_childrenNodes.size() > 0)
+        if (m_childrenNodes.Size() > 0)
         {
             selectionInvalidated = true;
-            for (int i = 0; i < count; i++)
-            {
-                if (m_childrenNodes[index])
-                {
-                    m_realizedChildrenNodeCount--;
-                }
-                m_childrenNodes.erase(m_childrenNodes.begin() + index);
-            }
+            m_childrenNodes.Erase(index, count);
         }
 
         //Adjust the anchor
@@ -646,7 +428,6 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
     {
         // No more items in the list, clear
         ClearSelection();
-        m_realizedChildrenNodeCount = 0;
         selectionInvalidated = true;
     }
 
@@ -674,12 +455,6 @@ bool SelectionNode::OnItemsRemoved(int index, int count)
     return selectionInvalidated;
 }
 
-void SelectionNode::OnSelectionChanged()
-{
-    m_selectedIndicesCacheIsValid = false;
-    m_selectedIndicesCached.clear();
-}
-
 /* static */
 winrt::IReference<bool> SelectionNode::ConvertToNullableBool(SelectionState isSelected)
 {
@@ -716,49 +491,47 @@ SelectionState SelectionNode::EvaluateIsSelectedBasedOnChildrenNodes()
         }
         else
         {
-            // There are child nodes, walk them individually and evaluate based on each child
-            // being selected/not selected or partially selected.
-            bool isSelected = false;
-            selectedCount = 0;
-            int notSelectedCount = 0;
-            for (int i = 0; i < ChildrenNodeCount(); i++)
+            // There are child nodes, walk the realized ones individually and evaluate based on
+            // each child being selected/not selected or partially selected. The children that
+            // are not realized are accounted for in bulk from the selected ranges.
+            int realizedSelectedCount = 0;
+            int realizedNotSelectedCount = 0;
+            int realizedInSelectedRangesCount = 0;
+            ForEachRealizedChild([&](int index, const std::shared_ptr<SelectionNode>&)
             {
-                if (auto child = GetAt(i, false /* realizeChild */))
+                if (selectionState == SelectionState::PartiallySelected)
                 {
-                    // child is realized, ask it.
-                    auto isChildSelected = IsSelectedWithPartial(i);
-                    if (isChildSelected == nullptr)
-                    {
-                        selectionState = SelectionState::PartiallySelected;
-                        break;
-                    }
-                    else if (isChildSelected.Value())
-                    {
-                        selectedCount++;
-                    }
-                    else
-                    {
-                        notSelectedCount++;
-                    }
+                    return;
+                }
+
+                auto isChildSelected = IsSelectedWithPartial(index);
+                if (isChildSelected == nullptr)
+                {
+                    selectionState = SelectionState::PartiallySelected;
+                }
+                else if (isChildSelected.Value())
+                {
+                    realizedSelectedCount++;
                 }
                 else
                 {
-                    // not realized.
-                    if (IsSelected(i))
-                    {
-                        selectedCount++;
-                    }
-                    else
-                    {
-                        notSelectedCount++;
-                    }
+                    realizedNotSelectedCount++;
                 }
 
-                if (selectedCount > 0 && notSelectedCount > 0)
+                if (IsSelected(index))
                 {
-                    selectionState = SelectionState::PartiallySelected;
-                    break;
+                    realizedInSelectedRangesCount++;
                 }
+            });
+
+            const int unrealizedCount = ChildrenNodeCount() - RealizedChildrenNodeCount();
+            const int unrealizedSelectedCount = SelectedCount() - realizedInSelectedRangesCount;
+            selectedCount = realizedSelectedCount + unrealizedSelectedCount;
+            const int notSelectedCount = realizedNotSelectedCount + (unrealizedCount - unrealizedSelectedCount);
+
+            if (selectedCount > 0 && notSelectedCount > 0)
+            {
+                selectionState = SelectionState::PartiallySelected;
             }
 
             if (selectionState != SelectionState::PartiallySelected)
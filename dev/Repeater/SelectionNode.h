@@ -3,6 +3,8 @@
 
 #pragma once
 #include "IndexRange.h"
+#include "IndexRangeSet.h"
+#include "SelectionNodeChildren.h"
 
 class SelectionModel;
 
@@ -33,14 +35,19 @@ public:
     int AnchorIndex();
     void AnchorIndex(int value);
     std::shared_ptr<SelectionNode> GetAt(int index, bool realizeChild);
+    // Calls action(index, child) for every realized child in increasing index order.
+    template <typename Action>
+    void ForEachRealizedChild(Action&& action) const { m_childrenNodes.ForEachRealized(std::forward<Action>(action)); }
 
     int SelectedCount();
+    const IndexRangeSet& SelectedRanges() const { return m_selected; }
     winrt::IReference<bool> IsSelectedWithPartial();
     winrt::IReference<bool> IsSelectedWithPartial(int index);
     bool IsSelected(int index);
     int SelectedIndex();
     void SelectedIndex(int value);
-    std::vector<int> SelectedIndices();
+    // Index of the selected item at the given position in the ordered selection.
+    int SelectedIndexAt(int position);
     bool Select(int index, bool select);
     bool ToggleSelect(int index);
     void SelectAll();
@@ -53,14 +60,12 @@ private:
     void HookupCollectionChangedHandler();
     void UnhookCollectionChangedHandler();
     bool IsValidIndex(int index);
-    void AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged);
-    void RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged);
+    void AddRange(const IndexRange& addRange);
+    void RemoveRange(const IndexRange& removeRange);
     void ClearSelection();
-    bool Select(int index, bool select, bool raiseOnSelectionChanged);
     void OnSourceListChanged(const winrt::IInspectable& dataSource, const winrt::NotifyCollectionChangedEventArgs& args);
     bool OnItemsAdded(int index, int count);
     bool OnItemsRemoved(int index, int count);
-    void OnSelectionChanged();
 
     SelectionModel* m_manager;
 
@@ -68,20 +73,16 @@ private:
     // chlidren containing leaf entries.
 
     // For inner nodes (any node whose children are data sources)
-    std::vector<std::shared_ptr<SelectionNode>> m_childrenNodes;
+    SelectionNodeChildren m_childrenNodes;
     // Don't take a ref.
     SelectionNode* m_parent { nullptr };
 
     // For parents of leaf nodes (any node whose children are not data sources)
-    std::vector<IndexRange> m_selected;
+    IndexRangeSet m_selected;
     
     tracker_ref<winrt::IInspectable> m_source;
     tracker_ref<winrt::ItemsSourceView> m_dataSource;
     winrt::event_token m_dataSourceChanged{};
 
-    int m_selectedCount{ 0 };
-    std::vector<int> m_selectedIndicesCached;
-    bool m_selectedIndicesCacheIsValid = false;
     int m_anchorIndex{ -1 };
-    int m_realizedChildrenNodeCount{ 0 };
 };
\ No newline at end of file
@@ -0,0 +1,146 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include <common.h>
+#include "SelectionNodeChildren.h"
+#include "SelectionNode.h"
+
+void SelectionNodeChildren::Initialize(int size)
+{
+    MUX_ASSERT(m_realizedCount == 0);
+    m_size = size;
+}
+
+void SelectionNodeChildren::Clear()
+{
+    m_sparseChildren.clear();
+    m_denseChildren.clear();
+    m_size = 0;
+    m_realizedCount = 0;
+    m_isDense = false;
+}
+
+std::shared_ptr<SelectionNode> SelectionNodeChildren::Get(int index) const
+{
+    std::shared_ptr<SelectionNode> child = nullptr;
+    if (index >= 0 && index < m_size)
+    {
+        if (m_isDense)
+        {
+            child = m_denseChildren[index];
+        }
+        else
+        {
+            const auto it = m_sparseChildren.find(index);
+            if (it != m_sparseChildren.end())
+            {
+                child = it->second;
+            }
+        }
+    }
+
+    return child;
+}
+
+void SelectionNodeChildren::Set(int index, const std::shared_ptr<SelectionNode>& child)
+{
+    MUX_ASSERT(index >= 0 && index < m_size);
+
+    if (m_isDense)
+    {
+        auto& slot = m_denseChildren[index];
+        m_realizedCount += (child != nullptr) - (slot != nullptr);
+        slot = child;
+    }
+    else if (child)
+    {
+        auto& slot = m_sparseChildren[index];
+        m_realizedCount += (slot == nullptr);
+        slot = child;
+        SwitchToDenseIfNeeded();
+    }
+    else
+    {
+        m_realizedCount -= static_cast<int>(m_sparseChildren.erase(index));
+    }
+}
+
+int SelectionNodeChildren::IndexOf(const SelectionNode* child) const
+{
+    int index = -1;
+    ForEachRealized([&index, child](int i, const std::shared_ptr<SelectionNode>& node)
+    {
+        if (index == -1 && node.get() == child)
+        {
+            index = i;
+        }
+    });
+
+    return index;
+}
+
+void SelectionNodeChildren::Insert(int index, int count)
+{
+    m_size += count;
+
+    if (m_isDense)
+    {
+        m_denseChildren.insert(m_denseChildren.begin() + index, count, nullptr);
+    }
+    else
+    {
+        // Keys are immutable, so the children after the insertion point are re-keyed.
+        // Their order does not change, so every insert is at the end.
+        auto first = m_sparseChildren.lower_bound(index);
+        std::vector<std::pair<int, std::shared_ptr<SelectionNode>>> shifted(first, m_sparseChildren.end());
+        m_sparseChildren.erase(first, m_sparseChildren.end());
+        for (auto& entry : shifted)
+        {
+            m_sparseChildren.emplace_hint(m_sparseChildren.end(), entry.first + count, std::move(entry.second));
+        }
+    }
+}
+
+void SelectionNodeChildren::Erase(int index, int count)
+{
+    m_size -= count;
+
+    if (m_isDense)
+    {
+        const auto first = m_denseChildren.begin() + index;
+        const auto last = first + count;
+        m_realizedCount -= static_cast<int>(std::count_if(first, last, [](const std::shared_ptr<SelectionNode>& node) { return node != nullptr; }));
+        m_denseChildren.erase(first, last);
+    }
+    else
+    {
+        auto first = m_sparseChildren.lower_bound(index);
+        auto last = m_sparseChildren.lower_bound(index + count);
+        m_realizedCount -= static_cast<int>(std::distance(first, last));
+        m_sparseChildren.erase(first, last);
+
+        auto tail = m_sparseChildren.lower_bound(index + count);
+        std::vector<std::pair<int, std::shared_ptr<SelectionNode>>> shifted(tail, m_sparseChildren.end());
+        m_sparseChildren.erase(tail, m_sparseChildren.end());
+        for (auto& entry : shifted)
+        {
+            m_sparseChildren.emplace_hint(m_sparseChildren.end(), entry.first - count, std::move(entry.second));
+        }
+    }
+}
+
+void SelectionNodeChildren::SwitchToDenseIfNeeded()
+{
+    if (m_realizedCount * DenseRealizationRatio > m_size)
+    {
+        m_denseChildren.resize(m_size, nullptr);
+        for (auto& entry : m_sparseChildren)
+        {
+            m_denseChildren[entry.first] = std::move(entry.second);
+        }
+
+        m_sparseChildren.clear();
+        m_isDense = true;
+    }
+}
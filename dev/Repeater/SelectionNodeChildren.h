@@ -0,0 +1,68 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class SelectionNode;
+
+// Child node slots of a SelectionNode, one per item in its data source.
+// Only realized children take up memory: they are kept in a map keyed by index
+// until enough of the slots are realized that a dense vector is cheaper, at which
+// point the storage switches to dense mode until it is cleared. Unrealized slots
+// read back as null either way.
+class SelectionNodeChildren final
+{
+public:
+    // Number of slots, zero until Initialize is called.
+    int Size() const { return m_size; }
+    int RealizedCount() const { return m_realizedCount; }
+    bool IsDense() const { return m_isDense; }
+
+    void Initialize(int size);
+    void Clear();
+
+    std::shared_ptr<SelectionNode> Get(int index) const;
+    void Set(int index, const std::shared_ptr<SelectionNode>& child);
+    // Index of the given realized child or -1.
+    int IndexOf(const SelectionNode* child) const;
+
+    // Adjust the slots for items inserted into or removed from the source.
+    void Insert(int index, int count);
+    void Erase(int index, int count);
+
+    // Calls action(index, child) for every realized child in increasing index order.
+    template <typename Action>
+    void ForEachRealized(Action&& action) const
+    {
+        if (m_isDense)
+        {
+            for (int i = 0; i < static_cast<int>(m_denseChildren.size()); i++)
+            {
+                if (const auto& child = m_denseChildren[i])
+                {
+                    action(i, child);
+                }
+            }
+        }
+        else
+        {
+            for (const auto& entry : m_sparseChildren)
+            {
+                action(entry.first, entry.second);
+            }
+        }
+    }
+
+private:
+    void SwitchToDenseIfNeeded();
+
+    // Once more than 1/DenseRealizationRatio of the slots are realized the
+    // per entry overhead of the map outweighs a vector of empty slots.
+    static constexpr int DenseRealizationRatio = 4;
+
+    std::map<int, std::shared_ptr<SelectionNode>> m_sparseChildren;
+    std::vector<std::shared_ptr<SelectionNode>> m_denseChildren;
+    int m_size{ 0 };
+    int m_realizedCount{ 0 };
+    bool m_isDense{ false };
+};
@@ -6,14 +6,13 @@
 #include "ItemsRepeater.common.h"
 #include "SelectionNode.h"
 #include "SelectionTreeHelper.h"
-#include "IndexPath.h"
 
 // static
 void SelectionTreeHelper::TraverseIndexPath(
     std::shared_ptr<SelectionNode> root,
-    const winrt::IndexPath& path,
+    const FlatIndexPath& path,
     bool realizeChildren,
-    std::function<void(std::shared_ptr<SelectionNode>, const winrt::IndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction)
+    std::function<void(std::shared_ptr<SelectionNode>, const FlatIndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction)
 {
     auto node = root;
     for (int depth = 0; depth < path.GetSize(); depth++)
@@ -35,23 +34,34 @@ void SelectionTreeHelper::Traverse(
     std::function<void(const TreeWalkNodeInfo&)> nodeAction)
 {
     auto pendingNodes = std::vector<TreeWalkNodeInfo>();
-    auto current = winrt::make<IndexPath>(nullptr);
-    pendingNodes.push_back(TreeWalkNodeInfo(root, current));
+    pendingNodes.push_back(TreeWalkNodeInfo(root, FlatIndexPath{}));
 
     while (pendingNodes.size() > 0)
     {
-        auto nextNode = pendingNodes.back();
+        auto nextNode = std::move(pendingNodes.back());
         pendingNodes.pop_back();
-        int count = realizeChildren ? nextNode.Node->DataCount() : nextNode.Node->ChildrenNodeCount();
-        for (int i = count - 1; i >= 0; i--)
+        if (realizeChildren)
         {
-            std::shared_ptr<SelectionNode> child = nextNode.Node->GetAt(i, realizeChildren);
-            auto childPath = winrt::get_self<IndexPath>(nextNode.Path)->CloneWithChildIndex(i);
-            if (child != nullptr)
+            for (int i = nextNode.Node->DataCount() - 1; i >= 0; i--)
             {
-                pendingNodes.push_back(TreeWalkNodeInfo(child, childPath, nextNode.Node));
+                std::shared_ptr<SelectionNode> child = nextNode.Node->GetAt(i, realizeChildren);
+                if (child != nullptr)
+                {
+                    pendingNodes.push_back(TreeWalkNodeInfo(child, nextNode.Path.CloneWithChildIndex(i), nextNode.Node));
+                }
             }
         }
+        else
+        {
+            // Only visit the children that are already realized instead of every slot.
+            // They come in increasing order, reverse them so the walk stays in order.
+            const auto firstChild = pendingNodes.size();
+            nextNode.Node->ForEachRealizedChild([&pendingNodes, &nextNode](int i, const std::shared_ptr<SelectionNode>& child)
+            {
+                pendingNodes.push_back(TreeWalkNodeInfo(child, nextNode.Path.CloneWithChildIndex(i), nextNode.Node));
+            });
+            std::reverse(pendingNodes.begin() + firstChild, pendingNodes.end());
+        }
 
         // Queue the children first and then perform the action. This way
         // the action can remove the children in the action if necessary
@@ -63,14 +73,13 @@ void SelectionTreeHelper::Traverse(
 // static 
 void SelectionTreeHelper::TraverseRangeRealizeChildren(
     std::shared_ptr<SelectionNode> root,
-    const winrt::IndexPath& start,
-    const winrt::IndexPath& end,
+    const FlatIndexPath& start,
+    const FlatIndexPath& end,
     std::function<void(const TreeWalkNodeInfo&)> nodeAction)
 {
     MUX_ASSERT(start.CompareTo(end) == -1);
 
     auto pendingNodes = std::vector<TreeWalkNodeInfo>();
-    winrt::IndexPath current = start;
 
     // Build up the stack to account for the depth first walk up to the 
     // start index path.
@@ -78,11 +87,11 @@ void SelectionTreeHelper::TraverseRangeRealizeChildren(
         root,
         start,
         true, /* realizeChildren */
-        [&start, &end, &pendingNodes](std::shared_ptr<SelectionNode> node, const winrt::IndexPath& path, int depth, int childIndex)
+        [&start, &end, &pendingNodes](std::shared_ptr<SelectionNode> node, const FlatIndexPath& path, int depth, int childIndex)
     {
-        auto currentPath = StartPath(path, depth);
-        bool isStartPath = IsSubSet(start, currentPath);
-        bool isEndPath = IsSubSet(end, currentPath);
+        auto currentPath = path.Prefix(depth);
+        bool isStartPath = start.StartsWith(currentPath);
+        bool isEndPath = end.StartsWith(currentPath);
 
         int startIndex = depth < start.GetSize() && isStartPath ? start.GetAt(depth) : 0;
         int endIndex = depth < end.GetSize() && isEndPath ? end.GetAt(depth) : node->DataCount() - 1;
@@ -92,8 +101,7 @@ void SelectionTreeHelper::TraverseRangeRealizeChildren(
             auto child = node->GetAt(i, true /* realizeChild */);
             if (child)
             {
-                auto childPath = winrt::get_self<IndexPath>(currentPath)->CloneWithChildIndex(i);
-                pendingNodes.push_back(TreeWalkNodeInfo(child, childPath, node));
+                pendingNodes.push_back(TreeWalkNodeInfo(child, currentPath.CloneWithChildIndex(i), node));
             }
         }
     });
@@ -102,11 +110,11 @@ void SelectionTreeHelper::TraverseRangeRealizeChildren(
     // current path is less than the end path.
     while (pendingNodes.size() > 0)
     {
-        auto info = pendingNodes.back();
+        auto info = std::move(pendingNodes.back());
         pendingNodes.pop_back();
         int depth = info.Path.GetSize();
-        bool isStartPath = IsSubSet(start, info.Path);
-        bool isEndPath = IsSubSet(end, info.Path);
+        bool isStartPath = start.StartsWith(info.Path);
+        bool isEndPath = end.StartsWith(info.Path);
         int startIndex = depth < start.GetSize() && isStartPath ? start.GetAt(depth) : 0;
         int endIndex = depth < end.GetSize() && isEndPath ? end.GetAt(depth) : info.Node->DataCount() - 1;
         for (int i = endIndex; i >= startIndex; i--)
@@ -114,8 +122,7 @@ void SelectionTreeHelper::TraverseRangeRealizeChildren(
             auto child = info.Node->GetAt(i, true /* realizeChild */);
             if (child)
             {
-                auto childPath = winrt::get_self<IndexPath>(info.Path)->CloneWithChildIndex(i);
-                pendingNodes.push_back(TreeWalkNodeInfo(child, childPath, info.Node));
+                pendingNodes.push_back(TreeWalkNodeInfo(child, info.Path.CloneWithChildIndex(i), info.Node));
             }
         }
 
@@ -128,29 +135,3 @@ void SelectionTreeHelper::TraverseRangeRealizeChildren(
         }
     }
 }
-
-// static 
-bool SelectionTreeHelper::IsSubSet(const winrt::IndexPath& path, const winrt::IndexPath& subset)
-{
-    bool isSubset = true;
-    for (int i = 0; i < subset.GetSize(); i++)
-    {
-        isSubset = path.GetAt(i) == subset.GetAt(i);
-        if (!isSubset)
-            break;
-    }
-
-    return isSubset;
-}
-
-// static 
-winrt::IndexPath SelectionTreeHelper::StartPath(const winrt::IndexPath& path, int length)
-{
-    std::vector<int> subPath;
-    for (int i = 0; i < length; i++)
-    {
-        subPath.emplace_back(path.GetAt(i));
-    }
-
-    return winrt::make<IndexPath>(subPath);
-}
\ No newline at end of file
@@ -3,26 +3,28 @@
 
 #pragma once
 
+#include "FlatIndexPath.h"
+
 class SelectionTreeHelper
 {
 public:
     struct TreeWalkNodeInfo
     {
-        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, const winrt::IndexPath& indexPath, std::shared_ptr<SelectionNode> parent)
+        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, const FlatIndexPath& indexPath, std::shared_ptr<SelectionNode> parent)
             : Node(node), Path(indexPath), ParentNode(parent) {}
-        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, const winrt::IndexPath& indexPath)
+        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, const FlatIndexPath& indexPath)
             : Node(node), Path(indexPath), ParentNode(nullptr) {}
 
         std::shared_ptr<SelectionNode> Node;
-        winrt::IndexPath Path;
+        FlatIndexPath Path;
         std::shared_ptr<SelectionNode> ParentNode;
     };
 
     static void TraverseIndexPath(
         std::shared_ptr<SelectionNode> root,
-        const winrt::IndexPath& path,
+        const FlatIndexPath& path,
         bool realizeChildren,
-        std::function<void(std::shared_ptr<SelectionNode>, const winrt::IndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction);
+        std::function<void(std::shared_ptr<SelectionNode>, const FlatIndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction);
 
     static void Traverse(
         std::shared_ptr<SelectionNode> root,
@@ -31,11 +33,7 @@ public:
 
     static void TraverseRangeRealizeChildren(
         std::shared_ptr<SelectionNode> root,
-        const winrt::IndexPath& start,
-        const winrt::IndexPath& end,
+        const FlatIndexPath& start,
+        const FlatIndexPath& end,
         std::function<void(const TreeWalkNodeInfo&)> nodeAction);
-
-private:
-    static bool IsSubSet(const winrt::IndexPath& path, const winrt::IndexPath& subset);
-    static winrt::IndexPath StartPath(const winrt::IndexPath& path, int length);
 };
@@ -38,6 +38,26 @@ void StackLayout::Spacing(double value)
     SetValue(s_spacingProperty, box_value(value));
 }
 
+bool StackLayout::IsMeasuredSizeCacheEnabled()
+{
+    return m_isMeasuredSizeCacheEnabled;
+}
+
+void StackLayout::IsMeasuredSizeCacheEnabled(bool value)
+{
+    SetValue(s_isMeasuredSizeCacheEnabledProperty, box_value(value));
+}
+
+winrt::IItemSizeProvider StackLayout::ItemSizeProvider()
+{
+    return m_itemSizeProvider.get();
+}
+
+void StackLayout::ItemSizeProvider(winrt::IItemSizeProvider const& value)
+{
+    SetValue(s_itemSizeProviderProperty, value);
+}
+
 #pragma endregion
 
 #pragma region IVirtualizingLayoutOverrides
@@ -76,6 +96,17 @@ winrt::Size StackLayout::MeasureOverride(
     winrt::VirtualizingLayoutContext const& context,
     winrt::Size const& availableSize)
 {
+    const auto stackState = GetAsStackState(context.LayoutState());
+    if (!UsesMeasuredSizes())
+    {
+        // Drop whatever was cached while the cache was enabled, it is not kept up to date anymore.
+        stackState->MeasuredSizes().Clear();
+    }
+    else if (m_itemSizeProvider)
+    {
+        EnsureProvidedItemSizes(context, stackState);
+    }
+
     auto desiredSize = GetFlowAlgorithm(context).Measure(
         availableSize,
         context,
@@ -108,6 +139,10 @@ void StackLayout::OnItemsChangedCore(
     winrt::NotifyCollectionChangedEventArgs const& args)
 {
     GetFlowAlgorithm(context).OnDataSourceChanged(source, args, context);
+    if (UsesMeasuredSizes())
+    {
+        GetAsStackState(context.LayoutState())->OnItemsChanged(args);
+    }
     // Always invalidate layout to keep the view accurate.
     InvalidateLayout();
 }
@@ -134,13 +169,13 @@ winrt::FlowLayoutAnchorInfo StackLayout::GetAnchorForRealizationRect(
 
         const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
         const double realizationWindowOffsetInExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
-        const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, averageElementSize * itemsCount - m_itemSpacing) : lastExtent.*MajorSize();
+        const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, GetOffsetFromIndex(itemsCount, averageElementSize, state) - m_itemSpacing) : lastExtent.*MajorSize();
         if (itemsCount > 0 &&
             realizationRect.*MajorSize() > 0 &&
             realizationWindowOffsetInExtent + realizationRect.*MajorSize() >= 0 && realizationWindowOffsetInExtent <= majorSize)
         {
-            anchorIndex = (int)(realizationWindowOffsetInExtent / averageElementSize);
-            offset = anchorIndex * averageElementSize + lastExtent.*MajorStart();
+            anchorIndex = GetIndexFromOffset(realizationWindowOffsetInExtent, averageElementSize, state);
+            offset = GetOffsetFromIndex(anchorIndex, averageElementSize, state) + lastExtent.*MajorStart();
             anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
         }
     }
@@ -168,15 +203,25 @@ winrt::Rect StackLayout::GetExtent(
     const double averageElementSize = GetAverageElementSize(availableSize, context, stackState) + m_itemSpacing;
 
     extent.*MinorSize() = static_cast<float>(stackState->MaxArrangeBounds());
-    extent.*MajorSize() = std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - m_itemSpacing));
+    extent.*MajorSize() = std::max(0.0f, static_cast<float>(GetOffsetFromIndex(itemsCount, averageElementSize, stackState) - m_itemSpacing));
     if (itemsCount > 0)
     {
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
-            extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - firstRealizedItemIndex * averageElementSize);
-            auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
-            extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingItems* averageElementSize);
+            extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - GetOffsetFromIndex(firstRealizedItemIndex, averageElementSize, stackState));
+            if (UsesMeasuredSizes())
+            {
+                const double remainingSize =
+                    GetOffsetFromIndex(itemsCount, averageElementSize, stackState) -
+                    GetOffsetFromIndex(lastRealizedItemIndex + 1, averageElementSize, stackState);
+                extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingSize);
+            }
+            else
+            {
+                auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
+                extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingItems* averageElementSize);
+            }
         }
         else
         {
@@ -213,6 +258,12 @@ void StackLayout::OnElementMeasured(
             index,
             provisionalArrangeSizeWinRt.*Major(),
             provisionalArrangeSizeWinRt.*Minor());
+
+        // Sizes that come from the ItemSizeProvider win over what the element measured to.
+        if (m_isMeasuredSizeCacheEnabled && !m_itemSizeProvider)
+        {
+            stackState->MeasuredSizes().SetSize(index, provisionalArrangeSizeWinRt.*Major());
+        }
     }
 }
 
@@ -261,7 +312,7 @@ winrt::FlowLayoutAnchorInfo StackLayout::Algorithm_GetAnchorForTargetElement(
         index = targetIndex;
         const auto state = GetAsStackState(context.LayoutState());
         const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
-        offset = index * averageElementSize + state->FlowAlgorithm().LastExtent().*MajorStart();
+        offset = GetOffsetFromIndex(index, averageElementSize, state) + state->FlowAlgorithm().LastExtent().*MajorStart();
     }
 
     return winrt::FlowLayoutAnchorInfo{ index, offset };
@@ -325,12 +376,91 @@ void StackLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventA
     {
         m_itemSpacing = unbox_value<double>(args.NewValue());
     }
+    else if (property == s_isMeasuredSizeCacheEnabledProperty)
+    {
+        m_isMeasuredSizeCacheEnabled = unbox_value<bool>(args.NewValue());
+    }
+    else if (property == s_itemSizeProviderProperty)
+    {
+        m_itemSizeProvider.set(args.NewValue().try_as<winrt::IItemSizeProvider>());
+        ++m_itemSizeProviderVersion;
+    }
 
     InvalidateLayout();
 }
 
 #pragma region private helpers
 
+void StackLayout::EnsureProvidedItemSizes(
+    const winrt::VirtualizingLayoutContext& context,
+    const winrt::com_ptr<StackLayoutState>& stackLayoutState)
+{
+    auto& measuredSizes = stackLayoutState->MeasuredSizes();
+    if (stackLayoutState->ItemSizeProviderVersion() != m_itemSizeProviderVersion)
+    {
+        // Sizes we have were measured or came from a different provider.
+        measuredSizes.Clear();
+        stackLayoutState->ItemSizeProviderVersion(m_itemSizeProviderVersion);
+    }
+
+    const int itemsCount = context.ItemCount();
+    if (measuredSizes.Count() >= itemsCount && measuredSizes.MeasuredCount() >= itemsCount)
+    {
+        return;
+    }
+
+    auto provider = m_itemSizeProvider.get();
+    std::vector<double> sizes;
+    int startIndex = measuredSizes.NextUnmeasured(0, itemsCount);
+    while (startIndex < itemsCount)
+    {
+        const int endIndex = measuredSizes.NextMeasured(startIndex, itemsCount);
+        const int count = endIndex - startIndex;
+        const auto providedSizes = provider.GetItemSizes(startIndex, count);
+        const int providedCount = providedSizes ? static_cast<int>(std::min(providedSizes.Size(), static_cast<uint32_t>(count))) : 0;
+
+        sizes.resize(providedCount);
+        if (providedCount > 0)
+        {
+            providedSizes.GetMany(0, sizes);
+        }
+
+        for (const double size : sizes)
+        {
+            if (!std::isfinite(size) || size < 0)
+            {
+                throw winrt::hresult_invalid_argument(L"ItemSizeProvider returned an invalid size.");
+            }
+        }
+
+        measuredSizes.SetSizes(startIndex, sizes);
+
+        if (providedCount < count)
+        {
+            // The provider does not know about the rest, those items get estimated.
+            break;
+        }
+
+        startIndex = measuredSizes.NextUnmeasured(endIndex, itemsCount);
+    }
+}
+
+winrt::Rect StackLayout::GetEstimatedItemBounds(int index, const winrt::VirtualizingLayoutContext& context)
+{
+    const auto state = GetAsStackState(context.LayoutState());
+    const double averageElementSize = GetAverageElementSize(state->FlowAlgorithm().LastAvailableSize(), context, state) + m_itemSpacing;
+
+    // Elements are arranged relative to the start of the extent, so are these bounds.
+    const double start = GetOffsetFromIndex(index, averageElementSize, state);
+    const double end = GetOffsetFromIndex(index + 1, averageElementSize, state) - m_itemSpacing;
+
+    winrt::Rect bounds{};
+    bounds.*MajorStart() = static_cast<float>(start);
+    bounds.*MajorSize() = static_cast<float>(std::max(0.0, end - start));
+    bounds.*MinorSize() = static_cast<float>(state->MaxArrangeBounds());
+    return bounds;
+}
+
 double StackLayout::GetAverageElementSize(
     winrt::Size availableSize,
     winrt::VirtualizingLayoutContext context,
@@ -340,6 +470,15 @@ double StackLayout::GetAverageElementSize(
     
     if (context.ItemCount() > 0)
     {
+        if (stackLayoutState->TotalElementsMeasured() == 0 &&
+            m_itemSizeProvider &&
+            stackLayoutState->MeasuredSizes().MeasuredCount() > 0)
+        {
+            // No need to realize an element just to get a size to estimate with.
+            const auto& measuredSizes = stackLayoutState->MeasuredSizes();
+            return round(measuredSizes.MeasuredTotal() / measuredSizes.MeasuredCount());
+        }
+
         if (stackLayoutState->TotalElementsMeasured() == 0)
         {
             const auto tmpElement = context.GetOrCreateElementAt(0, winrt::ElementRealizationOptions::ForceCreate | winrt::ElementRealizationOptions::SuppressAutoRecycle);
@@ -354,4 +493,24 @@ double StackLayout::GetAverageElementSize(
     return averageElementSize;
 }
 
+double StackLayout::GetOffsetFromIndex(
+    int index,
+    double averageElementSize,
+    const winrt::com_ptr<StackLayoutState>& stackLayoutState)
+{
+    return UsesMeasuredSizes() ?
+        stackLayoutState->MeasuredSizes().OffsetFromIndex(index, averageElementSize - m_itemSpacing, m_itemSpacing) :
+        index * averageElementSize;
+}
+
+int StackLayout::GetIndexFromOffset(
+    double offset,
+    double averageElementSize,
+    const winrt::com_ptr<StackLayoutState>& stackLayoutState)
+{
+    return UsesMeasuredSizes() ?
+        stackLayoutState->MeasuredSizes().IndexFromOffset(offset, averageElementSize - m_itemSpacing, m_itemSpacing) :
+        (int)(offset / averageElementSize);
+}
+
 #pragma endregion
\ No newline at end of file
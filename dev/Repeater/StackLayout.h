@@ -23,6 +23,12 @@ public:
 
     double Spacing();
     void Spacing(double value);
+
+    bool IsMeasuredSizeCacheEnabled();
+    void IsMeasuredSizeCacheEnabled(bool value);
+
+    winrt::IItemSizeProvider ItemSizeProvider();
+    void ItemSizeProvider(winrt::IItemSizeProvider const& value);
 #pragma endregion
 
 #pragma region IVirtualizingLayoutOverrides
@@ -101,11 +107,19 @@ public:
 
     void OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args);
 
+    // Where the item is expected to be, relative to the owner, from the measured sizes and the
+    // average. Lets ItemsRepeater::ScrollToIndex go to an item without realizing it first.
+    winrt::Rect GetEstimatedItemBounds(int index, const winrt::VirtualizingLayoutContext& context);
+
     static winrt::DependencyProperty OrientationProperty() { return s_orientationProperty; }
     static winrt::DependencyProperty SpacingProperty() { return s_spacingProperty; }
+    static winrt::DependencyProperty IsMeasuredSizeCacheEnabledProperty() { return s_isMeasuredSizeCacheEnabledProperty; }
+    static winrt::DependencyProperty ItemSizeProviderProperty() { return s_itemSizeProviderProperty; }
 
     static GlobalDependencyProperty s_orientationProperty;
     static GlobalDependencyProperty s_spacingProperty;
+    static GlobalDependencyProperty s_isMeasuredSizeCacheEnabledProperty;
+    static GlobalDependencyProperty s_itemSizeProviderProperty;
 
     static void EnsureProperties();
     static void ClearProperties();
@@ -116,11 +130,32 @@ private:
         const winrt::DependencyPropertyChangedEventArgs& args);
 
 private:
+    // Item sizes are tracked per index either because they are cached as elements get
+    // measured or because the app provides them.
+    bool UsesMeasuredSizes() { return m_isMeasuredSizeCacheEnabled || m_itemSizeProvider; }
+
+    // Asks the ItemSizeProvider for the sizes of the items we don't know about yet, one
+    // call per range of unknown items.
+    void EnsureProvidedItemSizes(
+        const winrt::VirtualizingLayoutContext& context,
+        const winrt::com_ptr<StackLayoutState>& layoutState);
+
     double GetAverageElementSize(
         winrt::Size availableSize,
         winrt::VirtualizingLayoutContext context,
         const winrt::com_ptr<StackLayoutState>& layoutState);
 
+    // Offset of the item at index from the start of the extent. averageElementSize
+    // includes the spacing.
+    double GetOffsetFromIndex(
+        int index,
+        double averageElementSize,
+        const winrt::com_ptr<StackLayoutState>& layoutState);
+    int GetIndexFromOffset(
+        double offset,
+        double averageElementSize,
+        const winrt::com_ptr<StackLayoutState>& layoutState);
+
     winrt::com_ptr<StackLayoutState> GetAsStackState(const winrt::IInspectable& state)
     {
         return winrt::get_self<StackLayoutState>(state.as<winrt::StackLayoutState>())->get_strong();
@@ -138,6 +173,10 @@ private:
 
     // Fields
     double m_itemSpacing{};
+    bool m_isMeasuredSizeCacheEnabled{};
+    tracker_ref<winrt::IItemSizeProvider> m_itemSizeProvider{ this };
+    // Bumped whenever ItemSizeProvider changes so that sizes from the old one get dropped.
+    unsigned m_itemSizeProviderVersion{ 0u };
 
     // !!! WARNING !!!
     // Any storage here needs to be related to layout configuration. 
@@ -11,6 +11,8 @@
 
 GlobalDependencyProperty StackLayout::s_orientationProperty{ nullptr };
 GlobalDependencyProperty StackLayout::s_spacingProperty{ nullptr };
+GlobalDependencyProperty StackLayout::s_isMeasuredSizeCacheEnabledProperty{ nullptr };
+GlobalDependencyProperty StackLayout::s_itemSizeProviderProperty{ nullptr };
 
 /* static */
 void StackLayout::EnsureProperties()
@@ -38,6 +40,30 @@ void StackLayout::EnsureProperties()
                 box_value(0.0), /* defaultValue */
                 winrt::PropertyChangedCallback(&StackLayout::OnPropertyChanged));
     }
+
+    if (!s_isMeasuredSizeCacheEnabledProperty)
+    {
+        s_isMeasuredSizeCacheEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsMeasuredSizeCacheEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::StackLayout>(),
+                false /* isAttached */,
+                box_value(false), /* defaultValue */
+                winrt::PropertyChangedCallback(&StackLayout::OnPropertyChanged));
+    }
+
+    if (!s_itemSizeProviderProperty)
+    {
+        s_itemSizeProviderProperty =
+            InitializeDependencyProperty(
+                L"ItemSizeProvider",
+                winrt::name_of<winrt::IItemSizeProvider>(),
+                winrt::name_of<winrt::StackLayout>(),
+                false /* isAttached */,
+                nullptr, /* defaultValue */
+                winrt::PropertyChangedCallback(&StackLayout::OnPropertyChanged));
+    }
 }
 
 /*static*/
@@ -45,6 +71,8 @@ void StackLayout::ClearProperties()
 {
     s_orientationProperty = nullptr;
     s_spacingProperty = nullptr;
+    s_isMeasuredSizeCacheEnabledProperty = nullptr;
+    s_itemSizeProviderProperty = nullptr;
 }
 
 void StackLayout::OnPropertyChanged(
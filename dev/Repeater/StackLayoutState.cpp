@@ -43,7 +43,39 @@ void StackLayoutState::OnElementMeasured(int elementIndex, double majorSize, dou
     m_maxArrangeBounds = std::max(m_maxArrangeBounds, minorSize);
 }
 
+void StackLayoutState::CopyEstimatesFrom(const StackLayoutState& other)
+{
+    m_estimationBuffer = other.m_estimationBuffer;
+    m_totalElementSize = other.m_totalElementSize;
+    m_totalElementsMeasured = other.m_totalElementsMeasured;
+    m_measuredSizes = other.m_measuredSizes;
+}
+
 void StackLayoutState::OnArrangeLayoutEnd()
 {
     m_maxArrangeBounds = 0.0;
+}
+
+void StackLayoutState::OnItemsChanged(const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    switch (args.Action())
+    {
+    case winrt::NotifyCollectionChangedAction::Add:
+        m_measuredSizes.Insert(args.NewStartingIndex(), args.NewItems().Size());
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Replace:
+        m_measuredSizes.Remove(args.OldStartingIndex(), args.OldItems().Size());
+        m_measuredSizes.Insert(args.NewStartingIndex(), args.NewItems().Size());
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Remove:
+        m_measuredSizes.Remove(args.OldStartingIndex(), args.OldItems().Size());
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Reset:
+    case winrt::NotifyCollectionChangedAction::Move:
+        m_measuredSizes.Clear();
+        break;
+    }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "StackLayoutState.g.h"
 #include "FlowLayoutAlgorithm.h"
+#include "MeasuredSizeIndex.h"
 
 class StackLayoutState :
     public ReferenceTracker<StackLayoutState, winrt::implementation::StackLayoutStateT, winrt::composing>
@@ -16,12 +17,22 @@ public:
     void UninitializeForContext(const winrt::VirtualizingLayoutContext& context);
     void OnElementMeasured(int elementIndex, double majorSize, double minorSize);
     void OnArrangeLayoutEnd();
+    void OnItemsChanged(const winrt::NotifyCollectionChangedEventArgs& args);
+    // Takes over what another state learned about item sizes, see ItemsRepeater::RestoreLayoutState.
+    void CopyEstimatesFrom(const StackLayoutState& other);
 
     ::FlowLayoutAlgorithm& FlowAlgorithm() { return m_flowAlgorithm; }
     double TotalElementSize() const { return m_totalElementSize; }
     double MaxArrangeBounds() const { return m_maxArrangeBounds; }
     int TotalElementsMeasured() const { return m_totalElementsMeasured; }
 
+    // Only maintained while StackLayout.IsMeasuredSizeCacheEnabled is true or
+    // StackLayout.ItemSizeProvider is set.
+    MeasuredSizeIndex& MeasuredSizes() { return m_measuredSizes; }
+    // Which StackLayout.ItemSizeProvider the sizes came from, see StackLayout::EnsureProvidedItemSizes.
+    unsigned ItemSizeProviderVersion() const { return m_itemSizeProviderVersion; }
+    void ItemSizeProviderVersion(unsigned value) { m_itemSizeProviderVersion = value; }
+
 private:
     ::FlowLayoutAlgorithm m_flowAlgorithm{ this };
     std::vector<double> m_estimationBuffer{};
@@ -31,5 +42,7 @@ private:
     // is going to be used in the calculation of the extent.
     double m_maxArrangeBounds{};
     int m_totalElementsMeasured{};
+    MeasuredSizeIndex m_measuredSizes{};
+    unsigned m_itemSizeProviderVersion{ 0u };
     static const int BufferSize = 100;
 };
\ No newline at end of file
@@ -0,0 +1,250 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include "ItemsRepeater.common.h"
+#include "StickyHeaderManager.h"
+#include "ItemsRepeater.h"
+
+thread_local bool StickyHeaderManager::s_isInUse = false;
+
+StickyHeaderManager::StickyHeaderManager(ItemsRepeater* owner) :
+    m_owner(owner),
+    m_currentHeader(owner),
+    m_scroller(owner),
+    m_scrollViewer(owner),
+    m_scrollContent(owner)
+{
+    // ItemsRepeater is not fully constructed yet. Don't interact with it.
+}
+
+bool StickyHeaderManager::IsCurrentHeader(const winrt::UIElement& element) const
+{
+    return m_currentHeader && m_currentHeader.get() == element;
+}
+
+void StickyHeaderManager::OnHeaderArranged(const winrt::UIElement& element, const winrt::Rect& bounds)
+{
+    auto it = std::find_if(m_headers.begin(), m_headers.end(), [&element](const HeaderInfo& header) { return header.Element.get() == element; });
+    if (it == m_headers.end())
+    {
+        if (!DownlevelHelper::SetIsTranslationEnabledExists())
+        {
+            // Nothing to drive the offset with.
+            return;
+        }
+
+        winrt::ElementCompositionPreview::SetIsTranslationEnabled(element, true);
+        // The header slides over the items that follow it.
+        winrt::Canvas::SetZIndex(element, 1);
+        m_headers.emplace_back(m_owner, element);
+        it = m_headers.end() - 1;
+    }
+
+    it->Bounds = bounds;
+    it->IsArranged = true;
+}
+
+void StickyHeaderManager::OnOwnerArranged()
+{
+    if (m_headers.empty())
+    {
+        return;
+    }
+
+    // Headers that were cleared, or stopped being headers, since the last arrange.
+    for (auto it = m_headers.begin(); it != m_headers.end();)
+    {
+        if (it->IsArranged)
+        {
+            it->IsArranged = false;
+            ++it;
+        }
+        else
+        {
+            StopHeaderAnimation(it->Element.get());
+            it = m_headers.erase(it);
+        }
+    }
+
+    if (m_headers.empty() || !EnsureScrollSource())
+    {
+        UpdateCurrentHeader(nullptr);
+        return;
+    }
+
+    std::sort(m_headers.begin(), m_headers.end(), [](const HeaderInfo& lhs, const HeaderInfo& rhs) { return lhs.Bounds.Y < rhs.Bounds.Y; });
+
+    // Header bounds are relative to the repeater, the scroll position is relative to the content.
+    const float ownerTop = m_owner->TransformToVisual(m_scrollContent.get()).TransformPoint(winrt::Point{}).Y;
+    const double verticalOffset = GetVerticalOffset();
+    winrt::UIElement currentHeader{ nullptr };
+
+    for (size_t i = 0; i < m_headers.size(); ++i)
+    {
+        auto& header = m_headers[i];
+        const float top = ownerTop + header.Bounds.Y;
+        // The next header pushes this one out instead of overlapping it.
+        const float limit = i + 1 < m_headers.size() ?
+            std::max(0.0f, m_headers[i + 1].Bounds.Y - header.Bounds.Y - header.Bounds.Height) :
+            std::numeric_limits<float>::max();
+
+        if (top != header.AnimatedTop || limit != header.AnimatedLimit)
+        {
+            StartHeaderAnimation(header, top, limit);
+        }
+
+        if (top <= verticalOffset)
+        {
+            currentHeader = header.Element.get();
+        }
+    }
+
+    UpdateCurrentHeader(currentHeader);
+}
+
+void StickyHeaderManager::OnElementCleared(const winrt::UIElement& element)
+{
+    if (m_headers.empty())
+    {
+        return;
+    }
+
+    // Pinned elements stay around and are still headers. Only forget
+    // about the ones that went back to the element factory.
+    const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+    if (virtInfo->Owner() == ElementOwner::ElementFactory)
+    {
+        auto it = std::find_if(m_headers.begin(), m_headers.end(), [&element](const HeaderInfo& header) { return header.Element.get() == element; });
+        if (it != m_headers.end())
+        {
+            StopHeaderAnimation(element);
+            m_headers.erase(it);
+        }
+
+        if (IsCurrentHeader(element))
+        {
+            // Forcibly unpinned by a collection change.
+            m_currentHeader.set(nullptr);
+        }
+    }
+}
+
+void StickyHeaderManager::ResetScrollSource()
+{
+    ClearHeaders();
+    m_scroller.set(nullptr);
+    m_scrollViewer.set(nullptr);
+    m_scrollContent.set(nullptr);
+    m_stickyAnimation = nullptr;
+}
+
+bool StickyHeaderManager::EnsureScrollSource()
+{
+    if (m_scrollContent)
+    {
+        return true;
+    }
+
+    auto child = static_cast<winrt::DependencyObject>(*m_owner);
+    auto parent = CachedVisualTreeHelpers::GetParent(child);
+    while (parent)
+    {
+        if (auto scroller = parent.try_as<winrt::Scroller>())
+        {
+            if (auto content = scroller.Content())
+            {
+                m_scroller.set(scroller);
+                m_scrollContent.set(content);
+                m_stickyAnimation = winrt::ElementCompositionPreview::GetElementVisual(*m_owner).Compositor().CreateExpressionAnimation(
+                    L"Clamp(source.Position.Y - top, 0, limit)");
+                m_stickyAnimation.SetReferenceParameter(L"source", scroller.ExpressionAnimationSources());
+            }
+            break;
+        }
+        else if (auto scrollViewer = parent.try_as<winrt::ScrollViewer>())
+        {
+            if (auto content = scrollViewer.Content().try_as<winrt::UIElement>())
+            {
+                m_scrollViewer.set(scrollViewer);
+                m_scrollContent.set(content);
+                m_stickyAnimation = winrt::ElementCompositionPreview::GetElementVisual(*m_owner).Compositor().CreateExpressionAnimation(
+                    L"Clamp(-source.Translation.Y - top, 0, limit)");
+                m_stickyAnimation.SetReferenceParameter(L"source", winrt::ElementCompositionPreview::GetScrollViewerManipulationPropertySet(scrollViewer));
+            }
+            break;
+        }
+
+        child = parent;
+        parent = CachedVisualTreeHelpers::GetParent(child);
+    }
+
+    return static_cast<bool>(m_scrollContent);
+}
+
+double StickyHeaderManager::GetVerticalOffset() const
+{
+    return m_scroller ? m_scroller.get().VerticalOffset() : m_scrollViewer.get().VerticalOffset();
+}
+
+void StickyHeaderManager::StartHeaderAnimation(HeaderInfo& header, float top, float limit)
+{
+    // Parameters are copied when the animation starts so the same
+    // animation can be shared by all the headers.
+    m_stickyAnimation.SetScalarParameter(L"top", top);
+    m_stickyAnimation.SetScalarParameter(L"limit", limit);
+    winrt::ElementCompositionPreview::GetElementVisual(header.Element.get()).StartAnimation(L"Translation.Y", m_stickyAnimation);
+    header.AnimatedTop = top;
+    header.AnimatedLimit = limit;
+}
+
+/* static */
+void StickyHeaderManager::StopHeaderAnimation(const winrt::UIElement& element)
+{
+    auto visual = winrt::ElementCompositionPreview::GetElementVisual(element);
+    visual.StopAnimation(L"Translation.Y");
+    visual.Properties().InsertVector3(L"Translation", winrt::float3{});
+}
+
+void StickyHeaderManager::UpdateCurrentHeader(const winrt::UIElement& header)
+{
+    if (IsCurrentHeader(header) || (!header && !m_currentHeader))
+    {
+        return;
+    }
+
+    // The current header is pinned so that it does not get recycled while
+    // the rest of its group is scrolled through. Only this repeater's pin is
+    // taken; the header lives in its own repeater's Children.
+    if (auto previousHeader = m_currentHeader.get())
+    {
+        auto virtInfo = ItemsRepeater::GetVirtualizationInfo(previousHeader);
+        if (virtInfo->IsPinned() && virtInfo->RemovePin() == 0)
+        {
+            // ElementFactory is invoked during the measure pass.
+            // We will clear the element then.
+            m_owner->ViewManager().OnElementUnpinned();
+            m_owner->InvalidateMeasure();
+        }
+    }
+
+    m_currentHeader.set(header);
+
+    if (header)
+    {
+        ItemsRepeater::GetVirtualizationInfo(header)->AddPin();
+    }
+}
+
+void StickyHeaderManager::ClearHeaders()
+{
+    UpdateCurrentHeader(nullptr);
+
+    for (auto& header : m_headers)
+    {
+        StopHeaderAnimation(header.Element.get());
+    }
+
+    m_headers.clear();
+}
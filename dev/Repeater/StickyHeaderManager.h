@@ -0,0 +1,64 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class ItemsRepeater;
+
+// Internal component that keeps the children marked with
+// ItemsRepeater.IsStickyHeader stuck to the top of the viewport.
+// The headers are moved by an expression animation bound to the
+// scroll position of the closest Scroller or ScrollViewer, so scrolling
+// does not go through the UI thread. The repeater only tells us where
+// headers got arranged, and we only decide which header is current
+// (and keep it pinned) when a layout pass happens.
+class StickyHeaderManager final
+{
+public:
+    StickyHeaderManager(ItemsRepeater* owner);
+
+    // True once any element on this thread had IsStickyHeader set,
+    // lets the repeater skip reading the property from every child.
+    static bool IsInUse() { return s_isInUse; }
+    static void OnIsStickyHeaderChanged() { s_isInUse = true; }
+
+    bool IsCurrentHeader(const winrt::UIElement& element) const;
+    void OnHeaderArranged(const winrt::UIElement& element, const winrt::Rect& bounds);
+    void OnOwnerArranged();
+    void OnElementCleared(const winrt::UIElement& element);
+    void ResetScrollSource();
+
+private:
+    struct HeaderInfo
+    {
+        HeaderInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element) :
+            Element(owner, element) {}
+
+        tracker_ref<winrt::UIElement> Element;
+        winrt::Rect Bounds{};
+        bool IsArranged{ true };
+        // Values the running animation was started with.
+        float AnimatedTop{ std::numeric_limits<float>::quiet_NaN() };
+        float AnimatedLimit{ std::numeric_limits<float>::quiet_NaN() };
+    };
+
+    bool EnsureScrollSource();
+    double GetVerticalOffset() const;
+    void StartHeaderAnimation(HeaderInfo& header, float top, float limit);
+    static void StopHeaderAnimation(const winrt::UIElement& element);
+    void UpdateCurrentHeader(const winrt::UIElement& header);
+    void ClearHeaders();
+
+    ItemsRepeater* m_owner;
+
+    // Sorted by vertical position after each arrange.
+    std::vector<HeaderInfo> m_headers;
+    tracker_ref<winrt::UIElement> m_currentHeader;
+
+    tracker_ref<winrt::Scroller> m_scroller;
+    tracker_ref<winrt::ScrollViewer> m_scrollViewer;
+    tracker_ref<winrt::UIElement> m_scrollContent;
+    winrt::ExpressionAnimation m_stickyAnimation{ nullptr };
+
+    static thread_local bool s_isInUse;
+};
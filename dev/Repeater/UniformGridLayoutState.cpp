@@ -38,11 +38,24 @@ void UniformGridLayoutState::EnsureElementSize(
     double minRowSpacing,
     double minColumnSpacing)
 {
+    if (!std::isnan(layoutItemWidth) && !std::isnan(LayoutItemHeight))
+    {
+        // The item size is fully specified, so there is no need to realize and measure
+        // the first element to find it out. This keeps large grids with a fixed item size
+        // from creating an element just to throw its size away.
+        if (m_cachedFirstElement)
+        {
+            context.RecycleElement(m_cachedFirstElement);
+            m_cachedFirstElement = nullptr;
+        }
+
+        SetSize(winrt::Size{}, layoutItemWidth, LayoutItemHeight, availableSize, stretch, orientation, minRowSpacing, minColumnSpacing);
+    }
     // If the first element is realized we don't need to cache it or to get it from the context
-    if (auto realizedElement = m_flowAlgorithm.GetElementIfRealized(0))
+    else if (auto realizedElement = m_flowAlgorithm.GetElementIfRealized(0))
     {
         realizedElement.Measure(availableSize);
-        SetSize(realizedElement, layoutItemWidth, LayoutItemHeight, availableSize, stretch, orientation, minRowSpacing, minColumnSpacing);
+        SetSize(realizedElement.DesiredSize(), layoutItemWidth, LayoutItemHeight, availableSize, stretch, orientation, minRowSpacing, minColumnSpacing);
         m_cachedFirstElement = nullptr;
     }
     else
@@ -54,7 +67,7 @@ void UniformGridLayoutState::EnsureElementSize(
         }
 
         m_cachedFirstElement.Measure(availableSize);
-        SetSize(m_cachedFirstElement, layoutItemWidth, LayoutItemHeight, availableSize, stretch, orientation, minRowSpacing, minColumnSpacing);
+        SetSize(m_cachedFirstElement.DesiredSize(), layoutItemWidth, LayoutItemHeight, availableSize, stretch, orientation, minRowSpacing, minColumnSpacing);
 
         // See if we can move ownership to the flow algorithm. If we can, we do not need a local cache.
         bool added = m_flowAlgorithm.TryAddElement0(m_cachedFirstElement);
@@ -66,7 +79,7 @@ void UniformGridLayoutState::EnsureElementSize(
 }
 
 void UniformGridLayoutState::SetSize(
-    winrt::UIElement UIElement,
+    const winrt::Size& firstElementDesiredSize,
     const double layoutItemWidth,
     const double LayoutItemHeight,
     const winrt::Size availableSize,
@@ -75,8 +88,8 @@ void UniformGridLayoutState::SetSize(
     double minRowSpacing,
     double minColumnSpacing)
 {
-    m_effectiveItemWidth = (std::isnan(layoutItemWidth) ? UIElement.DesiredSize().Width : layoutItemWidth);
-    m_effectiveItemHeight = (std::isnan(LayoutItemHeight) ? UIElement.DesiredSize().Height : LayoutItemHeight);
+    m_effectiveItemWidth = (std::isnan(layoutItemWidth) ? firstElementDesiredSize.Width : layoutItemWidth);
+    m_effectiveItemHeight = (std::isnan(LayoutItemHeight) ? firstElementDesiredSize.Height : LayoutItemHeight);
 
     auto availableSizeMinor = orientation == winrt::Orientation::Horizontal ? availableSize.Width : availableSize.Height;
     auto minorItemSpacing = orientation == winrt::Orientation::Horizontal ? minRowSpacing : minColumnSpacing;
@@ -13,11 +13,21 @@ public:
     void Add(const winrt::UIElement& element);
     winrt::UIElement Remove(int index);
     void Clear();
+    // Pre-sizes the pool so that a reset of count realized elements does not rehash.
+    void Reserve(size_t count);
+    size_t EstimatedBytes() const { return EstimateHashMapBytes(m_elementMap); }
 
     auto begin() const { return m_elementMap.begin(); }
     auto end() const { return m_elementMap.end(); }
 
 private:
+    struct UniqueIdHash
+    {
+        size_t operator()(winrt::hstring const& key) const { return std::hash<std::wstring_view>{}(key); }
+    };
+
     ItemsRepeater* m_owner{ nullptr };
-    std::map<std::wstring, tracker_ref<winrt::UIElement>> m_elementMap;
+    // Keyed on the unique id hstring directly. hstrings are reference counted so
+    // adding an element does not copy the id.
+    std::unordered_map<winrt::hstring, tracker_ref<winrt::UIElement>, UniqueIdHash> m_elementMap;
 };
\ No newline at end of file
@@ -6,12 +6,16 @@
 #include "ItemsRepeater.common.h"
 #include "ViewManager.h"
 #include "ItemsRepeater.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+#include "RecyclingElementFactory.h"
 #ifdef BUILD_WINDOWS
 #include "ElementFactoryGetArgsDownlevel.h"
 #include "ElementFactoryRecycleArgsDownlevel.h"
 #else
 #include "ElementFactoryGetArgs.h"
 #include "ElementFactoryRecycleArgs.h"
+#include "ItemTemplateWrapper.h"
 #endif
 
 ViewManager::ViewManager(ItemsRepeater* owner) :
@@ -25,6 +29,15 @@ ViewManager::ViewManager(ItemsRepeater* owner) :
     // ItemsRepeater is not fully constructed yet. Don't interact with it.
 }
 
+ViewManager::~ViewManager()
+{
+    // The scheduler holds a raw pointer to this instance.
+    if (m_prewarmWorkToken != 0u)
+    {
+        BuildTreeScheduler::CancelWork(m_prewarmWorkToken);
+    }
+}
+
 winrt::UIElement ViewManager::GetElement(int index, bool forceCreate, bool suppressAutoRecycle)
 {
     winrt::UIElement element = forceCreate ? nullptr : GetElementIfAlreadyHeldByLayout(index);
@@ -49,13 +62,14 @@ winrt::UIElement ViewManager::GetElement(int index, bool forceCreate, bool suppr
     if (suppressAutoRecycle)
     {
         virtInfo->AutoRecycleCandidate(false);
-        REPEATER_TRACE_INFO(L"GetElement: %d Not AutoRecycleCandidate: \n", virtInfo->Index());
+        REPEATER_TRACE_ELEMENT("GetElement", m_owner->LayoutIdForTracing().data(), virtInfo->Index());
     }
     else
     {
         virtInfo->AutoRecycleCandidate(true);
         virtInfo->KeepAlive(true);
-        REPEATER_TRACE_INFO(L"GetElement: %d AutoRecycleCandidate: \n", virtInfo->Index());
+        m_hasAutoRecycleCandidates = true;
+        REPEATER_TRACE_ELEMENT("GetElementAutoRecycle", m_owner->LayoutIdForTracing().data(), virtInfo->Index());
     }
 
     return element;
@@ -106,6 +120,17 @@ void ViewManager::ClearElementToElementFactory(const winrt::UIElement& element)
 {
     auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
     const int clearedIndex = virtInfo->Index();
+
+    if (virtInfo->Owner() == ElementOwner::PinnedPool)
+    {
+        // A collection change can clear an element out of the pinned pool. Make sure
+        // the pool doesn't keep a stale entry around.
+        const int position = FindInPinnedPool(clearedIndex);
+        if (position >= 0 && m_pinnedPool[position].Element() == element)
+        {
+            RemoveFromPinnedPool(position);
+        }
+    }
     m_owner->OnElementClearing(element);
 
     if (!m_ElementFactoryRecycleArgs)
@@ -122,11 +147,21 @@ void ViewManager::ClearElementToElementFactory(const winrt::UIElement& element)
     context.Element(element);
     context.Parent(*m_owner);
 
-    m_owner->ItemTemplateShim().RecycleElement(context);
+    {
+        QPCTimer factoryTimer;
+        m_owner->ItemTemplateShim().RecycleElement(context);
+        auto& counters = m_owner->PerfCounters();
+        counters.elementFactoryTimeInMicroseconds += factoryTimer.DurationInMicroSeconds();
+        ++counters.elementsRecycled;
+    }
 
     context.Element(nullptr);
     context.Parent(nullptr);
 
+    if (virtInfo->IsRealized())
+    {
+        RemoveFromRealizedElements(element, clearedIndex);
+    }
     virtInfo->MoveOwnershipToElementFactory();
     m_phaser.StopPhasing(element, virtInfo);
     if (m_lastFocusedElement == element)
@@ -248,26 +283,42 @@ int ViewManager::GetElementIndex(const winrt::com_ptr<VirtualizationInfo>& virtI
     return virtInfo->IsRealized() || virtInfo->IsInUniqueIdResetPool() ? virtInfo->Index() : -1;
 }
 
+size_t ViewManager::EstimatedBytes() const
+{
+    return (m_realizedElements.capacity() + m_pinnedPool.capacity()) * sizeof(RealizedElementInfo) +
+        EstimateHashMapBytes(m_pinnedPoolIndexMap) +
+        m_resetPool.EstimatedBytes() +
+        m_indexShiftLog->EstimatedBytes() +
+        m_phaser.EstimatedBytes();
+}
+
 void ViewManager::PrunePinnedElements()
 {
     EnsureEventSubscriptions();
 
+    if (!m_hasPendingUnpin)
+    {
+        return;
+    }
+
+    m_hasPendingUnpin = false;
+
     // Go through pinned elements and make sure they still have
-    // a reason to be pinned.
-    for (size_t i = 0; i < m_pinnedPool.size(); ++i)
+    // a reason to be pinned. Walk backwards since removal swaps
+    // the last element into the removed position.
+    for (size_t i = m_pinnedPool.size(); i-- > 0;)
     {
-        auto elementInfo = m_pinnedPool[i];
-        auto virtInfo = elementInfo.VirtualizationInfo();
+        auto virtInfo = m_pinnedPool[i].VirtualizationInfo();
 
         MUX_ASSERT(virtInfo->Owner() == ElementOwner::PinnedPool);
 
         if (!virtInfo->IsPinned())
         {
-            m_pinnedPool.erase(m_pinnedPool.begin() + i);
-            --i;
+            auto element = m_pinnedPool[i].Element();
+            RemoveFromPinnedPool(i);
 
             // Pinning was the only thing keeping this element alive.
-            ClearElementToElementFactory(elementInfo.PinnedElement());
+            ClearElementToElementFactory(element);
         }
     }
 }
@@ -295,6 +346,7 @@ void ViewManager::UpdatePin(const winrt::UIElement& element, bool addPin)
                 {
                     // ElementFactory is invoked during the measure pass.
                     // We will clear the element then.
+                    winrt::get_self<ItemsRepeater>(repeater)->ViewManager().OnElementUnpinned();
                     repeater.InvalidateMeasure();
                 }
             }
@@ -319,19 +371,7 @@ void ViewManager::OnDataSourceChanged(const winrt::IInspectable&, const winrt::N
         if (newIndex <= m_lastRealizedElementIndexHeldByLayout)
         {
             m_lastRealizedElementIndexHeldByLayout += newCount;
-            auto children = m_owner->Children();
-            auto childCount = children.Size();
-            for (unsigned i = 0u; i < childCount; ++i)
-            {
-                auto element = children.GetAt(i);
-                auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-                auto dataIndex = virtInfo->Index();
-
-                if (virtInfo->IsRealized() && dataIndex >= newIndex)
-                {
-                    UpdateElementIndex(element, virtInfo, dataIndex + newCount);
-                }
-            }
+            ShiftRealizedElementIndices(newIndex, static_cast<int>(newCount));
         }
         else
         {
@@ -339,13 +379,13 @@ void ViewManager::OnDataSourceChanged(const winrt::IInspectable&, const winrt::N
             // We could still have items in the pinned elements that need updates. This is usually a very small vector.
             for (size_t i = 0; i < m_pinnedPool.size(); ++i)
             {
-                auto elementInfo = m_pinnedPool[i];
+                auto const& elementInfo = m_pinnedPool[i];
                 auto virtInfo = elementInfo.VirtualizationInfo();
                 auto dataIndex = virtInfo->Index();
 
                 if (virtInfo->IsRealized() && dataIndex >= newIndex)
                 {
-                    auto element = elementInfo.PinnedElement();
+                    auto element = elementInfo.Element();
                     UpdateElementIndex(element, virtInfo, dataIndex + newCount);
                 }
             }
@@ -386,21 +426,7 @@ void ViewManager::OnDataSourceChanged(const winrt::IInspectable&, const winrt::N
         {
             // countChange > 0 : countChange items were added
             // countChange < 0 : -countChange  items were removed
-            auto children = m_owner->Children();
-            for (unsigned i = 0u; i < children.Size(); ++i)
-            {
-                auto element = children.GetAt(i);
-                auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-                auto dataIndex = virtInfo->Index();
-
-                if (virtInfo->IsRealized())
-                {
-                    if (dataIndex >= oldStartIndex + oldCount)
-                    {
-                        UpdateElementIndex(element, virtInfo, dataIndex + countChange);
-                    }
-                }
-            }
+            ShiftRealizedElementIndices(oldStartIndex + oldCount, countChange);
 
             EnsureFirstLastRealizedIndices();
             m_lastRealizedElementIndexHeldByLayout += countChange;
@@ -438,14 +464,15 @@ void ViewManager::OnDataSourceChanged(const winrt::IInspectable&, const winrt::N
     }
 
     case winrt::NotifyCollectionChangedAction::Reset:
+        auto children = m_owner->Children();
         if (m_owner->ItemsSourceView().HasKeyIndexMapping())
         {
             m_isDataSourceStableResetPending = true;
+            m_resetPool.Reserve(children.Size());
         }
 
         // Walk through all the elements and make sure they are cleared, they will go into
         // the stable id reset pool.
-        auto children = m_owner->Children();
         for (unsigned i = 0u; i < children.Size(); ++i)
         {
             auto element = children.GetAt(i);
@@ -497,6 +524,76 @@ void ViewManager::OnOwnerArranged()
     }
 }
 
+void ViewManager::SchedulePrewarm()
+{
+    if (m_prewarmWorkToken == 0u && m_owner->PrewarmElementCount() > 0)
+    {
+        // Prewarming is speculative so it runs after any other pending build tree work
+        // such as phasing of realized elements.
+        m_prewarmWorkToken = BuildTreeScheduler::RegisterWork(
+            BuildTreeWorkLane::Prewarm,
+            0 /* priority */,
+            [](void* context) { static_cast<::ViewManager*>(context)->OnPrewarmCallback(); },
+            this);
+    }
+}
+
+void ViewManager::OnOwnerLoaded()
+{
+    SchedulePrewarm();
+    m_phaser.OnOwnerLoaded();
+}
+
+void ViewManager::OnOwnerUnloaded()
+{
+    // Nothing queued for a repeater that left the live tree is worth the frame time.
+    if (m_prewarmWorkToken != 0u)
+    {
+        BuildTreeScheduler::CancelWork(m_prewarmWorkToken);
+        m_prewarmWorkToken = 0u;
+    }
+
+    m_phaser.OnOwnerUnloaded();
+}
+
+void ViewManager::OnPrewarmCallback()
+{
+    m_prewarmWorkToken = 0u;
+
+    const int countPerKey = m_owner->PrewarmElementCount();
+    bool hasPendingWork = countPerKey > 0;
+    while (hasPendingWork && !BuildTreeScheduler::ShouldYield())
+    {
+        hasPendingWork = PrewarmElement(countPerKey);
+    }
+
+    if (hasPendingWork)
+    {
+        SchedulePrewarm();
+    }
+}
+
+bool ViewManager::PrewarmElement(int countPerKey)
+{
+    // We can only prewarm factories whose templates we know about. Custom element
+    // factories own their creation policy.
+    const auto itemTemplate = m_owner->ItemTemplate();
+    if (auto recyclingFactory = itemTemplate.try_as<winrt::RecyclingElementFactory>())
+    {
+        return winrt::get_self<RecyclingElementFactory>(recyclingFactory)->PrewarmElement(countPerKey);
+    }
+
+#ifndef BUILD_WINDOWS
+    if (itemTemplate.try_as<winrt::DataTemplate>())
+    {
+        // DataTemplates are always wrapped in an ItemTemplateWrapper.
+        return winrt::get_self<ItemTemplateWrapper>(m_owner->ItemTemplateShim())->PrewarmElement(countPerKey);
+    }
+#endif
+
+    return false;
+}
+
 #pragma region GetElement providers
 
 // We optimize for the case where index is not realized to return null as quickly as we can.
@@ -561,6 +658,7 @@ winrt::UIElement ViewManager::GetElementFromUniqueIdResetPool(int index)
             auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
             virtInfo->MoveOwnershipToLayoutFromUniqueIdResetPool();
             UpdateElementIndex(element, virtInfo, index);
+            AddToRealizedElements(element);
         }
     }
 
@@ -572,21 +670,72 @@ winrt::UIElement ViewManager::GetElementFromPinnedElements(int index)
     winrt::UIElement element = nullptr;
 
     // See if you can find something among the pinned elements.
-    for (size_t i = 0; i < m_pinnedPool.size(); ++i)
+    const int position = FindInPinnedPool(index);
+    if (position >= 0)
     {
-        auto elementInfo = m_pinnedPool[i];
-        auto virtInfo = elementInfo.VirtualizationInfo();
+        auto virtInfo = m_pinnedPool[position].VirtualizationInfo();
+        element = m_pinnedPool[position].Element();
+        RemoveFromPinnedPool(position);
+        virtInfo->MoveOwnershipToLayoutFromPinnedPool();
+    }
+
+    return element;
+}
 
-        if (virtInfo->Index() == index)
+int ViewManager::FindInPinnedPool(int index)
+{
+    if (m_pinnedPool.empty())
+    {
+        return -1;
+    }
+
+    EnsurePinnedPoolIndexMap();
+    auto iterator = m_pinnedPoolIndexMap.find(index);
+    if (iterator != m_pinnedPoolIndexMap.end())
+    {
+        const auto position = iterator->second;
+        MUX_ASSERT(m_pinnedPool[position].VirtualizationInfo()->Index() == index);
+        return static_cast<int>(position);
+    }
+
+    return -1;
+}
+
+void ViewManager::RemoveFromPinnedPool(size_t position)
+{
+    MUX_ASSERT(position < m_pinnedPool.size());
+
+    if (m_isPinnedPoolIndexMapValid)
+    {
+        m_pinnedPoolIndexMap.erase(m_pinnedPool[position].VirtualizationInfo()->Index());
+    }
+
+    const size_t lastPosition = m_pinnedPool.size() - 1;
+    if (position != lastPosition)
+    {
+        m_pinnedPool[position] = std::move(m_pinnedPool[lastPosition]);
+        if (m_isPinnedPoolIndexMapValid)
         {
-            m_pinnedPool.erase(m_pinnedPool.begin() + i);
-            element = elementInfo.PinnedElement();
-            elementInfo.VirtualizationInfo()->MoveOwnershipToLayoutFromPinnedPool();
-            break;
+            m_pinnedPoolIndexMap[m_pinnedPool[position].VirtualizationInfo()->Index()] = position;
         }
     }
 
-    return element;
+    m_pinnedPool.pop_back();
+}
+
+void ViewManager::EnsurePinnedPoolIndexMap()
+{
+    if (!m_isPinnedPoolIndexMapValid)
+    {
+        m_pinnedPoolIndexMap.clear();
+        m_pinnedPoolIndexMap.reserve(m_pinnedPool.size());
+        for (size_t i = 0; i < m_pinnedPool.size(); ++i)
+        {
+            m_pinnedPoolIndexMap[m_pinnedPool[i].VirtualizationInfo()->Index()] = i;
+        }
+
+        m_isPinnedPoolIndexMapValid = true;
+    }
 }
 
 winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
@@ -624,7 +773,11 @@ winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
     args.as<ElementFactoryGetArgs>()->Index(index);
 #endif
 
+    QPCTimer factoryTimer;
     winrt::UIElement element = itemTemplateFactory.GetElement(args);
+    auto& counters = m_owner->PerfCounters();
+    counters.elementFactoryTimeInMicroseconds += factoryTimer.DurationInMicroSeconds();
+    ++counters.elementsCreated;
 
     args.Data(nullptr);
     args.Parent(nullptr);
@@ -647,7 +800,16 @@ winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
     // run before setting DataContext, when setting DataContext all the phases will be
     // run in the OnDataContextChanged handler in code generated by the xaml compiler (code-gen).
     auto extension = CachedVisualTreeHelpers::GetDataTemplateComponent(element);
-    if (extension)
+    if (virtInfo->IsBoundTo(data, index))
+    {
+        // The element was recycled and handed right back for the item it was showing
+        // (the realization window moving back and forth around an edge). Its bindings
+        // are still in place, don't run them again. Mark phasing as done so that the
+        // phaser doesn't rebind it either.
+        virtInfo->UpdatePhasingInfo(VirtualizationInfo::PhaseReachedEnd, nullptr, nullptr);
+        ++m_owner->PerfCounters().elementsRebindSkipped;
+    }
+    else if (extension)
     {
         // Clear out old data. 
         extension.Recycle();
@@ -658,12 +820,17 @@ winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
         // Setup phasing information, so that Phaser can pick up any pending phases left.
         // Update phase on virtInfo. Set data and templateComponent only if x:Phase was used.
         virtInfo->UpdatePhasingInfo(nextPhase, nextPhase > 0 ? data : nullptr, nextPhase > 0 ? extension : nullptr);
+
+        // Only remember the item when all the bindings ran, later phases get cancelled
+        // if the element is recycled before the phaser gets to them.
+        virtInfo->BoundTo(nextPhase > 0 ? nullptr : data, index);
     }
     else
     {
         // Set data context only if no x:Bind was used. ie. No data template component on the root.
         auto elementAsFE = element.try_as<winrt::FrameworkElement>();
         elementAsFE.DataContext(data);
+        virtInfo->BoundTo(data, index);
     }
 
     virtInfo->MoveOwnershipToLayoutFromElementFactory(
@@ -672,6 +839,8 @@ winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
         m_owner->ItemsSourceView().HasKeyIndexMapping() ?
         m_owner->ItemsSourceView().KeyFromIndex(index) :
         winrt::hstring{});
+    virtInfo->TrackIndexShifts(m_indexShiftLog);
+    AddToRealizedElements(element);
 
     // The view generator is the only provider that prepares the element.
     auto repeater = m_owner;
@@ -685,7 +854,10 @@ winrt::UIElement ViewManager::GetElementFromElementFactory(int index)
         children.Append(element);
     }
 
-    repeater->AnimationManager().OnElementPrepared(element);
+    if (repeater->AnimationManager().HasAnimator())
+    {
+        repeater->AnimationManager().OnElementPrepared(element);
+    }
     repeater->OnElementPrepared(element, index);
     m_phaser.PhaseElement(element, virtInfo);
 
@@ -704,6 +876,7 @@ bool ViewManager::ClearElementToUniqueIdResetPool(const winrt::UIElement& elemen
 {
     if (m_isDataSourceStableResetPending)
     {
+        RemoveFromRealizedElements(element, virtInfo->Index());
         m_resetPool.Add(element);
         virtInfo->MoveOwnershipToUniqueIdResetPoolFromLayout();
     }
@@ -713,10 +886,17 @@ bool ViewManager::ClearElementToUniqueIdResetPool(const winrt::UIElement& elemen
 
 bool ViewManager::ClearElementToAnimator(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo)
 {
-    const bool cleared = m_owner->AnimationManager().ClearElement(element);
+    auto& animationManager = m_owner->AnimationManager();
+    if (!animationManager.HasAnimator())
+    {
+        return false;
+    }
+
+    const bool cleared = animationManager.ClearElement(element);
     if (cleared)
     {
         const int clearedIndex = virtInfo->Index();
+        RemoveFromRealizedElements(element, clearedIndex);
         virtInfo->MoveOwnershipToAnimator();
         if (m_lastFocusedElement == element)
         {
@@ -740,11 +920,16 @@ bool ViewManager::ClearElementToPinnedPool(const winrt::UIElement& element, cons
 #ifdef _DEBUG
         for (size_t i = 0; i < m_pinnedPool.size(); ++i)
         {
-            MUX_ASSERT(m_pinnedPool[i].PinnedElement() != element);
+            MUX_ASSERT(m_pinnedPool[i].Element() != element);
         }
 #endif
-        m_pinnedPool.push_back(PinnedElementInfo(m_owner, element));
+        m_pinnedPool.push_back(RealizedElementInfo(m_owner, element));
+        if (m_isPinnedPoolIndexMapValid)
+        {
+            m_pinnedPoolIndexMap[virtInfo->Index()] = m_pinnedPool.size() - 1;
+        }
         virtInfo->MoveOwnershipToPinnedPool();
+        ++m_owner->PerfCounters().elementsPinned;
     }
 
     return moveToPinnedPool;
@@ -822,18 +1007,121 @@ void ViewManager::UpdateElementIndex(const winrt::UIElement& element, const winr
     auto oldIndex = virtInfo->Index();
     if (oldIndex != index)
     {
+        if (virtInfo->Owner() == ElementOwner::PinnedPool)
+        {
+            m_isPinnedPoolIndexMapValid = false;
+        }
+
         virtInfo->UpdateIndex(index);
         m_owner->OnElementIndexChanged(element, oldIndex, index);
     }
 }
 
+void ViewManager::ShiftRealizedElementIndices(int startIndex, int delta)
+{
+    if (m_owner->HasElementIndexChangedHandlers())
+    {
+        // Every moved element raises its own ElementIndexChanged, so there is nothing to defer.
+        auto children = m_owner->Children();
+        for (unsigned i = 0u; i < children.Size(); ++i)
+        {
+            auto element = children.GetAt(i);
+            auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+            auto dataIndex = virtInfo->Index();
+
+            if (virtInfo->IsRealized() && dataIndex >= startIndex)
+            {
+                UpdateElementIndex(element, virtInfo, dataIndex + delta);
+            }
+        }
+    }
+    else
+    {
+        if (m_indexShiftLog->Count() >= MaxPendingIndexShifts)
+        {
+            FlushIndexShifts();
+        }
+
+        m_indexShiftLog->Add(startIndex, delta);
+        if (!m_pinnedPool.empty())
+        {
+            m_isPinnedPoolIndexMapValid = false;
+        }
+    }
+}
+
+void ViewManager::FlushIndexShifts()
+{
+    // Realized elements are always children, reading their index brings them up to date.
+    auto children = m_owner->Children();
+    for (unsigned i = 0u; i < children.Size(); ++i)
+    {
+        ItemsRepeater::GetVirtualizationInfo(children.GetAt(i))->Index();
+    }
+
+    m_indexShiftLog->Clear();
+}
+
+const std::vector<ViewManager::RealizedElementInfo>& ViewManager::RealizedElementsInIndexOrder()
+{
+    const auto isOrderedBefore = [](const RealizedElementInfo& lhs, const RealizedElementInfo& rhs)
+    {
+        return lhs.VirtualizationInfo()->Index() < rhs.VirtualizationInfo()->Index();
+    };
+
+    if (!std::is_sorted(m_realizedElements.begin(), m_realizedElements.end(), isOrderedBefore))
+    {
+        std::stable_sort(m_realizedElements.begin(), m_realizedElements.end(), isOrderedBefore);
+    }
+
+    return m_realizedElements;
+}
+
+void ViewManager::AddToRealizedElements(const winrt::UIElement& element)
+{
+    RealizedElementInfo elementInfo(m_owner, element);
+    const int index = elementInfo.VirtualizationInfo()->Index();
+
+    // Elements are mostly realized at either end of the range, so look from the back first.
+    auto position = m_realizedElements.end();
+    if (!m_realizedElements.empty() && m_realizedElements.back().VirtualizationInfo()->Index() > index)
+    {
+        position = std::upper_bound(m_realizedElements.begin(), m_realizedElements.end(), index,
+            [](int index, const RealizedElementInfo& entry) { return index < entry.VirtualizationInfo()->Index(); });
+    }
+
+    m_realizedElements.insert(position, std::move(elementInfo));
+}
+
+void ViewManager::RemoveFromRealizedElements(const winrt::UIElement& element, int index)
+{
+    auto position = std::lower_bound(m_realizedElements.begin(), m_realizedElements.end(), index,
+        [](const RealizedElementInfo& entry, int index) { return entry.VirtualizationInfo()->Index() < index; });
+    while (position != m_realizedElements.end() && position->VirtualizationInfo()->Index() == index && position->Element() != element)
+    {
+        ++position;
+    }
+
+    if (position == m_realizedElements.end() || position->Element() != element)
+    {
+        // Out of order after a collection change, fall back to looking at every entry.
+        position = std::find_if(m_realizedElements.begin(), m_realizedElements.end(),
+            [&element](const RealizedElementInfo& entry) { return entry.Element() == element; });
+    }
+
+    if (position != m_realizedElements.end())
+    {
+        m_realizedElements.erase(position);
+    }
+}
+
 void ViewManager::InvalidateRealizedIndicesHeldByLayout()
 {
     m_firstRealizedElementIndexHeldByLayout = FirstRealizedElementIndexDefault;
     m_lastRealizedElementIndexHeldByLayout = LastRealizedElementIndexDefault;
 }
 
-ViewManager::PinnedElementInfo::PinnedElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element) :
-    m_pinnedElement(owner, element),
+ViewManager::RealizedElementInfo::RealizedElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element) :
+    m_element(owner, element),
     m_virtInfo(owner, ItemsRepeater::GetVirtualizationInfo(element))
 { }
@@ -15,6 +15,7 @@ class ViewManager final
 {
 public:
     ViewManager(ItemsRepeater* owner);
+    ~ViewManager();
 
     winrt::UIElement GetElement(int index, bool forceCreate, bool suppressAutoRecycle);
     void ClearElement(const winrt::UIElement& element, bool isClearedDueToCollectionChange);
@@ -23,10 +24,58 @@ public:
 
     void PrunePinnedElements();
     void UpdatePin(const winrt::UIElement& element, bool addPin);
+    void OnElementUnpinned() { m_hasPendingUnpin = true; }
 
     void OnDataSourceChanged(const winrt::IInspectable& source, const winrt::NotifyCollectionChangedEventArgs& args);
     void OnLayoutChanging();
     void OnOwnerArranged();
+    void OnOwnerLoaded();
+    void OnOwnerUnloaded();
+
+    int PhasingBacklog() const { return m_phaser.PendingElementCount(); }
+    // Memory held by the pools and tables below. The VirtualizationInfo of each element
+    // is counted by ItemsRepeater::EstimatedBookkeepingBytes.
+    size_t EstimatedBytes() const;
+
+    // False when no element has been handed to the layout as an auto recycle candidate
+    // since the owner last found none left, in which case there is nothing for the
+    // owner's post-measure cleanup to look for.
+    bool HasAutoRecycleCandidates() const { return m_hasAutoRecycleCandidates; }
+    void HasAutoRecycleCandidates(bool value) { m_hasAutoRecycleCandidates = value; }
+
+    // Uses the idle time left in a frame to create up to ItemsRepeater.PrewarmElementCount
+    // containers per template key into the recycle pool, so that realization during the
+    // first scroll is served from the pool instead of loading templates.
+    void SchedulePrewarm();
+
+    struct RealizedElementInfo
+    {
+        RealizedElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element);
+
+        // Copying would allocate new tracker handles, read what you need or move instead.
+        RealizedElementInfo(const RealizedElementInfo&) = delete;
+        RealizedElementInfo& operator=(const RealizedElementInfo&) = delete;
+        RealizedElementInfo(RealizedElementInfo&&) = default;
+        RealizedElementInfo& operator=(RealizedElementInfo&&) = default;
+
+        winrt::UIElement Element() const { return m_element.get(); }
+        winrt::com_ptr<VirtualizationInfo> VirtualizationInfo() const { return m_virtInfo.get(); }
+
+    private:
+        tracker_ref<winrt::UIElement> m_element;
+
+        // We hold on VirtualizationInfo to make sure we can
+        // quickly access its content rather than go through
+        // ItemsRepeater.GetVirtualizationInfo(element) which is
+        // slower (assuming it's implemented using attached
+        // properties).
+        tracker_com_ref<::VirtualizationInfo> m_virtInfo;
+    };
+
+    // The realized elements (held by layout or pinned) ordered by index. Kept up to date as
+    // elements are realized and cleared so that tab focus and automation don't have to sort
+    // the children on every query.
+    const std::vector<RealizedElementInfo>& RealizedElementsInIndexOrder();
 
 private:
 #pragma region GetElement providers
@@ -54,38 +103,57 @@ private:
     void EnsureEventSubscriptions();
 
     void UpdateElementIndex(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo, int index);
+    // Moves the indices of realized elements at or after startIndex by delta. When nobody
+    // listens to ElementIndexChanged the shift is recorded in m_indexShiftLog instead of
+    // visiting every child.
+    void ShiftRealizedElementIndices(int startIndex, int delta);
+    void FlushIndexShifts();
 
-    void InvalidateRealizedIndicesHeldByLayout();
-    void EnsureFirstLastRealizedIndices();
-
-    struct PinnedElementInfo
-    {
-        PinnedElementInfo(const ITrackerHandleManager* owner, const winrt::UIElement& element);
+    void OnPrewarmCallback();
+    bool PrewarmElement(int countPerKey);
 
-        winrt::UIElement PinnedElement() const { return m_pinnedElement.get(); }
-        winrt::com_ptr<VirtualizationInfo> VirtualizationInfo() const { return m_virtInfo.get(); }
+    // Removes the entry at position from the pinned pool by swapping the last entry into its place.
+    void RemoveFromPinnedPool(size_t position);
+    int FindInPinnedPool(int index);
+    void EnsurePinnedPoolIndexMap();
 
-    private:
-        tracker_ref<winrt::UIElement> m_pinnedElement;
+    void AddToRealizedElements(const winrt::UIElement& element);
+    void RemoveFromRealizedElements(const winrt::UIElement& element, int index);
 
-        // We hold on VirtualizationInfo to make sure we can
-        // quickly access its content rather than go through
-        // ItemsRepeater.GetVirtualizationInfo(element) which is
-        // slower (assuming it's implemented using attached
-        // properties).
-        tracker_com_ref<::VirtualizationInfo> m_virtInfo;
-    };
+    void InvalidateRealizedIndicesHeldByLayout();
+    void EnsureFirstLastRealizedIndices();
 
     ItemsRepeater* m_owner{ nullptr };
 
     // Pinned elements that are currently owned by layout are *NOT* in this pool.
-    std::vector<PinnedElementInfo> m_pinnedPool;
+    // The pool is unordered, see RemoveFromPinnedPool.
+    std::vector<RealizedElementInfo> m_pinnedPool;
+    // Maps the data index of each pinned element to its position in m_pinnedPool.
+    // Collection changes shift the indices of pinned elements, so instead of keeping
+    // the map in sync we invalidate it and rebuild it on the next lookup.
+    std::unordered_map<int /* index */, size_t /* position */> m_pinnedPoolIndexMap;
+    bool m_isPinnedPoolIndexMapValid{ true };
+    // Set when a pin is released. Otherwise nothing in the pinned pool can have lost
+    // its reason to be pinned and PrunePinnedElements has nothing to do.
+    bool m_hasPendingUnpin{};
     UniqueIdElementPool m_resetPool;
 
+    // Sorted by index, except after collection changes that moved indices past each other (e.g. a
+    // remove that the layout keeps an element for). RealizedElementsInIndexOrder restores the order.
+    std::vector<RealizedElementInfo> m_realizedElements;
+
+    // Shared with the VirtualizationInfo of every element realized by this view manager.
+    std::shared_ptr<ElementIndexShiftLog> m_indexShiftLog{ std::make_shared<ElementIndexShiftLog>() };
+    // Every pending shift is replayed on each index read, so the log is flushed
+    // once it gets this long.
+    static constexpr size_t MaxPendingIndexShifts = 32u;
+
     // _lastFocusedElement is listed in _pinnedPool.
     // It has to be an element we own (i.e. a direct child).
     tracker_ref<winrt::UIElement> m_lastFocusedElement;
     bool m_isDataSourceStableResetPending{};
+    bool m_hasAutoRecycleCandidates{};
+    BuildTreeWorkToken m_prewarmWorkToken{ 0u };
 
     // Event tokens
     winrt::event_token m_gotFocus{};
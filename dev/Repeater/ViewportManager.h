@@ -11,6 +11,9 @@ public:
     virtual double VerticalCacheLength() const = 0;
     virtual void VerticalCacheLength(double value) = 0;
 
+    virtual bool IsDirectionalCacheEnabled() const = 0;
+    virtual void IsDirectionalCacheEnabled(bool value) = 0;
+
     virtual winrt::Rect GetLayoutVisibleWindow() const = 0;
     virtual winrt::Rect GetLayoutRealizationWindow() const = 0;
 
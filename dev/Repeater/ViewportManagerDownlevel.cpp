@@ -6,6 +6,7 @@
 #include "ItemsRepeater.common.h"
 #include "ViewportManagerDownLevel.h"
 #include "ItemsRepeater.h"
+#include "Scroller.h"
 #include "layout.h"
 
 // Pixel delta by which to inflate the cache buffer on each side.  Rather than fill the entire
@@ -132,6 +133,10 @@ void ViewportManagerDownLevel::SetLayoutExtent(winrt::Rect extent)
     {
         REPEATER_TRACE_INFO(L"%ls: \tExpecting viewport shift of (%.0f,%.0f) \n",
             GetLayoutId().data(), m_expectedViewportShift.X, m_expectedViewportShift.Y);
+
+        // The content is about to move under the viewport, what we realized
+        // no longer tells us what the viewport will show.
+        m_isLastMeasureRealizationWindowValid = false;
     }
 
     m_layoutExtent = extent;
@@ -148,6 +153,7 @@ void ViewportManagerDownLevel::OnLayoutChanged()
 {
     m_layoutExtent = {};
     m_expectedViewportShift = {};
+    m_isLastMeasureRealizationWindowValid = false;
     ResetCacheBuffer();
 }
 
@@ -164,6 +170,17 @@ void ViewportManagerDownLevel::OnElementCleared(const winrt::UIElement& element)
     }
 }
 
+void ViewportManagerDownLevel::OnOwnerMeasuring()
+{
+    // Layout is about to realize content for the current realization window.
+    m_isLastMeasureRealizationWindowValid = HasScrollers() && m_visibleWindow != winrt::Rect() && !m_makeAnchorElement;
+    m_lastMeasureRealizationWindow = winrt::Rect{
+        m_visibleWindow.X - static_cast<float>(m_horizontalCacheBufferPerSide),
+        m_visibleWindow.Y - static_cast<float>(m_verticalCacheBufferPerSide),
+        m_visibleWindow.Width + static_cast<float>(m_horizontalCacheBufferPerSide) * 2.0f,
+        m_visibleWindow.Height + static_cast<float>(m_verticalCacheBufferPerSide) * 2.0f };
+}
+
 void ViewportManagerDownLevel::OnOwnerArranged()
 {
     m_expectedViewportShift = {};
@@ -219,6 +236,7 @@ void ViewportManagerDownLevel::ResetScrollers()
         scroller.ConfigurationChanged(scrollerInfo.ConfigurationChangedToken());
         if (scrollerInfo.ViewportChangedToken().value != 0) { scroller.ViewportChanged(scrollerInfo.ViewportChangedToken()); };
         if (scrollerInfo.PostArrangeToken().value != 0) { scroller.PostArrange(scrollerInfo.PostArrangeToken()); };
+        if (scrollerInfo.IsViewListener()) { GetNativeScroller(scroller)->RemoveViewListener(this); };
     }
     m_parentScrollers.clear();
     m_horizontalScroller.set(nullptr);
@@ -226,6 +244,7 @@ void ViewportManagerDownLevel::ResetScrollers()
     m_innerScrollableScroller.set(nullptr);
 
     m_ensuredScrollers = false;
+    m_isLastMeasureRealizationWindowValid = false;
 }
 
 void ViewportManagerDownLevel::OnCacheBuildActionCompleted()
@@ -236,14 +255,30 @@ void ViewportManagerDownLevel::OnCacheBuildActionCompleted()
 
 void ViewportManagerDownLevel::OnViewportChanged(const winrt::IRepeaterScrollingSurface&, const bool isFinal)
 {
+    ProcessViewportChange(isFinal);
+}
+
+void ViewportManagerDownLevel::OnScrollerViewChanged(const ScrollerViewState& viewState)
+{
+    ProcessViewportChange(viewState.isFinal);
+}
+
+void ViewportManagerDownLevel::ProcessViewportChange(const bool isFinal)
+{
+    // Read the new viewport from the scroller now rather than invalidating measure
+    // and waiting for the next post arrange to find out where we are. UpdateViewport
+    // only invalidates measure if the new window is not covered by realized content.
+    UpdateViewport();
+
     if (isFinal)
     {
         // Note that isFinal will never be true for input based manipulations.
         m_makeAnchorElement.set(nullptr);
         m_isAnchorOutsideRealizedRange = false;
-    }
 
-    TryInvalidateMeasure();
+        // Let layout recenter the realization window around where we stopped.
+        TryInvalidateMeasure();
+    }
 }
 
 void ViewportManagerDownLevel::OnPostArrange(const winrt::IRepeaterScrollingSurface&)
@@ -337,11 +372,21 @@ bool ViewportManagerDownLevel::AddScroller(const winrt::IRepeaterScrollingSurfac
     if (setVerticalScroller) { m_verticalScroller.set(scroller); }
     if (setInnerScrollableScroller) { m_innerScrollableScroller.set(scroller); }
 
+    const bool listenToViewport = setHorizontalScroller || setVerticalScroller;
+    Scroller* nativeScroller = listenToViewport ? GetNativeScroller(scroller) : nullptr;
+
+    if (nativeScroller)
+    {
+        // Avoid the projected event for this dll's Scroller.
+        nativeScroller->AddViewListener(this);
+    }
+
     m_parentScrollers.push_back(ScrollerInfo(
         m_owner,
         scroller,
-        setHorizontalScroller || setVerticalScroller ? scroller.ViewportChanged({ this, &ViewportManagerDownLevel::OnViewportChanged }) : winrt::event_token{},
-        scroller.ConfigurationChanged({ this, &ViewportManagerDownLevel::OnConfigurationChanged })));
+        listenToViewport && !nativeScroller ? scroller.ViewportChanged({ this, &ViewportManagerDownLevel::OnViewportChanged }) : winrt::event_token{},
+        scroller.ConfigurationChanged({ this, &ViewportManagerDownLevel::OnConfigurationChanged }),
+        nativeScroller != nullptr));
 
     return allScrollersSet;
 }
@@ -391,12 +436,34 @@ void ViewportManagerDownLevel::UpdateViewport()
         m_visibleWindow.Width != previousVisibleWindow.Width ||
         m_visibleWindow.Height != previousVisibleWindow.Height;
 
-    if (viewportChanged)
+    if (viewportChanged && !IsVisibleWindowCoveredByRealizedContent())
     {
         TryInvalidateMeasure();
     }
 }
 
+bool ViewportManagerDownLevel::IsVisibleWindowCoveredByRealizedContent() const
+{
+    if (!m_isLastMeasureRealizationWindowValid ||
+        m_makeAnchorElement ||
+        m_visibleWindow == winrt::Rect())
+    {
+        return false;
+    }
+
+    // Measure again before the viewport gets within half a cache buffer of the edge
+    // of what was realized, so the next elements are ready by the time they show up.
+    const auto marginX = static_cast<float>(m_horizontalCacheBufferPerSide) / 2.0f;
+    const auto marginY = static_cast<float>(m_verticalCacheBufferPerSide) / 2.0f;
+    const auto& realized = m_lastMeasureRealizationWindow;
+
+    return
+        m_visibleWindow.X - marginX >= realized.X &&
+        m_visibleWindow.Y - marginY >= realized.Y &&
+        m_visibleWindow.X + m_visibleWindow.Width + marginX <= realized.X + realized.Width &&
+        m_visibleWindow.Y + m_visibleWindow.Height + marginY <= realized.Y + realized.Height;
+}
+
 void ViewportManagerDownLevel::ResetCacheBuffer()
 {
     m_horizontalCacheBufferPerSide = 0.0;
@@ -447,6 +514,17 @@ void ViewportManagerDownLevel::TryInvalidateMeasure()
     }
 }
 
+// Returns the implementation of the provided scrolling surface when it is this dll's Scroller, and nullptr otherwise.
+Scroller* ViewportManagerDownLevel::GetNativeScroller(const winrt::IRepeaterScrollingSurface& scroller)
+{
+    if (const auto scrollerAsScroller = scroller.try_as<winrt::Scroller>())
+    {
+        return winrt::get_self<::Scroller>(scrollerAsScroller);
+    }
+
+    return nullptr;
+}
+
 winrt::IRepeaterScrollingSurface ViewportManagerDownLevel::GetOuterScroller() const
 {
     winrt::IRepeaterScrollingSurface scroller = nullptr;
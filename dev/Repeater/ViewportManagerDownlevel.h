@@ -3,15 +3,17 @@
 
 #pragma once
 #include "ViewportManager.h"
+#include "ScrollerViewListener.h"
 
 class ItemsRepeater;
+class Scroller;
 
 // Manages virtualization windows (visible/realization). 
 // This class does the equivalent behavior as ViewportManagerWithPlatformFeatures class
 // except that here we do not use EffectiveViewport and ScrollAnchoring features added to the framework in RS5. 
 // Instead we use the IRepeaterScrollingSurface internal API. This class is used when building in MUX and 
 // should work down-level.
-class ViewportManagerDownLevel : public ViewportManager
+class ViewportManagerDownLevel : public ViewportManager, public IScrollerViewListener
 {
 public:
     ViewportManagerDownLevel(ItemsRepeater* owner);
@@ -24,6 +26,11 @@ public:
     double VerticalCacheLength() const override { return m_maximumVerticalCacheLength; }
     void VerticalCacheLength(double value) override;
 
+    // The downlevel scrolling surface does not give us a reliable way to track velocity,
+    // so the cache buffer stays symmetric here.
+    bool IsDirectionalCacheEnabled() const override { return m_isDirectionalCacheEnabled; }
+    void IsDirectionalCacheEnabled(bool value) override { m_isDirectionalCacheEnabled = value; }
+
     winrt::Rect GetLayoutVisibleWindow() const override;
     winrt::Rect GetLayoutRealizationWindow() const override;
 
@@ -33,7 +40,7 @@ public:
     void OnLayoutChanged() override;
     void OnElementPrepared(const winrt::UIElement& element) override {}
     void OnElementCleared(const winrt::UIElement& element) override;
-    void OnOwnerMeasuring() override {};
+    void OnOwnerMeasuring() override;
     void OnOwnerArranged() override;
     void OnMakeAnchor(const winrt::UIElement& anchor, const bool isAnchorOutsideRealizedRange) override;
     void OnBringIntoViewRequested(const winrt::BringIntoViewRequestedEventArgs args) override;
@@ -42,11 +49,14 @@ public:
 
     winrt::UIElement MadeAnchor() const override { return m_makeAnchorElement.get(); }
 
+    void OnScrollerViewChanged(const ScrollerViewState& viewState) override;
+
 private:
     struct ScrollerInfo;
 
     void OnCacheBuildActionCompleted();
     void OnViewportChanged(const winrt::IRepeaterScrollingSurface& sender, const bool isFinal);
+    void ProcessViewportChange(const bool isFinal);
     void OnPostArrange(const winrt::IRepeaterScrollingSurface& sender);
     void OnConfigurationChanged(const winrt::IRepeaterScrollingSurface& sender);
 
@@ -54,11 +64,13 @@ private:
     bool HasScrollers() const { return !!m_horizontalScroller || !!m_verticalScroller; }
     bool AddScroller(const winrt::IRepeaterScrollingSurface& scroller);
     void UpdateViewport();
+    bool IsVisibleWindowCoveredByRealizedContent() const;
     void ResetCacheBuffer();
     void ValidateCacheLength(double cacheLength);
     void RegisterCacheBuildWork();
     void TryInvalidateMeasure();
     winrt::IRepeaterScrollingSurface GetOuterScroller() const;
+    static Scroller* GetNativeScroller(const winrt::IRepeaterScrollingSurface& scroller);
 
     winrt::hstring GetLayoutId();
 
@@ -88,9 +100,16 @@ private:
     winrt::Rect m_layoutExtent{};
     winrt::Point m_expectedViewportShift{};
 
+    // Realization window (in the same coordinates as m_visibleWindow) that the last
+    // measure pass realized content for. While the visible window stays well inside it,
+    // viewport changes don't need a new measure pass.
+    winrt::Rect m_lastMeasureRealizationWindow{};
+    bool m_isLastMeasureRealizationWindowValid{ false };
+
     // Realization window cache fields
     double m_maximumHorizontalCacheLength{ 2.0 };
     double m_maximumVerticalCacheLength{ 2.0 };
+    bool m_isDirectionalCacheEnabled{ false };
     double m_horizontalCacheBufferPerSide{};
     double m_verticalCacheBufferPerSide{};
 
@@ -100,7 +119,8 @@ private:
 
     // Stores information about a parent scrolling surface.
     // We subscribe to...
-    // - ViewportChanged only on scrollers that are scrollable in at least one direction.
+    // - ViewportChanged only on scrollers that are scrollable in at least one direction. For this dll's
+    //   Scroller, a native IScrollerViewListener registration is used instead of the event.
     // - ConfigurationChanged on all scrollers.
     // - PostArrange only on the outer most scroller, because we need to wait for that one
     //   to arrange its children before we can reliably figure out our relative viewport.
@@ -110,10 +130,12 @@ private:
             const ITrackerHandleManager* owner,
             winrt::IRepeaterScrollingSurface scroller,
             winrt::event_token viewportChangedToken,
-            winrt::event_token configurationChangedToken) :
+            winrt::event_token configurationChangedToken,
+            bool isViewListener) :
             m_scroller(owner, scroller),
             m_viewportChangedToken(viewportChangedToken),
-            m_configurationChangedToken(configurationChangedToken)
+            m_configurationChangedToken(configurationChangedToken),
+            m_isViewListener(isViewListener)
         { }
 
         winrt::IRepeaterScrollingSurface Scroller() const
@@ -141,10 +163,16 @@ private:
             return m_configurationChangedToken;
         }
 
+        bool IsViewListener() const
+        {
+            return m_isViewListener;
+        }
+
     private:
         tracker_ref<winrt::IRepeaterScrollingSurface> m_scroller;
         winrt::event_token m_viewportChangedToken{};
         winrt::event_token m_postArrangeToken{};
         winrt::event_token m_configurationChangedToken{};
+        bool m_isViewListener{ false };
     };
 };
@@ -14,6 +14,18 @@
 // properties.
 constexpr double CacheBufferPerSideInflationPixelDelta = 40.0;
 
+// When the directional cache is enabled, the share of the cache buffer moved from the
+// trailing side to the leading side grows with the scroll velocity and reaches
+// MaximumCacheBias when scrolling a viewport's length in FullCacheBiasDurationInMs.
+// The total buffer, and so the number of realized elements, does not change.
+constexpr double MaximumCacheBias = 0.75;
+constexpr double FullCacheBiasDurationInMs = 250.0;
+// Viewport updates further apart than this are not part of the same scroll.
+constexpr int ScrollVelocityTimeoutInMs = 150;
+// A viewport change does not need a new layout pass while the visible window stays inside the
+// last realization window with at least this fraction of the cache buffer left on each side.
+constexpr double RealizationHysteresisRatio = 0.5;
+
 ViewportManagerWithPlatformFeatures::ViewportManagerWithPlatformFeatures(ItemsRepeater* owner) :
     m_owner(owner),
     m_scroller(owner),
@@ -80,6 +92,17 @@ void ViewportManagerWithPlatformFeatures::VerticalCacheLength(double value)
     }
 }
 
+void ViewportManagerWithPlatformFeatures::IsDirectionalCacheEnabled(bool value)
+{
+    if (m_isDirectionalCacheEnabled != value)
+    {
+        m_isDirectionalCacheEnabled = value;
+        m_scrollVelocity = {};
+        m_viewportUpdateTimer.Reset();
+        TryInvalidateMeasure();
+    }
+}
+
 winrt::Rect ViewportManagerWithPlatformFeatures::GetLayoutVisibleWindow() const
 {
     auto visibleWindow = m_visibleWindow;
@@ -107,8 +130,11 @@ winrt::Rect ViewportManagerWithPlatformFeatures::GetLayoutRealizationWindow() co
     auto realizationWindow = GetLayoutVisibleWindow();
     if (HasScroller())
     {
-        realizationWindow.X -= static_cast<float>(m_horizontalCacheBufferPerSide);
-        realizationWindow.Y -= static_cast<float>(m_verticalCacheBufferPerSide);
+        // The leading side gets (1 + bias) of a side's buffer and the trailing side (1 - bias).
+        const double horizontalBias = GetCacheBias(m_scrollVelocity.X, m_visibleWindow.Width);
+        const double verticalBias = GetCacheBias(m_scrollVelocity.Y, m_visibleWindow.Height);
+        realizationWindow.X -= static_cast<float>(m_horizontalCacheBufferPerSide * (1.0 - horizontalBias));
+        realizationWindow.Y -= static_cast<float>(m_verticalCacheBufferPerSide * (1.0 - verticalBias));
         realizationWindow.Width += static_cast<float>(m_horizontalCacheBufferPerSide) * 2.0f;
         realizationWindow.Height += static_cast<float>(m_verticalCacheBufferPerSide) * 2.0f;
     }
@@ -181,8 +207,26 @@ void ViewportManagerWithPlatformFeatures::OnOwnerMeasuring()
 
 void ViewportManagerWithPlatformFeatures::OnOwnerArranged()
 {
+    // Captured before the expected shift is cleared and the cache grows below, this
+    // is the window the layout just realized.
+    m_lastLayoutRealizationWindow = GetLayoutRealizationWindow();
     m_expectedViewportShift = {};
 
+    if (m_scrollVelocity != winrt::Point{})
+    {
+        if (m_viewportUpdateTimer.DurationInMilliSeconds() > ScrollVelocityTimeoutInMs)
+        {
+            // Scrolling stopped, go back to a symmetric cache buffer.
+            m_scrollVelocity = {};
+            TryInvalidateMeasure();
+        }
+        else
+        {
+            // Come back once the UI thread is idle to see if scrolling stopped.
+            RegisterCacheBuildWork();
+        }
+    }
+
     // This is because of a bug that causes effective viewport to not 
     // fire if you register during arrange.
     // Bug 17411076: EffectiveViewport: registering for effective viewport in arrange should invalidate viewport
@@ -331,21 +375,64 @@ void ViewportManagerWithPlatformFeatures::UpdateViewport(winrt::Rect const& view
             GetLayoutId().data(),
             previousVisibleWindow.X, previousVisibleWindow.Y, previousVisibleWindow.Width, previousVisibleWindow.Height,
             currentVisibleWindow.X, currentVisibleWindow.Y, currentVisibleWindow.Width, currentVisibleWindow.Height);
+        if (m_isDirectionalCacheEnabled)
+        {
+            UpdateScrollVelocity(previousVisibleWindow, currentVisibleWindow);
+        }
         m_visibleWindow = currentVisibleWindow;
     }
 
-    TryInvalidateMeasure();
+    if (IsVisibleWindowCoveredByLastRealization(previousVisibleWindow))
+    {
+        REPEATER_TRACE_INFO(L"%ls: \tVisible window still covered by the realized range. \n", GetLayoutId().data());
+    }
+    else
+    {
+        TryInvalidateMeasure();
+    }
 }
 
 void ViewportManagerWithPlatformFeatures::ResetCacheBuffer()
 {
     m_horizontalCacheBufferPerSide = 0.0;
     m_verticalCacheBufferPerSide = 0.0;
+    m_lastLayoutRealizationWindow = {};
 
     // We need to start building the realization buffer again.
     RegisterCacheBuildWork();
 }
 
+void ViewportManagerWithPlatformFeatures::UpdateScrollVelocity(const winrt::Rect& previousVisibleWindow, const winrt::Rect& currentVisibleWindow)
+{
+    const int elapsedInMs = m_viewportUpdateTimer.DurationInMilliSeconds();
+    m_viewportUpdateTimer.Reset();
+
+    if (previousVisibleWindow == winrt::Rect{} || elapsedInMs > ScrollVelocityTimeoutInMs)
+    {
+        // Start of a new scroll, there is nothing to compare against yet.
+        m_scrollVelocity = {};
+        return;
+    }
+
+    // Smooth the samples, effective viewport changes do not arrive at a steady rate.
+    const float elapsed = static_cast<float>(std::max(elapsedInMs, 1));
+    const float velocityX = (currentVisibleWindow.X - previousVisibleWindow.X) / elapsed;
+    const float velocityY = (currentVisibleWindow.Y - previousVisibleWindow.Y) / elapsed;
+    m_scrollVelocity.X = (m_scrollVelocity.X + velocityX) / 2.0f;
+    m_scrollVelocity.Y = (m_scrollVelocity.Y + velocityY) / 2.0f;
+}
+
+double ViewportManagerWithPlatformFeatures::GetCacheBias(double velocity, double viewportLength) const
+{
+    if (!m_isDirectionalCacheEnabled || viewportLength <= 0.0)
+    {
+        return 0.0;
+    }
+
+    const double bias = velocity * FullCacheBiasDurationInMs / viewportLength;
+    return std::clamp(bias, -1.0, 1.0) * MaximumCacheBias;
+}
+
 void ViewportManagerWithPlatformFeatures::ValidateCacheLength(double cacheLength)
 {
     if (cacheLength < 0.0 || std::isinf(cacheLength) || std::isnan(cacheLength))
@@ -373,6 +460,44 @@ void ViewportManagerWithPlatformFeatures::RegisterCacheBuildWork()
     }
 }
 
+bool ViewportManagerWithPlatformFeatures::IsVisibleWindowCoveredByLastRealization(const winrt::Rect& previousVisibleWindow) const
+{
+    // Resizes, pending shifts and anchors all need a layout pass, and custom layouts
+    // may care about the viewport for more than realization.
+    if (!HasScroller() ||
+        m_makeAnchorElement ||
+        m_pendingViewportShift != winrt::Point{} ||
+        m_visibleWindow == winrt::Rect{} ||
+        m_lastLayoutRealizationWindow == winrt::Rect{} ||
+        m_visibleWindow.Width != previousVisibleWindow.Width ||
+        m_visibleWindow.Height != previousVisibleWindow.Height ||
+        !IsBuiltInLayout())
+    {
+        return false;
+    }
+
+    const auto visibleWindow = GetLayoutVisibleWindow();
+    const auto& realized = m_lastLayoutRealizationWindow;
+    const float horizontalMargin = static_cast<float>(m_horizontalCacheBufferPerSide * RealizationHysteresisRatio);
+    const float verticalMargin = static_cast<float>(m_verticalCacheBufferPerSide * RealizationHysteresisRatio);
+
+    return
+        visibleWindow.X - horizontalMargin >= realized.X &&
+        visibleWindow.Y - verticalMargin >= realized.Y &&
+        visibleWindow.X + visibleWindow.Width + horizontalMargin <= realized.X + realized.Width &&
+        visibleWindow.Y + visibleWindow.Height + verticalMargin <= realized.Y + realized.Height;
+}
+
+bool ViewportManagerWithPlatformFeatures::IsBuiltInLayout() const
+{
+    // These only use the viewport to pick the realized range.
+    const auto layout = m_owner->Layout();
+    return layout &&
+        (layout.try_as<winrt::StackLayout>() ||
+         layout.try_as<winrt::UniformGridLayout>() ||
+         layout.try_as<winrt::FlowLayout>());
+}
+
 void ViewportManagerWithPlatformFeatures::TryInvalidateMeasure()
 {
     // Don't invalidate measure if we have an invalid window.
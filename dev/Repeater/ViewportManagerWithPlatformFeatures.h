@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ViewportManager.h"
+#include "QPCTimer.h"
 
 class ItemsRepeater;
 
@@ -26,6 +27,9 @@ public:
     double VerticalCacheLength() const override { return m_maximumVerticalCacheLength; }
     void VerticalCacheLength(double value) override;
 
+    bool IsDirectionalCacheEnabled() const override { return m_isDirectionalCacheEnabled; }
+    void IsDirectionalCacheEnabled(bool value) override;
+
     winrt::Rect GetLayoutVisibleWindow() const override;
     winrt::Rect GetLayoutRealizationWindow() const override;
 
@@ -55,9 +59,13 @@ private:
     bool HasScroller() const { return m_scroller != nullptr; }
     void UpdateViewport(winrt::Rect const& args);
     void ResetCacheBuffer();
+    void UpdateScrollVelocity(const winrt::Rect& previousVisibleWindow, const winrt::Rect& currentVisibleWindow);
+    double GetCacheBias(double velocity, double viewportLength) const;
     void ValidateCacheLength(double cacheLength);
     void RegisterCacheBuildWork();
     void TryInvalidateMeasure();
+    bool IsVisibleWindowCoveredByLastRealization(const winrt::Rect& previousVisibleWindow) const;
+    bool IsBuiltInLayout() const;
     
     winrt::hstring GetLayoutId() const;
 
@@ -85,6 +93,14 @@ private:
     double m_maximumVerticalCacheLength{ 2.0 };
     double m_horizontalCacheBufferPerSide{};
     double m_verticalCacheBufferPerSide{};
+    // Realization window the layout ran with during the last layout pass, in layout coordinates.
+    winrt::Rect m_lastLayoutRealizationWindow{};
+
+    // Directional cache fields. The velocity (pixels per millisecond) is estimated from
+    // consecutive effective viewports so it works with any scroller.
+    bool m_isDirectionalCacheEnabled{ false };
+    winrt::Point m_scrollVelocity{};
+    QPCTimer m_viewportUpdateTimer{};
 
     // Event tokens
     winrt::FrameworkElement::EffectiveViewportChanged_revoker m_effectiveViewportChangedRevoker{};
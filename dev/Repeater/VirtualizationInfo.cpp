@@ -38,6 +38,27 @@ void VirtualizationInfo::UpdatePhasingInfo(int phase, const winrt::IInspectable&
     m_dataTemplateComponent = winrt::make_weak(component);
 }
 
+bool VirtualizationInfo::IsBoundTo(const winrt::IInspectable& data, int index) const
+{
+    return data && m_boundIndex == index && m_boundData.get() == data;
+}
+
+void VirtualizationInfo::BoundTo(const winrt::IInspectable& data, int index)
+{
+    // Items that can't be weakly referenced (or no item at all) are never considered
+    // bound, the element just goes through the regular binding path next time.
+    if (data && data.try_as<::IWeakReferenceSource>())
+    {
+        m_boundData = winrt::make_weak(data);
+        m_boundIndex = index;
+    }
+    else
+    {
+        m_boundData = nullptr;
+        m_boundIndex = -1;
+    }
+}
+
 #pragma region Ownership state machine
 
 void VirtualizationInfo::MoveOwnershipToLayoutFromElementFactory(int index, wstring_view uniqueId)
@@ -50,12 +71,14 @@ void VirtualizationInfo::MoveOwnershipToLayoutFromElementFactory(int index, wstr
 
 void VirtualizationInfo::MoveOwnershipToLayoutFromUniqueIdResetPool()
 {
+    ResolveIndexShifts();
     MUX_ASSERT(m_owner == ElementOwner::UniqueIdResetPool);
     m_owner = ElementOwner::Layout;
 }
 
 void VirtualizationInfo::MoveOwnershipToLayoutFromPinnedPool()
 {
+    ResolveIndexShifts();
     MUX_ASSERT(m_owner == ElementOwner::PinnedPool);
     MUX_ASSERT(IsPinned());
     m_owner = ElementOwner::Layout;
@@ -67,12 +90,14 @@ void VirtualizationInfo::MoveOwnershipToElementFactory()
     m_owner = ElementOwner::ElementFactory;
     m_pinCounter = 0u;
     m_index = -1;
+    m_indexShiftLog = nullptr;
     m_uniqueId.clear();
     m_arrangeBounds = ItemsRepeater::InvalidRect;
 }
 
 void VirtualizationInfo::MoveOwnershipToUniqueIdResetPoolFromLayout()
 {
+    ResolveIndexShifts();
     MUX_ASSERT(m_owner == ElementOwner::Layout);
     m_owner = ElementOwner::UniqueIdResetPool;
     // Keep the pinCounter the same. If the container survives the reset
@@ -87,11 +112,13 @@ void VirtualizationInfo::MoveOwnershipToAnimator()
     MUX_ASSERT(m_owner == ElementOwner::Layout || m_owner == ElementOwner::UniqueIdResetPool);
     m_owner = ElementOwner::Animator;
     m_index = -1;
+    m_indexShiftLog = nullptr;
     m_pinCounter = 0u;
 }
 
 void VirtualizationInfo::MoveOwnershipToPinnedPool()
 {
+    ResolveIndexShifts();
     MUX_ASSERT(m_owner == ElementOwner::Layout);
     m_owner = ElementOwner::PinnedPool;
 }
@@ -126,5 +153,43 @@ unsigned VirtualizationInfo::RemovePin()
 void VirtualizationInfo::UpdateIndex(int newIndex)
 {
     MUX_ASSERT(IsRealized());
+    ResolveIndexShifts();
     m_index = newIndex;
 }
+
+void VirtualizationInfo::TrackIndexShifts(const std::shared_ptr<ElementIndexShiftLog>& log)
+{
+    ResolveIndexShifts();
+    m_indexShiftLog = log;
+    m_indexShiftPosition = log->Count();
+    m_indexShiftEpoch = log->Epoch();
+}
+
+void VirtualizationInfo::ResolveIndexShifts() const
+{
+    if (m_indexShiftLog)
+    {
+        const auto& log = *m_indexShiftLog;
+        if (m_indexShiftEpoch != log.Epoch())
+        {
+            // The log was cleared after every realized element caught up,
+            // so this element was not realized since it last looked.
+            MUX_ASSERT(!IsRealized());
+            m_indexShiftEpoch = log.Epoch();
+            m_indexShiftPosition = 0u;
+        }
+
+        const size_t count = log.Count();
+        if (m_indexShiftPosition < count)
+        {
+            // Collection changes only move the indices of realized elements.
+            // Ownership changes resolve first, so the current owner is the one
+            // the element had when these shifts were added.
+            if (IsRealized())
+            {
+                m_index = log.Apply(m_index, m_indexShiftPosition);
+            }
+            m_indexShiftPosition = count;
+        }
+    }
+}
@@ -21,15 +21,55 @@ enum class ElementOwner
     Animator
 };
 
+// Index shifts caused by collection changes that have not been written to the
+// realized elements yet. A VirtualizationInfo that tracks the log catches up the
+// next time its index is read, so an insert before the realized range does not
+// have to visit every child.
+class ElementIndexShiftLog
+{
+public:
+    // Indices greater than or equal to startIndex move by delta.
+    void Add(int startIndex, int delta) { m_shifts.push_back({ startIndex, delta }); }
+    // Callers must bring every realized element up to date before clearing the log.
+    void Clear() { m_shifts.clear(); ++m_epoch; }
+
+    size_t Count() const { return m_shifts.size(); }
+    unsigned Epoch() const { return m_epoch; }
+    size_t EstimatedBytes() const { return sizeof(*this) + m_shifts.capacity() * sizeof(Shift); }
+
+    int Apply(int index, size_t from) const
+    {
+        for (size_t i = from; i < m_shifts.size(); ++i)
+        {
+            if (index >= m_shifts[i].startIndex)
+            {
+                index += m_shifts[i].delta;
+            }
+        }
+        return index;
+    }
+
+private:
+    struct Shift
+    {
+        int startIndex;
+        int delta;
+    };
+
+    std::vector<Shift> m_shifts;
+    unsigned m_epoch{ 0u };
+};
+
 // Would be nice to have this be part of UIElement similar to how MCBP does it.
-// That would make the lookups much more performant than an attached property.
+// Until then, the attached property only ties the lifetime to the element and
+// lookups go through a side table (see ItemsRepeater::TryGetVirtualizationInfo).
 class VirtualizationInfo : public winrt::implements<VirtualizationInfo, winrt::IInspectable>
 {
 public:
     VirtualizationInfo();
 
     ElementOwner Owner() const { return m_owner; }
-    int Index() const { return m_index; }
+    int Index() const { ResolveIndexShifts(); return m_index; }
 
     // Pinned means that the element is protected from getting cleared by layout.
     // A pinned element may still get cleared by a collection change.
@@ -48,6 +88,11 @@ public:
     winrt::IInspectable Data() const { return m_data.get(); }
     winrt::IDataTemplateComponent DataTemplateComponent() const { return m_dataTemplateComponent.get(); }
 
+    // Item and index the element's bindings were last fully applied for. Survives
+    // recycling so that an element given back for the same item can skip rebinding.
+    bool IsBoundTo(const winrt::IInspectable& data, int index) const;
+    void BoundTo(const winrt::IInspectable& data, int index);
+
     static constexpr int PhaseNotSpecified = std::numeric_limits<int>::min();
     static constexpr int PhaseReachedEnd = -1;
 
@@ -67,12 +112,17 @@ public:
     unsigned RemovePin();
 
     void UpdateIndex(int newIndex);
+    // Shifts added to the log from now on apply to this element while it is realized.
+    void TrackIndexShifts(const std::shared_ptr<ElementIndexShiftLog>& log);
 
     winrt::Rect ArrangeBounds() const { return m_arrangeBounds; }
     void ArrangeBounds(winrt::Rect value) { m_arrangeBounds = value; }
 
     wstring_view UniqueId() const { return m_uniqueId; }
 
+    // The unique id is counted here, UniqueIdElementPool shares the same hstring.
+    size_t EstimatedBytes() const { return sizeof(*this) + m_uniqueId.size() * sizeof(wchar_t); }
+
 #pragma region Keep element from being recycled
     bool KeepAlive() { return m_keepAlive; }
     void KeepAlive(bool value) { m_keepAlive = value; }
@@ -82,8 +132,14 @@ public:
     void AutoRecycleCandidate(bool value) { m_autoRecycleCandidate = value; }
 
 private:
+    void ResolveIndexShifts() const;
+
     unsigned m_pinCounter{ 0u };
-    int m_index{ -1 };
+    // Resolved lazily against m_indexShiftLog, hence mutable.
+    mutable int m_index{ -1 };
+    std::shared_ptr<ElementIndexShiftLog> m_indexShiftLog;
+    mutable size_t m_indexShiftPosition{ 0u };
+    mutable unsigned m_indexShiftEpoch{ 0u };
     winrt::hstring m_uniqueId;
     ElementOwner m_owner{ ElementOwner::ElementFactory };
     winrt::Rect m_arrangeBounds;
@@ -93,4 +149,6 @@ private:
 
     weak_ref<winrt::IInspectable> m_data;
     weak_ref<winrt::IDataTemplateComponent> m_dataTemplateComponent;
+    weak_ref<winrt::IInspectable> m_boundData;
+    int m_boundIndex{ -1 };
 };
\ No newline at end of file
@@ -49,12 +49,47 @@ winrt::ResourceMap ResourceAccessor::GetResourceMap()
     return packageResourceMap.GetSubtree(ResourceAccessor::c_resourceLoc);
 }
 
+// Bumped when the resource context's qualifiers (language, scale, contrast...) change, which
+// invalidates every thread's string cache.
+static std::atomic<uint32_t> s_resourceQualifiersGeneration{ 0 };
+
 winrt::hstring ResourceAccessor::GetLocalizedStringResource(const wstring_view &resourceName)
 {
     static winrt::ResourceMap s_resourceMap = GetResourceMap();
-    static winrt::ResourceContext s_resourceContext = winrt::ResourceContext::GetForViewIndependentUse();
+    static winrt::ResourceContext s_resourceContext = []() {
+        auto context = winrt::ResourceContext::GetForViewIndependentUse();
+        context.QualifierValues().MapChanged([](auto&&, auto&&)
+        {
+            ++s_resourceQualifiersGeneration;
+        });
+        return context;
+    }();
+
+    // Controls ask for the same few strings on every instance, resolving the candidate each time is
+    // the expensive part. The cache is per thread so that no locking is needed.
+    struct StringCache
+    {
+        uint32_t generation{ 0 };
+        std::map<std::wstring, winrt::hstring, std::less<>> strings;
+    };
+    static thread_local StringCache s_stringCache;
+
+    const uint32_t generation = s_resourceQualifiersGeneration;
+    if (s_stringCache.generation != generation)
+    {
+        s_stringCache.strings.clear();
+        s_stringCache.generation = generation;
+    }
+
+    auto it = s_stringCache.strings.find(resourceName);
+    if (it != s_stringCache.strings.end())
+    {
+        return it->second;
+    }
 
-    return s_resourceMap.GetValue(resourceName, s_resourceContext).ValueAsString();
+    auto value = s_resourceMap.GetValue(resourceName, s_resourceContext).ValueAsString();
+    s_stringCache.strings.emplace(std::wstring{ resourceName }, value);
+    return value;
 }
 
 winrt::LoadedImageSurface ResourceAccessor::GetImageSurface(const wstring_view &assetName, winrt::Size imageSize)
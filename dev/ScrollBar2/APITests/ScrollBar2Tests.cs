@@ -19,6 +19,7 @@ using ScrollMode = Microsoft.UI.Xaml.Controls.ScrollMode;
 using ScrollBar2 = Microsoft.UI.Xaml.Controls.ScrollBar2;
 using IScrollController = Microsoft.UI.Xaml.Controls.Primitives.IScrollController;
 using RailingMode = Microsoft.UI.Xaml.Controls.RailingMode;
+using Scroller = Microsoft.UI.Xaml.Controls.Primitives.Scroller;
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 {
@@ -109,5 +110,40 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 scrollBar2AsIScrollController.SetValues(10.0, 250.0, 75.0, 30.0);
             });
         }
+
+        [TestMethod]
+        [TestProperty("Description", "Verifies the ScrollBar2 Offset is synchronized at idle time when the thumb is composition-driven.")]
+        public void VerifyCompositionDrivenThumbOffsetSync()
+        {
+            ScrollBar2 scrollBar2 = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                Scroller scroller = new Scroller();
+                scrollBar2 = new ScrollBar2() { Height = 300 };
+                Verify.IsNull(scrollBar2.ScrollerExpressionAnimationSources);
+
+                scrollBar2.ScrollerExpressionAnimationSources = scroller.ExpressionAnimationSources;
+                Verify.AreEqual(scrollBar2.ScrollerExpressionAnimationSources, scroller.ExpressionAnimationSources);
+
+                MUXControlsTestApp.App.TestContentRoot = scrollBar2;
+                scrollBar2.UpdateLayout();
+
+                Log.Comment("Invoking ScrollBar2's IScrollController.SetValues method");
+                IScrollController scrollBar2AsIScrollController = scrollBar2 as IScrollController;
+                scrollBar2AsIScrollController.SetValues(0.0, 250.0, 75.0, 30.0);
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Verifying ScrollBar2 Offset after idle synchronization");
+                Verify.AreEqual(scrollBar2.Offset, 75.0);
+
+                scrollBar2.ScrollerExpressionAnimationSources = null;
+                Verify.IsNull(scrollBar2.ScrollerExpressionAnimationSources);
+            });
+        }
     }
 }
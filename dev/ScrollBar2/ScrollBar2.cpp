@@ -21,6 +21,7 @@ ScrollBar2::~ScrollBar2()
 {
     SCROLLBAR2_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
 
+    UnhookScrollBarLayoutUpdated();
     UnhookScrollBarEvent();
     UnhookPropertyChanged();
 #ifdef _DEBUG
@@ -111,70 +112,108 @@ void ScrollBar2::SetValues(
     offset = min(maxOffset, offset);
     m_lastOffset = offset;
 
-    SetValue(s_ViewportProperty, box_value(viewport));
+    // Only the offset typically changes from one call to the next, for instance during inertia.
+    // The range and viewport are only pushed to the dependency properties and inner ScrollBar when they change.
+    const bool isRangeChanged = minOffset != m_lastMinOffset || maxOffset != m_lastMaxOffset;
+    const bool isViewportChanged = viewport != m_lastViewport;
 
-    if (minOffset < unbox_value<double>(GetValue(s_MinOffsetProperty)))
-    {
-        SetValue(s_MinOffsetProperty, box_value(minOffset));
-    }
-
-    if (maxOffset < unbox_value<double>(GetValue(s_MaxOffsetProperty)))
-    {
-        SetValue(s_MaxOffsetProperty, box_value(maxOffset));
-    }
+    m_lastMinOffset = minOffset;
+    m_lastMaxOffset = maxOffset;
+    m_lastViewport = viewport;
 
-    if (minOffset != unbox_value<double>(GetValue(s_MinOffsetProperty)))
+    if (isViewportChanged)
     {
-        SetValue(s_MinOffsetProperty, box_value(minOffset));
+        SetValue(s_ViewportProperty, box_value(viewport));
     }
 
-    if (maxOffset != unbox_value<double>(GetValue(s_MaxOffsetProperty)))
+    if (isRangeChanged)
     {
-        SetValue(s_MaxOffsetProperty, box_value(maxOffset));
-    }
-
-    if (m_scrollBar)
-    {
-        winrt::ScrollBar scrollBar = m_scrollBar.get();
-
-        if (minOffset < scrollBar.Minimum())
+        if (minOffset < unbox_value<double>(GetValue(s_MinOffsetProperty)))
         {
-            scrollBar.Minimum(minOffset);
+            SetValue(s_MinOffsetProperty, box_value(minOffset));
         }
 
-        if (maxOffset > scrollBar.Maximum())
+        if (maxOffset < unbox_value<double>(GetValue(s_MaxOffsetProperty)))
         {
-            scrollBar.Maximum(maxOffset);
+            SetValue(s_MaxOffsetProperty, box_value(maxOffset));
         }
 
-        if (minOffset != scrollBar.Minimum())
+        if (minOffset != unbox_value<double>(GetValue(s_MinOffsetProperty)))
         {
-            scrollBar.Minimum(minOffset);
+            SetValue(s_MinOffsetProperty, box_value(minOffset));
         }
 
-        if (maxOffset != scrollBar.Maximum())
+        if (maxOffset != unbox_value<double>(GetValue(s_MaxOffsetProperty)))
         {
-            scrollBar.Maximum(maxOffset);
+            SetValue(s_MaxOffsetProperty, box_value(maxOffset));
         }
+    }
 
-        scrollBar.ViewportSize(viewport);
+    if (m_scrollBar)
+    {
+        winrt::ScrollBar scrollBar = m_scrollBar.get();
 
-        if (isnan(unbox_value<double>(GetValue(s_LargeChangeProperty))))
+        if (isRangeChanged)
         {
-            scrollBar.LargeChange(viewport);
+            if (minOffset < scrollBar.Minimum())
+            {
+                scrollBar.Minimum(minOffset);
+            }
+
+            if (maxOffset > scrollBar.Maximum())
+            {
+                scrollBar.Maximum(maxOffset);
+            }
+
+            if (minOffset != scrollBar.Minimum())
+            {
+                scrollBar.Minimum(minOffset);
+            }
+
+            if (maxOffset != scrollBar.Maximum())
+            {
+                scrollBar.Maximum(maxOffset);
+            }
         }
 
-        if (isnan(unbox_value<double>(GetValue(s_SmallChangeProperty))))
+        if (isViewportChanged)
         {
-            scrollBar.SmallChange(max(1.0, viewport / s_defaultViewportToSmallChangeRatio));
+            scrollBar.ViewportSize(viewport);
+
+            if (isnan(unbox_value<double>(GetValue(s_LargeChangeProperty))))
+            {
+                scrollBar.LargeChange(viewport);
+            }
+
+            if (isnan(unbox_value<double>(GetValue(s_SmallChangeProperty))))
+            {
+                scrollBar.SmallChange(max(1.0, viewport / s_defaultViewportToSmallChangeRatio));
+            }
         }
 
         // The ScrollBar Value is only updated when there is no operation in progress.
         if (m_operationsCount == 0 || scrollBar.Value() < minOffset || scrollBar.Value() > maxOffset)
         {
-            SetValue(s_OffsetProperty, box_value(offset));
-            scrollBar.Value(offset);
-            m_lastScrollBarValue = offset;
+            const bool isValueInRange = scrollBar.Value() >= minOffset && scrollBar.Value() <= maxOffset;
+
+            if (m_thumbExpressionAnimation && m_operationsCount == 0 && isValueInRange)
+            {
+                // The thumb already follows the Scroller offset on the composition thread, so the
+                // Value update is deferred until the UI thread is idle.
+                ScheduleDeferredValueSync();
+            }
+            else if (m_operationsCount == 0 && isValueInRange && !isRangeChanged && !isViewportChanged)
+            {
+                // Only the offset changed. Consecutive changes within a frame are coalesced into a single
+                // Value update, applied right before the frame is rendered.
+                SchedulePerFrameValueSync();
+            }
+            else
+            {
+                SetValue(s_OffsetProperty, box_value(offset));
+                scrollBar.Value(offset);
+                m_lastScrollBarValue = offset;
+            }
         }
     }
 }
@@ -252,6 +291,36 @@ void ScrollBar2::InteractionInfoChanged(winrt::event_token const& token)
 
 #pragma endregion
 
+winrt::CompositionPropertySet ScrollBar2::ScrollerExpressionAnimationSources()
+{
+    return m_scrollerExpressionAnimationSources;
+}
+
+void ScrollBar2::ScrollerExpressionAnimationSources(winrt::CompositionPropertySet const& value)
+{
+    SCROLLBAR2_TRACE_INFO(*this, TRACE_MSG_METH_PTR, METH_NAME, this, value);
+
+    if (m_scrollerExpressionAnimationSources == value)
+    {
+        return;
+    }
+
+    StopThumbAnimation();
+    m_thumbAnimationSources = nullptr;
+    m_scrollerExpressionAnimationSources = value;
+
+    if (m_scrollerExpressionAnimationSources)
+    {
+        // The thumb animation is set up on the next layout pass, once the ScrollBar template is applied.
+        HookScrollBarLayoutUpdated();
+        InvalidateArrange();
+    }
+    else
+    {
+        UnhookScrollBarLayoutUpdated();
+    }
+}
+
 #pragma region IFrameworkElementOverridesHelper
 
 winrt::Size ScrollBar2::MeasureOverride(winrt::Size const& availableSize)
@@ -345,6 +414,9 @@ void ScrollBar2::OnPropertyChanged(
     {
         SCROLLBAR2_TRACE_INFO(*this, TRACE_MSG_METH_STR, METH_NAME, this, s_OrientationPropertyName);
 
+        // The thumb animation is restarted on the thumb of the new orientation during the next layout pass.
+        StopThumbAnimation();
+
         if (m_scrollBar)
         {
             m_scrollBar.get().Orientation(unbox_value<winrt::Orientation>(args.NewValue()));
@@ -354,6 +426,9 @@ void ScrollBar2::OnPropertyChanged(
     {
         SCROLLBAR2_TRACE_INFO(*this, TRACE_MSG_METH_STR, METH_NAME, this, s_ScrollBarStylePropertyName);
 
+        // A new style may bring a new template, and thus new template parts for the thumb animation.
+        StopThumbAnimation();
+
         if (m_scrollBar)
         {
             m_scrollBar.get().Style(safe_cast<winrt::Style>(args.NewValue()));
@@ -472,6 +547,25 @@ void ScrollBar2::UnhookScrollBarEvent()
     }
 }
 
+void ScrollBar2::HookScrollBarLayoutUpdated()
+{
+    if (m_scrollBarLayoutUpdatedToken.value == 0)
+    {
+        m_scrollBarLayoutUpdatedToken = m_scrollBar.get().LayoutUpdated({ this, &ScrollBar2::OnScrollBarLayoutUpdated });
+    }
+}
+
+void ScrollBar2::UnhookScrollBarLayoutUpdated()
+{
+    winrt::ScrollBar scrollBar = m_scrollBar.safe_get();
+
+    if (scrollBar && m_scrollBarLayoutUpdatedToken.value != 0)
+    {
+        scrollBar.LayoutUpdated(m_scrollBarLayoutUpdatedToken);
+        m_scrollBarLayoutUpdatedToken.value = 0;
+    }
+}
+
 #ifdef _DEBUG
 void ScrollBar2::OnScrollBarPropertyChanged(
     const winrt::DependencyObject& /*sender*/,
@@ -484,7 +578,7 @@ void ScrollBar2::OnScrollBarPropertyChanged(
     else if (args == winrt::ScrollBar::IndicatorModeProperty())
     {
         SCROLLBAR2_TRACE_VERBOSE(*this, TRACE_MSG_METH_STR_STR, METH_NAME, this,
-            hstring{ ScrollBar2::s_IndicatorModePropertyName }.c_str(), TypeLogging::ScrollingIndicatorModeToString(m_scrollBar.get().IndicatorMode()).c_str());
+            ScrollBar2::s_IndicatorModePropertyName.data(), TypeLogging::ScrollingIndicatorModeToString(m_scrollBar.get().IndicatorMode()).c_str());
     }
 }
 #endif //_DEBUG
@@ -616,6 +710,177 @@ void ScrollBar2::OnScroll(
     SetValue(s_OffsetProperty, box_value(m_lastScrollBarValue));
 }
 
+void ScrollBar2::OnScrollBarLayoutUpdated(
+    const winrt::IInspectable& /*sender*/,
+    const winrt::IInspectable& /*args*/)
+{
+    if (m_scrollerExpressionAnimationSources)
+    {
+        EnsureThumbAnimation();
+
+        if (m_thumbExpressionAnimation)
+        {
+            UpdateThumbAnimationSources();
+        }
+    }
+}
+
+// Starts the expression animation that translates the ScrollBar thumb according to the Scroller's composition
+// offset, relative to the position the XAML layout gave it for the current ScrollBar Value. This is a no-op when
+// the Translation property is unavailable or when the ScrollBar template does not have the expected parts.
+void ScrollBar2::EnsureThumbAnimation()
+{
+    MUX_ASSERT(m_scrollerExpressionAnimationSources);
+
+    if (m_thumbExpressionAnimation || !m_scrollBar || !DownlevelHelper::SetIsTranslationEnabledExists())
+    {
+        return;
+    }
+
+    const winrt::ScrollBar scrollBar = m_scrollBar.get();
+    const bool isHorizontal = scrollBar.Orientation() == winrt::Orientation::Horizontal;
+    const winrt::UIElement thumb = SharedHelpers::FindInVisualTreeByName(scrollBar, isHorizontal ? s_horizontalThumbPartName : s_verticalThumbPartName);
+
+    if (!thumb)
+    {
+        return;
+    }
+
+    SCROLLBAR2_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
+
+    const winrt::Compositor compositor = m_scrollerExpressionAnimationSources.Compositor();
+
+    if (!m_thumbAnimationSources)
+    {
+        m_thumbAnimationSources = compositor.CreatePropertySet();
+        m_thumbAnimationSources.InsertScalar(s_syncedOffsetPropertyName, 0.0f);
+        m_thumbAnimationSources.InsertScalar(s_minOffsetPropertyName, 0.0f);
+        m_thumbAnimationSources.InsertScalar(s_maxOffsetPropertyName, 0.0f);
+        m_thumbAnimationSources.InsertScalar(s_multiplierPropertyName, 0.0f);
+    }
+
+    m_thumbExpressionAnimation = compositor.CreateExpressionAnimation(isHorizontal ?
+        L"(Clamp(scroller.Position.X - scroller.MinPosition.X, thumb.MinOffset, thumb.MaxOffset) - thumb.SyncedOffset) * thumb.Multiplier" :
+        L"(Clamp(scroller.Position.Y - scroller.MinPosition.Y, thumb.MinOffset, thumb.MaxOffset) - thumb.SyncedOffset) * thumb.Multiplier");
+    m_thumbExpressionAnimation.SetReferenceParameter(L"scroller", m_scrollerExpressionAnimationSources);
+    m_thumbExpressionAnimation.SetReferenceParameter(L"thumb", m_thumbAnimationSources);
+
+    winrt::ElementCompositionPreview::SetIsTranslationEnabled(thumb, true);
+
+    const winrt::Visual thumbVisual = winrt::ElementCompositionPreview::GetElementVisual(thumb);
+
+    thumbVisual.Properties().InsertVector3(s_translationPropertyName, { 0.0f, 0.0f, 0.0f });
+    thumbVisual.StartAnimation(isHorizontal ? s_translationXPropertyName : s_translationYPropertyName, m_thumbExpressionAnimation);
+
+    m_thumb.set(thumb);
+    m_largeDecrease.set(SharedHelpers::FindInVisualTreeByName(scrollBar, isHorizontal ? s_horizontalLargeDecreasePartName : s_verticalLargeDecreasePartName));
+    m_largeIncrease.set(SharedHelpers::FindInVisualTreeByName(scrollBar, isHorizontal ? s_horizontalLargeIncreasePartName : s_verticalLargeIncreasePartName));
+}
+
+void ScrollBar2::StopThumbAnimation()
+{
+    if (!m_thumbExpressionAnimation)
+    {
+        return;
+    }
+
+    SCROLLBAR2_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
+
+    if (const winrt::UIElement thumb = m_thumb.get())
+    {
+        const winrt::Visual thumbVisual = winrt::ElementCompositionPreview::GetElementVisual(thumb);
+
+        thumbVisual.StopAnimation(s_translationXPropertyName);
+        thumbVisual.StopAnimation(s_translationYPropertyName);
+        thumbVisual.Properties().InsertVector3(s_translationPropertyName, { 0.0f, 0.0f, 0.0f });
+    }
+
+    m_thumb.set(nullptr);
+    m_largeDecrease.set(nullptr);
+    m_largeIncrease.set(nullptr);
+    m_thumbExpressionAnimation = nullptr;
+}
+
+// Pushes the values reflected by the current XAML layout of the ScrollBar to the thumb animation.
+void ScrollBar2::UpdateThumbAnimationSources()
+{
+    MUX_ASSERT(m_thumbAnimationSources);
+    MUX_ASSERT(m_scrollBar);
+
+    const winrt::ScrollBar scrollBar = m_scrollBar.get();
+    const double minOffset = scrollBar.Minimum();
+    const double maxOffset = scrollBar.Maximum();
+    double multiplier = 0.0;
+
+    if (maxOffset > minOffset && m_largeDecrease && m_largeIncrease)
+    {
+        // The two large change repeat buttons fill the track length not covered by the thumb,
+        // so their combined length is the distance the thumb travels from minOffset to maxOffset.
+        const winrt::FrameworkElement largeDecrease = m_largeDecrease.get();
+        const winrt::FrameworkElement largeIncrease = m_largeIncrease.get();
+        const double thumbTravel = scrollBar.Orientation() == winrt::Orientation::Horizontal ?
+            largeDecrease.ActualWidth() + largeIncrease.ActualWidth() :
+            largeDecrease.ActualHeight() + largeIncrease.ActualHeight();
+
+        multiplier = thumbTravel / (maxOffset - minOffset);
+    }
+
+    m_thumbAnimationSources.InsertScalar(s_syncedOffsetPropertyName, static_cast<float>(scrollBar.Value()));
+    m_thumbAnimationSources.InsertScalar(s_minOffsetPropertyName, static_cast<float>(minOffset));
+    m_thumbAnimationSources.InsertScalar(s_maxOffsetPropertyName, static_cast<float>(maxOffset));
+    m_thumbAnimationSources.InsertScalar(s_multiplierPropertyName, static_cast<float>(multiplier));
+}
+
+void ScrollBar2::ScheduleDeferredValueSync()
+{
+    if (!m_deferredValueSyncAction)
+    {
+        auto strongThis = get_strong();
+
+        // The strong reference keeps this ScrollBar2 alive until the idle action runs.
+        m_deferredValueSyncAction.set(Dispatcher().RunIdleAsync([strongThis](const winrt::IdleDispatchedHandlerArgs&)
+        {
+            strongThis->OnDeferredValueSync();
+        }));
+    }
+}
+
+void ScrollBar2::SchedulePerFrameValueSync()
+{
+    if (!m_isPerFrameValueSyncPending)
+    {
+        m_isPerFrameValueSyncPending = true;
+
+        auto strongThis = get_strong();
+
+        SharedHelpers::QueueCallbackForCompositionRendering(
+            [strongThis]()
+            {
+                strongThis->m_isPerFrameValueSyncPending = false;
+                strongThis->SyncValue();
+            });
+    }
+}
+
+void ScrollBar2::OnDeferredValueSync()
+{
+    m_deferredValueSyncAction.set(nullptr);
+    SyncValue();
+}
+
+// Applies the latest offset provided by SetValues to the ScrollBar Value, unless an operation is in progress.
+void ScrollBar2::SyncValue()
+{
+    if (m_operationsCount == 0 && m_scrollBar && m_scrollBar.get().Value() != m_lastOffset)
+    {
+        SCROLLBAR2_TRACE_VERBOSE(*this, TRACE_MSG_METH_DBL, METH_NAME, this, m_lastOffset);
+
+        SetValue(s_OffsetProperty, box_value(m_lastOffset));
+        m_scrollBar.get().Value(m_lastOffset);
+        m_lastScrollBarValue = m_lastOffset;
+    }
+}
+
 bool ScrollBar2::RaiseOffsetChangeRequested(
     double offset)
 {
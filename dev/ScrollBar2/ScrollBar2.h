@@ -98,6 +98,12 @@ public:
 
     static void ValidateScrollMode(winrt::ScrollMode mode);
 
+    // When set to a Scroller's ExpressionAnimationSources, the inner ScrollBar's thumb is moved on the
+    // composition thread while the Scroller's InteractionTracker is moving, and the ScrollBar Value is
+    // only synchronized with the Scroller offset when the UI thread is idle.
+    winrt::CompositionPropertySet ScrollerExpressionAnimationSources();
+    void ScrollerExpressionAnimationSources(winrt::CompositionPropertySet const& value);
+
 private:
 #ifdef _DEBUG
     static winrt::hstring DependencyPropertyToString(const winrt::IDependencyProperty& dependencyProperty);
@@ -109,6 +115,8 @@ private:
     void UnhookPropertyChanged();
     void HookScrollBarEvent();
     void UnhookScrollBarEvent();
+    void HookScrollBarLayoutUpdated();
+    void UnhookScrollBarLayoutUpdated();
 #ifdef _DEBUG
     // For testing purposes only
     void HookScrollBarPropertyChanged();
@@ -123,6 +131,17 @@ private:
     void OnScroll(
         const winrt::IInspectable& sender,
         const winrt::ScrollEventArgs& args);
+    void OnScrollBarLayoutUpdated(
+        const winrt::IInspectable& sender,
+        const winrt::IInspectable& args);
+
+    void EnsureThumbAnimation();
+    void StopThumbAnimation();
+    void UpdateThumbAnimationSources();
+    void ScheduleDeferredValueSync();
+    void OnDeferredValueSync();
+    void SchedulePerFrameValueSync();
+    void SyncValue();
 
     bool RaiseOffsetChangeRequested(
         double offset);
@@ -137,9 +156,24 @@ private:
     int m_operationsCount{ 0 };
     double m_lastScrollBarValue{ 0.0 };
     double m_lastOffset{ 0.0 };
+    double m_lastMinOffset{ std::numeric_limits<double>::quiet_NaN() };
+    double m_lastMaxOffset{ std::numeric_limits<double>::quiet_NaN() };
+    double m_lastViewport{ std::numeric_limits<double>::quiet_NaN() };
+    bool m_isPerFrameValueSyncPending{ false };
     bool m_areScrollerInteractionsAllowed{ true };
     bool m_isInteracting{ false };
 
+    // Composition-driven thumb. m_thumbAnimationSources holds the ScrollBar Value reflected by the current
+    // XAML layout of the thumb, the thumb pixels per offset unit and the offset range. The expression
+    // animation translates the thumb by the difference between the Scroller's composition offset and that Value.
+    winrt::CompositionPropertySet m_scrollerExpressionAnimationSources{ nullptr };
+    winrt::CompositionPropertySet m_thumbAnimationSources{ nullptr };
+    winrt::ExpressionAnimation m_thumbExpressionAnimation{ nullptr };
+    tracker_ref<winrt::UIElement> m_thumb{ this };
+    tracker_ref<winrt::FrameworkElement> m_largeDecrease{ this };
+    tracker_ref<winrt::FrameworkElement> m_largeIncrease{ this };
+    tracker_ref<winrt::IAsyncAction> m_deferredValueSyncAction{ this };
+
     // Event Sources
     event_source<winrt::TypedEventHandler<winrt::IScrollController, winrt::ScrollControllerOffsetChangeRequestedEventArgs>> m_offsetChangeRequested{ this };
     event_source<winrt::TypedEventHandler<winrt::IScrollController, winrt::ScrollControllerOffsetChangeWithAdditionalVelocityRequestedEventArgs>> m_offsetChangeWithAdditionalVelocityRequested{ this };
@@ -147,6 +181,7 @@ private:
 
     // Event Tokens
     winrt::event_token m_scrollBarScrollToken{};
+    winrt::event_token m_scrollBarLayoutUpdatedToken{};
     winrt::event_token m_visibilityChangedToken{};
 #ifdef _DEBUG
     // For testing purposes only
@@ -170,4 +205,22 @@ private:
 
     // Additional velocity at Minimum and Maximum positions to ensure hitting the extreme Value.
     static constexpr double s_minMaxEpsilon{ 0.001 };
+
+    // Names of the ScrollBar template parts used by the composition-driven thumb.
+    static constexpr std::wstring_view s_horizontalThumbPartName{ L"HorizontalThumb"sv };
+    static constexpr std::wstring_view s_verticalThumbPartName{ L"VerticalThumb"sv };
+    static constexpr std::wstring_view s_horizontalLargeDecreasePartName{ L"HorizontalLargeDecrease"sv };
+    static constexpr std::wstring_view s_horizontalLargeIncreasePartName{ L"HorizontalLargeIncrease"sv };
+    static constexpr std::wstring_view s_verticalLargeDecreasePartName{ L"VerticalLargeDecrease"sv };
+    static constexpr std::wstring_view s_verticalLargeIncreasePartName{ L"VerticalLargeIncrease"sv };
+
+    static constexpr std::wstring_view s_translationPropertyName{ L"Translation"sv };
+    static constexpr std::wstring_view s_translationXPropertyName{ L"Translation.X"sv };
+    static constexpr std::wstring_view s_translationYPropertyName{ L"Translation.Y"sv };
+
+    // Property names used by the composition-driven thumb's expression animation.
+    static constexpr std::wstring_view s_syncedOffsetPropertyName{ L"SyncedOffset"sv };
+    static constexpr std::wstring_view s_minOffsetPropertyName{ L"MinOffset"sv };
+    static constexpr std::wstring_view s_maxOffsetPropertyName{ L"MaxOffset"sv };
+    static constexpr std::wstring_view s_multiplierPropertyName{ L"Multiplier"sv };
 };
@@ -27,6 +27,7 @@ using InputKind = Microsoft.UI.Xaml.Controls.InputKind;
 using ChainingMode = Microsoft.UI.Xaml.Controls.ChainingMode;
 using RailingMode = Microsoft.UI.Xaml.Controls.RailingMode;
 using ZoomMode = Microsoft.UI.Xaml.Controls.ZoomMode;
+using ScrollBarVisibility = Microsoft.UI.Xaml.Controls.ScrollBarVisibility;
 using MUXControlsTestHooksLoggingMessageEventArgs = Microsoft.UI.Private.Controls.MUXControlsTestHooksLoggingMessageEventArgs;
 using ScrollViewerTestHooks = Microsoft.UI.Private.Controls.ScrollViewerTestHooks;
 
@@ -228,6 +229,9 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                     Verify.AreEqual(scrollViewer.Content, rectangleScrollViewerContent);
                     Verify.IsNotNull(ScrollViewerTestHooks.GetScrollerPart(scrollViewer));
                     Verify.AreEqual(ScrollViewerTestHooks.GetScrollerPart(scrollViewer).Content, rectangleScrollViewerContent);
+
+                    Log.Comment("Verifying the deferred scroll controllers are realized when one is required to be visible");
+                    scrollViewer.VerticalScrollBarVisibility = ScrollBarVisibility.Visible;
                     Verify.IsNotNull(scrollViewer.HorizontalScrollController);
                     Verify.IsNotNull(scrollViewer.VerticalScrollController);
 
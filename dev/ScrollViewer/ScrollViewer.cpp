@@ -8,11 +8,18 @@
 #include "RuntimeProfiler.h"
 #include "FocusHelper.h"
 #include "ScrollViewerTestHooks.h"
+#include "StartupTrace.h"
 
 // Change to 'true' to turn on debugging outputs in Output window
 bool ScrollViewerTrace::s_IsDebugOutputEnabled{ false };
 bool ScrollViewerTrace::s_IsVerboseDebugOutputEnabled{ false };
 
+// All the ScrollViewers of a UI thread share one timer to delay the hiding of their indicators. It is owned by the
+// last ScrollViewer that scheduled a delayed hiding, so pointer activity only ever involves that single timer.
+static thread_local winrt::DispatcherTimer s_hideIndicatorsTimer{ nullptr };
+static thread_local winrt::weak_ref<ScrollViewer> s_hideIndicatorsTimerOwner = nullptr;
+static thread_local winrt::clock::time_point s_hideIndicatorsDeadline{};
+
 ScrollViewer::ScrollViewer()
 {
     SCROLLVIEWER_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
@@ -28,7 +35,7 @@ ScrollViewer::~ScrollViewer()
 
     UnhookScrollerEvents(true /*isForDestructor*/);
     UnhookScrollViewerEvents();
-    StopHideIndicatorsTimer(true /*isForDestructor*/);
+    // The shared hide-indicators timer stops by itself when it finds its weakly referenced owner gone.
 }
 
 #pragma region IScrollViewer
@@ -180,6 +187,8 @@ int32_t ScrollViewer::ChangeZoomFactorWithAdditionalVelocity(
 
 void ScrollViewer::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"ScrollViewer");
+
     SCROLLVIEWER_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
     __super::OnApplyTemplate();
@@ -192,22 +201,23 @@ void ScrollViewer::OnApplyTemplate()
 
     UpdateScroller(scroller);
 
-    winrt::IScrollController horizontalScrollController = GetTemplateChildT<winrt::IScrollController>(s_horizontalScrollControllerPartName, thisAsControlProtected);
-
-    UpdateHorizontalScrollController(horizontalScrollController);
-
-    winrt::IScrollController verticalScrollController = GetTemplateChildT<winrt::IScrollController>(s_verticalScrollControllerPartName, thisAsControlProtected);
-
-    UpdateVerticalScrollController(verticalScrollController);
-
-    winrt::IUIElement scrollControllersSeparator = GetTemplateChildT<winrt::IUIElement>(s_scrollControllersSeparatorPartName, thisAsControlProtected);
-
-    UpdateScrollControllersSeparator(scrollControllersSeparator);
-
-    UpdateScrollControllersVisibility(true /*horizontalChange*/, true /*verticalChange*/);
+    m_areScrollControllersRealized = false;
+    UpdateHorizontalScrollController(nullptr);
+    UpdateVerticalScrollController(nullptr);
+    UpdateScrollControllersSeparator(nullptr);
 
     winrt::FrameworkElement root = GetTemplateChildT<winrt::FrameworkElement>(s_rootPartName, thisAsControlProtected);
 
+    // The default template defers the scroll controllers and their separator. Retrieving them would realize them,
+    // so that is delayed until a scroll controller is required to be visible or the indicators are first shown.
+    // Templates that do not defer those parts have them retrieved right away.
+    if (unbox_value<winrt::ScrollBarVisibility>(GetValue(s_HorizontalScrollBarVisibilityProperty)) == winrt::ScrollBarVisibility::Visible ||
+        unbox_value<winrt::ScrollBarVisibility>(GetValue(s_VerticalScrollBarVisibilityProperty)) == winrt::ScrollBarVisibility::Visible ||
+        (root && AreScrollControllerPartsLoaded(root)))
+    {
+        RealizeScrollControllers();
+    }
+
     if (root)
     {        
         winrt::IVector<winrt::VisualStateGroup> rootVisualStateGroups = winrt::VisualStateManager::GetVisualStateGroups(root);
@@ -340,10 +350,9 @@ void ScrollViewer::OnScrollViewerPointerMoved(
         ShowIndicators();
 
         if (!SharedHelpers::IsAnimationsEnabled() &&
-            m_hideIndicatorsTimer &&
             (m_isPointerOverHorizontalScrollController || m_isPointerOverVerticalScrollController))
         {
-            StopHideIndicatorsTimer(false /*isForDestructor*/);
+            StopHideIndicatorsTimer();
         }
     }
 }
@@ -534,7 +543,14 @@ void ScrollViewer::OnPropertyChanged(const winrt::DependencyPropertyChangedEvent
     SCROLLVIEWER_TRACE_VERBOSE(nullptr, L"%s(property: %s)\n", METH_NAME, DependencyPropertyToString(dependencyProperty).c_str());
 #endif
 
-    if (dependencyProperty == s_HorizontalScrollBarVisibilityProperty ||
+    if ((dependencyProperty == s_HorizontalScrollBarVisibilityProperty || dependencyProperty == s_VerticalScrollBarVisibilityProperty) &&
+        !m_areScrollControllersRealized &&
+        unbox_value<winrt::ScrollBarVisibility>(args.NewValue()) == winrt::ScrollBarVisibility::Visible)
+    {
+        // RealizeScrollControllers updates the visibility of both scroll controllers.
+        RealizeScrollControllers();
+    }
+    else if (dependencyProperty == s_HorizontalScrollBarVisibilityProperty ||
         dependencyProperty == s_ComputedHorizontalScrollModeProperty)
     {
         UpdateScrollControllersVisibility(true /*horizontalChange*/, false /*verticalChange*/);
@@ -610,10 +626,27 @@ void ScrollViewer::OnHideIndicatorsTimerTick(
     const winrt::IInspectable& /*sender*/,
     const winrt::IInspectable& /*args*/)
 {
-    SCROLLVIEWER_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
+    const auto owner = s_hideIndicatorsTimerOwner.get();
 
-    StopHideIndicatorsTimer(false /*isForDestructor*/);
-    HideIndicators(true /*useTransitions*/);
+    if (!owner)
+    {
+        s_hideIndicatorsTimer.Stop();
+        return;
+    }
+
+    const auto now = winrt::clock::now();
+
+    if (now < s_hideIndicatorsDeadline)
+    {
+        // Activity on the owner pushed the deadline back since the timer was started.
+        s_hideIndicatorsTimer.Interval(s_hideIndicatorsDeadline - now);
+        return;
+    }
+
+    SCROLLVIEWER_TRACE_VERBOSE(nullptr, TRACE_MSG_METH, METH_NAME, owner.get());
+
+    owner->StopHideIndicatorsTimer();
+    owner->HideIndicators(true /*useTransitions*/);
 }
 
 void ScrollViewer::OnScrollerExtentChanged(
@@ -752,13 +785,23 @@ void ScrollViewer::OnScrollerPropertyChanged(
     }
 }
 
-void ScrollViewer::StopHideIndicatorsTimer(bool isForDestructor)
+bool ScrollViewer::IsHideIndicatorsTimerOwner()
 {
-    winrt::DispatcherTimer hideIndicatorsTimer = m_hideIndicatorsTimer.safe_get(isForDestructor /*useSafeGet*/);
+    const auto owner = s_hideIndicatorsTimerOwner.get();
 
-    if (hideIndicatorsTimer && hideIndicatorsTimer.IsEnabled())
+    return owner && owner.get() == this;
+}
+
+void ScrollViewer::StopHideIndicatorsTimer()
+{
+    if (IsHideIndicatorsTimerOwner())
     {
-        hideIndicatorsTimer.Stop();
+        s_hideIndicatorsTimerOwner = nullptr;
+
+        if (s_hideIndicatorsTimer.IsEnabled())
+        {
+            s_hideIndicatorsTimer.Stop();
+        }
     }
 }
 
@@ -1157,18 +1200,7 @@ void ScrollViewer::UpdateScrollControllersVisibility(
     {
         if (horizontalChange)
         {
-            winrt::ScrollBarVisibility scrollBarVisibility = 
-                unbox_value<winrt::ScrollBarVisibility>(GetValue(s_HorizontalScrollBarVisibilityProperty));
-
-            if (scrollBarVisibility == winrt::ScrollBarVisibility::Auto &&
-                ComputedHorizontalScrollMode() == winrt::ScrollMode::Enabled)
-            {
-                isHorizontalScrollControllerVisible = true;
-            }
-            else
-            {
-                isHorizontalScrollControllerVisible = (scrollBarVisibility == winrt::ScrollBarVisibility::Visible);
-            }
+            isHorizontalScrollControllerVisible = IsScrollControllerVisibilityRequested(true /*isHorizontal*/);
 
             m_horizontalScrollControllerElement.get().Visibility(
                 isHorizontalScrollControllerVisible ? winrt::Visibility::Visible : winrt::Visibility::Collapsed);
@@ -1185,18 +1217,7 @@ void ScrollViewer::UpdateScrollControllersVisibility(
     {
         if (verticalChange)
         {
-            winrt::ScrollBarVisibility scrollBarVisibility = 
-                unbox_value<winrt::ScrollBarVisibility>(GetValue(s_VerticalScrollBarVisibilityProperty));
-
-            if (scrollBarVisibility == winrt::ScrollBarVisibility::Auto &&
-                ComputedVerticalScrollMode() == winrt::ScrollMode::Enabled)
-            {
-                isVerticalScrollControllerVisible = true;
-            }
-            else
-            {
-                isVerticalScrollControllerVisible = (scrollBarVisibility == winrt::ScrollBarVisibility::Visible);
-            }
+            isVerticalScrollControllerVisible = IsScrollControllerVisibilityRequested(false /*isHorizontal*/);
 
             m_verticalScrollControllerElement.get().Visibility(
                 isVerticalScrollControllerVisible ? winrt::Visibility::Visible : winrt::Visibility::Collapsed);
@@ -1214,6 +1235,72 @@ void ScrollViewer::UpdateScrollControllersVisibility(
     }
 }
 
+// Returns True when the ScrollBarVisibility and computed scroll mode of the provided orientation call for a visible scroll controller.
+bool ScrollViewer::IsScrollControllerVisibilityRequested(bool isHorizontal)
+{
+    const winrt::ScrollBarVisibility scrollBarVisibility =
+        unbox_value<winrt::ScrollBarVisibility>(GetValue(isHorizontal ? s_HorizontalScrollBarVisibilityProperty : s_VerticalScrollBarVisibilityProperty));
+
+    if (scrollBarVisibility == winrt::ScrollBarVisibility::Auto)
+    {
+        return (isHorizontal ? ComputedHorizontalScrollMode() : ComputedVerticalScrollMode()) == winrt::ScrollMode::Enabled;
+    }
+
+    return scrollBarVisibility == winrt::ScrollBarVisibility::Visible;
+}
+
+// Retrieves the scroll controllers and separator template parts, which realizes them when they are deferred.
+void ScrollViewer::RealizeScrollControllers()
+{
+    if (m_areScrollControllersRealized)
+    {
+        return;
+    }
+
+    SCROLLVIEWER_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
+
+    m_areScrollControllersRealized = true;
+
+    winrt::IControlProtected thisAsControlProtected = *this;
+
+    winrt::IScrollController horizontalScrollController = GetTemplateChildT<winrt::IScrollController>(s_horizontalScrollControllerPartName, thisAsControlProtected);
+
+    UpdateHorizontalScrollController(horizontalScrollController);
+
+    winrt::IScrollController verticalScrollController = GetTemplateChildT<winrt::IScrollController>(s_verticalScrollControllerPartName, thisAsControlProtected);
+
+    UpdateVerticalScrollController(verticalScrollController);
+
+    winrt::IUIElement scrollControllersSeparator = GetTemplateChildT<winrt::IUIElement>(s_scrollControllersSeparatorPartName, thisAsControlProtected);
+
+    UpdateScrollControllersSeparator(scrollControllersSeparator);
+
+    UpdateScrollControllersVisibility(true /*horizontalChange*/, true /*verticalChange*/);
+}
+
+// Returns True when a scroll controller part is already a child of the template root, i.e. when the template does not defer it.
+// Only the root's direct children are inspected to avoid walking the content's subtree.
+bool ScrollViewer::AreScrollControllerPartsLoaded(const winrt::FrameworkElement& root)
+{
+    if (const winrt::Panel rootPanel = root.try_as<winrt::Panel>())
+    {
+        for (const winrt::UIElement& child : rootPanel.Children())
+        {
+            if (const winrt::FrameworkElement childAsFrameworkElement = child.try_as<winrt::FrameworkElement>())
+            {
+                const winrt::hstring childName = childAsFrameworkElement.Name();
+
+                if (childName == s_horizontalScrollControllerPartName || childName == s_verticalScrollControllerPartName)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
 bool ScrollViewer::IsLoaded()
 {
     return winrt::VisualTreeHelper::GetParent(*this) != nullptr;
@@ -1234,17 +1321,20 @@ bool ScrollViewer::AreBothScrollControllersVisible()
 // Show the appropriate scrolling indicators.
 void ScrollViewer::ShowIndicators()
 {
+    if (!m_areScrollControllersRealized &&
+        (IsScrollControllerVisibilityRequested(true /*isHorizontal*/) || IsScrollControllerVisibilityRequested(false /*isHorizontal*/)))
+    {
+        // First time indicators are needed, for instance on the first pointer interaction.
+        RealizeScrollControllers();
+    }
+
     if (!AreAllScrollControllersCollapsed())
     {
-        if (m_hideIndicatorsTimer)
+        if (IsHideIndicatorsTimerOwner())
         {
-            winrt::DispatcherTimer hideIndicatorsTimer = m_hideIndicatorsTimer.get();
-
-            if (hideIndicatorsTimer.IsEnabled())
-            {
-                hideIndicatorsTimer.Stop();
-                hideIndicatorsTimer.Start();
-            }
+            // Postpone the pending hiding. Rather than restarting the shared timer on each pointer move,
+            // only the deadline is moved and the timer re-arms itself when it ticks too early.
+            s_hideIndicatorsDeadline = winrt::clock::now() + winrt::TimeSpan::duration(s_noIndicatorCountdown);
         }
 
         // Mouse indicators dominate if they are already showing or if we have set the flag to prefer them.
@@ -1279,7 +1369,9 @@ void ScrollViewer::HideIndicators(
 {
     SCROLLVIEWER_TRACE_VERBOSE(*this, TRACE_MSG_METH_STR_INT_INT, METH_NAME, this, s_noIndicatorStateName, useTransitions, m_keepIndicatorsShowing);
 
-    if (!m_keepIndicatorsShowing)
+    // Until the scroll controllers are realized, the template's initial values match the NoIndicator state.
+    // Going to that state would needlessly realize the deferred separator it targets.
+    if (!m_keepIndicatorsShowing && m_areScrollControllersRealized)
     {
         winrt::VisualStateManager::GoToState(*this, s_noIndicatorStateName, useTransitions);
     }
@@ -1291,25 +1383,30 @@ void ScrollViewer::HideIndicatorsAfterDelay()
 
     if (!m_keepIndicatorsShowing)
     {
-        winrt::DispatcherTimer hideIndicatorsTimer = nullptr;
-
-        if (m_hideIndicatorsTimer)
+        if (const auto previousOwner = s_hideIndicatorsTimerOwner.get())
         {
-            hideIndicatorsTimer = m_hideIndicatorsTimer.get();
-            if (hideIndicatorsTimer.IsEnabled())
+            if (previousOwner.get() != this)
             {
-                hideIndicatorsTimer.Stop();
+                // This ScrollViewer takes over the shared timer, so the previous owner's indicators hide right away.
+                s_hideIndicatorsTimerOwner = nullptr;
+                previousOwner->HideIndicators(true /*useTransitions*/);
             }
         }
-        else
+
+        if (!s_hideIndicatorsTimer)
+        {
+            s_hideIndicatorsTimer = winrt::DispatcherTimer();
+            s_hideIndicatorsTimer.Tick(&ScrollViewer::OnHideIndicatorsTimerTick);
+        }
+        else if (s_hideIndicatorsTimer.IsEnabled())
         {
-            hideIndicatorsTimer = winrt::DispatcherTimer();
-            hideIndicatorsTimer.Interval(winrt::TimeSpan::duration(s_noIndicatorCountdown));
-            hideIndicatorsTimer.Tick({ this, &ScrollViewer::OnHideIndicatorsTimerTick });
-            m_hideIndicatorsTimer.set(hideIndicatorsTimer);
+            s_hideIndicatorsTimer.Stop();
         }
 
-        hideIndicatorsTimer.Start();
+        s_hideIndicatorsTimerOwner = get_weak();
+        s_hideIndicatorsDeadline = winrt::clock::now() + winrt::TimeSpan::duration(s_noIndicatorCountdown);
+        s_hideIndicatorsTimer.Interval(winrt::TimeSpan::duration(s_noIndicatorCountdown));
+        s_hideIndicatorsTimer.Start();
     }
 }
 
@@ -140,7 +140,7 @@ private:
     void OnScrollControllerInteractionInfoChanged(
         const winrt::IScrollController& sender,
         const winrt::IInspectable& args);
-    void OnHideIndicatorsTimerTick(
+    static void OnHideIndicatorsTimerTick(
         const winrt::IInspectable& sender,
         const winrt::IInspectable& args);
 
@@ -173,7 +173,8 @@ private:
         const winrt::IInspectable& sender,
         const winrt::ScrollerAnchorRequestedEventArgs& args);
 
-    void StopHideIndicatorsTimer(bool isForDestructor);
+    bool IsHideIndicatorsTimerOwner();
+    void StopHideIndicatorsTimer();
 
     void HookScrollViewerEvents();
     void UnhookScrollViewerEvents();
@@ -191,6 +192,9 @@ private:
     void UpdateScrollerHorizontalScrollController(const winrt::IScrollController& horizontalScrollController);
     void UpdateScrollerVerticalScrollController(const winrt::IScrollController& verticalScrollController);
     void UpdateScrollControllersVisibility(bool horizontalChange, bool verticalChange);
+    void RealizeScrollControllers();
+    bool IsScrollControllerVisibilityRequested(bool isHorizontal);
+    bool AreScrollControllerPartsLoaded(const winrt::FrameworkElement& root);
 
     bool IsLoaded();
 
@@ -226,7 +230,6 @@ private:
     tracker_ref<winrt::IUIElement> m_verticalScrollControllerElement{ this };
     tracker_ref<winrt::IUIElement> m_scrollControllersSeparatorElement{ this };
     tracker_ref<winrt::IScroller>  m_scroller{ this };
-    tracker_ref<winrt::DispatcherTimer> m_hideIndicatorsTimer{ this };
 
     // Event Tokens
     winrt::event_token m_gettingFocusToken{};
@@ -269,6 +272,10 @@ private:
     // Set to True to prevent the normal fade-out of the scrolling indicators.
     bool m_keepIndicatorsShowing{ false };
 
+    // Set to True once the scroll controllers and separator template parts were retrieved. Until then, they
+    // may still be deferred by the template (x:DeferLoadStrategy), which saves their realization cost.
+    bool m_areScrollControllersRealized{ false };
+
     // Set to True to favor mouse indicators over panning indicators for the scroll controllers.
     bool m_preferMouseIndicators{ false };
 
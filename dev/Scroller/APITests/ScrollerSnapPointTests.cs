@@ -68,6 +68,26 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Verify the SnapPointsEvaluationWindow default value and that invalid values throw.")]
+        public void SnapPointsEvaluationWindowValidation()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                Scroller scroller = new Scroller();
+                Verify.AreEqual(double.PositiveInfinity, scroller.SnapPointsEvaluationWindow);
+
+                scroller.VerticalSnapPoints.Add(new ScrollerSnapPointRegular(offset: 0, interval: 10, start: 0, end: 10000, alignment: ScrollerSnapPointAlignment.Near));
+                scroller.SnapPointsEvaluationWindow = 500;
+                Verify.AreEqual(500.0, scroller.SnapPointsEvaluationWindow);
+
+                Verify.Throws<ArgumentException>(() => { scroller.SnapPointsEvaluationWindow = 0; });
+                Verify.Throws<ArgumentException>(() => { scroller.SnapPointsEvaluationWindow = -1; });
+                Verify.Throws<ArgumentException>(() => { scroller.SnapPointsEvaluationWindow = double.NaN; });
+                Verify.AreEqual(500.0, scroller.SnapPointsEvaluationWindow);
+            });
+        }
+
         [TestMethod]
         [TestProperty("Description", "Add and remove snap points and make sure the corresponding collections look correct.")]
         public void CanAddAndRemoveSnapPointsFromAScroller()
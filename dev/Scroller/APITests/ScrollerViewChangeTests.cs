@@ -784,6 +784,166 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Verifies the Scroller stops ticking on CompositionTarget.Rendering once its view changes complete.")]
+        public void RenderingIsUnhookedAfterViewChangeCompletion()
+        {
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+            AutoResetEvent scrollerViewChangeOperationEvent = new AutoResetEvent(false);
+            ScrollerOperation operation = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsFalse(ScrollerTestHooksHelper.IsCompositionTargetRenderingHooked(scroller));
+
+                operation = StartChangeOffsets(
+                    scroller,
+                    600.0,
+                    400.0,
+                    ScrollerViewKind.Absolute,
+                    ScrollerViewChangeKind.DisableAnimation,
+                    ScrollerViewChangeSnapPointRespect.IgnoreSnapPoints,
+                    scrollerViewChangeOperationEvent);
+
+                Verify.IsTrue(ScrollerTestHooksHelper.IsCompositionTargetRenderingHooked(scroller));
+            });
+
+            WaitForEvent("Waiting for view change completion", scrollerViewChangeOperationEvent);
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(operation.Result, ScrollerViewChangeResult.Completed);
+                Verify.IsFalse(ScrollerTestHooksHelper.IsCompositionTargetRenderingHooked(scroller));
+            });
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Verifies the Scroller records interaction metrics for an animated view change.")]
+        public void InteractionMetricsAreRecordedForAnimatedViewChange()
+        {
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+            AutoResetEvent scrollerViewChangeOperationEvent = new AutoResetEvent(false);
+            ScrollerOperation operation = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                operation = StartChangeOffsets(
+                    scroller,
+                    600.0,
+                    400.0,
+                    ScrollerViewKind.Absolute,
+                    ScrollerViewChangeKind.AllowAnimation,
+                    ScrollerViewChangeSnapPointRespect.IgnoreSnapPoints,
+                    scrollerViewChangeOperationEvent);
+            });
+
+            WaitForEvent("Waiting for view change completion", scrollerViewChangeOperationEvent);
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                int valuesChangedCount;
+                int inertiaFrameCount;
+                int missedFrameCount;
+                double firstValuesChangedLatencyInMilliseconds;
+
+                ScrollerTestHooksHelper.GetLatestInteractionMetrics(
+                    scroller, out valuesChangedCount, out inertiaFrameCount, out missedFrameCount, out firstValuesChangedLatencyInMilliseconds);
+
+                Verify.AreEqual(operation.Result, ScrollerViewChangeResult.Completed);
+                Verify.IsGreaterThan(valuesChangedCount, 0);
+                Verify.AreEqual(0, inertiaFrameCount);
+                Verify.IsGreaterThanOrEqual(missedFrameCount, 0);
+                Verify.IsGreaterThanOrEqual(firstValuesChangedLatencyInMilliseconds, 0.0);
+            });
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Verifies that consecutive absolute offsets changes are coalesced when IsChangeOffsetsCoalescingEnabled is True.")]
+        public void CoalescedOffsetsChanges()
+        {
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+            AutoResetEvent scrollerViewChangeOperationEvent = new AutoResetEvent(false);
+            int viewChangeCompletedCount = 0;
+            ScrollerOperation[] operations = new ScrollerOperation[3];
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsFalse(scroller.IsChangeOffsetsCoalescingEnabled);
+                scroller.IsChangeOffsetsCoalescingEnabled = true;
+
+                scroller.ViewChangeCompleted += (Scroller sender, ScrollerViewChangeCompletedEventArgs args) =>
+                {
+                    viewChangeCompletedCount++;
+                };
+
+                for (int i = 0; i < operations.Length; i++)
+                {
+                    operations[i] = StartChangeOffsets(
+                        scroller,
+                        100.0 * (i + 1),
+                        50.0 * (i + 1),
+                        ScrollerViewKind.Absolute,
+                        ScrollerViewChangeKind.DisableAnimation,
+                        ScrollerViewChangeSnapPointRespect.IgnoreSnapPoints,
+                        scrollerViewChangeOperationEvent);
+                }
+
+                Verify.AreEqual(operations[0].Id, operations[1].Id);
+                Verify.AreEqual(operations[0].Id, operations[2].Id);
+            });
+
+            WaitForEvent("Waiting for view change completion", scrollerViewChangeOperationEvent);
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(ScrollerViewChangeResult.Completed, operations[2].Result);
+                Verify.AreEqual(1, viewChangeCompletedCount);
+                Verify.AreEqual(300.0, scroller.HorizontalOffset);
+                Verify.AreEqual(150.0, scroller.VerticalOffset);
+            });
+        }
+
         [TestMethod]
         [TestProperty("Description", "Performs consecutive non-animated zoomFactor changes.")]
         public void ConsecutiveZoomFactorJumps()
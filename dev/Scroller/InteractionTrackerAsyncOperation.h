@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ScrollerTrace.h"
+#include "QPCTimer.h"
 
 enum class InteractionTrackerAsyncOperationType
 {
@@ -184,11 +185,25 @@ public:
         m_requestId = requestId;
     }
 
+    // Time elapsed since the operation was created, used for the view change perf events.
+    double GetElapsedMilliseconds() const
+    {
+        return m_timer.DurationInMicroSeconds() / 1000.0;
+    }
+
     winrt::IInspectable GetOptions() const
     {
         return m_options;
     }
 
+    void SetOptions(const winrt::IInspectable& options)
+    {
+        SCROLLER_TRACE_VERBOSE(nullptr, TRACE_MSG_METH_PTR, METH_NAME, this, winrt::get_abi(options));
+
+        MUX_ASSERT(IsQueued());
+        m_options = options;
+    }
+
 private:
     // Identifies the InteractionTracker request type for this operation.
     InteractionTrackerAsyncOperationType m_operationType{ InteractionTrackerAsyncOperationType::None };
@@ -223,5 +238,8 @@ private:
 
     // ViewChangeId associated with this operation.
     int32_t m_viewChangeId{ -1 };
+
+    // Started when the operation is created.
+    QPCTimer m_timer{};
 };
 
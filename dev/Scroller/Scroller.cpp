@@ -6,6 +6,7 @@
 #include "TypeLogging.h"
 #include "ResourceAccessor.h"
 #include "RuntimeProfiler.h"
+#include "SampledPerfTrace.h"
 #include "InteractionTrackerOwner.h"
 #include "Scroller.h"
 #include "ScrollerChangeOffsetsOptions.h"
@@ -24,14 +25,29 @@ bool ScrollerTrace::s_IsVerboseDebugOutputEnabled{ false };
 // Number of pixels scrolled when the automation peer requests a line-type change.
 const double c_scrollerLineDelta = 16.0;
 
+// Expected interval between two ValuesChanged notifications while the view moves, used to detect missed UI thread frames.
+const double c_frameIntervalInMilliseconds = 1000.0 / 60.0;
+
 // Default inertia decay rate used when a IScrollController makes a request for
 // an offset change with additional velocity.
 const float c_scrollerDefaultInertiaDecayRate = 0.95f;
 
+// Compositor used by the UI thread's Scrollers and the expression animations parsed for it, indexed by expression.
+// See Scroller::GetSharedExpressionAnimation.
+static thread_local winrt::weak_ref<winrt::Compositor> s_sharedExpressionAnimationsCompositor{ nullptr };
+static thread_local std::unordered_map<winrt::hstring, winrt::ExpressionAnimation> s_sharedExpressionAnimations{};
+
+// Bring-into-view request currently bubbling up through nested Scrollers, and the operations queued by the ones
+// that fulfilled it so far. See Scroller::JoinBringIntoViewChain.
+static thread_local const void* s_bringIntoViewChainArgs{ nullptr };
+static thread_local std::vector<std::weak_ptr<InteractionTrackerAsyncOperation>> s_bringIntoViewChainOperations{};
+
 Scroller::~Scroller()
 {
     SCROLLER_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
 
+    __RP_Marker_ClassInstanceDestroyed(RuntimeProfiler::ProfId_Scroller);
+
     if (SharedHelpers::IsRS4OrHigher() &&
         !Scroller::IsInteractionTrackerMouseWheelZoomingEnabled() &&
         m_isListeningToKeystrokes)
@@ -46,6 +62,9 @@ Scroller::~Scroller()
 
 Scroller::Scroller()
 {
+    __RP_Marker_ClassById(RuntimeProfiler::ProfId_Scroller);
+    __RP_Marker_ClassInstanceCreated(RuntimeProfiler::ProfId_Scroller);
+
     EnsureProperties();
 
     SCROLLER_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
@@ -371,6 +390,56 @@ winrt::InteractionState Scroller::State()
     return m_state;
 }
 
+// Returns the size of the window centered on the predicted end-of-inertia position within which horizontal and vertical
+// snap points are handed to the InteractionTracker. Infinity, the default, installs all snap points.
+double Scroller::SnapPointsEvaluationWindow()
+{
+    return m_snapPointsEvaluationWindow;
+}
+
+void Scroller::SnapPointsEvaluationWindow(double value)
+{
+    SCROLLER_TRACE_INFO(*this, TRACE_MSG_METH_DBL, METH_NAME, this, value);
+
+    if (isnan(value) || value <= 0.0)
+    {
+        throw winrt::hresult_invalid_argument(L"'value' must be strictly positive.");
+    }
+
+    if (m_snapPointsEvaluationWindow != value)
+    {
+        m_snapPointsEvaluationWindow = value;
+
+        if (!SharedHelpers::IsTH2OrLower())
+        {
+            if (!m_sortedConsolidatedHorizontalSnapPoints.empty())
+            {
+                SetupSnapPoints(&m_sortedConsolidatedHorizontalSnapPoints, ScrollerDimension::HorizontalScroll);
+            }
+
+            if (!m_sortedConsolidatedVerticalSnapPoints.empty())
+            {
+                SetupSnapPoints(&m_sortedConsolidatedVerticalSnapPoints, ScrollerDimension::VerticalScroll);
+            }
+        }
+    }
+}
+
+// When True, an absolute ChangeOffsets call issued while the operation of the previous absolute ChangeOffsets call
+// is still queued replaces that operation's target offsets instead of starting a new operation. The call then returns
+// the ViewChangeId of the pending operation, which completes once with the latest offsets.
+bool Scroller::IsChangeOffsetsCoalescingEnabled()
+{
+    return m_isChangeOffsetsCoalescingEnabled;
+}
+
+void Scroller::IsChangeOffsetsCoalescingEnabled(bool value)
+{
+    SCROLLER_TRACE_INFO(*this, TRACE_MSG_METH_INT, METH_NAME, this, value);
+
+    m_isChangeOffsetsCoalescingEnabled = value;
+}
+
 winrt::IVector<winrt::ScrollerSnapPointBase> Scroller::HorizontalSnapPoints()
 {
     if (!m_horizontalSnapPoints)
@@ -418,12 +487,13 @@ winrt::IVector<winrt::ScrollerSnapPointBase> Scroller::ZoomSnapPoints()
 
 // Allows to change the HorizontalOffset/VerticalOffset properties in an asynchronous manner, either through an animation or jump.
 // Returns a unique integer representing the asynchronous operation and exposed in the ViewChangeCompleted event.
-// An InteractionTrackerAsyncOperation instance gets stored in a std::list<std::shared_ptr<InteractionTrackerAsyncOperation>>, m_interactionTrackerAsyncOperations,
+// An InteractionTrackerAsyncOperation instance gets stored in a std::vector<std::shared_ptr<InteractionTrackerAsyncOperation>>, m_interactionTrackerAsyncOperations,
 // during the lifetime of the async action.
 int32_t Scroller::ChangeOffsets(
     winrt::ScrollerChangeOffsetsOptions const& options)
 {
     SCROLLER_TRACE_INFO(*this, TRACE_MSG_METH_STR, METH_NAME, this, TypeLogging::ScrollerChangeOffsetsOptionsToString(options).c_str());
+    __RP_Marker_ClassMemberById(RuntimeProfiler::ProfId_Scroller, RuntimeProfiler::ProfMemberId_Scroller_ChangeOffsets);
 
     if (SharedHelpers::IsTH2OrLower())
     {
@@ -460,12 +530,13 @@ int32_t Scroller::ChangeOffsetsWithAdditionalVelocity(
 // Allows to change the ZoomFactor properties in an asynchronous manner, either through an animation or jump. The HorizontalOffset/VerticalOffset
 // properties can be affected too by the zoomFactor change.
 // Returns a unique integer representing the asynchronous operation and exposed in the ViewChangeCompleted event.
-// An InteractionTrackerAsyncOperation instance gets stored in a std::list<std::shared_ptr<InteractionTrackerAsyncOperation>>, m_interactionTrackerAsyncOperations,
+// An InteractionTrackerAsyncOperation instance gets stored in a std::vector<std::shared_ptr<InteractionTrackerAsyncOperation>>, m_interactionTrackerAsyncOperations,
 // during the lifetime of the async action.
 int32_t Scroller::ChangeZoomFactor(
     winrt::ScrollerChangeZoomFactorOptions const& options)
 {
     SCROLLER_TRACE_INFO(*this, TRACE_MSG_METH_STR, METH_NAME, this, TypeLogging::ScrollerChangeZoomFactorOptionsToString(options).c_str());
+    __RP_Marker_ClassMemberById(RuntimeProfiler::ProfId_Scroller, RuntimeProfiler::ProfMemberId_Scroller_ChangeZoomFactor);
 
     if (SharedHelpers::IsTH2OrLower())
     {
@@ -502,6 +573,7 @@ int32_t Scroller::ChangeZoomFactorWithAdditionalVelocity(
 
 winrt::Size Scroller::MeasureOverride(winrt::Size const& availableSize)
 {
+    SAMPLED_PERF_TRACE_SCOPE("Scroller.Measure");
     SCROLLER_TRACE_INFO(*this, TRACE_MSG_METH_STR_FLT_FLT, METH_NAME, this, L"availableSize:", availableSize.Width, availableSize.Height);
 
     m_availableSize = availableSize;
@@ -555,8 +627,15 @@ winrt::Size Scroller::MeasureOverride(winrt::Size const& availableSize)
 
 winrt::Size Scroller::ArrangeOverride(winrt::Size const& finalSize)
 {
+    SAMPLED_PERF_TRACE_SCOPE("Scroller.Arrange");
     SCROLLER_TRACE_INFO(*this, TRACE_MSG_METH_STR_FLT_FLT, METH_NAME, this, L"finalSize", finalSize.Width, finalSize.Height);
 
+    const QPCTimer arrangeTimer;
+    auto traceArrangeDuration = gsl::finally([this, &arrangeTimer]()
+    {
+        SCROLLER_TRACE_PERF_ARRANGE(this, arrangeTimer.DurationInMicroSeconds() / 1000.0);
+    });
+
     const winrt::UIElement content = Content();
     winrt::Rect finalContentRect{};
     winrt::Size viewport =
@@ -898,6 +977,7 @@ void Scroller::InertiaStateEntered(
         m_endOfInertiaZoomFactor);
 
     UpdateState(winrt::InteractionState::Inertia);
+    RefreshSnapPointsWindows();
 }
 
 void Scroller::InteractingStateEntered(
@@ -955,6 +1035,8 @@ void Scroller::ValuesChanged(
 
     std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation = GetInteractionTrackerOperationFromRequestId(requestId);
 
+    RecordInteractionValuesChanged(interactionTrackerAsyncOperation);
+
     double oldZoomedHorizontalOffset = m_zoomedHorizontalOffset;
     double oldZoomedVerticalOffset = m_zoomedVerticalOffset;
     float oldZoomFactor = m_zoomFactor;
@@ -971,16 +1053,22 @@ void Scroller::ValuesChanged(
     {
         OnViewChanged(oldZoomedHorizontalOffset != m_zoomedHorizontalOffset /*horizontalOffsetChanged*/,
             oldZoomedVerticalOffset != m_zoomedVerticalOffset /*verticalOffsetChanged*/);
+        RefreshSnapPointsWindows();
     }
 
     if (requestId != 0 && !m_interactionTrackerAsyncOperations.empty())
     {
+        // A non-animated request results in a single ValuesChanged notification. Completing its operation here rather than
+        // after c_maxNonAnimatedOperationTicks ticks lets the OnCompositionTargetRendering handler unhook on the next tick.
+        // The tick countdown remains for requests that leave the InteractionTracker silent because the view is unchanged.
+        const bool completeOperation = interactionTrackerAsyncOperation && !interactionTrackerAsyncOperation->IsAnimated() && !interactionTrackerAsyncOperation->IsQueued();
+
         CompleteInteractionTrackerOperations(
             requestId,
-            winrt::ScrollerViewChangeResult::Ignored     /*unused operationResult*/,
+            winrt::ScrollerViewChangeResult::Completed   /*operationResult*/,
             winrt::ScrollerViewChangeResult::Completed   /*priorNonAnimatedOperationsResult*/,
             winrt::ScrollerViewChangeResult::Interrupted /*priorAnimatedOperationsResult*/,
-            false /*completeOperation*/,
+            completeOperation,
             true  /*completePriorNonAnimatedOperations*/,
             true  /*completePriorAnimatedOperations*/);
     }
@@ -1211,16 +1299,19 @@ winrt::float2 Scroller::ComputePositionFromOffsets(double zoomedHorizontalOffset
 }
 
 // Evaluate what the value will be once the snap points have been applied.
-double Scroller::ComputeValueAfterSnapPoints(double value, const std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator>& snapPoints)
+double Scroller::ComputeValueAfterSnapPoints(double value, const std::vector<SnapPointZone>& snapPointZones)
 {
-    for (winrt::ScrollerSnapPointBase winrtSnapPoint : snapPoints)
+    // The zones are sorted and do not overlap, so the first zone ending at or after the value is the only candidate.
+    // Like a front-to-back walk, this picks the earlier of two zones sharing a boundary equal to the value.
+    const auto snapPointZone = std::lower_bound(
+        snapPointZones.begin(),
+        snapPointZones.end(),
+        value,
+        [](const SnapPointZone& zone, double value) { return zone.end < value; });
+
+    if (snapPointZone != snapPointZones.end() && snapPointZone->start <= value)
     {
-        auto snapPoint = winrt::get_self<ScrollerSnapPointBase>(winrtSnapPoint);
-        if (std::get<0>(snapPoint->ActualApplicableZone()) <= value &&
-            std::get<1>(snapPoint->ActualApplicableZone()) >= value)
-        {
-            return ((double)snapPoint->Evaluate((float)value));
-        }
+        return ((double)snapPointZone->snapPoint->Evaluate((float)value));
     }
     return value;
 }
@@ -1437,17 +1528,10 @@ void Scroller::EnsureExpressionAnimationSources()
         MUX_ASSERT(!m_maxPositionSourceExpressionAnimation);
         MUX_ASSERT(!m_zoomFactorSourceExpressionAnimation);
 
-        m_positionSourceExpressionAnimation = compositor.CreateExpressionAnimation(L"Vector2(it.Position.X, it.Position.Y)");
-        m_positionSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-
-        m_minPositionSourceExpressionAnimation = compositor.CreateExpressionAnimation(L"Vector2(it.MinPosition.X, it.MinPosition.Y)");
-        m_minPositionSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-
-        m_maxPositionSourceExpressionAnimation = compositor.CreateExpressionAnimation(L"Vector2(it.MaxPosition.X, it.MaxPosition.Y)");
-        m_maxPositionSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-
-        m_zoomFactorSourceExpressionAnimation = compositor.CreateExpressionAnimation(L"it.Scale");
-        m_zoomFactorSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
+        m_positionSourceExpressionAnimation = GetSharedExpressionAnimation(compositor, L"Vector2(it.Position.X, it.Position.Y)");
+        m_minPositionSourceExpressionAnimation = GetSharedExpressionAnimation(compositor, L"Vector2(it.MinPosition.X, it.MinPosition.Y)");
+        m_maxPositionSourceExpressionAnimation = GetSharedExpressionAnimation(compositor, L"Vector2(it.MaxPosition.X, it.MaxPosition.Y)");
+        m_zoomFactorSourceExpressionAnimation = GetSharedExpressionAnimation(compositor, L"it.Scale");
 
         StartExpressionAnimationSourcesAnimations();
         UpdateExpressionAnimationSources();
@@ -1562,41 +1646,16 @@ void Scroller::EnsureScrollControllerExpressionAnimationSources(
         MUX_ASSERT(!m_horizontalScrollControllerOffsetExpressionAnimation);
         MUX_ASSERT(!m_horizontalScrollControllerMaxOffsetExpressionAnimation);
 
-        m_horizontalScrollControllerOffsetExpressionAnimation = compositor.CreateExpressionAnimation(L"it.Position.X - it.MinPosition.X");
-        m_horizontalScrollControllerOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-        m_horizontalScrollControllerMaxOffsetExpressionAnimation = compositor.CreateExpressionAnimation(L"it.MaxPosition.X - it.MinPosition.X");
-        m_horizontalScrollControllerMaxOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
+        m_horizontalScrollControllerOffsetExpressionAnimation = GetSharedExpressionAnimation(compositor, L"it.Position.X - it.MinPosition.X");
+        m_horizontalScrollControllerMaxOffsetExpressionAnimation = GetSharedExpressionAnimation(compositor, L"it.MaxPosition.X - it.MinPosition.X");
     }
     else
     {
         MUX_ASSERT(!m_verticalScrollControllerOffsetExpressionAnimation);
         MUX_ASSERT(!m_verticalScrollControllerMaxOffsetExpressionAnimation);
 
-        m_verticalScrollControllerOffsetExpressionAnimation = compositor.CreateExpressionAnimation(L"it.Position.Y - it.MinPosition.Y");
-        m_verticalScrollControllerOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-        m_verticalScrollControllerMaxOffsetExpressionAnimation = compositor.CreateExpressionAnimation(L"it.MaxPosition.Y - it.MinPosition.Y");
-        m_verticalScrollControllerMaxOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-    }
-}
-
-void Scroller::EnsurePositionBoundariesExpressionAnimations()
-{
-    MUX_ASSERT(!SharedHelpers::IsTH2OrLower());
-
-    if (!m_minPositionExpressionAnimation || !m_maxPositionExpressionAnimation)
-    {
-        SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
-
-        const winrt::Compositor compositor = winrt::ElementCompositionPreview::GetElementVisual(*this).Compositor();
-
-        if (!m_minPositionExpressionAnimation)
-        {
-            m_minPositionExpressionAnimation = compositor.CreateExpressionAnimation();
-        }
-        if (!m_maxPositionExpressionAnimation)
-        {
-            m_maxPositionExpressionAnimation = compositor.CreateExpressionAnimation();
-        }
+        m_verticalScrollControllerOffsetExpressionAnimation = GetSharedExpressionAnimation(compositor, L"it.Position.Y - it.MinPosition.Y");
+        m_verticalScrollControllerMaxOffsetExpressionAnimation = GetSharedExpressionAnimation(compositor, L"it.MaxPosition.Y - it.MinPosition.Y");
     }
 }
 
@@ -1645,6 +1704,7 @@ void Scroller::SetupSnapPoints(std::set<winrt::ScrollerSnapPointBase, winrtProje
     MUX_ASSERT(!SharedHelpers::IsTH2OrLower());
 
     FixSnapPointRanges(snapPoints);
+    UpdateSnapPointZones(*snapPoints, dimension);
     if (!m_interactionTracker)
     {
         EnsureInteractionTracker();
@@ -1682,6 +1742,8 @@ void Scroller::SetupSnapPoints(std::set<winrt::ScrollerSnapPointBase, winrtProje
     //For older versions of windows the interaction tracker cannot accept empty collections of inertia modifiers
     if (snapPoints->size() == 0)
     {
+        GetSnapPointModifiers(dimension)->clear();
+
         winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
         winrt::ExpressionAnimation conditionExpressionAnimation = compositor.CreateExpressionAnimation(L"false");
         winrt::ExpressionAnimation restingPointExpressionAnimation = compositor.CreateExpressionAnimation(L"this.Target." + target);
@@ -1693,16 +1755,49 @@ void Scroller::SetupSnapPoints(std::set<winrt::ScrollerSnapPointBase, winrtProje
     }
     else
     {
+        std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier>* snapPointModifiers = GetSnapPointModifiers(dimension);
+        std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier> newSnapPointModifiers;
+        const double windowCenter = ComputeSnapPointsWindowCenter(dimension);
+        const double windowStart = windowCenter - m_snapPointsEvaluationWindow / 2.0;
+        const double windowEnd = windowCenter + m_snapPointsEvaluationWindow / 2.0;
+
+        newSnapPointModifiers.reserve(snapPoints->size());
+
         for (winrt::ScrollerSnapPointBase snapPoint : *snapPoints)
         {
-            ScrollerSnapPointBase* sp = winrt::get_self<ScrollerSnapPointBase>(snapPoint);
-            winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
+            if (!isnan(windowCenter))
+            {
+                ScrollerSnapPointBase* sp = winrt::get_self<ScrollerSnapPointBase>(snapPoint);
+                const std::tuple<double, double> actualApplicableZone = sp->ActualApplicableZone();
+
+                if (std::get<1>(actualApplicableZone) < windowStart || std::get<0>(actualApplicableZone) > windowEnd)
+                {
+                    // Snap points outside the window are not evaluated by the InteractionTracker. Their potential modifier
+                    // is kept for when the window moves back over them.
+                    auto snapPointModifier = snapPointModifiers->find(sp);
+
+                    if (snapPointModifier != snapPointModifiers->end())
+                    {
+                        newSnapPointModifiers.emplace(sp, std::move(snapPointModifier->second));
+                        snapPointModifiers->erase(snapPointModifier);
+                    }
+                    continue;
+                }
+            }
+
+            modifiers.Append(GetSnapPointModifier(snapPoint, compositor, target, scale, snapPointModifiers, &newSnapPointModifiers));
+        }
+
+        // Modifiers of snap points that are no longer part of the consolidated set are discarded.
+        *snapPointModifiers = std::move(newSnapPointModifiers);
 
-            winrt::ExpressionAnimation conditionExpressionAnimation = sp->CreateConditionalExpression(compositor, target, scale);
-            winrt::ExpressionAnimation restingPointExpressionAnimation = sp->CreateRestingPointExpression(compositor, target, scale);
+        if (modifiers.Size() == 0)
+        {
+            // No snap point overlaps with the window. Keep the InteractionTracker's natural resting value.
+            winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
 
-            modifier.Condition(conditionExpressionAnimation);
-            modifier.RestingValue(restingPointExpressionAnimation);
+            modifier.Condition(compositor.CreateExpressionAnimation(L"false"));
+            modifier.RestingValue(compositor.CreateExpressionAnimation(L"this.Target." + target));
 
             modifiers.Append(modifier);
         }
@@ -1730,6 +1825,144 @@ void Scroller::SetupSnapPoints(std::set<winrt::ScrollerSnapPointBase, winrtProje
     }
 }
 
+// Returns the inertia modifier for the provided consolidated snap point. The modifier created by a previous SetupSnapPoints call is
+// reused when available: only its expression parameters are refreshed since FixSnapPointRanges may have altered the snap point's
+// actual values. New modifiers are only created for snap points that were added since then, like for a single vector insertion.
+winrt::InteractionTrackerInertiaRestingValue Scroller::GetSnapPointModifier(
+    const winrt::ScrollerSnapPointBase& snapPoint,
+    const winrt::Compositor& compositor,
+    const winrt::hstring& target,
+    const winrt::hstring& scale,
+    _Inout_ std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier>* oldSnapPointModifiers,
+    _Inout_ std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier>* newSnapPointModifiers)
+{
+    ScrollerSnapPointBase* sp = winrt::get_self<ScrollerSnapPointBase>(snapPoint);
+    auto oldSnapPointModifier = oldSnapPointModifiers->find(sp);
+
+    if (oldSnapPointModifier != oldSnapPointModifiers->end())
+    {
+        winrt::InteractionTrackerInertiaRestingValue modifier = oldSnapPointModifier->second.modifier;
+
+        sp->UpdateConditionalExpression(modifier.Condition());
+        sp->UpdateRestingPointExpression(modifier.RestingValue());
+
+        newSnapPointModifiers->emplace(sp, std::move(oldSnapPointModifier->second));
+        oldSnapPointModifiers->erase(oldSnapPointModifier);
+        return modifier;
+    }
+
+    winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
+
+    winrt::ExpressionAnimation conditionExpressionAnimation = sp->CreateConditionalExpression(compositor, target, scale);
+    winrt::ExpressionAnimation restingPointExpressionAnimation = sp->CreateRestingPointExpression(compositor, target, scale);
+
+    modifier.Condition(conditionExpressionAnimation);
+    modifier.RestingValue(restingPointExpressionAnimation);
+
+    newSnapPointModifiers->emplace(sp, SnapPointModifier{ snapPoint, modifier });
+    return modifier;
+}
+
+// Returns the unzoomed center of the window of snap points to install for the provided dimension, based on the predicted
+// end-of-inertia position, and records it for RefreshSnapPointsWindows. Returns NaN when all snap points are installed.
+double Scroller::ComputeSnapPointsWindowCenter(ScrollerDimension dimension)
+{
+    double windowCenter = DoubleUtil::NaN;
+
+    if (dimension == ScrollerDimension::HorizontalScroll || dimension == ScrollerDimension::VerticalScroll)
+    {
+        if (!isinf(m_snapPointsEvaluationWindow))
+        {
+            const winrt::float2 endOfInertiaPosition = ComputeEndOfInertiaPosition();
+            const float endOfInertiaZoomFactor = ComputeEndOfInertiaZoomFactor();
+
+            windowCenter = (dimension == ScrollerDimension::HorizontalScroll ? endOfInertiaPosition.x : endOfInertiaPosition.y) / endOfInertiaZoomFactor;
+        }
+
+        if (dimension == ScrollerDimension::HorizontalScroll)
+        {
+            m_horizontalSnapPointsWindowCenter = windowCenter;
+        }
+        else
+        {
+            m_verticalSnapPointsWindowCenter = windowCenter;
+        }
+    }
+
+    return windowCenter;
+}
+
+// Moves the windows of installed snap points once the predicted end-of-inertia position drifted by a quarter of their size.
+void Scroller::RefreshSnapPointsWindows()
+{
+    if (isinf(m_snapPointsEvaluationWindow))
+    {
+        return;
+    }
+
+    const winrt::float2 endOfInertiaPosition = ComputeEndOfInertiaPosition();
+    const float endOfInertiaZoomFactor = ComputeEndOfInertiaZoomFactor();
+    const double refreshDistance = m_snapPointsEvaluationWindow / 4.0;
+
+    if (!m_sortedConsolidatedHorizontalSnapPoints.empty() &&
+        (isnan(m_horizontalSnapPointsWindowCenter) || std::abs(endOfInertiaPosition.x / endOfInertiaZoomFactor - m_horizontalSnapPointsWindowCenter) > refreshDistance))
+    {
+        SetupSnapPoints(&m_sortedConsolidatedHorizontalSnapPoints, ScrollerDimension::HorizontalScroll);
+    }
+
+    if (!m_sortedConsolidatedVerticalSnapPoints.empty() &&
+        (isnan(m_verticalSnapPointsWindowCenter) || std::abs(endOfInertiaPosition.y / endOfInertiaZoomFactor - m_verticalSnapPointsWindowCenter) > refreshDistance))
+    {
+        SetupSnapPoints(&m_sortedConsolidatedVerticalSnapPoints, ScrollerDimension::VerticalScroll);
+    }
+}
+
+std::unordered_map<ScrollerSnapPointBase*, Scroller::SnapPointModifier>* Scroller::GetSnapPointModifiers(ScrollerDimension dimension)
+{
+    switch (dimension)
+    {
+        case ScrollerDimension::HorizontalScroll:
+            return &m_horizontalSnapPointModifiers;
+        case ScrollerDimension::VerticalScroll:
+            return &m_verticalSnapPointModifiers;
+        default:
+            MUX_ASSERT(dimension == ScrollerDimension::ZoomFactor);
+            return &m_zoomSnapPointModifiers;
+    }
+}
+
+std::vector<Scroller::SnapPointZone>* Scroller::GetSnapPointZones(ScrollerDimension dimension)
+{
+    switch (dimension)
+    {
+        case ScrollerDimension::HorizontalScroll:
+            return &m_horizontalSnapPointZones;
+        case ScrollerDimension::VerticalScroll:
+            return &m_verticalSnapPointZones;
+        default:
+            MUX_ASSERT(dimension == ScrollerDimension::ZoomFactor);
+            return &m_zoomSnapPointZones;
+    }
+}
+
+// Refreshes the native copy of the actual applicable zones used by ComputeValueAfterSnapPoints. Must be invoked
+// after FixSnapPointRanges whenever the consolidated snap points change.
+void Scroller::UpdateSnapPointZones(const std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator>& snapPoints, ScrollerDimension dimension)
+{
+    std::vector<SnapPointZone>* snapPointZones = GetSnapPointZones(dimension);
+
+    snapPointZones->clear();
+    snapPointZones->reserve(snapPoints.size());
+
+    for (const winrt::ScrollerSnapPointBase& winrtSnapPoint : snapPoints)
+    {
+        ScrollerSnapPointBase* snapPoint = winrt::get_self<ScrollerSnapPointBase>(winrtSnapPoint);
+        const std::tuple<double, double> actualApplicableZone = snapPoint->ActualApplicableZone();
+
+        snapPointZones->push_back({ std::get<0>(actualApplicableZone), std::get<1>(actualApplicableZone), snapPoint });
+    }
+}
+
 //Snap points which have ApplicableRangeType = Optional are optional snap points, and their ActualApplicableRange should never be expanded beyond their ApplicableRange
 //and will only shrink to accommodate other snap points which are positioned such that the midpoint between them is within the specifiedApplicableRange.
 //Snap points which have ApplicableRangeType = Mandatory are mandatory snap points and their ActualApplicableRange will expand or shrink to ensure that there is no
@@ -1771,7 +2004,6 @@ void Scroller::SetupInteractionTrackerBoundaries()
 
     if (content && (!m_minPositionExpressionAnimation || !m_maxPositionExpressionAnimation))
     {
-        EnsurePositionBoundariesExpressionAnimations();
         SetupPositionBoundariesExpressionAnimations(content);
     }
 }
@@ -2764,31 +2996,13 @@ void Scroller::SetupPositionBoundariesExpressionAnimations(
     const winrt::UIElement& content)
 {
     MUX_ASSERT(content);
-    MUX_ASSERT(m_minPositionExpressionAnimation);
-    MUX_ASSERT(m_maxPositionExpressionAnimation);
     MUX_ASSERT(m_interactionTracker);
 
-    const winrt::Visual scrollerVisual = winrt::ElementCompositionPreview::GetElementVisual(*this);
-
-    winrt::hstring s = m_minPositionExpressionAnimation.Expression();
-
-    if (s.empty())
-    {
-        m_minPositionExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-        m_minPositionExpressionAnimation.SetReferenceParameter(L"scrollerVisual", scrollerVisual);
-    }
-
-    m_minPositionExpressionAnimation.Expression(GetMinPositionExpression(content));
-
-    s = m_maxPositionExpressionAnimation.Expression();
-
-    if (s.empty())
-    {
-        m_maxPositionExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
-        m_maxPositionExpressionAnimation.SetReferenceParameter(L"scrollerVisual", scrollerVisual);
-    }
+    const winrt::Compositor compositor = m_interactionTracker.Compositor();
 
-    m_maxPositionExpressionAnimation.Expression(GetMaxPositionExpression(content));
+    // Scrollers with the same content alignments share the same parsed boundary expressions.
+    m_minPositionExpressionAnimation = GetSharedExpressionAnimation(compositor, GetMinPositionExpression(content));
+    m_maxPositionExpressionAnimation = GetSharedExpressionAnimation(compositor, GetMaxPositionExpression(content));
 
     UpdatePositionBoundaries(content);
 }
@@ -2910,9 +3124,13 @@ void Scroller::StartExpressionAnimationSourcesAnimations()
     MUX_ASSERT(m_maxPositionSourceExpressionAnimation);
     MUX_ASSERT(m_zoomFactorSourceExpressionAnimation);
 
+    m_positionSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
     m_expressionAnimationSources.StartAnimation(s_positionSourcePropertyName, m_positionSourceExpressionAnimation);
+    m_minPositionSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
     m_expressionAnimationSources.StartAnimation(s_minPositionSourcePropertyName, m_minPositionSourceExpressionAnimation);
+    m_maxPositionSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
     m_expressionAnimationSources.StartAnimation(s_maxPositionSourcePropertyName, m_maxPositionSourceExpressionAnimation);
+    m_zoomFactorSourceExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
     m_expressionAnimationSources.StartAnimation(s_zoomFactorSourcePropertyName, m_zoomFactorSourceExpressionAnimation);
 }
 
@@ -2944,7 +3162,9 @@ void Scroller::StartScrollControllerExpressionAnimationSourcesAnimations(
         MUX_ASSERT(m_horizontalScrollControllerOffsetExpressionAnimation);
         MUX_ASSERT(m_horizontalScrollControllerMaxOffsetExpressionAnimation);
 
+        m_horizontalScrollControllerOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
         m_horizontalScrollControllerExpressionAnimationSources.StartAnimation(s_offsetPropertyName, m_horizontalScrollControllerOffsetExpressionAnimation);
+        m_horizontalScrollControllerMaxOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
         m_horizontalScrollControllerExpressionAnimationSources.StartAnimation(s_maxOffsetPropertyName, m_horizontalScrollControllerMaxOffsetExpressionAnimation);
     }
     else
@@ -2953,7 +3173,9 @@ void Scroller::StartScrollControllerExpressionAnimationSourcesAnimations(
         MUX_ASSERT(m_verticalScrollControllerOffsetExpressionAnimation);
         MUX_ASSERT(m_verticalScrollControllerMaxOffsetExpressionAnimation);
 
+        m_verticalScrollControllerOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
         m_verticalScrollControllerExpressionAnimationSources.StartAnimation(s_offsetPropertyName, m_verticalScrollControllerOffsetExpressionAnimation);
+        m_verticalScrollControllerMaxOffsetExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
         m_verticalScrollControllerExpressionAnimationSources.StartAnimation(s_maxOffsetPropertyName, m_verticalScrollControllerMaxOffsetExpressionAnimation);
     }
 }
@@ -3118,6 +3340,29 @@ bool Scroller::IsVisualTranslationPropertyAvailable()
     return DownlevelHelper::SetIsTranslationEnabledExists();
 }
 
+// Returns an ExpressionAnimation for the provided expression, shared with all the Scrollers of the UI thread so that
+// identical expressions are only created and parsed once per compositor. Composition copies an animation when it is
+// started, so callers must set all the reference and scalar parameters they rely on right before each StartAnimation call.
+winrt::ExpressionAnimation Scroller::GetSharedExpressionAnimation(const winrt::Compositor& compositor, const winrt::hstring& expression)
+{
+    MUX_ASSERT(compositor);
+
+    if (s_sharedExpressionAnimationsCompositor.get() != compositor)
+    {
+        s_sharedExpressionAnimations.clear();
+        s_sharedExpressionAnimationsCompositor = winrt::make_weak(compositor);
+    }
+
+    auto sharedExpressionAnimation = s_sharedExpressionAnimations.find(expression);
+
+    if (sharedExpressionAnimation == s_sharedExpressionAnimations.end())
+    {
+        sharedExpressionAnimation = s_sharedExpressionAnimations.emplace(expression, compositor.CreateExpressionAnimation(expression)).first;
+    }
+
+    return sharedExpressionAnimation->second;
+}
+
 // Returns the target property path, according to the availability of the ElementCompositionPreview::SetIsTranslationEnabled method,
 // and the provided dimension.
 wstring_view Scroller::GetVisualTargetedPropertyName(ScrollerDimension dimension)
@@ -3406,11 +3651,18 @@ void Scroller::OnCompositionTargetRendering(const winrt::IInspectable& /*sender*
 
     if (!m_interactionTrackerAsyncOperations.empty() && IsLoaded())
     {
-        for (auto operationsIter = m_interactionTrackerAsyncOperations.begin(); operationsIter != m_interactionTrackerAsyncOperations.end();)
+        BeginInteractionTrackerOperationsEnumeration();
+        auto endEnumeration = gsl::finally([this]() { EndInteractionTrackerOperationsEnumeration(); });
+
+        // Operations added while ticking are visited in the same pass.
+        for (size_t operationIndex = 0; operationIndex < m_interactionTrackerAsyncOperations.size(); operationIndex++)
         {
-            auto& interactionTrackerAsyncOperation = *operationsIter;
+            const std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation = m_interactionTrackerAsyncOperations[operationIndex];
 
-            operationsIter++;
+            if (!interactionTrackerAsyncOperation)
+            {
+                continue;
+            }
 
             if (interactionTrackerAsyncOperation->IsDelayed())
             {
@@ -3446,7 +3698,7 @@ void Scroller::OnCompositionTargetRendering(const winrt::IInspectable& /*sender*
                 {
                     // The non-animated view change request did not result in a status change or ValuesChanged notification. Consider it completed.
                     CompleteViewChange(interactionTrackerAsyncOperation, winrt::ScrollerViewChangeResult::Completed);
-                    m_interactionTrackerAsyncOperations.remove(interactionTrackerAsyncOperation);
+                    RemoveInteractionTrackerOperation(operationIndex);
                 }
                 else
                 {
@@ -3513,8 +3765,11 @@ void Scroller::OnLoaded(
             SetupTransformExpressionAnimations(content);
         }
 
-        // Process the potentially delayed operation in the OnCompositionTargetRendering handler.
-        HookCompositionTargetRendering();
+        if (!m_interactionTrackerAsyncOperations.empty())
+        {
+            // Process the potentially delayed operation in the OnCompositionTargetRendering handler.
+            HookCompositionTargetRendering();
+        }
     }
 }
 
@@ -3574,15 +3829,12 @@ void Scroller::OnPointerWheelChangedHandler(
         return;
     }
 
-    winrt::CoreVirtualKeyStates ctrlState = winrt::CoreWindow::GetForCurrentThread().GetKeyState(winrt::VirtualKey::Control);
-    winrt::PointerPoint pointerPoint = args.GetCurrentPoint(*this);
-    winrt::PointerPointProperties pointerPointProperties = pointerPoint.Properties();
-    bool isHorizontalMouseWheel = pointerPointProperties.IsHorizontalMouseWheel();
-    bool isControlPressed = (ctrlState & winrt::CoreVirtualKeyStates::Down) == winrt::CoreVirtualKeyStates::Down;
-
-    if (!isControlPressed || isHorizontalMouseWheel)
+    // High-resolution wheels and precision touchpads raise this event many times per frame, so the
+    // cheap rejections come first: the modifiers travel with the event args and require no CoreWindow
+    // query, and the PointerPoint is only retrieved once a zoom is possible.
+    if ((args.KeyModifiers() & winrt::VirtualKeyModifiers::Control) != winrt::VirtualKeyModifiers::Control)
     {
-        // Mouse-wheel-triggered zooming is only attempted when Control key is down and event is not for a horizontal scroll.
+        // Mouse-wheel-triggered zooming is only attempted when Control key is down.
         return;
     }
 
@@ -3593,6 +3845,15 @@ void Scroller::OnPointerWheelChangedHandler(
         return;
     }
 
+    winrt::PointerPoint pointerPoint = args.GetCurrentPoint(*this);
+    winrt::PointerPointProperties pointerPointProperties = pointerPoint.Properties();
+
+    if (pointerPointProperties.IsHorizontalMouseWheel())
+    {
+        // Mouse-wheel-triggered zooming is not attempted for a horizontal scroll.
+        return;
+    }
+
     int32_t mouseWheelDelta = pointerPointProperties.MouseWheelDelta();
     float endOfInertiaZoomFactor = ComputeEndOfInertiaZoomFactor();
     float minZoomFactor = m_interactionTracker.MinScale();
@@ -3630,6 +3891,8 @@ void Scroller::OnPointerWheelChangedHandler(
 
     if (interactionTrackerAsyncOperation)
     {
+        // All the notches received before the next UI thread tick accumulate into the pending operation
+        // instead of each queuing its own TryUpdateScaleWithAdditionalVelocity request.
         winrt::IInspectable options = interactionTrackerAsyncOperation->GetOptions();
         optionsClone = options.as<winrt::ScrollerChangeZoomFactorWithAdditionalVelocityOptions>();
         additionalVelocity += optionsClone.AdditionalVelocity();
@@ -3820,6 +4083,8 @@ void Scroller::OnBringIntoViewRequestedHandler(
             *options,
             viewChangeId /*existingViewChangeId*/,
             nullptr /*viewChangeId*/);
+
+        JoinBringIntoViewChain(args);
     }
     else
     {
@@ -4407,7 +4672,6 @@ void Scroller::UpdateContent(
             }
             else if (m_interactionTracker)
             {
-                EnsurePositionBoundariesExpressionAnimations();
                 SetupPositionBoundariesExpressionAnimations(newContent);
             }
 
@@ -4490,6 +4754,14 @@ void Scroller::UpdatePositionBoundaries(
         SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_STR_FLT, METH_NAME, this, L"contentLayoutOffsetX", m_contentLayoutOffsetX);
         SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_STR_FLT, METH_NAME, this, L"contentLayoutOffsetY", m_contentLayoutOffsetY);
 
+        const winrt::Visual scrollerVisual = winrt::ElementCompositionPreview::GetElementVisual(*this);
+
+        // The boundary animations are shared templates, so all their parameters are set before each start.
+        m_minPositionExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
+        m_maxPositionExpressionAnimation.SetReferenceParameter(L"it", m_interactionTracker);
+        m_minPositionExpressionAnimation.SetReferenceParameter(L"scrollerVisual", scrollerVisual);
+        m_maxPositionExpressionAnimation.SetReferenceParameter(L"scrollerVisual", scrollerVisual);
+
         m_minPositionExpressionAnimation.SetScalarParameter(L"contentSizeX", static_cast<float>(m_unzoomedExtentWidth));
         m_maxPositionExpressionAnimation.SetScalarParameter(L"contentSizeX", static_cast<float>(m_unzoomedExtentWidth));
         m_minPositionExpressionAnimation.SetScalarParameter(L"contentSizeY", static_cast<float>(m_unzoomedExtentHeight));
@@ -4521,12 +4793,81 @@ void Scroller::UpdateTransformSource(
     StartTransformExpressionAnimations(newContent);
 }
 
+void Scroller::RecordInteractionValuesChanged(
+    const std::shared_ptr<InteractionTrackerAsyncOperation>& interactionTrackerAsyncOperation)
+{
+    // A non-animated view change is delivered while idle, as a single notification.
+    const bool isNonAnimatedViewChange = m_state == winrt::InteractionState::Idle;
+
+    if (isNonAnimatedViewChange)
+    {
+        m_interactionMetrics = {};
+    }
+
+    // The view moves on every frame during inertia and animations, unlike during a user interaction
+    // which may hold the view still. Notifications further apart than a frame and a half then mean
+    // that the UI thread missed frames.
+    if (m_interactionMetrics.valuesChangedCount > 0 &&
+        (m_state == winrt::InteractionState::Inertia || m_state == winrt::InteractionState::Animation))
+    {
+        const double intervalInMilliseconds = m_valuesChangedTimer.DurationInMicroSeconds() / 1000.0;
+
+        if (intervalInMilliseconds > 1.5 * c_frameIntervalInMilliseconds)
+        {
+            m_interactionMetrics.missedFrameCount += static_cast<int>(intervalInMilliseconds / c_frameIntervalInMilliseconds + 0.5) - 1;
+        }
+    }
+
+    m_valuesChangedTimer.Reset();
+    m_interactionMetrics.valuesChangedCount++;
+
+    if (m_state == winrt::InteractionState::Inertia)
+    {
+        m_interactionMetrics.inertiaFrameCount++;
+    }
+
+    if (interactionTrackerAsyncOperation && m_interactionMetrics.firstValuesChangedLatencyInMilliseconds < 0.0)
+    {
+        m_interactionMetrics.firstValuesChangedLatencyInMilliseconds = interactionTrackerAsyncOperation->GetElapsedMilliseconds();
+    }
+
+    if (isNonAnimatedViewChange)
+    {
+        CompleteInteractionMetrics();
+    }
+}
+
+void Scroller::CompleteInteractionMetrics()
+{
+    m_latestInteractionMetrics = m_interactionMetrics;
+
+    SCROLLER_TRACE_PERF_INTERACTION_METRICS(
+        this,
+        m_latestInteractionMetrics.valuesChangedCount,
+        m_latestInteractionMetrics.inertiaFrameCount,
+        m_latestInteractionMetrics.missedFrameCount,
+        m_latestInteractionMetrics.firstValuesChangedLatencyInMilliseconds);
+}
+
 void Scroller::UpdateState(
     const winrt::InteractionState& state)
 {
     if (state != m_state)
     {
+        if (m_state == winrt::InteractionState::Idle)
+        {
+            // An interaction starts.
+            m_interactionMetrics = {};
+            m_valuesChangedTimer.Reset();
+        }
+
         m_state = state;
+
+        if (m_state == winrt::InteractionState::Idle)
+        {
+            CompleteInteractionMetrics();
+        }
+
         RaiseStateChanged();
     }
 }
@@ -4941,6 +5282,16 @@ void Scroller::ChangeOffsetsPrivate(
             snapPointRespect);
     }
 
+    if (m_isChangeOffsetsCoalescingEnabled &&
+        operationTrigger == InteractionTrackerAsyncOperationTrigger::DirectViewChange &&
+        offsetsKind == winrt::ScrollerViewKind::Absolute &&
+        existingViewChangeId == -1 &&
+        TryCoalesceOffsetsChange(operationType, delayOperation, winrt::IInspectable{ *optionsClone }, viewChangeId))
+    {
+        // The latest offsets were handed to the pending operation which will be processed once in ProcessDequeuedViewChange.
+        return;
+    }
+
     if (!delayOperation)
     {
         MUX_ASSERT(m_interactionTracker);
@@ -4980,7 +5331,7 @@ void Scroller::ChangeOffsetsPrivate(
         interactionTrackerAsyncOperation->SetTicksCountdown(std::max(1, ticksCountdown));
     }
 
-    m_interactionTrackerAsyncOperations.push_back(interactionTrackerAsyncOperation);
+    AddInteractionTrackerOperation(interactionTrackerAsyncOperation);
 
     if (viewChangeId)
     {
@@ -5002,6 +5353,121 @@ void Scroller::ChangeOffsetsPrivate(
     }
 }
 
+// Gives the operation just queued for the provided bring-into-view request the same ticks countdown as the ones queued
+// by the nested Scrollers that already handled that request on its way up. Each level would otherwise be processed on
+// its own schedule (for instance when one of them first interrupts an animated view change), resulting in a staggered
+// multi-frame scroll instead of all the Scrollers of the chain moving during the same UI thread tick.
+void Scroller::JoinBringIntoViewChain(const winrt::BringIntoViewRequestedEventArgs& args)
+{
+    std::shared_ptr<InteractionTrackerAsyncOperation> latestInteractionTrackerAsyncOperation;
+
+    for (auto operationsIter = m_interactionTrackerAsyncOperations.rbegin(); operationsIter != m_interactionTrackerAsyncOperations.rend(); operationsIter++)
+    {
+        if (*operationsIter)
+        {
+            latestInteractionTrackerAsyncOperation = *operationsIter;
+            break;
+        }
+    }
+
+    if (!latestInteractionTrackerAsyncOperation ||
+        !latestInteractionTrackerAsyncOperation->IsQueued() ||
+        latestInteractionTrackerAsyncOperation->IsDelayed() ||
+        latestInteractionTrackerAsyncOperation->IsCanceled())
+    {
+        return;
+    }
+
+    const void* argsAbi = winrt::get_abi(args);
+
+    if (s_bringIntoViewChainArgs != argsAbi)
+    {
+        // This Scroller is the first one to handle the request.
+        s_bringIntoViewChainArgs = argsAbi;
+        s_bringIntoViewChainOperations.clear();
+    }
+
+    s_bringIntoViewChainOperations.push_back(latestInteractionTrackerAsyncOperation);
+
+    int ticksCountdown = 0;
+
+    for (auto operationsIter = s_bringIntoViewChainOperations.begin(); operationsIter != s_bringIntoViewChainOperations.end();)
+    {
+        const auto interactionTrackerAsyncOperation = operationsIter->lock();
+
+        if (!interactionTrackerAsyncOperation || !interactionTrackerAsyncOperation->IsQueued() || interactionTrackerAsyncOperation->IsCanceled())
+        {
+            operationsIter = s_bringIntoViewChainOperations.erase(operationsIter);
+        }
+        else
+        {
+            ticksCountdown = std::max(ticksCountdown, interactionTrackerAsyncOperation->GetTicksCountdown());
+            operationsIter++;
+        }
+    }
+
+    for (auto& operation : s_bringIntoViewChainOperations)
+    {
+        const auto interactionTrackerAsyncOperation = operation.lock();
+
+        if (interactionTrackerAsyncOperation->GetTicksCountdown() != ticksCountdown)
+        {
+            SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_PTR_INT, METH_NAME, this, interactionTrackerAsyncOperation.get(), ticksCountdown);
+
+            interactionTrackerAsyncOperation->SetTicksCountdown(ticksCountdown);
+        }
+    }
+}
+
+// Hands the provided absolute ChangeOffsets options to the most recent operation when it is a still queued absolute
+// ChangeOffsets operation of the same type and delay state. Returns True when the options were coalesced, in which case
+// viewChangeId is set to the pending operation's ViewChangeId and no new operation is created.
+bool Scroller::TryCoalesceOffsetsChange(
+    InteractionTrackerAsyncOperationType operationType,
+    bool isDelayed,
+    const winrt::IInspectable& options,
+    _Out_opt_ int32_t* viewChangeId)
+{
+    std::shared_ptr<InteractionTrackerAsyncOperation> latestInteractionTrackerAsyncOperation;
+
+    for (auto operationsIter = m_interactionTrackerAsyncOperations.rbegin(); operationsIter != m_interactionTrackerAsyncOperations.rend(); operationsIter++)
+    {
+        if (*operationsIter)
+        {
+            latestInteractionTrackerAsyncOperation = *operationsIter;
+            break;
+        }
+    }
+
+    if (!latestInteractionTrackerAsyncOperation ||
+        !latestInteractionTrackerAsyncOperation->IsQueued() ||
+        latestInteractionTrackerAsyncOperation->IsCanceled() ||
+        latestInteractionTrackerAsyncOperation->IsDelayed() != isDelayed ||
+        latestInteractionTrackerAsyncOperation->GetOperationTrigger() != InteractionTrackerAsyncOperationTrigger::DirectViewChange ||
+        latestInteractionTrackerAsyncOperation->GetOperationType() != operationType)
+    {
+        return false;
+    }
+
+    const winrt::ScrollerChangeOffsetsOptions pendingOptions = latestInteractionTrackerAsyncOperation->GetOptions().try_as<winrt::ScrollerChangeOffsetsOptions>();
+
+    if (!pendingOptions || pendingOptions.OffsetsKind() != winrt::ScrollerViewKind::Absolute)
+    {
+        return false;
+    }
+
+    SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_PTR_INT, METH_NAME, this,
+        latestInteractionTrackerAsyncOperation.get(), latestInteractionTrackerAsyncOperation->GetViewChangeId());
+
+    latestInteractionTrackerAsyncOperation->SetOptions(options);
+
+    if (viewChangeId)
+    {
+        *viewChangeId = latestInteractionTrackerAsyncOperation->GetViewChangeId();
+    }
+    return true;
+}
+
 void Scroller::ChangeOffsetsWithAdditionalVelocityPrivate(
     InteractionTrackerAsyncOperationTrigger operationTrigger,
     const winrt::ScrollerChangeOffsetsWithAdditionalVelocityOptions& options,
@@ -5060,7 +5526,7 @@ void Scroller::ChangeOffsetsWithAdditionalVelocityPrivate(
         interactionTrackerAsyncOperation->SetTicksCountdown(std::max(1, ticksCountdown));
     }
 
-    m_interactionTrackerAsyncOperations.push_back(interactionTrackerAsyncOperation);
+    AddInteractionTrackerOperation(interactionTrackerAsyncOperation);
 
     if (viewChangeId)
     {
@@ -5176,7 +5642,7 @@ void Scroller::ChangeZoomFactorPrivate(
         interactionTrackerAsyncOperation->SetTicksCountdown(interactionTrackerAsyncOperation->GetTicksCountdown() + 1);
     }
 
-    m_interactionTrackerAsyncOperations.push_back(interactionTrackerAsyncOperation);
+    AddInteractionTrackerOperation(interactionTrackerAsyncOperation);
 
     if (viewChangeId)
     {
@@ -5243,7 +5709,7 @@ void Scroller::ChangeZoomFactorWithAdditionalVelocityPrivate(
         interactionTrackerAsyncOperation->SetTicksCountdown(std::max(1, ticksCountdown));
     }
 
-    m_interactionTrackerAsyncOperations.push_back(interactionTrackerAsyncOperation);
+    AddInteractionTrackerOperation(interactionTrackerAsyncOperation);
 
     if (viewChangeId)
     {
@@ -5308,7 +5774,16 @@ void Scroller::ProcessDequeuedViewChange(std::shared_ptr<InteractionTrackerAsync
             MUX_ASSERT(false);
         }
     }
-    interactionTrackerAsyncOperation->SetRequestId(m_latestInteractionTrackerRequest);
+    SetInteractionTrackerOperationRequestId(interactionTrackerAsyncOperation, m_latestInteractionTrackerRequest);
+
+    SCROLLER_TRACE_PERF_VIEW_CHANGE(
+        this,
+        "Started",
+        interactionTrackerAsyncOperation->GetViewChangeId(),
+        static_cast<int>(interactionTrackerAsyncOperation->GetOperationType()),
+        static_cast<int>(interactionTrackerAsyncOperation->GetOperationTrigger()),
+        interactionTrackerAsyncOperation->GetElapsedMilliseconds(),
+        false /*isInterrupted*/);
 }
 
 // Launches an InteractionTracker request to change the offsets.
@@ -5354,8 +5829,8 @@ void Scroller::ProcessOffsetsChange(
 
     if (respectSnapPoints)
     {
-        zoomedHorizontalOffset = ComputeValueAfterSnapPoints(zoomedHorizontalOffset, m_sortedConsolidatedHorizontalSnapPoints);
-        zoomedVerticalOffset = ComputeValueAfterSnapPoints(zoomedVerticalOffset, m_sortedConsolidatedVerticalSnapPoints);
+        zoomedHorizontalOffset = ComputeValueAfterSnapPoints(zoomedHorizontalOffset, m_horizontalSnapPointZones);
+        zoomedVerticalOffset = ComputeValueAfterSnapPoints(zoomedVerticalOffset, m_verticalSnapPointZones);
     }
 
     switch (viewChangeKind)
@@ -5489,7 +5964,7 @@ void Scroller::ProcessZoomFactorChange(
 
     if (options.SnapPointRespect() == winrt::ScrollerViewChangeSnapPointRespect::RespectSnapPoints)
     {
-        zoomFactor = (float)ComputeValueAfterSnapPoints(zoomFactor, m_sortedConsolidatedZoomSnapPoints);
+        zoomFactor = (float)ComputeValueAfterSnapPoints(zoomFactor, m_zoomSnapPointZones);
     }
 
     switch (options.ViewChangeKind())
@@ -5609,6 +6084,15 @@ void Scroller::CompleteViewChange(
     SCROLLER_TRACE_INFO(*this, TRACE_MSG_METH_PTR_STR, METH_NAME, this,
         interactionTrackerAsyncOperation.get(), TypeLogging::ScrollerViewChangeResultToString(result).c_str());
 
+    SCROLLER_TRACE_PERF_VIEW_CHANGE(
+        this,
+        "Completed",
+        interactionTrackerAsyncOperation->GetViewChangeId(),
+        static_cast<int>(interactionTrackerAsyncOperation->GetOperationType()),
+        static_cast<int>(interactionTrackerAsyncOperation->GetOperationTrigger()),
+        interactionTrackerAsyncOperation->GetElapsedMilliseconds(),
+        result == winrt::ScrollerViewChangeResult::Interrupted /*isInterrupted*/);
+
     bool onHorizontalOffsetChangeCompleted = false;
     bool onVerticalOffsetChangeCompleted = false;
 
@@ -5664,11 +6148,27 @@ void Scroller::CompleteInteractionTrackerOperations(
         return;
     }
 
-    for (auto operationsIter = m_interactionTrackerAsyncOperations.begin(); operationsIter != m_interactionTrackerAsyncOperations.end();)
+    if (requestId != -1 && !completePriorNonAnimatedOperations && !completePriorAnimatedOperations)
+    {
+        // Only the operations with the provided request id are completed. Find them through the request id lookup
+        // instead of visiting all pending operations.
+        if (m_interactionTrackerAsyncOperationsByRequestId.count(requestId) == 0)
+        {
+            return;
+        }
+    }
+
+    BeginInteractionTrackerOperationsEnumeration();
+    auto endEnumeration = gsl::finally([this]() { EndInteractionTrackerOperationsEnumeration(); });
+
+    for (size_t operationIndex = 0; operationIndex < m_interactionTrackerAsyncOperations.size(); operationIndex++)
     {
-        auto& interactionTrackerAsyncOperation = *operationsIter;
+        const std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation = m_interactionTrackerAsyncOperations[operationIndex];
 
-        operationsIter++;
+        if (!interactionTrackerAsyncOperation)
+        {
+            continue;
+        }
 
         bool isMatch = requestId == -1 || requestId == interactionTrackerAsyncOperation->GetRequestId();
         bool isPriorMatch = requestId > interactionTrackerAsyncOperation->GetRequestId() && -1 != interactionTrackerAsyncOperation->GetRequestId();
@@ -5687,17 +6187,15 @@ void Scroller::CompleteInteractionTrackerOperations(
                     interactionTrackerAsyncOperation,
                     isMatch ? operationResult : (isOperationAnimated ? priorAnimatedOperationsResult : priorNonAnimatedOperationsResult));
 
-                auto interactionTrackerAsyncOperationRemoved = interactionTrackerAsyncOperation;
-
-                m_interactionTrackerAsyncOperations.remove(interactionTrackerAsyncOperationRemoved);
+                RemoveInteractionTrackerOperation(operationIndex);
 
-                switch (interactionTrackerAsyncOperationRemoved->GetOperationType())
+                switch (interactionTrackerAsyncOperation->GetOperationType())
                 {
                     case InteractionTrackerAsyncOperationType::TryUpdatePositionWithAdditionalVelocity:
-                        PostProcessOffsetsChange(interactionTrackerAsyncOperationRemoved);
+                        PostProcessOffsetsChange(interactionTrackerAsyncOperation);
                         break;
                     case InteractionTrackerAsyncOperationType::TryUpdateScaleWithAdditionalVelocity:
-                        PostProcessZoomFactorChange(interactionTrackerAsyncOperationRemoved);
+                        PostProcessZoomFactorChange(interactionTrackerAsyncOperation);
                         break;
                 }
             }
@@ -5714,18 +6212,107 @@ void Scroller::CompleteDelayedOperations()
 
     SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
 
-    for (auto operationsIter = m_interactionTrackerAsyncOperations.begin(); operationsIter != m_interactionTrackerAsyncOperations.end();)
-    {
-        auto& interactionTrackerAsyncOperation = *operationsIter;
+    BeginInteractionTrackerOperationsEnumeration();
+    auto endEnumeration = gsl::finally([this]() { EndInteractionTrackerOperationsEnumeration(); });
 
-        operationsIter++;
+    for (size_t operationIndex = 0; operationIndex < m_interactionTrackerAsyncOperations.size(); operationIndex++)
+    {
+        const std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation = m_interactionTrackerAsyncOperations[operationIndex];
 
-        if (interactionTrackerAsyncOperation->IsDelayed())
+        if (interactionTrackerAsyncOperation && interactionTrackerAsyncOperation->IsDelayed())
         {
             CompleteViewChange(interactionTrackerAsyncOperation, winrt::ScrollerViewChangeResult::Interrupted);
-            m_interactionTrackerAsyncOperations.remove(interactionTrackerAsyncOperation);
+            RemoveInteractionTrackerOperation(operationIndex);
+        }
+    }
+}
+
+void Scroller::AddInteractionTrackerOperation(
+    const std::shared_ptr<InteractionTrackerAsyncOperation>& interactionTrackerAsyncOperation)
+{
+    MUX_ASSERT(interactionTrackerAsyncOperation);
+    MUX_ASSERT(interactionTrackerAsyncOperation->GetRequestId() == -1);
+
+    m_interactionTrackerAsyncOperations.push_back(interactionTrackerAsyncOperation);
+
+    // The ViewChangeId is not assigned yet at this point.
+    SCROLLER_TRACE_PERF_VIEW_CHANGE(
+        this,
+        "Queued",
+        interactionTrackerAsyncOperation->GetViewChangeId(),
+        static_cast<int>(interactionTrackerAsyncOperation->GetOperationType()),
+        static_cast<int>(interactionTrackerAsyncOperation->GetOperationTrigger()),
+        0.0 /*latencyInMilliseconds*/,
+        false /*isInterrupted*/);
+}
+
+// Removes the operation at the provided index from m_interactionTrackerAsyncOperations and from the request id lookup.
+// The slot is only cleared when the vector is being enumerated so that the enumerating loops' indexes remain valid.
+void Scroller::RemoveInteractionTrackerOperation(
+    size_t operationIndex)
+{
+    MUX_ASSERT(operationIndex < m_interactionTrackerAsyncOperations.size());
+
+    const std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation = m_interactionTrackerAsyncOperations[operationIndex];
+
+    MUX_ASSERT(interactionTrackerAsyncOperation);
+
+    const int requestId = interactionTrackerAsyncOperation->GetRequestId();
+
+    if (requestId != -1)
+    {
+        const auto it = m_interactionTrackerAsyncOperationsByRequestId.find(requestId);
+
+        if (it != m_interactionTrackerAsyncOperationsByRequestId.end())
+        {
+            auto& requestOperations = it->second;
+
+            requestOperations.erase(std::remove(requestOperations.begin(), requestOperations.end(), interactionTrackerAsyncOperation), requestOperations.end());
+            if (requestOperations.empty())
+            {
+                m_interactionTrackerAsyncOperationsByRequestId.erase(it);
+            }
         }
     }
+
+    if (m_interactionTrackerAsyncOperationsEnumerationDepth > 0)
+    {
+        m_interactionTrackerAsyncOperations[operationIndex] = nullptr;
+        m_hasRemovedInteractionTrackerAsyncOperations = true;
+    }
+    else
+    {
+        m_interactionTrackerAsyncOperations.erase(m_interactionTrackerAsyncOperations.begin() + operationIndex);
+    }
+}
+
+void Scroller::SetInteractionTrackerOperationRequestId(
+    const std::shared_ptr<InteractionTrackerAsyncOperation>& interactionTrackerAsyncOperation,
+    int requestId)
+{
+    MUX_ASSERT(interactionTrackerAsyncOperation);
+    MUX_ASSERT(interactionTrackerAsyncOperation->GetRequestId() == -1);
+
+    interactionTrackerAsyncOperation->SetRequestId(requestId);
+    m_interactionTrackerAsyncOperationsByRequestId[requestId].push_back(interactionTrackerAsyncOperation);
+}
+
+void Scroller::BeginInteractionTrackerOperationsEnumeration()
+{
+    m_interactionTrackerAsyncOperationsEnumerationDepth++;
+}
+
+void Scroller::EndInteractionTrackerOperationsEnumeration()
+{
+    MUX_ASSERT(m_interactionTrackerAsyncOperationsEnumerationDepth > 0);
+
+    if (--m_interactionTrackerAsyncOperationsEnumerationDepth == 0 && m_hasRemovedInteractionTrackerAsyncOperations)
+    {
+        m_interactionTrackerAsyncOperations.erase(
+            std::remove(m_interactionTrackerAsyncOperations.begin(), m_interactionTrackerAsyncOperations.end(), nullptr),
+            m_interactionTrackerAsyncOperations.end());
+        m_hasRemovedInteractionTrackerAsyncOperations = false;
+    }
 }
 
 int Scroller::GetInteractionTrackerOperationsTicksCountdownForTrigger(InteractionTrackerAsyncOperationTrigger operationTrigger) const
@@ -5734,7 +6321,8 @@ int Scroller::GetInteractionTrackerOperationsTicksCountdownForTrigger(Interactio
 
     for (auto& interactionTrackerAsyncOperation : m_interactionTrackerAsyncOperations)
     {
-        if ((static_cast<int>(interactionTrackerAsyncOperation->GetOperationTrigger()) & static_cast<int>(operationTrigger)) != 0x00 &&
+        if (interactionTrackerAsyncOperation &&
+            (static_cast<int>(interactionTrackerAsyncOperation->GetOperationTrigger()) & static_cast<int>(operationTrigger)) != 0x00 &&
             !interactionTrackerAsyncOperation->IsCanceled())
         {
             ticksCountdown = std::max(ticksCountdown, interactionTrackerAsyncOperation->GetTicksCountdown());
@@ -5752,6 +6340,11 @@ int Scroller::GetInteractionTrackerOperationsCount(bool includeAnimatedOperation
 
     for (auto& interactionTrackerAsyncOperation : m_interactionTrackerAsyncOperations)
     {
+        if (!interactionTrackerAsyncOperation)
+        {
+            continue;
+        }
+
         bool isOperationAnimated = interactionTrackerAsyncOperation->IsAnimated();
 
         if ((isOperationAnimated && includeAnimatedOperations) || (!isOperationAnimated && includeNonAnimatedOperations))
@@ -5767,15 +6360,9 @@ std::shared_ptr<InteractionTrackerAsyncOperation> Scroller::GetInteractionTracke
 {
     MUX_ASSERT(requestId >= 0);
 
-    for (auto& interactionTrackerAsyncOperation : m_interactionTrackerAsyncOperations)
-    {
-        if (interactionTrackerAsyncOperation->GetRequestId() == requestId)
-        {
-            return interactionTrackerAsyncOperation;
-        }
-    }
+    const auto it = m_interactionTrackerAsyncOperationsByRequestId.find(requestId);
 
-    return nullptr;
+    return it == m_interactionTrackerAsyncOperationsByRequestId.end() ? nullptr : it->second.front();
 }
 
 std::shared_ptr<InteractionTrackerAsyncOperation> Scroller::GetInteractionTrackerOperationFromKinds(
@@ -5786,6 +6373,11 @@ std::shared_ptr<InteractionTrackerAsyncOperation> Scroller::GetInteractionTracke
 {
     for (auto& interactionTrackerAsyncOperation : m_interactionTrackerAsyncOperations)
     {
+        if (!interactionTrackerAsyncOperation)
+        {
+            continue;
+        }
+
         winrt::IInspectable options = interactionTrackerAsyncOperation->GetOptions();
 
         if ((static_cast<int>(interactionTrackerAsyncOperation->GetOperationTrigger()) & static_cast<int>(operationTrigger)) == 0x00 ||
@@ -5842,6 +6434,11 @@ std::shared_ptr<InteractionTrackerAsyncOperation> Scroller::GetInteractionTracke
 {
     for (auto& interactionTrackerAsyncOperation : m_interactionTrackerAsyncOperations)
     {
+        if (!interactionTrackerAsyncOperation)
+        {
+            continue;
+        }
+
         winrt::IInspectable options = interactionTrackerAsyncOperation->GetOptions();
 
         if ((static_cast<int>(interactionTrackerAsyncOperation->GetOperationTrigger()) & static_cast<int>(operationTrigger)) == 0x00 ||
@@ -12,10 +12,26 @@
 #include "ScrollerAnchorRequestedEventArgs.h"
 #include "ScrollerSnapPoint.h"
 #include "ScrollerTrace.h"
+#include "ScrollerViewListener.h"
 
 #include "Scroller.g.h"
 #include "Scroller.properties.h"
 
+// Smoothness of an interaction, i.e. the time the InteractionTracker spends away from its Idle state or the single
+// view change of a non-animated request. Recorded by the Scroller, read through ScrollerTestHooks and traced as
+// a ScrollerInteractionMetrics perf event.
+struct ScrollerInteractionMetrics
+{
+    // ValuesChanged notifications received, one per frame in which the view moved.
+    int valuesChangedCount{};
+    // ValuesChanged notifications received while in the Inertia state.
+    int inertiaFrameCount{};
+    // UI thread frames that went by without a ValuesChanged notification while the view moved.
+    int missedFrameCount{};
+    // Time between the view change request and its first ValuesChanged notification, -1 for user interactions.
+    double firstValuesChangedLatencyInMilliseconds{ -1.0 };
+};
+
 class Scroller :
     public ReferenceTracker<Scroller, DeriveFromPanelHelper_base, winrt::Scroller, winrt::Controls::IScrollAnchorProvider, winrt::IRepeaterScrollingSurface>,
     public ScrollerProperties
@@ -59,6 +75,7 @@ public:
     static constexpr double s_defaultMinZoomFactor{ 0.1 };
     static constexpr double s_defaultMaxZoomFactor{ 10.0 };
     static constexpr double s_defaultAnchorRatio{ 0.0 };
+    static constexpr double s_defaultSnapPointsEvaluationWindow{ std::numeric_limits<double>::infinity() };
 
     // ChangeOffsets scrolling constants
     static constexpr int s_offsetsChangeMsPerUnit{ 5 };
@@ -157,6 +174,12 @@ public:
 
     winrt::IVector<winrt::ScrollerSnapPointBase> ZoomSnapPoints();
 
+    double SnapPointsEvaluationWindow();
+    void SnapPointsEvaluationWindow(double value);
+
+    bool IsChangeOffsetsCoalescingEnabled();
+    void IsChangeOffsetsCoalescingEnabled(bool value);
+
     int32_t ChangeOffsets(winrt::ScrollerChangeOffsetsOptions const& options);
     int32_t ChangeOffsetsWithAdditionalVelocity(winrt::ScrollerChangeOffsetsWithAdditionalVelocityOptions const& options);
     int32_t ChangeZoomFactor(winrt::ScrollerChangeZoomFactorOptions const& options);
@@ -189,6 +212,18 @@ public:
     void SetContentLayoutOffsetX(float contentLayoutOffsetX);
     void SetContentLayoutOffsetY(float contentLayoutOffsetY);
 
+    // Returns True while the OnCompositionTargetRendering handler is hooked, which keeps the XAML render loop alive.
+    bool IsCompositionTargetRenderingHooked() const
+    {
+        return m_renderingToken.value != 0;
+    }
+
+    // Metrics of the latest completed interaction.
+    const ScrollerInteractionMetrics& GetLatestInteractionMetrics() const
+    {
+        return m_latestInteractionMetrics;
+    }
+
     winrt::IVector<winrt::ScrollerSnapPointBase> GetConsolidatedSnapPoints(winrt::ScrollerSnapPointDimension dimension);
 
     // Invoked when a dependency property of this Scroller has changed.
@@ -237,12 +272,29 @@ private:
         ZoomFactor
     };
 
+    // InteractionTracker inertia modifier created for a consolidated snap point. Holding the snap point
+    // keeps it alive, and its address unique, for as long as the modifier is cached.
+    struct SnapPointModifier
+    {
+        winrt::ScrollerSnapPointBase snapPoint{ nullptr };
+        winrt::InteractionTrackerInertiaRestingValue modifier{ nullptr };
+    };
+
+    // Actual applicable zone of a consolidated snap point. Zones are stored in the order of the consolidated set,
+    // which makes them sorted and non-overlapping once FixSnapPointRanges ran. The snap point is kept alive by the set.
+    struct SnapPointZone
+    {
+        double start{};
+        double end{};
+        ScrollerSnapPointBase* snapPoint{ nullptr };
+    };
+
     float ComputeContentLayoutOffsetDelta(ScrollerDimension dimension, float unzoomedDelta) const;
     float ComputeEndOfInertiaZoomFactor() const;
     winrt::float2 ComputeEndOfInertiaPosition();
     void ComputeMinMaxPositions(float zoomFactor, _Out_opt_ winrt::float2* minPosition, _Out_opt_ winrt::float2* maxPosition);
     winrt::float2 ComputePositionFromOffsets(double zoomedHorizontalOffset, double zoomedVerticalOffset);
-    double ComputeValueAfterSnapPoints(double value, const std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator>& snapPoints);
+    static double ComputeValueAfterSnapPoints(double value, const std::vector<SnapPointZone>& snapPointZones);
     winrt::float2 ComputeCenterPointerForMouseWheelZooming(const winrt::UIElement& content, const winrt::Point& pointerPosition) const;
     void ComputeBringIntoViewTargetOffsets(
         const winrt::UIElement& content,
@@ -261,9 +313,20 @@ private:
         ScrollerDimension dimension);
     void EnsureScrollControllerExpressionAnimationSources(
         ScrollerDimension dimension);
-    void EnsurePositionBoundariesExpressionAnimations();
     void EnsureTransformExpressionAnimations();
     void SetupSnapPoints(std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator>* snapPoints, ScrollerDimension dimension);
+    winrt::InteractionTrackerInertiaRestingValue GetSnapPointModifier(
+        const winrt::ScrollerSnapPointBase& snapPoint,
+        const winrt::Compositor& compositor,
+        const winrt::hstring& target,
+        const winrt::hstring& scale,
+        _Inout_ std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier>* oldSnapPointModifiers,
+        _Inout_ std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier>* newSnapPointModifiers);
+    std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier>* GetSnapPointModifiers(ScrollerDimension dimension);
+    std::vector<SnapPointZone>* GetSnapPointZones(ScrollerDimension dimension);
+    void UpdateSnapPointZones(const std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator>& snapPoints, ScrollerDimension dimension);
+    double ComputeSnapPointsWindowCenter(ScrollerDimension dimension);
+    void RefreshSnapPointsWindows();
     void FixSnapPointRanges(std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator>* snapPoints);
     void SetupInteractionTrackerBoundaries();
     void SetupInteractionTrackerZoomFactorBoundaries(
@@ -328,6 +391,9 @@ private:
     void UpdateTransformSource(
         const winrt::UIElement& oldContent,
         const winrt::UIElement& newContent);
+    void RecordInteractionValuesChanged(
+        const std::shared_ptr<InteractionTrackerAsyncOperation>& interactionTrackerAsyncOperation);
+    void CompleteInteractionMetrics();
     void UpdateState(
         const winrt::InteractionState& state);
     void UpdateExpressionAnimationSources();
@@ -350,6 +416,13 @@ private:
         const winrt::ScrollerChangeOffsetsOptions& options,
         int32_t existingViewChangeId,
         _Out_opt_ int32_t* viewChangeId);
+    void JoinBringIntoViewChain(
+        const winrt::BringIntoViewRequestedEventArgs& args);
+    bool TryCoalesceOffsetsChange(
+        InteractionTrackerAsyncOperationType operationType,
+        bool isDelayed,
+        const winrt::IInspectable& options,
+        _Out_opt_ int32_t* viewChangeId);
     void ChangeOffsetsWithAdditionalVelocityPrivate(
         InteractionTrackerAsyncOperationTrigger operationTrigger,
         const winrt::ScrollerChangeOffsetsWithAdditionalVelocityOptions& options,
@@ -392,6 +465,15 @@ private:
         bool completePriorNonAnimatedOperations,
         bool completePriorAnimatedOperations);
     void CompleteDelayedOperations();
+    void AddInteractionTrackerOperation(
+        const std::shared_ptr<InteractionTrackerAsyncOperation>& interactionTrackerAsyncOperation);
+    void RemoveInteractionTrackerOperation(
+        size_t operationIndex);
+    void SetInteractionTrackerOperationRequestId(
+        const std::shared_ptr<InteractionTrackerAsyncOperation>& interactionTrackerAsyncOperation,
+        int requestId);
+    void BeginInteractionTrackerOperationsEnumeration();
+    void EndInteractionTrackerOperationsEnumeration();
     int GetInteractionTrackerOperationsTicksCountdownForTrigger(
         InteractionTrackerAsyncOperationTrigger operationTrigger) const;
     int GetInteractionTrackerOperationsCount(
@@ -567,6 +649,12 @@ private:
         std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator>* internalSet);
 
 #pragma region IRepeaterScrollingSurface Helpers
+public:
+    // Native alternative to the ViewportChanged event for consumers of this dll. See IScrollerViewListener.
+    void AddViewListener(IScrollerViewListener* listener);
+    void RemoveViewListener(IScrollerViewListener* listener);
+
+private:
     void RaiseConfigurationChanged();
     void RaisePostArrange();
     void RaiseViewportChanged(const bool isFinal);
@@ -598,16 +686,32 @@ private:
     void ResetAnchorElement();
     void EnsureAnchorElementSelection();
 
+    // Visual parent shared by anchor candidates during a single EnsureAnchorElementSelection pass.
+    // Caches whether the parent belongs to the Content and its transform to the Content.
+    struct AnchorCandidateParent
+    {
+        winrt::UIElement element{ nullptr };
+        winrt::GeneralTransform transformToContent{ nullptr };
+        bool isValid{ false };
+    };
+
     void ProcessAnchorCandidate(
         const winrt::UIElement& anchorCandidate,
         const winrt::UIElement& content,
         const winrt::Rect& viewportAnchorBounds,
         double viewportAnchorPointHorizontalOffset,
         double viewportAnchorPointVerticalOffset,
+        _Inout_ std::unordered_map<void*, AnchorCandidateParent>* anchorCandidateParents,
         _Inout_ double* bestAnchorCandidateDistance,
         _Inout_ winrt::UIElement* bestAnchorCandidate,
         _Inout_ winrt::Rect* bestAnchorCandidateBounds) const;
 
+    static bool TryGetAnchorCandidateBounds(
+        const winrt::UIElement& anchorCandidate,
+        const winrt::UIElement& content,
+        _Inout_ std::unordered_map<void*, AnchorCandidateParent>* anchorCandidateParents,
+        _Out_ winrt::Rect* anchorCandidateBounds);
+
     static winrt::Rect GetDescendantBounds(
         const winrt::UIElement& content,
         const winrt::UIElement& descendant);
@@ -646,6 +750,7 @@ private:
     static bool IsInteractionTrackerMouseWheelZoomingEnabled();
     static bool IsVisualTranslationPropertyAvailable();
     static wstring_view GetVisualTargetedPropertyName(ScrollerDimension dimension);
+    static winrt::ExpressionAnimation GetSharedExpressionAnimation(const winrt::Compositor& compositor, const winrt::hstring& expression);
 
 #ifdef _DEBUG
     void DumpMinMaxPositions();
@@ -654,6 +759,8 @@ private:
 private:
     int m_latestViewChangeId{ 0 };
     int m_latestInteractionTrackerRequest{ 0 };
+    // Set to True when consecutive absolute ChangeOffsets calls are merged into the still queued operation of the previous call.
+    bool m_isChangeOffsetsCoalescingEnabled{ false };
     InteractionTrackerAsyncOperationType m_lastInteractionTrackerAsyncOperationType{ InteractionTrackerAsyncOperationType::None };
     winrt::float2 m_endOfInertiaPosition{ 0.0f, 0.0f };
     float m_endOfInertiaZoomFactor{ 1.0f };
@@ -679,9 +786,20 @@ private:
     tracker_ref<winrt::UIElement> m_anchorElement{ this };
     tracker_ref<winrt::ScrollerAnchorRequestedEventArgs> m_anchorRequestedEventArgs{ this };
     std::vector<tracker_ref<winrt::UIElement>> m_anchorCandidates;
-    std::list<std::shared_ptr<InteractionTrackerAsyncOperation>> m_interactionTrackerAsyncOperations;
+    // Pending view changes, in request order. Removed operations are reset to nullptr while the vector is being enumerated
+    // and compacted out once the outermost enumeration ends.
+    std::vector<std::shared_ptr<InteractionTrackerAsyncOperation>> m_interactionTrackerAsyncOperations;
+    // Pending view changes that were handed to the InteractionTracker, keyed by request id. Operations that share a request id,
+    // because they did not result in a new InteractionTracker request, are kept in request order.
+    std::unordered_map<int, std::vector<std::shared_ptr<InteractionTrackerAsyncOperation>>> m_interactionTrackerAsyncOperationsByRequestId;
+    int m_interactionTrackerAsyncOperationsEnumerationDepth{ 0 };
+    bool m_hasRemovedInteractionTrackerAsyncOperations{ false };
     winrt::Rect m_anchorElementBounds{};
     winrt::InteractionState m_state{ winrt::InteractionState::Idle };
+    ScrollerInteractionMetrics m_interactionMetrics{};
+    ScrollerInteractionMetrics m_latestInteractionMetrics{};
+    // Started at the previous ValuesChanged notification of the ongoing interaction.
+    QPCTimer m_valuesChangedTimer{};
     winrt::IInspectable m_pointerPressedEventHandler{ nullptr };
     winrt::CompositionPropertySet m_expressionAnimationSources{ nullptr };
     winrt::CompositionPropertySet m_horizontalScrollControllerExpressionAnimationSources{ nullptr };
@@ -699,6 +817,8 @@ private:
     winrt::ExpressionAnimation m_zoomFactorExpressionAnimation{ nullptr };
     winrt::ExpressionAnimation m_transformMatrixZoomFactorExpressionAnimation{ nullptr };
 
+    // The animations below are templates shared with all the Scrollers of the UI thread which are started
+    // with the Scroller's own reference and scalar parameters. See GetSharedExpressionAnimation.
     winrt::ExpressionAnimation m_positionSourceExpressionAnimation{ nullptr };
     winrt::ExpressionAnimation m_minPositionSourceExpressionAnimation{ nullptr };
     winrt::ExpressionAnimation m_maxPositionSourceExpressionAnimation{ nullptr };
@@ -711,6 +831,7 @@ private:
 
     // Event Sources
     event_source<winrt::ViewportChangedEventHandler> m_viewportChanged{ this };
+    std::vector<IScrollerViewListener*> m_viewListeners{};
     event_source<winrt::PostArrangeEventHandler> m_postArrange{ this };
     event_source<winrt::ConfigurationChangedEventHandler> m_configurationChanged{ this };
 
@@ -754,6 +875,20 @@ private:
     std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator> m_sortedConsolidatedHorizontalSnapPoints{};
     std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator> m_sortedConsolidatedVerticalSnapPoints{};
     std::set<winrt::ScrollerSnapPointBase, winrtProjectionComparator> m_sortedConsolidatedZoomSnapPoints{};
+    // InteractionTracker inertia modifiers of the consolidated snap points above, reused by SetupSnapPoints when
+    // their snap point is still present.
+    std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier> m_horizontalSnapPointModifiers{};
+    std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier> m_verticalSnapPointModifiers{};
+    std::unordered_map<ScrollerSnapPointBase*, SnapPointModifier> m_zoomSnapPointModifiers{};
+    // Native copies of the actual applicable zones of the consolidated snap points above, for binary searches.
+    std::vector<SnapPointZone> m_horizontalSnapPointZones{};
+    std::vector<SnapPointZone> m_verticalSnapPointZones{};
+    std::vector<SnapPointZone> m_zoomSnapPointZones{};
+    // Size of the window, in unzoomed content units, within which scroll snap points are handed to the InteractionTracker.
+    double m_snapPointsEvaluationWindow{ s_defaultSnapPointsEvaluationWindow };
+    // Unzoomed center of the window of installed horizontal/vertical snap points. NaN when all snap points are installed.
+    double m_horizontalSnapPointsWindowCenter{ DoubleUtil::NaN };
+    double m_verticalSnapPointsWindowCenter{ DoubleUtil::NaN };
 
     // Property names being targeted for the Scroller.Content's Visual.
     // RedStone v1 case:
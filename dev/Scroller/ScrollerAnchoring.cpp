@@ -32,6 +32,24 @@ void Scroller::RaisePostArrange()
     }
 }
 
+void Scroller::AddViewListener(IScrollerViewListener* listener)
+{
+    MUX_ASSERT(listener);
+    MUX_ASSERT(std::find(m_viewListeners.begin(), m_viewListeners.end(), listener) == m_viewListeners.end());
+
+    m_viewListeners.push_back(listener);
+}
+
+void Scroller::RemoveViewListener(IScrollerViewListener* listener)
+{
+    const auto viewListener = std::find(m_viewListeners.begin(), m_viewListeners.end(), listener);
+
+    if (viewListener != m_viewListeners.end())
+    {
+        m_viewListeners.erase(viewListener);
+    }
+}
+
 void Scroller::RaiseViewportChanged(const bool isFinal)
 {
     if (m_viewportChanged)
@@ -40,6 +58,26 @@ void Scroller::RaiseViewportChanged(const bool isFinal)
 
         m_viewportChanged(*this, isFinal);
     }
+
+    if (!m_viewListeners.empty())
+    {
+        ScrollerViewState viewState;
+
+        viewState.zoomedHorizontalOffset = m_zoomedHorizontalOffset;
+        viewState.zoomedVerticalOffset = m_zoomedVerticalOffset;
+        viewState.zoomFactor = m_zoomFactor;
+        viewState.viewportWidth = m_viewportWidth;
+        viewState.viewportHeight = m_viewportHeight;
+        viewState.unzoomedExtentWidth = m_unzoomedExtentWidth;
+        viewState.unzoomedExtentHeight = m_unzoomedExtentHeight;
+        viewState.isFinal = isFinal;
+
+        // Walking backwards lets a listener remove itself during the notification.
+        for (size_t index = m_viewListeners.size(); index > 0; index--)
+        {
+            m_viewListeners[index - 1]->OnScrollerViewChanged(viewState);
+        }
+    }
 }
 
 void Scroller::RaiseAnchorRequested()
@@ -315,6 +353,13 @@ void Scroller::EnsureAnchorElementSelection()
         return;
     }
 
+    const QPCTimer anchorEvaluationTimer;
+    int anchorCandidateCount = 0;
+    auto traceAnchorEvaluation = gsl::finally([this, &anchorEvaluationTimer, &anchorCandidateCount]()
+    {
+        SCROLLER_TRACE_PERF_ANCHOR_EVALUATION(this, anchorCandidateCount, anchorEvaluationTimer.DurationInMicroSeconds() / 1000.0);
+    });
+
     m_anchorElement.set(nullptr);
     m_anchorElementBounds = winrt::Rect{};
     m_isAnchorElementDirty = false;
@@ -371,8 +416,14 @@ void Scroller::EnsureAnchorElementSelection()
 
     MUX_ASSERT(content);
 
+    // Candidates registered by an ItemsRepeater typically share the same visual parent. Caching that parent's
+    // validity and transform to the Content avoids walking the tree up to the Content for each candidate.
+    std::unordered_map<void*, AnchorCandidateParent> anchorCandidateParents;
+
     if (anchorCandidates)
     {
+        anchorCandidateCount = static_cast<int>(anchorCandidates.Size());
+
         for (winrt::UIElement anchorCandidate : anchorCandidates)
         {
             ProcessAnchorCandidate(
@@ -381,6 +432,7 @@ void Scroller::EnsureAnchorElementSelection()
                 viewportAnchorBounds,
                 viewportAnchorPointHorizontalOffset,
                 viewportAnchorPointVerticalOffset,
+                &anchorCandidateParents,
                 &bestAnchorCandidateDistance,
                 &bestAnchorCandidate,
                 &bestAnchorCandidateBounds);
@@ -388,6 +440,8 @@ void Scroller::EnsureAnchorElementSelection()
     }
     else
     {
+        anchorCandidateCount = static_cast<int>(m_anchorCandidates.size());
+
         for (tracker_ref<winrt::UIElement> anchorCandidateTracker : m_anchorCandidates)
         {
             const winrt::UIElement anchorCandidate = anchorCandidateTracker.get();
@@ -398,6 +452,7 @@ void Scroller::EnsureAnchorElementSelection()
                 viewportAnchorBounds,
                 viewportAnchorPointHorizontalOffset,
                 viewportAnchorPointVerticalOffset,
+                &anchorCandidateParents,
                 &bestAnchorCandidateDistance,
                 &bestAnchorCandidate,
                 &bestAnchorCandidateBounds);
@@ -426,6 +481,7 @@ void Scroller::ProcessAnchorCandidate(
     const winrt::Rect& viewportAnchorBounds,
     double viewportAnchorPointHorizontalOffset,
     double viewportAnchorPointVerticalOffset,
+    _Inout_ std::unordered_map<void*, AnchorCandidateParent>* anchorCandidateParents,
     _Inout_ double* bestAnchorCandidateDistance,
     _Inout_ winrt::UIElement* bestAnchorCandidate,
     _Inout_ winrt::Rect* bestAnchorCandidateBounds) const
@@ -433,14 +489,14 @@ void Scroller::ProcessAnchorCandidate(
     MUX_ASSERT(anchorCandidate);
     MUX_ASSERT(content);
 
-    if (!IsElementValidAnchor(anchorCandidate, content))
+    winrt::Rect anchorCandidateBounds{};
+
+    if (!TryGetAnchorCandidateBounds(anchorCandidate, content, anchorCandidateParents, &anchorCandidateBounds))
     {
         // Ignore candidates that are collapsed or do not belong to the Content element and are not the Content itself. 
         return;
     }
 
-    winrt::Rect anchorCandidateBounds = GetDescendantBounds(content, anchorCandidate);
-
     if (!SharedHelpers::DoRectsIntersect(viewportAnchorBounds, anchorCandidateBounds))
     {
         // Ignore candidates that do not intersect with the viewport in order to favor those that do.
@@ -470,6 +526,108 @@ void Scroller::ProcessAnchorCandidate(
     }
 }
 
+// Returns False when the anchor candidate is not a valid anchor, and otherwise sets its bounds in respect to the Scroller.Content.
+// Equivalent to IsElementValidAnchor followed by GetDescendantBounds, but the candidate's visual parent is only evaluated once per
+// selection pass. The candidate's corners are then transformed to its parent and through the cached parent transform to the Content.
+bool Scroller::TryGetAnchorCandidateBounds(
+    const winrt::UIElement& anchorCandidate,
+    const winrt::UIElement& content,
+    _Inout_ std::unordered_map<void*, AnchorCandidateParent>* anchorCandidateParents,
+    _Out_ winrt::Rect* anchorCandidateBounds)
+{
+    MUX_ASSERT(anchorCandidate);
+    MUX_ASSERT(content);
+
+    *anchorCandidateBounds = winrt::Rect{};
+
+    if (anchorCandidate.Visibility() != winrt::Visibility::Visible)
+    {
+        return false;
+    }
+
+    if (anchorCandidate == content)
+    {
+        *anchorCandidateBounds = GetDescendantBounds(content, anchorCandidate);
+        return true;
+    }
+
+    const winrt::DependencyObject parent = winrt::VisualTreeHelper::GetParent(anchorCandidate);
+
+    if (!parent)
+    {
+        return false;
+    }
+
+    void* parentIdentity = winrt::get_abi(parent.as<winrt::IUnknown>());
+    auto parentIt = anchorCandidateParents->find(parentIdentity);
+
+    if (parentIt == anchorCandidateParents->end())
+    {
+        AnchorCandidateParent anchorCandidateParent;
+
+        // The candidate belongs to the Content if and only if its parent is the Content or one of its descendants.
+        anchorCandidateParent.isValid = parent == content || SharedHelpers::IsAncestor(parent, content);
+
+        if (anchorCandidateParent.isValid)
+        {
+            anchorCandidateParent.element = parent.try_as<winrt::UIElement>();
+
+            if (anchorCandidateParent.element)
+            {
+                anchorCandidateParent.transformToContent = anchorCandidateParent.element.TransformToVisual(content);
+            }
+        }
+
+        parentIt = anchorCandidateParents->emplace(parentIdentity, anchorCandidateParent).first;
+    }
+
+    const AnchorCandidateParent& anchorCandidateParent = parentIt->second;
+
+    if (!anchorCandidateParent.isValid)
+    {
+        return false;
+    }
+
+    MUX_ASSERT(IsElementValidAnchor(anchorCandidate, content));
+
+    if (!anchorCandidateParent.transformToContent)
+    {
+        *anchorCandidateBounds = GetDescendantBounds(content, anchorCandidate);
+        return true;
+    }
+
+    const winrt::FrameworkElement anchorCandidateAsFE = anchorCandidate.try_as<winrt::FrameworkElement>();
+    const winrt::FrameworkElement contentAsFE = content.try_as<winrt::FrameworkElement>();
+    const winrt::Thickness contentMargin = contentAsFE ? contentAsFE.Margin() : winrt::Thickness{};
+    const float left = static_cast<float>(contentMargin.Left);
+    const float top = static_cast<float>(contentMargin.Top);
+    const float right = left + (anchorCandidateAsFE ? static_cast<float>(anchorCandidateAsFE.ActualWidth()) : 0.0f);
+    const float bottom = top + (anchorCandidateAsFE ? static_cast<float>(anchorCandidateAsFE.ActualHeight()) : 0.0f);
+    const winrt::GeneralTransform transformToParent = anchorCandidate.TransformToVisual(anchorCandidateParent.element);
+    const winrt::Point corners[] = {
+        winrt::Point{ left, top },
+        winrt::Point{ right, top },
+        winrt::Point{ left, bottom },
+        winrt::Point{ right, bottom } };
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+
+    for (const winrt::Point& corner : corners)
+    {
+        const winrt::Point transformedCorner = anchorCandidateParent.transformToContent.TransformPoint(transformToParent.TransformPoint(corner));
+
+        minX = std::min(minX, transformedCorner.X);
+        minY = std::min(minY, transformedCorner.Y);
+        maxX = std::max(maxX, transformedCorner.X);
+        maxY = std::max(maxY, transformedCorner.Y);
+    }
+
+    *anchorCandidateBounds = winrt::Rect{ minX, minY, maxX - minX, maxY - minY };
+    return true;
+}
+
 // Returns the bounds of a Scroller.Content descendant in respect to that content.
 winrt::Rect Scroller::GetDescendantBounds(
     const winrt::UIElement& content,
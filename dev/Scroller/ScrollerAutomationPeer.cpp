@@ -213,6 +213,48 @@ void ScrollerAutomationPeer::UpdateScrollPatternProperties()
 {
     SCROLLER_TRACE_VERBOSE(Owner(), TRACE_MSG_METH, METH_NAME, this);
 
+    if (m_throttlingTimer && m_throttlingTimer.get().IsEnabled())
+    {
+        // Properties were raised less than s_throttlingInterval ago. The timer tick raises the latest values.
+        m_hasThrottledUpdate = true;
+        return;
+    }
+
+    RaiseScrollPatternPropertyChanges();
+
+    if (!m_throttlingTimer)
+    {
+        auto throttlingTimer = winrt::DispatcherTimer();
+        throttlingTimer.Interval(winrt::TimeSpan::duration(s_throttlingInterval));
+        throttlingTimer.Tick([weakThis = get_weak()](const winrt::IInspectable& /*sender*/, const winrt::IInspectable& /*args*/)
+        {
+            if (auto strongThis = weakThis.get())
+            {
+                strongThis->OnThrottlingTimerTick();
+            }
+        });
+        m_throttlingTimer.set(throttlingTimer);
+    }
+
+    m_throttlingTimer.get().Start();
+}
+
+void ScrollerAutomationPeer::OnThrottlingTimerTick()
+{
+    if (m_hasThrottledUpdate)
+    {
+        // Keep the timer running so that further changes remain throttled.
+        m_hasThrottledUpdate = false;
+        RaiseScrollPatternPropertyChanges();
+    }
+    else
+    {
+        m_throttlingTimer.get().Stop();
+    }
+}
+
+void ScrollerAutomationPeer::RaiseScrollPatternPropertyChanges()
+{
     double newHorizontalScrollPercent = get_HorizontalScrollPercentImpl();
     double newVerticalScrollPercent = get_VerticalScrollPercentImpl();
     double newHorizontalViewSize = get_HorizontalViewSizeImpl();
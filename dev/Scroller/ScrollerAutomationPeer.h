@@ -16,6 +16,11 @@ public:
     ~ScrollerAutomationPeer()
     {
         SCROLLER_TRACE_VERBOSE(nullptr, TRACE_MSG_METH, METH_NAME, this);
+
+        if (m_throttlingTimer)
+        {
+            m_throttlingTimer.get().Stop();
+        }
     }
 
     // IAutomationPeerOverrides methods 
@@ -32,9 +37,14 @@ public:
     bool HorizontallyScrollable();
     bool VerticallyScrollable();
 
+    // Raises the property changes at most once per s_throttlingInterval. Changes that arrive in
+    // between, typically during inertia, are raised once with their final values when the interval ends.
     void UpdateScrollPatternProperties();
 
 private:
+    void RaiseScrollPatternPropertyChanges();
+    void OnThrottlingTimerTick();
+
     double get_HorizontalScrollPercentImpl();
     double get_VerticalScrollPercentImpl();
     double get_HorizontalViewSizeImpl();
@@ -56,6 +66,12 @@ private:
     bool m_horizontallyScrollable{ false };
     bool m_verticallyScrollable{ false };
 
+    tracker_ref<winrt::DispatcherTimer> m_throttlingTimer{ this };
+    bool m_hasThrottledUpdate{ false };
+
+    // 100ms, in 100ns units.
+    static constexpr int64_t s_throttlingInterval{ 100 * 10000 };
+
     static double s_minimumPercent;
     static double s_maximumPercent;
     static double s_noScroll;
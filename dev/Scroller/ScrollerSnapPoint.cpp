@@ -150,10 +150,15 @@ winrt::ExpressionAnimation ScrollerSnapPointIrregular::CreateRestingPointExpress
     winrt::hstring expression = StringUtil::FormatString(L"snapPointValue * %1!s!", scale.data());
     winrt::ExpressionAnimation restingPointExpressionAnimation = compositor.CreateExpressionAnimation(expression);
 
-    restingPointExpressionAnimation.SetScalarParameter(L"snapPointValue", static_cast<float>(m_actualValue));
+    UpdateRestingPointExpression(restingPointExpressionAnimation);
     return restingPointExpressionAnimation;
 }
 
+void ScrollerSnapPointIrregular::UpdateRestingPointExpression(winrt::ExpressionAnimation const& restingPointExpressionAnimation)
+{
+    restingPointExpressionAnimation.SetScalarParameter(L"snapPointValue", static_cast<float>(m_actualValue));
+}
+
 winrt::ExpressionAnimation ScrollerSnapPointIrregular::CreateConditionalExpression(winrt::Compositor compositor, winrt::hstring target, winrt::hstring scale)
 {
     winrt::hstring targetExpression = GetTargetExpression(target);
@@ -170,9 +175,14 @@ winrt::ExpressionAnimation ScrollerSnapPointIrregular::CreateConditionalExpressi
         scaledMaxApplicableRange.data());
     winrt::ExpressionAnimation conditionExpressionAnimation = compositor.CreateExpressionAnimation(expression);
 
+    UpdateConditionalExpression(conditionExpressionAnimation);
+    return conditionExpressionAnimation;
+}
+
+void ScrollerSnapPointIrregular::UpdateConditionalExpression(winrt::ExpressionAnimation const& conditionExpressionAnimation)
+{
     conditionExpressionAnimation.SetScalarParameter(L"minApplicableValue", static_cast<float>(std::get<0>(m_actualApplicableZone)));
     conditionExpressionAnimation.SetScalarParameter(L"maxApplicableValue", static_cast<float>(std::get<1>(m_actualApplicableZone)));
-    return conditionExpressionAnimation;
 }
 
 ScrollerSnapPointSortPredicate ScrollerSnapPointIrregular::SortPredicate()
@@ -410,10 +420,15 @@ winrt::ExpressionAnimation ScrollerSnapPointRegular::CreateRestingPointExpressio
         scaledFirst.data());
     winrt::ExpressionAnimation restingPointExpressionAnimation = compositor.CreateExpressionAnimation(expression);
 
+    UpdateRestingPointExpression(restingPointExpressionAnimation);
+    return restingPointExpressionAnimation;
+}
+
+void ScrollerSnapPointRegular::UpdateRestingPointExpression(winrt::ExpressionAnimation const& restingPointExpressionAnimation)
+{
     restingPointExpressionAnimation.SetScalarParameter(L"itv", static_cast<float>(m_interval));
     restingPointExpressionAnimation.SetScalarParameter(L"end", static_cast<float>(m_actualEnd));
     restingPointExpressionAnimation.SetScalarParameter(L"first", static_cast<float>(DetermineFirstRegularSnapPointValue()));
-    return restingPointExpressionAnimation;
 }
 
 winrt::ExpressionAnimation ScrollerSnapPointRegular::CreateConditionalExpression(winrt::Compositor compositor, winrt::hstring target, winrt::hstring scale)
@@ -457,12 +472,17 @@ winrt::ExpressionAnimation ScrollerSnapPointRegular::CreateConditionalExpression
         scaledFirst.data());
     winrt::ExpressionAnimation conditionExpressionAnimation = compositor.CreateExpressionAnimation(expression);
 
+    UpdateConditionalExpression(conditionExpressionAnimation);
+    return conditionExpressionAnimation;
+}
+
+void ScrollerSnapPointRegular::UpdateConditionalExpression(winrt::ExpressionAnimation const& conditionExpressionAnimation)
+{
     conditionExpressionAnimation.SetScalarParameter(L"itv", static_cast<float>(m_interval));
     conditionExpressionAnimation.SetScalarParameter(L"start", static_cast<float>(m_actualStart));
     conditionExpressionAnimation.SetScalarParameter(L"end", static_cast<float>(m_actualEnd));
     conditionExpressionAnimation.SetScalarParameter(L"applicableRange", static_cast<float>(m_specifiedApplicableRange));
     conditionExpressionAnimation.SetScalarParameter(L"first", static_cast<float>(DetermineFirstRegularSnapPointValue()));
-    return conditionExpressionAnimation;
 }
 
 ScrollerSnapPointSortPredicate ScrollerSnapPointRegular::SortPredicate()
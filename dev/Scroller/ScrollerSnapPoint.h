@@ -39,6 +39,10 @@ public:
 
     virtual winrt::ExpressionAnimation CreateRestingPointExpression(winrt::Compositor compositor, winrt::hstring target, winrt::hstring scale) = 0;
     virtual winrt::ExpressionAnimation CreateConditionalExpression(winrt::Compositor compositor, winrt::hstring target, winrt::hstring scale) = 0;
+    // Refresh the parameters of expressions previously created by CreateRestingPointExpression/CreateConditionalExpression
+    // so they reflect the current actual values without re-parsing the expression strings.
+    virtual void UpdateRestingPointExpression(winrt::ExpressionAnimation const& restingPointExpressionAnimation) = 0;
+    virtual void UpdateConditionalExpression(winrt::ExpressionAnimation const& conditionExpressionAnimation) = 0;
     virtual ScrollerSnapPointSortPredicate SortPredicate() = 0;
     virtual void DetermineActualApplicableZone(ScrollerSnapPointBase* previousSnapPoint, ScrollerSnapPointBase* nextSnapPoint) = 0;
     virtual double Influence(double edgeOfMidpoint) = 0;
@@ -88,6 +92,8 @@ public:
     //Internal
     winrt::ExpressionAnimation CreateRestingPointExpression(winrt::Compositor compositor, winrt::hstring, winrt::hstring scale);
     winrt::ExpressionAnimation CreateConditionalExpression(winrt::Compositor compositor, winrt::hstring target, winrt::hstring scale);
+    void UpdateRestingPointExpression(winrt::ExpressionAnimation const& restingPointExpressionAnimation);
+    void UpdateConditionalExpression(winrt::ExpressionAnimation const& conditionExpressionAnimation);
     ScrollerSnapPointSortPredicate SortPredicate();
     void DetermineActualApplicableZone(ScrollerSnapPointBase* previousSnapPoint, ScrollerSnapPointBase* nextSnapPoint);
     double Influence(double edgeOfMidpoint);
@@ -121,6 +127,8 @@ public:
     //Internal
     winrt::ExpressionAnimation CreateRestingPointExpression(winrt::Compositor compositor, winrt::hstring target, winrt::hstring scale);
     winrt::ExpressionAnimation CreateConditionalExpression(winrt::Compositor compositor, winrt::hstring target, winrt::hstring scale);
+    void UpdateRestingPointExpression(winrt::ExpressionAnimation const& restingPointExpressionAnimation);
+    void UpdateConditionalExpression(winrt::ExpressionAnimation const& conditionExpressionAnimation);
     ScrollerSnapPointSortPredicate SortPredicate();
     void DetermineActualApplicableZone(ScrollerSnapPointBase* previousSnapPoint, ScrollerSnapPointBase* nextSnapPoint);
     double Influence(double edgeOfMidpoint);
@@ -61,6 +61,32 @@ if (IsScrollerPerfTracingEnabled()) \
     ScrollerTrace::TracePerfInfo(info); \
 } \
 
+// Typed perf events. Each value is its own field so that view change latencies and the arrange and
+// anchoring costs can be aggregated without formatting or parsing messages.
+#define SCROLLER_TRACE_PERF_VIEW_CHANGE(scroller, stage, viewChangeId, operationType, operationTrigger, latencyInMilliseconds, isInterrupted) \
+if (IsScrollerPerfTracingEnabled()) \
+{ \
+    ScrollerTrace::TracePerfViewChange(scroller, stage, viewChangeId, operationType, operationTrigger, latencyInMilliseconds, isInterrupted); \
+} \
+
+#define SCROLLER_TRACE_PERF_ARRANGE(scroller, durationInMilliseconds) \
+if (IsScrollerPerfTracingEnabled()) \
+{ \
+    ScrollerTrace::TracePerfArrange(scroller, durationInMilliseconds); \
+} \
+
+#define SCROLLER_TRACE_PERF_ANCHOR_EVALUATION(scroller, candidateCount, durationInMilliseconds) \
+if (IsScrollerPerfTracingEnabled()) \
+{ \
+    ScrollerTrace::TracePerfAnchorEvaluation(scroller, candidateCount, durationInMilliseconds); \
+} \
+
+#define SCROLLER_TRACE_PERF_INTERACTION_METRICS(scroller, valuesChangedCount, inertiaFrameCount, missedFrameCount, firstValuesChangedLatencyInMilliseconds) \
+if (IsScrollerPerfTracingEnabled()) \
+{ \
+    ScrollerTrace::TracePerfInteractionMetrics(scroller, valuesChangedCount, inertiaFrameCount, missedFrameCount, firstValuesChangedLatencyInMilliseconds); \
+} \
+
 class ScrollerTrace
 {
 public:
@@ -139,6 +165,72 @@ public:
         va_end(args);
     }
 
+    // 'stage' is expected to be a string literal: "Queued", "Started" or "Completed".
+    static void TracePerfViewChange(
+        const void* scroller,
+        PCSTR stage,
+        int32_t viewChangeId,
+        int operationType,
+        int operationTrigger,
+        double latencyInMilliseconds,
+        bool isInterrupted) noexcept
+    {
+        TraceLoggingWrite(
+            g_hPerfProvider,
+            "ScrollerViewChange" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_SCROLLER),
+            TraceLoggingPointer(scroller, "Scroller"),
+            TraceLoggingString(stage, "Stage"),
+            TraceLoggingInt32(viewChangeId, "ViewChangeId"),
+            TraceLoggingInt32(operationType, "OperationType"),
+            TraceLoggingInt32(operationTrigger, "OperationTrigger"),
+            TraceLoggingFloat64(latencyInMilliseconds, "LatencyInMilliseconds"),
+            TraceLoggingBool(isInterrupted, "IsInterrupted"));
+    }
+
+    static void TracePerfArrange(const void* scroller, double durationInMilliseconds) noexcept
+    {
+        TraceLoggingWrite(
+            g_hPerfProvider,
+            "ScrollerArrange" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_SCROLLER),
+            TraceLoggingPointer(scroller, "Scroller"),
+            TraceLoggingFloat64(durationInMilliseconds, "DurationInMilliseconds"));
+    }
+
+    static void TracePerfAnchorEvaluation(const void* scroller, int candidateCount, double durationInMilliseconds) noexcept
+    {
+        TraceLoggingWrite(
+            g_hPerfProvider,
+            "ScrollerAnchorEvaluation" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_SCROLLER),
+            TraceLoggingPointer(scroller, "Scroller"),
+            TraceLoggingInt32(candidateCount, "CandidateCount"),
+            TraceLoggingFloat64(durationInMilliseconds, "DurationInMilliseconds"));
+    }
+
+    static void TracePerfInteractionMetrics(
+        const void* scroller,
+        int valuesChangedCount,
+        int inertiaFrameCount,
+        int missedFrameCount,
+        double firstValuesChangedLatencyInMilliseconds) noexcept
+    {
+        TraceLoggingWrite(
+            g_hPerfProvider,
+            "ScrollerInteractionMetrics" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_SCROLLER),
+            TraceLoggingPointer(scroller, "Scroller"),
+            TraceLoggingInt32(valuesChangedCount, "ValuesChangedCount"),
+            TraceLoggingInt32(inertiaFrameCount, "InertiaFrameCount"),
+            TraceLoggingInt32(missedFrameCount, "MissedFrameCount"),
+            TraceLoggingFloat64(firstValuesChangedLatencyInMilliseconds, "FirstValuesChangedLatencyInMilliseconds"));
+    }
+
     static void TracePerfInfo(PCWSTR info) noexcept
     {
         // TraceViewers
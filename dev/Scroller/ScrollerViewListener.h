@@ -0,0 +1,28 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Snapshot of a Scroller's view handed to its IScrollerViewListener instances.
+struct ScrollerViewState
+{
+    double zoomedHorizontalOffset{ 0.0 };
+    double zoomedVerticalOffset{ 0.0 };
+    float zoomFactor{ 1.0f };
+    double viewportWidth{ 0.0 };
+    double viewportHeight{ 0.0 };
+    double unzoomedExtentWidth{ 0.0 };
+    double unzoomedExtentHeight{ 0.0 };
+    // Same meaning as the isFinal parameter of the IRepeaterScrollingSurface.ViewportChanged event.
+    bool isFinal{ false };
+};
+
+// Implemented by components of this dll that track a Scroller's view without going through its projected
+// IRepeaterScrollingSurface.ViewportChanged event and properties. Listeners are notified whenever that event is raised,
+// and are not ref-counted: they must call Scroller::RemoveViewListener before being destroyed. A listener may remove
+// itself, but no other listener, from within OnScrollerViewChanged.
+class IScrollerViewListener
+{
+public:
+    virtual void OnScrollerViewChanged(const ScrollerViewState& viewState) = 0;
+};
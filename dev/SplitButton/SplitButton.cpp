@@ -9,6 +9,7 @@
 #include "SplitButtonEventArgs.h"
 #include "RuntimeProfiler.h"
 #include "ResourceAccessor.h"
+#include "StartupTrace.h"
 
 SplitButton::SplitButton()
 {
@@ -26,6 +27,8 @@ SplitButton::~SplitButton()
 
 void SplitButton::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"SplitButton");
+
     UnregisterEvents();
 
     winrt::IControlProtected controlProtected{ *this };
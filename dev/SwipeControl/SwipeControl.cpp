@@ -9,6 +9,7 @@
 #include "SwipeItem.h"
 #include "RuntimeProfiler.h"
 #include "SwipeTestHooks.h"
+#include "StartupTrace.h"
 
 // Change to 'true' to turn on debugging outputs in Output window
 bool SwipeControlTrace::s_IsDebugOutputEnabled{ false };
@@ -20,6 +21,34 @@ static const float c_MinimumCloseVelocity = 31.0;
 
 static thread_local winrt::weak_ref<SwipeControl> s_lastInteractedWithSwipeControl = nullptr;
 
+// Window, XamlRoot and dispatcher events used to dismiss the open SwipeControls of a thread. They are hooked the first
+// time a SwipeControl opens and remain hooked, so opening and closing swipes only adds and removes registry entries.
+struct SwipeControlDismissingHandlers
+{
+    std::vector<winrt::weak_ref<SwipeControl>> m_openSwipeControls;
+
+#ifdef USE_INSIDER_SDK
+    // Used on platforms where we have XamlRoot.
+    struct XamlRootHandlers
+    {
+        winrt::weak_ref<winrt::XamlRoot> m_xamlRoot;
+        winrt::weak_ref<winrt::UIElement> m_xamlRootContent;
+        winrt::IXamlRoot::Changed_revoker m_xamlRootChangedRevoker;
+    };
+    std::vector<XamlRootHandlers> m_xamlRootHandlers;
+#endif
+
+    // Used on platforms where we don't have XamlRoot.
+    winrt::ICoreWindow::PointerPressed_revoker m_coreWindowPointerPressedRevoker;
+    winrt::ICoreWindow::KeyDown_revoker m_coreWindowKeyDownRevoker;
+    winrt::ICoreWindow::VisibilityChanged_revoker m_windowMinimizeRevoker;
+    winrt::IWindow::SizeChanged_revoker m_windowSizeChangedRevoker;
+
+    winrt::CoreAcceleratorKeys::AcceleratorKeyActivated_revoker m_acceleratorKeyActivatedRevoker;
+};
+
+static thread_local SwipeControlDismissingHandlers s_dismissingHandlers;
+
 SwipeControl::SwipeControl()
 {
     __RP_Marker_ClassById(RuntimeProfiler::ProfId_SwipeControl);
@@ -102,12 +131,17 @@ void SwipeControl::Close()
 #pragma region IFrameworkElementOverrides
 void SwipeControl::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"SwipeControl");
+
     ThrowIfHasVerticalAndHorizontalContent(/*setIsHorizontal*/ true);
 
     DetachEventHandlers();
     GetTemplateParts();
     EnsureClip();
     AttachEventHandlers();
+
+    // The cached swipe item buttons use the style looked up with the previous template.
+    m_swipeItemButtons.clear();
 }
 
 void SwipeControl::OnPropertyChanged(const winrt::DependencyPropertyChangedEventArgs& args)
@@ -413,6 +447,8 @@ void SwipeControl::OnLeftItemsCollectionChanged(const winrt::DependencyPropertyC
         m_interactionTracker.get().Properties().InsertBoolean(s_hasLeftContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    m_swipeItemButtons.clear();
+
     if (m_createdContent == CreatedContent::Left)
     {
         CreateLeftContent();
@@ -442,6 +478,8 @@ void SwipeControl::OnRightItemsCollectionChanged(const winrt::DependencyProperty
         m_interactionTracker.get().Properties().InsertBoolean(s_hasRightContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    m_swipeItemButtons.clear();
+
     if (m_createdContent == CreatedContent::Right)
     {
         CreateRightContent();
@@ -471,6 +509,8 @@ void SwipeControl::OnTopItemsCollectionChanged(const winrt::DependencyPropertyCh
         m_interactionTracker.get().Properties().InsertBoolean(s_hasTopContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    m_swipeItemButtons.clear();
+
     if (m_createdContent == CreatedContent::Top)
     {
         CreateTopContent();
@@ -500,6 +540,8 @@ void SwipeControl::OnBottomItemsCollectionChanged(const winrt::DependencyPropert
         m_interactionTracker.get().Properties().InsertBoolean(s_hasBottomContentPropertyName, args.NewValue() && args.NewValue().try_as<winrt::IVector<winrt::SwipeItem>>().Size() > 0);
     }
 
+    m_swipeItemButtons.clear();
+
     if (m_createdContent == CreatedContent::Bottom)
     {
         CreateBottomContent();
@@ -513,12 +555,37 @@ void SwipeControl::OnLoaded(const winrt::IInspectable& /*sender*/, const winrt::
     if (!m_hasInitialLoadedEventFired)
     {
         m_hasInitialLoadedEventFired = true;
-        InitializeInteractionTracker();
-        TryGetSwipeVisuals();
+        //Creating the interaction tracker, its interaction source and the expression animations is deferred until the user
+        //first points at the control, see EnsureInteractionTracker. Rows of a list which are never swiped only pay for their content.
+        m_isInteractionTrackerInitializationPending = true;
     }
     //If the swipe control has been added to the tree for a subsequent time, for instance when a list view item has been recycled,
     //Ensure that we are in the closed interaction tracker state.
-    CloseWithoutAnimation();
+    if (m_interactionTracker)
+    {
+        CloseWithoutAnimation();
+    }
+}
+
+void SwipeControl::EnsureInteractionTracker()
+{
+    if (m_isInteractionTrackerInitializationPending)
+    {
+        SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
+
+        m_isInteractionTrackerInitializationPending = false;
+        InitializeInteractionTracker();
+        TryGetSwipeVisuals();
+
+        //The swipe content stack panel may have been resized while waiting. Apply the bounds it would have received.
+        if (m_isSwipeContentStackPanelSizePending)
+        {
+            m_isSwipeContentStackPanelSizePending = false;
+            m_interactionTracker.get().MinPosition({ -static_cast<float>(m_swipeContentStackPanel.get().ActualWidth()), -static_cast<float>(m_swipeContentStackPanel.get().ActualHeight()), 0.0f });
+            m_interactionTracker.get().MaxPosition({ static_cast<float>(m_swipeContentStackPanel.get().ActualWidth()), static_cast<float>(m_swipeContentStackPanel.get().ActualHeight()), 0.0f });
+            ConfigurePositionInertiaRestingValues();
+        }
+    }
 }
 
 void SwipeControl::AttachEventHandlers()
@@ -528,6 +595,8 @@ void SwipeControl::AttachEventHandlers()
     MUX_ASSERT(m_loadedToken.value == 0);
     m_loadedToken = Loaded({ this, &SwipeControl::OnLoaded });
     m_hasInitialLoadedEventFired = false;
+    m_isInteractionTrackerInitializationPending = false;
+    m_isSwipeContentStackPanelSizePending = false;
 
     MUX_ASSERT(m_onSizeChangedToken.value == 0);
     m_onSizeChangedToken = SizeChanged({ this, &SwipeControl::OnSizeChanged });
@@ -542,6 +611,12 @@ void SwipeControl::AttachEventHandlers()
         AddHandler(winrt::UIElement::PointerPressedEvent(), m_onPointerPressedEventHandler.get(), true);
     }
 
+    MUX_ASSERT(m_onPointerEnteredToken.value == 0);
+    m_onPointerEnteredToken = PointerEntered({ this, &SwipeControl::OnPointerEnteredEvent });
+
+    MUX_ASSERT(m_dataContextChangedToken.value == 0);
+    m_dataContextChangedToken = DataContextChanged({ this, &SwipeControl::OnDataContextChanged });
+
     MUX_ASSERT(m_inputEaterTappedToken.value == 0);
     m_inputEaterTappedToken = m_inputEater.get().Tapped({ this, &SwipeControl::InputEaterGridTapped });
 }
@@ -574,6 +649,18 @@ void SwipeControl::DetachEventHandlers()
         m_onPointerPressedEventHandler.set(nullptr);
     }
 
+    if (m_onPointerEnteredToken.value != 0)
+    {
+        PointerEntered(m_onPointerEnteredToken);
+        m_onPointerEnteredToken.value = 0;
+    }
+
+    if (m_dataContextChangedToken.value != 0)
+    {
+        DataContextChanged(m_dataContextChangedToken);
+        m_dataContextChangedToken.value = 0;
+    }
+
     if (m_inputEater.safe_get() && m_inputEaterTappedToken.value != 0)
     {
         m_inputEater.safe_get().Tapped(m_inputEaterTappedToken);
@@ -613,7 +700,11 @@ void SwipeControl::OnSizeChanged(const winrt::IInspectable& /*sender*/, const wi
 
 void SwipeControl::OnSwipeContentStackPanelSizeChanged(const winrt::IInspectable& sender, const winrt::SizeChangedEventArgs& args)
 {
-    if (m_interactionTracker)
+    if (m_isInteractionTrackerInitializationPending)
+    {
+        m_isSwipeContentStackPanelSizePending = true;
+    }
+    else if (m_interactionTracker)
     {
         m_interactionTracker.get().MinPosition({ -args.NewSize().Width, -args.NewSize().Height, 0.0f });
         m_interactionTracker.get().MaxPosition({ args.NewSize().Width, args.NewSize().Height, 0.0f });
@@ -621,12 +712,38 @@ void SwipeControl::OnSwipeContentStackPanelSizeChanged(const winrt::IInspectable
     }
 }
 
+//An ItemsRepeater or a ListView recycling the row containing this SwipeControl assigns it the DataContext of its new item,
+//without unloading it. Return to the closed state so the new item does not show up swiped open.
+void SwipeControl::OnDataContextChanged(const winrt::FrameworkElement& /*sender*/, const winrt::DataContextChangedEventArgs& /*args*/)
+{
+    if (m_interactionTracker && (m_isOpen || !m_isIdle || m_createdContent != CreatedContent::None))
+    {
+        SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
+
+        CloseWithoutAnimation();
+    }
+}
+
+void SwipeControl::OnPointerEnteredEvent(
+    const winrt::IInspectable& /*sender*/,
+    const winrt::PointerRoutedEventArgs& args)
+{
+    //Touchpad manipulations are redirected to the interaction source automatically, without a PointerPressed event,
+    //so it needs to exist by the time a mouse-like pointer hovers the control.
+    if (args.Pointer().PointerDeviceType() != winrt::Devices::Input::PointerDeviceType::Touch)
+    {
+        EnsureInteractionTracker();
+    }
+}
+
 void SwipeControl::OnPointerPressedEvent(
     const winrt::IInspectable& sender,
     const winrt::PointerRoutedEventArgs& args)
 {
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
+    EnsureInteractionTracker();
+
     if (args.Pointer().PointerDeviceType() == winrt::Devices::Input::PointerDeviceType::Touch && m_visualInteractionSource)
     {
         if (m_currentItems &&
@@ -672,79 +789,147 @@ void SwipeControl::AttachDismissingHandlers()
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
     DetachDismissingHandlers();
+    EnsureDismissingHandlers();
 
+    s_dismissingHandlers.m_openSwipeControls.push_back(get_weak());
+}
+
+void SwipeControl::DetachDismissingHandlers()
+{
+    SWIPECONTROL_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
+
+    // Also drops the entries of SwipeControls that were destroyed, including this one when called from its destructor.
+    auto& openSwipeControls = s_dismissingHandlers.m_openSwipeControls;
+    openSwipeControls.erase(
+        std::remove_if(openSwipeControls.begin(), openSwipeControls.end(), [this](const winrt::weak_ref<SwipeControl>& weakSwipeControl)
+        {
+            auto swipeControl = weakSwipeControl.get();
+            return !swipeControl || swipeControl.get() == this;
+        }),
+        openSwipeControls.end());
+}
+
+void SwipeControl::EnsureDismissingHandlers()
+{
 #ifdef USE_INSIDER_SDK
     if (SharedHelpers::IsXamlRootAvailable())
     {
         if (auto xamlRoot = XamlRoot())
         {
             auto xamlRootContent = xamlRoot.Content();
+            auto& xamlRootHandlers = s_dismissingHandlers.m_xamlRootHandlers;
 
-            m_onXamlRootPointerPressedEventHandler.set(winrt::box_value<winrt::PointerEventHandler>({ this, &SwipeControl::DismissSwipeOnAnExternalXamlRootTap }));
-            xamlRootContent.AddHandler(winrt::UIElement::PointerPressedEvent(), m_onXamlRootPointerPressedEventHandler.get(), true);
+            xamlRootHandlers.erase(
+                std::remove_if(xamlRootHandlers.begin(), xamlRootHandlers.end(), [](const auto& handlers) { return !handlers.m_xamlRoot.get(); }),
+                xamlRootHandlers.end());
 
-            m_onXamlRootKeyDownEventHandler.set(winrt::box_value<winrt::KeyEventHandler>({ this, &SwipeControl::DismissSwipeOnXamlRootKeyDown }));
-            xamlRootContent.AddHandler(winrt::UIElement::KeyDownEvent(), m_onXamlRootKeyDownEventHandler.get(), true);
+            auto handlers = std::find_if(xamlRootHandlers.begin(), xamlRootHandlers.end(), [&xamlRoot](const auto& handlers) { return handlers.m_xamlRoot.get() == xamlRoot; });
+            if (handlers == xamlRootHandlers.end())
+            {
+                auto& newHandlers = xamlRootHandlers.emplace_back();
+                newHandlers.m_xamlRoot = winrt::make_weak(xamlRoot);
+                newHandlers.m_xamlRootChangedRevoker = xamlRoot.Changed(winrt::auto_revoke, [](const winrt::XamlRoot& sender, const winrt::XamlRootChangedEventArgs& args)
+                {
+                    ForEachOpenSwipeControl(sender, [&](SwipeControl& swipeControl) { swipeControl.CurrentXamlRootChanged(sender, args); });
+                });
+                handlers = xamlRootHandlers.end() - 1;
+            }
 
-            m_xamlRootChangedRevoker = xamlRoot.Changed(winrt::auto_revoke, { this, &SwipeControl::CurrentXamlRootChanged });
+            if (handlers->m_xamlRootContent.get() != xamlRootContent)
+            {
+                // The handlers stay attached to a prior content, where they are harmless since they only route to open SwipeControls.
+                handlers->m_xamlRootContent = winrt::make_weak(xamlRootContent);
+
+                xamlRootContent.AddHandler(
+                    winrt::UIElement::PointerPressedEvent(),
+                    winrt::box_value<winrt::PointerEventHandler>([weakXamlRoot = winrt::make_weak(xamlRoot)](const winrt::IInspectable& sender, const winrt::PointerRoutedEventArgs& args)
+                    {
+                        if (auto xamlRoot = weakXamlRoot.get())
+                        {
+                            ForEachOpenSwipeControl(xamlRoot, [&](SwipeControl& swipeControl) { swipeControl.DismissSwipeOnAnExternalXamlRootTap(sender, args); });
+                        }
+                    }),
+                    true);
+
+                xamlRootContent.AddHandler(
+                    winrt::UIElement::KeyDownEvent(),
+                    winrt::box_value<winrt::KeyEventHandler>([weakXamlRoot = winrt::make_weak(xamlRoot)](const winrt::IInspectable& sender, const winrt::KeyRoutedEventArgs& args)
+                    {
+                        if (auto xamlRoot = weakXamlRoot.get())
+                        {
+                            ForEachOpenSwipeControl(xamlRoot, [&](SwipeControl& swipeControl) { swipeControl.DismissSwipeOnXamlRootKeyDown(sender, args); });
+                        }
+                    }),
+                    true);
+            }
         }
     }
     else
 #endif
+    if (!s_dismissingHandlers.m_coreWindowPointerPressedRevoker)
     {
         if (auto currentWindow = winrt::Window::Current())
         {
             if (auto coreWindow = currentWindow.CoreWindow())
             {
-                m_coreWindowPointerPressedRevoker = coreWindow.PointerPressed(winrt::auto_revoke, { this, &SwipeControl::DismissSwipeOnAnExternalCoreWindowTap });
-                m_coreWindowKeyDownRevoker = coreWindow.KeyDown(winrt::auto_revoke, { this, &SwipeControl::DismissSwipeOnCoreWindowKeyDown });
-                m_windowMinimizeRevoker = coreWindow.VisibilityChanged(winrt::auto_revoke, { this, &SwipeControl::CurrentWindowVisibilityChanged });
-                m_windowSizeChangedRevoker = currentWindow.SizeChanged(winrt::auto_revoke, { this, &SwipeControl::CurrentWindowSizeChanged });
+                s_dismissingHandlers.m_coreWindowPointerPressedRevoker = coreWindow.PointerPressed(winrt::auto_revoke, [](const winrt::CoreWindow& sender, const winrt::PointerEventArgs& args)
+                {
+                    ForEachOpenSwipeControl(nullptr, [&](SwipeControl& swipeControl) { swipeControl.DismissSwipeOnAnExternalCoreWindowTap(sender, args); });
+                });
+                s_dismissingHandlers.m_coreWindowKeyDownRevoker = coreWindow.KeyDown(winrt::auto_revoke, [](const winrt::CoreWindow& sender, const winrt::KeyEventArgs& args)
+                {
+                    ForEachOpenSwipeControl(nullptr, [&](SwipeControl& swipeControl) { swipeControl.DismissSwipeOnCoreWindowKeyDown(sender, args); });
+                });
+                s_dismissingHandlers.m_windowMinimizeRevoker = coreWindow.VisibilityChanged(winrt::auto_revoke, [](const winrt::CoreWindow& sender, const winrt::VisibilityChangedEventArgs& args)
+                {
+                    ForEachOpenSwipeControl(nullptr, [&](SwipeControl& swipeControl) { swipeControl.CurrentWindowVisibilityChanged(sender, args); });
+                });
+                s_dismissingHandlers.m_windowSizeChangedRevoker = currentWindow.SizeChanged(winrt::auto_revoke, [](const winrt::IInspectable& sender, const winrt::WindowSizeChangedEventArgs& args)
+                {
+                    ForEachOpenSwipeControl(nullptr, [&](SwipeControl& swipeControl) { swipeControl.CurrentWindowSizeChanged(sender, args); });
+                });
             }
         }
     }
 
-    if (auto coreWindow = winrt::CoreWindow::GetForCurrentThread())
+    if (!s_dismissingHandlers.m_acceleratorKeyActivatedRevoker)
     {
-        if (auto dispatcher = coreWindow.Dispatcher())
+        if (auto coreWindow = winrt::CoreWindow::GetForCurrentThread())
         {
-            m_acceleratorKeyActivatedRevoker = dispatcher.AcceleratorKeyActivated(winrt::auto_revoke, { this, &SwipeControl::DismissSwipeOnAcceleratorKeyActivator });
+            if (auto dispatcher = coreWindow.Dispatcher())
+            {
+                s_dismissingHandlers.m_acceleratorKeyActivatedRevoker = dispatcher.AcceleratorKeyActivated(winrt::auto_revoke, [](const winrt::CoreDispatcher& sender, const winrt::AcceleratorKeyEventArgs& args)
+                {
+                    ForEachOpenSwipeControl(nullptr, [&](SwipeControl& swipeControl) { swipeControl.DismissSwipeOnAcceleratorKeyActivator(sender, args); });
+                });
+            }
         }
     }
 }
 
-void SwipeControl::DetachDismissingHandlers()
+// Invokes the provided function for each open SwipeControl, restricted to the ones hosted in the provided XamlRoot when it is set.
+void SwipeControl::ForEachOpenSwipeControl(const winrt::IInspectable& xamlRoot, const std::function<void(SwipeControl&)>& function)
 {
-    SWIPECONTROL_TRACE_INFO(nullptr, TRACE_MSG_METH, METH_NAME, this);
-
-#ifdef USE_INSIDER_SDK
-    if (SharedHelpers::IsXamlRootAvailable())
+    // Dismissing a SwipeControl unregisters it, so iterate over a snapshot.
+    std::vector<winrt::com_ptr<SwipeControl>> openSwipeControls;
+    for (const auto& weakSwipeControl : s_dismissingHandlers.m_openSwipeControls)
     {
-        if (auto xamlRoot = this->XamlRoot())
+        if (auto swipeControl = weakSwipeControl.get())
         {
-            auto xamlRootContent = xamlRoot.Content();
-
-            if (m_onXamlRootPointerPressedEventHandler)
-            {
-                xamlRootContent.RemoveHandler(winrt::UIElement::PointerPressedEvent(), m_onXamlRootPointerPressedEventHandler.get());
-                m_onXamlRootPointerPressedEventHandler.set(nullptr);
-            }
-
-            if (m_onXamlRootKeyDownEventHandler)
-            {
-                xamlRootContent.RemoveHandler(winrt::UIElement::KeyDownEvent(), m_onXamlRootKeyDownEventHandler.get());
-                m_onXamlRootKeyDownEventHandler.set(nullptr);
-            }
+            openSwipeControls.push_back(swipeControl);
         }
     }
-    m_xamlRootChangedRevoker.revoke();
-#endif
 
-    m_acceleratorKeyActivatedRevoker.revoke();
-    m_coreWindowPointerPressedRevoker.revoke();
-    m_coreWindowKeyDownRevoker.revoke();
-    m_windowMinimizeRevoker.revoke();
-    m_windowSizeChangedRevoker.revoke();
+    for (const auto& swipeControl : openSwipeControls)
+    {
+#ifdef USE_INSIDER_SDK
+        if (xamlRoot && swipeControl->XamlRoot() != xamlRoot)
+        {
+            continue;
+        }
+#endif
+        function(*swipeControl);
+    }
 }
 
 void SwipeControl::DismissSwipeOnAcceleratorKeyActivator(const winrt::Windows::UI::Core::CoreDispatcher& sender, const winrt::AcceleratorKeyEventArgs& args)
@@ -1197,7 +1382,7 @@ void SwipeControl::PopulateContentItems()
 
     for (winrt::SwipeItem swipeItem : m_currentItems.get())
     {
-        m_swipeContentStackPanel.get().Children().Append(GetSwipeItemButton(swipeItem));
+        m_swipeContentStackPanel.get().Children().Append(GetOrCreateSwipeItemButton(swipeItem));
     }
 
     TryGetSwipeVisuals();
@@ -1279,10 +1464,66 @@ void SwipeControl::UpdateColors()
     }
 }
 
+//Generating the AppBarButton of a swipe item, with its style and icon, is the expensive part of showing swipe content.
+//The buttons are kept once the SwipeControl closes so that swiping again, including after the control was recycled
+//for another list item, only refreshes their colors and sizes. They are regenerated when the item's text or icon changed.
+winrt::AppBarButton SwipeControl::GetOrCreateSwipeItemButton(const winrt::SwipeItem& swipeItem)
+{
+    const auto mode = m_currentItems.get().Mode();
+
+    for (auto& swipeItemButton : m_swipeItemButtons)
+    {
+        if (swipeItemButton.m_swipeItem.get() == swipeItem)
+        {
+            auto itemAsButton = swipeItemButton.m_button.get();
+
+            if (swipeItemButton.m_mode != mode ||
+                swipeItemButton.m_text != swipeItem.Text() ||
+                swipeItemButton.m_iconSource.get() != swipeItem.IconSource() ||
+                winrt::VisualTreeHelper::GetParent(itemAsButton))
+            {
+                itemAsButton = GetSwipeItemButton(swipeItem);
+                swipeItemButton.m_button.set(itemAsButton);
+                swipeItemButton.m_iconSource.set(swipeItem.IconSource());
+                swipeItemButton.m_text = swipeItem.Text();
+                swipeItemButton.m_mode = mode;
+            }
+            else
+            {
+                if (auto background = swipeItem.Background())
+                {
+                    itemAsButton.Background(background);
+                }
+                if (auto foreground = swipeItem.Foreground())
+                {
+                    itemAsButton.Foreground(foreground);
+                }
+                UpdateSwipeItemButton(itemAsButton, swipeItem);
+            }
+            return itemAsButton;
+        }
+    }
+
+    auto itemAsButton = GetSwipeItemButton(swipeItem);
+    auto& swipeItemButton = m_swipeItemButtons.emplace_back(this);
+    swipeItemButton.m_swipeItem.set(swipeItem);
+    swipeItemButton.m_button.set(itemAsButton);
+    swipeItemButton.m_iconSource.set(swipeItem.IconSource());
+    swipeItemButton.m_text = swipeItem.Text();
+    swipeItemButton.m_mode = mode;
+    return itemAsButton;
+}
+
 winrt::AppBarButton SwipeControl::GetSwipeItemButton(const winrt::SwipeItem& swipeItem)
 {
     winrt::AppBarButton itemAsButton;
     winrt::get_self<SwipeItem>(swipeItem)->GenerateControl(itemAsButton, m_swipeItemStyle.get());
+    UpdateSwipeItemButton(itemAsButton, swipeItem);
+    return itemAsButton;
+}
+
+void SwipeControl::UpdateSwipeItemButton(const winrt::AppBarButton& itemAsButton, const winrt::SwipeItem& swipeItem)
+{
     auto resources = winrt::Application::Current().Resources();
 
     if (!swipeItem.Background())
@@ -1317,7 +1558,6 @@ winrt::AppBarButton SwipeControl::GetSwipeItemButton(const winrt::SwipeItem& swi
             itemAsButton.Height(ActualHeight());
         }
     }
-    return itemAsButton;
 }
 
 void SwipeControl::UpdateColorsIfExecuteItem()
@@ -1464,7 +1704,12 @@ void SwipeControl::OnLeftItemsChanged(const winrt::IObservableVector<winrt::Swip
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
     ThrowIfHasVerticalAndHorizontalContent();
-    m_interactionTracker.get().Properties().InsertBoolean(s_hasLeftContentPropertyName, sender.Size() > 0);
+    if (m_interactionTracker)
+    {
+        m_interactionTracker.get().Properties().InsertBoolean(s_hasLeftContentPropertyName, sender.Size() > 0);
+    }
+
+    m_swipeItemButtons.clear();
 
     if (m_createdContent == CreatedContent::Left)
     {
@@ -1477,7 +1722,12 @@ void SwipeControl::OnRightItemsChanged(const winrt::IObservableVector<winrt::Swi
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
     ThrowIfHasVerticalAndHorizontalContent();
-    m_interactionTracker.get().Properties().InsertBoolean(s_hasRightContentPropertyName, sender.Size() > 0);
+    if (m_interactionTracker)
+    {
+        m_interactionTracker.get().Properties().InsertBoolean(s_hasRightContentPropertyName, sender.Size() > 0);
+    }
+
+    m_swipeItemButtons.clear();
 
     if (m_createdContent == CreatedContent::Right)
     {
@@ -1490,7 +1740,12 @@ void SwipeControl::OnTopItemsChanged(const winrt::IObservableVector<winrt::Swipe
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
     ThrowIfHasVerticalAndHorizontalContent();
-    m_interactionTracker.get().Properties().InsertBoolean(s_hasTopContentPropertyName, sender.Size() > 0);
+    if (m_interactionTracker)
+    {
+        m_interactionTracker.get().Properties().InsertBoolean(s_hasTopContentPropertyName, sender.Size() > 0);
+    }
+
+    m_swipeItemButtons.clear();
 
     if (m_createdContent == CreatedContent::Top)
     {
@@ -1503,7 +1758,12 @@ void SwipeControl::OnBottomItemsChanged(const winrt::IObservableVector<winrt::Sw
     SWIPECONTROL_TRACE_INFO(*this, TRACE_MSG_METH, METH_NAME, this);
 
     ThrowIfHasVerticalAndHorizontalContent();
-    m_interactionTracker.get().Properties().InsertBoolean(s_hasBottomContentPropertyName, sender.Size() > 0);
+    if (m_interactionTracker)
+    {
+        m_interactionTracker.get().Properties().InsertBoolean(s_hasBottomContentPropertyName, sender.Size() > 0);
+    }
+
+    m_swipeItemButtons.clear();
 
     if (m_createdContent == CreatedContent::Bottom)
     {
@@ -78,10 +78,14 @@ private:
     void OnSizeChanged(const winrt::IInspectable& sender, const winrt::SizeChangedEventArgs& args);
     void OnSwipeContentStackPanelSizeChanged(const winrt::IInspectable& sender, const winrt::SizeChangedEventArgs& args);
     void OnPointerPressedEvent(const winrt::IInspectable& sender, const winrt::PointerRoutedEventArgs& args);
+    void OnPointerEnteredEvent(const winrt::IInspectable& sender, const winrt::PointerRoutedEventArgs& args);
+    void OnDataContextChanged(const winrt::FrameworkElement& sender, const winrt::DataContextChangedEventArgs& args);
     void InputEaterGridTapped(const winrt::IInspectable& /*sender*/, const winrt::TappedRoutedEventArgs& args);
 
     void AttachDismissingHandlers();
     void DetachDismissingHandlers();
+    void EnsureDismissingHandlers();
+    static void ForEachOpenSwipeControl(const winrt::IInspectable& xamlRoot, const std::function<void(SwipeControl&)>& function);
     void DismissSwipeOnAcceleratorKeyActivator(const winrt::Windows::UI::Core::CoreDispatcher & sender, const winrt::AcceleratorKeyEventArgs & args);
 
 #ifdef USE_INSIDER_SDK
@@ -103,6 +107,7 @@ private:
     void GetTemplateParts();
 
     void InitializeInteractionTracker();
+    void EnsureInteractionTracker();
     void ConfigurePositionInertiaRestingValues();
 
     winrt::Visual FindVisualInteractionSourceVisual();
@@ -123,7 +128,9 @@ private:
     void SetupClipAnimation();
     void UpdateColors();
 
+    winrt::AppBarButton GetOrCreateSwipeItemButton(const winrt::SwipeItem& swipeItem);
     winrt::AppBarButton GetSwipeItemButton(const winrt::SwipeItem& swipeItem);
+    void UpdateSwipeItemButton(const winrt::AppBarButton& itemAsButton, const winrt::SwipeItem& swipeItem);
     void UpdateColorsIfExecuteItem();
     void UpdateColorsIfRevealItems();
     void UpdateExecuteForegroundColor(const winrt::SwipeItem& swipeItem);
@@ -170,6 +177,25 @@ private:
     // Cache the current content object to minimize work if there are multiple swipes in the same direction.
     tracker_ref<winrt::SwipeItems> m_currentItems{ this };
 
+    // Generated swipe item buttons, reused until the items collections change.
+    struct SwipeItemButton
+    {
+        explicit SwipeItemButton(const ITrackerHandleManager* owner) :
+            m_swipeItem(owner),
+            m_button(owner),
+            m_iconSource(owner)
+        {
+        }
+
+        tracker_ref<winrt::SwipeItem> m_swipeItem;
+        tracker_ref<winrt::AppBarButton> m_button;
+        // Values the button was generated with.
+        tracker_ref<winrt::IconSource> m_iconSource;
+        winrt::hstring m_text;
+        winrt::SwipeMode m_mode{ winrt::SwipeMode::Reveal };
+    };
+    std::vector<SwipeItemButton> m_swipeItemButtons;
+
     winrt::event_token m_loadedToken{};
     winrt::event_token m_leftItemsChangedToken{};
     winrt::event_token m_rightItemsChangedToken{};
@@ -178,25 +204,13 @@ private:
     winrt::event_token m_onSizeChangedToken{};
     winrt::event_token m_onSwipeContentStackPanelSizeChangedToken{};
     winrt::event_token m_inputEaterTappedToken{};
+    winrt::event_token m_onPointerEnteredToken{};
+    winrt::event_token m_dataContextChangedToken{};
     tracker_ref<winrt::IInspectable> m_onPointerPressedEventHandler{ this };
 
-#ifdef USE_INSIDER_SDK
-    // Used on platforms where we have XamlRoot.
-    tracker_ref<winrt::IInspectable> m_onXamlRootPointerPressedEventHandler{ this };
-    tracker_ref<winrt::IInspectable> m_onXamlRootKeyDownEventHandler{ this };
-    winrt::IXamlRoot::Changed_revoker m_xamlRootChangedRevoker;
-#endif
-
-
-    // Used on platforms where we don't have XamlRoot.
-    winrt::ICoreWindow::PointerPressed_revoker m_coreWindowPointerPressedRevoker;
-    winrt::ICoreWindow::KeyDown_revoker m_coreWindowKeyDownRevoker;
-    winrt::ICoreWindow::VisibilityChanged_revoker m_windowMinimizeRevoker;
-    winrt::IWindow::SizeChanged_revoker m_windowSizeChangedRevoker;
-
-    winrt::CoreAcceleratorKeys::AcceleratorKeyActivated_revoker m_acceleratorKeyActivatedRevoker;
-
     bool m_hasInitialLoadedEventFired{ false };
+    bool m_isInteractionTrackerInitializationPending{ false };
+    bool m_isSwipeContentStackPanelSizePending{ false };
 
     bool m_lastActionWasClosing{ false };
     bool m_lastActionWasOpening{ false };
@@ -5,24 +5,100 @@
 #include "RuntimeProfiler.h"
 #include "TraceLogging.h"
 
-#define DEFINE_PROFILEGROUP(name, group, size) \
-    CMethodProfileGroup<size>        name(group)
+#define DEFINE_PROFILEGROUP(name, group, size, slotbase) \
+    CMethodProfileGroup<size>        name(group, slotbase)
 
 namespace RuntimeProfiler {
 
     void UninitializeRuntimeProfiler();
 
+    //  Every registered marker owns one slot, PG_Class markers first and
+    //  PG_ClassMember markers after them.
+    constexpr LONG c_cCounterSlots = ProfId_Size + ProfMemberId_Size;
+
+    //  Hit counts are kept per thread so that markers hit on different UI
+    //  threads never share a cache line. Only the owning thread writes its
+    //  shard and the counts only ever grow (modulo wrap), FireEvent sums the
+    //  shards and reports the difference from what it reported last time.
+    struct DECLSPEC_CACHEALIGN CCounterShard
+    {
+        volatile ULONG      m_cHits[c_cCounterSlots] = {};
+        CCounterShard      *m_pNext{ nullptr };
+        volatile LONG       m_bInUse{ 0 };
+    };
+
+    //  Shards are never freed, a thread that exits hands its shard over to
+    //  the next thread that needs one, so the list is bounded by the peak
+    //  number of threads that hit a marker.
+    CCounterShard * volatile g_pShards = nullptr;
+
+    CCounterShard* AcquireShard() noexcept
+    {
+        for (CCounterShard *pShard = g_pShards; pShard; pShard = pShard->m_pNext)
+        {
+            if (0 == ::InterlockedCompareExchange(&pShard->m_bInUse, 1, 0))
+            {
+                return pShard;
+            }
+        }
+
+        CCounterShard *pShard = new (std::nothrow) CCounterShard();
+
+        if (pShard)
+        {
+            CCounterShard *pHead;
+
+            pShard->m_bInUse = 1;
+            do
+            {
+                pHead = g_pShards;
+                pShard->m_pNext = pHead;
+            }
+            while (pHead != ::InterlockedCompareExchangePointer(reinterpret_cast<PVOID volatile *>(&g_pShards), pShard, pHead));
+        }
+
+        return pShard;
+    }
+
+    struct CThreadShard
+    {
+        CCounterShard      *m_pShard{ AcquireShard() };
+
+        ~CThreadShard()
+        {
+            if (m_pShard)
+            {
+                ::InterlockedExchange(&m_pShard->m_bInUse, 0);
+            }
+        }
+    };
+
+    thread_local CThreadShard t_shard;
+
+    ULONG SumShards(LONG slot) noexcept
+    {
+        ULONG cHits = 0;
+
+        for (CCounterShard *pShard = g_pShards; pShard; pShard = pShard->m_pNext)
+        {
+            cHits += pShard->m_cHits[slot];
+        }
+
+        return cHits;
+    }
+
     struct FunctionTelemetryCount
     {
-        volatile LONG      *pInstanceCount{ nullptr };
+        volatile LONG       bRegistered{ 0 };
         volatile UINT16     uTypeIndex;
         volatile UINT16     uMethodIndex;
+        ULONG               cReported;
     };
 
     class CMethodProfileGroupBase
     {
     public:
-        virtual void RegisterMethod(UINT16 uTypeIndex, UINT16 uMethodIndex, volatile LONG *pCount) noexcept = 0;
+        virtual LONG RegisterMethod(UINT16 uTypeIndex, UINT16 uMethodIndex) noexcept = 0;
         virtual void FireEvent(bool bSuspend) noexcept = 0;
     };
 
@@ -32,9 +108,10 @@ namespace RuntimeProfiler {
     public:
         static const int TableSize = size;
         
-        CMethodProfileGroup(ProfileGroup group)
+        CMethodProfileGroup(ProfileGroup group, LONG slotBase)
         :   m_cMethods(0)
         ,   m_group(group)
+        ,   m_slotBase(slotBase)
         {
             //  Note: We are declaring these objects in a global scope which
             //      basically means that anything we call here in the
@@ -47,7 +124,7 @@ namespace RuntimeProfiler {
             UninitializeRuntimeProfiler();
         }
         
-        void RegisterMethod(UINT16 uTypeIndex, UINT16 uMethodIndex, volatile LONG *pCount) noexcept
+        LONG RegisterMethod(UINT16 uTypeIndex, UINT16 uMethodIndex) noexcept
         {
             static_assert(sizeof(LONG) == sizeof(UINT32), "Since we're using InterlockedIncrement, make sure that this is the same size independent of build flavors.");
             
@@ -59,18 +136,17 @@ namespace RuntimeProfiler {
                 m_Counts[WriteIndex].uTypeIndex          = uTypeIndex;
                 m_Counts[WriteIndex].uMethodIndex        = uMethodIndex;
                 
-                //  Note:  This pointer is the last thing to be set, this is
-                //    intentional, FireEvent will check the this pointer and
-                //    if set will assume that the rest of this structure is
-                //    valid, do not change the order.
-                m_Counts[WriteIndex].pInstanceCount      = pCount;
-                
-                //  FireEvent() will reset counts to zero and we don't want
-                //  RegisterMethod() to be called again, thus we set the
-                //  initial static value to -1, to be incremented to 0 on first
-                //  call and we increment again for an accurate count.
-                ::InterlockedIncrement(pCount);
+                //  Note:  This flag is the last thing to be set, this is
+                //    intentional, FireEvent will check the flag and if set
+                //    will assume that the rest of this structure is valid,
+                //    do not change the order.
+                ::InterlockedExchange(&m_Counts[WriteIndex].bRegistered, 1);
+
+                return (m_slotBase + WriteIndex);
             }
+
+            //  Table is full, the marker won't be counted.
+            return -1;
         }
         
         void FireEvent(bool bSuspend) noexcept
@@ -104,7 +180,7 @@ namespace RuntimeProfiler {
             {
                 LONG        cHits;
 
-                if (!m_Counts[ii].pInstanceCount)
+                if (!m_Counts[ii].bRegistered)
                 {
                     //  In the middle of RegisterMethod on another thread,
                     //  we'll forgo logging this method for now and pick it
@@ -112,8 +188,10 @@ namespace RuntimeProfiler {
                     continue;
                 }
             
-                //  Zeroing out AND getting value.
-                cHits = InterlockedExchange(m_Counts[ii].pInstanceCount, 0);
+                //  Hits since the last event, unsigned math covers wrapping.
+                ULONG cTotal = SumShards(m_slotBase + ii);
+                cHits = (LONG)(cTotal - m_Counts[ii].cReported);
+                m_Counts[ii].cReported = cTotal;
             
                 if (0 != cHits)
                 {
@@ -173,12 +251,116 @@ namespace RuntimeProfiler {
         std::array<FunctionTelemetryCount, TableSize>   m_Counts = {0};
         LONG                                            m_cMethods;
         ProfileGroup                                    m_group;
+        LONG                                            m_slotBase;
     };  //  class CMethodProfileGroup
 
 
+    //  Live instance counts aren't zeroed by FireEvent, only the peak is
+    //  brought back down to the live count so that it covers one interval.
+    class CInstanceProfileGroup
+    {
+    public:
+        //  Same DllMain rules as CMethodProfileGroup, nothing to do here.
+        CInstanceProfileGroup() = default;
+
+        void AddInstance(UINT16 uTypeIndex) noexcept
+        {
+            if (uTypeIndex < ProfId_Size)
+            {
+                LONG cLive = ::InterlockedIncrement(&m_cLive[uTypeIndex]);
+                LONG cPeak = m_cPeak[uTypeIndex];
+                while (cLive > cPeak)
+                {
+                    LONG cPrevious = ::InterlockedCompareExchange(&m_cPeak[uTypeIndex], cLive, cPeak);
+                    if (cPrevious == cPeak)
+                    {
+                        break;
+                    }
+                    cPeak = cPrevious;
+                }
+            }
+        }
+
+        void RemoveInstance(UINT16 uTypeIndex) noexcept
+        {
+            if (uTypeIndex < ProfId_Size)
+            {
+                ::InterlockedDecrement(&m_cLive[uTypeIndex]);
+            }
+        }
+
+        void FireEvent(bool bSuspend) noexcept
+        {
+            if (!g_IsTelemetryProviderEnabled)
+            {
+                return;
+            }
+
+            //  Each entry will look like this:
+            //  [XX]:YYYY/ZZZZ (live/peak)
+            WCHAR       OutputBuffer[24 * ProfId_Size];
+            size_t      cchDest = ARRAYSIZE(OutputBuffer);
+            PWSTR       pszDest = &(OutputBuffer[0]);
+            UINT16      cTypesLogged = 0;
+            bool        bStringOverflow = false;
+
+            for (UINT16 ii = 0; ii < ProfId_Size; ii++)
+            {
+                LONG cLive = m_cLive[ii];
+                LONG cPeak = ::InterlockedExchange(&m_cPeak[ii], cLive);
+
+                if (0 != cPeak)
+                {
+                    HRESULT hr = StringCchPrintfExW(
+                            pszDest,
+                            cchDest,
+                            &pszDest,
+                            &cchDest,
+                            STRSAFE_NULL_ON_FAILURE,
+                            L"%ls[%d]:%d/%d",
+                            (cTypesLogged ? L"," : L""),
+                            (int)ii,
+                            cLive,
+                            cPeak);
+
+                    if (S_OK == hr)
+                    {
+                        cTypesLogged++;
+                    }
+                    else
+                    {
+                        bStringOverflow = true;
+                        break;
+                    }
+                }
+            }
+
+            if (0 == cTypesLogged)
+            {
+                return;
+            }
+
+            TraceLoggingWrite(
+                g_hTelemetryProvider,
+                "RuntimeProfilerInstances",
+                TraceLoggingDescription("Live and peak instance counts of XAML classes."),
+                TraceLoggingWideString(OutputBuffer, "InstanceCounts"),
+                TraceLoggingBoolean(bSuspend, "OnSuspend"),
+                TraceLoggingBoolean(bStringOverflow, "StringOverflow"),
+                TraceLoggingBoolean(TRUE, "UTCReplace_AppSessionGuid"),
+                TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES));
+        }
+
+    private:
+        volatile LONG m_cLive[ProfId_Size] = {};
+        volatile LONG m_cPeak[ProfId_Size] = {};
+    };
+
     //  Yes, we're declaring this as a global, the ctor/dtor are implemented
     //  very carefully and this will not create issues with DllMain().
-    DEFINE_PROFILEGROUP(gGroupClasses, PG_Class, ProfId_Size);
+    DEFINE_PROFILEGROUP(gGroupClasses, PG_Class, ProfId_Size, 0);
+    DEFINE_PROFILEGROUP(gGroupClassMembers, PG_ClassMember, ProfMemberId_Size, ProfId_Size);
+    CInstanceProfileGroup gInstances;
 
     struct ProfileGroupInfo
     {
@@ -187,17 +369,30 @@ namespace RuntimeProfiler {
     } gProfileGroups[] = 
     {
         { static_cast<CMethodProfileGroupBase*>(&gGroupClasses), "Classes" },
+        { static_cast<CMethodProfileGroupBase*>(&gGroupClassMembers), "ClassMembers" },
     };
 
     using namespace std::chrono;
     constexpr auto  EventFrequency = 20min;
 
+    volatile LONG   g_bFiringEvent = 0;
+
     void FireEvent(bool bSuspend) noexcept
     {
+        //  The reported totals aren't interlocked, so a suspend racing the
+        //  timer callback just leaves the counts to the one already running.
+        if (0 != ::InterlockedCompareExchange(&g_bFiringEvent, 1, 0))
+        {
+            return;
+        }
+
         for (auto group : gProfileGroups)
         {
             group.pGroup->FireEvent(bSuspend);
         }
+        gInstances.FireEvent(bSuspend);
+
+        ::InterlockedExchange(&g_bFiringEvent, 0);
     }
 
     VOID CALLBACK TPTimerCallback(PTP_CALLBACK_INSTANCE, PVOID, PTP_TIMER) noexcept
@@ -268,14 +463,44 @@ namespace RuntimeProfiler {
         return ((NULL != g_pTimer)?TRUE:FALSE);
     }
 
-    void RegisterMethod(ProfileGroup group, UINT16 uTypeIndex, UINT16 uMethodIndex, volatile LONG *pCount) noexcept
+    void EnsureRuntimeProfilerInitialized() noexcept
     {
         static INIT_ONCE            InitProfiler = INIT_ONCE_STATIC_INIT;
+
+        InitOnceExecuteOnce(&InitProfiler, InitializeRuntimeProfiler, NULL, NULL);
+    }
+
+    LONG RegisterMethod(ProfileGroup group, UINT16 uTypeIndex, UINT16 uMethodIndex) noexcept
+    {
         CMethodProfileGroupBase    *pGroup = gProfileGroups[(int)group].pGroup;
     
-        InitOnceExecuteOnce(&InitProfiler, InitializeRuntimeProfiler, NULL, NULL);
+        EnsureRuntimeProfilerInitialized();
+
+        return (pGroup->RegisterMethod(uTypeIndex, uMethodIndex));
+    }
 
-        return (pGroup->RegisterMethod(uTypeIndex, uMethodIndex, pCount));
+    void IncrementMethodCount(LONG slot) noexcept
+    {
+        if (slot >= 0)
+        {
+            if (CCounterShard *pShard = t_shard.m_pShard)
+            {
+                //  Single writer, no interlocked needed.
+                pShard->m_cHits[slot] = pShard->m_cHits[slot] + 1;
+            }
+        }
+    }
+
+    void AddLiveInstance(UINT16 uTypeIndex) noexcept
+    {
+        EnsureRuntimeProfilerInitialized();
+
+        gInstances.AddInstance(uTypeIndex);
+    }
+
+    void RemoveLiveInstance(UINT16 uTypeIndex) noexcept
+    {
+        gInstances.RemoveInstance(uTypeIndex);
     }
 
 } // namespace RuntimeProfiler
@@ -6,7 +6,8 @@ namespace RuntimeProfiler
 {
     typedef enum
     {
-        PG_Class = 0
+        PG_Class = 0,
+        PG_ClassMember
     } ProfileGroup;
 
     //  We use these id's on reports so please don't remove or move these
@@ -38,21 +39,47 @@ namespace RuntimeProfiler
         ProfId_StackLayout,
         ProfId_UniformGridLayout,
         ProfId_VirtualizingLayout,
+        ProfId_Scroller,
         ProfId_Size
     } ProfilerClassId;
 
+    //  Hot methods counted with __RP_Marker_ClassMemberById. Same rules as
+    //  above, add new id's immediately preceding ProfMemberId_Size.
+    typedef enum
+    {
+        ProfMemberId_ItemsRepeater_MeasureOverride = 0,
+        ProfMemberId_Scroller_ChangeOffsets,
+        ProfMemberId_Scroller_ChangeZoomFactor,
+        ProfMemberId_Size
+    } ProfilerClassMemberId;
+
     void FireEvent(bool Suspend) noexcept;
-    void RegisterMethod(ProfileGroup group, UINT16 TypeIndex, UINT16 MethodIndex, volatile LONG *Count) noexcept;
+    LONG RegisterMethod(ProfileGroup group, UINT16 TypeIndex, UINT16 MethodIndex) noexcept;
+    void IncrementMethodCount(LONG Slot) noexcept;
+    void AddLiveInstance(UINT16 TypeIndex) noexcept;
+    void RemoveLiveInstance(UINT16 TypeIndex) noexcept;
 }
 
+//  The slot is registered once per call site, hits go to a per-thread
+//  counter so that markers don't contend across UI threads.
 #define __RP_Marker_ClassById(typeindex) \
     { \
-        __pragma (warning ( suppress : 28112)) \
-        static volatile LONG __RuntimeProfiler_Counter = -1; \
-        if (0 == ::InterlockedIncrement(&__RuntimeProfiler_Counter)) \
-        { \
-            RuntimeProfiler::RegisterMethod(RuntimeProfiler::PG_Class, (UINT16)typeindex, 9999, &__RuntimeProfiler_Counter); \
-        } \
+        static const LONG __RuntimeProfiler_Slot = RuntimeProfiler::RegisterMethod(RuntimeProfiler::PG_Class, (UINT16)typeindex, 9999); \
+        RuntimeProfiler::IncrementMethodCount(__RuntimeProfiler_Slot); \
     }
     
 
+//  Counts calls of a hot method, reported per event interval like the
+//  class markers above.
+#define __RP_Marker_ClassMemberById(typeindex, memberindex) \
+    { \
+        static const LONG __RuntimeProfiler_Slot = RuntimeProfiler::RegisterMethod(RuntimeProfiler::PG_ClassMember, (UINT16)typeindex, (UINT16)memberindex); \
+        RuntimeProfiler::IncrementMethodCount(__RuntimeProfiler_Slot); \
+    }
+
+//  Live and peak instance counts, put in the constructor and destructor.
+#define __RP_Marker_ClassInstanceCreated(typeindex) \
+    RuntimeProfiler::AddLiveInstance((UINT16)typeindex)
+
+#define __RP_Marker_ClassInstanceDestroyed(typeindex) \
+    RuntimeProfiler::RemoveLiveInstance((UINT16)typeindex)
@@ -0,0 +1,82 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "TraceLogging.h"
+#include "QPCTimer.h"
+#include <optional>
+
+// Unlike the rest of the perf provider, sampled events are cheap enough to leave enabled in production:
+// each call site only times and writes 1 in SampledPerfTraceInterval() of its operations. They are only
+// emitted when KEYWORD_SAMPLEDPERF is explicitly requested, so turning the whole provider on
+// does not also turn them on. The level picks the sampling rate:
+//   WINEVENT_LEVEL_VERBOSE - every operation
+//   WINEVENT_LEVEL_INFO    - 1 in 16
+//   lower levels           - 1 in 256
+inline bool IsSampledPerfTracingEnabled()
+{
+    return g_IsPerfProviderEnabled &&
+        (g_PerfProviderMatchAnyKeyword & KEYWORD_SAMPLEDPERF);
+}
+
+inline uint32_t SampledPerfTraceInterval()
+{
+    if (g_PerfProviderLevel >= WINEVENT_LEVEL_VERBOSE)
+    {
+        return 1;
+    }
+    else if (g_PerfProviderLevel >= WINEVENT_LEVEL_INFO)
+    {
+        return 16;
+    }
+    return 256;
+}
+
+// Times the enclosing scope when it is the sampled one out of the current interval. 'operation' is expected
+// to be a string literal and 'counter' a per call site, per thread operation count (see SAMPLED_PERF_TRACE_SCOPE).
+class SampledPerfTraceScope
+{
+public:
+    SampledPerfTraceScope(PCSTR operation, uint32_t& counter) noexcept
+        : m_operation(operation)
+    {
+        if (IsSampledPerfTracingEnabled())
+        {
+            m_interval = SampledPerfTraceInterval();
+            if (++counter >= m_interval)
+            {
+                counter = 0;
+                m_timer.emplace();
+            }
+        }
+    }
+
+    ~SampledPerfTraceScope() noexcept
+    {
+        if (m_timer)
+        {
+            TraceLoggingWrite(
+                g_hPerfProvider,
+                "SampledPerf" /* eventName */,
+                TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+                TraceLoggingKeyword(KEYWORD_SAMPLEDPERF),
+                TraceLoggingString(m_operation, "Operation"),
+                TraceLoggingInt64(m_timer->DurationInMicroSeconds(), "DurationInMicroseconds"),
+                TraceLoggingUInt32(m_interval, "SampleInterval"));
+        }
+    }
+
+    SampledPerfTraceScope(const SampledPerfTraceScope&) = delete;
+    SampledPerfTraceScope& operator=(const SampledPerfTraceScope&) = delete;
+
+private:
+    PCSTR m_operation;
+    uint32_t m_interval{};
+    std::optional<QPCTimer> m_timer{};
+};
+
+// Put at the top of the operation to sample.
+#define SAMPLED_PERF_TRACE_SCOPE(operation) \
+    static thread_local uint32_t s_sampledPerfTraceCounter{}; \
+    SampledPerfTraceScope sampledPerfTraceScope{ operation, s_sampledPerfTraceCounter }
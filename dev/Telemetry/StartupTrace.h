@@ -0,0 +1,86 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "TraceLogging.h"
+
+inline bool IsStartupPerfTracingEnabled()
+{
+    return g_IsPerfProviderEnabled &&
+        g_PerfProviderLevel >= WINEVENT_LEVEL_INFO &&
+        (g_PerfProviderMatchAnyKeyword & KEYWORD_STARTUP || g_PerfProviderMatchAnyKeyword == 0);
+}
+
+// Start/stop events bracketing the work this library does while an app starts: DLL attach, activation
+// factories, metadata provider registration, theme dictionary loading and the first template application
+// of each control. 'activity' is expected to be a string literal, 'detail' names the class or Uri involved.
+class StartupTraceScope
+{
+public:
+    StartupTraceScope(PCSTR activity, PCWSTR detail = L"", bool isEnabled = true) noexcept
+        : m_activity(activity)
+        , m_detail(detail)
+        , m_isEnabled(isEnabled && IsStartupPerfTracingEnabled())
+    {
+        if (m_isEnabled)
+        {
+            TraceStarted(m_activity, m_detail);
+            QueryPerformanceCounter(&m_startCounter);
+        }
+    }
+
+    ~StartupTraceScope() noexcept
+    {
+        if (m_isEnabled)
+        {
+            TraceStopped(m_activity, m_detail, m_startCounter);
+        }
+    }
+
+    StartupTraceScope(const StartupTraceScope&) = delete;
+    StartupTraceScope& operator=(const StartupTraceScope&) = delete;
+
+    static void TraceStarted(PCSTR activity, PCWSTR detail) noexcept
+    {
+        TraceLoggingWrite(
+            g_hPerfProvider,
+            "StartupActivity" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_STARTUP),
+            TraceLoggingOpcode(WINEVENT_OPCODE_START),
+            TraceLoggingString(activity, "Activity"),
+            TraceLoggingWideString(detail, "Detail"));
+    }
+
+    // Also used on its own where the work started before tracing was registered.
+    static void TraceStopped(PCSTR activity, PCWSTR detail, const LARGE_INTEGER& startCounter) noexcept
+    {
+        LARGE_INTEGER stopCounter{};
+        LARGE_INTEGER frequency{};
+        QueryPerformanceCounter(&stopCounter);
+        QueryPerformanceFrequency(&frequency);
+
+        TraceLoggingWrite(
+            g_hPerfProvider,
+            "StartupActivity" /* eventName */,
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(KEYWORD_STARTUP),
+            TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+            TraceLoggingString(activity, "Activity"),
+            TraceLoggingWideString(detail, "Detail"),
+            TraceLoggingFloat64(1000.0 * (stopCounter.QuadPart - startCounter.QuadPart) / frequency.QuadPart, "DurationInMilliseconds"));
+    }
+
+private:
+    PCSTR m_activity;
+    PCWSTR m_detail;
+    bool m_isEnabled;
+    LARGE_INTEGER m_startCounter{};
+};
+
+// Put at the top of a control's OnApplyTemplate. Only the first call per class is traced.
+#define STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(className) \
+    static std::atomic<bool> s_isFirstTemplateApplied{ false }; \
+    StartupTraceScope startupTraceScope{ "FirstTemplateApplied", className, \
+        !s_isFirstTemplateApplied.load(std::memory_order_relaxed) && !s_isFirstTemplateApplied.exchange(true) }
@@ -22,6 +22,8 @@
 #define KEYWORD_SCROLLVIEWER    0x0000000000000004
 #define KEYWORD_SCROLLBAR2      0x0000000000000005
 #define KEYWORD_SWIPECONTROL    0x0000000000000006
+#define KEYWORD_STARTUP         0x0000000000000007
+#define KEYWORD_SAMPLEDPERF     0x0000000000000008
 
 // Common output formats
 #define TRACE_MSG_METH L"%s[0x%p]()\n"
@@ -5,40 +5,73 @@
 #include "TypeLogging.h"
 #include "Utils.h"
 
+TypeLogging::String::String(const String& other) noexcept
+    : m_literal(other.m_literal)
+{
+    if (!m_literal)
+    {
+        StringCchCopyW(m_buffer, ARRAYSIZE(m_buffer), other.m_buffer);
+    }
+}
+
+// Same FormatMessage inserts as StringUtil::FormatString, written to the inline buffer instead of
+// a LocalAlloc'ed one and an hstring copy.
+TypeLogging::String TypeLogging::String::Format(PCWSTR format, ...) noexcept
+{
+    String result;
+    va_list args;
+    va_start(args, format);
+
+    if (0 == FormatMessageW(
+        FORMAT_MESSAGE_FROM_STRING,
+        format,
+        0,
+        0,
+        result.m_buffer,
+        static_cast<DWORD>(ARRAYSIZE(result.m_buffer)),
+        &args))
+    {
+        result.m_buffer[0] = L'\0';
+    }
+
+    va_end(args);
+    return result;
+}
+
 #pragma region Common section
 
-winrt::hstring TypeLogging::PointerPointToString(const winrt::PointerPoint& pointerPoint, bool verbose)
+TypeLogging::String TypeLogging::PointerPointToString(const winrt::PointerPoint& pointerPoint, bool verbose)
 {
     if (verbose)
     {
-        return StringUtil::FormatString(L"PointerPoint: PointerId: %1!u!, Position: (%2!u!, %3!u!), IsInContact: %4!u!, PointerDevice: %5!u!",
+        return String::Format(L"PointerPoint: PointerId: %1!u!, Position: (%2!u!, %3!u!), IsInContact: %4!u!, PointerDevice: %5!u!",
             pointerPoint.PointerId(), static_cast<uint32_t>(pointerPoint.Position().X), static_cast<uint32_t>(pointerPoint.Position().Y), 
             pointerPoint.IsInContact(), pointerPoint.PointerDevice());
     }
     else
     {
-        return StringUtil::FormatString(L"PointerPoint: PointerId: %1!u!, Position: (%2!u!, %3!u!)",
+        return String::Format(L"PointerPoint: PointerId: %1!u!, Position: (%2!u!, %3!u!)",
             pointerPoint.PointerId(), static_cast<uint32_t>(pointerPoint.Position().X), static_cast<uint32_t>(pointerPoint.Position().Y));
     }
 }
 
-winrt::hstring TypeLogging::RectToString(const winrt::Rect& rect)
+TypeLogging::String TypeLogging::RectToString(const winrt::Rect& rect)
 {
-    return StringUtil::FormatString(L"Rect: X: %1!i!, Y: %2!i!, W: %3!u!, H: %4!u!",
+    return String::Format(L"Rect: X: %1!i!, Y: %2!i!, W: %3!u!, H: %4!u!",
         static_cast<int32_t>(rect.X), static_cast<int32_t>(rect.Y), static_cast<uint32_t>(rect.Width), static_cast<uint32_t>(rect.Height));
 }
 
-winrt::hstring TypeLogging::Float2ToString(const winrt::float2& v2)
+TypeLogging::String TypeLogging::Float2ToString(const winrt::float2& v2)
 {
-    return StringUtil::FormatString(L"(%1!i!, %2!i!)", static_cast<int32_t>(v2.x), static_cast<int32_t>(v2.y));
+    return String::Format(L"(%1!i!, %2!i!)", static_cast<int32_t>(v2.x), static_cast<int32_t>(v2.y));
 }
 
-winrt::hstring TypeLogging::OrientationToString(const winrt::Orientation& orientation)
+TypeLogging::String TypeLogging::OrientationToString(const winrt::Orientation& orientation)
 {
     return orientation == winrt::Orientation::Horizontal ? L"Horizontal" : L"Vertical";
 }
 
-winrt::hstring TypeLogging::ScrollEventTypeToString(const winrt::ScrollEventType& scrollEventType)
+TypeLogging::String TypeLogging::ScrollEventTypeToString(const winrt::ScrollEventType& scrollEventType)
 {
     switch (scrollEventType)
     {
@@ -66,7 +99,7 @@ winrt::hstring TypeLogging::ScrollEventTypeToString(const winrt::ScrollEventType
     }
 }
 
-winrt::hstring TypeLogging::ScrollingIndicatorModeToString(const winrt::ScrollingIndicatorMode& indicatorMode)
+TypeLogging::String TypeLogging::ScrollingIndicatorModeToString(const winrt::ScrollingIndicatorMode& indicatorMode)
 {
     switch (indicatorMode)
     {
@@ -88,7 +121,7 @@ winrt::hstring TypeLogging::ScrollingIndicatorModeToString(const winrt::Scrollin
 
 #ifndef BUILD_LEAN_MUX_FOR_THE_STORE_APP
 #ifndef BUILD_WINDOWS
-winrt::hstring TypeLogging::ScrollBarVisibilityToString(const winrt::ScrollBarVisibility& scrollBarVisibility)
+TypeLogging::String TypeLogging::ScrollBarVisibilityToString(const winrt::ScrollBarVisibility& scrollBarVisibility)
 {
     switch (scrollBarVisibility)
     {
@@ -110,7 +143,7 @@ winrt::hstring TypeLogging::ScrollBarVisibilityToString(const winrt::ScrollBarVi
 
 #pragma region Scroller-specific section
 
-winrt::hstring TypeLogging::ChainingModeToString(const winrt::ChainingMode& chainingMode)
+TypeLogging::String TypeLogging::ChainingModeToString(const winrt::ChainingMode& chainingMode)
 {
     switch (chainingMode)
     {
@@ -126,7 +159,7 @@ winrt::hstring TypeLogging::ChainingModeToString(const winrt::ChainingMode& chai
     }
 }
 
-winrt::hstring TypeLogging::RailingModeToString(const winrt::RailingMode& railingMode)
+TypeLogging::String TypeLogging::RailingModeToString(const winrt::RailingMode& railingMode)
 {
     switch (railingMode)
     {
@@ -140,7 +173,7 @@ winrt::hstring TypeLogging::RailingModeToString(const winrt::RailingMode& railin
     }
 }
 
-winrt::hstring TypeLogging::ScrollModeToString(const winrt::ScrollMode& scrollMode)
+TypeLogging::String TypeLogging::ScrollModeToString(const winrt::ScrollMode& scrollMode)
 {
     switch (scrollMode)
     {
@@ -158,7 +191,7 @@ winrt::hstring TypeLogging::ScrollModeToString(const winrt::ScrollMode& scrollMo
     }
 }
 
-winrt::hstring TypeLogging::ZoomModeToString(const winrt::ZoomMode& zoomMode)
+TypeLogging::String TypeLogging::ZoomModeToString(const winrt::ZoomMode& zoomMode)
 {
     switch (zoomMode)
     {
@@ -172,7 +205,7 @@ winrt::hstring TypeLogging::ZoomModeToString(const winrt::ZoomMode& zoomMode)
     }
 }
 
-winrt::hstring TypeLogging::InputKindToString(const winrt::InputKind& inputKind)
+TypeLogging::String TypeLogging::InputKindToString(const winrt::InputKind& inputKind)
 {
     switch (static_cast<int>(inputKind))
     {
@@ -196,7 +229,7 @@ winrt::hstring TypeLogging::InputKindToString(const winrt::InputKind& inputKind)
     }
 }
 
-winrt::hstring TypeLogging::ScrollerViewKindToString(const winrt::ScrollerViewKind& viewKind)
+TypeLogging::String TypeLogging::ScrollerViewKindToString(const winrt::ScrollerViewKind& viewKind)
 {
     switch (viewKind)
     {
@@ -212,7 +245,7 @@ winrt::hstring TypeLogging::ScrollerViewKindToString(const winrt::ScrollerViewKi
     }
 }
 
-winrt::hstring TypeLogging::ScrollerViewChangeKindToString(const winrt::ScrollerViewChangeKind& viewChangeKind)
+TypeLogging::String TypeLogging::ScrollerViewChangeKindToString(const winrt::ScrollerViewChangeKind& viewChangeKind)
 {
     switch (viewChangeKind)
     {
@@ -226,7 +259,7 @@ winrt::hstring TypeLogging::ScrollerViewChangeKindToString(const winrt::Scroller
     }
 }
 
-winrt::hstring TypeLogging::ScrollerViewChangeSnapPointRespectToString(const winrt::ScrollerViewChangeSnapPointRespect& snapPointRespect)
+TypeLogging::String TypeLogging::ScrollerViewChangeSnapPointRespectToString(const winrt::ScrollerViewChangeSnapPointRespect& snapPointRespect)
 {
     switch (snapPointRespect)
     {
@@ -240,7 +273,7 @@ winrt::hstring TypeLogging::ScrollerViewChangeSnapPointRespectToString(const win
     }
 }
 
-winrt::hstring TypeLogging::ScrollerViewChangeResultToString(const winrt::ScrollerViewChangeResult& result)
+TypeLogging::String TypeLogging::ScrollerViewChangeResultToString(const winrt::ScrollerViewChangeResult& result)
 {
     switch (result)
     {
@@ -256,7 +289,7 @@ winrt::hstring TypeLogging::ScrollerViewChangeResultToString(const winrt::Scroll
     }
 }
 
-winrt::hstring TypeLogging::ScrollAmountToString(const winrt::ScrollAmount& scrollAmount)
+TypeLogging::String TypeLogging::ScrollAmountToString(const winrt::ScrollAmount& scrollAmount)
 {
     switch (scrollAmount)
     {
@@ -276,9 +309,9 @@ winrt::hstring TypeLogging::ScrollAmountToString(const winrt::ScrollAmount& scro
     }
 }
 
-winrt::hstring TypeLogging::ScrollerChangeOffsetsOptionsToString(const winrt::ScrollerChangeOffsetsOptions& options)
+TypeLogging::String TypeLogging::ScrollerChangeOffsetsOptionsToString(const winrt::ScrollerChangeOffsetsOptions& options)
 {
-    return StringUtil::FormatString(L"ScrollerChangeOffsetsOptions[0x%1!p!]: HorizontalOffset: %2!i!, VerticalOffset: %3!i!, OffsetsKind: %4!s!, ViewChangeKind: %5!s!, SnapPointRespect: %6!s!",
+    return String::Format(L"ScrollerChangeOffsetsOptions[0x%1!p!]: HorizontalOffset: %2!i!, VerticalOffset: %3!i!, OffsetsKind: %4!s!, ViewChangeKind: %5!s!, SnapPointRespect: %6!s!",
         options,
         static_cast<int32_t>(options.HorizontalOffset()),
         static_cast<int32_t>(options.VerticalOffset()),
@@ -287,9 +320,9 @@ winrt::hstring TypeLogging::ScrollerChangeOffsetsOptionsToString(const winrt::Sc
         ScrollerViewChangeSnapPointRespectToString(options.SnapPointRespect()).c_str());
 }
 
-winrt::hstring TypeLogging::ScrollerChangeOffsetsWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeOffsetsWithAdditionalVelocityOptions& options)
+TypeLogging::String TypeLogging::ScrollerChangeOffsetsWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeOffsetsWithAdditionalVelocityOptions& options)
 {
-    return StringUtil::FormatString(L"ScrollerChangeOffsetsWithAdditionalVelocityOptions[0x%1!p!]: AdditionalVelocity: (%2!i!, %3!i!), 1000*InertiaDecayRate: (%4!i!, %5!i!)",
+    return String::Format(L"ScrollerChangeOffsetsWithAdditionalVelocityOptions[0x%1!p!]: AdditionalVelocity: (%2!i!, %3!i!), 1000*InertiaDecayRate: (%4!i!, %5!i!)",
         options,
         static_cast<int32_t>(options.AdditionalVelocity().x),
         static_cast<int32_t>(options.AdditionalVelocity().y),
@@ -297,9 +330,9 @@ winrt::hstring TypeLogging::ScrollerChangeOffsetsWithAdditionalVelocityOptionsTo
         static_cast<int32_t>(options.InertiaDecayRate() ? 1000.0f * options.InertiaDecayRate().Value().y : -1.0f));
 }
 
-winrt::hstring TypeLogging::ScrollerChangeZoomFactorOptionsToString(const winrt::ScrollerChangeZoomFactorOptions& options)
+TypeLogging::String TypeLogging::ScrollerChangeZoomFactorOptionsToString(const winrt::ScrollerChangeZoomFactorOptions& options)
 {
-    return StringUtil::FormatString(L"ScrollerChangeZoomFactorOptions[0x%1!p!]: 1000*ZoomFactor: %2!u!, CenterPoint: %3!s!, ZoomFactorKind: %4!s!, ViewChangeKind: %5!s!",
+    return String::Format(L"ScrollerChangeZoomFactorOptions[0x%1!p!]: 1000*ZoomFactor: %2!u!, CenterPoint: %3!s!, ZoomFactorKind: %4!s!, ViewChangeKind: %5!s!",
         options,
         static_cast<uint32_t>(options.ZoomFactor() * 1000.0f),
         Float2ToString(options.CenterPoint()).c_str(),
@@ -307,16 +340,16 @@ winrt::hstring TypeLogging::ScrollerChangeZoomFactorOptionsToString(const winrt:
         ScrollerViewChangeKindToString(options.ViewChangeKind()).c_str());
 }
 
-winrt::hstring TypeLogging::ScrollerChangeZoomFactorWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeZoomFactorWithAdditionalVelocityOptions& options)
+TypeLogging::String TypeLogging::ScrollerChangeZoomFactorWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeZoomFactorWithAdditionalVelocityOptions& options)
 {
-    return StringUtil::FormatString(L"ScrollerChangeZoomFactorWithAdditionalVelocityOptions[0x%1!p!]: AdditionalVelocity: %2!i!, 1000*InertiaDecayRate: %3!i!, CenterPoint: %4!s!",
+    return String::Format(L"ScrollerChangeZoomFactorWithAdditionalVelocityOptions[0x%1!p!]: AdditionalVelocity: %2!i!, 1000*InertiaDecayRate: %3!i!, CenterPoint: %4!s!",
         options,
         static_cast<int32_t>(options.AdditionalVelocity()),
         static_cast<int32_t>(options.InertiaDecayRate() ? 1000.0f * options.InertiaDecayRate().Value() : -1.0f),
         Float2ToString(options.CenterPoint()).c_str());
 }
 
-winrt::hstring TypeLogging::InteractionTrackerAsyncOperationTypeToString(InteractionTrackerAsyncOperationType operationType)
+TypeLogging::String TypeLogging::InteractionTrackerAsyncOperationTypeToString(InteractionTrackerAsyncOperationType operationType)
 {
     switch (operationType)
     {
@@ -342,7 +375,7 @@ winrt::hstring TypeLogging::InteractionTrackerAsyncOperationTypeToString(Interac
     }
 }
 
-winrt::hstring TypeLogging::InteractionTrackerAsyncOperationTriggerToString(InteractionTrackerAsyncOperationTrigger operationTrigger)
+TypeLogging::String TypeLogging::InteractionTrackerAsyncOperationTriggerToString(InteractionTrackerAsyncOperationTrigger operationTrigger)
 {
     switch (operationTrigger)
     {
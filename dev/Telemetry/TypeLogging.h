@@ -8,40 +8,63 @@
 class TypeLogging
 {
 public:
+    // Result of the ToString helpers. Enum names point at string literals and the other values are
+    // formatted into the inline buffer, so tracing never allocates. Meant to be used as a temporary
+    // within the trace call, e.g. TypeLogging::RectToString(rect).c_str().
+    class String
+    {
+    public:
+        String(PCWSTR literal) noexcept : m_literal(literal) {}
+        String(const String& other) noexcept;
+
+        PCWSTR c_str() const noexcept { return m_literal ? m_literal : m_buffer; }
+
+        static String Format(PCWSTR format, ...) noexcept;
+
+    private:
+        String() noexcept { m_buffer[0] = L'\0'; }
+
+        // Large enough for the longest options string. Output that does not fit is dropped.
+        static constexpr size_t c_bufferLength = 256;
+
+        PCWSTR m_literal{ nullptr };
+        WCHAR m_buffer[c_bufferLength];
+    };
+
 #pragma region Common section
-    static winrt::hstring PointerPointToString(const winrt::PointerPoint& pointerPoint, bool verbose = false);
-    static winrt::hstring RectToString(const winrt::Rect& rect);
-    static winrt::hstring Float2ToString(const winrt::float2& v2);
-    static winrt::hstring OrientationToString(const winrt::Orientation& orientation);
-    static winrt::hstring ScrollEventTypeToString(const winrt::ScrollEventType& scrollEventType);
-    static winrt::hstring ScrollingIndicatorModeToString(const winrt::ScrollingIndicatorMode& indicatorMode);
+    static String PointerPointToString(const winrt::PointerPoint& pointerPoint, bool verbose = false);
+    static String RectToString(const winrt::Rect& rect);
+    static String Float2ToString(const winrt::float2& v2);
+    static String OrientationToString(const winrt::Orientation& orientation);
+    static String ScrollEventTypeToString(const winrt::ScrollEventType& scrollEventType);
+    static String ScrollingIndicatorModeToString(const winrt::ScrollingIndicatorMode& indicatorMode);
 #pragma endregion
 
 #pragma region ScrollViewer-specific section
 #ifndef BUILD_LEAN_MUX_FOR_THE_STORE_APP
 #ifndef BUILD_WINDOWS
-static winrt::hstring ScrollBarVisibilityToString(const winrt::ScrollBarVisibility& scrollBarVisibility);
+static String ScrollBarVisibilityToString(const winrt::ScrollBarVisibility& scrollBarVisibility);
 #endif
 #endif
 #pragma endregion
 
 #pragma region Scroller-specific section
-    static winrt::hstring ChainingModeToString(const winrt::ChainingMode& chainingMode);
-    static winrt::hstring RailingModeToString(const winrt::RailingMode& railingMode);
-    static winrt::hstring ScrollModeToString(const winrt::ScrollMode& scrollMode);
-    static winrt::hstring ZoomModeToString(const winrt::ZoomMode& zoomMode);
-    static winrt::hstring InputKindToString(const winrt::InputKind& inputKind);
-    static winrt::hstring ScrollerViewKindToString(const winrt::ScrollerViewKind& offsetKind);
-    static winrt::hstring ScrollerViewChangeKindToString(const winrt::ScrollerViewChangeKind& viewChangeKind);
-    static winrt::hstring ScrollerViewChangeSnapPointRespectToString(const winrt::ScrollerViewChangeSnapPointRespect& snapPointRespect);
-    static winrt::hstring ScrollerViewChangeResultToString(const winrt::ScrollerViewChangeResult& result);
-    static winrt::hstring ScrollAmountToString(const winrt::ScrollAmount& scrollAmount);
-    static winrt::hstring ScrollerChangeOffsetsOptionsToString(const winrt::ScrollerChangeOffsetsOptions& options);
-    static winrt::hstring ScrollerChangeOffsetsWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeOffsetsWithAdditionalVelocityOptions& options);
-    static winrt::hstring ScrollerChangeZoomFactorOptionsToString(const winrt::ScrollerChangeZoomFactorOptions& options);
-    static winrt::hstring ScrollerChangeZoomFactorWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeZoomFactorWithAdditionalVelocityOptions& options);
-    static winrt::hstring InteractionTrackerAsyncOperationTypeToString(InteractionTrackerAsyncOperationType operationType);
-    static winrt::hstring InteractionTrackerAsyncOperationTriggerToString(InteractionTrackerAsyncOperationTrigger operationTrigger);
+    static String ChainingModeToString(const winrt::ChainingMode& chainingMode);
+    static String RailingModeToString(const winrt::RailingMode& railingMode);
+    static String ScrollModeToString(const winrt::ScrollMode& scrollMode);
+    static String ZoomModeToString(const winrt::ZoomMode& zoomMode);
+    static String InputKindToString(const winrt::InputKind& inputKind);
+    static String ScrollerViewKindToString(const winrt::ScrollerViewKind& offsetKind);
+    static String ScrollerViewChangeKindToString(const winrt::ScrollerViewChangeKind& viewChangeKind);
+    static String ScrollerViewChangeSnapPointRespectToString(const winrt::ScrollerViewChangeSnapPointRespect& snapPointRespect);
+    static String ScrollerViewChangeResultToString(const winrt::ScrollerViewChangeResult& result);
+    static String ScrollAmountToString(const winrt::ScrollAmount& scrollAmount);
+    static String ScrollerChangeOffsetsOptionsToString(const winrt::ScrollerChangeOffsetsOptions& options);
+    static String ScrollerChangeOffsetsWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeOffsetsWithAdditionalVelocityOptions& options);
+    static String ScrollerChangeZoomFactorOptionsToString(const winrt::ScrollerChangeZoomFactorOptions& options);
+    static String ScrollerChangeZoomFactorWithAdditionalVelocityOptionsToString(const winrt::ScrollerChangeZoomFactorWithAdditionalVelocityOptions& options);
+    static String InteractionTrackerAsyncOperationTypeToString(InteractionTrackerAsyncOperationType operationType);
+    static String InteractionTrackerAsyncOperationTriggerToString(InteractionTrackerAsyncOperationTrigger operationTrigger);
 #pragma endregion
 };
 
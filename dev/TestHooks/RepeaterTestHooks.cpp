@@ -5,6 +5,8 @@
 #include "common.h"
 #include "RepeaterTestHooksFactory.h"
 #include "layout.h"
+#include "RecyclePool.h"
+#include "ItemsRepeater.h"
 #ifdef BUILD_WINDOWS
 #include "ElementFactoryGetArgsDownlevel.h"
 #include "ElementFactoryRecycleArgsDownlevel.h"
@@ -84,4 +86,106 @@ void RepeaterTestHooks::SetLayoutId(winrt::IInspectable const& layout, hstring i
     {
         instance->LayoutId(id);
     }
-}
\ No newline at end of file
+}
+
+/* static */
+int RepeaterTestHooks::GetRecyclePoolElementCount(winrt::IInspectable const& recyclePool)
+{
+    return recyclePool.as<RecyclePool>()->ElementCount();
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRecyclePoolEstimatedBytes(winrt::IInspectable const& recyclePool)
+{
+    return recyclePool.as<RecyclePool>()->EstimatedBytes();
+}
+
+/* static */
+int RepeaterTestHooks::GetRecyclePoolHitCount(winrt::IInspectable const& recyclePool)
+{
+    return recyclePool.as<RecyclePool>()->HitCount();
+}
+
+/* static */
+int RepeaterTestHooks::GetRecyclePoolMissCount(winrt::IInspectable const& recyclePool)
+{
+    return recyclePool.as<RecyclePool>()->MissCount();
+}
+
+/* static */
+int RepeaterTestHooks::GetRecyclePoolEvictionCount(winrt::IInspectable const& recyclePool)
+{
+    return recyclePool.as<RecyclePool>()->EvictionCount();
+}
+
+/* static */
+void RepeaterTestHooks::ResetRecyclePoolCounters(winrt::IInspectable const& recyclePool)
+{
+    recyclePool.as<RecyclePool>()->ResetCounters();
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterElementsCreatedCount(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().elementsCreated;
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterElementsRecycledCount(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().elementsRecycled;
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterElementsRebindSkippedCount(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().elementsRebindSkipped;
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterElementsPinnedCount(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().elementsPinned;
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterMeasureCount(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().measureCount;
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterArrangeCount(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().arrangeCount;
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterMeasureTimeInMicroseconds(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().measureTimeInMicroseconds;
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterElementFactoryTimeInMicroseconds(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PerfCounters().elementFactoryTimeInMicroseconds;
+}
+
+/* static */
+int RepeaterTestHooks::GetRepeaterPhasingBacklog(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->PhasingBacklog();
+}
+
+/* static */
+int64_t RepeaterTestHooks::GetRepeaterEstimatedBookkeepingBytes(winrt::IInspectable const& repeater)
+{
+    return repeater.as<ItemsRepeater>()->EstimatedBookkeepingBytes();
+}
+
+/* static */
+void RepeaterTestHooks::ResetRepeaterCounters(winrt::IInspectable const& repeater)
+{
+    repeater.as<ItemsRepeater>()->PerfCounters() = {};
+}
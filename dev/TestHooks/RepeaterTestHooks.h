@@ -30,6 +30,25 @@ public:
     static hstring GetLayoutId(winrt::IInspectable const& layout);
     static void SetLayoutId(winrt::IInspectable const& layout, hstring id);
 
+    static int GetRecyclePoolElementCount(winrt::IInspectable const& recyclePool);
+    static int64_t GetRecyclePoolEstimatedBytes(winrt::IInspectable const& recyclePool);
+    static int GetRecyclePoolHitCount(winrt::IInspectable const& recyclePool);
+    static int GetRecyclePoolMissCount(winrt::IInspectable const& recyclePool);
+    static int GetRecyclePoolEvictionCount(winrt::IInspectable const& recyclePool);
+    static void ResetRecyclePoolCounters(winrt::IInspectable const& recyclePool);
+
+    static int64_t GetRepeaterElementsCreatedCount(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterElementsRecycledCount(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterElementsRebindSkippedCount(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterElementsPinnedCount(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterMeasureCount(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterArrangeCount(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterMeasureTimeInMicroseconds(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterElementFactoryTimeInMicroseconds(winrt::IInspectable const& repeater);
+    static int GetRepeaterPhasingBacklog(winrt::IInspectable const& repeater);
+    static int64_t GetRepeaterEstimatedBookkeepingBytes(winrt::IInspectable const& repeater);
+    static void ResetRepeaterCounters(winrt::IInspectable const& repeater);
+
 private:
     static RepeaterTestHooks* s_testHooks;
 
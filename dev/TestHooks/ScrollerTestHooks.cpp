@@ -163,6 +163,36 @@ void ScrollerTestHooks::SetContentLayoutOffsetY(const winrt::Scroller& scroller,
     }
 }
 
+bool ScrollerTestHooks::IsCompositionTargetRenderingHooked(const winrt::Scroller& scroller)
+{
+    if (scroller)
+    {
+        return winrt::get_self<Scroller>(scroller)->IsCompositionTargetRenderingHooked();
+    }
+
+    return false;
+}
+
+void ScrollerTestHooks::GetLatestInteractionMetrics(
+    const winrt::Scroller& scroller,
+    _Out_ int& valuesChangedCount,
+    _Out_ int& inertiaFrameCount,
+    _Out_ int& missedFrameCount,
+    _Out_ double& firstValuesChangedLatencyInMilliseconds)
+{
+    ScrollerInteractionMetrics metrics{};
+
+    if (scroller)
+    {
+        metrics = winrt::get_self<Scroller>(scroller)->GetLatestInteractionMetrics();
+    }
+
+    valuesChangedCount = metrics.valuesChangedCount;
+    inertiaFrameCount = metrics.inertiaFrameCount;
+    missedFrameCount = metrics.missedFrameCount;
+    firstValuesChangedLatencyInMilliseconds = metrics.firstValuesChangedLatencyInMilliseconds;
+}
+
 void ScrollerTestHooks::NotifyAnchorEvaluated(
     const winrt::Scroller& sender,
     const winrt::UIElement& anchorElement,
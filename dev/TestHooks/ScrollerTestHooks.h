@@ -40,6 +40,8 @@ public:
     static void SetContentLayoutOffsetX(const winrt::Scroller& scroller, float contentLayoutOffsetX);
     static void GetContentLayoutOffsetY(const winrt::Scroller& scroller, _Out_ float& contentLayoutOffsetY);
     static void SetContentLayoutOffsetY(const winrt::Scroller& scroller, float contentLayoutOffsetY);
+    static bool IsCompositionTargetRenderingHooked(const winrt::Scroller& scroller);
+    static void GetLatestInteractionMetrics(const winrt::Scroller& scroller, _Out_ int& valuesChangedCount, _Out_ int& inertiaFrameCount, _Out_ int& missedFrameCount, _Out_ double& firstValuesChangedLatencyInMilliseconds);
 
     static void NotifyAnchorEvaluated(const winrt::Scroller& sender, const winrt::UIElement& anchorElement, double viewportAnchorPointHorizontalOffset, double viewportAnchorPointVerticalOffset);
     static winrt::event_token AnchorEvaluated(winrt::TypedEventHandler<winrt::Scroller, winrt::ScrollerTestHooksAnchorEvaluatedEventArgs> const& value);
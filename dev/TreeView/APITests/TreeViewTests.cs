@@ -506,6 +506,115 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void TreeViewMultiSelectCollapsedDescendantsTest()
+        {
+            TreeView treeView = null;
+            TreeViewNode node1 = null;
+            TreeViewNode node11 = null;
+            TreeViewNode node111 = null;
+            TreeViewNode node2 = null;
+
+            var loadedWaiter = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                treeView = new TreeView();
+                treeView.SelectionMode = TreeViewSelectionMode.Multiple;
+
+                node1 = new TreeViewNode() { Content = "Node1" };
+                node11 = new TreeViewNode() { Content = "Node1.1" };
+                node111 = new TreeViewNode() { Content = "Node1.1.1" };
+                node2 = new TreeViewNode() { Content = "Node2" };
+                node11.Children.Add(node111);
+                node1.Children.Add(node11);
+                treeView.RootNodes.Add(node1);
+                treeView.RootNodes.Add(node2);
+
+                treeView.Loaded += (object sender, RoutedEventArgs e) =>
+                {
+                    loadedWaiter.Set();
+                };
+
+                MUXControlsTestApp.App.TestContentRoot = treeView;
+            });
+
+            Verify.IsTrue(loadedWaiter.WaitOne(TimeSpan.FromMinutes(1)), "Check if Loaded was successfully raised");
+            RunOnUIThread.Execute(() =>
+            {
+                // Selecting a collapsed node selects everything below it.
+                treeView.SelectedNodes.Add(node1);
+                Verify.AreEqual(3, treeView.SelectedNodes.Count);
+                Verify.IsTrue(treeView.SelectedNodes.Contains(node111));
+
+                // Unselecting a leaf makes its ancestors partially selected.
+                treeView.SelectedNodes.Remove(node111);
+                Verify.AreEqual(0, treeView.SelectedNodes.Count);
+
+                treeView.SelectedNodes.Add(node111);
+                Verify.AreEqual(3, treeView.SelectedNodes.Count);
+                Verify.IsFalse(treeView.SelectedNodes.Contains(node2));
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
+        [TestMethod]
+        public void TreeViewDeferredExpandingTest()
+        {
+            TreeView treeView = null;
+            TreeViewNode node1 = null;
+            TreeViewNode node2 = null;
+            Windows.Foundation.Deferral deferral = null;
+
+            var loadedWaiter = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                treeView = new TreeView();
+                node1 = new TreeViewNode() { Content = "Node1", HasUnrealizedChildren = true };
+                node2 = new TreeViewNode() { Content = "Node2" };
+                treeView.RootNodes.Add(node1);
+                treeView.RootNodes.Add(node2);
+
+                treeView.Expanding += (TreeView sender, TreeViewExpandingEventArgs args) =>
+                {
+                    deferral = args.GetDeferral();
+                };
+
+                treeView.Loaded += (object sender, RoutedEventArgs e) =>
+                {
+                    loadedWaiter.Set();
+                };
+
+                MUXControlsTestApp.App.TestContentRoot = treeView;
+            });
+
+            Verify.IsTrue(loadedWaiter.WaitOne(TimeSpan.FromMinutes(1)), "Check if Loaded was successfully raised");
+            RunOnUIThread.Execute(() =>
+            {
+                var listControl = FindVisualChildByName(treeView, "ListControl") as TreeViewList;
+                treeView.Expand(node1);
+                Verify.IsNotNull(deferral);
+
+                var children = new TreeViewNode[10];
+                for (int i = 0; i < children.Length; i++)
+                {
+                    children[i] = new TreeViewNode() { Content = "Node1." + i };
+                    node1.Children.Add(children[i]);
+                }
+
+                // The children show up once the deferral completes.
+                Verify.AreEqual(2, listControl.Items.Count);
+                deferral.Complete();
+                Verify.AreEqual(12, listControl.Items.Count);
+                Verify.AreEqual(children[9], listControl.Items[10]);
+                Verify.AreEqual(node2, listControl.Items[11]);
+
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
         private bool IsMultiSelectCheckBoxChecked(TreeView tree, TreeViewNode node)
         {
             var treeViewItem = tree.ContainerFromNode(node) as TreeViewItem;
@@ -12,6 +12,7 @@
 #include "TreeViewNode.h"
 #include "RuntimeProfiler.h"
 #include "InspectingDataSource.h"
+#include "StartupTrace.h"
 
 static constexpr auto c_listControlName = L"ListControl"sv;
 
@@ -103,7 +104,17 @@ void TreeView::OnContainerContentChanging(const winrt::IInspectable& sender, con
 
 void TreeView::OnNodeExpanding(const winrt::TreeViewNode& sender, const winrt::IInspectable& /*args*/)
 {
-    auto treeViewExpandingEventArgs = winrt::make_self<TreeViewExpandingEventArgs>();
+    com_ptr<TreeView> strongThis = get_strong();
+    winrt::TreeViewNode node = sender;
+
+    winrt::DeferralCompletedHandler instance{ [strongThis, node]()
+        {
+            strongThis->CheckThread();
+            strongThis->OnNodeExpandingCompleted(node);
+        }
+    };
+
+    auto treeViewExpandingEventArgs = winrt::make_self<TreeViewExpandingEventArgs>(instance);
     treeViewExpandingEventArgs->Node(sender);
 
     if (m_listControl)
@@ -121,7 +132,24 @@ void TreeView::OnNodeExpanding(const winrt::TreeViewNode& sender, const winrt::I
             templateSettings->ExpandedGlyphVisibility(winrt::Visibility::Visible);
             templateSettings->CollapsedGlyphVisibility(winrt::Visibility::Collapsed);
         }
+
+        // Children added to the node until every deferral taken by the handlers completes go into
+        // the flat list in a single splice.
+        ListControl()->ListViewModel()->BeginDeferredExpansion(sender);
+        treeViewExpandingEventArgs->IncrementDeferralCount();
         m_expandingEventSource(*this, *treeViewExpandingEventArgs);
+        treeViewExpandingEventArgs->DecrementDeferralCount();
+    }
+}
+
+void TreeView::OnNodeExpandingCompleted(const winrt::TreeViewNode& node)
+{
+    if (auto listControl = ListControl())
+    {
+        if (auto vm = listControl->ListViewModel())
+        {
+            vm->EndDeferredExpansion(node);
+        }
     }
 }
 
@@ -321,6 +349,8 @@ void TreeView::UpdateItemsSelectionMode(bool isMultiSelect)
 
 void TreeView::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"TreeView");
+
     winrt::IControlProtected controlProtected = *this;
     m_listControl.set(GetTemplateChildT<winrt::TreeViewList>(c_listControlName, controlProtected));
 
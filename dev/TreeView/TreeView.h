@@ -35,6 +35,7 @@ public:
     void OnItemClick(const winrt::IInspectable& sender, const winrt::ItemClickEventArgs& args);
     void OnContainerContentChanging(const winrt::IInspectable& sender, const winrt::ContainerContentChangingEventArgs& args);
     void OnNodeExpanding(const winrt::TreeViewNode& sender, const winrt::IInspectable&);
+    void OnNodeExpandingCompleted(const winrt::TreeViewNode& node);
     void OnNodeCollapsed(const winrt::TreeViewNode& sender, const winrt::IInspectable&);
     void OnListControlDragItemsStarting(const winrt::IInspectable& sender, const winrt::DragItemsStartingEventArgs& args);
     void OnListControlDragItemsCompleted(const winrt::IInspectable& sender, const winrt::DragItemsCompletedEventArgs& args);
@@ -5,8 +5,9 @@
 #include "common.h"
 #include "TreeViewExpandingEventArgs.h"
 
-TreeViewExpandingEventArgs::TreeViewExpandingEventArgs()
+TreeViewExpandingEventArgs::TreeViewExpandingEventArgs(const winrt::Deferral& handler)
 {
+    m_deferral.set(handler);
 }
 
 winrt::TreeViewNode TreeViewExpandingEventArgs::Node()
@@ -22,4 +23,34 @@ void TreeViewExpandingEventArgs::Node(const winrt::TreeViewNode& value)
 winrt::IInspectable TreeViewExpandingEventArgs::Item()
 {
     return m_node.get().Content();
-}
\ No newline at end of file
+}
+
+winrt::Deferral TreeViewExpandingEventArgs::GetDeferral()
+{
+    m_deferralCount++;
+
+    com_ptr<TreeViewExpandingEventArgs> strongThis = get_strong();
+
+    winrt::DeferralCompletedHandler instance{ [strongThis]()
+        {
+            strongThis->CheckThread();
+            strongThis->DecrementDeferralCount();
+        }
+    };
+    return instance;
+}
+
+void TreeViewExpandingEventArgs::DecrementDeferralCount()
+{
+    MUX_ASSERT(m_deferralCount >= 0);
+    m_deferralCount--;
+    if (m_deferralCount == 0)
+    {
+        m_deferral.get().Complete();
+    }
+}
+
+void TreeViewExpandingEventArgs::IncrementDeferralCount()
+{
+    m_deferralCount++;
+}
@@ -14,11 +14,18 @@ class TreeViewExpandingEventArgs :
         winrt::composable>
 {
 public:
-    TreeViewExpandingEventArgs();
+    TreeViewExpandingEventArgs(const winrt::Deferral& handler);
     winrt::TreeViewNode Node();
     void Node(const winrt::TreeViewNode& value);
     winrt::IInspectable Item();
 
+    winrt::Deferral GetDeferral();
+
+    void IncrementDeferralCount();
+    void DecrementDeferralCount();
+
 private:
     tracker_ref<winrt::TreeViewNode> m_node{ this };
+    tracker_ref<winrt::Deferral> m_deferral{ this };
+    int m_deferralCount{ 0 };
 };
@@ -7,6 +7,7 @@
 #include "TreeViewItemAutomationPeer.h"
 #include "TreeViewList.h"
 #include "TreeViewItemTemplateSettings.h"
+#include "StartupTrace.h"
 
 TreeViewItem::TreeViewItem()
 {
@@ -259,6 +260,8 @@ winrt::AutomationPeer TreeViewItem::OnCreateAutomationPeer()
 // IFrameworkElementOverrides
 void TreeViewItem::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"TreeViewItem");
+
     RecycleEvents();
 
     winrt::IControlProtected controlProtected = *this;
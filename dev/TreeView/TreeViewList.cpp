@@ -8,9 +8,14 @@
 #include "TreeViewList.h"
 #include "TreeViewListAutomationPeer.h"
 #include "TreeViewItem.h"
+#include "StartupTrace.h"
+#include <unordered_set>
 
 CppWinRTActivatableClassWithBasicFactory(TreeViewList);
 
+// Dropping at least this many selected subtrees rebuilds the flat list once instead of moving them one by one.
+static constexpr size_t c_minNodeCountForBatchedMove = 100;
+
 TreeViewList::TreeViewList()
 {
     ListViewModel(winrt::make_self<ViewModel>());
@@ -61,20 +66,22 @@ void TreeViewList::OnDragItemsStarting(const winrt::IInspectable& /*sender*/, co
                 // When TreeView is set to multi-select mode, the underlying TreeViewList's selection mode is set to None (See OnPropertyChanged function in TreeView.cpp).
                 // TreeViewList has no knowledge about item selections happened in TreeView, no matter how many items are actually selected, args.Items() always contains only one item that is currently being dragged by cursor.
                 // Here, we manually add selected nodes to args.Items in order to expose all selected (and dragged) items to outside handlers.
-                args.Items().Clear();
                 bool isContentMode = ListViewModel()->IsContentMode();
 
+                std::vector<winrt::IInspectable> items;
+                items.reserve(selectedCount);
                 for (auto const& node : ListViewModel()->GetSelectedNodes())
                 {
                     if (isContentMode)
                     {
-                        args.Items().Append(node.Content());
+                        items.push_back(node.Content());
                     }
                     else
                     {
-                        args.Items().Append(node);
+                        items.push_back(node);
                     }
                 }
+                args.Items().ReplaceAll(items);
             }
         }
         else
@@ -130,11 +137,25 @@ void TreeViewList::OnDrop(winrt::DragEventArgs const& e)
                 auto selectedRootNodes = GetRootsOfSelectedSubtrees();
                 auto selectionSize = selectedRootNodes.size();
 
+                // Moving many subtrees one at a time updates the flat list for every one of them,
+                // take the flat indexes up front and rebuild the list once afterwards instead.
+                const bool isBatchedMove = selectionSize >= c_minNodeCountForBatchedMove;
+                std::vector<int> nodeFlatIndexes;
+                if (isBatchedMove)
+                {
+                    nodeFlatIndexes.reserve(selectionSize);
+                    for (auto const& node : selectedRootNodes)
+                    {
+                        nodeFlatIndexes.push_back(FlatIndex(node));
+                    }
+                    ListViewModel()->BeginBatchUpdate();
+                }
+
                 // Loop through in reverse order because we are inserting above the previous item to get the order correct.
                 for (int i = static_cast<int>(selectedRootNodes.size()) - 1; i >= 0; --i)
                 {
                     auto node = selectedRootNodes[i];
-                    int nodeFlatIndex = FlatIndex(node);
+                    int nodeFlatIndex = isBatchedMove ? nodeFlatIndexes[i] : FlatIndex(node);
                     if (IsFlatIndexValid(nodeFlatIndex))
                     {
                         RemoveNodeFromParent(node);
@@ -154,6 +175,11 @@ void TreeViewList::OnDrop(winrt::DragEventArgs const& e)
                         }
                     }
                 }
+
+                if (isBatchedMove)
+                {
+                    ListViewModel()->EndBatchUpdate();
+                }
             }
             else
             {
@@ -267,16 +293,10 @@ void TreeViewList::OnDragOver(winrt::DragEventArgs const& args)
             auto insertAtNode = NodeAtFlatIndex(m_emptySlotIndex);
             if (IsMultiselect())
             {
-                // If insertAtNode is in the selected items, then we do not want to allow a dropping.
-                auto selectedItems = ListViewModel()->GetSelectedNodes();
-                for (unsigned int i = 0; i < selectedItems.Size(); i++)
+                // If insertAtNode is in the selected items (the nodes being dragged), then we do not want to allow a dropping.
+                if (ListViewModel()->IsNodeSelected(insertAtNode))
                 {
-                    auto selectedNode = selectedItems.GetAt(i);
-                    if (selectedNode == insertAtNode)
-                    {
-                        allowReorder = false;
-                        break;
-                    }
+                    allowReorder = false;
                 }
             }
             else
@@ -363,6 +383,8 @@ winrt::DependencyObject TreeViewList::GetContainerForItemOverride()
 // IFrameworkElementOverrides
 void TreeViewList::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"TreeViewList");
+
     if (!m_itemsSourceAttached)
     {
         ItemsSource(*ListViewModel());
@@ -517,30 +539,20 @@ bool TreeViewList::IsMutiSelectWithSelectedItems() const
 
 bool TreeViewList::IsSelected(const winrt::TreeViewNode& node) const
 {
-    bool isSelected = false;
-    auto selectedItems = ListViewModel()->GetSelectedNodes();
-    for (unsigned int i = 0; i < selectedItems.Size(); i++)
-    {
-        if (selectedItems.GetAt(i) == node)
-        {
-            isSelected = true;
-            break;
-        }
-    }
-
-    return isSelected;
+    // GetSelectedNodes never contains the root node.
+    return node != ListViewModel()->OriginNode() && ListViewModel()->IsNodeSelected(node);
 }
 
 std::vector<winrt::TreeViewNode> TreeViewList::GetRootsOfSelectedSubtrees() const
 {
     std::vector<winrt::TreeViewNode> roots;
+    std::unordered_set<TreeViewNode*> seenRoots;
     auto selectedItems = ListViewModel()->GetSelectedNodes();
     for (unsigned int i = 0; i < selectedItems.Size(); i++)
     {
         auto item = selectedItems.GetAt(i);
         auto selectionRoot = GetRootOfSelection(item);
-        auto it = std::find(roots.cbegin(), roots.cend(), selectionRoot);
-        if (it == roots.cend())
+        if (seenRoots.insert(winrt::get_self<TreeViewNode>(selectionRoot)).second)
         {
             roots.emplace_back(selectionRoot);
         }
@@ -677,9 +689,11 @@ winrt::TreeViewNode TreeViewList::NodeFromContainer(winrt::DependencyObject cons
 
 winrt::DependencyObject TreeViewList::ContainerFromNode(winrt::TreeViewNode const& node)
 {
-    if (ListViewModel()->IsContentMode())
+    // Go through the flat list index rather than ContainerFromItem, which has to search the items.
+    uint32_t index;
+    if (ListViewModel()->IndexOfNode(node, index))
     {
-        return ContainerFromItem(node.Content());
+        return ContainerFromIndex(index);
     }
-    return ContainerFromItem(node);
+    return nullptr;
 }
\ No newline at end of file
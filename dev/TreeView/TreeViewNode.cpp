@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "common.h"
 #include "TreeViewNode.h"
+#include "ViewModel.h"
 #include "Vector.h"
 #include "VectorChangedEventArgs.h"
 
@@ -78,7 +79,56 @@ TreeNodeSelectionState TreeViewNode::SelectionState()
 
 void TreeViewNode::SelectionState(TreeNodeSelectionState const& state)
 {
-    m_multiSelectionState = state;
+    if (m_multiSelectionState != state)
+    {
+        auto previousState = m_multiSelectionState;
+        m_multiSelectionState = state;
+        if (auto parent = Parent())
+        {
+            winrt::get_self<TreeViewNode>(parent)->OnChildSelectionStateChanged(previousState, state);
+        }
+    }
+}
+
+// The tri-state we would show based on our children alone, in constant time.
+TreeNodeSelectionState TreeViewNode::SelectionStateBasedOnChildren()
+{
+    if (m_partialSelectedChildCount > 0 ||
+        (m_selectedChildCount > 0 && m_selectedChildCount < static_cast<int>(Children().Size())))
+    {
+        return TreeNodeSelectionState::PartialSelected;
+    }
+
+    return m_selectedChildCount > 0 ? TreeNodeSelectionState::Selected : TreeNodeSelectionState::UnSelected;
+}
+
+void TreeViewNode::OnChildSelectionStateChanged(TreeNodeSelectionState const& previousState, TreeNodeSelectionState const& newState)
+{
+    UpdateChildSelectionCounts(previousState, -1);
+    UpdateChildSelectionCounts(newState, 1);
+}
+
+void TreeViewNode::UpdateChildSelectionCounts(TreeNodeSelectionState const& state, int delta)
+{
+    switch (state)
+    {
+    case TreeNodeSelectionState::Selected:
+        m_selectedChildCount += delta;
+        break;
+    case TreeNodeSelectionState::PartialSelected:
+        m_partialSelectedChildCount += delta;
+        break;
+    }
+}
+
+void TreeViewNode::RefreshChildSelectionCounts()
+{
+    m_selectedChildCount = 0;
+    m_partialSelectedChildCount = 0;
+    for (auto const& child : Children())
+    {
+        UpdateChildSelectionCounts(winrt::get_self<TreeViewNode>(child)->SelectionState(), 1);
+    }
 }
 
 void TreeViewNode::UpdateDepth(int depth)
@@ -106,41 +156,112 @@ void TreeViewNode::ChildVectorChanged(winrt::IObservableVector<winrt::TreeViewNo
     winrt::CollectionChange collectionChange = wArgs.CollectionChange();
     unsigned int index = args.as<winrt::IVectorChangedEventArgs>().Index();
     UpdateHasChildren();
+    UpdateExpandedDescendantCount();
+    RefreshChildSelectionCounts();
     RaiseChildrenChanged(collectionChange, index);
 }
 
 void TreeViewNode::OnPropertyChanged(winrt::DependencyPropertyChangedEventArgs const& args)
 {
     winrt::IDependencyProperty property = args.Property();
-    m_propertyChangedEventSource(*this, args);
+    if (property == s_IsExpandedProperty)
+    {
+        // Our descendants start or stop counting towards our ancestors.
+        if (auto parent = Parent())
+        {
+            const int delta = static_cast<int>(m_expandedDescendantCount);
+            winrt::get_self<TreeViewNode>(parent)->OnExpandedDescendantCountChanged(unbox_value<bool>(args.NewValue()) ? delta : -delta);
+        }
+    }
+
+    if (m_isInView)
+    {
+        if (auto viewModel = m_viewModel.get())
+        {
+            viewModel->TreeViewNodePropertyChanged(*this, args);
+        }
+    }
 }
 
-winrt::event_token TreeViewNode::AddExpandedChanged(winrt::TypedEventHandler<winrt::TreeViewNode, winrt::DependencyPropertyChangedEventArgs> const& value)
+unsigned int TreeViewNode::ExpandedDescendantCount()
 {
-    winrt::event_token token = m_propertyChangedEventSource.add(value);
-    return token;
+    return m_expandedDescendantCount;
 }
 
-void TreeViewNode::RemoveExpandedChanged(winrt::event_token token)
+// Number of rows this node takes up in its parent's expanded descendants.
+unsigned int TreeViewNode::GetCountInParent()
 {
-    m_propertyChangedEventSource.remove(token);
+    return 1 + (IsExpanded() ? m_expandedDescendantCount : 0);
 }
 
-winrt::event_token TreeViewNode::ChildrenChanged(winrt::TypedEventHandler<winrt::TreeViewNode, winrt::IVectorChangedEventArgs> const& value)
+// Children keep their own counts up to date, so summing them is enough
+// after any change to our Children vector; the removed nodes are already gone.
+void TreeViewNode::UpdateExpandedDescendantCount()
 {
-    winrt::event_token token = m_childrenChangedSource.add(value);
-    return token;
+    unsigned int count = 0;
+    for (auto const& child : Children())
+    {
+        count += winrt::get_self<TreeViewNode>(child)->GetCountInParent();
+    }
+
+    if (count != m_expandedDescendantCount)
+    {
+        OnExpandedDescendantCountChanged(static_cast<int>(count) - static_cast<int>(m_expandedDescendantCount));
+    }
+}
+
+void TreeViewNode::OnExpandedDescendantCountChanged(int delta)
+{
+    m_expandedDescendantCount = static_cast<unsigned int>(static_cast<int>(m_expandedDescendantCount) + delta);
+
+    // A collapsed node contributes a single row to its parent, whatever is below it.
+    if (IsExpanded())
+    {
+        if (auto parent = Parent())
+        {
+            winrt::get_self<TreeViewNode>(parent)->OnExpandedDescendantCountChanged(delta);
+        }
+    }
+}
+
+void TreeViewNode::SetViewModel(winrt::weak_ref<ViewModel> const& viewModel)
+{
+    m_viewModel = viewModel;
+}
+
+void TreeViewNode::IsInView(bool value)
+{
+    m_isInView = value;
+}
+
+void TreeViewNode::IsViewOrigin(bool value)
+{
+    m_isViewOrigin = value;
 }
 
-void TreeViewNode::ChildrenChanged(winrt::event_token token)
+void TreeViewNode::IsInSelectedNodes(bool value)
 {
-    m_childrenChangedSource.remove(token);
+    m_isInSelectedNodes = value;
 }
 
 void TreeViewNode::RaiseChildrenChanged(winrt::CollectionChange CC, unsigned int index)
 {
-    auto args = winrt::make<VectorChangedEventArgs>(CC, index);
-    m_childrenChangedSource(*this, args);
+    if (m_isInView || m_isViewOrigin || m_isInSelectedNodes)
+    {
+        if (auto viewModel = m_viewModel.get())
+        {
+            auto args = winrt::make<VectorChangedEventArgs>(CC, index);
+            // Update the flat list first, the selection update notifies the containers it contains.
+            if (m_isInView || m_isViewOrigin)
+            {
+                viewModel->TreeViewNodeVectorChanged(*this, args);
+            }
+            if (m_isInSelectedNodes)
+            {
+                viewModel->SelectedNodeChildrenChanged(*this, args);
+            }
+        }
+    }
 }
 
 winrt::IInspectable TreeViewNode::ItemsSource()
@@ -363,25 +484,23 @@ void TreeViewNodeVector::ReplaceAllCore(winrt::array_view<winrt::TreeViewNode co
 
     auto count = inner->Size();
 
-    if (count > 0)
+    // Clear parent on outgoing
+    for (unsigned int i = 0; i < count; i++)
     {
-        // Clear parent on outgoing
-        for (unsigned int i = 0; i < count; i++)
-        {
-            auto targetNode = inner->GetAt(i);
+        auto targetNode = inner->GetAt(i);
 
-            winrt::get_self<TreeViewNode>(targetNode)->put_ParentImpl(nullptr);
-        }
-
-        // Set parent on new elements
-        MUX_ASSERT(m_parent.get());
-        for (auto& value : values)
-        {
-            winrt::get_self<TreeViewNode>(value)->put_ParentImpl(m_parent.get());
-        }
+        winrt::get_self<TreeViewNode>(targetNode)->put_ParentImpl(nullptr);
+    }
 
-        inner->ReplaceAll(values);
+    // Set parent on new elements
+    MUX_ASSERT(m_parent.get());
+    for (auto& value : values)
+    {
+        winrt::get_self<TreeViewNode>(value)->put_ParentImpl(m_parent.get());
     }
+
+    // A single Reset lets the TreeView splice all of the new children into its flat list at once.
+    inner->AssignRange(values);
 }
 
 void TreeViewNodeVector::ClearCore()
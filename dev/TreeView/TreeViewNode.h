@@ -7,6 +7,8 @@
 #include "TreeViewNode.g.h"
 #include "TreeViewNode.properties.h"
 
+class ViewModel;
+
 class TreeViewNode :
     public ReferenceTracker<TreeViewNode, winrt::implementation::TreeViewNodeT, winrt::Windows::UI::Xaml::Data::ICustomPropertyProvider, winrt::Windows::Foundation::IStringable>,
     public TreeViewNodeProperties
@@ -31,15 +33,12 @@ public:
 
     void ChildVectorChanged(winrt::IObservableVector<winrt::TreeViewNode> const& sender, winrt::IInspectable const& args);
     void OnPropertyChanged(winrt::DependencyPropertyChangedEventArgs const& args);
-    winrt::event_token AddExpandedChanged(winrt::TypedEventHandler<winrt::TreeViewNode, winrt::DependencyPropertyChangedEventArgs> const& value);
-    void RemoveExpandedChanged(winrt::event_token);
-    winrt::event_token ChildrenChanged(winrt::TypedEventHandler<winrt::TreeViewNode, winrt::IVectorChangedEventArgs> const& value);
-    void ChildrenChanged(winrt::event_token);
 
     winrt::IInspectable ItemsSource();
     void ItemsSource(winrt::IInspectable const& value);
     TreeNodeSelectionState SelectionState();
     void SelectionState(TreeNodeSelectionState const& state);
+    TreeNodeSelectionState SelectionStateBasedOnChildren();
 
 // Enable "ToString" on TreeViewNode to show stringable data correctly
 #pragma region ICustomPropertyProvider
@@ -56,8 +55,12 @@ public:
 private:
     // Variables
     winrt::weak_ref<winrt::TreeViewNode> m_parentNode{ nullptr };
-    event_source<winrt::TypedEventHandler<winrt::TreeViewNode, winrt::IVectorChangedEventArgs>> m_childrenChangedSource{ this };
-    event_source<winrt::TypedEventHandler<winrt::TreeViewNode, winrt::DependencyPropertyChangedEventArgs>> m_propertyChangedEventSource{ this };
+    // The ViewModel that shows this node, or has it in its selected nodes, is called directly
+    // when the node changes instead of subscribing to per-node events.
+    winrt::weak_ref<ViewModel> m_viewModel{ nullptr };
+    bool m_isInView{ false };
+    bool m_isViewOrigin{ false };
+    bool m_isInSelectedNodes{ false };
     winrt::ItemsSourceView::CollectionChanged_revoker m_itemItemsSourceViewChangedRevoker{};
     bool m_HasUnrealizedChildren{ false };
     bool m_isExpanded{ false };
@@ -69,7 +72,20 @@ private:
     void OnItemsAdded(int index, int count);
     void OnItemsRemoved(int index, int count);
     bool m_isContentMode{ false };
+    // Number of descendants shown below this node while it is expanded, kept
+    // up to date as children are added/removed and descendants expand/collapse.
+    unsigned int m_expandedDescendantCount{ 0 };
+    unsigned int GetCountInParent();
+    void UpdateExpandedDescendantCount();
+    void OnExpandedDescendantCountChanged(int delta);
     TreeNodeSelectionState m_multiSelectionState{ TreeNodeSelectionState::UnSelected };
+    // How many of our children are (partially) selected, so the tri-state of a node
+    // can be updated without scanning its children.
+    int m_selectedChildCount{ 0 };
+    int m_partialSelectedChildCount{ 0 };
+    void OnChildSelectionStateChanged(TreeNodeSelectionState const& previousState, TreeNodeSelectionState const& newState);
+    void UpdateChildSelectionCounts(TreeNodeSelectionState const& state, int delta);
+    void RefreshChildSelectionCounts();
     hstring GetContentAsString();
 
 public:
@@ -78,6 +94,11 @@ public:
     void put_ParentImpl(winrt::TreeViewNode const& value);
     void UpdateDepth(int depth);
     void UpdateHasChildren();
+    unsigned int ExpandedDescendantCount();
+    void SetViewModel(winrt::weak_ref<ViewModel> const& viewModel);
+    void IsInView(bool value);
+    void IsViewOrigin(bool value);
+    void IsInSelectedNodes(bool value);
     void RaiseChildrenChanged(winrt::CollectionChange CC, unsigned int index);
 };
 
@@ -7,6 +7,11 @@
 #include "TreeViewItem.h"
 #include "VectorChangedEventArgs.h"
 #include "TreeViewList.h"
+#include "SampledPerfTrace.h"
+#include <unordered_set>
+
+// Adding or removing more nodes than this at once raises a single Reset instead of one change per node.
+static constexpr size_t c_minNodeCountForSingleReset = 100;
 
 // Need to update node selection states on UI before vector changes.
 // Listen on vector change events don't solve the problem because the event already happened when the event handler gets called.
@@ -27,6 +32,8 @@ class SelectedTreeNodeVector :
 
 private:
     ViewModel* m_viewModel{ nullptr };
+    // Mirrors the vector content so membership checks don't have to scan it.
+    std::unordered_set<TreeViewNode*> m_nodes;
     void UpdateSelection(winrt::TreeViewNode const& node, TreeNodeSelectionState state)
     {
         if (winrt::get_self<TreeViewNode>(node)->SelectionState() != state)
@@ -98,20 +105,25 @@ public:
 
     bool Contains(winrt::TreeViewNode const& node)
     {
-        uint32_t index;
-        return GetVectorInnerImpl()->IndexOf(node, index);
+        return m_nodes.find(winrt::get_self<TreeViewNode>(node)) != m_nodes.end();
     }
 
     // Default write methods will trigger TreeView visual updates.
     // If you want to update vector content without notifying TreeViewNodes, use "core" version of the methods.
     void AppendCore(winrt::TreeViewNode const& node)
     {
+        m_nodes.insert(winrt::get_self<TreeViewNode>(node));
+        m_viewModel->TrackSelectedNode(node, true);
         GetVectorInnerImpl()->Append(node);
     }
 
     void RemoveAtCore(unsigned int index)
     {
-        GetVectorInnerImpl()->RemoveAt(index);
+        auto inner = GetVectorInnerImpl();
+        auto node = inner->GetAt(index);
+        m_nodes.erase(winrt::get_self<TreeViewNode>(node));
+        m_viewModel->TrackSelectedNode(node, false);
+        inner->RemoveAt(index);
     }
 };
 
@@ -126,15 +138,7 @@ ViewModel::ViewModel()
 
 ViewModel::~ViewModel()
 {
-    if (m_rootNodeChildrenChangedEventToken.value != 0)
-    {
-        if (auto origin = m_originNode.safe_get())
-        {
-            winrt::get_self<TreeViewNode>(origin)->ChildrenChanged(m_rootNodeChildrenChangedEventToken);
-        }
-
-        ClearEventTokenVectors();
-    }
+    // Nothing to unhook, the nodes only hold a weak reference to us.
 }
 
 void ViewModel::ExpandNode(const winrt::TreeViewNode& value)
@@ -196,6 +200,10 @@ bool ViewModel::IndexOf(winrt::IInspectable const& value, uint32_t& index)
     {
         return indexOfFunction(value, index);
     }
+    else if (auto node = value.try_as<winrt::TreeViewNode>())
+    {
+        return IndexOfNode(node, index);
+    }
     else
     {
         auto inner = GetVectorInnerImpl();
@@ -208,13 +216,19 @@ uint32_t ViewModel::GetMany(uint32_t const startIndex, winrt::array_view<winrt::
     auto inner = GetVectorInnerImpl();
     if (IsContentMode())
     {
-        auto vector = winrt::make<Vector<winrt::IInspectable>>();
-        int size = Size();
-        for (int i = 0; i < size; i++)
+        // Only fetch the requested window, the list asks for small chunks as it virtualizes.
+        const uint32_t size = Size();
+        if (startIndex >= size)
+        {
+            return 0;
+        }
+
+        const uint32_t actual = std::min(size - startIndex, static_cast<uint32_t>(values.size()));
+        for (uint32_t i = 0; i < actual; i++)
         {
-            vector.Append(GetNodeAt(i).Content());
+            values[i] = GetNodeAt(startIndex + i).Content();
         }
-        return vector.GetMany(startIndex, values);
+        return actual;
     }
     return inner->GetMany(startIndex, values);
 }
@@ -238,25 +252,19 @@ void ViewModel::SetAt(uint32_t index, winrt::IInspectable const& value)
 
     winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
 
-    auto tvnCurrent = winrt::get_self<TreeViewNode>(current);
-    tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector[index]);
-    tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector[index]);
+    m_nodeIndexes.erase(winrt::get_self<TreeViewNode>(current));
+    InvalidateNodeIndexesFrom(index);
 
-    // Hook up events and replace tokens
-    auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
-    m_collectionChangedEventTokenVector[index] = tvnNewNode->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged });
-    m_IsExpandedChangedEventTokenVector[index] = tvnNewNode->AddExpandedChanged({ this, &ViewModel::TreeViewNodePropertyChanged });
+    TrackNodeInView(current, false);
+    TrackNodeInView(newNode, true);
 }
 
 void ViewModel::InsertAt(uint32_t index, winrt::IInspectable const& value)
 {
     GetVectorInnerImpl()->InsertAt(index, value);
     winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
-
-    //Hook up events and save tokens
-    auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
-    m_collectionChangedEventTokenVector.insert(m_collectionChangedEventTokenVector.begin() + index, tvnNewNode->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged }));
-    m_IsExpandedChangedEventTokenVector.insert(m_IsExpandedChangedEventTokenVector.begin() + index, tvnNewNode->AddExpandedChanged({ this, &ViewModel::TreeViewNodePropertyChanged }));
+    InvalidateNodeIndexesFrom(index);
+    TrackNodeInView(newNode, true);
 }
 
 void ViewModel::RemoveAt(uint32_t index)
@@ -265,25 +273,16 @@ void ViewModel::RemoveAt(uint32_t index)
     auto current = inner->GetAt(index).as<winrt::TreeViewNode>();
     inner->RemoveAt(index);
 
-    // Unhook event handlers
-    auto tvnCurrent = winrt::get_self<TreeViewNode>(current);
-    tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector[index]);
-    tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector[index]);
-
-    // Remove tokens from vectors
-    m_collectionChangedEventTokenVector.erase(m_collectionChangedEventTokenVector.begin() + index);
-    m_IsExpandedChangedEventTokenVector.erase(m_IsExpandedChangedEventTokenVector.begin() + index);
+    m_nodeIndexes.erase(winrt::get_self<TreeViewNode>(current));
+    InvalidateNodeIndexesFrom(index);
+    TrackNodeInView(current, false);
 }
 
 void ViewModel::Append(winrt::IInspectable const& value)
 {
     GetVectorInnerImpl()->Append(value);
     winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
-    
-    // Hook up events and save tokens
-    auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
-    m_collectionChangedEventTokenVector.push_back(tvnNewNode->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged }));
-    m_IsExpandedChangedEventTokenVector.push_back(tvnNewNode->AddExpandedChanged({ this, &ViewModel::TreeViewNodePropertyChanged }));
+    TrackNodeInView(newNode, true);
 }
 
 void ViewModel::RemoveAtEnd()
@@ -292,14 +291,9 @@ void ViewModel::RemoveAtEnd()
     auto current = inner->GetAt(Size() - 1).as<winrt::TreeViewNode>();
     inner->RemoveAtEnd();
 
-    // unhook events
-    auto tvnCurrent = winrt::get_self<TreeViewNode>(current);
-    tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector.back());
-    tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector.back());
-
-    // remove tokens
-    m_collectionChangedEventTokenVector.pop_back();
-    m_IsExpandedChangedEventTokenVector.pop_back();
+    m_nodeIndexes.erase(winrt::get_self<TreeViewNode>(current));
+    InvalidateNodeIndexesFrom(Size());
+    TrackNodeInView(current, false);
 }
 
 void ViewModel::Clear()
@@ -316,6 +310,16 @@ void ViewModel::Clear()
 void ViewModel::ReplaceAll(winrt::array_view<winrt::IInspectable const> items)
 {
     auto inner = GetVectorInnerImpl();
+    for (uint32_t i = 0; i < inner->Size(); i++)
+    {
+        TrackNodeInView(GetNodeAt(i), false);
+    }
+    for (auto const& item : items)
+    {
+        TrackNodeInView(item.as<winrt::TreeViewNode>(), true);
+    }
+    m_nodeIndexes.clear();
+    InvalidateNodeIndexesFrom(0);
     return inner->ReplaceAll(items);
 }
 
@@ -331,24 +335,19 @@ void ViewModel::PrepareView(const winrt::TreeViewNode& originNode)
             RemoveNodeAndDescendantsFromView(removeNode);
         }
 
-        if (m_rootNodeChildrenChangedEventToken.value != 0)
-        {
-            existingOriginNode.Children().as<winrt::IObservableVector<winrt::TreeViewNode>>().VectorChanged(m_rootNodeChildrenChangedEventToken);
-        }
+        winrt::get_self<TreeViewNode>(existingOriginNode)->IsViewOrigin(false);
     }
 
+    m_deferredExpansions.clear();
+
     // Add new RootNode & children
     m_originNode.set(originNode);
-    m_rootNodeChildrenChangedEventToken = winrt::get_self<TreeViewNode>(originNode)->ChildrenChanged({ this, &ViewModel::TreeViewNodeVectorChanged });
+    auto origin = winrt::get_self<TreeViewNode>(originNode);
+    origin->SetViewModel(get_weak());
+    origin->IsViewOrigin(true);
     originNode.IsExpanded(true);
 
-    int allOpenedDescendantsCount = 0;
-    for (unsigned int i = 0; i < originNode.Children().Size(); i++)
-    {
-        auto addNode = originNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-        AddNodeToView(addNode, i + allOpenedDescendantsCount);
-        allOpenedDescendantsCount = AddNodeDescendantsToView(addNode, i, allOpenedDescendantsCount);
-    }
+    AddNodesToView(GetVisibleDescendants(originNode), 0);
 }
 
 void ViewModel::SetOwningList(winrt::TreeViewList const& owningList)
@@ -367,6 +366,56 @@ void ViewModel::AddNodeToView(const winrt::TreeViewNode& value, unsigned int ind
     InsertAt(index, value);
 }
 
+// The descendants of value which are shown when value is expanded, in flat list order.
+std::vector<winrt::IInspectable> ViewModel::GetVisibleDescendants(const winrt::TreeViewNode& value)
+{
+    std::vector<winrt::IInspectable> descendants;
+    descendants.reserve(winrt::get_self<TreeViewNode>(value)->ExpandedDescendantCount());
+    std::function<void(const winrt::TreeViewNode&)> addChildren = [&descendants, &addChildren](const winrt::TreeViewNode& node)
+    {
+        for (auto const& childNode : node.Children())
+        {
+            descendants.push_back(childNode);
+            if (childNode.IsExpanded())
+            {
+                addChildren(childNode);
+            }
+        }
+    };
+    addChildren(value);
+    return descendants;
+}
+
+void ViewModel::AddNodesToView(std::vector<winrt::IInspectable> const& nodes, unsigned int index)
+{
+    if (nodes.size() < c_minNodeCountForSingleReset)
+    {
+        for (unsigned int i = 0; i < nodes.size(); i++)
+        {
+            InsertAt(index + i, nodes[i]);
+        }
+        return;
+    }
+
+    // Splice all nodes in and raise one Reset, so the list doesn't process a change per node.
+    // The list drops its selection on Reset, so remember it and put it back afterwards.
+    auto list = m_TreeViewList.get();
+    winrt::IInspectable selectedItem = list ? list.SelectedItem() : nullptr;
+
+    for (auto const& node : nodes)
+    {
+        TrackNodeInView(node.as<winrt::TreeViewNode>(), true);
+    }
+
+    InvalidateNodeIndexesFrom(index);
+    GetVectorInnerImpl()->InsertRangeAt(index, nodes);
+
+    if (selectedItem && list.SelectedItem() != selectedItem)
+    {
+        list.SelectedItem(selectedItem);
+    }
+}
+
 int ViewModel::AddNodeDescendantsToView(const winrt::TreeViewNode& value, unsigned int index, int offset)
 {
     if (value.IsExpanded())
@@ -410,9 +459,44 @@ void ViewModel::RemoveNodesAndDescendentsWithFlatIndexRange(unsigned int lowInde
 {
     MUX_ASSERT(lowIndex <= highIndex);
 
-    for (int i = static_cast<int>(highIndex); i >= static_cast<int>(lowIndex); i--)
+    // Descendants always follow their node, so the range already holds all of them.
+    RemoveNodesFromView(lowIndex, highIndex - lowIndex + 1);
+}
+
+void ViewModel::RemoveNodesFromView(unsigned int index, unsigned int count)
+{
+    if (count < c_minNodeCountForSingleReset)
     {
-        RemoveNodeAndDescendantsFromView(GetNodeAt(i));
+        for (unsigned int i = index + count; i > index; i--)
+        {
+            RemoveAt(i - 1);
+        }
+        return;
+    }
+
+    // Erase the whole range and raise one Reset, see AddNodesToView.
+    auto list = m_TreeViewList.get();
+    winrt::IInspectable selectedItem = list ? list.SelectedItem() : nullptr;
+    bool isSelectedItemRemoved = false;
+
+    for (unsigned int i = index; i < index + count; i++)
+    {
+        auto node = GetNodeAt(i);
+        TrackNodeInView(node, false);
+        m_nodeIndexes.erase(winrt::get_self<TreeViewNode>(node));
+
+        if (selectedItem && (selectedItem == node || (IsContentMode() && selectedItem == node.Content())))
+        {
+            isSelectedItemRemoved = true;
+        }
+    }
+
+    InvalidateNodeIndexesFrom(index);
+    GetVectorInnerImpl()->RemoveRangeAt(index, count);
+
+    if (selectedItem && !isSelectedItemRemoved && list.SelectedItem() != selectedItem)
+    {
+        list.SelectedItem(selectedItem);
     }
 }
 
@@ -456,19 +540,7 @@ winrt::TreeViewNode ViewModel::GetRemovedChildTreeViewNodeByIndex(winrt::TreeVie
 
 int ViewModel::CountDescendants(const winrt::TreeViewNode& value)
 {
-    int descendantCount = 0;
-    unsigned int size = value.Children().Size();
-    for (unsigned int i = 0; i < size; i++)
-    {
-        auto childNode = value.Children().GetAt(i).as<winrt::TreeViewNode>();
-        descendantCount++;
-        if (childNode.IsExpanded())
-        {
-            descendantCount = descendantCount + CountDescendants(childNode);
-        }
-    }
-
-    return descendantCount;
+    return static_cast<int>(winrt::get_self<TreeViewNode>(value)->ExpandedDescendantCount());
 }
 
 unsigned int ViewModel::IndexOfNextSibling(winrt::TreeViewNode& childNode)
@@ -508,23 +580,12 @@ unsigned int ViewModel::IndexOfNextSibling(winrt::TreeViewNode& childNode)
 
 unsigned int ViewModel::GetExpandedDescendantCount(winrt::TreeViewNode& parentNode)
 {
-    unsigned int allOpenedDescendantsCount = 0;
-    for (unsigned int i = 0; i < parentNode.Children().Size(); i++)
-    {
-        auto childNode = parentNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-        allOpenedDescendantsCount++;
-        if (childNode.IsExpanded())
-        {
-            allOpenedDescendantsCount += CountDescendants(childNode);
-        }
-    }
-    return allOpenedDescendantsCount;
+    return winrt::get_self<TreeViewNode>(parentNode)->ExpandedDescendantCount();
 }
 
 bool ViewModel::IsNodeSelected(winrt::TreeViewNode const& targetNode)
 {
-    unsigned int index;
-    return m_selectedNodes.get().IndexOf(targetNode, index);
+    return winrt::get_self<SelectedTreeNodeVector>(m_selectedNodes.get())->Contains(targetNode);
 }
 
 TreeNodeSelectionState ViewModel::NodeSelectionState(winrt::TreeViewNode const& targetNode)
@@ -543,17 +604,14 @@ void ViewModel::UpdateNodeSelection(winrt::TreeViewNode const& selectNode, TreeN
         {
         case TreeNodeSelectionState::Selected:
             selectedNodes->AppendCore(selectNode);
-            m_selectedNodeChildrenChangedEventTokenVector.push_back(winrt::get_self<TreeViewNode>(selectNode)->ChildrenChanged({ this, &ViewModel::SelectedNodeChildrenChanged }));
             break;
 
         case TreeNodeSelectionState::PartialSelected:
         case TreeNodeSelectionState::UnSelected:
             unsigned int index;
-            if (selectedNodes->IndexOf(selectNode, index))
+            if (selectedNodes->Contains(selectNode) && selectedNodes->IndexOf(selectNode, index))
             {
                 selectedNodes->RemoveAtCore(index);
-                winrt::get_self<TreeViewNode>(selectNode)->ChildrenChanged(m_selectedNodeChildrenChangedEventTokenVector[index]);
-                m_selectedNodeChildrenChangedEventTokenVector.erase(m_selectedNodeChildrenChangedEventTokenVector.begin() + index);
             }
             break;
         }
@@ -565,20 +623,27 @@ void ViewModel::UpdateSelection(winrt::TreeViewNode const& selectNode, TreeNodeS
     if(NodeSelectionState(selectNode) != selectionState)
     {
         UpdateNodeSelection(selectNode, selectionState);
-        UpdateSelectionStateOfDescendants(selectNode, selectionState);
+        UpdateSelectionStateOfDescendants(selectNode, selectionState, selectNode.IsExpanded());
         UpdateSelectionStateOfAncestors(selectNode);
     }
 }
 
-void ViewModel::UpdateSelectionStateOfDescendants(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState)
+void ViewModel::UpdateSelectionStateOfDescendants(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState, bool areChildrenInView)
 {
     if (selectionState == TreeNodeSelectionState::PartialSelected) return;
 
     for (auto const& childNode : targetNode.Children())
     {
+        // A fully (un)selected node already has all of its descendants in that same state.
+        if (NodeSelectionState(childNode) == selectionState) continue;
+
         UpdateNodeSelection(childNode, selectionState);
-        UpdateSelectionStateOfDescendants(childNode, selectionState);
-        NotifyContainerOfSelectionChange(childNode, selectionState);
+        UpdateSelectionStateOfDescendants(childNode, selectionState, areChildrenInView && childNode.IsExpanded());
+        // Nodes under a collapsed node have no container, they pick up their state when they are realized.
+        if (areChildrenInView)
+        {
+            NotifyContainerOfSelectionChange(childNode, selectionState);
+        }
     }
 }
 
@@ -587,7 +652,7 @@ void ViewModel::UpdateSelectionStateOfAncestors(winrt::TreeViewNode const& targe
     if (auto parentNode = targetNode.Parent())
     {
         auto previousState = NodeSelectionState(parentNode);
-        auto selectionState = SelectionStateBasedOnChildren(parentNode);
+        auto selectionState = winrt::get_self<TreeViewNode>(parentNode)->SelectionStateBasedOnChildren();
 
         if (previousState != selectionState)
         {
@@ -598,33 +663,6 @@ void ViewModel::UpdateSelectionStateOfAncestors(winrt::TreeViewNode const& targe
     }
 }
 
-TreeNodeSelectionState ViewModel::SelectionStateBasedOnChildren(winrt::TreeViewNode const& node)
-{
-    bool hasSelectedChildren{ false };
-    bool hasUnSelectedChildren{ false };
-
-    for (auto const& childNode : node.Children())
-    {
-        auto state = NodeSelectionState(childNode);
-        if (state == TreeNodeSelectionState::Selected)
-        {
-            hasSelectedChildren = true;
-        }
-        else if (state == TreeNodeSelectionState::UnSelected)
-        {
-            hasUnSelectedChildren = true;
-        }
-
-        if ((hasSelectedChildren && hasUnSelectedChildren) ||
-            state == TreeNodeSelectionState::PartialSelected)
-        {
-            return TreeNodeSelectionState::PartialSelected;
-        }
-    }
-
-    return hasSelectedChildren ? TreeNodeSelectionState::Selected : TreeNodeSelectionState::UnSelected;
-}
-
 void ViewModel::NotifyContainerOfSelectionChange(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState)
 {
     if (m_TreeViewList)
@@ -642,7 +680,7 @@ winrt::IVector<winrt::TreeViewNode> ViewModel::GetSelectedNodes()
 {
     auto modifiedItems = winrt::get_self<SelectedTreeNodeVector>(m_selectedNodes.get());
     unsigned int index;
-    bool containsRoot = modifiedItems->IndexOf(m_originNode.get(), index);
+    bool containsRoot = modifiedItems->Contains(m_originNode.get()) && modifiedItems->IndexOf(m_originNode.get(), index);
     if (containsRoot)
     {
         modifiedItems->RemoveAtCore(index);
@@ -653,32 +691,119 @@ winrt::IVector<winrt::TreeViewNode> ViewModel::GetSelectedNodes()
 
 bool ViewModel::IndexOfNode(winrt::TreeViewNode const& targetNode, uint32_t& index)
 {
-    return GetVectorInnerImpl()->IndexOf(targetNode, index);
+    if (!targetNode)
+    {
+        return false;
+    }
+
+    auto target = winrt::get_self<TreeViewNode>(targetNode);
+    auto it = m_nodeIndexes.find(target);
+    // An entry can be left over from before the node moved, so make sure the node is still there.
+    if (it != m_nodeIndexes.end() && it->second < m_validNodeIndexCount && GetNodeAt(it->second) == targetNode)
+    {
+        index = it->second;
+        return true;
+    }
+
+    // The node can only be past the up to date entries, index the flat list until we reach it.
+    auto size = Size();
+    while (m_validNodeIndexCount < size)
+    {
+        auto nodeIndex = m_validNodeIndexCount++;
+        auto node = GetNodeAt(nodeIndex);
+        m_nodeIndexes[winrt::get_self<TreeViewNode>(node)] = nodeIndex;
+        if (node == targetNode)
+        {
+            index = nodeIndex;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ViewModel::InvalidateNodeIndexesFrom(uint32_t index)
+{
+    m_validNodeIndexCount = std::min(m_validNodeIndexCount, index);
 }
 
 void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, winrt::IInspectable const& args)
 {
+    SAMPLED_PERF_TRACE_SCOPE("TreeViewViewModel.NodeVectorChanged");
+
     winrt::CollectionChange collectionChange = args.as<winrt::IVectorChangedEventArgs>().CollectionChange();
     unsigned int index = args.as<winrt::IVectorChangedEventArgs>().Index();
 
+    if (m_isInBatchUpdate)
+    {
+        return;
+    }
+
+    auto deferredExpansion = FindDeferredExpansion(sender);
+    if (deferredExpansion && !sender.IsExpanded())
+    {
+        // None of the children are in the flat list, there is nothing to hold back.
+        deferredExpansion->firstPendingChildIndex = sender.Children().Size();
+    }
+    else if (deferredExpansion)
+    {
+        auto& firstPendingChildIndex = deferredExpansion->firstPendingChildIndex;
+        switch (collectionChange)
+        {
+        case (winrt::CollectionChange::ItemInserted):
+            if (index >= firstPendingChildIndex)
+            {
+                // Wait for the deferral to complete, see EndDeferredExpansion.
+                return;
+            }
+            firstPendingChildIndex++;
+            break;
+
+        case (winrt::CollectionChange::ItemRemoved):
+            if (index >= firstPendingChildIndex)
+            {
+                return;
+            }
+            firstPendingChildIndex--;
+            break;
+
+        case (winrt::CollectionChange::ItemChanged):
+            if (index >= firstPendingChildIndex)
+            {
+                return;
+            }
+            break;
+
+        case (winrt::CollectionChange::Reset):
+            // The Reset below puts all of the children in the flat list.
+            firstPendingChildIndex = sender.Children().Size();
+            break;
+        }
+    }
+
+    // Everything below assumes the flat list matches the tree.
+    FlushDeferredExpansions();
+
     switch (collectionChange)
     {
-        // Reset case, commonly seen when a TreeNode is cleared.
-        // removes all nodes that need removing then 
-        // toggles a collapse / expand to ensure order.
+        // Reset case, commonly seen when a TreeNode is cleared or its children are replaced.
+        // removes all nodes that need removing then
+        // adds the current descendants back in one go.
     case (winrt::CollectionChange::Reset):
     {
         auto resetNode = sender.as<winrt::TreeViewNode>();
         if (resetNode.IsExpanded())
         {
-            //The lowIndex is the index of the first child, while the high index is the index of the last descendant in the list.
+            //The lowIndex is the index of the first child, while the stopIndex is the index after the last descendant in the list.
             unsigned int lowIndex = GetNextIndexInFlatTree(resetNode);
-            unsigned int highIndex = IndexOfNextSibling(resetNode) - 1;
-            RemoveNodesAndDescendentsWithFlatIndexRange(lowIndex, highIndex);
+            auto siblingNode = resetNode;
+            unsigned int stopIndex = IndexOfNextSibling(siblingNode);
+            if (stopIndex > lowIndex)
+            {
+                RemoveNodesAndDescendentsWithFlatIndexRange(lowIndex, stopIndex - 1);
+            }
 
-            // reset the status of resetNodes children
-            CollapseNode(resetNode);
-            ExpandNode(resetNode);
+            // Put the new children in with a single splice.
+            AddNodesToView(GetVisibleDescendants(resetNode), lowIndex);
         }
 
         break;
@@ -766,7 +891,10 @@ void ViewModel::SelectedNodeChildrenChanged(winrt::TreeViewNode const& sender, w
     case (winrt::CollectionChange::ItemInserted):
     {
         auto newNode = changingChildrenNode.Children().GetAt(index);
-        UpdateNodeSelection(newNode, NodeSelectionState(changingChildrenNode));
+        auto selectionState = NodeSelectionState(changingChildrenNode);
+        UpdateNodeSelection(newNode, selectionState);
+        // Keep the whole inserted subtree in the parent's state, UpdateSelectionStateOfDescendants relies on it.
+        UpdateSelectionStateOfDescendants(newNode, selectionState, changingChildrenNode.IsExpanded() && newNode.IsExpanded());
         break;
     }
 
@@ -788,7 +916,6 @@ void ViewModel::SelectedNodeChildrenChanged(winrt::TreeViewNode const& sender, w
             if (ancestorNode != m_originNode.get())
             {
                 selectedNodes->RemoveAtCore(i);
-                m_selectedNodeChildrenChangedEventTokenVector.erase(m_selectedNodeChildrenChangedEventTokenVector.begin() + i);
             }
         }
         break;
@@ -819,7 +946,6 @@ void ViewModel::SelectedNodeChildrenChanged(winrt::TreeViewNode const& sender, w
             if (ancestorNode != m_originNode.get())
             {
                 selectedNodes->RemoveAtCore(i);
-                m_selectedNodeChildrenChangedEventTokenVector.erase(m_selectedNodeChildrenChangedEventTokenVector.begin() + i);
             }
         }
         break;
@@ -843,22 +969,23 @@ void ViewModel::TreeViewNodePropertyChanged(winrt::TreeViewNode const& sender, w
 
 void ViewModel::TreeViewNodeIsExpandedPropertyChanged(winrt::TreeViewNode const& sender, winrt::IDependencyPropertyChangedEventArgs const& args)
 {
+    SAMPLED_PERF_TRACE_SCOPE("TreeViewViewModel.IsExpandedChanged");
+
+    if (m_isInBatchUpdate)
+    {
+        return;
+    }
+
+    FlushDeferredExpansions();
+
     auto targetNode = sender.as<winrt::TreeViewNode>();
     if (targetNode.IsExpanded())
     {
         if (targetNode.Children().Size() != 0)
         {
-            int openedDescendantOffset = 0;
             unsigned int index;
             IndexOfNode(targetNode, index);
-            index = index + 1;
-            for (unsigned int i = 0; i < targetNode.Children().Size(); i++)
-            {
-                winrt::TreeViewNode childNode{ nullptr };
-                childNode = targetNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-                AddNodeToView(childNode, index + i + openedDescendantOffset);
-                openedDescendantOffset = AddNodeDescendantsToView(childNode, index + i, openedDescendantOffset);
-            }
+            AddNodesToView(GetVisibleDescendants(targetNode), index + 1);
         }
 
         //Notify TreeView that a node is being expanded.
@@ -866,11 +993,24 @@ void ViewModel::TreeViewNodeIsExpandedPropertyChanged(winrt::TreeViewNode const&
     }
     else
     {
-        for (unsigned int i = 0; i < targetNode.Children().Size(); i++)
+        // The visible descendants of targetNode directly follow it in the flat list
+        unsigned int index;
+        if (IndexOfNode(targetNode, index))
         {
-            winrt::TreeViewNode childNode{ nullptr };
-            childNode = targetNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-            RemoveNodeAndDescendantsFromView(childNode);
+            auto count = static_cast<unsigned int>(GetVisibleDescendants(targetNode).size());
+            if (count > 0)
+            {
+                RemoveNodesFromView(index + 1, count);
+            }
+        }
+        else
+        {
+            for (unsigned int i = 0; i < targetNode.Children().Size(); i++)
+            {
+                winrt::TreeViewNode childNode{ nullptr };
+                childNode = targetNode.Children().GetAt(i).as<winrt::TreeViewNode>();
+                RemoveNodeAndDescendantsFromView(childNode);
+            }
         }
 
         //Notife TreeView that a node is being collapsed
@@ -878,59 +1018,183 @@ void ViewModel::TreeViewNodeIsExpandedPropertyChanged(winrt::TreeViewNode const&
     }
 }
 
-void ViewModel::TreeViewNodeHasChildrenPropertyChanged(winrt::TreeViewNode const& sender, winrt::IDependencyPropertyChangedEventArgs const& args)
+winrt::TreeViewNode ViewModel::OriginNode()
 {
-    if (m_TreeViewList)
+    return m_originNode.get();
+}
+
+void ViewModel::BeginBatchUpdate()
+{
+    FlushDeferredExpansions();
+    m_isInBatchUpdate = true;
+}
+
+void ViewModel::EndBatchUpdate()
+{
+    m_isInBatchUpdate = false;
+
+    auto origin = m_originNode.get();
+    if (!origin)
     {
-        auto targetNode = sender.as<winrt::TreeViewNode>();
-        auto container = winrt::get_self<TreeViewList>(m_TreeViewList.get())->ContainerFromNode(targetNode);
-        if (container)
+        return;
+    }
+
+    // The list drops its selection on Reset, see AddNodesToView.
+    auto list = m_TreeViewList.get();
+    winrt::IInspectable selectedItem = list ? list.SelectedItem() : nullptr;
+
+    auto inner = GetVectorInnerImpl();
+    for (uint32_t i = 0; i < inner->Size(); i++)
+    {
+        TrackNodeInView(GetNodeAt(i), false);
+    }
+
+    auto nodes = GetVisibleDescendants(origin);
+    for (auto const& node : nodes)
+    {
+        TrackNodeInView(node.as<winrt::TreeViewNode>(), true);
+    }
+
+    m_nodeIndexes.clear();
+    InvalidateNodeIndexesFrom(0);
+    inner->AssignRange(nodes);
+
+    for (auto& deferredExpansion : m_deferredExpansions)
+    {
+        if (auto node = deferredExpansion.node.get())
         {
-            winrt::TreeViewItem targetItem = container.as<winrt::TreeViewItem>();
-            targetItem.GlyphOpacity(targetNode.HasChildren() ? 1.0 : 0.0);
+            deferredExpansion.firstPendingChildIndex = node.Children().Size();
         }
     }
+
+    uint32_t selectedIndex;
+    if (selectedItem && list.SelectedItem() != selectedItem && IndexOf(selectedItem, selectedIndex))
+    {
+        list.SelectedItem(selectedItem);
+    }
 }
 
-void ViewModel::IsContentMode(const bool value)
+// While an Expanding handler holds a deferral, children appended to the expanding node are
+// kept out of the flat list and added in one splice when the deferral completes.
+void ViewModel::BeginDeferredExpansion(winrt::TreeViewNode const& node)
 {
-    m_isContentMode = value;
+    if (!FindDeferredExpansion(node))
+    {
+        m_deferredExpansions.push_back({ winrt::make_weak(node), node.Children().Size() });
+    }
 }
 
-bool ViewModel::IsContentMode()
+void ViewModel::EndDeferredExpansion(winrt::TreeViewNode const& node)
 {
-    return m_isContentMode;
+    for (auto it = m_deferredExpansions.begin(); it != m_deferredExpansions.end(); ++it)
+    {
+        if (it->node.get() == node)
+        {
+            FlushDeferredExpansion(*it);
+            m_deferredExpansions.erase(it);
+            break;
+        }
+    }
 }
 
-void ViewModel::ClearEventTokenVectors()
+ViewModel::DeferredExpansion* ViewModel::FindDeferredExpansion(winrt::TreeViewNode const& node)
 {
-    // Remove ChildrenChanged and ExpandedChanged events
-    auto inner = GetVectorInnerImpl();
-    for (uint32_t i =0 ; i < Size(); i++)
+    for (auto& deferredExpansion : m_deferredExpansions)
     {
-        if (auto current = inner->SafeGetAt(i))
+        if (deferredExpansion.node.get() == node)
         {
-            auto tvnCurrent = winrt::get_self<TreeViewNode>(current.as<winrt::TreeViewNode>());
-            tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector.at(i));
-            tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector.at(i));
+            return &deferredExpansion;
         }
     }
+    return nullptr;
+}
+
+void ViewModel::FlushDeferredExpansions()
+{
+    for (auto& deferredExpansion : m_deferredExpansions)
+    {
+        FlushDeferredExpansion(deferredExpansion);
+    }
+}
 
-    // Remove SelectedNodeChildrenChangtedEvent
-    if (auto selectedNodes = m_selectedNodes.safe_get())
+void ViewModel::FlushDeferredExpansion(DeferredExpansion& deferredExpansion)
+{
+    if (auto node = deferredExpansion.node.get())
     {
-        for (uint32_t i = 0; i < selectedNodes.Size(); i++)
+        auto children = node.Children();
+        const unsigned int size = children.Size();
+        // Skip nodes that were removed from the tree in the meantime, their rows are going away.
+        auto ancestorNode = node;
+        while (ancestorNode.Parent())
         {
-            if (auto current = selectedNodes.GetAt(i))
+            ancestorNode = ancestorNode.Parent();
+        }
+
+        unsigned int nodeIndex;
+        if (deferredExpansion.firstPendingChildIndex < size && node.IsExpanded() &&
+            ancestorNode == m_originNode.get() && IndexOfNode(node, nodeIndex))
+        {
+            std::vector<winrt::IInspectable> nodes;
+            for (unsigned int i = deferredExpansion.firstPendingChildIndex; i < size; i++)
             {
-                auto node = winrt::get_self<TreeViewNode>(current.as<winrt::TreeViewNode>());
-                node->ChildrenChanged(m_selectedNodeChildrenChangedEventTokenVector[i]);
+                auto childNode = children.GetAt(i);
+                nodes.push_back(childNode);
+                if (childNode.IsExpanded())
+                {
+                    auto descendants = GetVisibleDescendants(childNode);
+                    nodes.insert(nodes.end(), descendants.begin(), descendants.end());
+                }
             }
+
+            // The pending children go after everything of node that is already in the flat list.
+            auto siblingNode = node;
+            AddNodesToView(nodes, IndexOfNextSibling(siblingNode));
+        }
+        deferredExpansion.firstPendingChildIndex = size;
+    }
+}
+
+void ViewModel::TrackNodeInView(winrt::TreeViewNode const& node, bool isInView)
+{
+    auto tvnNode = winrt::get_self<TreeViewNode>(node);
+    if (isInView)
+    {
+        tvnNode->SetViewModel(get_weak());
+    }
+    tvnNode->IsInView(isInView);
+}
+
+void ViewModel::TrackSelectedNode(winrt::TreeViewNode const& node, bool isSelected)
+{
+    auto tvnNode = winrt::get_self<TreeViewNode>(node);
+    if (isSelected)
+    {
+        tvnNode->SetViewModel(get_weak());
+    }
+    tvnNode->IsInSelectedNodes(isSelected);
+}
+
+void ViewModel::TreeViewNodeHasChildrenPropertyChanged(winrt::TreeViewNode const& sender, winrt::IDependencyPropertyChangedEventArgs const& args)
+{
+    if (m_TreeViewList)
+    {
+        auto targetNode = sender.as<winrt::TreeViewNode>();
+        auto container = winrt::get_self<TreeViewList>(m_TreeViewList.get())->ContainerFromNode(targetNode);
+        if (container)
+        {
+            winrt::TreeViewItem targetItem = container.as<winrt::TreeViewItem>();
+            targetItem.GlyphOpacity(targetNode.HasChildren() ? 1.0 : 0.0);
         }
     }
+}
+
+void ViewModel::IsContentMode(const bool value)
+{
+    m_isContentMode = value;
+}
+
+bool ViewModel::IsContentMode()
+{
+    return m_isContentMode;
+}
 
-    // Clear token vectors
-    m_collectionChangedEventTokenVector.clear();
-    m_IsExpandedChangedEventTokenVector.clear();
-    m_selectedNodeChildrenChangedEventTokenVector.clear();
-}
\ No newline at end of file
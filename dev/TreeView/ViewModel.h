@@ -69,32 +69,59 @@ public:
     void UpdateSelection(winrt::TreeViewNode const& selectNode, TreeNodeSelectionState const& selectionState);
     winrt::IVector<winrt::TreeViewNode> GetSelectedNodes();
     void NotifyContainerOfSelectionChange(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState);
+    winrt::TreeViewNode OriginNode();
+    // Tree changes made between these calls don't update the flat list one by one,
+    // EndBatchUpdate rebuilds it with a single Reset.
+    void BeginBatchUpdate();
+    void EndBatchUpdate();
+    void BeginDeferredExpansion(winrt::TreeViewNode const& node);
+    void EndDeferredExpansion(winrt::TreeViewNode const& node);
+    // Nodes call back into TreeViewNodeVectorChanged/TreeViewNodePropertyChanged/SelectedNodeChildrenChanged
+    // while they are in the flat list or the selected nodes.
+    void TrackSelectedNode(winrt::TreeViewNode const& node, bool isSelected);
 
 private:
+    // An expanding node whose children from firstPendingChildIndex on are not in the flat list yet.
+    struct DeferredExpansion
+    {
+        winrt::weak_ref<winrt::TreeViewNode> node;
+        unsigned int firstPendingChildIndex;
+    };
+
     tracker_ref<winrt::IVector<winrt::TreeViewNode>> m_selectedNodes{ this };
     event_source<winrt::TypedEventHandler<winrt::TreeViewNode, winrt::IInspectable>> m_nodeExpandingEventSource{ this };
     event_source<winrt::TypedEventHandler<winrt::TreeViewNode, winrt::IInspectable>> m_nodeCollapsedEventSource{ this };
-    std::vector<winrt::event_token> m_collectionChangedEventTokenVector;
-    std::vector<winrt::event_token> m_selectedNodeChildrenChangedEventTokenVector;
-    std::vector<winrt::event_token> m_IsExpandedChangedEventTokenVector;
-    winrt::event_token m_rootNodeChildrenChangedEventToken;
     winrt::weak_ref<winrt::TreeViewList> m_TreeViewList{ nullptr };
     tracker_ref<winrt::TreeViewNode> m_originNode{ this };
     bool m_isContentMode{ false };
 
+    // Flat list index of the nodes in the view. Entries below m_validNodeIndexCount are up to date,
+    // the rest are filled in again by IndexOfNode when a lookup reaches them.
+    std::unordered_map<TreeViewNode*, uint32_t> m_nodeIndexes;
+    uint32_t m_validNodeIndexCount{ 0 };
+
+    std::vector<DeferredExpansion> m_deferredExpansions;
+    bool m_isInBatchUpdate{ false };
+
     // Methods
+    void InvalidateNodeIndexesFrom(uint32_t index);
     winrt::TreeViewNode GetRemovedChildTreeViewNodeByIndex(winrt::TreeViewNode const& node, unsigned int childIndex);
     int CountDescendants(const winrt::TreeViewNode& value);
     void AddNodeToView(const winrt::TreeViewNode& value, unsigned int index);
+    std::vector<winrt::IInspectable> GetVisibleDescendants(const winrt::TreeViewNode& value);
+    void AddNodesToView(std::vector<winrt::IInspectable> const& nodes, unsigned int index);
     int AddNodeDescendantsToView(const winrt::TreeViewNode& value, unsigned int index, int offset);
     void RemoveNodeAndDescendantsFromView(const winrt::TreeViewNode& value);
     void RemoveNodesAndDescendentsWithFlatIndexRange(unsigned int startIndex, unsigned int stopIndex);
+    void RemoveNodesFromView(unsigned int index, unsigned int count);
     int GetNextIndexInFlatTree(const winrt::TreeViewNode& indexNode);
     unsigned int IndexOfNextSibling(winrt::TreeViewNode& childNode);
     unsigned int GetExpandedDescendantCount(winrt::TreeViewNode& parentNode);
     void UpdateNodeSelection(winrt::TreeViewNode const& selectNode, TreeNodeSelectionState const& selectionState);
-    void UpdateSelectionStateOfDescendants(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState);
+    void UpdateSelectionStateOfDescendants(winrt::TreeViewNode const& targetNode, TreeNodeSelectionState const& selectionState, bool areChildrenInView);
     void UpdateSelectionStateOfAncestors(winrt::TreeViewNode const& targetNode);
-    TreeNodeSelectionState SelectionStateBasedOnChildren(winrt::TreeViewNode const& node);
-    void ClearEventTokenVectors();
+    DeferredExpansion* FindDeferredExpansion(winrt::TreeViewNode const& node);
+    void FlushDeferredExpansions();
+    void FlushDeferredExpansion(DeferredExpansion& deferredExpansion);
+    void TrackNodeInView(winrt::TreeViewNode const& node, bool isInView);
 };
@@ -21,21 +21,45 @@ DisplayRegionHelperInfo DisplayRegionHelper::GetRegionInfo()
 {
     auto instance = LifetimeHandler::GetDisplayRegionHelperInstance();
 
+    if (!instance->m_isRegionInfoValid)
+    {
+        instance->m_regionInfo = instance->ComputeRegionInfo();
+        instance->m_isRegionInfoValid = true;
+
+        if (!instance->m_windowSizeChangedRevoker)
+        {
+            if (auto window = winrt::Window::Current())
+            {
+                instance->m_windowSizeChangedRevoker = window.SizeChanged(winrt::auto_revoke, { instance.get(), &DisplayRegionHelper::OnWindowSizeChanged });
+            }
+        }
+    }
+
+    return instance->m_regionInfo;
+}
+
+void DisplayRegionHelper::OnWindowSizeChanged(const winrt::IInspectable& /*sender*/, const winrt::WindowSizeChangedEventArgs& /*args*/)
+{
+    m_isRegionInfoValid = false;
+}
+
+DisplayRegionHelperInfo DisplayRegionHelper::ComputeRegionInfo()
+{
     DisplayRegionHelperInfo info;
     info.RegionCount = 1;
     info.Mode = winrt::TwoPaneViewMode::SinglePane;
 
-    if (instance->m_simulateDisplayRegions)
+    if (m_simulateDisplayRegions)
     {
         // Create fake rectangles for test app
-        if (instance->m_simulateMode == winrt::TwoPaneViewMode::Wide)
+        if (m_simulateMode == winrt::TwoPaneViewMode::Wide)
         {
             info.RegionCount = 2;
             info.Regions[0] = m_simulateWide0;
             info.Regions[1] = m_simulateWide1;
             info.Mode = winrt::TwoPaneViewMode::Wide;
         }
-        else if (instance->m_simulateMode == winrt::TwoPaneViewMode::Tall)
+        else if (m_simulateMode == winrt::TwoPaneViewMode::Tall)
         {
             info.RegionCount = 2;
             info.Regions[0] = m_simulateTall0;
@@ -140,6 +164,7 @@ void DisplayRegionHelper::SimulateDisplayRegions(bool value)
 {
     auto instance = LifetimeHandler::GetDisplayRegionHelperInstance();
     instance->m_simulateDisplayRegions = value;
+    instance->m_isRegionInfoValid = false;
 }
 
 /* static */
@@ -154,6 +179,7 @@ void DisplayRegionHelper::SimulateMode(winrt::TwoPaneViewMode value)
 {
     auto instance = LifetimeHandler::GetDisplayRegionHelperInstance();
     instance->m_simulateMode = value;
+    instance->m_isRegionInfoValid = false;
 }
 
 /* static */
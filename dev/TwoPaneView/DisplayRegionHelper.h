@@ -31,8 +31,14 @@ public:
     static winrt::TwoPaneViewMode SimulateMode();
 
 private:
-
-    void OnDisplayModeChanged(const winrt::IInspectable& sender, const winrt::IInspectable& args);
+    DisplayRegionHelperInfo ComputeRegionInfo();
+    void OnWindowSizeChanged(const winrt::IInspectable& sender, const winrt::WindowSizeChangedEventArgs& args);
+
+    // Region info only changes with the window bounds (spanning, rotation, resizing) or the simulation settings,
+    // so it is shared between all TwoPaneViews on the thread until one of those changes.
+    DisplayRegionHelperInfo m_regionInfo{};
+    bool m_isRegionInfoValid{ false };
+    winrt::IWindow::SizeChanged_revoker m_windowSizeChangedRevoker{};
 
     bool m_simulateDisplayRegions{ false };
     winrt::TwoPaneViewMode m_simulateMode{ winrt::TwoPaneViewMode::SinglePane };
@@ -6,6 +6,7 @@
 #include "TwoPaneView.h"
 #include "DisplayRegionHelperTestApi.h"
 #include "RuntimeProfiler.h"
+#include "StartupTrace.h"
 
 static constexpr auto c_pane1ScrollViewerName = L"PART_Pane1ScrollViewer";
 static constexpr auto c_pane2ScrollViewerName = L"PART_Pane2ScrollViewer";
@@ -19,6 +20,11 @@ static constexpr auto c_rowBottomName    = L"PART_RowBottom"sv;
 
 using namespace std;
 
+static bool AreGridLengthsEqual(const winrt::GridLength& first, const winrt::GridLength& second)
+{
+    return first.GridUnitType == second.GridUnitType && first.Value == second.Value;
+}
+
 TwoPaneView::~TwoPaneView()
 {
 }
@@ -36,7 +42,10 @@ TwoPaneView::TwoPaneView()
 
 void TwoPaneView::OnApplyTemplate()
 {
+    STARTUP_TRACE_FIRST_TEMPLATE_SCOPE(L"TwoPaneView");
+
     m_loaded = true;
+    m_areRowsColumnsValid = false;
 
     winrt::IControlProtected controlProtected = *this;
 
@@ -120,8 +129,15 @@ void TwoPaneView::UpdateMode()
 
     // Calculate new mode
     DisplayRegionHelperInfo info = DisplayRegionHelper::GetRegionInfo();
-    winrt::Rect rcControl = GetControlRect();
-    bool isInMultipleRegions = IsInMultipleRegions(info, rcControl);
+
+    // Where the control sits in the window only matters when there is more than one region to straddle.
+    winrt::Rect rcControl{};
+    bool isInMultipleRegions = false;
+    if (info.Mode != winrt::TwoPaneViewMode::SinglePane)
+    {
+        rcControl = GetControlRect();
+        isInMultipleRegions = IsInMultipleRegions(info, rcControl);
+    }
     
     if (isInMultipleRegions)
     {
@@ -158,7 +174,7 @@ void TwoPaneView::UpdateMode()
     }
 
     // Update row/column sizes (this may need to happen even if the mode doesn't change)
-    UpdateRowsColumns(newMode, info, rcControl);
+    UpdateRowsColumns(newMode, info, rcControl, isInMultipleRegions);
 
     // Update mode if necessary
     if (newMode != m_currentMode)
@@ -185,10 +201,31 @@ void TwoPaneView::UpdateMode()
     }
 }
 
-void TwoPaneView::UpdateRowsColumns(ViewMode newMode, DisplayRegionHelperInfo info, winrt::Rect rcControl)
+void TwoPaneView::UpdateRowsColumns(ViewMode newMode, const DisplayRegionHelperInfo& info, winrt::Rect rcControl, bool isInMultipleRegions)
 {
     if (m_columnLeft && m_columnMiddle && m_columnRight && m_rowTop && m_rowMiddle && m_rowBottom)
     {
+        const bool isSplitAcrossRegions = isInMultipleRegions && newMode != ViewMode::Pane1Only && newMode != ViewMode::Pane2Only;
+        const auto pane1Length = Pane1Length();
+        const auto pane2Length = Pane2Length();
+
+        // Outside of regions the lengths only depend on the mode and the pane lengths, so a resize that
+        // keeps both doesn't need to touch the definitions. Split lengths follow the control's position.
+        if (!isSplitAcrossRegions &&
+            m_areRowsColumnsValid &&
+            newMode == m_rowsColumnsMode &&
+            AreGridLengthsEqual(pane1Length, m_rowsColumnsPane1Length) &&
+            AreGridLengthsEqual(pane2Length, m_rowsColumnsPane2Length))
+        {
+            return;
+        }
+
+        // Lengths set for a split depend on rcControl and aren't cached.
+        m_areRowsColumnsValid = !isSplitAcrossRegions;
+        m_rowsColumnsMode = newMode;
+        m_rowsColumnsPane1Length = pane1Length;
+        m_rowsColumnsPane2Length = pane2Length;
+
         // Reset split lengths
         m_columnMiddle.get().Width({ 0, winrt::GridUnitType::Pixel });
         m_rowMiddle.get().Height({ 0, winrt::GridUnitType::Pixel });
@@ -196,8 +233,8 @@ void TwoPaneView::UpdateRowsColumns(ViewMode newMode, DisplayRegionHelperInfo in
         // Set columns lengths
         if (newMode == ViewMode::LeftRight || newMode == ViewMode::RightLeft)
         {
-            m_columnLeft.get().Width((newMode == ViewMode::LeftRight) ? Pane1Length() : Pane2Length());
-            m_columnRight.get().Width((newMode == ViewMode::LeftRight) ? Pane2Length() : Pane1Length());
+            m_columnLeft.get().Width((newMode == ViewMode::LeftRight) ? pane1Length : pane2Length);
+            m_columnRight.get().Width((newMode == ViewMode::LeftRight) ? pane2Length : pane1Length);
         }
         else
         {
@@ -208,8 +245,8 @@ void TwoPaneView::UpdateRowsColumns(ViewMode newMode, DisplayRegionHelperInfo in
         // Set row lengths
         if (newMode == ViewMode::TopBottom || newMode == ViewMode::BottomTop)
         {
-            m_rowTop.get().Height((newMode == ViewMode::TopBottom) ? Pane1Length() : Pane2Length());
-            m_rowBottom.get().Height((newMode == ViewMode::TopBottom) ? Pane2Length() : Pane1Length());
+            m_rowTop.get().Height((newMode == ViewMode::TopBottom) ? pane1Length : pane2Length);
+            m_rowBottom.get().Height((newMode == ViewMode::TopBottom) ? pane2Length : pane1Length);
         }
         else
         {
@@ -218,7 +255,7 @@ void TwoPaneView::UpdateRowsColumns(ViewMode newMode, DisplayRegionHelperInfo in
         }
 
         // Handle regions
-        if (IsInMultipleRegions(info, rcControl) && newMode != ViewMode::Pane1Only && newMode != ViewMode::Pane2Only)
+        if (isSplitAcrossRegions)
         {
             winrt::Rect rc1 = info.Regions[0];
             winrt::Rect rc2 = info.Regions[1];
@@ -249,7 +286,7 @@ winrt::Rect TwoPaneView::GetControlRect()
     return transform.TransformBounds({ 0, 0, (float)ActualWidth(), (float)ActualHeight() });
 }
 
-bool TwoPaneView::IsInMultipleRegions(DisplayRegionHelperInfo info, winrt::Rect rcControl)
+bool TwoPaneView::IsInMultipleRegions(const DisplayRegionHelperInfo& info, winrt::Rect rcControl)
 {
     bool isInMultipleRegions = false;
 
@@ -45,14 +45,20 @@ private:
 
     void OnSizeChanged(const winrt::IInspectable& sender, const winrt::SizeChangedEventArgs& args);
 
-    void UpdateRowsColumns(ViewMode newMode, DisplayRegionHelperInfo info, winrt::Rect rcControl);
+    void UpdateRowsColumns(ViewMode newMode, const DisplayRegionHelperInfo& info, winrt::Rect rcControl, bool isInMultipleRegions);
     void UpdateMode();
 
     winrt::Rect GetControlRect();
-    bool IsInMultipleRegions(DisplayRegionHelperInfo info, winrt::Rect rcControl);
+    bool IsInMultipleRegions(const DisplayRegionHelperInfo& info, winrt::Rect rcControl);
 
     ViewMode m_currentMode { ViewMode::None } ;
 
+    // What the rows and columns were last laid out for, so that resizing within one mode doesn't rewrite them.
+    bool m_areRowsColumnsValid{ false };
+    ViewMode m_rowsColumnsMode{ ViewMode::None };
+    winrt::GridLength m_rowsColumnsPane1Length{};
+    winrt::GridLength m_rowsColumnsPane2Length{};
+
     bool m_loaded { false };
 
     winrt::Control::Loaded_revoker m_pane1LoadedRevoker{};
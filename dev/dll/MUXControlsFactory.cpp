@@ -7,6 +7,7 @@
 #include "MUXControlsFactory.h"
 #include "ThemeResourcesFactory.h"
 #include "RevealBrush.h"
+#include "StartupTrace.h"
 
 bool MUXControlsFactory::s_initialized{ false };
 
@@ -14,6 +15,8 @@ void MUXControlsFactory::EnsureInitialized()
 {
     if (!s_initialized)
     {
+        StartupTraceScope startupTraceScope{ "FactoryInitialization" };
+
         // Need to register here the DPs of types which are not referenced in our XAML but whose attached properties are.
         if (SharedHelpers::IsXamlCompositionBrushBaseAvailable())
         {
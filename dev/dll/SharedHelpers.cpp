@@ -155,6 +155,15 @@ bool SharedHelpers::IsScrollContentPresenterSizesContentToTemplatedParentAvailab
     return s_isScrollContentPresenterSizesContentToTemplatedParentAvailable;
 }
 
+bool SharedHelpers::IsBitmapIconShowAsMonochromeAvailable()
+{
+    static bool s_isBitmapIconShowAsMonochromeAvailable =
+        IsSystemDll() ||
+        IsRS4OrHigher() ||
+        winrt::ApiInformation::IsPropertyPresent(L"Windows.UI.Xaml.Controls.BitmapIcon", L"ShowAsMonochrome");
+    return s_isBitmapIconShowAsMonochromeAvailable;
+}
+
 bool SharedHelpers::IsFrameworkElementInvalidateViewportAvailable()
 {
     static bool s_isFrameworkElementInvalidateViewportAvailable = IsSystemDll() || IsRS5OrHigher();
@@ -221,20 +230,31 @@ bool SharedHelpers::IsThemeShadowAvailable()
     return s_isThemeShadowAvailable;
 }
 
-template <uint16_t APIVersion> bool SharedHelpers::IsAPIContractVxAvailable()
+// UniversalApiContract versions are cumulative, so the highest one present answers every IsAPIContractVxAvailable.
+// Probing from the newest version we know about down usually takes a single metadata query.
+uint16_t SharedHelpers::GetUniversalApiContractVersion()
 {
-    static bool isAPIContractVxAvailableInitialized = false;
-    static bool isAPIContractVxAvailable = false;
-    if (!isAPIContractVxAvailableInitialized)
+    static const uint16_t s_version = []()
     {
-        isAPIContractVxAvailableInitialized = true;
-        isAPIContractVxAvailable =
-            IsSystemDll() ?
-            true :
-            winrt::ApiInformation::IsApiContractPresent(L"Windows.Foundation.UniversalApiContract", APIVersion);
-    }
+        if (IsSystemDll())
+        {
+            return static_cast<uint16_t>(UINT16_MAX);
+        }
 
-    return isAPIContractVxAvailable;
+        uint16_t version = c_highestKnownApiContractVersion;
+        while (version > 2 && !winrt::ApiInformation::IsApiContractPresent(L"Windows.Foundation.UniversalApiContract", version))
+        {
+            version--;
+        }
+        return version;
+    }();
+    return s_version;
+}
+
+template <uint16_t APIVersion> bool SharedHelpers::IsAPIContractVxAvailable()
+{
+    static_assert(APIVersion <= c_highestKnownApiContractVersion, "Raise c_highestKnownApiContractVersion");
+    return GetUniversalApiContractVersion() >= APIVersion;
 }
 
 // base helpers
@@ -521,6 +541,10 @@ bool SharedHelpers::IsAncestor(
     return false;
 }
 
+// Menus and swipe rows can create thousands of icons from the same few sources. The Geometry of a PathIcon and
+// the image behind a BitmapIcon's Uri are already shared by the framework, so the work left per icon is the
+// element itself and its property values. Values that are the same as the new element's defaults are skipped:
+// every local value set costs a property store entry and a change notification.
 winrt::IconElement SharedHelpers::MakeIconElementFrom(winrt::IconSource const& iconSource)
 {
     if (auto fontIconSource = iconSource.try_as<winrt::FontIconSource>())
@@ -528,17 +552,41 @@ winrt::IconElement SharedHelpers::MakeIconElementFrom(winrt::IconSource const& i
         winrt::FontIcon fontIcon;
 
         fontIcon.Glyph(fontIconSource.Glyph());
-        fontIcon.FontSize(fontIconSource.FontSize());
 
-        if (fontIconSource.FontFamily())
+        // FontIconSource and FontIcon share their defaults.
+        static constexpr double c_defaultIconFontSize = 20.0;
+        const double fontSize = fontIconSource.FontSize();
+        if (fontSize != c_defaultIconFontSize)
+        {
+            fontIcon.FontSize(fontSize);
+        }
+
+        if (auto fontFamily = fontIconSource.FontFamily())
         {
-            fontIcon.FontFamily(fontIconSource.FontFamily());
+            fontIcon.FontFamily(fontFamily);
         }
 
-        fontIcon.FontWeight(fontIconSource.FontWeight());
-        fontIcon.FontStyle(fontIconSource.FontStyle());
-        fontIcon.IsTextScaleFactorEnabled(fontIconSource.IsTextScaleFactorEnabled());
-        fontIcon.MirroredWhenRightToLeft(fontIconSource.MirroredWhenRightToLeft());
+        const winrt::FontWeight fontWeight = fontIconSource.FontWeight();
+        if (fontWeight.Weight != winrt::FontWeights::Normal().Weight)
+        {
+            fontIcon.FontWeight(fontWeight);
+        }
+
+        const winrt::FontStyle fontStyle = fontIconSource.FontStyle();
+        if (fontStyle != winrt::FontStyle::Normal)
+        {
+            fontIcon.FontStyle(fontStyle);
+        }
+
+        if (!fontIconSource.IsTextScaleFactorEnabled())
+        {
+            fontIcon.IsTextScaleFactorEnabled(false);
+        }
+
+        if (fontIconSource.MirroredWhenRightToLeft())
+        {
+            fontIcon.MirroredWhenRightToLeft(true);
+        }
 
         return fontIcon;
     }
@@ -553,14 +601,14 @@ winrt::IconElement SharedHelpers::MakeIconElementFrom(winrt::IconSource const& i
     {
         winrt::BitmapIcon bitmapIcon;
 
-        if (bitmapIconSource.UriSource())
+        if (auto uriSource = bitmapIconSource.UriSource())
         {
-            bitmapIcon.UriSource(bitmapIconSource.UriSource());
+            bitmapIcon.UriSource(uriSource);
         }
 
-        if (SharedHelpers::IsSystemDll() || winrt::ApiInformation::IsPropertyPresent(L"Windows.UI.Xaml.Controls.BitmapIcon", L"ShowAsMonochrome"))
+        if (SharedHelpers::IsBitmapIconShowAsMonochromeAvailable() && !bitmapIconSource.ShowAsMonochrome())
         {
-            bitmapIcon.ShowAsMonochrome(bitmapIconSource.ShowAsMonochrome());
+            bitmapIcon.ShowAsMonochrome(false);
         }
 
         return bitmapIcon;
@@ -569,9 +617,9 @@ winrt::IconElement SharedHelpers::MakeIconElementFrom(winrt::IconSource const& i
     {
         winrt::PathIcon pathIcon;
 
-        if (pathIconSource.Data())
+        if (auto data = pathIconSource.Data())
         {
-            pathIcon.Data(pathIconSource.Data());
+            pathIcon.Data(data);
         }
 
         return pathIcon;
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "common.h"
 #include "ThemeResources.h"
+#include "StartupTrace.h"
 
 #ifndef BUILD_WINDOWS
 #include "MUXControlsFactory.h"
@@ -87,10 +88,114 @@ ThemeResources::ThemeResources()
         }()
     };
 
-    Source(uri);
+    // Every XamlControlsResources on a thread (one per window or island root, typically) merges the same
+    // parsed dictionary rather than parsing its own. ms-appx resolves the Uri to the .xbf that the build
+    // compiles from the merged XAML, so this is the binary load path already.
+    thread_local winrt::weak_ref<winrt::ResourceDictionary> s_sharedThemeResources;
+    auto themeResources = s_sharedThemeResources.get();
+    if (!themeResources)
+    {
+        winrt::hstring rawUri{ IsStartupPerfTracingEnabled() ? uri.RawUri() : winrt::hstring{} };
+        StartupTraceScope startupTraceScope{ "ThemeResourcesLoad", rawUri.c_str() };
+
+        themeResources = winrt::ResourceDictionary{};
+        themeResources.Source(uri);
+        s_sharedThemeResources = winrt::make_weak(themeResources);
+    }
+
+    MergedDictionaries().Append(themeResources);
 #endif
 }
 
+#ifndef BUILD_WINDOWS
+namespace
+{
+    // Controls whose theme resources have OnDemandFor metadata in their .vcxitems file, keyed by the
+    // class name without its namespace. Keep the two in sync.
+    struct OnDemandThemeResources
+    {
+        std::wstring_view className;
+        PCWSTR frameworkPackageUri;
+        PCWSTR appPackageUri;
+    };
+
+    constexpr OnDemandThemeResources c_onDemandThemeResources[] =
+    {
+        { L"ColorPicker"sv,
+            L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/ColorPicker_themeresources.xaml",
+            L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/ColorPicker_themeresources.xaml" },
+        { L"ColorSpectrum"sv,
+            L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/ColorPicker_themeresources.xaml",
+            L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/ColorPicker_themeresources.xaml" },
+        { L"TreeView"sv,
+            L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/TreeView_themeresources.xaml",
+            L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/TreeView_themeresources.xaml" },
+        { L"TreeViewItem"sv,
+            L"ms-appx://" MUXCONTROLS_PACKAGE_NAME "/" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/TreeView_themeresources.xaml",
+            L"ms-appx:///" MUXCONTROLSROOT_NAMESPACE_STR "/Themes/TreeView_themeresources.xaml" },
+    };
+
+    winrt::ResourceDictionary FindXamlControlsResources(winrt::ResourceDictionary const& dictionary)
+    {
+        for (auto const& merged : dictionary.MergedDictionaries())
+        {
+            if (merged.try_as<winrt::XamlControlsResources>())
+            {
+                return merged;
+            }
+        }
+        return nullptr;
+    }
+}
+
+void ThemeResources::EnsureOnDemandThemeResources(std::wstring_view const& className)
+{
+    // Older versions still get every control's theme resources from their monolithic dictionary.
+    if (!SharedHelpers::Is19H1OrHigher())
+    {
+        return;
+    }
+
+    auto const shortName = className.substr(className.rfind(L'.') + 1);
+    auto const entry = std::find_if(std::begin(c_onDemandThemeResources), std::end(c_onDemandThemeResources),
+        [&shortName](auto const& candidate) { return candidate.className == shortName; });
+
+    if (entry == std::end(c_onDemandThemeResources))
+    {
+        return;
+    }
+
+    // Resources are per thread like the rest of XAML, so is the record of what has been merged.
+    // Controls sharing a dictionary share its record since they point at the same Uri.
+    thread_local std::vector<PCWSTR> s_mergedUris;
+    PCWSTR uri = SharedHelpers::IsInFrameworkPackage() ? entry->frameworkPackageUri : entry->appPackageUri;
+
+    if (std::find_if(s_mergedUris.begin(), s_mergedUris.end(), [uri](PCWSTR merged) { return wcscmp(merged, uri) == 0; }) != s_mergedUris.end())
+    {
+        return;
+    }
+
+    if (auto application = winrt::Application::Current())
+    {
+        StartupTraceScope startupTraceScope{ "ThemeResourcesLoad", uri };
+
+        // Merge next to the rest of our theme resources so that lookups resolve the same way. Apps that put
+        // XamlControlsResources somewhere other than Application.Resources get them at the application level.
+        auto const applicationResources = application.Resources();
+        auto target = FindXamlControlsResources(applicationResources);
+        if (!target)
+        {
+            target = applicationResources;
+        }
+
+        winrt::ResourceDictionary dictionary;
+        dictionary.Source(winrt::Uri{ uri });
+        target.MergedDictionaries().Append(dictionary);
+        s_mergedUris.push_back(uri);
+    }
+}
+#endif
+
 void SetDefaultStyleKeyWorker(winrt::IControlProtected const& controlProtected, std::wstring_view const& className) 
 {
     if (SharedHelpers::IsRS2OrHigher() || SharedHelpers::IsInDesignMode())
@@ -123,6 +228,8 @@ void SetDefaultStyleKeyWorker(winrt::IControlProtected const& controlProtected,
     }
 
 #ifndef BUILD_WINDOWS
+    ThemeResources::EnsureOnDemandThemeResources(className);
+
     if (auto control5 = controlProtected.try_as<winrt::IControl5>())
     {
         winrt::Uri uri{
@@ -12,4 +12,7 @@ public:
     ThemeResources();
 
     static void EnsureRevealLights(winrt::UIElement const& element);
+
+    // Merges the theme resources that were split out of 19h1_themeresources.xaml for this control, if any.
+    static void EnsureOnDemandThemeResources(std::wstring_view const& className);
 };
\ No newline at end of file
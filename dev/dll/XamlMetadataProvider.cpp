@@ -5,16 +5,18 @@
 #include "common.h"
 #include "XamlMetadataProvider.h"
 #include "XamlType.h"
+#include "StartupTrace.h"
 
 #ifndef BUILD_WINDOWS
 #include "MUXControlsFactory.h"
 #endif
 
-std::vector<XamlMetadataProvider::Entry>* XamlMetadataProvider::s_types{ nullptr };
+std::unordered_map<wstring_view, XamlMetadataProvider::Entry>* XamlMetadataProvider::s_types{ nullptr };
 
 XamlMetadataProvider::XamlMetadataProvider()
 {
 #ifndef BUILD_WINDOWS
+    StartupTraceScope startupTraceScope{ "MetadataProviderRegistration" };
     RegisterTypes();
 #endif
 }
@@ -33,12 +35,14 @@ bool XamlMetadataProvider::RegisterXamlType(
 {
     if (!s_types)
     {
-        s_types = new std::vector<Entry>();
+        s_types = new std::unordered_map<wstring_view, Entry>();
     }
 
     Entry type{ typeName, createXamlTypeCallback };
+    wstring_view key{ type.typeName };
 
-    s_types->push_back(type);
+    // If a name is registered twice, the first registration wins.
+    s_types->try_emplace(key, std::move(type));
     return true;
 }
 
@@ -47,16 +51,15 @@ winrt::IXamlType XamlMetadataProvider::GetXamlType(
 {
     if (s_types)
     {
-        for (auto& entry : *s_types)
+        auto it = s_types->find(typeName);
+        if (it != s_types->end())
         {
-            if (typeName == entry.typeName)
+            auto& entry = it->second;
+            if (!entry.xamlType)
             {
-                if (!entry.xamlType)
-                {
-                    entry.xamlType = entry.createXamlTypeCallback();
-                }
-                return entry.xamlType;
+                entry.xamlType = entry.createXamlTypeCallback();
             }
+            return entry.xamlType;
         }
     }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <unordered_map>
 #include "XamlType.h"
 #include "XamlMetadataProviderGenerated.h"
 
@@ -64,5 +65,6 @@ private:
 
     // Defined as raw pointer so it doesn't have an initializer, this way we can control when it's initialized relative to other globals.
     // TODO: will clean this up with MSFT:9427272 - Codegen the IXamlMetadataProvider stuff
-    static std::vector<Entry>* s_types;
+    // Keyed by a view of the entry's own typeName, the hstring buffer stays put when the entry is moved into the map.
+    static std::unordered_map<wstring_view, Entry>* s_types;
 };
@@ -122,12 +122,10 @@ winrt::IXamlMember XamlTypeBase::GetMember(winrt::hstring const& name)
 {
     EnsureProperties();
 
-    for (auto& member : m_members)
+    auto it = m_members.find(name);
+    if (it != m_members.end())
     {
-        if (member.Name() == name)
-        {
-            return member;
-        }
+        return it->second;
     }
 
     return nullptr;
@@ -174,7 +172,7 @@ void XamlTypeBase::AddMember(
             isDependencyProperty,
             isAttachable);
 
-    m_members.push_back(member);
+    m_members.try_emplace(hstring{ name }, member);
     if (isContent)
     {
         MUX_ASSERT(!m_contentProperty);
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 class XamlTypeBase :
     public winrt::implements<XamlTypeBase, winrt::IXamlType>
 {
@@ -57,7 +59,8 @@ protected:
     std::function<void(winrt::IInspectable const&, winrt::IInspectable const&, winrt::IInspectable const&)> m_addToMap;
 
     winrt::IXamlMember m_contentProperty;
-    std::vector<winrt::IXamlMember> m_members;
+    // Keyed by member name so GetMember doesn't have to ask every member for its Name.
+    std::unordered_map<hstring, winrt::IXamlMember> m_members;
 
     bool m_isSystemType = false;
 };
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "common.h"
 #include "TraceLogging.h"
+#include "StartupTrace.h"
 #include <initguid.h>
 #include <wrl\module.h>
 
@@ -23,6 +24,9 @@ STDAPI_(BOOL) DllMain(_In_ HINSTANCE hInstance, _In_ DWORD reason, _In_opt_ void
 {
     if (DLL_PROCESS_ATTACH == reason)
     {
+        LARGE_INTEGER attachStartCounter{};
+        QueryPerformanceCounter(&attachStartCounter);
+
     #if defined(DBG) && defined(BUILD_WINDOWS)
         // Initialize the debug allocator.
         InitCheckedMemoryChainLock();
@@ -31,6 +35,12 @@ STDAPI_(BOOL) DllMain(_In_ HINSTANCE hInstance, _In_ DWORD reason, _In_opt_ void
         g_hInstance = hInstance;
         DisableThreadLibraryCalls(hInstance);
         RegisterTraceLogging();
+
+        // Tracing is only registered at this point so there is no start event for the attach.
+        if (IsStartupPerfTracingEnabled())
+        {
+            StartupTraceScope::TraceStopped("DllAttach", L"", attachStartCounter);
+        }
     }
     else if (DLL_PROCESS_DETACH == reason)
     {
@@ -42,6 +52,7 @@ STDAPI_(BOOL) DllMain(_In_ HINSTANCE hInstance, _In_ DWORD reason, _In_opt_ void
 
 STDAPI DllGetActivationFactory(_In_ HSTRING activatibleClassId, _COM_Outptr_ IActivationFactory **factory)
 {
+    StartupTraceScope startupTraceScope{ "ActivationFactory", WindowsGetStringRawBuffer(activatibleClassId, nullptr) };
     return Module<InProc>::GetModule().GetActivationFactory(activatibleClassId, factory);
 }
 
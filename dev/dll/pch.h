@@ -51,8 +51,10 @@
 
 // STL
 #include <vector>
+#include <deque>
 #include <map>
 #include <functional>
+#include <atomic>
 
 #define _USE_MATH_DEFINES
 #include <math.h>
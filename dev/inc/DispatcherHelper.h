@@ -35,24 +35,37 @@ public:
         }
     }
 
-    void RunAsync(std::function<void()> func, bool fallbackToThisThread = false) const
+    enum class Priority
+    {
+        Idle, // Same as Low when running on a DispatcherQueue.
+        Low,
+        Normal,
+        High,
+    };
+
+    // func is moved into the dispatcher handler, so move-only callables work and captures are not copied.
+    // The handler itself is what runs when falling back to this thread.
+    template <typename F>
+    void RunAsync(F&& func, bool fallbackToThisThread = false, Priority priority = Priority::Normal) const
     {
         if (dispatcherQueue)
         {
-            auto result = dispatcherQueue.TryEnqueue(winrt::Windows::System::DispatcherQueueHandler(func));
+            winrt::Windows::System::DispatcherQueueHandler handler{ std::forward<F>(func) };
+            auto result = dispatcherQueue.TryEnqueue(GetDispatcherQueuePriority(priority), handler);
             if (!result)
             {
                 if (fallbackToThisThread)
                 {
-                    func();
+                    handler();
                 }
             }
         }
         else if (coreDispatcher)
         {
-            auto asyncOp = coreDispatcher.TryRunAsync(winrt::CoreDispatcherPriority::Normal, winrt::DispatchedHandler(func));
+            winrt::DispatchedHandler handler{ std::forward<F>(func) };
+            auto asyncOp = coreDispatcher.TryRunAsync(GetCoreDispatcherPriority(priority), handler);
 
-            asyncOp.Completed([func, fallbackToThisThread](auto& asyncInfo, auto& asyncStatus)
+            asyncOp.Completed([handler, fallbackToThisThread](auto& asyncInfo, auto& asyncStatus)
             {
                 bool reRunOnThisThread = false;
 
@@ -70,7 +83,7 @@ public:
 
                 if (reRunOnThisThread)
                 {
-                    func();
+                    handler();
                 }
             });
         }
@@ -83,7 +96,51 @@ public:
         }
     }
 
+    // Posts all of funcs as a single dispatcher item, they run in order.
+    void RunAsyncBatch(std::vector<std::function<void()>> funcs, bool fallbackToThisThread = false, Priority priority = Priority::Normal) const
+    {
+        if (!funcs.empty())
+        {
+            RunAsync([funcs = std::move(funcs)]()
+            {
+                for (auto const& func : funcs)
+                {
+                    func();
+                }
+            }, fallbackToThisThread, priority);
+        }
+    }
+
 private:
+    static winrt::Windows::System::DispatcherQueuePriority GetDispatcherQueuePriority(Priority priority)
+    {
+        switch (priority)
+        {
+        case Priority::Idle:
+        case Priority::Low:
+            return winrt::Windows::System::DispatcherQueuePriority::Low;
+        case Priority::High:
+            return winrt::Windows::System::DispatcherQueuePriority::High;
+        default:
+            return winrt::Windows::System::DispatcherQueuePriority::Normal;
+        }
+    }
+
+    static winrt::CoreDispatcherPriority GetCoreDispatcherPriority(Priority priority)
+    {
+        switch (priority)
+        {
+        case Priority::Idle:
+            return winrt::CoreDispatcherPriority::Idle;
+        case Priority::Low:
+            return winrt::CoreDispatcherPriority::Low;
+        case Priority::High:
+            return winrt::CoreDispatcherPriority::High;
+        default:
+            return winrt::CoreDispatcherPriority::Normal;
+        }
+    }
+
     winrt::Windows::System::DispatcherQueue dispatcherQueue{ nullptr };
     winrt::CoreDispatcher coreDispatcher{ nullptr };
 };
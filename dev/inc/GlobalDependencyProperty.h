@@ -41,9 +41,18 @@ struct GlobalDependencyProperty
         return static_cast<bool>(m_dependencyProperty);
     }
 
+    // OnPropertyChanged implementations dispatch by comparing args.Property() against each of their
+    // properties in turn, so this has to stay a pointer comparison. The projected operator== queries both
+    // sides for IUnknown whenever the pointers differ, i.e. for every property that doesn't match. Both
+    // sides are IDependencyProperty pointers handed out by the framework, so pointer identity is enough.
     bool operator==(winrt::DependencyProperty const& other) const
     {
-        return Property() == other;
+        return m_dependencyProperty == static_cast<IUnknown*>(winrt::get_abi(other));
+    }
+
+    bool operator!=(winrt::DependencyProperty const& other) const
+    {
+        return !(*this == other);
     }
 
     bool operator==(nullptr_t) const
@@ -64,3 +73,14 @@ private:
 
     IUnknown* m_dependencyProperty{};
 };
+
+// Lets 'args.Property() == s_FooProperty' use the comparison above instead of converting to winrt::DependencyProperty.
+inline bool operator==(winrt::DependencyProperty const& left, GlobalDependencyProperty const& right)
+{
+    return right == left;
+}
+
+inline bool operator!=(winrt::DependencyProperty const& left, GlobalDependencyProperty const& right)
+{
+    return !(right == left);
+}
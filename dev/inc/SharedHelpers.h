@@ -57,6 +57,8 @@ public:
 
     static bool IsThemeShadowAvailable();
 
+    static bool IsBitmapIconShowAsMonochromeAvailable();
+
     // Actual OS version checks
     static bool IsAPIContractV9Available(); // 19H2
     static bool IsAPIContractV8Available(); // 19H1
@@ -292,6 +294,8 @@ private:
     SharedHelpers() {}
 
     template <uint16_t APIVersion> static bool IsAPIContractVxAvailable();
+    static uint16_t GetUniversalApiContractVersion();
+    static constexpr uint16_t c_highestKnownApiContractVersion = 9;
 
     static bool s_isOnXboxInitialized;
     static bool s_isOnXbox;
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <set>
+#include <vector>
 
 //
 // This is simple event implementation that is single-threaded and allows for customization of
@@ -16,7 +18,9 @@ template <typename ImplT, typename T, typename StorageT = T>
 class event_base
 {
 protected:
-    std::shared_ptr<std::map<int64_t, StorageT>> m_handlers;
+    // Handlers in subscription order, which is also token order since tokens only grow.
+    using handler_list = std::vector<std::pair<int64_t, StorageT>>;
+    std::shared_ptr<handler_list> m_handlers;
 
 public:
 
@@ -32,46 +36,35 @@ public:
     winrt::event_token add(const T & value)
     {
         auto token = InterlockedIncrement64(&s_eventHandlerId);
-        
-        // Make a new map because add/remove during event call-out can happen and we want to
-        // swap in a new container instead of modifying the one that we're iterating over.
-        // This is a tradeoff -- either we copy the map every time during invoke in case add/remove
-        // happens or we make a new copy during add/remove. We (and the C++/WinRT implementation
-        // we're copied from) choose the latter.
-        auto handlers = std::make_shared<std::map<int64_t, StorageT>>();
-
-        if (auto * before = m_handlers.get())
-        {
-            handlers->insert(before->begin(), before->end());
-        }
-        
         auto holder = Impl()->wrap(value);
-        handlers->insert({ token, holder });
-        m_handlers = std::move(handlers);
+        EnsureWritableHandlers()->emplace_back(token, holder);
         return winrt::event_token{ token };
     }
 
     void remove(const winrt::event_token token)
     {
-        // See comment in add(), we make a copy of the map on add/remove just like the C++/WinRT event implementation.
-        auto handlers = std::make_shared<std::map<int64_t, StorageT>>();
-
-        if (auto * before = m_handlers.get())
+        if (m_handlers)
         {
-            handlers->insert(before->begin(), before->end());
+            auto const& handlers = *m_handlers;
+            auto it = std::lower_bound(handlers.begin(), handlers.end(), token.value, [](const auto& entry, int64_t value) { return entry.first < value; });
+            if (it != handlers.end() && it->first == token.value)
+            {
+                auto index = it - handlers.begin();
+                auto writableHandlers = EnsureWritableHandlers();
+                writableHandlers->erase(writableHandlers->begin() + index);
+            }
         }
-
-        handlers->erase(token.value);
-        m_handlers = std::move(handlers);
     }
 
     template <typename... A> void operator()(A const & ... args) const
     {
+        // Holding a reference to the list makes add/remove during the call-out copy it instead
+        // of modifying the one that we're iterating over.
         auto handlers = m_handlers;
 
-        if (auto * map = handlers.get())
+        if (auto * list = handlers.get())
         {
-            for (const auto & pair : *map)
+            for (const auto & pair : *list)
             {
                 auto handler = Impl()->unwrap(pair.second);
                 handler(args...);
@@ -85,6 +78,25 @@ public:
     }
 
 private:
+    // Add/remove update the list in place unless an invocation in progress still holds it, in
+    // which case they swap in a copy, so subscribing and unsubscribing outside of call-outs
+    // doesn't allocate once the list has grown.
+    handler_list* EnsureWritableHandlers()
+    {
+        if (!m_handlers)
+        {
+            m_handlers = std::make_shared<handler_list>();
+            m_handlers->reserve(c_initialHandlerCapacity);
+        }
+        else if (m_handlers.use_count() > 1)
+        {
+            m_handlers = std::make_shared<handler_list>(*m_handlers);
+        }
+        return m_handlers.get();
+    }
+
+    static constexpr size_t c_initialHandlerCapacity = 2;
+
     const ImplT* Impl() const { return static_cast<const ImplT*>(this); }
 };
 
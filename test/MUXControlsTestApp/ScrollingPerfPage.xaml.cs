@@ -0,0 +1,379 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using Windows.Data.Json;
+using Windows.Foundation.Metadata;
+using Windows.Storage;
+using Windows.System;
+using Windows.System.Diagnostics;
+using Windows.UI.Xaml;
+using Windows.UI.Xaml.Controls;
+using Windows.UI.Xaml.Media;
+
+#if !BUILD_WINDOWS
+using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
+using NavigationView = Microsoft.UI.Xaml.Controls.NavigationView;
+using NavigationViewItem = Microsoft.UI.Xaml.Controls.NavigationViewItem;
+using NavigationViewPaneDisplayMode = Microsoft.UI.Xaml.Controls.NavigationViewPaneDisplayMode;
+using TreeView = Microsoft.UI.Xaml.Controls.TreeView;
+using TreeViewNode = Microsoft.UI.Xaml.Controls.TreeViewNode;
+#endif
+
+namespace MUXControlsTestApp
+{
+    public class ScrollingPerfTemplateSelector : DataTemplateSelector
+    {
+        public DataTemplate SmallTemplate { get; set; }
+        public DataTemplate LargeTemplate { get; set; }
+
+        protected override DataTemplate SelectTemplateCore(object item)
+        {
+            return (item is int && (int)item % 5 == 0) ? LargeTemplate : SmallTemplate;
+        }
+    }
+
+    public class ScrollingPerfGroup
+    {
+        public string Name { get; set; }
+        public List<int> Items { get; set; }
+    }
+
+    // Scripted scrolling scenarios whose frame time, memory and CPU measurements are written out as json
+    // so that runs can be compared over time. Each run builds its scenario from scratch, waits for it to
+    // settle, then performs a fixed sequence of animated flings on the scenario's main ScrollViewer.
+    public sealed partial class ScrollingPerfPage : TestPage
+    {
+        private const string ResultsFileName = "ScrollingPerfResults.json";
+        private const int FlingCount = 6;
+        private const double SlowFrameThresholdInMilliseconds = 33.4;
+        private static readonly TimeSpan FlingTimeout = TimeSpan.FromSeconds(10);
+
+        private readonly Dictionary<string, Func<FrameworkElement>> _scenarios;
+        private readonly List<double> _frameTimes = new List<double>();
+        private TimeSpan _lastRenderingTime = TimeSpan.Zero;
+        private ulong _peakMemoryUsage = 0;
+
+        public ScrollingPerfPage()
+        {
+            this.InitializeComponent();
+
+            _scenarios = new Dictionary<string, Func<FrameworkElement>>()
+            {
+                { "ItemsRepeaterMixedTemplates", CreateItemsRepeaterScenario },
+                { "ItemsRepeaterNestedGroups", CreateNestedRepeatersScenario },
+                { "TreeViewLargeHierarchy", CreateTreeViewScenario },
+                { "NavigationViewManyItems", CreateNavigationViewScenario },
+                { "RevealAcrylicShell", CreateRevealAcrylicScenario },
+            };
+
+            foreach (string name in _scenarios.Keys)
+            {
+                cmbScenario.Items.Add(name);
+            }
+            cmbScenario.SelectedIndex = 0;
+        }
+
+        private async void BtnRunScenario_Click(object sender, RoutedEventArgs e)
+        {
+            await RunScenariosAsync(new string[] { (string)cmbScenario.SelectedItem });
+        }
+
+        private async void BtnRunAllScenarios_Click(object sender, RoutedEventArgs e)
+        {
+            await RunScenariosAsync(_scenarios.Keys.ToArray());
+        }
+
+        private async Task RunScenariosAsync(IEnumerable<string> scenarioNames)
+        {
+            btnRunScenario.IsEnabled = false;
+            btnRunAllScenarios.IsEnabled = false;
+
+            JsonArray scenarioResults = new JsonArray();
+            try
+            {
+                foreach (string name in scenarioNames)
+                {
+                    txtStatus.Text = "Running " + name;
+                    scenarioResults.Add(await RunScenarioAsync(name));
+                }
+
+                JsonObject results = new JsonObject();
+                results["timestamp"] = JsonValue.CreateStringValue(DateTimeOffset.Now.ToString("o"));
+                results["scenarios"] = scenarioResults;
+                txtResults.Text = results.Stringify();
+
+                StorageFile file = await ApplicationData.Current.LocalFolder.CreateFileAsync(ResultsFileName, CreationCollisionOption.ReplaceExisting);
+                await FileIO.WriteTextAsync(file, txtResults.Text);
+                txtStatus.Text = "Done";
+            }
+            catch (Exception ex)
+            {
+                txtResults.Text = ex.ToString();
+                txtStatus.Text = "Failed";
+            }
+            finally
+            {
+                scenarioHost.Child = null;
+                btnRunScenario.IsEnabled = true;
+                btnRunAllScenarios.IsEnabled = true;
+            }
+        }
+
+        private async Task<JsonObject> RunScenarioAsync(string name)
+        {
+            scenarioHost.Child = null;
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+
+            ulong memoryBefore = MemoryManager.AppMemoryUsage;
+            DateTimeOffset loadStart = DateTimeOffset.Now;
+            FrameworkElement content = _scenarios[name]();
+            scenarioHost.Child = content;
+            await WaitForFramesAsync(10);
+            double loadTime = (DateTimeOffset.Now - loadStart).TotalMilliseconds;
+
+            ScrollViewer scrollViewer = FindMainScrollViewer(content);
+            if (scrollViewer == null)
+            {
+                throw new InvalidOperationException("No scrollable ScrollViewer found in scenario " + name);
+            }
+
+            _frameTimes.Clear();
+            _lastRenderingTime = TimeSpan.Zero;
+            _peakMemoryUsage = MemoryManager.AppMemoryUsage;
+            TimeSpan cpuTimeBefore = GetProcessCpuTime();
+            DateTimeOffset flingsStart = DateTimeOffset.Now;
+
+            CompositionTarget.Rendering += CompositionTarget_Rendering;
+            try
+            {
+                for (int fling = 0; fling < FlingCount; fling++)
+                {
+                    // Alternate flings towards the end and back to the start, going a bit further each time.
+                    double distance = scrollViewer.ViewportHeight * (fling / 2 + 1) * 10;
+                    double target = fling % 2 == 0 ?
+                        Math.Min(scrollViewer.VerticalOffset + distance, scrollViewer.ScrollableHeight) :
+                        0.0;
+                    await FlingAsync(scrollViewer, target);
+                    _peakMemoryUsage = Math.Max(_peakMemoryUsage, MemoryManager.AppMemoryUsage);
+                }
+            }
+            finally
+            {
+                CompositionTarget.Rendering -= CompositionTarget_Rendering;
+            }
+
+            double flingsDuration = (DateTimeOffset.Now - flingsStart).TotalMilliseconds;
+            double cpuTime = (GetProcessCpuTime() - cpuTimeBefore).TotalMilliseconds;
+
+            JsonObject result = new JsonObject();
+            result["name"] = JsonValue.CreateStringValue(name);
+            result["loadTimeInMilliseconds"] = JsonValue.CreateNumberValue(loadTime);
+            result["frames"] = GetFrameTimeStatistics();
+            result["memoryBeforeInBytes"] = JsonValue.CreateNumberValue(memoryBefore);
+            result["peakMemoryInBytes"] = JsonValue.CreateNumberValue(_peakMemoryUsage);
+            result["cpuTimeInMilliseconds"] = JsonValue.CreateNumberValue(cpuTime);
+            result["cpuUtilization"] = JsonValue.CreateNumberValue(flingsDuration > 0 ? cpuTime / flingsDuration / Environment.ProcessorCount : 0.0);
+            return result;
+        }
+
+        private void CompositionTarget_Rendering(object sender, object e)
+        {
+            TimeSpan renderingTime = ((RenderingEventArgs)e).RenderingTime;
+
+            // Rendering can be raised more than once per frame; only distinct frames are counted.
+            if (renderingTime != _lastRenderingTime)
+            {
+                if (_lastRenderingTime != TimeSpan.Zero)
+                {
+                    _frameTimes.Add((renderingTime - _lastRenderingTime).TotalMilliseconds);
+                }
+                _lastRenderingTime = renderingTime;
+            }
+        }
+
+        private JsonObject GetFrameTimeStatistics()
+        {
+            List<double> sorted = _frameTimes.OrderBy(t => t).ToList();
+            JsonObject frames = new JsonObject();
+            frames["count"] = JsonValue.CreateNumberValue(sorted.Count);
+            frames["meanInMilliseconds"] = JsonValue.CreateNumberValue(sorted.Count > 0 ? sorted.Average() : 0.0);
+            frames["p50InMilliseconds"] = JsonValue.CreateNumberValue(GetPercentile(sorted, 0.5));
+            frames["p95InMilliseconds"] = JsonValue.CreateNumberValue(GetPercentile(sorted, 0.95));
+            frames["p99InMilliseconds"] = JsonValue.CreateNumberValue(GetPercentile(sorted, 0.99));
+            frames["maxInMilliseconds"] = JsonValue.CreateNumberValue(sorted.Count > 0 ? sorted.Last() : 0.0);
+            frames["slowFrameCount"] = JsonValue.CreateNumberValue(sorted.Count(t => t > SlowFrameThresholdInMilliseconds));
+            return frames;
+        }
+
+        private static double GetPercentile(List<double> sorted, double percentile)
+        {
+            if (sorted.Count == 0)
+            {
+                return 0.0;
+            }
+            int index = (int)Math.Ceiling(percentile * sorted.Count) - 1;
+            return sorted[Math.Max(0, Math.Min(index, sorted.Count - 1))];
+        }
+
+        private static TimeSpan GetProcessCpuTime()
+        {
+            if (!ApiInformation.IsTypePresent("Windows.System.Diagnostics.ProcessDiagnosticInfo"))
+            {
+                return TimeSpan.Zero;
+            }
+
+            ProcessCpuUsageReport report = ProcessDiagnosticInfo.GetForCurrentProcess().CpuUsage.GetReport();
+            return report.UserTime + report.KernelTime;
+        }
+
+        private static async Task FlingAsync(ScrollViewer scrollViewer, double verticalOffset)
+        {
+            var viewChangeCompleted = new TaskCompletionSource<bool>();
+            EventHandler<ScrollViewerViewChangedEventArgs> viewChangedHandler = (sender, args) =>
+            {
+                if (!args.IsIntermediate)
+                {
+                    viewChangeCompleted.TrySetResult(true);
+                }
+            };
+
+            scrollViewer.ViewChanged += viewChangedHandler;
+            try
+            {
+                if (!scrollViewer.ChangeView(null, verticalOffset, null, false /*disableAnimation*/))
+                {
+                    return;
+                }
+                // No ViewChanged is raised when the ScrollViewer is already at the requested offset.
+                await Task.WhenAny(viewChangeCompleted.Task, Task.Delay(FlingTimeout));
+            }
+            finally
+            {
+                scrollViewer.ViewChanged -= viewChangedHandler;
+            }
+        }
+
+        private static Task WaitForFramesAsync(int frameCount)
+        {
+            var framesRendered = new TaskCompletionSource<bool>();
+            int remainingFrames = frameCount;
+            EventHandler<object> renderingHandler = null;
+            renderingHandler = (sender, args) =>
+            {
+                if (--remainingFrames == 0)
+                {
+                    CompositionTarget.Rendering -= renderingHandler;
+                    framesRendered.TrySetResult(true);
+                }
+            };
+            CompositionTarget.Rendering += renderingHandler;
+            return framesRendered.Task;
+        }
+
+        // Scenarios like NavigationView contain several ScrollViewers, the one with the most content is the one to fling.
+        private static ScrollViewer FindMainScrollViewer(DependencyObject root)
+        {
+            ScrollViewer mainScrollViewer = null;
+            var pending = new Queue<DependencyObject>();
+            pending.Enqueue(root);
+
+            while (pending.Count > 0)
+            {
+                DependencyObject current = pending.Dequeue();
+                ScrollViewer scrollViewer = current as ScrollViewer;
+                if (scrollViewer != null && scrollViewer.ScrollableHeight > 0 &&
+                    (mainScrollViewer == null || scrollViewer.ScrollableHeight > mainScrollViewer.ScrollableHeight))
+                {
+                    mainScrollViewer = scrollViewer;
+                }
+
+                int childrenCount = VisualTreeHelper.GetChildrenCount(current);
+                for (int i = 0; i < childrenCount; i++)
+                {
+                    pending.Enqueue(VisualTreeHelper.GetChild(current, i));
+                }
+            }
+
+            return mainScrollViewer;
+        }
+
+        private FrameworkElement CreateItemsRepeaterScenario()
+        {
+            return new ScrollViewer()
+            {
+                Content = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 100000).ToList(),
+                    ItemTemplate = Resources["MixedTemplateSelector"]
+                }
+            };
+        }
+
+        private FrameworkElement CreateNestedRepeatersScenario()
+        {
+            var groups = Enumerable.Range(0, 1000).Select(i => new ScrollingPerfGroup()
+            {
+                Name = "Group " + i,
+                Items = Enumerable.Range(i * 50, 50).ToList()
+            }).ToList();
+
+            return new ScrollViewer()
+            {
+                Content = new ItemsRepeater()
+                {
+                    ItemsSource = groups,
+                    ItemTemplate = Resources["GroupTemplate"]
+                }
+            };
+        }
+
+        private FrameworkElement CreateTreeViewScenario()
+        {
+            var treeView = new TreeView();
+            for (int i = 0; i < 500; i++)
+            {
+                var node = new TreeViewNode() { Content = "Node " + i, IsExpanded = true };
+                for (int j = 0; j < 99; j++)
+                {
+                    node.Children.Add(new TreeViewNode() { Content = "Node " + i + "." + j });
+                }
+                treeView.RootNodes.Add(node);
+            }
+            return treeView;
+        }
+
+        private FrameworkElement CreateNavigationViewScenario()
+        {
+            var navigationView = new NavigationView()
+            {
+                PaneDisplayMode = NavigationViewPaneDisplayMode.Left,
+                IsPaneOpen = true,
+                IsSettingsVisible = false
+            };
+            for (int i = 0; i < 500; i++)
+            {
+                navigationView.MenuItems.Add(new NavigationViewItem() { Content = "Menu item " + i, Icon = new SymbolIcon(Symbol.Home) });
+            }
+            return navigationView;
+        }
+
+        private FrameworkElement CreateRevealAcrylicScenario()
+        {
+            var shell = new Grid() { Background = (Brush)Resources["ShellAcrylicBrush"] };
+            shell.Children.Add(new ScrollViewer()
+            {
+                Content = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 5000).ToList(),
+                    ItemTemplate = Resources["RevealItemTemplate"]
+                }
+            });
+            return shell;
+        }
+    }
+}
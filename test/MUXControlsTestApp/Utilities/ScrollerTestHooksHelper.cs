@@ -126,6 +126,21 @@ namespace MUXControlsTestApp.Utilities
             }
         }
 
+        // Returns True while the Scroller keeps the XAML render loop alive to tick its pending view changes.
+        public static bool IsCompositionTargetRenderingHooked(Scroller scroller)
+        {
+            return ScrollerTestHooks.IsCompositionTargetRenderingHooked(scroller);
+        }
+
+        // Returns the smoothness metrics the Scroller recorded for its latest completed interaction or view change.
+        public static void GetLatestInteractionMetrics(Scroller scroller, out int valuesChangedCount, out int inertiaFrameCount, out int missedFrameCount, out double firstValuesChangedLatencyInMilliseconds)
+        {
+            ScrollerTestHooks.GetLatestInteractionMetrics(scroller, out valuesChangedCount, out inertiaFrameCount, out missedFrameCount, out firstValuesChangedLatencyInMilliseconds);
+
+            Log.Comment("ScrollerTestHooksHelper: ValuesChangedCount={0}, InertiaFrameCount={1}, MissedFrameCount={2}, FirstValuesChangedLatencyInMilliseconds={3}",
+                valuesChangedCount, inertiaFrameCount, missedFrameCount, firstValuesChangedLatencyInMilliseconds);
+        }
+
         public static void LogInteractionSources(CompositionInteractionSourceCollection interactionSources)
         {
             if (interactionSources == null)
@@ -673,6 +673,16 @@ public:
             // EnsureProperties
             sb.AppendLine(String.Format("void {0}Properties::EnsureProperties()", ownerType.Name));
             sb.AppendLine("{");
+            if (props.Count > 0)
+            {
+                // Each instance constructor calls EnsureProperties, so skip the per-property checks once everything is registered.
+                sb.AppendLine("    // Properties are registered in order, once the last one is they all are.");
+                sb.AppendLine(String.Format("    if (s_{0}Property)", props.Last().Name));
+                sb.AppendLine("    {");
+                sb.AppendLine("        return;");
+                sb.AppendLine("    }");
+                sb.AppendLine();
+            }
             if (baseTypeIsInComponent)
             {
                 sb.AppendLine(String.Format("    {0}::EnsureProperties();", baseType.Name));